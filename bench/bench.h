@@ -0,0 +1,46 @@
+#ifndef BENCH_H
+#define BENCH_H
+
+// Helpers shared by the benchmarks in this directory
+
+#include "ballworld.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <random>
+
+// Wall-clock time in milliseconds
+inline double
+nowMs()
+{
+	using namespace std::chrono;
+	return duration<double, std::milli>(steady_clock::now().time_since_epoch()).count();
+}
+
+// Number of balls from the first command line argument, or the default
+inline int
+ballCount(int argc, char** argv, int defaultCount)
+{
+	return argc > 1 ? std::atoi(argv[1]) : defaultCount;
+}
+
+// Scatter n balls over the room with random velocities of the same order
+// as the impulse given to the ball in run.cpp. Always the same for one seed.
+inline void
+fillRandom(BallWorld& world, int n, float radius, unsigned seed = 1)
+{
+	std::mt19937 rng(seed);
+	const Room& room = world.room;
+	std::uniform_real_distribution<float> px(room.walls[leftWall] + radius, room.walls[rightWall] - radius);
+	std::uniform_real_distribution<float> py(room.ground + radius, room.ground + 4.0f);
+	std::uniform_real_distribution<float> pz(room.walls[farWall] + radius, room.walls[nearWall] - radius);
+	std::uniform_real_distribution<float> v(-0.03f, 0.03f);
+
+	world.clear();
+	world.reserve(n);
+	for (int i = 0; i < n; i++) {
+		world.addBall(glm::vec3(px(rng), py(rng), pz(rng)), glm::vec3(v(rng), v(rng), v(rng)), radius);
+	}
+}
+
+#endif // BENCH_H
@@ -0,0 +1,104 @@
+// Compares one BallWorld::step() over structure-of-arrays storage with the
+// same rules applied to an array of glm::vec3 based structs.
+
+#include "bench.h"
+
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+struct Ball
+{
+	glm::vec3 position;
+	glm::vec3 velocity;
+	float radius;
+	bool rest;
+};
+
+// Same as BallWorld::step(), one struct per ball
+static void
+stepAoS(std::vector<Ball>& balls, float gravity, const Room& room)
+{
+	const int n = int(balls.size());
+	for (int i = 0; i < n; i++) {
+		Ball& b = balls[i];
+		if (b.rest) {
+			continue;
+		}
+
+		b.position += b.velocity;
+		b.position.y += gravity;
+
+		if (b.position.y <= room.ground + b.radius) {
+			b.position.y = room.ground + b.radius;
+			b.velocity.y = -b.velocity.y;
+			if (std::abs(b.velocity.y) <= std::abs(gravity)) {
+				b.rest = true;
+				b.velocity = glm::vec3(0, 0, 0);
+			}
+		}
+		if (b.position.x >= room.walls[rightWall] - b.radius) {
+			b.position.x = room.walls[rightWall] - b.radius;
+			b.velocity.x = -b.velocity.x;
+		}
+		else if (b.position.x <= room.walls[leftWall] + b.radius) {
+			b.position.x = room.walls[leftWall] + b.radius;
+			b.velocity.x = -b.velocity.x;
+		}
+		if (b.position.z >= room.walls[nearWall] - b.radius) {
+			b.position.z = room.walls[nearWall] - b.radius;
+			b.velocity.z = -b.velocity.z;
+		}
+		else if (b.position.z <= room.walls[farWall] + b.radius) {
+			b.position.z = room.walls[farWall] + b.radius;
+			b.velocity.z = -b.velocity.z;
+		}
+
+		b.velocity.y += gravity;
+	}
+}
+
+int
+main(int argc, char** argv)
+{
+	const int n = ballCount(argc, argv, 1000000);
+	const int steps = 200;
+
+	BallWorld world;
+	fillRandom(world, n, 0.05f);
+
+	std::vector<Ball> balls(n);
+	for (int i = 0; i < n; i++) {
+		balls[i].position = world.position(i);
+		balls[i].velocity = world.velocity(i);
+		balls[i].radius = world.radius[i];
+		balls[i].rest = false;
+	}
+
+	double start = nowMs();
+	for (int s = 0; s < steps; s++) {
+		world.step();
+	}
+	double soaMs = nowMs() - start;
+
+	start = nowMs();
+	for (int s = 0; s < steps; s++) {
+		stepAoS(balls, world.gravity, world.room);
+	}
+	double aosMs = nowMs() - start;
+
+	// Both layouts must end up in exactly the same place
+	int mismatches = 0;
+	for (int i = 0; i < n; i++) {
+		if (world.position(i) != balls[i].position) {
+			mismatches++;
+		}
+	}
+
+	printf("%d balls, %d steps\n", n, steps);
+	printf("SoA: %8.3f ms/step  %6.2f ns/ball\n", soaMs / steps, soaMs * 1e6 / (double(steps) * n));
+	printf("AoS: %8.3f ms/step  %6.2f ns/ball\n", aosMs / steps, aosMs * 1e6 / (double(steps) * n));
+	printf("speedup: %.2fx, mismatches: %d\n", aosMs / soaMs, mismatches);
+
+	return mismatches == 0 ? 0 : 1;
+}
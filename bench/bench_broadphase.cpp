@@ -0,0 +1,143 @@
+// Times the broadphases on growing numbers of balls, both spread over the
+// room and all lying on the ground, and checks that they find the same pairs
+// as each other and as the plain O(n^2) test on the smaller worlds.
+
+#include "bench.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+static const char* broadphaseNames[NumBroadphases] = { "grid", "sweep+prune" };
+
+static bool
+operator<(const BallPair& l, const BallPair& r)
+{
+	return l.a < r.a || (l.a == r.a && l.b < r.b);
+}
+
+static void
+bruteForcePairs(const BallWorld& world, std::vector<BallPair>& pairs)
+{
+	pairs.clear();
+	const int n = world.size();
+	for (int a = 0; a < n; a++) {
+		for (int b = a + 1; b < n; b++) {
+			float dx = world.x[b] - world.x[a];
+			float dy = world.y[b] - world.y[a];
+			float dz = world.z[b] - world.z[a];
+			float reach = world.radius[a] + world.radius[b];
+			if (dx * dx + dy * dy + dz * dz < reach * reach) {
+				BallPair pair = { a, b };
+				pairs.push_back(pair);
+			}
+		}
+	}
+}
+
+static bool
+samePairs(std::vector<BallPair> l, std::vector<BallPair> r)
+{
+	std::sort(l.begin(), l.end());
+	std::sort(r.begin(), r.end());
+	if (l.size() != r.size()) {
+		return false;
+	}
+	for (size_t i = 0; i < l.size(); i++) {
+		if (l[i].a != r[i].a || l[i].b != r[i].b) {
+			return false;
+		}
+	}
+	return true;
+}
+
+// About 5% of the room filled whatever the count
+static void
+fillSpread(BallWorld& world, int n)
+{
+	fillRandom(world, n, 0.25f * std::cbrt(64.0f / n));
+}
+
+// One layer of balls that have come to rest, covering half of the ground
+static void
+fillResting(BallWorld& world, int n)
+{
+	const Room& room = world.room;
+	const float width = room.walls[rightWall] - room.walls[leftWall];
+	const float depth = room.walls[nearWall] - room.walls[farWall];
+	const float radius = std::sqrt(0.5f * width * depth / (3.1415926f * n));
+
+	fillRandom(world, n, radius);
+	for (int i = 0; i < n; i++) {
+		world.y[i] = room.ground + radius;
+		world.vx[i] = 0.0f;
+		world.vy[i] = world.gravity;
+		world.vz[i] = 0.0f;
+		world.restFlag[i] = 1;
+	}
+}
+
+int
+main(int argc, char** argv)
+{
+	const int maxBalls = ballCount(argc, argv, 100000);
+	const int bruteForceLimit = 20000;
+	const int steps = 5;
+	bool ok = true;
+
+	struct Scene { const char* name; void (*fill)(BallWorld&, int); };
+	const Scene scenes[] = { { "spread", fillSpread }, { "resting", fillResting } };
+
+	printf("%-8s %10s %12s %10s %12s %14s\n", "scene", "balls", "broadphase", "pairs", "ms/step", "sort swaps");
+
+	for (int n = 1000; n <= maxBalls; n *= 10) {
+		for (int s = 0; s < 2; s++) {
+			BallWorld initial;
+			scenes[s].fill(initial, n);
+
+			// Same pairs from every method on the first step
+			std::vector<BallPair> expected, pairs;
+			initial.grid.build(initial);
+			initial.grid.findPairs(expected);
+			initial.sweepAndPrune.build(initial);
+			initial.sweepAndPrune.findPairs(pairs);
+			if (!samePairs(pairs, expected)) {
+				printf("sweep and prune differs from the grid: %s, %d balls\n", scenes[s].name, n);
+				ok = false;
+			}
+			if (n <= bruteForceLimit) {
+				bruteForcePairs(initial, pairs);
+				if (!samePairs(pairs, expected)) {
+					printf("grid differs from O(n^2): %s, %d balls\n", scenes[s].name, n);
+					ok = false;
+				}
+			}
+
+			for (int type = 0; type < NumBroadphases; type++) {
+				BallWorld world = initial;
+				world.broadphaseType = BroadphaseType(type);
+				Broadphase& bp = world.broadphase();
+				bp.build(world); // the first build has nothing to be coherent with
+
+				// Same as BallWorld::step() with collideBalls, timing only the broadphase
+				double total = 0.0;
+				long long swaps = 0;
+				for (int k = 0; k < steps; k++) {
+					world.step();
+					double start = nowMs();
+					bp.build(world);
+					bp.findPairs(pairs);
+					total += nowMs() - start;
+					world.resolveContacts(pairs);
+					swaps += world.sweepAndPrune.lastSwaps();
+				}
+
+				printf("%-8s %10d %12s %10d %12.3f %14lld\n", scenes[s].name, n, broadphaseNames[type],
+					int(pairs.size()), total / steps, type == SweepAndPruneBroadphase ? swaps / steps : 0);
+			}
+		}
+	}
+
+	return ok ? 0 : 1;
+}
@@ -0,0 +1,83 @@
+// Runs the same fast balls for a fixed stretch of simulated time with
+// continuous collision detection at growing timesteps, and with the
+// discrete step(), and reports cost and drift from the finest run.
+// step() adds a full step of gravity to the position instead of following
+// the arc, so part of its drift is the model and part is the time lost by
+// clamping to the walls.
+
+#include "bench.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <random>
+
+// Balls fast enough to cross the room in a few steps
+static void
+fillFast(BallWorld& world, int n)
+{
+	fillRandom(world, n, 0.05f);
+	std::mt19937 rng(2);
+	std::uniform_real_distribution<float> v(-0.5f, 0.5f);
+	for (int i = 0; i < n; i++) {
+		world.vx[i] = v(rng);
+		world.vy[i] = v(rng);
+		world.vz[i] = v(rng);
+	}
+}
+
+static void
+report(const char* method, float dt, int steps, double ms, int n, int ticks,
+	const BallWorld& world, const BallWorld& reference)
+{
+	double sum = 0.0, worst = 0.0;
+	for (int i = 0; i < n; i++) {
+		double e = glm::length(world.position(i) - reference.position(i));
+		sum += e;
+		worst = std::max(worst, e);
+	}
+	printf("%-10s %6.2f %8d %10.3f %12.2f %12.5f %12.5f\n", method, dt, steps, ms,
+		ms * 1e6 / (double(n) * ticks), sum / n, worst);
+}
+
+int
+main(int argc, char** argv)
+{
+	const int n = ballCount(argc, argv, 100000);
+	const int ticks = 256; // simulated time, in steps of update()
+
+	BallWorld initial;
+	fillFast(initial, n);
+
+	// Finest continuous run is the reference
+	BallWorld reference = initial;
+	const float finest = 0.25f;
+	double start = nowMs();
+	for (int s = 0; s < int(ticks / finest); s++) {
+		reference.stepContinuous(finest);
+	}
+	double referenceMs = nowMs() - start;
+
+	printf("%d balls, %d ticks\n", n, ticks);
+	printf("%-10s %6s %8s %10s %12s %12s %12s\n", "method", "dt", "steps", "ms", "ns/ball/tick", "mean error", "max error");
+	report("continuous", finest, int(ticks / finest), referenceMs, n, ticks, reference, reference);
+
+	for (float dt = 1.0f; dt <= 32.0f; dt *= 2.0f) {
+		BallWorld world = initial;
+		const int steps = int(ticks / dt);
+		start = nowMs();
+		for (int s = 0; s < steps; s++) {
+			world.stepContinuous(dt);
+		}
+		report("continuous", dt, steps, nowMs() - start, n, ticks, world, reference);
+	}
+
+	BallWorld world = initial;
+	start = nowMs();
+	for (int s = 0; s < ticks; s++) {
+		world.step();
+	}
+	report("discrete", 1.0f, ticks, nowMs() - start, n, ticks, world, reference);
+
+	return 0;
+}
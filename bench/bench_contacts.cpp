@@ -0,0 +1,128 @@
+// Piles of balls resting on the ground and on each other, held up by the
+// pairwise contacts and by the contact solver at a few sweep counts, cold
+// and warm started. After the piles had time to settle, reports the cost
+// of a step, how deep the balls sink into each other, how much they still
+// jiggle, and how tall the stacks stand compared to balls just touching.
+
+#include "bench.h"
+
+#include <cmath>
+#include <cstdio>
+
+const int SIDE = 20;     // stacks along x and z
+const int HEIGHT = 10;   // balls per stack
+const float RADIUS = 0.02f;
+
+// SIDE x SIDE stacks just touching. Without friction only a straight stack
+// stands, so the balls are right on top of each other.
+static void
+fillStacks(BallWorld& world)
+{
+	world.clear();
+	for (int i = 0; i < SIDE; i++) {
+		for (int k = 0; k < SIDE; k++) {
+			for (int level = 0; level < HEIGHT; level++) {
+				const glm::vec3 p(-0.5f + i * 3.0f * RADIUS,
+					world.room.ground + RADIUS * (1 + 2 * level),
+					-0.5f + k * 3.0f * RADIUS);
+				world.addBall(p, glm::vec3(0.0f), RADIUS);
+			}
+		}
+	}
+}
+
+// Total overlap of the touching pairs over their number
+static double
+meanOverlap(const BallWorld& world, double& maxOverlap)
+{
+	double sum = 0.0;
+	maxOverlap = 0.0;
+	for (size_t k = 0; k < world.pairs.size(); k++) {
+		const int a = world.pairs[k].a, b = world.pairs[k].b;
+		const double depth = world.radius[a] + world.radius[b] - glm::length(world.position(b) - world.position(a));
+		sum += std::max(depth, 0.0);
+		maxOverlap = std::max(maxOverlap, depth);
+	}
+	return world.pairs.empty() ? 0.0 : sum / world.pairs.size();
+}
+
+// Height of the top balls of the stacks over the height they have just touching
+static double
+stackHeight(const BallWorld& world)
+{
+	double sum = 0.0;
+	for (int s = 0; s < SIDE * SIDE; s++) {
+		sum += world.y[s * HEIGHT + HEIGHT - 1] - world.room.ground;
+	}
+	return sum / (SIDE * SIDE) / (RADIUS * (2 * HEIGHT - 1));
+}
+
+static void
+run(const char* name, BallWorld world, ContactSolverType solver, int iterations, bool warm, bool stacks)
+{
+	const int settle = 600, measure = 200;
+	world.contactSolver = solver;
+	world.solverIterations = iterations;
+	world.warmStart = warm;
+	for (int s = 0; s < settle; s++) {
+		world.step();
+	}
+
+	StepStats stats;
+	world.stats = &stats;
+	double kinetic = 0.0, overlap = 0.0, maxOverlap = 0.0;
+	double ms = 0.0;
+	for (int s = 0; s < measure; s++) {
+		double start = nowMs();
+		world.step();
+		ms += nowMs() - start;
+		double stepMax;
+		overlap += meanOverlap(world, stepMax);
+		maxOverlap = std::max(maxOverlap, stepMax);
+		kinetic += stats.kinetic;
+	}
+
+	printf("%-14s %10.1f %12.3g %12.3g %12.3g", name, ms * 1000.0 / measure,
+		overlap / measure / RADIUS, maxOverlap / RADIUS, kinetic / measure);
+	if (stacks) {
+		printf(" %8.3f", stackHeight(world));
+	}
+	printf("\n");
+}
+
+static void
+runAll(const BallWorld& world, bool stacks)
+{
+	printf("%-14s %10s %12s %12s %12s%s\n", "contacts", "us/step", "mean sink/r", "max sink/r", "kinetic",
+		stacks ? "   height" : "");
+	run("pairwise", world, PairwiseContacts, 1, false, stacks);
+	const int cold[] = { 1, 2, 4, 10, 30 };
+	for (int k = 0; k < 5; k++) {
+		char name[32];
+		snprintf(name, sizeof(name), "cold x%d", cold[k]);
+		run(name, world, SequentialImpulses, cold[k], false, stacks);
+	}
+	run("warm x1", world, SequentialImpulses, 1, true, stacks);
+	run("warm x2", world, SequentialImpulses, 2, true, stacks);
+	printf("\n");
+}
+
+int
+main(int argc, char** argv)
+{
+	BallWorld world;
+	world.collideBalls = true;
+	world.restitution = 0.5f;
+
+	fillStacks(world);
+	printf("%d stacks of %d balls, 600 steps to settle, then 200 measured\n", SIDE * SIDE, HEIGHT);
+	runAll(world, true);
+
+	const int n = ballCount(argc, argv, 6000);
+	world.room.walls[leftWall] = world.room.walls[farWall] = -1.0f;
+	world.room.walls[rightWall] = world.room.walls[nearWall] = 1.0f;
+	fillRandom(world, n, RADIUS);
+	printf("%d balls dropped into a small room\n", n);
+	runAll(world, false);
+	return 0;
+}
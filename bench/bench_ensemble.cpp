@@ -0,0 +1,67 @@
+// Runs N copies of the game ball with random start velocities until they
+// all rest, one copy at a time through stepGame() and all together as a
+// GameEnsemble. Every copy must rest at the same step in the same state.
+// Build with "make ARCHFLAGS=-mavx2" for 8 copies per instruction.
+//
+// Usage: bench_ensemble [copies]
+
+#include "bench.h"
+#include "ensemble.h"
+#include "stepkernel.h"
+
+#include <cstdio>
+
+int
+main(int argc, char** argv)
+{
+	const int n = ballCount(argc, argv, 4096);
+	const int maxSteps = 216000;
+
+	const GameConstants c = defaultConstants();
+	std::mt19937 rng(1);
+	std::uniform_real_distribution<float> v(-2 * c.impulse, 2 * c.impulse);
+	std::vector<GameState> starts(n, startState(c));
+	for (int i = 0; i < n; i++) {
+		starts[i].velocity = glm::vec3(v(rng), v(rng), v(rng));
+	}
+
+	std::vector<GameState> ends(starts);
+	std::vector<int> restSteps(n, -1);
+	double total = 0;
+	double start = nowMs();
+	for (int i = 0; i < n; i++) {
+		GameState& s = ends[i];
+		for (int step = 1; step <= maxSteps; step++) {
+			stepGame(s, c);
+			if (s.rest) {
+				restSteps[i] = step;
+				break;
+			}
+		}
+		total += restSteps[i] < 0 ? maxSteps : restSteps[i];
+	}
+	const double oneMs = nowMs() - start;
+
+	GameEnsemble ensemble(c, n);
+	for (int i = 0; i < n; i++) {
+		ensemble.setState(i, starts[i]);
+	}
+	start = nowMs();
+	const int steps = ensemble.run(maxSteps);
+	const double ensembleMs = nowMs() - start;
+
+	int mismatches = 0;
+	for (int i = 0; i < n; i++) {
+		if (ensemble.restStep(i) != restSteps[i] || hashState(ensemble.state(i)) != hashState(ends[i])) {
+			mismatches++;
+		}
+	}
+
+	printf("%d copies, %.0f copy steps, last at rest after %d steps, %s x%d\n",
+		n, total, steps, stepBallsInstructions(), stepBallsWidth());
+	printf("stepGame:  %8.2f ms  %6.2f ns/copy step\n", oneMs, oneMs * 1e6 / total);
+	printf("ensemble:  %8.2f ms  %6.2f ns/copy step\n", ensembleMs, ensembleMs * 1e6 / total);
+	printf("speedup: %.2fx, mismatches: %d\n", oneMs / ensembleMs, mismatches);
+
+	return mismatches == 0 ? 0 : 1;
+}
@@ -0,0 +1,60 @@
+// Simulates ten minutes of bouncing balls event by event and by stepping 60
+// times per simulated second, and reports how long each took and how far
+// apart they end up. Runs once at the speed of the ball in run.cpp and once
+// ten times slower, where impacts are rarer and events pay off more.
+
+#include "bench.h"
+#include "events.h"
+
+#include <algorithm>
+#include <cstdio>
+
+int
+main(int argc, char** argv)
+{
+	const int n = ballCount(argc, argv, 1000);
+	const int ticks = 60 * 60 * 10;
+
+	printf("%d balls, %d ticks\n", n, ticks);
+	printf("%-6s %10s %10s %12s %12s %14s\n", "speed", "impacts", "step() ms", "continuous", "events ms", "events error");
+
+	for (float speed = 1.0f; speed >= 0.1f; speed *= 0.1f) {
+		BallWorld initial;
+		fillRandom(initial, n, 0.5f);
+		for (int i = 0; i < n; i++) {
+			initial.vx[i] *= speed;
+			initial.vy[i] *= speed;
+			initial.vz[i] *= speed;
+		}
+
+		BallWorld stepped = initial;
+		double start = nowMs();
+		for (int s = 0; s < ticks; s++) {
+			stepped.step();
+		}
+		double stepMs = nowMs() - start;
+
+		BallWorld continuous = initial;
+		start = nowMs();
+		for (int s = 0; s < ticks; s++) {
+			continuous.stepContinuous(1.0f);
+		}
+		double continuousMs = nowMs() - start;
+
+		start = nowMs();
+		EventSimulator events(initial);
+		events.advanceTo(ticks);
+		double eventMs = nowMs() - start;
+
+		// Same model as stepContinuous(), so they should agree
+		double worst = 0.0;
+		for (int i = 0; i < n; i++) {
+			worst = std::max(worst, glm::length(events.position(i) - glm::dvec3(continuous.position(i))));
+		}
+
+		printf("%-6.1f %10lld %10.2f %12.2f %12.2f %14.6f\n", speed, events.processedEvents(),
+			stepMs, continuousMs, eventMs, worst);
+	}
+
+	return 0;
+}
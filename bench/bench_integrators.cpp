@@ -0,0 +1,107 @@
+// Runs the same balls with each integrator of game.h at growing step
+// lengths, and reports the cost of a step against how far the balls end up
+// from the exact path of the event simulator and how much their energy
+// drifted. Pick the cheapest integrator that stays accurate enough at the
+// longest step. Under the constant gravity of the game Runge-Kutta 4 takes
+// the same steps as velocity Verlet, so it has the same errors and only
+// shows what evaluating its stages costs.
+//
+// First the balls fly for about two seconds in a room too big to reach, which
+// shows the integrators alone. Then they bounce in the room of the game for
+// ten seconds and a minute, where the bounces take over: every integrator
+// meets the room the way stepGame() does, which loses energy at every
+// bounce on the ground until the ball stops.
+//
+// Usage: bench_integrators [balls]
+
+#include "bench.h"
+#include "events.h"
+#include "game.h"
+
+#include <cfloat>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+// Kinetic plus potential energy above the lowest the ball can be, per mass
+static double
+energy(const glm::dvec3& p, const glm::dvec3& v, double g, double floorY)
+{
+	return 0.5 * glm::dot(v, v) - g * (p.y - floorY);
+}
+
+template <class Integrator>
+static void
+run(const char* name, const BallWorld& world, const EventSimulator& exact, int duration)
+{
+	const int n = world.size();
+	const float r = world.radius[0];
+	GameConstants c = defaultConstants();
+	c.gravity = world.gravity;
+	c.radius = r;
+	c.room = world.room;
+	const double floorY = world.room.ground + r;
+
+	const float steps[] = { 1, 4, 16 };
+	for (size_t k = 0; k < sizeof(steps) / sizeof(steps[0]); k++) {
+		const float dt = steps[k];
+		const int count = int(duration / dt);
+
+		std::vector<GameState> balls(n, startState(c));
+		for (int i = 0; i < n; i++) {
+			balls[i].position = world.position(i);
+			balls[i].velocity = world.velocity(i);
+		}
+
+		double start = nowMs();
+		for (int i = 0; i < n; i++) {
+			for (int s = 0; s < count; s++) {
+				stepGameWith<Integrator>(balls[i], c, dt);
+			}
+		}
+		const double ms = nowMs() - start;
+
+		double positionError = 0, energyError = 0;
+		int rested = 0;
+		for (int i = 0; i < n; i++) {
+			const BallState e = exact.state(i);
+			const double e0 = energy(glm::dvec3(world.position(i)), glm::dvec3(world.velocity(i)), c.gravity, floorY);
+			const double e1 = energy(glm::dvec3(balls[i].position), glm::dvec3(balls[i].velocity), c.gravity, floorY);
+			positionError += glm::length(glm::dvec3(balls[i].position) - e.position);
+			energyError += std::abs(e1 - e0) / e0;
+			rested += balls[i].rest && !e.rest;
+		}
+		printf("%6d   %-19s %4.0f   %8.2f   %12.5f   %10.5f   %6d\n", duration, name, dt, ms * 1e6 / (double(n) * count),
+			positionError / n, energyError / n, rested);
+	}
+}
+
+int
+main(int argc, char** argv)
+{
+	const int n = ballCount(argc, argv, 1000);
+	// Steps of stepGame(), 60 a second in the window
+	const Room far = { -100.0f, { -100.0f, 100.0f, -100.0f, 100.0f }, FLT_MAX };
+	const Room rooms[] = { far, defaultRoom(), defaultRoom() };
+	const int durations[] = { 128, 640, 3584 };
+
+	BallWorld start;
+	fillRandom(start, n, 0.05f);
+
+	printf("%d balls\n", n);
+	printf("%6s   %-19s %4s   %8s   %12s   %10s   %6s\n", "steps", "integrator", "dt", "ns/step", "position err", "energy err", "rested");
+	for (size_t k = 0; k < sizeof(durations) / sizeof(durations[0]); k++) {
+		BallWorld world = start;
+		world.room = rooms[k];
+		EventSimulator exact(world);
+		exact.advanceTo(durations[k]);
+		run<ExplicitEuler>("explicit Euler", world, exact, durations[k]);
+		run<SemiImplicitEuler>("semi-implicit Euler", world, exact, durations[k]);
+		run<VelocityVerlet>("velocity Verlet", world, exact, durations[k]);
+		run<RungeKutta4>("Runge-Kutta 4", world, exact, durations[k]);
+	}
+	printf("128 steps fly without touching the room, 640 and 3584 bounce in the room of the game\n");
+	printf("position error is the mean distance to the exact path, energy error the mean relative drift,\n"
+		"rested the balls that stopped on the ground though the exact ones did not\n");
+	return 0;
+}
@@ -0,0 +1,231 @@
+// The startup cost of the meshes of the window: building them with the
+// push_back loops and sin/cos that init() in run.cpp used to run, against
+// the tables of meshes.h that the compiler has already worked out, which
+// only have to be copied out (as glBufferSubData() does). Also checks that
+// both give the same meshes, and how far the interleaved PackedVertex with
+// its 10 bit normals is from them, at 16 bytes a vertex instead of 28.
+//
+// Usage: bench_meshes [repeats]
+
+#include "bench.h"
+#include "meshes.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+const float PI = 3.1415926f;
+const float TWO_PI = PI * 2;
+
+struct BuiltMeshes
+{
+	std::vector<float> vertices, normals;
+	std::vector<unsigned> indices;
+};
+
+// makeGround() and makeWall() of run.cpp, one for both planes
+static void
+buildPlane(BuiltMeshes& m, bool wall)
+{
+	const int lastIndex = int(m.vertices.size() / 4);
+	float xPoints = 31;
+	float dx = 4.0f / xPoints;
+	float offsetX = -4.0f / 2 + dx / 2;
+	float offsetY = wall ? 2.0f : -2.0f + dx;
+	glm::vec3 n = wall ? glm::vec3(0, 0, 1) : glm::vec3(0, -1, 0);
+
+	for (int i = 0; i < xPoints; i++) {
+		for (float j = 0; j < xPoints; j++) {
+			m.vertices.push_back(j * dx + offsetX);
+			m.vertices.push_back(wall ? offsetY : i * dx + offsetY);
+			m.vertices.push_back(wall ? i * dx : 0);
+			m.vertices.push_back(1);
+			m.normals.push_back(n.x);
+			m.normals.push_back(n.y);
+			m.normals.push_back(n.z);
+		}
+	}
+	for (int i = 0; i < (round(xPoints) - 1) * round(xPoints); i++) {
+		if (i % (int)xPoints != xPoints - 1) {
+			m.indices.push_back(unsigned(lastIndex + i));
+			m.indices.push_back(unsigned(lastIndex + i + xPoints + 1));
+			m.indices.push_back(unsigned(lastIndex + i + 1));
+			m.indices.push_back(unsigned(lastIndex + i));
+			m.indices.push_back(unsigned(lastIndex + i + xPoints));
+			m.indices.push_back(unsigned(lastIndex + i + xPoints + 1));
+		}
+	}
+}
+
+// makeSphere() of run.cpp
+static void
+buildSphere(BuiltMeshes& m, float radius)
+{
+	const int lastIndex = int(m.vertices.size() / 4);
+	int circlePoints = 22;
+	int arcPoints = 15;
+
+	for (float i = 0; i <= circlePoints; i++) {
+		float phi = i / (circlePoints) * TWO_PI;
+		for (float j = 0; j < arcPoints; j++) {
+			float theta = j / (arcPoints - 1) * PI;
+			float x = radius * sin(theta) * cos(phi);
+			float y = radius * sin(theta) * sin(phi);
+			float z = radius * cos(theta);
+			m.vertices.push_back(x);
+			m.vertices.push_back(y);
+			m.vertices.push_back(z);
+			m.vertices.push_back(1.0f);
+			glm::vec3 n = normalize(glm::vec3(x, y, z));
+			m.normals.push_back(n.x);
+			m.normals.push_back(n.y);
+			m.normals.push_back(n.z);
+		}
+	}
+	int squares = arcPoints * (circlePoints)-1;
+	for (int i = 0; i <= squares; i++) {
+		if (i % arcPoints != arcPoints - 1) {
+			m.indices.push_back(unsigned(lastIndex + i));
+			m.indices.push_back(unsigned(lastIndex + i + arcPoints + 1));
+			m.indices.push_back(unsigned(lastIndex + i + 1));
+			m.indices.push_back(unsigned(lastIndex + i));
+			m.indices.push_back(unsigned(lastIndex + i + arcPoints));
+			m.indices.push_back(unsigned(lastIndex + i + arcPoints + 1));
+		}
+	}
+}
+
+// makeGroundShadow() and makeWallShadow() of run.cpp
+static void
+buildShadow(BuiltMeshes& m, float radius, bool wall)
+{
+	const int lastIndex = int(m.vertices.size() / 4);
+	int circlePoints = 22;
+	const float centre[4] = { 0, 0, 0, 1 };
+	m.vertices.insert(m.vertices.end(), centre, centre + 4);
+	for (float i = 0; i <= circlePoints; i++) {
+		float phi = i / (circlePoints) * TWO_PI;
+		m.vertices.push_back(radius * cos(phi));
+		m.vertices.push_back(wall ? radius * sin(phi) : 0);
+		m.vertices.push_back(wall ? 0 : radius * sin(phi));
+		m.vertices.push_back(1.0f);
+	}
+	for (int i = 0; i < circlePoints; i++) {
+		m.indices.push_back(unsigned(lastIndex + 1));
+		m.indices.push_back(unsigned(lastIndex + 1 + i));
+		m.indices.push_back(unsigned(lastIndex + 1 + i + 1));
+	}
+}
+
+static void
+build(BuiltMeshes& m)
+{
+	buildPlane(m, false);
+	buildPlane(m, true);
+	buildSphere(m, 1.0f);
+	buildShadow(m, 1.0f, false);
+	buildShadow(m, 1.0f, true);
+}
+
+// What run.cpp does with the tables: copy them one after the other into
+// the buffers, the indices made relative to the whole
+static void
+copyTables(const MeshView* meshes, int count, float* vertices, float* normals, unsigned* indices)
+{
+	int base = 0;
+	for (int k = 0; k < count; k++) {
+		const MeshView& m = meshes[k];
+		std::memcpy(vertices + 4 * base, m.positions, sizeof(float) * 4 * m.vertexCount);
+		std::memcpy(normals + 3 * base, m.normals, sizeof(float) * 3 * m.vertexCount);
+		for (int i = 0; i < m.indexCount; i++) {
+			*indices++ = m.indices[i] + base;
+		}
+		base += m.vertexCount;
+	}
+}
+
+// The same for the interleaved vertices the window uploads now
+static void
+copyPacked(const MeshView* meshes, int count, PackedVertex* vertices, unsigned* indices)
+{
+	int base = 0;
+	for (int k = 0; k < count; k++) {
+		const MeshView& m = meshes[k];
+		std::memcpy(vertices + base, m.vertices, sizeof(PackedVertex) * m.vertexCount);
+		for (int i = 0; i < m.indexCount; i++) {
+			*indices++ = m.indices[i] + base;
+		}
+		base += m.vertexCount;
+	}
+}
+
+// Component c of a packed normal as GL reads it (GL 4.2 and later)
+static float
+unpackNormal(PackedNormal n, int c)
+{
+	const int bits = int(n.bits >> (10 * c) & 0x3FFu);
+	return std::max(float(bits >= 512 ? bits - 1024 : bits) / 511.0f, -1.0f);
+}
+
+int
+main(int argc, char** argv)
+{
+	const int repeats = ballCount(argc, argv, 10000);
+	const MeshView meshes[5] = {
+		MeshTables<GroundGrid>::view(), MeshTables<WallGrid>::view(), MeshTables<BallMesh>::view(),
+		MeshTables<GroundShadowMesh>::view(), MeshTables<WallShadowMesh>::view()
+	};
+
+	BuiltMeshes built;
+	double start = nowMs();
+	for (int r = 0; r < repeats; r++) {
+		built = BuiltMeshes();
+		build(built);
+	}
+	double builtMs = nowMs() - start;
+
+	const int vertexCount = int(built.vertices.size() / 4);
+	std::vector<float> vertices(4 * vertexCount), normals(3 * vertexCount);
+	std::vector<unsigned> indices(built.indices.size());
+	start = nowMs();
+	for (int r = 0; r < repeats; r++) {
+		copyTables(meshes, 5, vertices.data(), normals.data(), indices.data());
+	}
+	double tableMs = nowMs() - start;
+
+	// The shadows had no normals
+	float worst = 0.0f;
+	for (size_t i = 0; i < vertices.size(); i++) {
+		worst = std::max(worst, std::abs(vertices[i] - built.vertices[i]));
+	}
+	for (size_t i = 0; i < built.normals.size(); i++) {
+		worst = std::max(worst, std::abs(normals[i] - built.normals[i]));
+	}
+	const bool sameIndices = indices == built.indices;
+
+	std::vector<PackedVertex> packed(vertexCount);
+	start = nowMs();
+	for (int r = 0; r < repeats; r++) {
+		copyPacked(meshes, 5, packed.data(), indices.data());
+	}
+	double packedMs = nowMs() - start;
+
+	float worstPosition = 0.0f, worstNormal = 0.0f;
+	for (int v = 0; v < vertexCount; v++) {
+		for (int c = 0; c < 3; c++) {
+			worstPosition = std::max(worstPosition, std::abs(packed[v].position[c] - vertices[4 * v + c]));
+			worstNormal = std::max(worstNormal, std::abs(unpackNormal(packed[v].normal, c) - normals[3 * v + c]));
+		}
+	}
+
+	printf("%d vertices, %d indices, %d times\n", vertexCount, int(indices.size()), repeats);
+	printf("%-10s %12s %12s %12s\n", "meshes", "us/startup", "bytes/vertex", "vertex KiB");
+	printf("%-10s %12.3f %12d %12.1f\n", "built", builtMs * 1000.0 / repeats, 28, 28.0 * vertexCount / 1024);
+	printf("%-10s %12.3f %12d %12.1f\n", "tables", tableMs * 1000.0 / repeats, 28, 28.0 * vertexCount / 1024);
+	printf("%-10s %12.3f %12d %12.1f\n", "packed", packedMs * 1000.0 / repeats, int(sizeof(PackedVertex)),
+		double(sizeof(PackedVertex)) * vertexCount / 1024);
+	printf("largest difference %g, indices %s\n", worst, sameIndices ? "the same" : "DIFFER");
+	printf("packed: largest difference %g in a position, %g in a normal\n", worstPosition, worstNormal);
+	return sameIndices && worst < 1e-5f && worstPosition == 0.0f && worstNormal <= 1.0f / 511 ? 0 : 1;
+}
@@ -0,0 +1,72 @@
+// Steps the same colliding balls without a thread pool and on pools of
+// 1, 2, 4, ... threads, reporting the time per step, the speedup over one
+// thread and whether the final state is bit for bit the same as on one thread.
+// The second argument is the most threads to try, by default one per
+// hardware thread.
+
+#include "bench.h"
+#include "threadpool.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <thread>
+
+static bool
+sameState(const BallWorld& l, const BallWorld& r)
+{
+	const size_t bytes = l.x.size() * sizeof(float);
+	return std::memcmp(l.x.data(), r.x.data(), bytes) == 0
+		&& std::memcmp(l.y.data(), r.y.data(), bytes) == 0
+		&& std::memcmp(l.z.data(), r.z.data(), bytes) == 0
+		&& std::memcmp(l.vx.data(), r.vx.data(), bytes) == 0
+		&& std::memcmp(l.vy.data(), r.vy.data(), bytes) == 0
+		&& std::memcmp(l.vz.data(), r.vz.data(), bytes) == 0;
+}
+
+static double
+run(BallWorld& world, int steps)
+{
+	double start = nowMs();
+	for (int s = 0; s < steps; s++) {
+		world.step();
+	}
+	return (nowMs() - start) / steps;
+}
+
+int
+main(int argc, char** argv)
+{
+	const int n = ballCount(argc, argv, 1000000);
+	const int maxThreads = argc > 2 ? std::atoi(argv[2]) : int(std::max(1u, std::thread::hardware_concurrency()));
+	const int steps = 20;
+
+	// About 5% of the room filled, so there are contacts all over it
+	BallWorld initial;
+	fillRandom(initial, n, 0.25f * std::cbrt(64.0f / n));
+	initial.collideBalls = true;
+	initial.restitution = 0.8f;
+
+	printf("%d balls, %d steps, %u hardware threads\n", n, steps, std::thread::hardware_concurrency());
+	printf("%-8s %10s %10s %10s\n", "threads", "ms/step", "speedup", "same");
+
+	BallWorld serial = initial;
+	printf("%-8s %10.2f\n", "none", run(serial, steps));
+
+	BallWorld reference = initial;
+	double oneThreadMs = 0.0;
+	for (int threads = 1; threads <= maxThreads; threads *= 2) {
+		ThreadPool pool(threads);
+		BallWorld world = initial;
+		world.threadPool = &pool;
+		double ms = run(world, steps);
+		if (threads == 1) {
+			reference = world;
+			oneThreadMs = ms;
+		}
+		printf("%-8d %10.2f %10.2f %10s\n", threads, ms, oneThreadMs / ms,
+			sameState(world, reference) ? "yes" : "NO");
+	}
+
+	return 0;
+}
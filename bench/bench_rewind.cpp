@@ -0,0 +1,96 @@
+// Keeps the last ten seconds (600 steps) of a BallWorld in a RewindBuffer
+// at a few keyframe intervals, and reports the memory against storing
+// every frame whole, the cost of a push, of seeking to the worst and to a
+// random frame, and of going back one step. Every frame read back must
+// hash the same as when it was pushed.
+//
+// Usage: bench_rewind [balls]
+
+#include "bench.h"
+#include "rewind.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <vector>
+
+static unsigned long long
+hashBytes(const void* data, size_t size)
+{
+	const unsigned char* p = static_cast<const unsigned char*>(data);
+	unsigned long long h = 14695981039346656037ull;
+	for (size_t i = 0; i < size; i++) {
+		h = (h ^ p[i]) * 1099511628211ull;
+	}
+	return h;
+}
+
+int
+main(int argc, char** argv)
+{
+	const int n = ballCount(argc, argv, 20000);
+	const int capacity = 600;
+	const int warmup = 600; // steps before the ones kept, so the buffer wraps
+	const int seeks = 200;
+	const int intervals[] = { 1, 10, 30, 60, 120 };
+
+	bool ok = true;
+	for (size_t t = 0; t < sizeof(intervals) / sizeof(intervals[0]); t++) {
+		BallWorld world;
+		world.allowSleep = true;
+		fillRandom(world, n, 0.02f);
+
+		RewindBuffer rewind(worldFrameSize(world), capacity, intervals[t]);
+		std::vector<unsigned char> frame(rewind.frameSize());
+		std::vector<unsigned long long> hashes;
+
+		double pushMs = 0;
+		for (int s = 0; s < warmup + capacity; s++) {
+			world.step();
+			saveWorldFrame(world, frame.data());
+			hashes.push_back(hashBytes(frame.data(), frame.size()));
+			double start = nowMs();
+			rewind.push(frame.data());
+			pushMs += nowMs() - start;
+		}
+		const double memoryMb = rewind.memoryBytes() / 1e6;
+
+		std::mt19937 rng(1);
+		std::uniform_int_distribution<int> anyAge(0, rewind.size() - 1);
+		double worstMs = 0, randomMs = 0;
+		for (int k = 0; k < seeks; k++) {
+			int age = anyAge(rng);
+			double start = nowMs();
+			rewind.get(age, frame.data());
+			double ms = nowMs() - start;
+			randomMs += ms;
+			worstMs = std::max(worstMs, ms);
+			ok = ok && hashBytes(frame.data(), frame.size()) == hashes[hashes.size() - 1 - age];
+		}
+
+		// Scrub all the way back one step at a time
+		double backMs = 0;
+		int backs = 0;
+		for (;;) {
+			double start = nowMs();
+			bool more = rewind.back(frame.data());
+			backMs += nowMs() - start;
+			if (!more) {
+				break;
+			}
+			backs++;
+			hashes.pop_back();
+			ok = ok && hashBytes(frame.data(), frame.size()) == hashes.back();
+		}
+		loadWorldFrame(world, frame.data());
+
+		if (t == 0) {
+			printf("%d balls, a frame %.2f MB, the last %d frames whole %.1f MB\n",
+				n, rewind.frameSize() / 1e6, capacity, rewind.frameSize() * double(capacity) / 1e6);
+			printf("keyframe every   memory MB   push ms   seek avg ms   seek max ms   back ms\n");
+		}
+		printf("%14d   %9.1f   %7.3f   %11.3f   %11.3f   %7.4f\n", intervals[t], memoryMb,
+			pushMs / (warmup + capacity), randomMs / seeks, worstMs, backMs / std::max(backs, 1));
+	}
+	printf("every frame read back: %s\n", ok ? "same" : "DIFFERENT");
+	return ok ? 0 : 1;
+}
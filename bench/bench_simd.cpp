@@ -0,0 +1,168 @@
+// Times the step kernel three ways on the same balls: branching on every
+// wall like update() in run.cpp, the branchless scalar loop as the
+// compiler vectorizes it, and the loop written with SSE2/AVX2 intrinsics.
+// All three must end up with the same state to the bit. Then the
+// intrinsics again with the counters of monitor.h compiled in, to see what
+// watching the energy costs; it too must not change a bit.
+// Build with "make ARCHFLAGS=-mavx2" to get the 8 wide AVX2 kernel.
+
+#include "bench.h"
+#include "stepkernel.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+// update() of run.cpp over the arrays of a BallWorld
+static void
+stepBranching(BallWorld& w)
+{
+	const int n = w.size();
+	const float g = w.gravity;
+	const Room& room = w.room;
+	for (int i = 0; i < n; i++) {
+		if (w.restFlag[i]) {
+			continue;
+		}
+		const float r = w.radius[i];
+
+		w.x[i] += w.vx[i];
+		w.y[i] += w.vy[i];
+		w.z[i] += w.vz[i];
+		w.y[i] += g;
+
+		if (w.y[i] >= room.ceiling - r) {
+			w.y[i] = room.ceiling - r;
+			w.vy[i] = -w.vy[i];
+		}
+		if (w.y[i] <= room.ground + r) {
+			w.y[i] = room.ground + r;
+			w.vy[i] = -w.vy[i];
+			if (std::abs(w.vy[i]) <= std::abs(g)) {
+				w.restFlag[i] = 1;
+				w.vx[i] = w.vy[i] = w.vz[i] = 0.0f;
+			}
+		}
+		if (w.x[i] >= room.walls[rightWall] - r) {
+			w.x[i] = room.walls[rightWall] - r;
+			w.vx[i] = -w.vx[i];
+		}
+		else if (w.x[i] <= room.walls[leftWall] + r) {
+			w.x[i] = room.walls[leftWall] + r;
+			w.vx[i] = -w.vx[i];
+		}
+		if (w.z[i] >= room.walls[nearWall] - r) {
+			w.z[i] = room.walls[nearWall] - r;
+			w.vz[i] = -w.vz[i];
+		}
+		else if (w.z[i] <= room.walls[farWall] + r) {
+			w.z[i] = room.walls[farWall] + r;
+			w.vz[i] = -w.vz[i];
+		}
+
+		w.vy[i] += g;
+	}
+}
+
+typedef void (*Kernel)(int, float, const Room&, float*, float*, float*,
+	float*, float*, float*, const float*, unsigned char*);
+
+static void
+stepWith(Kernel kernel, BallWorld& w)
+{
+	kernel(w.size(), w.gravity, w.room, w.x.data(), w.y.data(), w.z.data(),
+		w.vx.data(), w.vy.data(), w.vz.data(), w.radius.data(), w.restFlag.data());
+}
+
+// The energy of the balls recounted from their state, one at a time
+static double
+energyOf(const BallWorld& w)
+{
+	double energy = 0.0;
+	for (int i = 0; i < w.size(); i++) {
+		const double m = double(w.radius[i]) * w.radius[i] * w.radius[i];
+		energy += m * std::abs(w.gravity) * (w.y[i] - w.room.ground);
+		if (!w.restFlag[i]) {
+			energy += 0.5 * m * glm::dot(glm::dvec3(w.velocity(i)), glm::dvec3(w.velocity(i)));
+		}
+	}
+	return energy;
+}
+
+static int
+mismatches(const BallWorld& l, const BallWorld& r)
+{
+	int count = 0;
+	for (int i = 0; i < l.size(); i++) {
+		if (std::memcmp(&l.x[i], &r.x[i], sizeof(float)) || std::memcmp(&l.y[i], &r.y[i], sizeof(float))
+			|| std::memcmp(&l.z[i], &r.z[i], sizeof(float)) || std::memcmp(&l.vy[i], &r.vy[i], sizeof(float))
+			|| l.restFlag[i] != r.restFlag[i]) {
+			count++;
+		}
+	}
+	return count;
+}
+
+static void
+report(const char* name, double ms, double baseMs, int n, int steps)
+{
+	printf("%-10s %10.3f %10.2f %10.2f\n", name, ms / steps, ms * 1e6 / (double(steps) * n), baseMs / ms);
+}
+
+int
+main(int argc, char** argv)
+{
+	const int n = ballCount(argc, argv, 1000000);
+	const int steps = 100;
+
+	BallWorld initial;
+	fillRandom(initial, n, 0.05f);
+	BallWorld branching = initial, scalar = initial, simd = initial, monitored = initial;
+
+	double start = nowMs();
+	for (int s = 0; s < steps; s++) {
+		stepBranching(branching);
+	}
+	double branchingMs = nowMs() - start;
+
+	start = nowMs();
+	for (int s = 0; s < steps; s++) {
+		stepWith(stepBallsScalar, scalar);
+	}
+	double scalarMs = nowMs() - start;
+
+	start = nowMs();
+	for (int s = 0; s < steps; s++) {
+		stepWith(stepBalls, simd);
+	}
+	double simdMs = nowMs() - start;
+
+	StepStats stats;
+	long long bounces = 0;
+	start = nowMs();
+	for (int s = 0; s < steps; s++) {
+		stats.clear();
+		stepBallsMonitored(n, monitored.gravity, monitored.room,
+			monitored.x.data(), monitored.y.data(), monitored.z.data(),
+			monitored.vx.data(), monitored.vy.data(), monitored.vz.data(),
+			monitored.radius.data(), monitored.restFlag.data(), stats);
+		bounces += stats.bounces;
+	}
+	double monitoredMs = nowMs() - start;
+
+	printf("%d balls, %d steps, %s, %d balls per instruction\n", n, steps, stepBallsInstructions(), stepBallsWidth());
+	printf("%-10s %10s %10s %10s\n", "kernel", "ms/step", "ns/ball", "speedup");
+	report("branching", branchingMs, branchingMs, n, steps);
+	report("scalar", scalarMs, branchingMs, n, steps);
+	report("simd", simdMs, branchingMs, n, steps);
+	report("monitored", monitoredMs, branchingMs, n, steps);
+
+	const double energy = energyOf(monitored);
+	printf("monitor: %lld bounces, energy %.9g, recounted %.9g, max penetration %.3g\n",
+		bounces, stats.energy(), energy, stats.maxPenetration);
+
+	const int wrongScalar = mismatches(scalar, branching), wrongSimd = mismatches(simd, branching);
+	const int wrongMonitored = mismatches(monitored, branching);
+	printf("mismatches: scalar %d, simd %d, monitored %d\n", wrongScalar, wrongSimd, wrongMonitored);
+	return wrongScalar == 0 && wrongSimd == 0 && wrongMonitored == 0 ? 0 : 1;
+}
@@ -0,0 +1,50 @@
+// Drops balls into a smaller room, so they land a few layers deep, with
+// contacts that lose energy, with and without sleeping, and reports the cost of a step as the pile settles.
+// Then kicks one ball to show an island waking up.
+
+#include "bench.h"
+
+#include <cstdio>
+
+static void
+run(const char* name, BallWorld world, int steps)
+{
+	printf("%s\n", name);
+	printf("%8s %10s %10s\n", "steps", "awake", "us/step");
+
+	const int block = steps / 16;
+	for (int s = 0; s < steps; s += block) {
+		double start = nowMs();
+		for (int k = 0; k < block; k++) {
+			world.step();
+		}
+		double ms = nowMs() - start;
+		printf("%8d %10d %10.2f\n", s + block, world.awakeCount(), ms * 1000.0 / block);
+	}
+
+	world.applyImpulse(0, glm::vec3(0.0f, 0.03f, 0.0f));
+	printf("kick ball 0: %d awake", world.awakeCount());
+	world.step();
+	printf(", %d after one step\n\n", world.awakeCount());
+}
+
+int
+main(int argc, char** argv)
+{
+	const int n = ballCount(argc, argv, 6000);
+	const int steps = 1600;
+
+	BallWorld world;
+	world.room.walls[leftWall] = world.room.walls[farWall] = -1.0f;
+	world.room.walls[rightWall] = world.room.walls[nearWall] = 1.0f;
+	fillRandom(world, n, 0.02f);
+	world.collideBalls = true;
+	world.restitution = 0.5f;
+
+	printf("%d balls, %d steps\n\n", n, steps);
+	run("always awake", world, steps);
+	world.allowSleep = true;
+	run("sleeping", world, steps);
+
+	return 0;
+}
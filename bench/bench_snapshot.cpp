@@ -0,0 +1,181 @@
+// Writes a BallWorld to a snapshot and restores it, next to a text dump
+// that is parsed ball by ball. The restored world must step on exactly
+// like the original. So must a world with the warm started contact solver
+// restored halfway into a world of default settings.
+//
+// Usage: bench_snapshot [balls] [file]
+
+#include "bench.h"
+#include "snapshot.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <string>
+
+static bool
+sameWorld(const BallWorld& a, const BallWorld& b)
+{
+	return a.x == b.x && a.y == b.y && a.z == b.z
+		&& a.vx == b.vx && a.vy == b.vy && a.vz == b.vz
+		&& a.radius == b.radius && a.restFlag == b.restFlag
+		&& a.quietSteps == b.quietSteps && a.nextInIsland == b.nextInIsland;
+}
+
+// Exact text of every ball, as a format with per-field parsing would keep it
+static bool
+saveText(const std::string& path, const BallWorld& w)
+{
+	FILE* fp = fopen(path.c_str(), "w");
+	if (!fp) {
+		return false;
+	}
+	fprintf(fp, "%d\n", w.size());
+	for (int i = 0; i < w.size(); i++) {
+		fprintf(fp, "%a %a %a %a %a %a %a %d %d %d\n", w.x[i], w.y[i], w.z[i], w.vx[i], w.vy[i], w.vz[i],
+			w.radius[i], int(w.restFlag[i]), w.quietSteps[i], w.nextInIsland[i]);
+	}
+	return fclose(fp) == 0;
+}
+
+static bool
+loadText(const std::string& path, BallWorld& w)
+{
+	FILE* fp = fopen(path.c_str(), "r");
+	int n = 0;
+	if (!fp || fscanf(fp, "%d", &n) != 1) {
+		return false;
+	}
+	w.clear();
+	w.reserve(n);
+	for (int i = 0; i < n; i++) {
+		float p[3], v[3], r;
+		int rest, quiet, next;
+		if (fscanf(fp, "%a %a %a %a %a %a %a %d %d %d", &p[0], &p[1], &p[2], &v[0], &v[1], &v[2], &r,
+			&rest, &quiet, &next) != 10) {
+			break;
+		}
+		w.addBall(glm::vec3(p[0], p[1], p[2]), glm::vec3(v[0], v[1], v[2]), r);
+		w.restFlag[i] = (unsigned char)rest;
+		w.quietSteps[i] = quiet;
+		w.nextInIsland[i] = next;
+	}
+	fclose(fp);
+	return w.size() == n;
+}
+
+// 200 steps straight against 100, a snapshot, and 100 more from it
+static bool
+solverContinuesSame(const std::string& path)
+{
+	BallWorld world;
+	fillRandom(world, 3000, 0.05f);
+	world.collideBalls = true;
+	world.contactSolver = SequentialImpulses;
+	world.solverIterations = 3;
+	BallWorld straight = world;
+	for (int s = 0; s < 200; s++) {
+		straight.step();
+	}
+	for (int s = 0; s < 100; s++) {
+		world.step();
+	}
+
+	const GameConstants constants = defaultConstants();
+	BallWorld restored;
+	Snapshot snapshot;
+	if (!saveSnapshot(path, constants, startState(constants), 100, &world) || !snapshot.open(path)) {
+		return false;
+	}
+	snapshot.restoreWorld(restored);
+	snapshot.close();
+	std::remove(path.c_str());
+	for (int s = 0; s < 100; s++) {
+		restored.step();
+	}
+	return sameWorld(straight, restored);
+}
+
+int
+main(int argc, char** argv)
+{
+	const int n = ballCount(argc, argv, 1000000);
+	const std::string path = argc > 2 ? argv[2] : "bench_snapshot.bsnp";
+	const std::string textPath = path + ".txt";
+	const int repeats = 5;
+
+	// Some steps with sleeping on, so every array holds something
+	BallWorld world;
+	world.allowSleep = true;
+	world.sleepSpeed = 0.05f;
+	world.sleepSteps = 5;
+	fillRandom(world, n, 0.02f);
+	for (int s = 0; s < 50; s++) {
+		world.step();
+	}
+
+	const GameConstants constants = defaultConstants();
+	const GameState game = startState(constants);
+
+	double saveMs = 1e30, restoreMs = 1e30, mapMs = 1e30;
+	bool ok = true;
+	BallWorld restored;
+	for (int r = 0; r < repeats && ok; r++) {
+		double start = nowMs();
+		ok = saveSnapshot(path, constants, game, 50, &world);
+		saveMs = std::min(saveMs, nowMs() - start);
+
+		// Only mapping the file, the arrays are then used in place
+		start = nowMs();
+		Snapshot mapped;
+		ok = ok && mapped.open(path);
+		mapMs = std::min(mapMs, nowMs() - start);
+		mapped.close();
+
+		start = nowMs();
+		Snapshot snapshot;
+		ok = ok && snapshot.open(path);
+		if (ok) {
+			snapshot.restoreWorld(restored);
+		}
+		restoreMs = std::min(restoreMs, nowMs() - start);
+	}
+	if (!ok) {
+		fprintf(stderr, "cannot write or read %s\n", path.c_str());
+		return 1;
+	}
+
+	double start = nowMs();
+	ok = saveText(textPath, world);
+	const double textSaveMs = nowMs() - start;
+	BallWorld parsed;
+	start = nowMs();
+	ok = ok && loadText(textPath, parsed);
+	const double textLoadMs = nowMs() - start;
+
+	const bool same = sameWorld(world, restored) && ok && sameWorld(world, parsed);
+	for (int s = 0; s < 50; s++) {
+		world.step();
+		restored.step();
+	}
+	const bool sameAfter = sameWorld(world, restored);
+
+	Snapshot snapshot;
+	snapshot.open(path);
+	const double mb = snapshot.header().fileSize / 1e6;
+	snapshot.close();
+	std::remove(path.c_str());
+	std::remove(textPath.c_str());
+
+	printf("%d balls, snapshot %.1f MB, best of %d\n", n, mb, repeats);
+	printf("snapshot save:    %8.2f ms  %6.2f GB/s\n", saveMs, mb / saveMs);
+	printf("snapshot map:     %8.2f ms\n", mapMs);
+	printf("snapshot restore: %8.2f ms  %6.2f GB/s\n", restoreMs, mb / restoreMs);
+	printf("text save:        %8.2f ms\n", textSaveMs);
+	printf("text load:        %8.2f ms\n", textLoadMs);
+	printf("restored: %s, after 50 more steps: %s\n", same ? "same" : "DIFFERENT", sameAfter ? "same" : "DIFFERENT");
+
+	const bool solverSame = solverContinuesSame(path);
+	printf("contact solver restored halfway, after 200 steps: %s\n", solverSame ? "same" : "DIFFERENT");
+
+	return same && sameAfter && solverSame ? 0 : 1;
+}
@@ -0,0 +1,74 @@
+// Steps a hall with mostly slow balls and a few fast ones in ticks of N
+// steps, once by calling step() N times and once by stepAdaptive(N), and
+// reports the time of a tick, how many balls jumped the whole tick and
+// how far the two runs ended up apart: the share of balls more than 0.01
+// apart, and the median distance. With collide 1 the balls also collide,
+// which sends most of them off on paths of their own in either run.
+//
+// Usage: bench_substep [balls] [collide]
+
+#include "bench.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+int
+main(int argc, char** argv)
+{
+	const int n = ballCount(argc, argv, 100000);
+	const bool collide = argc > 2 && std::atoi(argv[2]) != 0;
+	const int steps = 960;
+	const float fastShare = 0.1f;
+
+	// A hall 100 wide, balls anywhere in it, one in ten as fast as the game
+	// ball and the rest ten times slower
+	BallWorld start;
+	start.collideBalls = collide;
+	start.room.ground = -50.0f;
+	start.room.walls[leftWall] = start.room.walls[farWall] = -50.0f;
+	start.room.walls[rightWall] = start.room.walls[nearWall] = 50.0f;
+	std::mt19937 rng(1);
+	std::uniform_real_distribution<float> p(-49.0f, 49.0f);
+	std::uniform_real_distribution<float> v(-0.03f, 0.03f);
+	std::uniform_real_distribution<float> share(0.0f, 1.0f);
+	for (int i = 0; i < n; i++) {
+		const float speed = share(rng) < fastShare ? 10.0f : 1.0f;
+		start.addBall(glm::vec3(p(rng), p(rng), p(rng)), glm::vec3(v(rng), v(rng), v(rng)) * speed, 0.05f);
+	}
+
+	BallWorld fixed = start;
+	double begin = nowMs();
+	for (int s = 0; s < steps; s++) {
+		fixed.step();
+	}
+	const double fixedMs = nowMs() - begin;
+
+	printf("%d balls, %d steps, one in %.0f fast%s\n", n, steps, 1.0f / fastShare, collide ? ", colliding" : "");
+	printf("tick   step() ms/tick   stepAdaptive ms/tick   speedup   jumped   apart   median distance\n");
+	for (int tick = 2; tick <= 32; tick *= 2) {
+		BallWorld adaptive = start;
+		double jumped = 0;
+		begin = nowMs();
+		for (int s = 0; s < steps; s += tick) {
+			jumped += adaptive.stepAdaptive(tick);
+		}
+		const double adaptiveMs = nowMs() - begin;
+
+		// Rounding moves a bounce by a step now and then, which sends a ball
+		// off on a different path, so look at how many do and at the median
+		std::vector<float> distances(n);
+		int apart = 0;
+		for (int i = 0; i < n; i++) {
+			distances[i] = glm::length(adaptive.position(i) - fixed.position(i));
+			apart += distances[i] > 0.01f;
+		}
+		std::nth_element(distances.begin(), distances.begin() + n / 2, distances.end());
+		const double ticks = double(steps / tick);
+		printf("%4d   %14.3f   %20.3f   %6.2fx   %5.1f%%   %4.1f%%   %g\n", tick, fixedMs / ticks, adaptiveMs / ticks,
+			fixedMs / adaptiveMs, 100.0 * jumped / (ticks * n), 100.0 * apart / n, distances[n / 2]);
+	}
+	return 0;
+}
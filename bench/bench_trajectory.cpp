@@ -0,0 +1,60 @@
+// Seeks to random times on the path of the ball from run.cpp, through the
+// impact index of Trajectory and by replaying the events from the restart
+// state, and checks both give the same answer.
+
+#include "bench.h"
+#include "trajectory.h"
+
+#include <cstdio>
+#include <random>
+
+int
+main(int argc, char** argv)
+{
+	const int queries = ballCount(argc, argv, 100000);
+	const double length = 60.0 * 60.0 * 10.0; // ten minutes of steps
+
+	// Restart state of run.cpp ('r')
+	const float impulse = 0.0002f * 150.0f;
+	BallWorld world;
+	world.addBall(glm::vec3(0, 1, -1), glm::vec3(impulse, impulse, impulse), 0.5f);
+
+	std::mt19937 rng(3);
+	std::uniform_real_distribution<double> when(0.0, length);
+
+	// Index is filled by the first query past the end, time that separately
+	double start = nowMs();
+	Trajectory trajectory(world, 0);
+	trajectory.stateAt(length);
+	double indexMs = nowMs() - start;
+
+	double checksum = 0.0;
+	start = nowMs();
+	for (int q = 0; q < queries; q++) {
+		checksum += trajectory.stateAt(when(rng)).position.y;
+	}
+	double seekMs = nowMs() - start;
+
+	// Replays are slow, only do a few and compare them
+	const int replays = 200;
+	int mismatches = 0;
+	start = nowMs();
+	for (int q = 0; q < replays; q++) {
+		double t = when(rng);
+		EventSimulator replay(world);
+		replay.advanceTo(t);
+		BallState expected = replay.state(0);
+		BallState got = trajectory.stateAt(t);
+		if (got.position != expected.position || got.velocity != expected.velocity) {
+			mismatches++;
+		}
+	}
+	double replayMs = nowMs() - start;
+
+	printf("%d impacts in %.0f steps, index built in %.3f ms\n", trajectory.cachedImpacts(), length, indexMs);
+	printf("stateAt: %10.1f ns/seek (checksum %.3f)\n", seekMs * 1e6 / queries, checksum);
+	printf("replay:  %10.1f ns/seek\n", replayMs * 1e6 / replays);
+	printf("mismatches: %d of %d\n", mismatches, replays);
+
+	return mismatches == 0 ? 0 : 1;
+}
@@ -0,0 +1,9829 @@
+// Generated by tools/meshstats with bake=file: the meshes of meshes.h after
+// the passes of meshopt.h, in the order of BakedMeshId. Do not edit, bake
+// them again after changing either, meshstats says when it is needed.
+
+#ifndef BAKEDMESHES_H
+#define BAKEDMESHES_H
+
+#include "meshes.h"
+
+static const BakedMesh bakedMeshes[BAKED_MESHES] = {
+	{ 0, 4, 0, 6 }, // ground quad
+	{ 4, 4, 6, 6 }, // wall quad
+	{ 8, 961, 12, 5400 }, // ground grid
+	{ 969, 961, 5412, 5400 }, // wall grid
+	{ 1930, 23, 10812, 66 }, // ground shadow
+	{ 1953, 23, 10878, 66 }, // wall shadow
+	{ 1976, 35, 10944, 144 }, // ball level 0
+	{ 2011, 77, 11088, 360 }, // ball level 1
+	{ 2088, 135, 11448, 672 }, // ball level 2
+	{ 2223, 345, 12120, 1848 }, // ball level 3
+	{ 2568, 693, 13968, 3840 }, // ball level 4
+	{ 3261, 1305, 17808, 7392 }, // ball level 5
+	{ 4566, 2665, 25200, 15360 }, // ball level 6
+};
+
+static const PackedVertex bakedVertices[7231] = {
+	// ground quad
+	{ { -1.93548393f, -1.87096775f, 0.0f }, { 0x00080400u } },
+	{ { 1.93548369f, 1.99999988f, 0.0f }, { 0x40080400u } },
+	{ { 1.93548369f, -1.87096775f, 0.0f }, { 0x40080400u } },
+	{ { -1.93548393f, 1.99999988f, 0.0f }, { 0x00080400u } },
+	// wall quad
+	{ { -1.93548393f, 2.0f, 0.0f }, { 0x1ff00000u } },
+	{ { 1.93548369f, 2.0f, 3.87096763f }, { 0x5ff00000u } },
+	{ { 1.93548369f, 2.0f, 0.0f }, { 0x5ff00000u } },
+	{ { -1.93548393f, 2.0f, 3.87096763f }, { 0x1ff00000u } },
+	// ground grid
+	{ { 1.80645132f, -1.87096775f, 0.0f }, { 0x40080400u } },
+	{ { 1.93548369f, -1.74193549f, 0.0f }, { 0x40080400u } },
+	{ { 1.93548369f, -1.87096775f, 0.0f }, { 0x00080400u } },
+	{ { 1.80645132f, -1.74193549f, 0.0f }, { 0x00080400u } },
+	{ { 1.67741919f, -1.87096775f, 0.0f }, { 0x00080400u } },
+	{ { 1.93548369f, -1.61290324f, 0.0f }, { 0x00080400u } },
+	{ { 1.67741919f, -1.74193549f, 0.0f }, { 0x40080400u } },
+	{ { 1.54838705f, -1.87096775f, 0.0f }, { 0x40080400u } },
+	{ { 1.80645132f, -1.61290324f, 0.0f }, { 0x40080400u } },
+	{ { 1.93548369f, -1.48387098f, 0.0f }, { 0x40080400u } },
+	{ { 1.54838705f, -1.74193549f, 0.0f }, { 0x00080400u } },
+	{ { 1.41935468f, -1.87096775f, 0.0f }, { 0x00080400u } },
+	{ { 1.67741919f, -1.61290324f, 0.0f }, { 0x00080400u } },
+	{ { 1.80645132f, -1.48387098f, 0.0f }, { 0x00080400u } },
+	{ { 1.93548369f, -1.35483873f, 0.0f }, { 0x00080400u } },
+	{ { 1.41935468f, -1.74193549f, 0.0f }, { 0x40080400u } },
+	{ { 1.2903223f, -1.87096775f, 0.0f }, { 0x40080400u } },
+	{ { 1.80645132f, -1.35483873f, 0.0f }, { 0x40080400u } },
+	{ { 1.93548369f, -1.22580647f, 0.0f }, { 0x40080400u } },
+	{ { 1.67741919f, -1.48387098f, 0.0f }, { 0x40080400u } },
+	{ { 1.54838705f, -1.61290324f, 0.0f }, { 0x40080400u } },
+	{ { 1.80645132f, -1.22580647f, 0.0f }, { 0x00080400u } },
+	{ { 1.93548369f, -1.09677422f, 0.0f }, { 0x00080400u } },
+	{ { 1.67741919f, -1.35483873f, 0.0f }, { 0x00080400u } },
+	{ { 1.54838705f, -1.48387098f, 0.0f }, { 0x00080400u } },
+	{ { 1.80645132f, -1.09677422f, 0.0f }, { 0x40080400u } },
+	{ { 1.93548369f, -0.967741966f, 0.0f }, { 0x40080400u } },
+	{ { 1.67741919f, -1.22580647f, 0.0f }, { 0x40080400u } },
+	{ { 1.80645132f, -0.967741966f, 0.0f }, { 0x00080400u } },
+	{ { 1.93548369f, -0.838709712f, 0.0f }, { 0x00080400u } },
+	{ { 1.67741919f, -1.09677422f, 0.0f }, { 0x00080400u } },
+	{ { 1.54838705f, -1.35483873f, 0.0f }, { 0x40080400u } },
+	{ { 1.54838705f, -1.22580647f, 0.0f }, { 0x00080400u } },
+	{ { 1.80645132f, -0.838709712f, 0.0f }, { 0x40080400u } },
+	{ { 1.93548369f, -0.709677458f, 0.0f }, { 0x40080400u } },
+	{ { 1.67741919f, -0.967741966f, 0.0f }, { 0x40080400u } },
+	{ { 1.80645132f, -0.709677458f, 0.0f }, { 0x00080400u } },
+	{ { 1.93548369f, -0.580645204f, 0.0f }, { 0x00080400u } },
+	{ { 1.67741919f, -0.838709712f, 0.0f }, { 0x00080400u } },
+	{ { 1.54838705f, -1.09677422f, 0.0f }, { 0x40080400u } },
+	{ { 1.54838705f, -0.967741966f, 0.0f }, { 0x00080400u } },
+	{ { 1.80645132f, -0.580645204f, 0.0f }, { 0x40080400u } },
+	{ { 1.93548369f, -0.451612949f, 0.0f }, { 0x40080400u } },
+	{ { 1.67741919f, -0.709677458f, 0.0f }, { 0x40080400u } },
+	{ { 1.80645132f, -0.451612949f, 0.0f }, { 0x00080400u } },
+	{ { 1.93548369f, -0.322580695f, 0.0f }, { 0x00080400u } },
+	{ { 1.67741919f, -0.580645204f, 0.0f }, { 0x00080400u } },
+	{ { 1.54838705f, -0.838709712f, 0.0f }, { 0x40080400u } },
+	{ { 1.54838705f, -0.709677458f, 0.0f }, { 0x00080400u } },
+	{ { 1.80645132f, -0.322580695f, 0.0f }, { 0x40080400u } },
+	{ { 1.93548369f, -0.193548441f, 0.0f }, { 0x40080400u } },
+	{ { 1.67741919f, -0.451612949f, 0.0f }, { 0x40080400u } },
+	{ { 1.80645132f, -0.193548441f, 0.0f }, { 0x00080400u } },
+	{ { 1.93548369f, -0.0645161867f, 0.0f }, { 0x00080400u } },
+	{ { 1.67741919f, -0.322580695f, 0.0f }, { 0x00080400u } },
+	{ { 1.54838705f, -0.580645204f, 0.0f }, { 0x40080400u } },
+	{ { 1.54838705f, -0.451612949f, 0.0f }, { 0x00080400u } },
+	{ { 1.80645132f, -0.0645161867f, 0.0f }, { 0x40080400u } },
+	{ { 1.93548369f, 0.0645160675f, 0.0f }, { 0x40080400u } },
+	{ { 1.67741919f, -0.193548441f, 0.0f }, { 0x40080400u } },
+	{ { 1.80645132f, 0.0645160675f, 0.0f }, { 0x00080400u } },
+	{ { 1.93548369f, 0.193548322f, 0.0f }, { 0x00080400u } },
+	{ { 1.67741919f, -0.0645161867f, 0.0f }, { 0x00080400u } },
+	{ { 1.54838705f, -0.322580695f, 0.0f }, { 0x40080400u } },
+	{ { 1.54838705f, -0.193548441f, 0.0f }, { 0x00080400u } },
+	{ { 1.80645132f, 0.193548322f, 0.0f }, { 0x40080400u } },
+	{ { 1.93548369f, 0.322580457f, 0.0f }, { 0x40080400u } },
+	{ { 1.67741919f, 0.0645160675f, 0.0f }, { 0x40080400u } },
+	{ { 1.80645132f, 0.322580457f, 0.0f }, { 0x00080400u } },
+	{ { 1.93548369f, 0.45161283f, 0.0f }, { 0x00080400u } },
+	{ { 1.67741919f, 0.193548322f, 0.0f }, { 0x00080400u } },
+	{ { 1.54838705f, -0.0645161867f, 0.0f }, { 0x40080400u } },
+	{ { 1.54838705f, 0.0645160675f, 0.0f }, { 0x00080400u } },
+	{ { 1.80645132f, 0.45161283f, 0.0f }, { 0x40080400u } },
+	{ { 1.93548369f, 0.580645204f, 0.0f }, { 0x40080400u } },
+	{ { 1.67741919f, 0.322580457f, 0.0f }, { 0x40080400u } },
+	{ { 1.80645132f, 0.580645204f, 0.0f }, { 0x00080400u } },
+	{ { 1.93548369f, 0.709677339f, 0.0f }, { 0x00080400u } },
+	{ { 1.67741919f, 0.45161283f, 0.0f }, { 0x00080400u } },
+	{ { 1.54838705f, 0.193548322f, 0.0f }, { 0x40080400u } },
+	{ { 1.54838705f, 0.322580457f, 0.0f }, { 0x00080400u } },
+	{ { 1.80645132f, 0.709677339f, 0.0f }, { 0x40080400u } },
+	{ { 1.93548369f, 0.838709474f, 0.0f }, { 0x40080400u } },
+	{ { 1.67741919f, 0.580645204f, 0.0f }, { 0x40080400u } },
+	{ { 1.80645132f, 0.838709474f, 0.0f }, { 0x00080400u } },
+	{ { 1.93548369f, 0.967741847f, 0.0f }, { 0x00080400u } },
+	{ { 1.67741919f, 0.709677339f, 0.0f }, { 0x00080400u } },
+	{ { 1.54838705f, 0.45161283f, 0.0f }, { 0x40080400u } },
+	{ { 1.54838705f, 0.580645204f, 0.0f }, { 0x00080400u } },
+	{ { 1.80645132f, 0.967741847f, 0.0f }, { 0x40080400u } },
+	{ { 1.93548369f, 1.09677422f, 0.0f }, { 0x40080400u } },
+	{ { 1.67741919f, 0.838709474f, 0.0f }, { 0x40080400u } },
+	{ { 1.80645132f, 1.09677422f, 0.0f }, { 0x00080400u } },
+	{ { 1.93548369f, 1.22580636f, 0.0f }, { 0x00080400u } },
+	{ { 1.67741919f, 0.967741847f, 0.0f }, { 0x00080400u } },
+	{ { 1.54838705f, 0.709677339f, 0.0f }, { 0x40080400u } },
+	{ { 1.54838705f, 0.838709474f, 0.0f }, { 0x00080400u } },
+	{ { 1.80645132f, 1.22580636f, 0.0f }, { 0x40080400u } },
+	{ { 1.93548369f, 1.35483849f, 0.0f }, { 0x40080400u } },
+	{ { 1.67741919f, 1.09677422f, 0.0f }, { 0x40080400u } },
+	{ { 1.80645132f, 1.35483849f, 0.0f }, { 0x00080400u } },
+	{ { 1.93548369f, 1.48387086f, 0.0f }, { 0x00080400u } },
+	{ { 1.67741919f, 1.22580636f, 0.0f }, { 0x00080400u } },
+	{ { 1.54838705f, 0.967741847f, 0.0f }, { 0x40080400u } },
+	{ { 1.54838705f, 1.09677422f, 0.0f }, { 0x00080400u } },
+	{ { 1.80645132f, 1.48387086f, 0.0f }, { 0x40080400u } },
+	{ { 1.93548369f, 1.61290324f, 0.0f }, { 0x40080400u } },
+	{ { 1.67741919f, 1.35483849f, 0.0f }, { 0x40080400u } },
+	{ { 1.80645132f, 1.61290324f, 0.0f }, { 0x00080400u } },
+	{ { 1.93548369f, 1.74193537f, 0.0f }, { 0x00080400u } },
+	{ { 1.67741919f, 1.48387086f, 0.0f }, { 0x00080400u } },
+	{ { 1.54838705f, 1.22580636f, 0.0f }, { 0x40080400u } },
+	{ { 1.54838705f, 1.35483849f, 0.0f }, { 0x00080400u } },
+	{ { 1.80645132f, 1.74193537f, 0.0f }, { 0x40080400u } },
+	{ { 1.93548369f, 1.87096751f, 0.0f }, { 0x40080400u } },
+	{ { 1.67741919f, 1.61290324f, 0.0f }, { 0x40080400u } },
+	{ { 1.80645132f, 1.87096751f, 0.0f }, { 0x00080400u } },
+	{ { 1.93548369f, 1.99999988f, 0.0f }, { 0x00080400u } },
+	{ { 1.80645132f, 1.99999988f, 0.0f }, { 0x40080400u } },
+	{ { 1.67741919f, 1.74193537f, 0.0f }, { 0x00080400u } },
+	{ { 1.67741919f, 1.87096751f, 0.0f }, { 0x40080400u } },
+	{ { 1.67741919f, 1.99999988f, 0.0f }, { 0x00080400u } },
+	{ { 1.54838705f, 1.61290324f, 0.0f }, { 0x00080400u } },
+	{ { 1.54838705f, 1.87096751f, 0.0f }, { 0x00080400u } },
+	{ { 1.54838705f, 1.99999988f, 0.0f }, { 0x40080400u } },
+	{ { 1.54838705f, 1.74193537f, 0.0f }, { 0x40080400u } },
+	{ { 1.41935468f, 1.87096751f, 0.0f }, { 0x40080400u } },
+	{ { 1.41935468f, 1.99999988f, 0.0f }, { 0x00080400u } },
+	{ { 1.41935468f, 1.74193537f, 0.0f }, { 0x00080400u } },
+	{ { 1.2903223f, 1.87096751f, 0.0f }, { 0x00080400u } },
+	{ { 1.2903223f, 1.99999988f, 0.0f }, { 0x40080400u } },
+	{ { 1.2903223f, 1.74193537f, 0.0f }, { 0x40080400u } },
+	{ { 1.41935468f, 1.61290324f, 0.0f }, { 0x40080400u } },
+	{ { 1.2903223f, 1.61290324f, 0.0f }, { 0x00080400u } },
+	{ { 1.16129017f, 1.87096751f, 0.0f }, { 0x40080400u } },
+	{ { 1.16129017f, 1.99999988f, 0.0f }, { 0x00080400u } },
+	{ { 1.16129017f, 1.74193537f, 0.0f }, { 0x00080400u } },
+	{ { 1.03225803f, 1.87096751f, 0.0f }, { 0x00080400u } },
+	{ { 1.03225803f, 1.99999988f, 0.0f }, { 0x40080400u } },
+	{ { 1.03225803f, 1.74193537f, 0.0f }, { 0x40080400u } },
+	{ { 1.16129017f, 1.61290324f, 0.0f }, { 0x40080400u } },
+	{ { 1.03225803f, 1.61290324f, 0.0f }, { 0x00080400u } },
+	{ { 0.90322566f, 1.87096751f, 0.0f }, { 0x40080400u } },
+	{ { 0.90322566f, 1.99999988f, 0.0f }, { 0x00080400u } },
+	{ { 0.90322566f, 1.74193537f, 0.0f }, { 0x00080400u } },
+	{ { 0.774193287f, 1.87096751f, 0.0f }, { 0x00080400u } },
+	{ { 0.774193287f, 1.99999988f, 0.0f }, { 0x40080400u } },
+	{ { 0.774193287f, 1.74193537f, 0.0f }, { 0x40080400u } },
+	{ { 0.90322566f, 1.61290324f, 0.0f }, { 0x40080400u } },
+	{ { 0.774193287f, 1.61290324f, 0.0f }, { 0x00080400u } },
+	{ { 0.645161152f, 1.87096751f, 0.0f }, { 0x40080400u } },
+	{ { 0.645161152f, 1.99999988f, 0.0f }, { 0x00080400u } },
+	{ { 0.645161152f, 1.74193537f, 0.0f }, { 0x00080400u } },
+	{ { 0.516129017f, 1.87096751f, 0.0f }, { 0x00080400u } },
+	{ { 0.516129017f, 1.99999988f, 0.0f }, { 0x40080400u } },
+	{ { 0.516129017f, 1.74193537f, 0.0f }, { 0x40080400u } },
+	{ { 0.645161152f, 1.61290324f, 0.0f }, { 0x40080400u } },
+	{ { 0.516129017f, 1.61290324f, 0.0f }, { 0x00080400u } },
+	{ { 0.387096643f, 1.87096751f, 0.0f }, { 0x40080400u } },
+	{ { 0.387096643f, 1.99999988f, 0.0f }, { 0x00080400u } },
+	{ { 0.387096643f, 1.74193537f, 0.0f }, { 0x00080400u } },
+	{ { 0.25806427f, 1.87096751f, 0.0f }, { 0x00080400u } },
+	{ { 0.25806427f, 1.99999988f, 0.0f }, { 0x40080400u } },
+	{ { 0.25806427f, 1.74193537f, 0.0f }, { 0x40080400u } },
+	{ { 0.387096643f, 1.61290324f, 0.0f }, { 0x40080400u } },
+	{ { 0.25806427f, 1.61290324f, 0.0f }, { 0x00080400u } },
+	{ { 0.129032135f, 1.87096751f, 0.0f }, { 0x40080400u } },
+	{ { 0.129032135f, 1.99999988f, 0.0f }, { 0x00080400u } },
+	{ { 0.129032135f, 1.74193537f, 0.0f }, { 0x00080400u } },
+	{ { -1.1920929e-07f, 1.87096751f, 0.0f }, { 0x00080400u } },
+	{ { -1.1920929e-07f, 1.99999988f, 0.0f }, { 0x40080400u } },
+	{ { -1.1920929e-07f, 1.74193537f, 0.0f }, { 0x40080400u } },
+	{ { 0.129032135f, 1.61290324f, 0.0f }, { 0x40080400u } },
+	{ { -1.1920929e-07f, 1.61290324f, 0.0f }, { 0x00080400u } },
+	{ { -0.129032373f, 1.87096751f, 0.0f }, { 0x40080400u } },
+	{ { -0.129032373f, 1.99999988f, 0.0f }, { 0x00080400u } },
+	{ { -0.129032373f, 1.74193537f, 0.0f }, { 0x00080400u } },
+	{ { -0.258064628f, 1.87096751f, 0.0f }, { 0x00080400u } },
+	{ { -0.258064628f, 1.99999988f, 0.0f }, { 0x40080400u } },
+	{ { -0.258064628f, 1.74193537f, 0.0f }, { 0x40080400u } },
+	{ { -0.129032373f, 1.61290324f, 0.0f }, { 0x40080400u } },
+	{ { -0.258064628f, 1.61290324f, 0.0f }, { 0x00080400u } },
+	{ { -0.387096882f, 1.87096751f, 0.0f }, { 0x40080400u } },
+	{ { -0.387096882f, 1.99999988f, 0.0f }, { 0x00080400u } },
+	{ { -0.387096882f, 1.74193537f, 0.0f }, { 0x00080400u } },
+	{ { -0.516129136f, 1.87096751f, 0.0f }, { 0x00080400u } },
+	{ { -0.516129136f, 1.99999988f, 0.0f }, { 0x40080400u } },
+	{ { -0.516129136f, 1.74193537f, 0.0f }, { 0x40080400u } },
+	{ { -0.387096882f, 1.61290324f, 0.0f }, { 0x40080400u } },
+	{ { -0.516129136f, 1.61290324f, 0.0f }, { 0x00080400u } },
+	{ { -0.64516139f, 1.87096751f, 0.0f }, { 0x40080400u } },
+	{ { -0.64516139f, 1.99999988f, 0.0f }, { 0x00080400u } },
+	{ { -0.64516139f, 1.74193537f, 0.0f }, { 0x00080400u } },
+	{ { -0.774193645f, 1.87096751f, 0.0f }, { 0x00080400u } },
+	{ { -0.774193645f, 1.99999988f, 0.0f }, { 0x40080400u } },
+	{ { -0.774193645f, 1.74193537f, 0.0f }, { 0x40080400u } },
+	{ { -0.64516139f, 1.61290324f, 0.0f }, { 0x40080400u } },
+	{ { -0.774193645f, 1.61290324f, 0.0f }, { 0x00080400u } },
+	{ { -0.903225899f, 1.87096751f, 0.0f }, { 0x40080400u } },
+	{ { -0.903225899f, 1.99999988f, 0.0f }, { 0x00080400u } },
+	{ { -0.903225899f, 1.74193537f, 0.0f }, { 0x00080400u } },
+	{ { -1.03225815f, 1.87096751f, 0.0f }, { 0x00080400u } },
+	{ { -1.03225815f, 1.99999988f, 0.0f }, { 0x40080400u } },
+	{ { -1.03225815f, 1.74193537f, 0.0f }, { 0x40080400u } },
+	{ { -0.903225899f, 1.61290324f, 0.0f }, { 0x40080400u } },
+	{ { -1.03225815f, 1.61290324f, 0.0f }, { 0x00080400u } },
+	{ { -1.16129041f, 1.87096751f, 0.0f }, { 0x40080400u } },
+	{ { -1.16129041f, 1.99999988f, 0.0f }, { 0x00080400u } },
+	{ { -1.16129041f, 1.74193537f, 0.0f }, { 0x00080400u } },
+	{ { -1.29032266f, 1.87096751f, 0.0f }, { 0x00080400u } },
+	{ { -1.29032266f, 1.99999988f, 0.0f }, { 0x40080400u } },
+	{ { -1.29032266f, 1.74193537f, 0.0f }, { 0x40080400u } },
+	{ { -1.16129041f, 1.61290324f, 0.0f }, { 0x40080400u } },
+	{ { -1.29032266f, 1.61290324f, 0.0f }, { 0x00080400u } },
+	{ { -1.41935492f, 1.87096751f, 0.0f }, { 0x40080400u } },
+	{ { -1.41935492f, 1.99999988f, 0.0f }, { 0x00080400u } },
+	{ { -1.41935492f, 1.74193537f, 0.0f }, { 0x00080400u } },
+	{ { -1.54838717f, 1.87096751f, 0.0f }, { 0x00080400u } },
+	{ { -1.54838717f, 1.99999988f, 0.0f }, { 0x40080400u } },
+	{ { -1.54838717f, 1.74193537f, 0.0f }, { 0x40080400u } },
+	{ { -1.41935492f, 1.61290324f, 0.0f }, { 0x40080400u } },
+	{ { -1.54838717f, 1.61290324f, 0.0f }, { 0x00080400u } },
+	{ { -1.67741942f, 1.87096751f, 0.0f }, { 0x40080400u } },
+	{ { -1.67741942f, 1.99999988f, 0.0f }, { 0x00080400u } },
+	{ { -1.67741942f, 1.74193537f, 0.0f }, { 0x00080400u } },
+	{ { -1.80645168f, 1.87096751f, 0.0f }, { 0x00080400u } },
+	{ { -1.80645168f, 1.99999988f, 0.0f }, { 0x40080400u } },
+	{ { -1.93548393f, 1.87096751f, 0.0f }, { 0x40080400u } },
+	{ { -1.93548393f, 1.99999988f, 0.0f }, { 0x00080400u } },
+	{ { -1.93548393f, 1.74193537f, 0.0f }, { 0x00080400u } },
+	{ { -1.80645168f, 1.74193537f, 0.0f }, { 0x40080400u } },
+	{ { -1.93548393f, 1.61290324f, 0.0f }, { 0x40080400u } },
+	{ { -1.80645168f, 1.61290324f, 0.0f }, { 0x00080400u } },
+	{ { -1.93548393f, 1.48387086f, 0.0f }, { 0x00080400u } },
+	{ { -1.67741942f, 1.61290324f, 0.0f }, { 0x40080400u } },
+	{ { -1.80645168f, 1.48387086f, 0.0f }, { 0x40080400u } },
+	{ { -1.93548393f, 1.35483849f, 0.0f }, { 0x40080400u } },
+	{ { -1.67741942f, 1.48387086f, 0.0f }, { 0x00080400u } },
+	{ { -1.80645168f, 1.35483849f, 0.0f }, { 0x00080400u } },
+	{ { -1.93548393f, 1.22580636f, 0.0f }, { 0x00080400u } },
+	{ { -1.54838717f, 1.48387086f, 0.0f }, { 0x40080400u } },
+	{ { -1.67741942f, 1.35483849f, 0.0f }, { 0x40080400u } },
+	{ { -1.80645168f, 1.22580636f, 0.0f }, { 0x40080400u } },
+	{ { -1.93548393f, 1.09677422f, 0.0f }, { 0x40080400u } },
+	{ { -1.41935492f, 1.48387086f, 0.0f }, { 0x00080400u } },
+	{ { -1.80645168f, 1.09677422f, 0.0f }, { 0x00080400u } },
+	{ { -1.93548393f, 0.967741847f, 0.0f }, { 0x00080400u } },
+	{ { -1.67741942f, 1.22580636f, 0.0f }, { 0x00080400u } },
+	{ { -1.54838717f, 1.35483849f, 0.0f }, { 0x00080400u } },
+	{ { -1.80645168f, 0.967741847f, 0.0f }, { 0x40080400u } },
+	{ { -1.93548393f, 0.838709474f, 0.0f }, { 0x40080400u } },
+	{ { -1.67741942f, 1.09677422f, 0.0f }, { 0x40080400u } },
+	{ { -1.54838717f, 1.22580636f, 0.0f }, { 0x40080400u } },
+	{ { -1.80645168f, 0.838709474f, 0.0f }, { 0x00080400u } },
+	{ { -1.93548393f, 0.709677339f, 0.0f }, { 0x00080400u } },
+	{ { -1.67741942f, 0.967741847f, 0.0f }, { 0x00080400u } },
+	{ { -1.80645168f, 0.709677339f, 0.0f }, { 0x40080400u } },
+	{ { -1.93548393f, 0.580645204f, 0.0f }, { 0x40080400u } },
+	{ { -1.67741942f, 0.838709474f, 0.0f }, { 0x40080400u } },
+	{ { -1.54838717f, 1.09677422f, 0.0f }, { 0x00080400u } },
+	{ { -1.80645168f, 0.580645204f, 0.0f }, { 0x00080400u } },
+	{ { -1.93548393f, 0.45161283f, 0.0f }, { 0x00080400u } },
+	{ { -1.67741942f, 0.709677339f, 0.0f }, { 0x00080400u } },
+	{ { -1.80645168f, 0.45161283f, 0.0f }, { 0x40080400u } },
+	{ { -1.93548393f, 0.322580457f, 0.0f }, { 0x40080400u } },
+	{ { -1.67741942f, 0.580645204f, 0.0f }, { 0x40080400u } },
+	{ { -1.80645168f, 0.322580457f, 0.0f }, { 0x00080400u } },
+	{ { -1.93548393f, 0.193548322f, 0.0f }, { 0x00080400u } },
+	{ { -1.67741942f, 0.45161283f, 0.0f }, { 0x00080400u } },
+	{ { -1.80645168f, 0.193548322f, 0.0f }, { 0x40080400u } },
+	{ { -1.93548393f, 0.0645160675f, 0.0f }, { 0x40080400u } },
+	{ { -1.67741942f, 0.322580457f, 0.0f }, { 0x40080400u } },
+	{ { -1.80645168f, 0.0645160675f, 0.0f }, { 0x00080400u } },
+	{ { -1.93548393f, -0.0645161867f, 0.0f }, { 0x00080400u } },
+	{ { -1.67741942f, 0.193548322f, 0.0f }, { 0x00080400u } },
+	{ { -1.80645168f, -0.0645161867f, 0.0f }, { 0x40080400u } },
+	{ { -1.93548393f, -0.193548441f, 0.0f }, { 0x40080400u } },
+	{ { -1.67741942f, 0.0645160675f, 0.0f }, { 0x40080400u } },
+	{ { -1.80645168f, -0.193548441f, 0.0f }, { 0x00080400u } },
+	{ { -1.93548393f, -0.322580695f, 0.0f }, { 0x00080400u } },
+	{ { -1.67741942f, -0.0645161867f, 0.0f }, { 0x00080400u } },
+	{ { -1.80645168f, -0.322580695f, 0.0f }, { 0x40080400u } },
+	{ { -1.93548393f, -0.451612949f, 0.0f }, { 0x40080400u } },
+	{ { -1.67741942f, -0.193548441f, 0.0f }, { 0x40080400u } },
+	{ { -1.80645168f, -0.451612949f, 0.0f }, { 0x00080400u } },
+	{ { -1.93548393f, -0.580645204f, 0.0f }, { 0x00080400u } },
+	{ { -1.67741942f, -0.322580695f, 0.0f }, { 0x00080400u } },
+	{ { -1.80645168f, -0.580645204f, 0.0f }, { 0x40080400u } },
+	{ { -1.93548393f, -0.709677458f, 0.0f }, { 0x40080400u } },
+	{ { -1.67741942f, -0.451612949f, 0.0f }, { 0x40080400u } },
+	{ { -1.80645168f, -0.709677458f, 0.0f }, { 0x00080400u } },
+	{ { -1.93548393f, -0.838709712f, 0.0f }, { 0x00080400u } },
+	{ { -1.67741942f, -0.580645204f, 0.0f }, { 0x00080400u } },
+	{ { -1.80645168f, -0.838709712f, 0.0f }, { 0x40080400u } },
+	{ { -1.93548393f, -0.967741966f, 0.0f }, { 0x40080400u } },
+	{ { -1.67741942f, -0.709677458f, 0.0f }, { 0x40080400u } },
+	{ { -1.80645168f, -0.967741966f, 0.0f }, { 0x00080400u } },
+	{ { -1.93548393f, -1.09677422f, 0.0f }, { 0x00080400u } },
+	{ { -1.67741942f, -0.838709712f, 0.0f }, { 0x00080400u } },
+	{ { -1.80645168f, -1.09677422f, 0.0f }, { 0x40080400u } },
+	{ { -1.93548393f, -1.22580647f, 0.0f }, { 0x40080400u } },
+	{ { -1.67741942f, -0.967741966f, 0.0f }, { 0x40080400u } },
+	{ { -1.80645168f, -1.22580647f, 0.0f }, { 0x00080400u } },
+	{ { -1.93548393f, -1.35483873f, 0.0f }, { 0x00080400u } },
+	{ { -1.67741942f, -1.09677422f, 0.0f }, { 0x00080400u } },
+	{ { -1.80645168f, -1.35483873f, 0.0f }, { 0x40080400u } },
+	{ { -1.93548393f, -1.48387098f, 0.0f }, { 0x40080400u } },
+	{ { -1.67741942f, -1.22580647f, 0.0f }, { 0x40080400u } },
+	{ { -1.80645168f, -1.48387098f, 0.0f }, { 0x00080400u } },
+	{ { -1.93548393f, -1.61290324f, 0.0f }, { 0x00080400u } },
+	{ { -1.67741942f, -1.35483873f, 0.0f }, { 0x00080400u } },
+	{ { -1.80645168f, -1.61290324f, 0.0f }, { 0x40080400u } },
+	{ { -1.93548393f, -1.74193549f, 0.0f }, { 0x40080400u } },
+	{ { -1.67741942f, -1.48387098f, 0.0f }, { 0x40080400u } },
+	{ { -1.80645168f, -1.74193549f, 0.0f }, { 0x00080400u } },
+	{ { -1.93548393f, -1.87096775f, 0.0f }, { 0x00080400u } },
+	{ { -1.80645168f, -1.87096775f, 0.0f }, { 0x40080400u } },
+	{ { -1.67741942f, -1.61290324f, 0.0f }, { 0x00080400u } },
+	{ { -1.67741942f, -1.74193549f, 0.0f }, { 0x40080400u } },
+	{ { -1.67741942f, -1.87096775f, 0.0f }, { 0x00080400u } },
+	{ { -1.54838717f, -1.48387098f, 0.0f }, { 0x00080400u } },
+	{ { -1.54838717f, -1.74193549f, 0.0f }, { 0x00080400u } },
+	{ { -1.54838717f, -1.87096775f, 0.0f }, { 0x40080400u } },
+	{ { -1.54838717f, -1.61290324f, 0.0f }, { 0x40080400u } },
+	{ { -1.41935492f, -1.74193549f, 0.0f }, { 0x40080400u } },
+	{ { -1.41935492f, -1.87096775f, 0.0f }, { 0x00080400u } },
+	{ { -1.41935492f, -1.61290324f, 0.0f }, { 0x00080400u } },
+	{ { -1.29032266f, -1.74193549f, 0.0f }, { 0x00080400u } },
+	{ { -1.29032266f, -1.87096775f, 0.0f }, { 0x40080400u } },
+	{ { -1.29032266f, -1.61290324f, 0.0f }, { 0x40080400u } },
+	{ { -1.41935492f, -1.48387098f, 0.0f }, { 0x40080400u } },
+	{ { -1.29032266f, -1.48387098f, 0.0f }, { 0x00080400u } },
+	{ { -1.16129041f, -1.61290324f, 0.0f }, { 0x00080400u } },
+	{ { -1.16129041f, -1.74193549f, 0.0f }, { 0x40080400u } },
+	{ { -1.16129041f, -1.87096775f, 0.0f }, { 0x00080400u } },
+	{ { -1.16129041f, -1.48387098f, 0.0f }, { 0x40080400u } },
+	{ { -1.03225815f, -1.74193549f, 0.0f }, { 0x00080400u } },
+	{ { -1.03225815f, -1.87096775f, 0.0f }, { 0x40080400u } },
+	{ { -1.03225815f, -1.61290324f, 0.0f }, { 0x40080400u } },
+	{ { -0.903225899f, -1.74193549f, 0.0f }, { 0x40080400u } },
+	{ { -0.903225899f, -1.87096775f, 0.0f }, { 0x00080400u } },
+	{ { -0.903225899f, -1.61290324f, 0.0f }, { 0x00080400u } },
+	{ { -1.03225815f, -1.48387098f, 0.0f }, { 0x00080400u } },
+	{ { -0.903225899f, -1.48387098f, 0.0f }, { 0x40080400u } },
+	{ { -0.774193645f, -1.61290324f, 0.0f }, { 0x40080400u } },
+	{ { -0.774193645f, -1.74193549f, 0.0f }, { 0x00080400u } },
+	{ { -0.774193645f, -1.87096775f, 0.0f }, { 0x40080400u } },
+	{ { -0.774193645f, -1.48387098f, 0.0f }, { 0x00080400u } },
+	{ { -0.64516139f, -1.74193549f, 0.0f }, { 0x40080400u } },
+	{ { -0.64516139f, -1.87096775f, 0.0f }, { 0x00080400u } },
+	{ { -0.64516139f, -1.61290324f, 0.0f }, { 0x00080400u } },
+	{ { -0.516129136f, -1.74193549f, 0.0f }, { 0x00080400u } },
+	{ { -0.516129136f, -1.87096775f, 0.0f }, { 0x40080400u } },
+	{ { -0.516129136f, -1.61290324f, 0.0f }, { 0x40080400u } },
+	{ { -0.64516139f, -1.48387098f, 0.0f }, { 0x40080400u } },
+	{ { -0.516129136f, -1.48387098f, 0.0f }, { 0x00080400u } },
+	{ { -0.387096882f, -1.61290324f, 0.0f }, { 0x00080400u } },
+	{ { -0.387096882f, -1.74193549f, 0.0f }, { 0x40080400u } },
+	{ { -0.387096882f, -1.87096775f, 0.0f }, { 0x00080400u } },
+	{ { -0.387096882f, -1.48387098f, 0.0f }, { 0x40080400u } },
+	{ { -0.258064628f, -1.74193549f, 0.0f }, { 0x00080400u } },
+	{ { -0.258064628f, -1.87096775f, 0.0f }, { 0x40080400u } },
+	{ { -0.258064628f, -1.61290324f, 0.0f }, { 0x40080400u } },
+	{ { -0.129032373f, -1.74193549f, 0.0f }, { 0x40080400u } },
+	{ { -0.129032373f, -1.87096775f, 0.0f }, { 0x00080400u } },
+	{ { -0.129032373f, -1.61290324f, 0.0f }, { 0x00080400u } },
+	{ { -0.258064628f, -1.48387098f, 0.0f }, { 0x00080400u } },
+	{ { -0.129032373f, -1.48387098f, 0.0f }, { 0x40080400u } },
+	{ { -1.1920929e-07f, -1.61290324f, 0.0f }, { 0x40080400u } },
+	{ { -1.1920929e-07f, -1.74193549f, 0.0f }, { 0x00080400u } },
+	{ { -1.1920929e-07f, -1.87096775f, 0.0f }, { 0x40080400u } },
+	{ { -1.1920929e-07f, -1.48387098f, 0.0f }, { 0x00080400u } },
+	{ { 0.129032135f, -1.74193549f, 0.0f }, { 0x40080400u } },
+	{ { 0.129032135f, -1.87096775f, 0.0f }, { 0x00080400u } },
+	{ { 0.129032135f, -1.61290324f, 0.0f }, { 0x00080400u } },
+	{ { 0.25806427f, -1.74193549f, 0.0f }, { 0x00080400u } },
+	{ { 0.25806427f, -1.87096775f, 0.0f }, { 0x40080400u } },
+	{ { 0.25806427f, -1.61290324f, 0.0f }, { 0x40080400u } },
+	{ { 0.129032135f, -1.48387098f, 0.0f }, { 0x40080400u } },
+	{ { 0.25806427f, -1.48387098f, 0.0f }, { 0x00080400u } },
+	{ { 0.387096643f, -1.61290324f, 0.0f }, { 0x00080400u } },
+	{ { 0.387096643f, -1.74193549f, 0.0f }, { 0x40080400u } },
+	{ { 0.387096643f, -1.87096775f, 0.0f }, { 0x00080400u } },
+	{ { 0.387096643f, -1.48387098f, 0.0f }, { 0x40080400u } },
+	{ { 0.516129017f, -1.74193549f, 0.0f }, { 0x00080400u } },
+	{ { 0.516129017f, -1.87096775f, 0.0f }, { 0x40080400u } },
+	{ { 0.516129017f, -1.61290324f, 0.0f }, { 0x40080400u } },
+	{ { 0.645161152f, -1.74193549f, 0.0f }, { 0x40080400u } },
+	{ { 0.645161152f, -1.87096775f, 0.0f }, { 0x00080400u } },
+	{ { 0.645161152f, -1.61290324f, 0.0f }, { 0x00080400u } },
+	{ { 0.516129017f, -1.48387098f, 0.0f }, { 0x00080400u } },
+	{ { 0.645161152f, -1.48387098f, 0.0f }, { 0x40080400u } },
+	{ { 0.774193287f, -1.61290324f, 0.0f }, { 0x40080400u } },
+	{ { 0.774193287f, -1.74193549f, 0.0f }, { 0x00080400u } },
+	{ { 0.774193287f, -1.87096775f, 0.0f }, { 0x40080400u } },
+	{ { 0.774193287f, -1.48387098f, 0.0f }, { 0x00080400u } },
+	{ { 0.90322566f, -1.74193549f, 0.0f }, { 0x40080400u } },
+	{ { 0.90322566f, -1.87096775f, 0.0f }, { 0x00080400u } },
+	{ { 0.90322566f, -1.61290324f, 0.0f }, { 0x00080400u } },
+	{ { 1.03225803f, -1.74193549f, 0.0f }, { 0x00080400u } },
+	{ { 1.03225803f, -1.87096775f, 0.0f }, { 0x40080400u } },
+	{ { 1.03225803f, -1.61290324f, 0.0f }, { 0x40080400u } },
+	{ { 0.90322566f, -1.48387098f, 0.0f }, { 0x40080400u } },
+	{ { 1.03225803f, -1.48387098f, 0.0f }, { 0x00080400u } },
+	{ { 1.16129017f, -1.61290324f, 0.0f }, { 0x00080400u } },
+	{ { 1.16129017f, -1.74193549f, 0.0f }, { 0x40080400u } },
+	{ { 1.16129017f, -1.87096775f, 0.0f }, { 0x00080400u } },
+	{ { 1.16129017f, -1.48387098f, 0.0f }, { 0x40080400u } },
+	{ { 1.2903223f, -1.74193549f, 0.0f }, { 0x00080400u } },
+	{ { 1.2903223f, -1.61290324f, 0.0f }, { 0x40080400u } },
+	{ { 1.41935468f, -1.61290324f, 0.0f }, { 0x00080400u } },
+	{ { 1.41935468f, -1.48387098f, 0.0f }, { 0x40080400u } },
+	{ { 1.2903223f, -1.48387098f, 0.0f }, { 0x00080400u } },
+	{ { 1.41935468f, -1.35483873f, 0.0f }, { 0x00080400u } },
+	{ { 1.2903223f, -1.35483873f, 0.0f }, { 0x40080400u } },
+	{ { 1.41935468f, -1.22580647f, 0.0f }, { 0x40080400u } },
+	{ { 1.16129017f, -1.35483873f, 0.0f }, { 0x00080400u } },
+	{ { 1.2903223f, -1.22580647f, 0.0f }, { 0x00080400u } },
+	{ { 1.41935468f, -1.09677422f, 0.0f }, { 0x00080400u } },
+	{ { 1.03225803f, -1.35483873f, 0.0f }, { 0x40080400u } },
+	{ { 1.41935468f, -0.967741966f, 0.0f }, { 0x40080400u } },
+	{ { 1.2903223f, -1.09677422f, 0.0f }, { 0x40080400u } },
+	{ { 1.16129017f, -1.22580647f, 0.0f }, { 0x40080400u } },
+	{ { 1.41935468f, -0.838709712f, 0.0f }, { 0x00080400u } },
+	{ { 1.2903223f, -0.967741966f, 0.0f }, { 0x00080400u } },
+	{ { 1.16129017f, -1.09677422f, 0.0f }, { 0x00080400u } },
+	{ { 1.41935468f, -0.709677458f, 0.0f }, { 0x40080400u } },
+	{ { 1.2903223f, -0.838709712f, 0.0f }, { 0x40080400u } },
+	{ { 1.41935468f, -0.580645204f, 0.0f }, { 0x00080400u } },
+	{ { 1.2903223f, -0.709677458f, 0.0f }, { 0x00080400u } },
+	{ { 1.16129017f, -0.967741966f, 0.0f }, { 0x40080400u } },
+	{ { 1.16129017f, -0.838709712f, 0.0f }, { 0x00080400u } },
+	{ { 1.41935468f, -0.451612949f, 0.0f }, { 0x40080400u } },
+	{ { 1.2903223f, -0.580645204f, 0.0f }, { 0x40080400u } },
+	{ { 1.41935468f, -0.322580695f, 0.0f }, { 0x00080400u } },
+	{ { 1.2903223f, -0.451612949f, 0.0f }, { 0x00080400u } },
+	{ { 1.16129017f, -0.709677458f, 0.0f }, { 0x40080400u } },
+	{ { 1.16129017f, -0.580645204f, 0.0f }, { 0x00080400u } },
+	{ { 1.41935468f, -0.193548441f, 0.0f }, { 0x40080400u } },
+	{ { 1.2903223f, -0.322580695f, 0.0f }, { 0x40080400u } },
+	{ { 1.41935468f, -0.0645161867f, 0.0f }, { 0x00080400u } },
+	{ { 1.2903223f, -0.193548441f, 0.0f }, { 0x00080400u } },
+	{ { 1.16129017f, -0.451612949f, 0.0f }, { 0x40080400u } },
+	{ { 1.16129017f, -0.322580695f, 0.0f }, { 0x00080400u } },
+	{ { 1.41935468f, 0.0645160675f, 0.0f }, { 0x40080400u } },
+	{ { 1.2903223f, -0.0645161867f, 0.0f }, { 0x40080400u } },
+	{ { 1.41935468f, 0.193548322f, 0.0f }, { 0x00080400u } },
+	{ { 1.2903223f, 0.0645160675f, 0.0f }, { 0x00080400u } },
+	{ { 1.16129017f, -0.193548441f, 0.0f }, { 0x40080400u } },
+	{ { 1.16129017f, -0.0645161867f, 0.0f }, { 0x00080400u } },
+	{ { 1.41935468f, 0.322580457f, 0.0f }, { 0x40080400u } },
+	{ { 1.2903223f, 0.193548322f, 0.0f }, { 0x40080400u } },
+	{ { 1.41935468f, 0.45161283f, 0.0f }, { 0x00080400u } },
+	{ { 1.2903223f, 0.322580457f, 0.0f }, { 0x00080400u } },
+	{ { 1.16129017f, 0.0645160675f, 0.0f }, { 0x40080400u } },
+	{ { 1.16129017f, 0.193548322f, 0.0f }, { 0x00080400u } },
+	{ { 1.41935468f, 0.580645204f, 0.0f }, { 0x40080400u } },
+	{ { 1.2903223f, 0.45161283f, 0.0f }, { 0x40080400u } },
+	{ { 1.41935468f, 0.709677339f, 0.0f }, { 0x00080400u } },
+	{ { 1.2903223f, 0.580645204f, 0.0f }, { 0x00080400u } },
+	{ { 1.16129017f, 0.322580457f, 0.0f }, { 0x40080400u } },
+	{ { 1.16129017f, 0.45161283f, 0.0f }, { 0x00080400u } },
+	{ { 1.41935468f, 0.838709474f, 0.0f }, { 0x40080400u } },
+	{ { 1.2903223f, 0.709677339f, 0.0f }, { 0x40080400u } },
+	{ { 1.41935468f, 0.967741847f, 0.0f }, { 0x00080400u } },
+	{ { 1.2903223f, 0.838709474f, 0.0f }, { 0x00080400u } },
+	{ { 1.16129017f, 0.580645204f, 0.0f }, { 0x40080400u } },
+	{ { 1.16129017f, 0.709677339f, 0.0f }, { 0x00080400u } },
+	{ { 1.41935468f, 1.09677422f, 0.0f }, { 0x40080400u } },
+	{ { 1.2903223f, 0.967741847f, 0.0f }, { 0x40080400u } },
+	{ { 1.41935468f, 1.22580636f, 0.0f }, { 0x00080400u } },
+	{ { 1.2903223f, 1.09677422f, 0.0f }, { 0x00080400u } },
+	{ { 1.16129017f, 0.838709474f, 0.0f }, { 0x40080400u } },
+	{ { 1.16129017f, 0.967741847f, 0.0f }, { 0x00080400u } },
+	{ { 1.2903223f, 1.22580636f, 0.0f }, { 0x40080400u } },
+	{ { 1.03225803f, 0.709677339f, 0.0f }, { 0x40080400u } },
+	{ { 1.16129017f, 1.09677422f, 0.0f }, { 0x40080400u } },
+	{ { 1.03225803f, 0.838709474f, 0.0f }, { 0x00080400u } },
+	{ { 1.03225803f, 0.967741847f, 0.0f }, { 0x40080400u } },
+	{ { 1.03225803f, 0.580645204f, 0.0f }, { 0x00080400u } },
+	{ { 0.90322566f, 0.709677339f, 0.0f }, { 0x00080400u } },
+	{ { 1.03225803f, 0.45161283f, 0.0f }, { 0x40080400u } },
+	{ { 0.90322566f, 0.580645204f, 0.0f }, { 0x40080400u } },
+	{ { 0.90322566f, 0.45161283f, 0.0f }, { 0x00080400u } },
+	{ { 1.03225803f, 0.322580457f, 0.0f }, { 0x00080400u } },
+	{ { 0.90322566f, 0.322580457f, 0.0f }, { 0x40080400u } },
+	{ { 1.03225803f, 0.193548322f, 0.0f }, { 0x40080400u } },
+	{ { 0.90322566f, 0.193548322f, 0.0f }, { 0x00080400u } },
+	{ { 1.03225803f, 0.0645160675f, 0.0f }, { 0x00080400u } },
+	{ { 0.90322566f, 0.0645160675f, 0.0f }, { 0x40080400u } },
+	{ { 1.03225803f, -0.0645161867f, 0.0f }, { 0x40080400u } },
+	{ { 0.90322566f, -0.0645161867f, 0.0f }, { 0x00080400u } },
+	{ { 1.03225803f, -0.193548441f, 0.0f }, { 0x00080400u } },
+	{ { 0.90322566f, -0.193548441f, 0.0f }, { 0x40080400u } },
+	{ { 1.03225803f, -0.322580695f, 0.0f }, { 0x40080400u } },
+	{ { 0.90322566f, -0.322580695f, 0.0f }, { 0x00080400u } },
+	{ { 1.03225803f, -0.451612949f, 0.0f }, { 0x00080400u } },
+	{ { 0.90322566f, -0.451612949f, 0.0f }, { 0x40080400u } },
+	{ { 1.03225803f, -0.580645204f, 0.0f }, { 0x40080400u } },
+	{ { 0.90322566f, -0.580645204f, 0.0f }, { 0x00080400u } },
+	{ { 1.03225803f, -0.709677458f, 0.0f }, { 0x00080400u } },
+	{ { 0.90322566f, -0.709677458f, 0.0f }, { 0x40080400u } },
+	{ { 1.03225803f, -0.838709712f, 0.0f }, { 0x40080400u } },
+	{ { 0.90322566f, -0.838709712f, 0.0f }, { 0x00080400u } },
+	{ { 1.03225803f, -0.967741966f, 0.0f }, { 0x00080400u } },
+	{ { 0.90322566f, -0.967741966f, 0.0f }, { 0x40080400u } },
+	{ { 1.03225803f, -1.09677422f, 0.0f }, { 0x40080400u } },
+	{ { 0.90322566f, -1.09677422f, 0.0f }, { 0x00080400u } },
+	{ { 1.03225803f, -1.22580647f, 0.0f }, { 0x00080400u } },
+	{ { 0.90322566f, -1.22580647f, 0.0f }, { 0x40080400u } },
+	{ { 0.90322566f, -1.35483873f, 0.0f }, { 0x00080400u } },
+	{ { 0.774193287f, -1.35483873f, 0.0f }, { 0x40080400u } },
+	{ { 0.774193287f, -1.22580647f, 0.0f }, { 0x00080400u } },
+	{ { 0.645161152f, -1.35483873f, 0.0f }, { 0x00080400u } },
+	{ { 0.774193287f, -1.09677422f, 0.0f }, { 0x40080400u } },
+	{ { 0.645161152f, -1.22580647f, 0.0f }, { 0x40080400u } },
+	{ { 0.516129017f, -1.35483873f, 0.0f }, { 0x40080400u } },
+	{ { 0.774193287f, -0.967741966f, 0.0f }, { 0x00080400u } },
+	{ { 0.387096643f, -1.35483873f, 0.0f }, { 0x00080400u } },
+	{ { 0.516129017f, -1.22580647f, 0.0f }, { 0x00080400u } },
+	{ { 0.645161152f, -1.09677422f, 0.0f }, { 0x00080400u } },
+	{ { 0.25806427f, -1.35483873f, 0.0f }, { 0x40080400u } },
+	{ { 0.387096643f, -1.22580647f, 0.0f }, { 0x40080400u } },
+	{ { 0.516129017f, -1.09677422f, 0.0f }, { 0x40080400u } },
+	{ { 0.129032135f, -1.35483873f, 0.0f }, { 0x00080400u } },
+	{ { 0.25806427f, -1.22580647f, 0.0f }, { 0x00080400u } },
+	{ { -1.1920929e-07f, -1.35483873f, 0.0f }, { 0x40080400u } },
+	{ { 0.129032135f, -1.22580647f, 0.0f }, { 0x40080400u } },
+	{ { 0.387096643f, -1.09677422f, 0.0f }, { 0x00080400u } },
+	{ { -0.129032373f, -1.35483873f, 0.0f }, { 0x00080400u } },
+	{ { -1.1920929e-07f, -1.22580647f, 0.0f }, { 0x00080400u } },
+	{ { 0.25806427f, -1.09677422f, 0.0f }, { 0x40080400u } },
+	{ { -0.258064628f, -1.35483873f, 0.0f }, { 0x40080400u } },
+	{ { -0.129032373f, -1.22580647f, 0.0f }, { 0x40080400u } },
+	{ { 0.129032135f, -1.09677422f, 0.0f }, { 0x00080400u } },
+	{ { -0.387096882f, -1.35483873f, 0.0f }, { 0x00080400u } },
+	{ { -0.258064628f, -1.22580647f, 0.0f }, { 0x00080400u } },
+	{ { -1.1920929e-07f, -1.09677422f, 0.0f }, { 0x40080400u } },
+	{ { -0.516129136f, -1.35483873f, 0.0f }, { 0x40080400u } },
+	{ { -0.387096882f, -1.22580647f, 0.0f }, { 0x40080400u } },
+	{ { -0.129032373f, -1.09677422f, 0.0f }, { 0x00080400u } },
+	{ { -0.64516139f, -1.35483873f, 0.0f }, { 0x00080400u } },
+	{ { -0.516129136f, -1.22580647f, 0.0f }, { 0x00080400u } },
+	{ { -0.258064628f, -1.09677422f, 0.0f }, { 0x40080400u } },
+	{ { -0.774193645f, -1.35483873f, 0.0f }, { 0x40080400u } },
+	{ { -0.64516139f, -1.22580647f, 0.0f }, { 0x40080400u } },
+	{ { -0.387096882f, -1.09677422f, 0.0f }, { 0x00080400u } },
+	{ { -0.903225899f, -1.35483873f, 0.0f }, { 0x00080400u } },
+	{ { -0.774193645f, -1.22580647f, 0.0f }, { 0x00080400u } },
+	{ { -0.516129136f, -1.09677422f, 0.0f }, { 0x40080400u } },
+	{ { -1.03225815f, -1.35483873f, 0.0f }, { 0x40080400u } },
+	{ { -0.903225899f, -1.22580647f, 0.0f }, { 0x40080400u } },
+	{ { -0.64516139f, -1.09677422f, 0.0f }, { 0x00080400u } },
+	{ { -1.16129041f, -1.35483873f, 0.0f }, { 0x00080400u } },
+	{ { -1.03225815f, -1.22580647f, 0.0f }, { 0x00080400u } },
+	{ { -0.774193645f, -1.09677422f, 0.0f }, { 0x40080400u } },
+	{ { -1.29032266f, -1.35483873f, 0.0f }, { 0x40080400u } },
+	{ { -1.16129041f, -1.22580647f, 0.0f }, { 0x40080400u } },
+	{ { -0.903225899f, -1.09677422f, 0.0f }, { 0x00080400u } },
+	{ { -1.41935492f, -1.35483873f, 0.0f }, { 0x00080400u } },
+	{ { -1.29032266f, -1.22580647f, 0.0f }, { 0x00080400u } },
+	{ { -1.03225815f, -1.09677422f, 0.0f }, { 0x40080400u } },
+	{ { -1.54838717f, -1.35483873f, 0.0f }, { 0x40080400u } },
+	{ { -1.41935492f, -1.22580647f, 0.0f }, { 0x40080400u } },
+	{ { -1.54838717f, -1.22580647f, 0.0f }, { 0x00080400u } },
+	{ { -1.29032266f, -1.09677422f, 0.0f }, { 0x40080400u } },
+	{ { -1.54838717f, -1.09677422f, 0.0f }, { 0x40080400u } },
+	{ { -1.41935492f, -1.09677422f, 0.0f }, { 0x00080400u } },
+	{ { -1.54838717f, -0.967741966f, 0.0f }, { 0x00080400u } },
+	{ { -1.41935492f, -0.967741966f, 0.0f }, { 0x40080400u } },
+	{ { -1.54838717f, -0.838709712f, 0.0f }, { 0x40080400u } },
+	{ { -1.41935492f, -0.838709712f, 0.0f }, { 0x00080400u } },
+	{ { -1.29032266f, -0.967741966f, 0.0f }, { 0x00080400u } },
+	{ { -1.29032266f, -0.838709712f, 0.0f }, { 0x40080400u } },
+	{ { -1.41935492f, -0.709677458f, 0.0f }, { 0x40080400u } },
+	{ { -1.54838717f, -0.709677458f, 0.0f }, { 0x00080400u } },
+	{ { -1.29032266f, -0.709677458f, 0.0f }, { 0x00080400u } },
+	{ { -1.54838717f, -0.580645204f, 0.0f }, { 0x40080400u } },
+	{ { -1.41935492f, -0.580645204f, 0.0f }, { 0x00080400u } },
+	{ { -1.54838717f, -0.451612949f, 0.0f }, { 0x00080400u } },
+	{ { -1.41935492f, -0.451612949f, 0.0f }, { 0x40080400u } },
+	{ { -1.29032266f, -0.580645204f, 0.0f }, { 0x40080400u } },
+	{ { -1.29032266f, -0.451612949f, 0.0f }, { 0x00080400u } },
+	{ { -1.41935492f, -0.322580695f, 0.0f }, { 0x00080400u } },
+	{ { -1.54838717f, -0.322580695f, 0.0f }, { 0x40080400u } },
+	{ { -1.29032266f, -0.322580695f, 0.0f }, { 0x40080400u } },
+	{ { -1.54838717f, -0.193548441f, 0.0f }, { 0x00080400u } },
+	{ { -1.41935492f, -0.193548441f, 0.0f }, { 0x40080400u } },
+	{ { -1.54838717f, -0.0645161867f, 0.0f }, { 0x40080400u } },
+	{ { -1.41935492f, -0.0645161867f, 0.0f }, { 0x00080400u } },
+	{ { -1.29032266f, -0.193548441f, 0.0f }, { 0x00080400u } },
+	{ { -1.29032266f, -0.0645161867f, 0.0f }, { 0x40080400u } },
+	{ { -1.41935492f, 0.0645160675f, 0.0f }, { 0x40080400u } },
+	{ { -1.54838717f, 0.0645160675f, 0.0f }, { 0x00080400u } },
+	{ { -1.29032266f, 0.0645160675f, 0.0f }, { 0x00080400u } },
+	{ { -1.54838717f, 0.193548322f, 0.0f }, { 0x40080400u } },
+	{ { -1.41935492f, 0.193548322f, 0.0f }, { 0x00080400u } },
+	{ { -1.54838717f, 0.322580457f, 0.0f }, { 0x00080400u } },
+	{ { -1.41935492f, 0.322580457f, 0.0f }, { 0x40080400u } },
+	{ { -1.29032266f, 0.193548322f, 0.0f }, { 0x40080400u } },
+	{ { -1.29032266f, 0.322580457f, 0.0f }, { 0x00080400u } },
+	{ { -1.41935492f, 0.45161283f, 0.0f }, { 0x00080400u } },
+	{ { -1.54838717f, 0.45161283f, 0.0f }, { 0x40080400u } },
+	{ { -1.29032266f, 0.45161283f, 0.0f }, { 0x40080400u } },
+	{ { -1.54838717f, 0.580645204f, 0.0f }, { 0x00080400u } },
+	{ { -1.41935492f, 0.580645204f, 0.0f }, { 0x40080400u } },
+	{ { -1.54838717f, 0.709677339f, 0.0f }, { 0x40080400u } },
+	{ { -1.41935492f, 0.709677339f, 0.0f }, { 0x00080400u } },
+	{ { -1.29032266f, 0.580645204f, 0.0f }, { 0x00080400u } },
+	{ { -1.29032266f, 0.709677339f, 0.0f }, { 0x40080400u } },
+	{ { -1.41935492f, 0.838709474f, 0.0f }, { 0x40080400u } },
+	{ { -1.54838717f, 0.838709474f, 0.0f }, { 0x00080400u } },
+	{ { -1.29032266f, 0.838709474f, 0.0f }, { 0x00080400u } },
+	{ { -1.54838717f, 0.967741847f, 0.0f }, { 0x40080400u } },
+	{ { -1.41935492f, 0.967741847f, 0.0f }, { 0x00080400u } },
+	{ { -1.41935492f, 1.09677422f, 0.0f }, { 0x40080400u } },
+	{ { -1.29032266f, 0.967741847f, 0.0f }, { 0x40080400u } },
+	{ { -1.29032266f, 1.09677422f, 0.0f }, { 0x00080400u } },
+	{ { -1.41935492f, 1.22580636f, 0.0f }, { 0x00080400u } },
+	{ { -1.29032266f, 1.22580636f, 0.0f }, { 0x40080400u } },
+	{ { -1.41935492f, 1.35483849f, 0.0f }, { 0x40080400u } },
+	{ { -1.29032266f, 1.35483849f, 0.0f }, { 0x00080400u } },
+	{ { -1.29032266f, 1.48387086f, 0.0f }, { 0x40080400u } },
+	{ { -1.16129041f, 1.48387086f, 0.0f }, { 0x00080400u } },
+	{ { -1.16129041f, 1.35483849f, 0.0f }, { 0x40080400u } },
+	{ { -1.03225815f, 1.48387086f, 0.0f }, { 0x40080400u } },
+	{ { -1.16129041f, 1.22580636f, 0.0f }, { 0x00080400u } },
+	{ { -1.03225815f, 1.35483849f, 0.0f }, { 0x00080400u } },
+	{ { -0.903225899f, 1.48387086f, 0.0f }, { 0x00080400u } },
+	{ { -1.16129041f, 1.09677422f, 0.0f }, { 0x40080400u } },
+	{ { -1.03225815f, 1.22580636f, 0.0f }, { 0x40080400u } },
+	{ { -0.903225899f, 1.35483849f, 0.0f }, { 0x40080400u } },
+	{ { -0.774193645f, 1.48387086f, 0.0f }, { 0x40080400u } },
+	{ { -0.903225899f, 1.22580636f, 0.0f }, { 0x00080400u } },
+	{ { -0.64516139f, 1.48387086f, 0.0f }, { 0x00080400u } },
+	{ { -0.774193645f, 1.35483849f, 0.0f }, { 0x00080400u } },
+	{ { -0.516129136f, 1.48387086f, 0.0f }, { 0x40080400u } },
+	{ { -0.64516139f, 1.35483849f, 0.0f }, { 0x40080400u } },
+	{ { -0.774193645f, 1.22580636f, 0.0f }, { 0x40080400u } },
+	{ { -0.387096882f, 1.48387086f, 0.0f }, { 0x00080400u } },
+	{ { -0.516129136f, 1.35483849f, 0.0f }, { 0x00080400u } },
+	{ { -0.64516139f, 1.22580636f, 0.0f }, { 0x00080400u } },
+	{ { -0.258064628f, 1.48387086f, 0.0f }, { 0x40080400u } },
+	{ { -0.387096882f, 1.35483849f, 0.0f }, { 0x40080400u } },
+	{ { -0.516129136f, 1.22580636f, 0.0f }, { 0x40080400u } },
+	{ { -0.129032373f, 1.48387086f, 0.0f }, { 0x00080400u } },
+	{ { -0.258064628f, 1.35483849f, 0.0f }, { 0x00080400u } },
+	{ { -0.387096882f, 1.22580636f, 0.0f }, { 0x00080400u } },
+	{ { -1.1920929e-07f, 1.48387086f, 0.0f }, { 0x40080400u } },
+	{ { -0.129032373f, 1.35483849f, 0.0f }, { 0x40080400u } },
+	{ { -0.258064628f, 1.22580636f, 0.0f }, { 0x40080400u } },
+	{ { 0.129032135f, 1.48387086f, 0.0f }, { 0x00080400u } },
+	{ { -1.1920929e-07f, 1.35483849f, 0.0f }, { 0x00080400u } },
+	{ { -0.129032373f, 1.22580636f, 0.0f }, { 0x00080400u } },
+	{ { 0.25806427f, 1.48387086f, 0.0f }, { 0x40080400u } },
+	{ { 0.129032135f, 1.35483849f, 0.0f }, { 0x40080400u } },
+	{ { -1.1920929e-07f, 1.22580636f, 0.0f }, { 0x40080400u } },
+	{ { 0.387096643f, 1.48387086f, 0.0f }, { 0x00080400u } },
+	{ { 0.25806427f, 1.35483849f, 0.0f }, { 0x00080400u } },
+	{ { 0.129032135f, 1.22580636f, 0.0f }, { 0x00080400u } },
+	{ { 0.516129017f, 1.48387086f, 0.0f }, { 0x40080400u } },
+	{ { 0.387096643f, 1.35483849f, 0.0f }, { 0x40080400u } },
+	{ { 0.25806427f, 1.22580636f, 0.0f }, { 0x40080400u } },
+	{ { 0.645161152f, 1.48387086f, 0.0f }, { 0x00080400u } },
+	{ { 0.516129017f, 1.35483849f, 0.0f }, { 0x00080400u } },
+	{ { 0.387096643f, 1.22580636f, 0.0f }, { 0x00080400u } },
+	{ { 0.774193287f, 1.48387086f, 0.0f }, { 0x40080400u } },
+	{ { 0.645161152f, 1.35483849f, 0.0f }, { 0x40080400u } },
+	{ { 0.516129017f, 1.22580636f, 0.0f }, { 0x40080400u } },
+	{ { 0.90322566f, 1.48387086f, 0.0f }, { 0x00080400u } },
+	{ { 0.774193287f, 1.35483849f, 0.0f }, { 0x00080400u } },
+	{ { 0.645161152f, 1.22580636f, 0.0f }, { 0x00080400u } },
+	{ { 1.03225803f, 1.48387086f, 0.0f }, { 0x40080400u } },
+	{ { 0.90322566f, 1.35483849f, 0.0f }, { 0x40080400u } },
+	{ { 0.774193287f, 1.22580636f, 0.0f }, { 0x40080400u } },
+	{ { 1.16129017f, 1.48387086f, 0.0f }, { 0x00080400u } },
+	{ { 1.03225803f, 1.35483849f, 0.0f }, { 0x00080400u } },
+	{ { 0.90322566f, 1.22580636f, 0.0f }, { 0x00080400u } },
+	{ { 1.2903223f, 1.48387086f, 0.0f }, { 0x40080400u } },
+	{ { 1.16129017f, 1.35483849f, 0.0f }, { 0x40080400u } },
+	{ { 1.03225803f, 1.22580636f, 0.0f }, { 0x40080400u } },
+	{ { 1.41935468f, 1.48387086f, 0.0f }, { 0x00080400u } },
+	{ { 1.2903223f, 1.35483849f, 0.0f }, { 0x00080400u } },
+	{ { 1.16129017f, 1.22580636f, 0.0f }, { 0x00080400u } },
+	{ { 1.54838705f, 1.48387086f, 0.0f }, { 0x40080400u } },
+	{ { 1.41935468f, 1.35483849f, 0.0f }, { 0x40080400u } },
+	{ { 1.03225803f, 1.09677422f, 0.0f }, { 0x00080400u } },
+	{ { 0.90322566f, 1.09677422f, 0.0f }, { 0x40080400u } },
+	{ { 0.90322566f, 0.967741847f, 0.0f }, { 0x00080400u } },
+	{ { 0.774193287f, 1.09677422f, 0.0f }, { 0x00080400u } },
+	{ { 0.774193287f, 0.967741847f, 0.0f }, { 0x40080400u } },
+	{ { 0.90322566f, 0.838709474f, 0.0f }, { 0x40080400u } },
+	{ { 0.774193287f, 0.838709474f, 0.0f }, { 0x00080400u } },
+	{ { 0.774193287f, 0.709677339f, 0.0f }, { 0x40080400u } },
+	{ { 0.774193287f, 0.580645204f, 0.0f }, { 0x00080400u } },
+	{ { 0.645161152f, 0.709677339f, 0.0f }, { 0x00080400u } },
+	{ { 0.774193287f, 0.45161283f, 0.0f }, { 0x40080400u } },
+	{ { 0.645161152f, 0.580645204f, 0.0f }, { 0x40080400u } },
+	{ { 0.645161152f, 0.45161283f, 0.0f }, { 0x00080400u } },
+	{ { 0.774193287f, 0.322580457f, 0.0f }, { 0x00080400u } },
+	{ { 0.645161152f, 0.322580457f, 0.0f }, { 0x40080400u } },
+	{ { 0.774193287f, 0.193548322f, 0.0f }, { 0x40080400u } },
+	{ { 0.645161152f, 0.193548322f, 0.0f }, { 0x00080400u } },
+	{ { 0.774193287f, 0.0645160675f, 0.0f }, { 0x00080400u } },
+	{ { 0.645161152f, 0.0645160675f, 0.0f }, { 0x40080400u } },
+	{ { 0.774193287f, -0.0645161867f, 0.0f }, { 0x40080400u } },
+	{ { 0.645161152f, -0.0645161867f, 0.0f }, { 0x00080400u } },
+	{ { 0.774193287f, -0.193548441f, 0.0f }, { 0x00080400u } },
+	{ { 0.645161152f, -0.193548441f, 0.0f }, { 0x40080400u } },
+	{ { 0.774193287f, -0.322580695f, 0.0f }, { 0x40080400u } },
+	{ { 0.645161152f, -0.322580695f, 0.0f }, { 0x00080400u } },
+	{ { 0.774193287f, -0.451612949f, 0.0f }, { 0x00080400u } },
+	{ { 0.645161152f, -0.451612949f, 0.0f }, { 0x40080400u } },
+	{ { 0.774193287f, -0.580645204f, 0.0f }, { 0x40080400u } },
+	{ { 0.645161152f, -0.580645204f, 0.0f }, { 0x00080400u } },
+	{ { 0.774193287f, -0.709677458f, 0.0f }, { 0x00080400u } },
+	{ { 0.645161152f, -0.709677458f, 0.0f }, { 0x40080400u } },
+	{ { 0.774193287f, -0.838709712f, 0.0f }, { 0x40080400u } },
+	{ { 0.645161152f, -0.838709712f, 0.0f }, { 0x00080400u } },
+	{ { 0.645161152f, -0.967741966f, 0.0f }, { 0x40080400u } },
+	{ { 0.516129017f, -0.967741966f, 0.0f }, { 0x00080400u } },
+	{ { 0.516129017f, -0.838709712f, 0.0f }, { 0x40080400u } },
+	{ { 0.387096643f, -0.967741966f, 0.0f }, { 0x40080400u } },
+	{ { 0.516129017f, -0.709677458f, 0.0f }, { 0x00080400u } },
+	{ { 0.387096643f, -0.838709712f, 0.0f }, { 0x00080400u } },
+	{ { 0.25806427f, -0.967741966f, 0.0f }, { 0x00080400u } },
+	{ { 0.516129017f, -0.580645204f, 0.0f }, { 0x40080400u } },
+	{ { 0.129032135f, -0.967741966f, 0.0f }, { 0x40080400u } },
+	{ { 0.25806427f, -0.838709712f, 0.0f }, { 0x40080400u } },
+	{ { 0.387096643f, -0.709677458f, 0.0f }, { 0x40080400u } },
+	{ { -1.1920929e-07f, -0.967741966f, 0.0f }, { 0x00080400u } },
+	{ { 0.129032135f, -0.838709712f, 0.0f }, { 0x00080400u } },
+	{ { 0.25806427f, -0.709677458f, 0.0f }, { 0x00080400u } },
+	{ { -0.129032373f, -0.967741966f, 0.0f }, { 0x40080400u } },
+	{ { -1.1920929e-07f, -0.838709712f, 0.0f }, { 0x40080400u } },
+	{ { -0.258064628f, -0.967741966f, 0.0f }, { 0x00080400u } },
+	{ { -0.129032373f, -0.838709712f, 0.0f }, { 0x00080400u } },
+	{ { 0.129032135f, -0.709677458f, 0.0f }, { 0x40080400u } },
+	{ { -0.387096882f, -0.967741966f, 0.0f }, { 0x40080400u } },
+	{ { -0.258064628f, -0.838709712f, 0.0f }, { 0x40080400u } },
+	{ { -1.1920929e-07f, -0.709677458f, 0.0f }, { 0x00080400u } },
+	{ { -0.516129136f, -0.967741966f, 0.0f }, { 0x00080400u } },
+	{ { -0.387096882f, -0.838709712f, 0.0f }, { 0x00080400u } },
+	{ { -0.129032373f, -0.709677458f, 0.0f }, { 0x40080400u } },
+	{ { -0.64516139f, -0.967741966f, 0.0f }, { 0x40080400u } },
+	{ { -0.516129136f, -0.838709712f, 0.0f }, { 0x40080400u } },
+	{ { -0.258064628f, -0.709677458f, 0.0f }, { 0x00080400u } },
+	{ { -0.774193645f, -0.967741966f, 0.0f }, { 0x00080400u } },
+	{ { -0.64516139f, -0.838709712f, 0.0f }, { 0x00080400u } },
+	{ { -0.387096882f, -0.709677458f, 0.0f }, { 0x40080400u } },
+	{ { -0.903225899f, -0.967741966f, 0.0f }, { 0x40080400u } },
+	{ { -0.774193645f, -0.838709712f, 0.0f }, { 0x40080400u } },
+	{ { -0.516129136f, -0.709677458f, 0.0f }, { 0x00080400u } },
+	{ { -0.64516139f, -0.709677458f, 0.0f }, { 0x40080400u } },
+	{ { -0.903225899f, -0.838709712f, 0.0f }, { 0x00080400u } },
+	{ { -0.774193645f, -0.709677458f, 0.0f }, { 0x00080400u } },
+	{ { -1.03225815f, -0.967741966f, 0.0f }, { 0x00080400u } },
+	{ { -1.16129041f, -1.09677422f, 0.0f }, { 0x00080400u } },
+	{ { -1.16129041f, -0.967741966f, 0.0f }, { 0x40080400u } },
+	{ { -1.03225815f, -0.838709712f, 0.0f }, { 0x40080400u } },
+	{ { -1.16129041f, -0.838709712f, 0.0f }, { 0x00080400u } },
+	{ { -0.903225899f, -0.709677458f, 0.0f }, { 0x40080400u } },
+	{ { -1.03225815f, -0.709677458f, 0.0f }, { 0x00080400u } },
+	{ { -1.16129041f, -0.709677458f, 0.0f }, { 0x40080400u } },
+	{ { -0.903225899f, -0.580645204f, 0.0f }, { 0x00080400u } },
+	{ { -1.16129041f, -0.580645204f, 0.0f }, { 0x00080400u } },
+	{ { -1.03225815f, -0.580645204f, 0.0f }, { 0x40080400u } },
+	{ { -1.16129041f, -0.451612949f, 0.0f }, { 0x40080400u } },
+	{ { -1.03225815f, -0.451612949f, 0.0f }, { 0x00080400u } },
+	{ { -1.16129041f, -0.322580695f, 0.0f }, { 0x00080400u } },
+	{ { -1.03225815f, -0.322580695f, 0.0f }, { 0x40080400u } },
+	{ { -0.903225899f, -0.451612949f, 0.0f }, { 0x40080400u } },
+	{ { -0.903225899f, -0.322580695f, 0.0f }, { 0x00080400u } },
+	{ { -1.03225815f, -0.193548441f, 0.0f }, { 0x00080400u } },
+	{ { -1.16129041f, -0.193548441f, 0.0f }, { 0x40080400u } },
+	{ { -0.903225899f, -0.193548441f, 0.0f }, { 0x40080400u } },
+	{ { -1.16129041f, -0.0645161867f, 0.0f }, { 0x00080400u } },
+	{ { -1.03225815f, -0.0645161867f, 0.0f }, { 0x40080400u } },
+	{ { -1.16129041f, 0.0645160675f, 0.0f }, { 0x40080400u } },
+	{ { -1.03225815f, 0.0645160675f, 0.0f }, { 0x00080400u } },
+	{ { -0.903225899f, -0.0645161867f, 0.0f }, { 0x00080400u } },
+	{ { -0.903225899f, 0.0645160675f, 0.0f }, { 0x40080400u } },
+	{ { -1.03225815f, 0.193548322f, 0.0f }, { 0x40080400u } },
+	{ { -1.16129041f, 0.193548322f, 0.0f }, { 0x00080400u } },
+	{ { -0.903225899f, 0.193548322f, 0.0f }, { 0x00080400u } },
+	{ { -1.16129041f, 0.322580457f, 0.0f }, { 0x40080400u } },
+	{ { -1.03225815f, 0.322580457f, 0.0f }, { 0x00080400u } },
+	{ { -1.16129041f, 0.45161283f, 0.0f }, { 0x00080400u } },
+	{ { -1.03225815f, 0.45161283f, 0.0f }, { 0x40080400u } },
+	{ { -0.903225899f, 0.322580457f, 0.0f }, { 0x40080400u } },
+	{ { -0.903225899f, 0.45161283f, 0.0f }, { 0x00080400u } },
+	{ { -1.03225815f, 0.580645204f, 0.0f }, { 0x00080400u } },
+	{ { -1.16129041f, 0.580645204f, 0.0f }, { 0x40080400u } },
+	{ { -0.903225899f, 0.580645204f, 0.0f }, { 0x40080400u } },
+	{ { -1.16129041f, 0.709677339f, 0.0f }, { 0x00080400u } },
+	{ { -1.03225815f, 0.709677339f, 0.0f }, { 0x40080400u } },
+	{ { -1.16129041f, 0.838709474f, 0.0f }, { 0x40080400u } },
+	{ { -1.03225815f, 0.838709474f, 0.0f }, { 0x00080400u } },
+	{ { -0.903225899f, 0.709677339f, 0.0f }, { 0x00080400u } },
+	{ { -0.903225899f, 0.838709474f, 0.0f }, { 0x40080400u } },
+	{ { -1.03225815f, 0.967741847f, 0.0f }, { 0x40080400u } },
+	{ { -1.16129041f, 0.967741847f, 0.0f }, { 0x00080400u } },
+	{ { -1.03225815f, 1.09677422f, 0.0f }, { 0x00080400u } },
+	{ { -0.903225899f, 1.09677422f, 0.0f }, { 0x40080400u } },
+	{ { -0.903225899f, 0.967741847f, 0.0f }, { 0x00080400u } },
+	{ { -0.774193645f, 1.09677422f, 0.0f }, { 0x00080400u } },
+	{ { -0.774193645f, 0.967741847f, 0.0f }, { 0x40080400u } },
+	{ { -0.64516139f, 1.09677422f, 0.0f }, { 0x40080400u } },
+	{ { -0.774193645f, 0.838709474f, 0.0f }, { 0x00080400u } },
+	{ { -0.64516139f, 0.967741847f, 0.0f }, { 0x00080400u } },
+	{ { -0.516129136f, 1.09677422f, 0.0f }, { 0x00080400u } },
+	{ { -0.774193645f, 0.709677339f, 0.0f }, { 0x40080400u } },
+	{ { -0.64516139f, 0.838709474f, 0.0f }, { 0x40080400u } },
+	{ { -0.516129136f, 0.967741847f, 0.0f }, { 0x40080400u } },
+	{ { -0.387096882f, 1.09677422f, 0.0f }, { 0x40080400u } },
+	{ { -0.516129136f, 0.838709474f, 0.0f }, { 0x00080400u } },
+	{ { -0.258064628f, 1.09677422f, 0.0f }, { 0x00080400u } },
+	{ { -0.387096882f, 0.967741847f, 0.0f }, { 0x00080400u } },
+	{ { -0.129032373f, 1.09677422f, 0.0f }, { 0x40080400u } },
+	{ { -0.258064628f, 0.967741847f, 0.0f }, { 0x40080400u } },
+	{ { -0.387096882f, 0.838709474f, 0.0f }, { 0x40080400u } },
+	{ { -1.1920929e-07f, 1.09677422f, 0.0f }, { 0x00080400u } },
+	{ { -0.129032373f, 0.967741847f, 0.0f }, { 0x00080400u } },
+	{ { -0.258064628f, 0.838709474f, 0.0f }, { 0x00080400u } },
+	{ { 0.129032135f, 1.09677422f, 0.0f }, { 0x40080400u } },
+	{ { -1.1920929e-07f, 0.967741847f, 0.0f }, { 0x40080400u } },
+	{ { -0.129032373f, 0.838709474f, 0.0f }, { 0x40080400u } },
+	{ { 0.25806427f, 1.09677422f, 0.0f }, { 0x00080400u } },
+	{ { 0.129032135f, 0.967741847f, 0.0f }, { 0x00080400u } },
+	{ { -1.1920929e-07f, 0.838709474f, 0.0f }, { 0x00080400u } },
+	{ { 0.387096643f, 1.09677422f, 0.0f }, { 0x40080400u } },
+	{ { 0.25806427f, 0.967741847f, 0.0f }, { 0x40080400u } },
+	{ { 0.129032135f, 0.838709474f, 0.0f }, { 0x40080400u } },
+	{ { 0.516129017f, 1.09677422f, 0.0f }, { 0x00080400u } },
+	{ { 0.387096643f, 0.967741847f, 0.0f }, { 0x00080400u } },
+	{ { 0.25806427f, 0.838709474f, 0.0f }, { 0x00080400u } },
+	{ { 0.645161152f, 1.09677422f, 0.0f }, { 0x40080400u } },
+	{ { 0.516129017f, 0.967741847f, 0.0f }, { 0x40080400u } },
+	{ { 0.645161152f, 0.967741847f, 0.0f }, { 0x00080400u } },
+	{ { 0.387096643f, 0.838709474f, 0.0f }, { 0x40080400u } },
+	{ { 0.516129017f, 0.838709474f, 0.0f }, { 0x00080400u } },
+	{ { 0.645161152f, 0.838709474f, 0.0f }, { 0x40080400u } },
+	{ { 0.516129017f, 0.709677339f, 0.0f }, { 0x40080400u } },
+	{ { 0.387096643f, 0.709677339f, 0.0f }, { 0x00080400u } },
+	{ { 0.25806427f, 0.709677339f, 0.0f }, { 0x40080400u } },
+	{ { 0.516129017f, 0.580645204f, 0.0f }, { 0x00080400u } },
+	{ { 0.387096643f, 0.580645204f, 0.0f }, { 0x40080400u } },
+	{ { 0.25806427f, 0.580645204f, 0.0f }, { 0x00080400u } },
+	{ { 0.129032135f, 0.709677339f, 0.0f }, { 0x00080400u } },
+	{ { 0.129032135f, 0.580645204f, 0.0f }, { 0x40080400u } },
+	{ { -1.1920929e-07f, 0.709677339f, 0.0f }, { 0x40080400u } },
+	{ { -1.1920929e-07f, 0.580645204f, 0.0f }, { 0x00080400u } },
+	{ { -0.129032373f, 0.709677339f, 0.0f }, { 0x00080400u } },
+	{ { -0.129032373f, 0.580645204f, 0.0f }, { 0x40080400u } },
+	{ { -0.258064628f, 0.709677339f, 0.0f }, { 0x40080400u } },
+	{ { -0.258064628f, 0.580645204f, 0.0f }, { 0x00080400u } },
+	{ { -0.387096882f, 0.709677339f, 0.0f }, { 0x00080400u } },
+	{ { -0.387096882f, 0.580645204f, 0.0f }, { 0x40080400u } },
+	{ { -0.516129136f, 0.709677339f, 0.0f }, { 0x40080400u } },
+	{ { -0.516129136f, 0.580645204f, 0.0f }, { 0x00080400u } },
+	{ { -0.64516139f, 0.709677339f, 0.0f }, { 0x00080400u } },
+	{ { -0.64516139f, 0.580645204f, 0.0f }, { 0x40080400u } },
+	{ { -0.774193645f, 0.580645204f, 0.0f }, { 0x00080400u } },
+	{ { -0.774193645f, 0.45161283f, 0.0f }, { 0x40080400u } },
+	{ { -0.64516139f, 0.45161283f, 0.0f }, { 0x00080400u } },
+	{ { -0.774193645f, 0.322580457f, 0.0f }, { 0x00080400u } },
+	{ { -0.516129136f, 0.45161283f, 0.0f }, { 0x40080400u } },
+	{ { -0.64516139f, 0.322580457f, 0.0f }, { 0x40080400u } },
+	{ { -0.774193645f, 0.193548322f, 0.0f }, { 0x40080400u } },
+	{ { -0.387096882f, 0.45161283f, 0.0f }, { 0x00080400u } },
+	{ { -0.774193645f, 0.0645160675f, 0.0f }, { 0x00080400u } },
+	{ { -0.64516139f, 0.193548322f, 0.0f }, { 0x00080400u } },
+	{ { -0.516129136f, 0.322580457f, 0.0f }, { 0x00080400u } },
+	{ { -0.774193645f, -0.0645161867f, 0.0f }, { 0x40080400u } },
+	{ { -0.64516139f, 0.0645160675f, 0.0f }, { 0x40080400u } },
+	{ { -0.516129136f, 0.193548322f, 0.0f }, { 0x40080400u } },
+	{ { -0.774193645f, -0.193548441f, 0.0f }, { 0x00080400u } },
+	{ { -0.64516139f, -0.0645161867f, 0.0f }, { 0x00080400u } },
+	{ { -0.774193645f, -0.322580695f, 0.0f }, { 0x40080400u } },
+	{ { -0.64516139f, -0.193548441f, 0.0f }, { 0x40080400u } },
+	{ { -0.516129136f, 0.0645160675f, 0.0f }, { 0x00080400u } },
+	{ { -0.774193645f, -0.451612949f, 0.0f }, { 0x00080400u } },
+	{ { -0.64516139f, -0.322580695f, 0.0f }, { 0x00080400u } },
+	{ { -0.774193645f, -0.580645204f, 0.0f }, { 0x40080400u } },
+	{ { -0.64516139f, -0.451612949f, 0.0f }, { 0x40080400u } },
+	{ { -0.64516139f, -0.580645204f, 0.0f }, { 0x00080400u } },
+	{ { -0.516129136f, -0.322580695f, 0.0f }, { 0x40080400u } },
+	{ { -0.516129136f, -0.580645204f, 0.0f }, { 0x40080400u } },
+	{ { -0.516129136f, -0.451612949f, 0.0f }, { 0x00080400u } },
+	{ { -0.387096882f, -0.580645204f, 0.0f }, { 0x00080400u } },
+	{ { -0.387096882f, -0.451612949f, 0.0f }, { 0x40080400u } },
+	{ { -0.258064628f, -0.580645204f, 0.0f }, { 0x40080400u } },
+	{ { -0.258064628f, -0.451612949f, 0.0f }, { 0x00080400u } },
+	{ { -0.387096882f, -0.322580695f, 0.0f }, { 0x00080400u } },
+	{ { -0.258064628f, -0.322580695f, 0.0f }, { 0x40080400u } },
+	{ { -0.129032373f, -0.451612949f, 0.0f }, { 0x40080400u } },
+	{ { -0.129032373f, -0.580645204f, 0.0f }, { 0x00080400u } },
+	{ { -0.129032373f, -0.322580695f, 0.0f }, { 0x00080400u } },
+	{ { -1.1920929e-07f, -0.580645204f, 0.0f }, { 0x40080400u } },
+	{ { -1.1920929e-07f, -0.451612949f, 0.0f }, { 0x00080400u } },
+	{ { 0.129032135f, -0.580645204f, 0.0f }, { 0x00080400u } },
+	{ { 0.129032135f, -0.451612949f, 0.0f }, { 0x40080400u } },
+	{ { -1.1920929e-07f, -0.322580695f, 0.0f }, { 0x40080400u } },
+	{ { 0.129032135f, -0.322580695f, 0.0f }, { 0x00080400u } },
+	{ { 0.25806427f, -0.451612949f, 0.0f }, { 0x00080400u } },
+	{ { 0.25806427f, -0.580645204f, 0.0f }, { 0x40080400u } },
+	{ { 0.25806427f, -0.322580695f, 0.0f }, { 0x40080400u } },
+	{ { 0.387096643f, -0.580645204f, 0.0f }, { 0x00080400u } },
+	{ { 0.387096643f, -0.451612949f, 0.0f }, { 0x40080400u } },
+	{ { 0.516129017f, -0.451612949f, 0.0f }, { 0x00080400u } },
+	{ { 0.516129017f, -0.322580695f, 0.0f }, { 0x40080400u } },
+	{ { 0.387096643f, -0.322580695f, 0.0f }, { 0x00080400u } },
+	{ { 0.516129017f, -0.193548441f, 0.0f }, { 0x00080400u } },
+	{ { 0.387096643f, -0.193548441f, 0.0f }, { 0x40080400u } },
+	{ { 0.516129017f, -0.0645161867f, 0.0f }, { 0x40080400u } },
+	{ { 0.25806427f, -0.193548441f, 0.0f }, { 0x00080400u } },
+	{ { 0.387096643f, -0.0645161867f, 0.0f }, { 0x00080400u } },
+	{ { 0.516129017f, 0.0645160675f, 0.0f }, { 0x00080400u } },
+	{ { 0.129032135f, -0.193548441f, 0.0f }, { 0x40080400u } },
+	{ { 0.516129017f, 0.193548322f, 0.0f }, { 0x40080400u } },
+	{ { 0.387096643f, 0.0645160675f, 0.0f }, { 0x40080400u } },
+	{ { 0.25806427f, -0.0645161867f, 0.0f }, { 0x40080400u } },
+	{ { 0.516129017f, 0.322580457f, 0.0f }, { 0x00080400u } },
+	{ { 0.387096643f, 0.193548322f, 0.0f }, { 0x00080400u } },
+	{ { 0.25806427f, 0.0645160675f, 0.0f }, { 0x00080400u } },
+	{ { 0.516129017f, 0.45161283f, 0.0f }, { 0x40080400u } },
+	{ { 0.387096643f, 0.322580457f, 0.0f }, { 0x40080400u } },
+	{ { 0.387096643f, 0.45161283f, 0.0f }, { 0x00080400u } },
+	{ { 0.25806427f, 0.193548322f, 0.0f }, { 0x40080400u } },
+	{ { 0.25806427f, 0.322580457f, 0.0f }, { 0x00080400u } },
+	{ { 0.25806427f, 0.45161283f, 0.0f }, { 0x40080400u } },
+	{ { 0.129032135f, 0.193548322f, 0.0f }, { 0x00080400u } },
+	{ { 0.129032135f, 0.45161283f, 0.0f }, { 0x00080400u } },
+	{ { 0.129032135f, 0.322580457f, 0.0f }, { 0x40080400u } },
+	{ { -1.1920929e-07f, 0.45161283f, 0.0f }, { 0x40080400u } },
+	{ { -1.1920929e-07f, 0.322580457f, 0.0f }, { 0x00080400u } },
+	{ { -0.129032373f, 0.45161283f, 0.0f }, { 0x00080400u } },
+	{ { -0.129032373f, 0.322580457f, 0.0f }, { 0x40080400u } },
+	{ { -1.1920929e-07f, 0.193548322f, 0.0f }, { 0x40080400u } },
+	{ { -0.129032373f, 0.193548322f, 0.0f }, { 0x00080400u } },
+	{ { -0.258064628f, 0.45161283f, 0.0f }, { 0x40080400u } },
+	{ { -0.258064628f, 0.322580457f, 0.0f }, { 0x00080400u } },
+	{ { -0.387096882f, 0.322580457f, 0.0f }, { 0x40080400u } },
+	{ { -0.387096882f, 0.193548322f, 0.0f }, { 0x00080400u } },
+	{ { -0.258064628f, 0.193548322f, 0.0f }, { 0x40080400u } },
+	{ { -0.387096882f, 0.0645160675f, 0.0f }, { 0x40080400u } },
+	{ { -0.258064628f, 0.0645160675f, 0.0f }, { 0x00080400u } },
+	{ { -0.516129136f, -0.0645161867f, 0.0f }, { 0x40080400u } },
+	{ { -0.387096882f, -0.0645161867f, 0.0f }, { 0x00080400u } },
+	{ { -0.516129136f, -0.193548441f, 0.0f }, { 0x00080400u } },
+	{ { -0.387096882f, -0.193548441f, 0.0f }, { 0x40080400u } },
+	{ { -0.258064628f, -0.0645161867f, 0.0f }, { 0x40080400u } },
+	{ { -0.258064628f, -0.193548441f, 0.0f }, { 0x00080400u } },
+	{ { -0.129032373f, 0.0645160675f, 0.0f }, { 0x40080400u } },
+	{ { -0.129032373f, -0.0645161867f, 0.0f }, { 0x00080400u } },
+	{ { -0.129032373f, -0.193548441f, 0.0f }, { 0x40080400u } },
+	{ { -1.1920929e-07f, 0.0645160675f, 0.0f }, { 0x00080400u } },
+	{ { -1.1920929e-07f, -0.0645161867f, 0.0f }, { 0x40080400u } },
+	{ { -1.1920929e-07f, -0.193548441f, 0.0f }, { 0x00080400u } },
+	{ { 0.129032135f, 0.0645160675f, 0.0f }, { 0x40080400u } },
+	{ { 0.129032135f, -0.0645161867f, 0.0f }, { 0x00080400u } },
+	// wall grid
+	{ { 1.80645132f, 2.0f, 0.0f }, { 0x5ff00000u } },
+	{ { 1.93548369f, 2.0f, 0.129032254f }, { 0x5ff00000u } },
+	{ { 1.93548369f, 2.0f, 0.0f }, { 0x1ff00000u } },
+	{ { 1.80645132f, 2.0f, 0.129032254f }, { 0x1ff00000u } },
+	{ { 1.67741919f, 2.0f, 0.0f }, { 0x1ff00000u } },
+	{ { 1.93548369f, 2.0f, 0.258064508f }, { 0x1ff00000u } },
+	{ { 1.67741919f, 2.0f, 0.129032254f }, { 0x5ff00000u } },
+	{ { 1.54838705f, 2.0f, 0.0f }, { 0x5ff00000u } },
+	{ { 1.80645132f, 2.0f, 0.258064508f }, { 0x5ff00000u } },
+	{ { 1.93548369f, 2.0f, 0.387096763f }, { 0x5ff00000u } },
+	{ { 1.54838705f, 2.0f, 0.129032254f }, { 0x1ff00000u } },
+	{ { 1.41935468f, 2.0f, 0.0f }, { 0x1ff00000u } },
+	{ { 1.67741919f, 2.0f, 0.258064508f }, { 0x1ff00000u } },
+	{ { 1.80645132f, 2.0f, 0.387096763f }, { 0x1ff00000u } },
+	{ { 1.93548369f, 2.0f, 0.516129017f }, { 0x1ff00000u } },
+	{ { 1.41935468f, 2.0f, 0.129032254f }, { 0x5ff00000u } },
+	{ { 1.2903223f, 2.0f, 0.0f }, { 0x5ff00000u } },
+	{ { 1.80645132f, 2.0f, 0.516129017f }, { 0x5ff00000u } },
+	{ { 1.93548369f, 2.0f, 0.645161271f }, { 0x5ff00000u } },
+	{ { 1.67741919f, 2.0f, 0.387096763f }, { 0x5ff00000u } },
+	{ { 1.54838705f, 2.0f, 0.258064508f }, { 0x5ff00000u } },
+	{ { 1.80645132f, 2.0f, 0.645161271f }, { 0x1ff00000u } },
+	{ { 1.93548369f, 2.0f, 0.774193525f }, { 0x1ff00000u } },
+	{ { 1.67741919f, 2.0f, 0.516129017f }, { 0x1ff00000u } },
+	{ { 1.54838705f, 2.0f, 0.387096763f }, { 0x1ff00000u } },
+	{ { 1.80645132f, 2.0f, 0.774193525f }, { 0x5ff00000u } },
+	{ { 1.93548369f, 2.0f, 0.90322578f }, { 0x5ff00000u } },
+	{ { 1.67741919f, 2.0f, 0.645161271f }, { 0x5ff00000u } },
+	{ { 1.80645132f, 2.0f, 0.90322578f }, { 0x1ff00000u } },
+	{ { 1.93548369f, 2.0f, 1.03225803f }, { 0x1ff00000u } },
+	{ { 1.67741919f, 2.0f, 0.774193525f }, { 0x1ff00000u } },
+	{ { 1.54838705f, 2.0f, 0.516129017f }, { 0x5ff00000u } },
+	{ { 1.54838705f, 2.0f, 0.645161271f }, { 0x1ff00000u } },
+	{ { 1.80645132f, 2.0f, 1.03225803f }, { 0x5ff00000u } },
+	{ { 1.93548369f, 2.0f, 1.16129029f }, { 0x5ff00000u } },
+	{ { 1.67741919f, 2.0f, 0.90322578f }, { 0x5ff00000u } },
+	{ { 1.80645132f, 2.0f, 1.16129029f }, { 0x1ff00000u } },
+	{ { 1.93548369f, 2.0f, 1.29032254f }, { 0x1ff00000u } },
+	{ { 1.67741919f, 2.0f, 1.03225803f }, { 0x1ff00000u } },
+	{ { 1.54838705f, 2.0f, 0.774193525f }, { 0x5ff00000u } },
+	{ { 1.54838705f, 2.0f, 0.90322578f }, { 0x1ff00000u } },
+	{ { 1.80645132f, 2.0f, 1.29032254f }, { 0x5ff00000u } },
+	{ { 1.93548369f, 2.0f, 1.4193548f }, { 0x5ff00000u } },
+	{ { 1.67741919f, 2.0f, 1.16129029f }, { 0x5ff00000u } },
+	{ { 1.80645132f, 2.0f, 1.4193548f }, { 0x1ff00000u } },
+	{ { 1.93548369f, 2.0f, 1.54838705f }, { 0x1ff00000u } },
+	{ { 1.67741919f, 2.0f, 1.29032254f }, { 0x1ff00000u } },
+	{ { 1.54838705f, 2.0f, 1.03225803f }, { 0x5ff00000u } },
+	{ { 1.54838705f, 2.0f, 1.16129029f }, { 0x1ff00000u } },
+	{ { 1.80645132f, 2.0f, 1.54838705f }, { 0x5ff00000u } },
+	{ { 1.93548369f, 2.0f, 1.6774193f }, { 0x5ff00000u } },
+	{ { 1.67741919f, 2.0f, 1.4193548f }, { 0x5ff00000u } },
+	{ { 1.80645132f, 2.0f, 1.6774193f }, { 0x1ff00000u } },
+	{ { 1.93548369f, 2.0f, 1.80645156f }, { 0x1ff00000u } },
+	{ { 1.67741919f, 2.0f, 1.54838705f }, { 0x1ff00000u } },
+	{ { 1.54838705f, 2.0f, 1.29032254f }, { 0x5ff00000u } },
+	{ { 1.54838705f, 2.0f, 1.4193548f }, { 0x1ff00000u } },
+	{ { 1.80645132f, 2.0f, 1.80645156f }, { 0x5ff00000u } },
+	{ { 1.93548369f, 2.0f, 1.93548381f }, { 0x5ff00000u } },
+	{ { 1.67741919f, 2.0f, 1.6774193f }, { 0x5ff00000u } },
+	{ { 1.80645132f, 2.0f, 1.93548381f }, { 0x1ff00000u } },
+	{ { 1.93548369f, 2.0f, 2.06451607f }, { 0x1ff00000u } },
+	{ { 1.67741919f, 2.0f, 1.80645156f }, { 0x1ff00000u } },
+	{ { 1.54838705f, 2.0f, 1.54838705f }, { 0x5ff00000u } },
+	{ { 1.54838705f, 2.0f, 1.6774193f }, { 0x1ff00000u } },
+	{ { 1.80645132f, 2.0f, 2.06451607f }, { 0x5ff00000u } },
+	{ { 1.93548369f, 2.0f, 2.1935482f }, { 0x5ff00000u } },
+	{ { 1.67741919f, 2.0f, 1.93548381f }, { 0x5ff00000u } },
+	{ { 1.80645132f, 2.0f, 2.1935482f }, { 0x1ff00000u } },
+	{ { 1.93548369f, 2.0f, 2.32258058f }, { 0x1ff00000u } },
+	{ { 1.67741919f, 2.0f, 2.06451607f }, { 0x1ff00000u } },
+	{ { 1.54838705f, 2.0f, 1.80645156f }, { 0x5ff00000u } },
+	{ { 1.54838705f, 2.0f, 1.93548381f }, { 0x1ff00000u } },
+	{ { 1.80645132f, 2.0f, 2.32258058f }, { 0x5ff00000u } },
+	{ { 1.93548369f, 2.0f, 2.45161295f }, { 0x5ff00000u } },
+	{ { 1.67741919f, 2.0f, 2.1935482f }, { 0x5ff00000u } },
+	{ { 1.80645132f, 2.0f, 2.45161295f }, { 0x1ff00000u } },
+	{ { 1.93548369f, 2.0f, 2.58064508f }, { 0x1ff00000u } },
+	{ { 1.67741919f, 2.0f, 2.32258058f }, { 0x1ff00000u } },
+	{ { 1.54838705f, 2.0f, 2.06451607f }, { 0x5ff00000u } },
+	{ { 1.54838705f, 2.0f, 2.1935482f }, { 0x1ff00000u } },
+	{ { 1.80645132f, 2.0f, 2.58064508f }, { 0x5ff00000u } },
+	{ { 1.93548369f, 2.0f, 2.70967722f }, { 0x5ff00000u } },
+	{ { 1.67741919f, 2.0f, 2.45161295f }, { 0x5ff00000u } },
+	{ { 1.80645132f, 2.0f, 2.70967722f }, { 0x1ff00000u } },
+	{ { 1.93548369f, 2.0f, 2.83870959f }, { 0x1ff00000u } },
+	{ { 1.67741919f, 2.0f, 2.58064508f }, { 0x1ff00000u } },
+	{ { 1.54838705f, 2.0f, 2.32258058f }, { 0x5ff00000u } },
+	{ { 1.54838705f, 2.0f, 2.45161295f }, { 0x1ff00000u } },
+	{ { 1.80645132f, 2.0f, 2.83870959f }, { 0x5ff00000u } },
+	{ { 1.93548369f, 2.0f, 2.96774197f }, { 0x5ff00000u } },
+	{ { 1.67741919f, 2.0f, 2.70967722f }, { 0x5ff00000u } },
+	{ { 1.80645132f, 2.0f, 2.96774197f }, { 0x1ff00000u } },
+	{ { 1.93548369f, 2.0f, 3.0967741f }, { 0x1ff00000u } },
+	{ { 1.67741919f, 2.0f, 2.83870959f }, { 0x1ff00000u } },
+	{ { 1.54838705f, 2.0f, 2.58064508f }, { 0x5ff00000u } },
+	{ { 1.54838705f, 2.0f, 2.70967722f }, { 0x1ff00000u } },
+	{ { 1.80645132f, 2.0f, 3.0967741f }, { 0x5ff00000u } },
+	{ { 1.93548369f, 2.0f, 3.22580624f }, { 0x5ff00000u } },
+	{ { 1.67741919f, 2.0f, 2.96774197f }, { 0x5ff00000u } },
+	{ { 1.80645132f, 2.0f, 3.22580624f }, { 0x1ff00000u } },
+	{ { 1.93548369f, 2.0f, 3.35483861f }, { 0x1ff00000u } },
+	{ { 1.67741919f, 2.0f, 3.0967741f }, { 0x1ff00000u } },
+	{ { 1.54838705f, 2.0f, 2.83870959f }, { 0x5ff00000u } },
+	{ { 1.54838705f, 2.0f, 2.96774197f }, { 0x1ff00000u } },
+	{ { 1.80645132f, 2.0f, 3.35483861f }, { 0x5ff00000u } },
+	{ { 1.93548369f, 2.0f, 3.48387098f }, { 0x5ff00000u } },
+	{ { 1.67741919f, 2.0f, 3.22580624f }, { 0x5ff00000u } },
+	{ { 1.80645132f, 2.0f, 3.48387098f }, { 0x1ff00000u } },
+	{ { 1.93548369f, 2.0f, 3.61290312f }, { 0x1ff00000u } },
+	{ { 1.67741919f, 2.0f, 3.35483861f }, { 0x1ff00000u } },
+	{ { 1.54838705f, 2.0f, 3.0967741f }, { 0x5ff00000u } },
+	{ { 1.54838705f, 2.0f, 3.22580624f }, { 0x1ff00000u } },
+	{ { 1.80645132f, 2.0f, 3.61290312f }, { 0x5ff00000u } },
+	{ { 1.93548369f, 2.0f, 3.74193525f }, { 0x5ff00000u } },
+	{ { 1.67741919f, 2.0f, 3.48387098f }, { 0x5ff00000u } },
+	{ { 1.80645132f, 2.0f, 3.74193525f }, { 0x1ff00000u } },
+	{ { 1.93548369f, 2.0f, 3.87096763f }, { 0x1ff00000u } },
+	{ { 1.80645132f, 2.0f, 3.87096763f }, { 0x5ff00000u } },
+	{ { 1.67741919f, 2.0f, 3.61290312f }, { 0x1ff00000u } },
+	{ { 1.67741919f, 2.0f, 3.74193525f }, { 0x5ff00000u } },
+	{ { 1.67741919f, 2.0f, 3.87096763f }, { 0x1ff00000u } },
+	{ { 1.54838705f, 2.0f, 3.48387098f }, { 0x1ff00000u } },
+	{ { 1.54838705f, 2.0f, 3.74193525f }, { 0x1ff00000u } },
+	{ { 1.54838705f, 2.0f, 3.87096763f }, { 0x5ff00000u } },
+	{ { 1.54838705f, 2.0f, 3.61290312f }, { 0x5ff00000u } },
+	{ { 1.41935468f, 2.0f, 3.74193525f }, { 0x5ff00000u } },
+	{ { 1.41935468f, 2.0f, 3.87096763f }, { 0x1ff00000u } },
+	{ { 1.41935468f, 2.0f, 3.61290312f }, { 0x1ff00000u } },
+	{ { 1.2903223f, 2.0f, 3.74193525f }, { 0x1ff00000u } },
+	{ { 1.2903223f, 2.0f, 3.87096763f }, { 0x5ff00000u } },
+	{ { 1.2903223f, 2.0f, 3.61290312f }, { 0x5ff00000u } },
+	{ { 1.41935468f, 2.0f, 3.48387098f }, { 0x5ff00000u } },
+	{ { 1.2903223f, 2.0f, 3.48387098f }, { 0x1ff00000u } },
+	{ { 1.16129017f, 2.0f, 3.74193525f }, { 0x5ff00000u } },
+	{ { 1.16129017f, 2.0f, 3.87096763f }, { 0x1ff00000u } },
+	{ { 1.16129017f, 2.0f, 3.61290312f }, { 0x1ff00000u } },
+	{ { 1.03225803f, 2.0f, 3.74193525f }, { 0x1ff00000u } },
+	{ { 1.03225803f, 2.0f, 3.87096763f }, { 0x5ff00000u } },
+	{ { 1.03225803f, 2.0f, 3.61290312f }, { 0x5ff00000u } },
+	{ { 1.16129017f, 2.0f, 3.48387098f }, { 0x5ff00000u } },
+	{ { 1.03225803f, 2.0f, 3.48387098f }, { 0x1ff00000u } },
+	{ { 0.90322566f, 2.0f, 3.74193525f }, { 0x5ff00000u } },
+	{ { 0.90322566f, 2.0f, 3.87096763f }, { 0x1ff00000u } },
+	{ { 0.90322566f, 2.0f, 3.61290312f }, { 0x1ff00000u } },
+	{ { 0.774193287f, 2.0f, 3.74193525f }, { 0x1ff00000u } },
+	{ { 0.774193287f, 2.0f, 3.87096763f }, { 0x5ff00000u } },
+	{ { 0.774193287f, 2.0f, 3.61290312f }, { 0x5ff00000u } },
+	{ { 0.90322566f, 2.0f, 3.48387098f }, { 0x5ff00000u } },
+	{ { 0.774193287f, 2.0f, 3.48387098f }, { 0x1ff00000u } },
+	{ { 0.645161152f, 2.0f, 3.74193525f }, { 0x5ff00000u } },
+	{ { 0.645161152f, 2.0f, 3.87096763f }, { 0x1ff00000u } },
+	{ { 0.645161152f, 2.0f, 3.61290312f }, { 0x1ff00000u } },
+	{ { 0.516129017f, 2.0f, 3.74193525f }, { 0x1ff00000u } },
+	{ { 0.516129017f, 2.0f, 3.87096763f }, { 0x5ff00000u } },
+	{ { 0.516129017f, 2.0f, 3.61290312f }, { 0x5ff00000u } },
+	{ { 0.645161152f, 2.0f, 3.48387098f }, { 0x5ff00000u } },
+	{ { 0.516129017f, 2.0f, 3.48387098f }, { 0x1ff00000u } },
+	{ { 0.387096643f, 2.0f, 3.74193525f }, { 0x5ff00000u } },
+	{ { 0.387096643f, 2.0f, 3.87096763f }, { 0x1ff00000u } },
+	{ { 0.387096643f, 2.0f, 3.61290312f }, { 0x1ff00000u } },
+	{ { 0.25806427f, 2.0f, 3.74193525f }, { 0x1ff00000u } },
+	{ { 0.25806427f, 2.0f, 3.87096763f }, { 0x5ff00000u } },
+	{ { 0.25806427f, 2.0f, 3.61290312f }, { 0x5ff00000u } },
+	{ { 0.387096643f, 2.0f, 3.48387098f }, { 0x5ff00000u } },
+	{ { 0.25806427f, 2.0f, 3.48387098f }, { 0x1ff00000u } },
+	{ { 0.129032135f, 2.0f, 3.74193525f }, { 0x5ff00000u } },
+	{ { 0.129032135f, 2.0f, 3.87096763f }, { 0x1ff00000u } },
+	{ { 0.129032135f, 2.0f, 3.61290312f }, { 0x1ff00000u } },
+	{ { -1.1920929e-07f, 2.0f, 3.74193525f }, { 0x1ff00000u } },
+	{ { -1.1920929e-07f, 2.0f, 3.87096763f }, { 0x5ff00000u } },
+	{ { -1.1920929e-07f, 2.0f, 3.61290312f }, { 0x5ff00000u } },
+	{ { 0.129032135f, 2.0f, 3.48387098f }, { 0x5ff00000u } },
+	{ { -1.1920929e-07f, 2.0f, 3.48387098f }, { 0x1ff00000u } },
+	{ { -0.129032373f, 2.0f, 3.74193525f }, { 0x5ff00000u } },
+	{ { -0.129032373f, 2.0f, 3.87096763f }, { 0x1ff00000u } },
+	{ { -0.129032373f, 2.0f, 3.61290312f }, { 0x1ff00000u } },
+	{ { -0.258064628f, 2.0f, 3.74193525f }, { 0x1ff00000u } },
+	{ { -0.258064628f, 2.0f, 3.87096763f }, { 0x5ff00000u } },
+	{ { -0.258064628f, 2.0f, 3.61290312f }, { 0x5ff00000u } },
+	{ { -0.129032373f, 2.0f, 3.48387098f }, { 0x5ff00000u } },
+	{ { -0.258064628f, 2.0f, 3.48387098f }, { 0x1ff00000u } },
+	{ { -0.387096882f, 2.0f, 3.74193525f }, { 0x5ff00000u } },
+	{ { -0.387096882f, 2.0f, 3.87096763f }, { 0x1ff00000u } },
+	{ { -0.387096882f, 2.0f, 3.61290312f }, { 0x1ff00000u } },
+	{ { -0.516129136f, 2.0f, 3.74193525f }, { 0x1ff00000u } },
+	{ { -0.516129136f, 2.0f, 3.87096763f }, { 0x5ff00000u } },
+	{ { -0.516129136f, 2.0f, 3.61290312f }, { 0x5ff00000u } },
+	{ { -0.387096882f, 2.0f, 3.48387098f }, { 0x5ff00000u } },
+	{ { -0.516129136f, 2.0f, 3.48387098f }, { 0x1ff00000u } },
+	{ { -0.64516139f, 2.0f, 3.74193525f }, { 0x5ff00000u } },
+	{ { -0.64516139f, 2.0f, 3.87096763f }, { 0x1ff00000u } },
+	{ { -0.64516139f, 2.0f, 3.61290312f }, { 0x1ff00000u } },
+	{ { -0.774193645f, 2.0f, 3.74193525f }, { 0x1ff00000u } },
+	{ { -0.774193645f, 2.0f, 3.87096763f }, { 0x5ff00000u } },
+	{ { -0.774193645f, 2.0f, 3.61290312f }, { 0x5ff00000u } },
+	{ { -0.64516139f, 2.0f, 3.48387098f }, { 0x5ff00000u } },
+	{ { -0.774193645f, 2.0f, 3.48387098f }, { 0x1ff00000u } },
+	{ { -0.903225899f, 2.0f, 3.74193525f }, { 0x5ff00000u } },
+	{ { -0.903225899f, 2.0f, 3.87096763f }, { 0x1ff00000u } },
+	{ { -0.903225899f, 2.0f, 3.61290312f }, { 0x1ff00000u } },
+	{ { -1.03225815f, 2.0f, 3.74193525f }, { 0x1ff00000u } },
+	{ { -1.03225815f, 2.0f, 3.87096763f }, { 0x5ff00000u } },
+	{ { -1.03225815f, 2.0f, 3.61290312f }, { 0x5ff00000u } },
+	{ { -0.903225899f, 2.0f, 3.48387098f }, { 0x5ff00000u } },
+	{ { -1.03225815f, 2.0f, 3.48387098f }, { 0x1ff00000u } },
+	{ { -1.16129041f, 2.0f, 3.74193525f }, { 0x5ff00000u } },
+	{ { -1.16129041f, 2.0f, 3.87096763f }, { 0x1ff00000u } },
+	{ { -1.16129041f, 2.0f, 3.61290312f }, { 0x1ff00000u } },
+	{ { -1.29032266f, 2.0f, 3.74193525f }, { 0x1ff00000u } },
+	{ { -1.29032266f, 2.0f, 3.87096763f }, { 0x5ff00000u } },
+	{ { -1.29032266f, 2.0f, 3.61290312f }, { 0x5ff00000u } },
+	{ { -1.16129041f, 2.0f, 3.48387098f }, { 0x5ff00000u } },
+	{ { -1.29032266f, 2.0f, 3.48387098f }, { 0x1ff00000u } },
+	{ { -1.41935492f, 2.0f, 3.74193525f }, { 0x5ff00000u } },
+	{ { -1.41935492f, 2.0f, 3.87096763f }, { 0x1ff00000u } },
+	{ { -1.41935492f, 2.0f, 3.61290312f }, { 0x1ff00000u } },
+	{ { -1.54838717f, 2.0f, 3.74193525f }, { 0x1ff00000u } },
+	{ { -1.54838717f, 2.0f, 3.87096763f }, { 0x5ff00000u } },
+	{ { -1.54838717f, 2.0f, 3.61290312f }, { 0x5ff00000u } },
+	{ { -1.41935492f, 2.0f, 3.48387098f }, { 0x5ff00000u } },
+	{ { -1.54838717f, 2.0f, 3.48387098f }, { 0x1ff00000u } },
+	{ { -1.67741942f, 2.0f, 3.74193525f }, { 0x5ff00000u } },
+	{ { -1.67741942f, 2.0f, 3.87096763f }, { 0x1ff00000u } },
+	{ { -1.67741942f, 2.0f, 3.61290312f }, { 0x1ff00000u } },
+	{ { -1.80645168f, 2.0f, 3.74193525f }, { 0x1ff00000u } },
+	{ { -1.80645168f, 2.0f, 3.87096763f }, { 0x5ff00000u } },
+	{ { -1.93548393f, 2.0f, 3.74193525f }, { 0x5ff00000u } },
+	{ { -1.93548393f, 2.0f, 3.87096763f }, { 0x1ff00000u } },
+	{ { -1.93548393f, 2.0f, 3.61290312f }, { 0x1ff00000u } },
+	{ { -1.80645168f, 2.0f, 3.61290312f }, { 0x5ff00000u } },
+	{ { -1.93548393f, 2.0f, 3.48387098f }, { 0x5ff00000u } },
+	{ { -1.80645168f, 2.0f, 3.48387098f }, { 0x1ff00000u } },
+	{ { -1.93548393f, 2.0f, 3.35483861f }, { 0x1ff00000u } },
+	{ { -1.67741942f, 2.0f, 3.48387098f }, { 0x5ff00000u } },
+	{ { -1.80645168f, 2.0f, 3.35483861f }, { 0x5ff00000u } },
+	{ { -1.93548393f, 2.0f, 3.22580624f }, { 0x5ff00000u } },
+	{ { -1.67741942f, 2.0f, 3.35483861f }, { 0x1ff00000u } },
+	{ { -1.80645168f, 2.0f, 3.22580624f }, { 0x1ff00000u } },
+	{ { -1.93548393f, 2.0f, 3.0967741f }, { 0x1ff00000u } },
+	{ { -1.54838717f, 2.0f, 3.35483861f }, { 0x5ff00000u } },
+	{ { -1.67741942f, 2.0f, 3.22580624f }, { 0x5ff00000u } },
+	{ { -1.80645168f, 2.0f, 3.0967741f }, { 0x5ff00000u } },
+	{ { -1.93548393f, 2.0f, 2.96774197f }, { 0x5ff00000u } },
+	{ { -1.41935492f, 2.0f, 3.35483861f }, { 0x1ff00000u } },
+	{ { -1.80645168f, 2.0f, 2.96774197f }, { 0x1ff00000u } },
+	{ { -1.93548393f, 2.0f, 2.83870959f }, { 0x1ff00000u } },
+	{ { -1.67741942f, 2.0f, 3.0967741f }, { 0x1ff00000u } },
+	{ { -1.54838717f, 2.0f, 3.22580624f }, { 0x1ff00000u } },
+	{ { -1.80645168f, 2.0f, 2.83870959f }, { 0x5ff00000u } },
+	{ { -1.93548393f, 2.0f, 2.70967722f }, { 0x5ff00000u } },
+	{ { -1.67741942f, 2.0f, 2.96774197f }, { 0x5ff00000u } },
+	{ { -1.54838717f, 2.0f, 3.0967741f }, { 0x5ff00000u } },
+	{ { -1.80645168f, 2.0f, 2.70967722f }, { 0x1ff00000u } },
+	{ { -1.93548393f, 2.0f, 2.58064508f }, { 0x1ff00000u } },
+	{ { -1.67741942f, 2.0f, 2.83870959f }, { 0x1ff00000u } },
+	{ { -1.80645168f, 2.0f, 2.58064508f }, { 0x5ff00000u } },
+	{ { -1.93548393f, 2.0f, 2.45161295f }, { 0x5ff00000u } },
+	{ { -1.67741942f, 2.0f, 2.70967722f }, { 0x5ff00000u } },
+	{ { -1.54838717f, 2.0f, 2.96774197f }, { 0x1ff00000u } },
+	{ { -1.80645168f, 2.0f, 2.45161295f }, { 0x1ff00000u } },
+	{ { -1.93548393f, 2.0f, 2.32258058f }, { 0x1ff00000u } },
+	{ { -1.67741942f, 2.0f, 2.58064508f }, { 0x1ff00000u } },
+	{ { -1.80645168f, 2.0f, 2.32258058f }, { 0x5ff00000u } },
+	{ { -1.93548393f, 2.0f, 2.1935482f }, { 0x5ff00000u } },
+	{ { -1.67741942f, 2.0f, 2.45161295f }, { 0x5ff00000u } },
+	{ { -1.80645168f, 2.0f, 2.1935482f }, { 0x1ff00000u } },
+	{ { -1.93548393f, 2.0f, 2.06451607f }, { 0x1ff00000u } },
+	{ { -1.67741942f, 2.0f, 2.32258058f }, { 0x1ff00000u } },
+	{ { -1.80645168f, 2.0f, 2.06451607f }, { 0x5ff00000u } },
+	{ { -1.93548393f, 2.0f, 1.93548381f }, { 0x5ff00000u } },
+	{ { -1.67741942f, 2.0f, 2.1935482f }, { 0x5ff00000u } },
+	{ { -1.80645168f, 2.0f, 1.93548381f }, { 0x1ff00000u } },
+	{ { -1.93548393f, 2.0f, 1.80645156f }, { 0x1ff00000u } },
+	{ { -1.67741942f, 2.0f, 2.06451607f }, { 0x1ff00000u } },
+	{ { -1.80645168f, 2.0f, 1.80645156f }, { 0x5ff00000u } },
+	{ { -1.93548393f, 2.0f, 1.6774193f }, { 0x5ff00000u } },
+	{ { -1.67741942f, 2.0f, 1.93548381f }, { 0x5ff00000u } },
+	{ { -1.80645168f, 2.0f, 1.6774193f }, { 0x1ff00000u } },
+	{ { -1.93548393f, 2.0f, 1.54838705f }, { 0x1ff00000u } },
+	{ { -1.67741942f, 2.0f, 1.80645156f }, { 0x1ff00000u } },
+	{ { -1.80645168f, 2.0f, 1.54838705f }, { 0x5ff00000u } },
+	{ { -1.93548393f, 2.0f, 1.4193548f }, { 0x5ff00000u } },
+	{ { -1.67741942f, 2.0f, 1.6774193f }, { 0x5ff00000u } },
+	{ { -1.80645168f, 2.0f, 1.4193548f }, { 0x1ff00000u } },
+	{ { -1.93548393f, 2.0f, 1.29032254f }, { 0x1ff00000u } },
+	{ { -1.67741942f, 2.0f, 1.54838705f }, { 0x1ff00000u } },
+	{ { -1.80645168f, 2.0f, 1.29032254f }, { 0x5ff00000u } },
+	{ { -1.93548393f, 2.0f, 1.16129029f }, { 0x5ff00000u } },
+	{ { -1.67741942f, 2.0f, 1.4193548f }, { 0x5ff00000u } },
+	{ { -1.80645168f, 2.0f, 1.16129029f }, { 0x1ff00000u } },
+	{ { -1.93548393f, 2.0f, 1.03225803f }, { 0x1ff00000u } },
+	{ { -1.67741942f, 2.0f, 1.29032254f }, { 0x1ff00000u } },
+	{ { -1.80645168f, 2.0f, 1.03225803f }, { 0x5ff00000u } },
+	{ { -1.93548393f, 2.0f, 0.90322578f }, { 0x5ff00000u } },
+	{ { -1.67741942f, 2.0f, 1.16129029f }, { 0x5ff00000u } },
+	{ { -1.80645168f, 2.0f, 0.90322578f }, { 0x1ff00000u } },
+	{ { -1.93548393f, 2.0f, 0.774193525f }, { 0x1ff00000u } },
+	{ { -1.67741942f, 2.0f, 1.03225803f }, { 0x1ff00000u } },
+	{ { -1.80645168f, 2.0f, 0.774193525f }, { 0x5ff00000u } },
+	{ { -1.93548393f, 2.0f, 0.645161271f }, { 0x5ff00000u } },
+	{ { -1.67741942f, 2.0f, 0.90322578f }, { 0x5ff00000u } },
+	{ { -1.80645168f, 2.0f, 0.645161271f }, { 0x1ff00000u } },
+	{ { -1.93548393f, 2.0f, 0.516129017f }, { 0x1ff00000u } },
+	{ { -1.67741942f, 2.0f, 0.774193525f }, { 0x1ff00000u } },
+	{ { -1.80645168f, 2.0f, 0.516129017f }, { 0x5ff00000u } },
+	{ { -1.93548393f, 2.0f, 0.387096763f }, { 0x5ff00000u } },
+	{ { -1.67741942f, 2.0f, 0.645161271f }, { 0x5ff00000u } },
+	{ { -1.80645168f, 2.0f, 0.387096763f }, { 0x1ff00000u } },
+	{ { -1.93548393f, 2.0f, 0.258064508f }, { 0x1ff00000u } },
+	{ { -1.67741942f, 2.0f, 0.516129017f }, { 0x1ff00000u } },
+	{ { -1.80645168f, 2.0f, 0.258064508f }, { 0x5ff00000u } },
+	{ { -1.93548393f, 2.0f, 0.129032254f }, { 0x5ff00000u } },
+	{ { -1.67741942f, 2.0f, 0.387096763f }, { 0x5ff00000u } },
+	{ { -1.80645168f, 2.0f, 0.129032254f }, { 0x1ff00000u } },
+	{ { -1.93548393f, 2.0f, 0.0f }, { 0x1ff00000u } },
+	{ { -1.80645168f, 2.0f, 0.0f }, { 0x5ff00000u } },
+	{ { -1.67741942f, 2.0f, 0.258064508f }, { 0x1ff00000u } },
+	{ { -1.67741942f, 2.0f, 0.129032254f }, { 0x5ff00000u } },
+	{ { -1.67741942f, 2.0f, 0.0f }, { 0x1ff00000u } },
+	{ { -1.54838717f, 2.0f, 0.387096763f }, { 0x1ff00000u } },
+	{ { -1.54838717f, 2.0f, 0.129032254f }, { 0x1ff00000u } },
+	{ { -1.54838717f, 2.0f, 0.0f }, { 0x5ff00000u } },
+	{ { -1.54838717f, 2.0f, 0.258064508f }, { 0x5ff00000u } },
+	{ { -1.41935492f, 2.0f, 0.129032254f }, { 0x5ff00000u } },
+	{ { -1.41935492f, 2.0f, 0.0f }, { 0x1ff00000u } },
+	{ { -1.41935492f, 2.0f, 0.258064508f }, { 0x1ff00000u } },
+	{ { -1.29032266f, 2.0f, 0.129032254f }, { 0x1ff00000u } },
+	{ { -1.29032266f, 2.0f, 0.0f }, { 0x5ff00000u } },
+	{ { -1.29032266f, 2.0f, 0.258064508f }, { 0x5ff00000u } },
+	{ { -1.41935492f, 2.0f, 0.387096763f }, { 0x5ff00000u } },
+	{ { -1.29032266f, 2.0f, 0.387096763f }, { 0x1ff00000u } },
+	{ { -1.16129041f, 2.0f, 0.258064508f }, { 0x1ff00000u } },
+	{ { -1.16129041f, 2.0f, 0.129032254f }, { 0x5ff00000u } },
+	{ { -1.16129041f, 2.0f, 0.0f }, { 0x1ff00000u } },
+	{ { -1.16129041f, 2.0f, 0.387096763f }, { 0x5ff00000u } },
+	{ { -1.03225815f, 2.0f, 0.129032254f }, { 0x1ff00000u } },
+	{ { -1.03225815f, 2.0f, 0.0f }, { 0x5ff00000u } },
+	{ { -1.03225815f, 2.0f, 0.258064508f }, { 0x5ff00000u } },
+	{ { -0.903225899f, 2.0f, 0.129032254f }, { 0x5ff00000u } },
+	{ { -0.903225899f, 2.0f, 0.0f }, { 0x1ff00000u } },
+	{ { -0.903225899f, 2.0f, 0.258064508f }, { 0x1ff00000u } },
+	{ { -1.03225815f, 2.0f, 0.387096763f }, { 0x1ff00000u } },
+	{ { -0.903225899f, 2.0f, 0.387096763f }, { 0x5ff00000u } },
+	{ { -0.774193645f, 2.0f, 0.258064508f }, { 0x5ff00000u } },
+	{ { -0.774193645f, 2.0f, 0.129032254f }, { 0x1ff00000u } },
+	{ { -0.774193645f, 2.0f, 0.0f }, { 0x5ff00000u } },
+	{ { -0.774193645f, 2.0f, 0.387096763f }, { 0x1ff00000u } },
+	{ { -0.64516139f, 2.0f, 0.129032254f }, { 0x5ff00000u } },
+	{ { -0.64516139f, 2.0f, 0.0f }, { 0x1ff00000u } },
+	{ { -0.64516139f, 2.0f, 0.258064508f }, { 0x1ff00000u } },
+	{ { -0.516129136f, 2.0f, 0.129032254f }, { 0x1ff00000u } },
+	{ { -0.516129136f, 2.0f, 0.0f }, { 0x5ff00000u } },
+	{ { -0.516129136f, 2.0f, 0.258064508f }, { 0x5ff00000u } },
+	{ { -0.64516139f, 2.0f, 0.387096763f }, { 0x5ff00000u } },
+	{ { -0.516129136f, 2.0f, 0.387096763f }, { 0x1ff00000u } },
+	{ { -0.387096882f, 2.0f, 0.258064508f }, { 0x1ff00000u } },
+	{ { -0.387096882f, 2.0f, 0.129032254f }, { 0x5ff00000u } },
+	{ { -0.387096882f, 2.0f, 0.0f }, { 0x1ff00000u } },
+	{ { -0.387096882f, 2.0f, 0.387096763f }, { 0x5ff00000u } },
+	{ { -0.258064628f, 2.0f, 0.129032254f }, { 0x1ff00000u } },
+	{ { -0.258064628f, 2.0f, 0.0f }, { 0x5ff00000u } },
+	{ { -0.258064628f, 2.0f, 0.258064508f }, { 0x5ff00000u } },
+	{ { -0.129032373f, 2.0f, 0.129032254f }, { 0x5ff00000u } },
+	{ { -0.129032373f, 2.0f, 0.0f }, { 0x1ff00000u } },
+	{ { -0.129032373f, 2.0f, 0.258064508f }, { 0x1ff00000u } },
+	{ { -0.258064628f, 2.0f, 0.387096763f }, { 0x1ff00000u } },
+	{ { -0.129032373f, 2.0f, 0.387096763f }, { 0x5ff00000u } },
+	{ { -1.1920929e-07f, 2.0f, 0.258064508f }, { 0x5ff00000u } },
+	{ { -1.1920929e-07f, 2.0f, 0.129032254f }, { 0x1ff00000u } },
+	{ { -1.1920929e-07f, 2.0f, 0.0f }, { 0x5ff00000u } },
+	{ { -1.1920929e-07f, 2.0f, 0.387096763f }, { 0x1ff00000u } },
+	{ { 0.129032135f, 2.0f, 0.129032254f }, { 0x5ff00000u } },
+	{ { 0.129032135f, 2.0f, 0.0f }, { 0x1ff00000u } },
+	{ { 0.129032135f, 2.0f, 0.258064508f }, { 0x1ff00000u } },
+	{ { 0.25806427f, 2.0f, 0.129032254f }, { 0x1ff00000u } },
+	{ { 0.25806427f, 2.0f, 0.0f }, { 0x5ff00000u } },
+	{ { 0.25806427f, 2.0f, 0.258064508f }, { 0x5ff00000u } },
+	{ { 0.129032135f, 2.0f, 0.387096763f }, { 0x5ff00000u } },
+	{ { 0.25806427f, 2.0f, 0.387096763f }, { 0x1ff00000u } },
+	{ { 0.387096643f, 2.0f, 0.258064508f }, { 0x1ff00000u } },
+	{ { 0.387096643f, 2.0f, 0.129032254f }, { 0x5ff00000u } },
+	{ { 0.387096643f, 2.0f, 0.0f }, { 0x1ff00000u } },
+	{ { 0.387096643f, 2.0f, 0.387096763f }, { 0x5ff00000u } },
+	{ { 0.516129017f, 2.0f, 0.129032254f }, { 0x1ff00000u } },
+	{ { 0.516129017f, 2.0f, 0.0f }, { 0x5ff00000u } },
+	{ { 0.516129017f, 2.0f, 0.258064508f }, { 0x5ff00000u } },
+	{ { 0.645161152f, 2.0f, 0.129032254f }, { 0x5ff00000u } },
+	{ { 0.645161152f, 2.0f, 0.0f }, { 0x1ff00000u } },
+	{ { 0.645161152f, 2.0f, 0.258064508f }, { 0x1ff00000u } },
+	{ { 0.516129017f, 2.0f, 0.387096763f }, { 0x1ff00000u } },
+	{ { 0.645161152f, 2.0f, 0.387096763f }, { 0x5ff00000u } },
+	{ { 0.774193287f, 2.0f, 0.258064508f }, { 0x5ff00000u } },
+	{ { 0.774193287f, 2.0f, 0.129032254f }, { 0x1ff00000u } },
+	{ { 0.774193287f, 2.0f, 0.0f }, { 0x5ff00000u } },
+	{ { 0.774193287f, 2.0f, 0.387096763f }, { 0x1ff00000u } },
+	{ { 0.90322566f, 2.0f, 0.129032254f }, { 0x5ff00000u } },
+	{ { 0.90322566f, 2.0f, 0.0f }, { 0x1ff00000u } },
+	{ { 0.90322566f, 2.0f, 0.258064508f }, { 0x1ff00000u } },
+	{ { 1.03225803f, 2.0f, 0.129032254f }, { 0x1ff00000u } },
+	{ { 1.03225803f, 2.0f, 0.0f }, { 0x5ff00000u } },
+	{ { 1.03225803f, 2.0f, 0.258064508f }, { 0x5ff00000u } },
+	{ { 0.90322566f, 2.0f, 0.387096763f }, { 0x5ff00000u } },
+	{ { 1.03225803f, 2.0f, 0.387096763f }, { 0x1ff00000u } },
+	{ { 1.16129017f, 2.0f, 0.258064508f }, { 0x1ff00000u } },
+	{ { 1.16129017f, 2.0f, 0.129032254f }, { 0x5ff00000u } },
+	{ { 1.16129017f, 2.0f, 0.0f }, { 0x1ff00000u } },
+	{ { 1.16129017f, 2.0f, 0.387096763f }, { 0x5ff00000u } },
+	{ { 1.2903223f, 2.0f, 0.129032254f }, { 0x1ff00000u } },
+	{ { 1.2903223f, 2.0f, 0.258064508f }, { 0x5ff00000u } },
+	{ { 1.41935468f, 2.0f, 0.258064508f }, { 0x1ff00000u } },
+	{ { 1.41935468f, 2.0f, 0.387096763f }, { 0x5ff00000u } },
+	{ { 1.2903223f, 2.0f, 0.387096763f }, { 0x1ff00000u } },
+	{ { 1.41935468f, 2.0f, 0.516129017f }, { 0x1ff00000u } },
+	{ { 1.2903223f, 2.0f, 0.516129017f }, { 0x5ff00000u } },
+	{ { 1.41935468f, 2.0f, 0.645161271f }, { 0x5ff00000u } },
+	{ { 1.16129017f, 2.0f, 0.516129017f }, { 0x1ff00000u } },
+	{ { 1.2903223f, 2.0f, 0.645161271f }, { 0x1ff00000u } },
+	{ { 1.41935468f, 2.0f, 0.774193525f }, { 0x1ff00000u } },
+	{ { 1.03225803f, 2.0f, 0.516129017f }, { 0x5ff00000u } },
+	{ { 1.41935468f, 2.0f, 0.90322578f }, { 0x5ff00000u } },
+	{ { 1.2903223f, 2.0f, 0.774193525f }, { 0x5ff00000u } },
+	{ { 1.16129017f, 2.0f, 0.645161271f }, { 0x5ff00000u } },
+	{ { 1.41935468f, 2.0f, 1.03225803f }, { 0x1ff00000u } },
+	{ { 1.2903223f, 2.0f, 0.90322578f }, { 0x1ff00000u } },
+	{ { 1.16129017f, 2.0f, 0.774193525f }, { 0x1ff00000u } },
+	{ { 1.41935468f, 2.0f, 1.16129029f }, { 0x5ff00000u } },
+	{ { 1.2903223f, 2.0f, 1.03225803f }, { 0x5ff00000u } },
+	{ { 1.41935468f, 2.0f, 1.29032254f }, { 0x1ff00000u } },
+	{ { 1.2903223f, 2.0f, 1.16129029f }, { 0x1ff00000u } },
+	{ { 1.16129017f, 2.0f, 0.90322578f }, { 0x5ff00000u } },
+	{ { 1.16129017f, 2.0f, 1.03225803f }, { 0x1ff00000u } },
+	{ { 1.41935468f, 2.0f, 1.4193548f }, { 0x5ff00000u } },
+	{ { 1.2903223f, 2.0f, 1.29032254f }, { 0x5ff00000u } },
+	{ { 1.41935468f, 2.0f, 1.54838705f }, { 0x1ff00000u } },
+	{ { 1.2903223f, 2.0f, 1.4193548f }, { 0x1ff00000u } },
+	{ { 1.16129017f, 2.0f, 1.16129029f }, { 0x5ff00000u } },
+	{ { 1.16129017f, 2.0f, 1.29032254f }, { 0x1ff00000u } },
+	{ { 1.41935468f, 2.0f, 1.6774193f }, { 0x5ff00000u } },
+	{ { 1.2903223f, 2.0f, 1.54838705f }, { 0x5ff00000u } },
+	{ { 1.41935468f, 2.0f, 1.80645156f }, { 0x1ff00000u } },
+	{ { 1.2903223f, 2.0f, 1.6774193f }, { 0x1ff00000u } },
+	{ { 1.16129017f, 2.0f, 1.4193548f }, { 0x5ff00000u } },
+	{ { 1.16129017f, 2.0f, 1.54838705f }, { 0x1ff00000u } },
+	{ { 1.41935468f, 2.0f, 1.93548381f }, { 0x5ff00000u } },
+	{ { 1.2903223f, 2.0f, 1.80645156f }, { 0x5ff00000u } },
+	{ { 1.41935468f, 2.0f, 2.06451607f }, { 0x1ff00000u } },
+	{ { 1.2903223f, 2.0f, 1.93548381f }, { 0x1ff00000u } },
+	{ { 1.16129017f, 2.0f, 1.6774193f }, { 0x5ff00000u } },
+	{ { 1.16129017f, 2.0f, 1.80645156f }, { 0x1ff00000u } },
+	{ { 1.41935468f, 2.0f, 2.1935482f }, { 0x5ff00000u } },
+	{ { 1.2903223f, 2.0f, 2.06451607f }, { 0x5ff00000u } },
+	{ { 1.41935468f, 2.0f, 2.32258058f }, { 0x1ff00000u } },
+	{ { 1.2903223f, 2.0f, 2.1935482f }, { 0x1ff00000u } },
+	{ { 1.16129017f, 2.0f, 1.93548381f }, { 0x5ff00000u } },
+	{ { 1.16129017f, 2.0f, 2.06451607f }, { 0x1ff00000u } },
+	{ { 1.41935468f, 2.0f, 2.45161295f }, { 0x5ff00000u } },
+	{ { 1.2903223f, 2.0f, 2.32258058f }, { 0x5ff00000u } },
+	{ { 1.41935468f, 2.0f, 2.58064508f }, { 0x1ff00000u } },
+	{ { 1.2903223f, 2.0f, 2.45161295f }, { 0x1ff00000u } },
+	{ { 1.16129017f, 2.0f, 2.1935482f }, { 0x5ff00000u } },
+	{ { 1.16129017f, 2.0f, 2.32258058f }, { 0x1ff00000u } },
+	{ { 1.41935468f, 2.0f, 2.70967722f }, { 0x5ff00000u } },
+	{ { 1.2903223f, 2.0f, 2.58064508f }, { 0x5ff00000u } },
+	{ { 1.41935468f, 2.0f, 2.83870959f }, { 0x1ff00000u } },
+	{ { 1.2903223f, 2.0f, 2.70967722f }, { 0x1ff00000u } },
+	{ { 1.16129017f, 2.0f, 2.45161295f }, { 0x5ff00000u } },
+	{ { 1.16129017f, 2.0f, 2.58064508f }, { 0x1ff00000u } },
+	{ { 1.41935468f, 2.0f, 2.96774197f }, { 0x5ff00000u } },
+	{ { 1.2903223f, 2.0f, 2.83870959f }, { 0x5ff00000u } },
+	{ { 1.41935468f, 2.0f, 3.0967741f }, { 0x1ff00000u } },
+	{ { 1.2903223f, 2.0f, 2.96774197f }, { 0x1ff00000u } },
+	{ { 1.16129017f, 2.0f, 2.70967722f }, { 0x5ff00000u } },
+	{ { 1.16129017f, 2.0f, 2.83870959f }, { 0x1ff00000u } },
+	{ { 1.2903223f, 2.0f, 3.0967741f }, { 0x5ff00000u } },
+	{ { 1.03225803f, 2.0f, 2.58064508f }, { 0x5ff00000u } },
+	{ { 1.16129017f, 2.0f, 2.96774197f }, { 0x5ff00000u } },
+	{ { 1.03225803f, 2.0f, 2.70967722f }, { 0x1ff00000u } },
+	{ { 1.03225803f, 2.0f, 2.83870959f }, { 0x5ff00000u } },
+	{ { 1.03225803f, 2.0f, 2.45161295f }, { 0x1ff00000u } },
+	{ { 0.90322566f, 2.0f, 2.58064508f }, { 0x1ff00000u } },
+	{ { 1.03225803f, 2.0f, 2.32258058f }, { 0x5ff00000u } },
+	{ { 0.90322566f, 2.0f, 2.45161295f }, { 0x5ff00000u } },
+	{ { 0.90322566f, 2.0f, 2.32258058f }, { 0x1ff00000u } },
+	{ { 1.03225803f, 2.0f, 2.1935482f }, { 0x1ff00000u } },
+	{ { 0.90322566f, 2.0f, 2.1935482f }, { 0x5ff00000u } },
+	{ { 1.03225803f, 2.0f, 2.06451607f }, { 0x5ff00000u } },
+	{ { 0.90322566f, 2.0f, 2.06451607f }, { 0x1ff00000u } },
+	{ { 1.03225803f, 2.0f, 1.93548381f }, { 0x1ff00000u } },
+	{ { 0.90322566f, 2.0f, 1.93548381f }, { 0x5ff00000u } },
+	{ { 1.03225803f, 2.0f, 1.80645156f }, { 0x5ff00000u } },
+	{ { 0.90322566f, 2.0f, 1.80645156f }, { 0x1ff00000u } },
+	{ { 1.03225803f, 2.0f, 1.6774193f }, { 0x1ff00000u } },
+	{ { 0.90322566f, 2.0f, 1.6774193f }, { 0x5ff00000u } },
+	{ { 1.03225803f, 2.0f, 1.54838705f }, { 0x5ff00000u } },
+	{ { 0.90322566f, 2.0f, 1.54838705f }, { 0x1ff00000u } },
+	{ { 1.03225803f, 2.0f, 1.4193548f }, { 0x1ff00000u } },
+	{ { 0.90322566f, 2.0f, 1.4193548f }, { 0x5ff00000u } },
+	{ { 1.03225803f, 2.0f, 1.29032254f }, { 0x5ff00000u } },
+	{ { 0.90322566f, 2.0f, 1.29032254f }, { 0x1ff00000u } },
+	{ { 1.03225803f, 2.0f, 1.16129029f }, { 0x1ff00000u } },
+	{ { 0.90322566f, 2.0f, 1.16129029f }, { 0x5ff00000u } },
+	{ { 1.03225803f, 2.0f, 1.03225803f }, { 0x5ff00000u } },
+	{ { 0.90322566f, 2.0f, 1.03225803f }, { 0x1ff00000u } },
+	{ { 1.03225803f, 2.0f, 0.90322578f }, { 0x1ff00000u } },
+	{ { 0.90322566f, 2.0f, 0.90322578f }, { 0x5ff00000u } },
+	{ { 1.03225803f, 2.0f, 0.774193525f }, { 0x5ff00000u } },
+	{ { 0.90322566f, 2.0f, 0.774193525f }, { 0x1ff00000u } },
+	{ { 1.03225803f, 2.0f, 0.645161271f }, { 0x1ff00000u } },
+	{ { 0.90322566f, 2.0f, 0.645161271f }, { 0x5ff00000u } },
+	{ { 0.90322566f, 2.0f, 0.516129017f }, { 0x1ff00000u } },
+	{ { 0.774193287f, 2.0f, 0.516129017f }, { 0x5ff00000u } },
+	{ { 0.774193287f, 2.0f, 0.645161271f }, { 0x1ff00000u } },
+	{ { 0.645161152f, 2.0f, 0.516129017f }, { 0x1ff00000u } },
+	{ { 0.774193287f, 2.0f, 0.774193525f }, { 0x5ff00000u } },
+	{ { 0.645161152f, 2.0f, 0.645161271f }, { 0x5ff00000u } },
+	{ { 0.516129017f, 2.0f, 0.516129017f }, { 0x5ff00000u } },
+	{ { 0.774193287f, 2.0f, 0.90322578f }, { 0x1ff00000u } },
+	{ { 0.387096643f, 2.0f, 0.516129017f }, { 0x1ff00000u } },
+	{ { 0.516129017f, 2.0f, 0.645161271f }, { 0x1ff00000u } },
+	{ { 0.645161152f, 2.0f, 0.774193525f }, { 0x1ff00000u } },
+	{ { 0.25806427f, 2.0f, 0.516129017f }, { 0x5ff00000u } },
+	{ { 0.387096643f, 2.0f, 0.645161271f }, { 0x5ff00000u } },
+	{ { 0.516129017f, 2.0f, 0.774193525f }, { 0x5ff00000u } },
+	{ { 0.129032135f, 2.0f, 0.516129017f }, { 0x1ff00000u } },
+	{ { 0.25806427f, 2.0f, 0.645161271f }, { 0x1ff00000u } },
+	{ { -1.1920929e-07f, 2.0f, 0.516129017f }, { 0x5ff00000u } },
+	{ { 0.129032135f, 2.0f, 0.645161271f }, { 0x5ff00000u } },
+	{ { 0.387096643f, 2.0f, 0.774193525f }, { 0x1ff00000u } },
+	{ { -0.129032373f, 2.0f, 0.516129017f }, { 0x1ff00000u } },
+	{ { -1.1920929e-07f, 2.0f, 0.645161271f }, { 0x1ff00000u } },
+	{ { 0.25806427f, 2.0f, 0.774193525f }, { 0x5ff00000u } },
+	{ { -0.258064628f, 2.0f, 0.516129017f }, { 0x5ff00000u } },
+	{ { -0.129032373f, 2.0f, 0.645161271f }, { 0x5ff00000u } },
+	{ { 0.129032135f, 2.0f, 0.774193525f }, { 0x1ff00000u } },
+	{ { -0.387096882f, 2.0f, 0.516129017f }, { 0x1ff00000u } },
+	{ { -0.258064628f, 2.0f, 0.645161271f }, { 0x1ff00000u } },
+	{ { -1.1920929e-07f, 2.0f, 0.774193525f }, { 0x5ff00000u } },
+	{ { -0.516129136f, 2.0f, 0.516129017f }, { 0x5ff00000u } },
+	{ { -0.387096882f, 2.0f, 0.645161271f }, { 0x5ff00000u } },
+	{ { -0.129032373f, 2.0f, 0.774193525f }, { 0x1ff00000u } },
+	{ { -0.64516139f, 2.0f, 0.516129017f }, { 0x1ff00000u } },
+	{ { -0.516129136f, 2.0f, 0.645161271f }, { 0x1ff00000u } },
+	{ { -0.258064628f, 2.0f, 0.774193525f }, { 0x5ff00000u } },
+	{ { -0.774193645f, 2.0f, 0.516129017f }, { 0x5ff00000u } },
+	{ { -0.64516139f, 2.0f, 0.645161271f }, { 0x5ff00000u } },
+	{ { -0.387096882f, 2.0f, 0.774193525f }, { 0x1ff00000u } },
+	{ { -0.903225899f, 2.0f, 0.516129017f }, { 0x1ff00000u } },
+	{ { -0.774193645f, 2.0f, 0.645161271f }, { 0x1ff00000u } },
+	{ { -0.516129136f, 2.0f, 0.774193525f }, { 0x5ff00000u } },
+	{ { -1.03225815f, 2.0f, 0.516129017f }, { 0x5ff00000u } },
+	{ { -0.903225899f, 2.0f, 0.645161271f }, { 0x5ff00000u } },
+	{ { -0.64516139f, 2.0f, 0.774193525f }, { 0x1ff00000u } },
+	{ { -1.16129041f, 2.0f, 0.516129017f }, { 0x1ff00000u } },
+	{ { -1.03225815f, 2.0f, 0.645161271f }, { 0x1ff00000u } },
+	{ { -0.774193645f, 2.0f, 0.774193525f }, { 0x5ff00000u } },
+	{ { -1.29032266f, 2.0f, 0.516129017f }, { 0x5ff00000u } },
+	{ { -1.16129041f, 2.0f, 0.645161271f }, { 0x5ff00000u } },
+	{ { -0.903225899f, 2.0f, 0.774193525f }, { 0x1ff00000u } },
+	{ { -1.41935492f, 2.0f, 0.516129017f }, { 0x1ff00000u } },
+	{ { -1.29032266f, 2.0f, 0.645161271f }, { 0x1ff00000u } },
+	{ { -1.03225815f, 2.0f, 0.774193525f }, { 0x5ff00000u } },
+	{ { -1.54838717f, 2.0f, 0.516129017f }, { 0x5ff00000u } },
+	{ { -1.41935492f, 2.0f, 0.645161271f }, { 0x5ff00000u } },
+	{ { -1.54838717f, 2.0f, 0.645161271f }, { 0x1ff00000u } },
+	{ { -1.29032266f, 2.0f, 0.774193525f }, { 0x5ff00000u } },
+	{ { -1.54838717f, 2.0f, 0.774193525f }, { 0x5ff00000u } },
+	{ { -1.41935492f, 2.0f, 0.774193525f }, { 0x1ff00000u } },
+	{ { -1.54838717f, 2.0f, 0.90322578f }, { 0x1ff00000u } },
+	{ { -1.41935492f, 2.0f, 0.90322578f }, { 0x5ff00000u } },
+	{ { -1.54838717f, 2.0f, 1.03225803f }, { 0x5ff00000u } },
+	{ { -1.41935492f, 2.0f, 1.03225803f }, { 0x1ff00000u } },
+	{ { -1.29032266f, 2.0f, 0.90322578f }, { 0x1ff00000u } },
+	{ { -1.29032266f, 2.0f, 1.03225803f }, { 0x5ff00000u } },
+	{ { -1.41935492f, 2.0f, 1.16129029f }, { 0x5ff00000u } },
+	{ { -1.54838717f, 2.0f, 1.16129029f }, { 0x1ff00000u } },
+	{ { -1.29032266f, 2.0f, 1.16129029f }, { 0x1ff00000u } },
+	{ { -1.54838717f, 2.0f, 1.29032254f }, { 0x5ff00000u } },
+	{ { -1.41935492f, 2.0f, 1.29032254f }, { 0x1ff00000u } },
+	{ { -1.54838717f, 2.0f, 1.4193548f }, { 0x1ff00000u } },
+	{ { -1.41935492f, 2.0f, 1.4193548f }, { 0x5ff00000u } },
+	{ { -1.29032266f, 2.0f, 1.29032254f }, { 0x5ff00000u } },
+	{ { -1.29032266f, 2.0f, 1.4193548f }, { 0x1ff00000u } },
+	{ { -1.41935492f, 2.0f, 1.54838705f }, { 0x1ff00000u } },
+	{ { -1.54838717f, 2.0f, 1.54838705f }, { 0x5ff00000u } },
+	{ { -1.29032266f, 2.0f, 1.54838705f }, { 0x5ff00000u } },
+	{ { -1.54838717f, 2.0f, 1.6774193f }, { 0x1ff00000u } },
+	{ { -1.41935492f, 2.0f, 1.6774193f }, { 0x5ff00000u } },
+	{ { -1.54838717f, 2.0f, 1.80645156f }, { 0x5ff00000u } },
+	{ { -1.41935492f, 2.0f, 1.80645156f }, { 0x1ff00000u } },
+	{ { -1.29032266f, 2.0f, 1.6774193f }, { 0x1ff00000u } },
+	{ { -1.29032266f, 2.0f, 1.80645156f }, { 0x5ff00000u } },
+	{ { -1.41935492f, 2.0f, 1.93548381f }, { 0x5ff00000u } },
+	{ { -1.54838717f, 2.0f, 1.93548381f }, { 0x1ff00000u } },
+	{ { -1.29032266f, 2.0f, 1.93548381f }, { 0x1ff00000u } },
+	{ { -1.54838717f, 2.0f, 2.06451607f }, { 0x5ff00000u } },
+	{ { -1.41935492f, 2.0f, 2.06451607f }, { 0x1ff00000u } },
+	{ { -1.54838717f, 2.0f, 2.1935482f }, { 0x1ff00000u } },
+	{ { -1.41935492f, 2.0f, 2.1935482f }, { 0x5ff00000u } },
+	{ { -1.29032266f, 2.0f, 2.06451607f }, { 0x5ff00000u } },
+	{ { -1.29032266f, 2.0f, 2.1935482f }, { 0x1ff00000u } },
+	{ { -1.41935492f, 2.0f, 2.32258058f }, { 0x1ff00000u } },
+	{ { -1.54838717f, 2.0f, 2.32258058f }, { 0x5ff00000u } },
+	{ { -1.29032266f, 2.0f, 2.32258058f }, { 0x5ff00000u } },
+	{ { -1.54838717f, 2.0f, 2.45161295f }, { 0x1ff00000u } },
+	{ { -1.41935492f, 2.0f, 2.45161295f }, { 0x5ff00000u } },
+	{ { -1.54838717f, 2.0f, 2.58064508f }, { 0x5ff00000u } },
+	{ { -1.41935492f, 2.0f, 2.58064508f }, { 0x1ff00000u } },
+	{ { -1.29032266f, 2.0f, 2.45161295f }, { 0x1ff00000u } },
+	{ { -1.29032266f, 2.0f, 2.58064508f }, { 0x5ff00000u } },
+	{ { -1.41935492f, 2.0f, 2.70967722f }, { 0x5ff00000u } },
+	{ { -1.54838717f, 2.0f, 2.70967722f }, { 0x1ff00000u } },
+	{ { -1.29032266f, 2.0f, 2.70967722f }, { 0x1ff00000u } },
+	{ { -1.54838717f, 2.0f, 2.83870959f }, { 0x5ff00000u } },
+	{ { -1.41935492f, 2.0f, 2.83870959f }, { 0x1ff00000u } },
+	{ { -1.41935492f, 2.0f, 2.96774197f }, { 0x5ff00000u } },
+	{ { -1.29032266f, 2.0f, 2.83870959f }, { 0x5ff00000u } },
+	{ { -1.29032266f, 2.0f, 2.96774197f }, { 0x1ff00000u } },
+	{ { -1.41935492f, 2.0f, 3.0967741f }, { 0x1ff00000u } },
+	{ { -1.29032266f, 2.0f, 3.0967741f }, { 0x5ff00000u } },
+	{ { -1.41935492f, 2.0f, 3.22580624f }, { 0x5ff00000u } },
+	{ { -1.29032266f, 2.0f, 3.22580624f }, { 0x1ff00000u } },
+	{ { -1.29032266f, 2.0f, 3.35483861f }, { 0x5ff00000u } },
+	{ { -1.16129041f, 2.0f, 3.35483861f }, { 0x1ff00000u } },
+	{ { -1.16129041f, 2.0f, 3.22580624f }, { 0x5ff00000u } },
+	{ { -1.03225815f, 2.0f, 3.35483861f }, { 0x5ff00000u } },
+	{ { -1.16129041f, 2.0f, 3.0967741f }, { 0x1ff00000u } },
+	{ { -1.03225815f, 2.0f, 3.22580624f }, { 0x1ff00000u } },
+	{ { -0.903225899f, 2.0f, 3.35483861f }, { 0x1ff00000u } },
+	{ { -1.16129041f, 2.0f, 2.96774197f }, { 0x5ff00000u } },
+	{ { -1.03225815f, 2.0f, 3.0967741f }, { 0x5ff00000u } },
+	{ { -0.903225899f, 2.0f, 3.22580624f }, { 0x5ff00000u } },
+	{ { -0.774193645f, 2.0f, 3.35483861f }, { 0x5ff00000u } },
+	{ { -0.903225899f, 2.0f, 3.0967741f }, { 0x1ff00000u } },
+	{ { -0.64516139f, 2.0f, 3.35483861f }, { 0x1ff00000u } },
+	{ { -0.774193645f, 2.0f, 3.22580624f }, { 0x1ff00000u } },
+	{ { -0.516129136f, 2.0f, 3.35483861f }, { 0x5ff00000u } },
+	{ { -0.64516139f, 2.0f, 3.22580624f }, { 0x5ff00000u } },
+	{ { -0.774193645f, 2.0f, 3.0967741f }, { 0x5ff00000u } },
+	{ { -0.387096882f, 2.0f, 3.35483861f }, { 0x1ff00000u } },
+	{ { -0.516129136f, 2.0f, 3.22580624f }, { 0x1ff00000u } },
+	{ { -0.64516139f, 2.0f, 3.0967741f }, { 0x1ff00000u } },
+	{ { -0.258064628f, 2.0f, 3.35483861f }, { 0x5ff00000u } },
+	{ { -0.387096882f, 2.0f, 3.22580624f }, { 0x5ff00000u } },
+	{ { -0.516129136f, 2.0f, 3.0967741f }, { 0x5ff00000u } },
+	{ { -0.129032373f, 2.0f, 3.35483861f }, { 0x1ff00000u } },
+	{ { -0.258064628f, 2.0f, 3.22580624f }, { 0x1ff00000u } },
+	{ { -0.387096882f, 2.0f, 3.0967741f }, { 0x1ff00000u } },
+	{ { -1.1920929e-07f, 2.0f, 3.35483861f }, { 0x5ff00000u } },
+	{ { -0.129032373f, 2.0f, 3.22580624f }, { 0x5ff00000u } },
+	{ { -0.258064628f, 2.0f, 3.0967741f }, { 0x5ff00000u } },
+	{ { 0.129032135f, 2.0f, 3.35483861f }, { 0x1ff00000u } },
+	{ { -1.1920929e-07f, 2.0f, 3.22580624f }, { 0x1ff00000u } },
+	{ { -0.129032373f, 2.0f, 3.0967741f }, { 0x1ff00000u } },
+	{ { 0.25806427f, 2.0f, 3.35483861f }, { 0x5ff00000u } },
+	{ { 0.129032135f, 2.0f, 3.22580624f }, { 0x5ff00000u } },
+	{ { -1.1920929e-07f, 2.0f, 3.0967741f }, { 0x5ff00000u } },
+	{ { 0.387096643f, 2.0f, 3.35483861f }, { 0x1ff00000u } },
+	{ { 0.25806427f, 2.0f, 3.22580624f }, { 0x1ff00000u } },
+	{ { 0.129032135f, 2.0f, 3.0967741f }, { 0x1ff00000u } },
+	{ { 0.516129017f, 2.0f, 3.35483861f }, { 0x5ff00000u } },
+	{ { 0.387096643f, 2.0f, 3.22580624f }, { 0x5ff00000u } },
+	{ { 0.25806427f, 2.0f, 3.0967741f }, { 0x5ff00000u } },
+	{ { 0.645161152f, 2.0f, 3.35483861f }, { 0x1ff00000u } },
+	{ { 0.516129017f, 2.0f, 3.22580624f }, { 0x1ff00000u } },
+	{ { 0.387096643f, 2.0f, 3.0967741f }, { 0x1ff00000u } },
+	{ { 0.774193287f, 2.0f, 3.35483861f }, { 0x5ff00000u } },
+	{ { 0.645161152f, 2.0f, 3.22580624f }, { 0x5ff00000u } },
+	{ { 0.516129017f, 2.0f, 3.0967741f }, { 0x5ff00000u } },
+	{ { 0.90322566f, 2.0f, 3.35483861f }, { 0x1ff00000u } },
+	{ { 0.774193287f, 2.0f, 3.22580624f }, { 0x1ff00000u } },
+	{ { 0.645161152f, 2.0f, 3.0967741f }, { 0x1ff00000u } },
+	{ { 1.03225803f, 2.0f, 3.35483861f }, { 0x5ff00000u } },
+	{ { 0.90322566f, 2.0f, 3.22580624f }, { 0x5ff00000u } },
+	{ { 0.774193287f, 2.0f, 3.0967741f }, { 0x5ff00000u } },
+	{ { 1.16129017f, 2.0f, 3.35483861f }, { 0x1ff00000u } },
+	{ { 1.03225803f, 2.0f, 3.22580624f }, { 0x1ff00000u } },
+	{ { 0.90322566f, 2.0f, 3.0967741f }, { 0x1ff00000u } },
+	{ { 1.2903223f, 2.0f, 3.35483861f }, { 0x5ff00000u } },
+	{ { 1.16129017f, 2.0f, 3.22580624f }, { 0x5ff00000u } },
+	{ { 1.03225803f, 2.0f, 3.0967741f }, { 0x5ff00000u } },
+	{ { 1.41935468f, 2.0f, 3.35483861f }, { 0x1ff00000u } },
+	{ { 1.2903223f, 2.0f, 3.22580624f }, { 0x1ff00000u } },
+	{ { 1.16129017f, 2.0f, 3.0967741f }, { 0x1ff00000u } },
+	{ { 1.54838705f, 2.0f, 3.35483861f }, { 0x5ff00000u } },
+	{ { 1.41935468f, 2.0f, 3.22580624f }, { 0x5ff00000u } },
+	{ { 1.03225803f, 2.0f, 2.96774197f }, { 0x1ff00000u } },
+	{ { 0.90322566f, 2.0f, 2.96774197f }, { 0x5ff00000u } },
+	{ { 0.90322566f, 2.0f, 2.83870959f }, { 0x1ff00000u } },
+	{ { 0.774193287f, 2.0f, 2.96774197f }, { 0x1ff00000u } },
+	{ { 0.774193287f, 2.0f, 2.83870959f }, { 0x5ff00000u } },
+	{ { 0.90322566f, 2.0f, 2.70967722f }, { 0x5ff00000u } },
+	{ { 0.774193287f, 2.0f, 2.70967722f }, { 0x1ff00000u } },
+	{ { 0.774193287f, 2.0f, 2.58064508f }, { 0x5ff00000u } },
+	{ { 0.774193287f, 2.0f, 2.45161295f }, { 0x1ff00000u } },
+	{ { 0.645161152f, 2.0f, 2.58064508f }, { 0x1ff00000u } },
+	{ { 0.774193287f, 2.0f, 2.32258058f }, { 0x5ff00000u } },
+	{ { 0.645161152f, 2.0f, 2.45161295f }, { 0x5ff00000u } },
+	{ { 0.645161152f, 2.0f, 2.32258058f }, { 0x1ff00000u } },
+	{ { 0.774193287f, 2.0f, 2.1935482f }, { 0x1ff00000u } },
+	{ { 0.645161152f, 2.0f, 2.1935482f }, { 0x5ff00000u } },
+	{ { 0.774193287f, 2.0f, 2.06451607f }, { 0x5ff00000u } },
+	{ { 0.645161152f, 2.0f, 2.06451607f }, { 0x1ff00000u } },
+	{ { 0.774193287f, 2.0f, 1.93548381f }, { 0x1ff00000u } },
+	{ { 0.645161152f, 2.0f, 1.93548381f }, { 0x5ff00000u } },
+	{ { 0.774193287f, 2.0f, 1.80645156f }, { 0x5ff00000u } },
+	{ { 0.645161152f, 2.0f, 1.80645156f }, { 0x1ff00000u } },
+	{ { 0.774193287f, 2.0f, 1.6774193f }, { 0x1ff00000u } },
+	{ { 0.645161152f, 2.0f, 1.6774193f }, { 0x5ff00000u } },
+	{ { 0.774193287f, 2.0f, 1.54838705f }, { 0x5ff00000u } },
+	{ { 0.645161152f, 2.0f, 1.54838705f }, { 0x1ff00000u } },
+	{ { 0.774193287f, 2.0f, 1.4193548f }, { 0x1ff00000u } },
+	{ { 0.645161152f, 2.0f, 1.4193548f }, { 0x5ff00000u } },
+	{ { 0.774193287f, 2.0f, 1.29032254f }, { 0x5ff00000u } },
+	{ { 0.645161152f, 2.0f, 1.29032254f }, { 0x1ff00000u } },
+	{ { 0.774193287f, 2.0f, 1.16129029f }, { 0x1ff00000u } },
+	{ { 0.645161152f, 2.0f, 1.16129029f }, { 0x5ff00000u } },
+	{ { 0.774193287f, 2.0f, 1.03225803f }, { 0x5ff00000u } },
+	{ { 0.645161152f, 2.0f, 1.03225803f }, { 0x1ff00000u } },
+	{ { 0.645161152f, 2.0f, 0.90322578f }, { 0x5ff00000u } },
+	{ { 0.516129017f, 2.0f, 0.90322578f }, { 0x1ff00000u } },
+	{ { 0.516129017f, 2.0f, 1.03225803f }, { 0x5ff00000u } },
+	{ { 0.387096643f, 2.0f, 0.90322578f }, { 0x5ff00000u } },
+	{ { 0.516129017f, 2.0f, 1.16129029f }, { 0x1ff00000u } },
+	{ { 0.387096643f, 2.0f, 1.03225803f }, { 0x1ff00000u } },
+	{ { 0.25806427f, 2.0f, 0.90322578f }, { 0x1ff00000u } },
+	{ { 0.516129017f, 2.0f, 1.29032254f }, { 0x5ff00000u } },
+	{ { 0.129032135f, 2.0f, 0.90322578f }, { 0x5ff00000u } },
+	{ { 0.25806427f, 2.0f, 1.03225803f }, { 0x5ff00000u } },
+	{ { 0.387096643f, 2.0f, 1.16129029f }, { 0x5ff00000u } },
+	{ { -1.1920929e-07f, 2.0f, 0.90322578f }, { 0x1ff00000u } },
+	{ { 0.129032135f, 2.0f, 1.03225803f }, { 0x1ff00000u } },
+	{ { 0.25806427f, 2.0f, 1.16129029f }, { 0x1ff00000u } },
+	{ { -0.129032373f, 2.0f, 0.90322578f }, { 0x5ff00000u } },
+	{ { -1.1920929e-07f, 2.0f, 1.03225803f }, { 0x5ff00000u } },
+	{ { -0.258064628f, 2.0f, 0.90322578f }, { 0x1ff00000u } },
+	{ { -0.129032373f, 2.0f, 1.03225803f }, { 0x1ff00000u } },
+	{ { 0.129032135f, 2.0f, 1.16129029f }, { 0x5ff00000u } },
+	{ { -0.387096882f, 2.0f, 0.90322578f }, { 0x5ff00000u } },
+	{ { -0.258064628f, 2.0f, 1.03225803f }, { 0x5ff00000u } },
+	{ { -1.1920929e-07f, 2.0f, 1.16129029f }, { 0x1ff00000u } },
+	{ { -0.516129136f, 2.0f, 0.90322578f }, { 0x1ff00000u } },
+	{ { -0.387096882f, 2.0f, 1.03225803f }, { 0x1ff00000u } },
+	{ { -0.129032373f, 2.0f, 1.16129029f }, { 0x5ff00000u } },
+	{ { -0.64516139f, 2.0f, 0.90322578f }, { 0x5ff00000u } },
+	{ { -0.516129136f, 2.0f, 1.03225803f }, { 0x5ff00000u } },
+	{ { -0.258064628f, 2.0f, 1.16129029f }, { 0x1ff00000u } },
+	{ { -0.774193645f, 2.0f, 0.90322578f }, { 0x1ff00000u } },
+	{ { -0.64516139f, 2.0f, 1.03225803f }, { 0x1ff00000u } },
+	{ { -0.387096882f, 2.0f, 1.16129029f }, { 0x5ff00000u } },
+	{ { -0.903225899f, 2.0f, 0.90322578f }, { 0x5ff00000u } },
+	{ { -0.774193645f, 2.0f, 1.03225803f }, { 0x5ff00000u } },
+	{ { -0.516129136f, 2.0f, 1.16129029f }, { 0x1ff00000u } },
+	{ { -0.64516139f, 2.0f, 1.16129029f }, { 0x5ff00000u } },
+	{ { -0.903225899f, 2.0f, 1.03225803f }, { 0x1ff00000u } },
+	{ { -0.774193645f, 2.0f, 1.16129029f }, { 0x1ff00000u } },
+	{ { -1.03225815f, 2.0f, 0.90322578f }, { 0x1ff00000u } },
+	{ { -1.16129041f, 2.0f, 0.774193525f }, { 0x1ff00000u } },
+	{ { -1.16129041f, 2.0f, 0.90322578f }, { 0x5ff00000u } },
+	{ { -1.03225815f, 2.0f, 1.03225803f }, { 0x5ff00000u } },
+	{ { -1.16129041f, 2.0f, 1.03225803f }, { 0x1ff00000u } },
+	{ { -0.903225899f, 2.0f, 1.16129029f }, { 0x5ff00000u } },
+	{ { -1.03225815f, 2.0f, 1.16129029f }, { 0x1ff00000u } },
+	{ { -1.16129041f, 2.0f, 1.16129029f }, { 0x5ff00000u } },
+	{ { -0.903225899f, 2.0f, 1.29032254f }, { 0x1ff00000u } },
+	{ { -1.16129041f, 2.0f, 1.29032254f }, { 0x1ff00000u } },
+	{ { -1.03225815f, 2.0f, 1.29032254f }, { 0x5ff00000u } },
+	{ { -1.16129041f, 2.0f, 1.4193548f }, { 0x5ff00000u } },
+	{ { -1.03225815f, 2.0f, 1.4193548f }, { 0x1ff00000u } },
+	{ { -1.16129041f, 2.0f, 1.54838705f }, { 0x1ff00000u } },
+	{ { -1.03225815f, 2.0f, 1.54838705f }, { 0x5ff00000u } },
+	{ { -0.903225899f, 2.0f, 1.4193548f }, { 0x5ff00000u } },
+	{ { -0.903225899f, 2.0f, 1.54838705f }, { 0x1ff00000u } },
+	{ { -1.03225815f, 2.0f, 1.6774193f }, { 0x1ff00000u } },
+	{ { -1.16129041f, 2.0f, 1.6774193f }, { 0x5ff00000u } },
+	{ { -0.903225899f, 2.0f, 1.6774193f }, { 0x5ff00000u } },
+	{ { -1.16129041f, 2.0f, 1.80645156f }, { 0x1ff00000u } },
+	{ { -1.03225815f, 2.0f, 1.80645156f }, { 0x5ff00000u } },
+	{ { -1.16129041f, 2.0f, 1.93548381f }, { 0x5ff00000u } },
+	{ { -1.03225815f, 2.0f, 1.93548381f }, { 0x1ff00000u } },
+	{ { -0.903225899f, 2.0f, 1.80645156f }, { 0x1ff00000u } },
+	{ { -0.903225899f, 2.0f, 1.93548381f }, { 0x5ff00000u } },
+	{ { -1.03225815f, 2.0f, 2.06451607f }, { 0x5ff00000u } },
+	{ { -1.16129041f, 2.0f, 2.06451607f }, { 0x1ff00000u } },
+	{ { -0.903225899f, 2.0f, 2.06451607f }, { 0x1ff00000u } },
+	{ { -1.16129041f, 2.0f, 2.1935482f }, { 0x5ff00000u } },
+	{ { -1.03225815f, 2.0f, 2.1935482f }, { 0x1ff00000u } },
+	{ { -1.16129041f, 2.0f, 2.32258058f }, { 0x1ff00000u } },
+	{ { -1.03225815f, 2.0f, 2.32258058f }, { 0x5ff00000u } },
+	{ { -0.903225899f, 2.0f, 2.1935482f }, { 0x5ff00000u } },
+	{ { -0.903225899f, 2.0f, 2.32258058f }, { 0x1ff00000u } },
+	{ { -1.03225815f, 2.0f, 2.45161295f }, { 0x1ff00000u } },
+	{ { -1.16129041f, 2.0f, 2.45161295f }, { 0x5ff00000u } },
+	{ { -0.903225899f, 2.0f, 2.45161295f }, { 0x5ff00000u } },
+	{ { -1.16129041f, 2.0f, 2.58064508f }, { 0x1ff00000u } },
+	{ { -1.03225815f, 2.0f, 2.58064508f }, { 0x5ff00000u } },
+	{ { -1.16129041f, 2.0f, 2.70967722f }, { 0x5ff00000u } },
+	{ { -1.03225815f, 2.0f, 2.70967722f }, { 0x1ff00000u } },
+	{ { -0.903225899f, 2.0f, 2.58064508f }, { 0x1ff00000u } },
+	{ { -0.903225899f, 2.0f, 2.70967722f }, { 0x5ff00000u } },
+	{ { -1.03225815f, 2.0f, 2.83870959f }, { 0x5ff00000u } },
+	{ { -1.16129041f, 2.0f, 2.83870959f }, { 0x1ff00000u } },
+	{ { -1.03225815f, 2.0f, 2.96774197f }, { 0x1ff00000u } },
+	{ { -0.903225899f, 2.0f, 2.96774197f }, { 0x5ff00000u } },
+	{ { -0.903225899f, 2.0f, 2.83870959f }, { 0x1ff00000u } },
+	{ { -0.774193645f, 2.0f, 2.96774197f }, { 0x1ff00000u } },
+	{ { -0.774193645f, 2.0f, 2.83870959f }, { 0x5ff00000u } },
+	{ { -0.64516139f, 2.0f, 2.96774197f }, { 0x5ff00000u } },
+	{ { -0.774193645f, 2.0f, 2.70967722f }, { 0x1ff00000u } },
+	{ { -0.64516139f, 2.0f, 2.83870959f }, { 0x1ff00000u } },
+	{ { -0.516129136f, 2.0f, 2.96774197f }, { 0x1ff00000u } },
+	{ { -0.774193645f, 2.0f, 2.58064508f }, { 0x5ff00000u } },
+	{ { -0.64516139f, 2.0f, 2.70967722f }, { 0x5ff00000u } },
+	{ { -0.516129136f, 2.0f, 2.83870959f }, { 0x5ff00000u } },
+	{ { -0.387096882f, 2.0f, 2.96774197f }, { 0x5ff00000u } },
+	{ { -0.516129136f, 2.0f, 2.70967722f }, { 0x1ff00000u } },
+	{ { -0.258064628f, 2.0f, 2.96774197f }, { 0x1ff00000u } },
+	{ { -0.387096882f, 2.0f, 2.83870959f }, { 0x1ff00000u } },
+	{ { -0.129032373f, 2.0f, 2.96774197f }, { 0x5ff00000u } },
+	{ { -0.258064628f, 2.0f, 2.83870959f }, { 0x5ff00000u } },
+	{ { -0.387096882f, 2.0f, 2.70967722f }, { 0x5ff00000u } },
+	{ { -1.1920929e-07f, 2.0f, 2.96774197f }, { 0x1ff00000u } },
+	{ { -0.129032373f, 2.0f, 2.83870959f }, { 0x1ff00000u } },
+	{ { -0.258064628f, 2.0f, 2.70967722f }, { 0x1ff00000u } },
+	{ { 0.129032135f, 2.0f, 2.96774197f }, { 0x5ff00000u } },
+	{ { -1.1920929e-07f, 2.0f, 2.83870959f }, { 0x5ff00000u } },
+	{ { -0.129032373f, 2.0f, 2.70967722f }, { 0x5ff00000u } },
+	{ { 0.25806427f, 2.0f, 2.96774197f }, { 0x1ff00000u } },
+	{ { 0.129032135f, 2.0f, 2.83870959f }, { 0x1ff00000u } },
+	{ { -1.1920929e-07f, 2.0f, 2.70967722f }, { 0x1ff00000u } },
+	{ { 0.387096643f, 2.0f, 2.96774197f }, { 0x5ff00000u } },
+	{ { 0.25806427f, 2.0f, 2.83870959f }, { 0x5ff00000u } },
+	{ { 0.129032135f, 2.0f, 2.70967722f }, { 0x5ff00000u } },
+	{ { 0.516129017f, 2.0f, 2.96774197f }, { 0x1ff00000u } },
+	{ { 0.387096643f, 2.0f, 2.83870959f }, { 0x1ff00000u } },
+	{ { 0.25806427f, 2.0f, 2.70967722f }, { 0x1ff00000u } },
+	{ { 0.645161152f, 2.0f, 2.96774197f }, { 0x5ff00000u } },
+	{ { 0.516129017f, 2.0f, 2.83870959f }, { 0x5ff00000u } },
+	{ { 0.645161152f, 2.0f, 2.83870959f }, { 0x1ff00000u } },
+	{ { 0.387096643f, 2.0f, 2.70967722f }, { 0x5ff00000u } },
+	{ { 0.516129017f, 2.0f, 2.70967722f }, { 0x1ff00000u } },
+	{ { 0.645161152f, 2.0f, 2.70967722f }, { 0x5ff00000u } },
+	{ { 0.516129017f, 2.0f, 2.58064508f }, { 0x5ff00000u } },
+	{ { 0.387096643f, 2.0f, 2.58064508f }, { 0x1ff00000u } },
+	{ { 0.25806427f, 2.0f, 2.58064508f }, { 0x5ff00000u } },
+	{ { 0.516129017f, 2.0f, 2.45161295f }, { 0x1ff00000u } },
+	{ { 0.387096643f, 2.0f, 2.45161295f }, { 0x5ff00000u } },
+	{ { 0.25806427f, 2.0f, 2.45161295f }, { 0x1ff00000u } },
+	{ { 0.129032135f, 2.0f, 2.58064508f }, { 0x1ff00000u } },
+	{ { 0.129032135f, 2.0f, 2.45161295f }, { 0x5ff00000u } },
+	{ { -1.1920929e-07f, 2.0f, 2.58064508f }, { 0x5ff00000u } },
+	{ { -1.1920929e-07f, 2.0f, 2.45161295f }, { 0x1ff00000u } },
+	{ { -0.129032373f, 2.0f, 2.58064508f }, { 0x1ff00000u } },
+	{ { -0.129032373f, 2.0f, 2.45161295f }, { 0x5ff00000u } },
+	{ { -0.258064628f, 2.0f, 2.58064508f }, { 0x5ff00000u } },
+	{ { -0.258064628f, 2.0f, 2.45161295f }, { 0x1ff00000u } },
+	{ { -0.387096882f, 2.0f, 2.58064508f }, { 0x1ff00000u } },
+	{ { -0.387096882f, 2.0f, 2.45161295f }, { 0x5ff00000u } },
+	{ { -0.516129136f, 2.0f, 2.58064508f }, { 0x5ff00000u } },
+	{ { -0.516129136f, 2.0f, 2.45161295f }, { 0x1ff00000u } },
+	{ { -0.64516139f, 2.0f, 2.58064508f }, { 0x1ff00000u } },
+	{ { -0.64516139f, 2.0f, 2.45161295f }, { 0x5ff00000u } },
+	{ { -0.774193645f, 2.0f, 2.45161295f }, { 0x1ff00000u } },
+	{ { -0.774193645f, 2.0f, 2.32258058f }, { 0x5ff00000u } },
+	{ { -0.64516139f, 2.0f, 2.32258058f }, { 0x1ff00000u } },
+	{ { -0.774193645f, 2.0f, 2.1935482f }, { 0x1ff00000u } },
+	{ { -0.516129136f, 2.0f, 2.32258058f }, { 0x5ff00000u } },
+	{ { -0.64516139f, 2.0f, 2.1935482f }, { 0x5ff00000u } },
+	{ { -0.774193645f, 2.0f, 2.06451607f }, { 0x5ff00000u } },
+	{ { -0.387096882f, 2.0f, 2.32258058f }, { 0x1ff00000u } },
+	{ { -0.774193645f, 2.0f, 1.93548381f }, { 0x1ff00000u } },
+	{ { -0.64516139f, 2.0f, 2.06451607f }, { 0x1ff00000u } },
+	{ { -0.516129136f, 2.0f, 2.1935482f }, { 0x1ff00000u } },
+	{ { -0.774193645f, 2.0f, 1.80645156f }, { 0x5ff00000u } },
+	{ { -0.64516139f, 2.0f, 1.93548381f }, { 0x5ff00000u } },
+	{ { -0.516129136f, 2.0f, 2.06451607f }, { 0x5ff00000u } },
+	{ { -0.774193645f, 2.0f, 1.6774193f }, { 0x1ff00000u } },
+	{ { -0.64516139f, 2.0f, 1.80645156f }, { 0x1ff00000u } },
+	{ { -0.774193645f, 2.0f, 1.54838705f }, { 0x5ff00000u } },
+	{ { -0.64516139f, 2.0f, 1.6774193f }, { 0x5ff00000u } },
+	{ { -0.516129136f, 2.0f, 1.93548381f }, { 0x1ff00000u } },
+	{ { -0.774193645f, 2.0f, 1.4193548f }, { 0x1ff00000u } },
+	{ { -0.64516139f, 2.0f, 1.54838705f }, { 0x1ff00000u } },
+	{ { -0.774193645f, 2.0f, 1.29032254f }, { 0x5ff00000u } },
+	{ { -0.64516139f, 2.0f, 1.4193548f }, { 0x5ff00000u } },
+	{ { -0.64516139f, 2.0f, 1.29032254f }, { 0x1ff00000u } },
+	{ { -0.516129136f, 2.0f, 1.54838705f }, { 0x5ff00000u } },
+	{ { -0.516129136f, 2.0f, 1.29032254f }, { 0x5ff00000u } },
+	{ { -0.516129136f, 2.0f, 1.4193548f }, { 0x1ff00000u } },
+	{ { -0.387096882f, 2.0f, 1.29032254f }, { 0x1ff00000u } },
+	{ { -0.387096882f, 2.0f, 1.4193548f }, { 0x5ff00000u } },
+	{ { -0.258064628f, 2.0f, 1.29032254f }, { 0x5ff00000u } },
+	{ { -0.258064628f, 2.0f, 1.4193548f }, { 0x1ff00000u } },
+	{ { -0.387096882f, 2.0f, 1.54838705f }, { 0x1ff00000u } },
+	{ { -0.258064628f, 2.0f, 1.54838705f }, { 0x5ff00000u } },
+	{ { -0.129032373f, 2.0f, 1.4193548f }, { 0x5ff00000u } },
+	{ { -0.129032373f, 2.0f, 1.29032254f }, { 0x1ff00000u } },
+	{ { -0.129032373f, 2.0f, 1.54838705f }, { 0x1ff00000u } },
+	{ { -1.1920929e-07f, 2.0f, 1.29032254f }, { 0x5ff00000u } },
+	{ { -1.1920929e-07f, 2.0f, 1.4193548f }, { 0x1ff00000u } },
+	{ { 0.129032135f, 2.0f, 1.29032254f }, { 0x1ff00000u } },
+	{ { 0.129032135f, 2.0f, 1.4193548f }, { 0x5ff00000u } },
+	{ { -1.1920929e-07f, 2.0f, 1.54838705f }, { 0x5ff00000u } },
+	{ { 0.129032135f, 2.0f, 1.54838705f }, { 0x1ff00000u } },
+	{ { 0.25806427f, 2.0f, 1.4193548f }, { 0x1ff00000u } },
+	{ { 0.25806427f, 2.0f, 1.29032254f }, { 0x5ff00000u } },
+	{ { 0.25806427f, 2.0f, 1.54838705f }, { 0x5ff00000u } },
+	{ { 0.387096643f, 2.0f, 1.29032254f }, { 0x1ff00000u } },
+	{ { 0.387096643f, 2.0f, 1.4193548f }, { 0x5ff00000u } },
+	{ { 0.516129017f, 2.0f, 1.4193548f }, { 0x1ff00000u } },
+	{ { 0.516129017f, 2.0f, 1.54838705f }, { 0x5ff00000u } },
+	{ { 0.387096643f, 2.0f, 1.54838705f }, { 0x1ff00000u } },
+	{ { 0.516129017f, 2.0f, 1.6774193f }, { 0x1ff00000u } },
+	{ { 0.387096643f, 2.0f, 1.6774193f }, { 0x5ff00000u } },
+	{ { 0.516129017f, 2.0f, 1.80645156f }, { 0x5ff00000u } },
+	{ { 0.25806427f, 2.0f, 1.6774193f }, { 0x1ff00000u } },
+	{ { 0.387096643f, 2.0f, 1.80645156f }, { 0x1ff00000u } },
+	{ { 0.516129017f, 2.0f, 1.93548381f }, { 0x1ff00000u } },
+	{ { 0.129032135f, 2.0f, 1.6774193f }, { 0x5ff00000u } },
+	{ { 0.516129017f, 2.0f, 2.06451607f }, { 0x5ff00000u } },
+	{ { 0.387096643f, 2.0f, 1.93548381f }, { 0x5ff00000u } },
+	{ { 0.25806427f, 2.0f, 1.80645156f }, { 0x5ff00000u } },
+	{ { 0.516129017f, 2.0f, 2.1935482f }, { 0x1ff00000u } },
+	{ { 0.387096643f, 2.0f, 2.06451607f }, { 0x1ff00000u } },
+	{ { 0.25806427f, 2.0f, 1.93548381f }, { 0x1ff00000u } },
+	{ { 0.516129017f, 2.0f, 2.32258058f }, { 0x5ff00000u } },
+	{ { 0.387096643f, 2.0f, 2.1935482f }, { 0x5ff00000u } },
+	{ { 0.387096643f, 2.0f, 2.32258058f }, { 0x1ff00000u } },
+	{ { 0.25806427f, 2.0f, 2.06451607f }, { 0x5ff00000u } },
+	{ { 0.25806427f, 2.0f, 2.1935482f }, { 0x1ff00000u } },
+	{ { 0.25806427f, 2.0f, 2.32258058f }, { 0x5ff00000u } },
+	{ { 0.129032135f, 2.0f, 2.06451607f }, { 0x1ff00000u } },
+	{ { 0.129032135f, 2.0f, 2.32258058f }, { 0x1ff00000u } },
+	{ { 0.129032135f, 2.0f, 2.1935482f }, { 0x5ff00000u } },
+	{ { -1.1920929e-07f, 2.0f, 2.32258058f }, { 0x5ff00000u } },
+	{ { -1.1920929e-07f, 2.0f, 2.1935482f }, { 0x1ff00000u } },
+	{ { -0.129032373f, 2.0f, 2.32258058f }, { 0x1ff00000u } },
+	{ { -0.129032373f, 2.0f, 2.1935482f }, { 0x5ff00000u } },
+	{ { -1.1920929e-07f, 2.0f, 2.06451607f }, { 0x5ff00000u } },
+	{ { -0.129032373f, 2.0f, 2.06451607f }, { 0x1ff00000u } },
+	{ { -0.258064628f, 2.0f, 2.32258058f }, { 0x5ff00000u } },
+	{ { -0.258064628f, 2.0f, 2.1935482f }, { 0x1ff00000u } },
+	{ { -0.387096882f, 2.0f, 2.1935482f }, { 0x5ff00000u } },
+	{ { -0.387096882f, 2.0f, 2.06451607f }, { 0x1ff00000u } },
+	{ { -0.258064628f, 2.0f, 2.06451607f }, { 0x5ff00000u } },
+	{ { -0.387096882f, 2.0f, 1.93548381f }, { 0x5ff00000u } },
+	{ { -0.258064628f, 2.0f, 1.93548381f }, { 0x1ff00000u } },
+	{ { -0.516129136f, 2.0f, 1.80645156f }, { 0x5ff00000u } },
+	{ { -0.387096882f, 2.0f, 1.80645156f }, { 0x1ff00000u } },
+	{ { -0.516129136f, 2.0f, 1.6774193f }, { 0x1ff00000u } },
+	{ { -0.387096882f, 2.0f, 1.6774193f }, { 0x5ff00000u } },
+	{ { -0.258064628f, 2.0f, 1.80645156f }, { 0x5ff00000u } },
+	{ { -0.258064628f, 2.0f, 1.6774193f }, { 0x1ff00000u } },
+	{ { -0.129032373f, 2.0f, 1.93548381f }, { 0x5ff00000u } },
+	{ { -0.129032373f, 2.0f, 1.80645156f }, { 0x1ff00000u } },
+	{ { -0.129032373f, 2.0f, 1.6774193f }, { 0x5ff00000u } },
+	{ { -1.1920929e-07f, 2.0f, 1.93548381f }, { 0x1ff00000u } },
+	{ { -1.1920929e-07f, 2.0f, 1.80645156f }, { 0x5ff00000u } },
+	{ { -1.1920929e-07f, 2.0f, 1.6774193f }, { 0x1ff00000u } },
+	{ { 0.129032135f, 2.0f, 1.93548381f }, { 0x5ff00000u } },
+	{ { 0.129032135f, 2.0f, 1.80645156f }, { 0x1ff00000u } },
+	// ground shadow
+	{ { 1.0f, 0.0f, 0.0f }, { 0x4007fc00u } },
+	{ { 0.959492981f, 0.0f, 0.281732559f }, { 0x0007fc00u } },
+	{ { 0.841253519f, 0.0f, 0.540640831f }, { 0x4007fc00u } },
+	{ { 0.654860735f, 0.0f, 0.755749583f }, { 0x0007fc00u } },
+	{ { 0.415415019f, 0.0f, 0.909631968f }, { 0x4007fc00u } },
+	{ { 0.142314836f, 0.0f, 0.989821434f }, { 0x0007fc00u } },
+	{ { -0.142314836f, 0.0f, 0.989821434f }, { 0x4007fc00u } },
+	{ { -0.415415019f, 0.0f, 0.909631968f }, { 0x0007fc00u } },
+	{ { -0.654860735f, 0.0f, 0.755749583f }, { 0x4007fc00u } },
+	{ { -0.841253519f, 0.0f, 0.540640831f }, { 0x0007fc00u } },
+	{ { -0.959492981f, 0.0f, 0.281732559f }, { 0x4007fc00u } },
+	{ { -1.0f, 0.0f, 2.18649922e-16f }, { 0x0007fc00u } },
+	{ { -0.959492981f, 0.0f, -0.281732559f }, { 0x4007fc00u } },
+	{ { -0.841253519f, 0.0f, -0.540640831f }, { 0x0007fc00u } },
+	{ { -0.654860735f, 0.0f, -0.755749583f }, { 0x4007fc00u } },
+	{ { -0.415415019f, 0.0f, -0.909631968f }, { 0x0007fc00u } },
+	{ { -0.142314836f, 0.0f, -0.989821434f }, { 0x4007fc00u } },
+	{ { 0.142314836f, 0.0f, -0.989821434f }, { 0x0007fc00u } },
+	{ { 0.415415019f, 0.0f, -0.909631968f }, { 0x4007fc00u } },
+	{ { 0.654860735f, 0.0f, -0.755749583f }, { 0x0007fc00u } },
+	{ { 0.841253519f, 0.0f, -0.540640831f }, { 0x4007fc00u } },
+	{ { 0.959492981f, 0.0f, -0.281732559f }, { 0x0007fc00u } },
+	{ { 1.0f, 0.0f, 0.0f }, { 0x4007fc00u } },
+	// wall shadow
+	{ { 1.0f, 0.0f, 0.0f }, { 0x5ff00000u } },
+	{ { 0.959492981f, 0.281732559f, 0.0f }, { 0x1ff00000u } },
+	{ { 0.841253519f, 0.540640831f, 0.0f }, { 0x5ff00000u } },
+	{ { 0.654860735f, 0.755749583f, 0.0f }, { 0x1ff00000u } },
+	{ { 0.415415019f, 0.909631968f, 0.0f }, { 0x5ff00000u } },
+	{ { 0.142314836f, 0.989821434f, 0.0f }, { 0x1ff00000u } },
+	{ { -0.142314836f, 0.989821434f, 0.0f }, { 0x5ff00000u } },
+	{ { -0.415415019f, 0.909631968f, 0.0f }, { 0x1ff00000u } },
+	{ { -0.654860735f, 0.755749583f, 0.0f }, { 0x5ff00000u } },
+	{ { -0.841253519f, 0.540640831f, 0.0f }, { 0x1ff00000u } },
+	{ { -0.959492981f, 0.281732559f, 0.0f }, { 0x5ff00000u } },
+	{ { -1.0f, 2.18649922e-16f, 0.0f }, { 0x1ff00000u } },
+	{ { -0.959492981f, -0.281732559f, 0.0f }, { 0x5ff00000u } },
+	{ { -0.841253519f, -0.540640831f, 0.0f }, { 0x1ff00000u } },
+	{ { -0.654860735f, -0.755749583f, 0.0f }, { 0x5ff00000u } },
+	{ { -0.415415019f, -0.909631968f, 0.0f }, { 0x1ff00000u } },
+	{ { -0.142314836f, -0.989821434f, 0.0f }, { 0x5ff00000u } },
+	{ { 0.142314836f, -0.989821434f, 0.0f }, { 0x1ff00000u } },
+	{ { 0.415415019f, -0.909631968f, 0.0f }, { 0x5ff00000u } },
+	{ { 0.654860735f, -0.755749583f, 0.0f }, { 0x1ff00000u } },
+	{ { 0.841253519f, -0.540640831f, 0.0f }, { 0x5ff00000u } },
+	{ { 0.959492981f, -0.281732559f, 0.0f }, { 0x1ff00000u } },
+	{ { 1.0f, 0.0f, 0.0f }, { 0x5ff00000u } },
+	// ball level 0
+	{ { 0.0f, 0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { 0.353553385f, 0.612372458f, 0.707106769f }, { 0x1694e4b5u } },
+	{ { 0.707106769f, 0.0f, 0.707106769f }, { 0x56900169u } },
+	{ { 0.0f, 0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { 0.5f, 0.866025388f, 2.18649922e-16f }, { 0x4006ed00u } },
+	{ { 1.0f, 0.0f, 2.18649922e-16f }, { 0x000001ffu } },
+	{ { 0.353553385f, 0.612372458f, -0.707106769f }, { 0x2974e4b5u } },
+	{ { 0.707106769f, 0.0f, -0.707106769f }, { 0x69700169u } },
+	{ { 1.09324961e-16f, 1.89356386e-16f, -1.0f }, { 0x60100000u } },
+	{ { 2.18649922e-16f, 0.0f, -1.0f }, { 0x20100000u } },
+	{ { -0.353553385f, 0.612372458f, 0.707106769f }, { 0x5694e74bu } },
+	{ { -0.0f, 0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { -0.5f, 0.866025388f, 2.18649922e-16f }, { 0x0006ef00u } },
+	{ { -0.353553385f, 0.612372458f, -0.707106769f }, { 0x6974e74bu } },
+	{ { -1.09324961e-16f, 1.89356386e-16f, -1.0f }, { 0x20100000u } },
+	{ { -0.707106769f, 1.54608844e-16f, 0.707106769f }, { 0x16900297u } },
+	{ { -0.0f, 0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { -1.0f, 2.18649922e-16f, 2.18649922e-16f }, { 0x40000201u } },
+	{ { -0.707106769f, 1.54608844e-16f, -0.707106769f }, { 0x29700297u } },
+	{ { -2.18649922e-16f, 4.78077872e-32f, -1.0f }, { 0x60100000u } },
+	{ { -0.353553385f, -0.612372458f, 0.707106769f }, { 0x569b1f4bu } },
+	{ { -0.0f, -0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { -0.5f, -0.866025388f, 2.18649922e-16f }, { 0x00091700u } },
+	{ { -0.353553385f, -0.612372458f, -0.707106769f }, { 0x697b1f4bu } },
+	{ { -1.09324961e-16f, -1.89356386e-16f, -1.0f }, { 0x20100000u } },
+	{ { 0.353553385f, -0.612372458f, 0.707106769f }, { 0x169b1cb5u } },
+	{ { 0.0f, -0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { 0.5f, -0.866025388f, 2.18649922e-16f }, { 0x40091500u } },
+	{ { 0.353553385f, -0.612372458f, -0.707106769f }, { 0x297b1cb5u } },
+	{ { 1.09324961e-16f, -1.89356386e-16f, -1.0f }, { 0x60100000u } },
+	{ { 0.707106769f, 0.0f, 0.707106769f }, { 0x56900169u } },
+	{ { 0.0f, 0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { 1.0f, 0.0f, 2.18649922e-16f }, { 0x000001ffu } },
+	{ { 0.707106769f, 0.0f, -0.707106769f }, { 0x69700169u } },
+	{ { 2.18649922e-16f, 0.0f, -1.0f }, { 0x20100000u } },
+	// ball level 1
+	{ { 0.0f, 0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { 0.404508501f, 0.293892622f, 0.866025388f }, { 0x1bb258cfu } },
+	{ { 0.5f, 0.0f, 0.866025388f }, { 0x5bb00100u } },
+	{ { 0.0f, 0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { 0.700629294f, 0.509036958f, 0.5f }, { 0x50041166u } },
+	{ { 0.866025388f, 0.0f, 0.5f }, { 0x100001bbu } },
+	{ { 0.809017003f, 0.587785244f, 2.18649922e-16f }, { 0x0004b19du } },
+	{ { 1.0f, 0.0f, 2.18649922e-16f }, { 0x400001ffu } },
+	{ { 0.700629294f, 0.509036958f, -0.5f }, { 0x70041166u } },
+	{ { 0.866025388f, 0.0f, -0.5f }, { 0x300001bbu } },
+	{ { 0.404508501f, 0.293892622f, -0.866025388f }, { 0x245258cfu } },
+	{ { 0.5f, 0.0f, -0.866025388f }, { 0x64500100u } },
+	{ { 1.76891502e-16f, 1.28519197e-16f, -1.0f }, { 0x60100000u } },
+	{ { 2.18649922e-16f, 0.0f, -1.0f }, { 0x20100000u } },
+	{ { 0.154508501f, 0.47552827f, 0.866025388f }, { 0x5bb3cc4fu } },
+	{ { 0.0f, 0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { 0.26761657f, 0.823639095f, 0.5f }, { 0x10069489u } },
+	{ { 0.309017003f, 0.95105654f, 2.18649922e-16f }, { 0x4007989eu } },
+	{ { 0.26761657f, 0.823639095f, -0.5f }, { 0x30069489u } },
+	{ { 0.154508501f, 0.47552827f, -0.866025388f }, { 0x6453cc4fu } },
+	{ { 6.7566541e-17f, 2.07948428e-16f, -1.0f }, { 0x20100000u } },
+	{ { -0.154508501f, 0.47552827f, 0.866025388f }, { 0x1bb3cfb1u } },
+	{ { -0.0f, 0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { -0.26761657f, 0.823639095f, 0.5f }, { 0x50069777u } },
+	{ { -0.309017003f, 0.95105654f, 2.18649922e-16f }, { 0x00079b62u } },
+	{ { -0.26761657f, 0.823639095f, -0.5f }, { 0x70069777u } },
+	{ { -0.154508501f, 0.47552827f, -0.866025388f }, { 0x2453cfb1u } },
+	{ { -6.7566541e-17f, 2.07948428e-16f, -1.0f }, { 0x60100000u } },
+	{ { -0.404508501f, 0.293892622f, 0.866025388f }, { 0x5bb25b31u } },
+	{ { -0.0f, 0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { -0.700629294f, 0.509036958f, 0.5f }, { 0x1004129au } },
+	{ { -0.809017003f, 0.587785244f, 2.18649922e-16f }, { 0x4004b263u } },
+	{ { -0.700629294f, 0.509036958f, -0.5f }, { 0x3004129au } },
+	{ { -0.404508501f, 0.293892622f, -0.866025388f }, { 0x64525b31u } },
+	{ { -1.76891502e-16f, 1.28519197e-16f, -1.0f }, { 0x20100000u } },
+	{ { -0.5f, 1.09324961e-16f, 0.866025388f }, { 0x1bb00300u } },
+	{ { -0.0f, 0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { -0.866025388f, 1.89356386e-16f, 0.5f }, { 0x50000245u } },
+	{ { -1.0f, 2.18649922e-16f, 2.18649922e-16f }, { 0x00000201u } },
+	{ { -0.866025388f, 1.89356386e-16f, -0.5f }, { 0x70000245u } },
+	{ { -0.5f, 1.09324961e-16f, -0.866025388f }, { 0x24500300u } },
+	{ { -2.18649922e-16f, 4.78077872e-32f, -1.0f }, { 0x60100000u } },
+	{ { -0.404508501f, -0.293892622f, 0.866025388f }, { 0x5bbdab31u } },
+	{ { -0.0f, -0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { -0.700629294f, -0.509036958f, 0.5f }, { 0x100bf29au } },
+	{ { -0.809017003f, -0.587785244f, 2.18649922e-16f }, { 0x400b5263u } },
+	{ { -0.700629294f, -0.509036958f, -0.5f }, { 0x300bf29au } },
+	{ { -0.404508501f, -0.293892622f, -0.866025388f }, { 0x645dab31u } },
+	{ { -1.76891502e-16f, -1.28519197e-16f, -1.0f }, { 0x20100000u } },
+	{ { -0.154508501f, -0.47552827f, 0.866025388f }, { 0x1bbc37b1u } },
+	{ { -0.0f, -0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { -0.26761657f, -0.823639095f, 0.5f }, { 0x50096f77u } },
+	{ { -0.309017003f, -0.95105654f, 2.18649922e-16f }, { 0x00086b62u } },
+	{ { -0.26761657f, -0.823639095f, -0.5f }, { 0x70096f77u } },
+	{ { -0.154508501f, -0.47552827f, -0.866025388f }, { 0x245c37b1u } },
+	{ { -6.7566541e-17f, -2.07948428e-16f, -1.0f }, { 0x60100000u } },
+	{ { 0.154508501f, -0.47552827f, 0.866025388f }, { 0x5bbc344fu } },
+	{ { 0.0f, -0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { 0.26761657f, -0.823639095f, 0.5f }, { 0x10096c89u } },
+	{ { 0.309017003f, -0.95105654f, 2.18649922e-16f }, { 0x4008689eu } },
+	{ { 0.26761657f, -0.823639095f, -0.5f }, { 0x30096c89u } },
+	{ { 0.154508501f, -0.47552827f, -0.866025388f }, { 0x645c344fu } },
+	{ { 6.7566541e-17f, -2.07948428e-16f, -1.0f }, { 0x20100000u } },
+	{ { 0.404508501f, -0.293892622f, 0.866025388f }, { 0x1bbda8cfu } },
+	{ { 0.0f, -0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { 0.700629294f, -0.509036958f, 0.5f }, { 0x500bf166u } },
+	{ { 0.809017003f, -0.587785244f, 2.18649922e-16f }, { 0x000b519du } },
+	{ { 0.700629294f, -0.509036958f, -0.5f }, { 0x700bf166u } },
+	{ { 0.404508501f, -0.293892622f, -0.866025388f }, { 0x245da8cfu } },
+	{ { 1.76891502e-16f, -1.28519197e-16f, -1.0f }, { 0x60100000u } },
+	{ { 0.5f, 0.0f, 0.866025388f }, { 0x5bb00100u } },
+	{ { 0.0f, 0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { 0.866025388f, 0.0f, 0.5f }, { 0x100001bbu } },
+	{ { 1.0f, 0.0f, 2.18649922e-16f }, { 0x400001ffu } },
+	{ { 0.866025388f, 0.0f, -0.5f }, { 0x300001bbu } },
+	{ { 0.5f, 0.0f, -0.866025388f }, { 0x64500100u } },
+	{ { 2.18649922e-16f, 0.0f, -1.0f }, { 0x20100000u } },
+	// ball level 2
+	{ { 0.0f, 0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { 0.344785869f, 0.166040123f, 0.923879504f }, { 0x1d8154b0u } },
+	{ { 0.382683426f, 0.0f, 0.923879504f }, { 0x5d8000c4u } },
+	{ { 0.0f, 0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { 0.637081206f, 0.306802124f, 0.707106769f }, { 0x56927546u } },
+	{ { 0.707106769f, 0.0f, 0.707106769f }, { 0x16900169u } },
+	{ { 0.832386672f, 0.400856316f, 0.382683426f }, { 0x0c4335a9u } },
+	{ { 0.923879504f, 0.0f, 0.382683426f }, { 0x4c4001d8u } },
+	{ { 0.90096885f, 0.433883727f, 2.18649922e-16f }, { 0x400379ccu } },
+	{ { 1.0f, 0.0f, 2.18649922e-16f }, { 0x000001ffu } },
+	{ { 0.832386672f, 0.400856316f, -0.382683426f }, { 0x33c335a9u } },
+	{ { 0.923879504f, 0.0f, -0.382683426f }, { 0x73c001d8u } },
+	{ { 0.637081206f, 0.306802124f, -0.707106769f }, { 0x69727546u } },
+	{ { 0.707106769f, 0.0f, -0.707106769f }, { 0x29700169u } },
+	{ { 0.344785869f, 0.166040123f, -0.923879504f }, { 0x228154b0u } },
+	{ { 0.382683426f, 0.0f, -0.923879504f }, { 0x628000c4u } },
+	{ { 1.96996769e-16f, 9.4868643e-17f, -1.0f }, { 0x60100000u } },
+	{ { 2.18649922e-16f, 0.0f, -1.0f }, { 0x20100000u } },
+	{ { 0.238599211f, 0.299193949f, 0.923879504f }, { 0x5d82647au } },
+	{ { 0.0f, 0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { 0.440873861f, 0.552838326f, 0.707106769f }, { 0x16946ce1u } },
+	{ { 0.57602948f, 0.722318113f, 0.382683426f }, { 0x4c45c526u } },
+	{ { 0.623489797f, 0.781831503f, 2.18649922e-16f }, { 0x0006413fu } },
+	{ { 0.57602948f, 0.722318113f, -0.382683426f }, { 0x73c5c526u } },
+	{ { 0.440873861f, 0.552838326f, -0.707106769f }, { 0x29746ce1u } },
+	{ { 0.238599211f, 0.299193949f, -0.923879504f }, { 0x6282647au } },
+	{ { 1.36325996e-16f, 1.70947395e-16f, -1.0f }, { 0x20100000u } },
+	{ { 0.0851550773f, 0.373088747f, 0.923879504f }, { 0x1d82fc2cu } },
+	{ { 0.0f, 0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { 0.157346055f, 0.689378142f, 0.707106769f }, { 0x56958050u } },
+	{ { 0.205582529f, 0.900715947f, 0.382683426f }, { 0x0c473069u } },
+	{ { 0.222520933f, 0.974927902f, 2.18649922e-16f }, { 0x4007c872u } },
+	{ { 0.205582529f, 0.900715947f, -0.382683426f }, { 0x33c73069u } },
+	{ { 0.157346055f, 0.689378142f, -0.707106769f }, { 0x69758050u } },
+	{ { 0.0851550773f, 0.373088747f, -0.923879504f }, { 0x2282fc2cu } },
+	{ { 4.86541846e-17f, 2.13167911e-16f, -1.0f }, { 0x60100000u } },
+	{ { -0.0851550773f, 0.373088747f, 0.923879504f }, { 0x5d82ffd4u } },
+	{ { -0.0f, 0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { -0.157346055f, 0.689378142f, 0.707106769f }, { 0x169583b0u } },
+	{ { -0.205582529f, 0.900715947f, 0.382683426f }, { 0x4c473397u } },
+	{ { -0.222520933f, 0.974927902f, 2.18649922e-16f }, { 0x0007cb8eu } },
+	{ { -0.205582529f, 0.900715947f, -0.382683426f }, { 0x73c73397u } },
+	{ { -0.157346055f, 0.689378142f, -0.707106769f }, { 0x297583b0u } },
+	{ { -0.0851550773f, 0.373088747f, -0.923879504f }, { 0x6282ffd4u } },
+	{ { -4.86541846e-17f, 2.13167911e-16f, -1.0f }, { 0x20100000u } },
+	{ { -0.238599211f, 0.299193949f, 0.923879504f }, { 0x1d826786u } },
+	{ { -0.0f, 0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { -0.440873861f, 0.552838326f, 0.707106769f }, { 0x56946f1fu } },
+	{ { -0.57602948f, 0.722318113f, 0.382683426f }, { 0x0c45c6dau } },
+	{ { -0.623489797f, 0.781831503f, 2.18649922e-16f }, { 0x400642c1u } },
+	{ { -0.57602948f, 0.722318113f, -0.382683426f }, { 0x33c5c6dau } },
+	{ { -0.440873861f, 0.552838326f, -0.707106769f }, { 0x69746f1fu } },
+	{ { -0.238599211f, 0.299193949f, -0.923879504f }, { 0x22826786u } },
+	{ { -1.36325996e-16f, 1.70947395e-16f, -1.0f }, { 0x60100000u } },
+	{ { -0.344785869f, 0.166040123f, 0.923879504f }, { 0x5d815750u } },
+	{ { -0.0f, 0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { -0.637081206f, 0.306802124f, 0.707106769f }, { 0x169276bau } },
+	{ { -0.832386672f, 0.400856316f, 0.382683426f }, { 0x4c433657u } },
+	{ { -0.90096885f, 0.433883727f, 2.18649922e-16f }, { 0x00037a34u } },
+	{ { -0.832386672f, 0.400856316f, -0.382683426f }, { 0x73c33657u } },
+	{ { -0.637081206f, 0.306802124f, -0.707106769f }, { 0x297276bau } },
+	{ { -0.344785869f, 0.166040123f, -0.923879504f }, { 0x62815750u } },
+	{ { -1.96996769e-16f, 9.4868643e-17f, -1.0f }, { 0x20100000u } },
+	{ { -0.382683426f, 8.36736997e-17f, 0.923879504f }, { 0x1d80033cu } },
+	{ { -0.0f, 0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { -0.707106769f, 1.54608844e-16f, 0.707106769f }, { 0x56900297u } },
+	{ { -0.923879504f, 2.02006188e-16f, 0.382683426f }, { 0x0c400228u } },
+	{ { -1.0f, 2.18649922e-16f, 2.18649922e-16f }, { 0x40000201u } },
+	{ { -0.923879504f, 2.02006188e-16f, -0.382683426f }, { 0x33c00228u } },
+	{ { -0.707106769f, 1.54608844e-16f, -0.707106769f }, { 0x69700297u } },
+	{ { -0.382683426f, 8.36736997e-17f, -0.923879504f }, { 0x2280033cu } },
+	{ { -2.18649922e-16f, 4.78077872e-32f, -1.0f }, { 0x60100000u } },
+	{ { -0.344785869f, -0.166040123f, 0.923879504f }, { 0x5d8eaf50u } },
+	{ { -0.0f, -0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { -0.637081206f, -0.306802124f, 0.707106769f }, { 0x169d8ebau } },
+	{ { -0.832386672f, -0.400856316f, 0.382683426f }, { 0x4c4cce57u } },
+	{ { -0.90096885f, -0.433883727f, 2.18649922e-16f }, { 0x000c8a34u } },
+	{ { -0.832386672f, -0.400856316f, -0.382683426f }, { 0x73ccce57u } },
+	{ { -0.637081206f, -0.306802124f, -0.707106769f }, { 0x297d8ebau } },
+	{ { -0.344785869f, -0.166040123f, -0.923879504f }, { 0x628eaf50u } },
+	{ { -1.96996769e-16f, -9.4868643e-17f, -1.0f }, { 0x20100000u } },
+	{ { -0.238599211f, -0.299193949f, 0.923879504f }, { 0x1d8d9f86u } },
+	{ { -0.0f, -0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { -0.440873861f, -0.552838326f, 0.707106769f }, { 0x569b971fu } },
+	{ { -0.57602948f, -0.722318113f, 0.382683426f }, { 0x0c4a3edau } },
+	{ { -0.623489797f, -0.781831503f, 2.18649922e-16f }, { 0x4009c2c1u } },
+	{ { -0.57602948f, -0.722318113f, -0.382683426f }, { 0x33ca3edau } },
+	{ { -0.440873861f, -0.552838326f, -0.707106769f }, { 0x697b971fu } },
+	{ { -0.238599211f, -0.299193949f, -0.923879504f }, { 0x228d9f86u } },
+	{ { -1.36325996e-16f, -1.70947395e-16f, -1.0f }, { 0x60100000u } },
+	{ { -0.0851550773f, -0.373088747f, 0.923879504f }, { 0x5d8d07d4u } },
+	{ { -0.0f, -0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { -0.157346055f, -0.689378142f, 0.707106769f }, { 0x169a83b0u } },
+	{ { -0.205582529f, -0.900715947f, 0.382683426f }, { 0x4c48d397u } },
+	{ { -0.222520933f, -0.974927902f, 2.18649922e-16f }, { 0x00083b8eu } },
+	{ { -0.205582529f, -0.900715947f, -0.382683426f }, { 0x73c8d397u } },
+	{ { -0.157346055f, -0.689378142f, -0.707106769f }, { 0x297a83b0u } },
+	{ { -0.0851550773f, -0.373088747f, -0.923879504f }, { 0x628d07d4u } },
+	{ { -4.86541846e-17f, -2.13167911e-16f, -1.0f }, { 0x20100000u } },
+	{ { 0.0851550773f, -0.373088747f, 0.923879504f }, { 0x1d8d042cu } },
+	{ { 0.0f, -0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { 0.157346055f, -0.689378142f, 0.707106769f }, { 0x569a8050u } },
+	{ { 0.205582529f, -0.900715947f, 0.382683426f }, { 0x0c48d069u } },
+	{ { 0.222520933f, -0.974927902f, 2.18649922e-16f }, { 0x40083872u } },
+	{ { 0.205582529f, -0.900715947f, -0.382683426f }, { 0x33c8d069u } },
+	{ { 0.157346055f, -0.689378142f, -0.707106769f }, { 0x697a8050u } },
+	{ { 0.0851550773f, -0.373088747f, -0.923879504f }, { 0x228d042cu } },
+	{ { 4.86541846e-17f, -2.13167911e-16f, -1.0f }, { 0x60100000u } },
+	{ { 0.238599211f, -0.299193949f, 0.923879504f }, { 0x5d8d9c7au } },
+	{ { 0.0f, -0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { 0.440873861f, -0.552838326f, 0.707106769f }, { 0x169b94e1u } },
+	{ { 0.57602948f, -0.722318113f, 0.382683426f }, { 0x4c4a3d26u } },
+	{ { 0.623489797f, -0.781831503f, 2.18649922e-16f }, { 0x0009c13fu } },
+	{ { 0.57602948f, -0.722318113f, -0.382683426f }, { 0x73ca3d26u } },
+	{ { 0.440873861f, -0.552838326f, -0.707106769f }, { 0x297b94e1u } },
+	{ { 0.238599211f, -0.299193949f, -0.923879504f }, { 0x628d9c7au } },
+	{ { 1.36325996e-16f, -1.70947395e-16f, -1.0f }, { 0x20100000u } },
+	{ { 0.344785869f, -0.166040123f, 0.923879504f }, { 0x1d8eacb0u } },
+	{ { 0.0f, -0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { 0.637081206f, -0.306802124f, 0.707106769f }, { 0x569d8d46u } },
+	{ { 0.832386672f, -0.400856316f, 0.382683426f }, { 0x0c4ccda9u } },
+	{ { 0.90096885f, -0.433883727f, 2.18649922e-16f }, { 0x400c89ccu } },
+	{ { 0.832386672f, -0.400856316f, -0.382683426f }, { 0x33cccda9u } },
+	{ { 0.637081206f, -0.306802124f, -0.707106769f }, { 0x697d8d46u } },
+	{ { 0.344785869f, -0.166040123f, -0.923879504f }, { 0x228eacb0u } },
+	{ { 1.96996769e-16f, -9.4868643e-17f, -1.0f }, { 0x60100000u } },
+	{ { 0.382683426f, 0.0f, 0.923879504f }, { 0x5d8000c4u } },
+	{ { 0.0f, 0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { 0.707106769f, 0.0f, 0.707106769f }, { 0x16900169u } },
+	{ { 0.923879504f, 0.0f, 0.382683426f }, { 0x4c4001d8u } },
+	{ { 1.0f, 0.0f, 2.18649922e-16f }, { 0x000001ffu } },
+	{ { 0.923879504f, 0.0f, -0.382683426f }, { 0x73c001d8u } },
+	{ { 0.707106769f, 0.0f, -0.707106769f }, { 0x29700169u } },
+	{ { 0.382683426f, 0.0f, -0.923879504f }, { 0x628000c4u } },
+	{ { 2.18649922e-16f, 0.0f, -1.0f }, { 0x20100000u } },
+	// ball level 3
+	{ { 0.0f, 0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { 0.21350728f, 0.0626913905f, 0.974927902f }, { 0x1f20806du } },
+	{ { 0.222520933f, 0.0f, 0.974927902f }, { 0x5f200072u } },
+	{ { 0.0f, 0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { 0.416308403f, 0.122239172f, 0.90096885f }, { 0x5cc0f8d5u } },
+	{ { 0.433883727f, 0.0f, 0.90096885f }, { 0x1cc000deu } },
+	{ { 0.598234057f, 0.175657377f, 0.781831503f }, { 0x19016932u } },
+	{ { 0.623489797f, 0.0f, 0.781831503f }, { 0x5900013fu } },
+	{ { 0.750161827f, 0.220267385f, 0.623489797f }, { 0x53f1c57fu } },
+	{ { 0.781831503f, 0.0f, 0.623489797f }, { 0x13f00190u } },
+	{ { 0.864473283f, 0.253832251f, 0.433883727f }, { 0x0de209bau } },
+	{ { 0.90096885f, 0.0f, 0.433883727f }, { 0x4de001ccu } },
+	{ { 0.935436487f, 0.274668932f, 0.222520933f }, { 0x472231deu } },
+	{ { 0.974927902f, 0.0f, 0.222520933f }, { 0x072001f2u } },
+	{ { 0.959492981f, 0.281732559f, 2.18649922e-16f }, { 0x000241eau } },
+	{ { 1.0f, 0.0f, 2.18649922e-16f }, { 0x400001ffu } },
+	{ { 0.935436487f, 0.274668932f, -0.222520933f }, { 0x78e231deu } },
+	{ { 0.974927902f, 0.0f, -0.222520933f }, { 0x38e001f2u } },
+	{ { 0.864473283f, 0.253832251f, -0.433883727f }, { 0x322209bau } },
+	{ { 0.90096885f, 0.0f, -0.433883727f }, { 0x722001ccu } },
+	{ { 0.750161827f, 0.220267385f, -0.623489797f }, { 0x6c11c57fu } },
+	{ { 0.781831503f, 0.0f, -0.623489797f }, { 0x2c100190u } },
+	{ { 0.598234057f, 0.175657377f, -0.781831503f }, { 0x27016932u } },
+	{ { 0.623489797f, 0.0f, -0.781831503f }, { 0x6700013fu } },
+	{ { 0.416308403f, 0.122239172f, -0.90096885f }, { 0x6340f8d5u } },
+	{ { 0.433883727f, 0.0f, -0.90096885f }, { 0x234000deu } },
+	{ { 0.21350728f, 0.0626913905f, -0.974927902f }, { 0x20e0806du } },
+	{ { 0.222520933f, 0.0f, -0.974927902f }, { 0x60e00072u } },
+	{ { 2.09793067e-16f, 6.1600802e-17f, -1.0f }, { 0x60100000u } },
+	{ { 2.18649922e-16f, 0.0f, -1.0f }, { 0x20100000u } },
+	{ { 0.187196523f, 0.120303899f, 0.974927902f }, { 0x5f20f460u } },
+	{ { 0.0f, 0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { 0.365006238f, 0.234575257f, 0.90096885f }, { 0x1cc1e0bbu } },
+	{ { 0.524513006f, 0.337084025f, 0.781831503f }, { 0x5902b10cu } },
+	{ { 0.65771848f, 0.422690004f, 0.623489797f }, { 0x13f36150u } },
+	{ { 0.757943273f, 0.487100542f, 0.433883727f }, { 0x4de3e583u } },
+	{ { 0.820161521f, 0.527085841f, 0.222520933f }, { 0x072435a3u } },
+	{ { 0.841253519f, 0.540640831f, 2.18649922e-16f }, { 0x400451aeu } },
+	{ { 0.820161521f, 0.527085841f, -0.222520933f }, { 0x38e435a3u } },
+	{ { 0.757943273f, 0.487100542f, -0.433883727f }, { 0x7223e583u } },
+	{ { 0.65771848f, 0.422690004f, -0.623489797f }, { 0x2c136150u } },
+	{ { 0.524513006f, 0.337084025f, -0.781831503f }, { 0x6702b10cu } },
+	{ { 0.365006238f, 0.234575257f, -0.90096885f }, { 0x2341e0bbu } },
+	{ { 0.187196523f, 0.120303899f, -0.974927902f }, { 0x60e0f460u } },
+	{ { 1.8394002e-16f, 1.18211071e-16f, -1.0f }, { 0x20100000u } },
+	{ { 0.145720229f, 0.168170094f, 0.974927902f }, { 0x1f21584au } },
+	{ { 0.0f, 0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { 0.284133434f, 0.327907443f, 0.90096885f }, { 0x5cc2a091u } },
+	{ { 0.408298999f, 0.471202165f, 0.781831503f }, { 0x1903c4d1u } },
+	{ { 0.511990726f, 0.590868831f, 0.623489797f }, { 0x53f4b906u } },
+	{ { 0.590009153f, 0.680906832f, 0.433883727f }, { 0x0de5712du } },
+	{ { 0.63844198f, 0.736801326f, 0.222520933f }, { 0x4725e546u } },
+	{ { 0.654860735f, 0.755749583f, 2.18649922e-16f }, { 0x0006094fu } },
+	{ { 0.63844198f, 0.736801326f, -0.222520933f }, { 0x78e5e546u } },
+	{ { 0.590009153f, 0.680906832f, -0.433883727f }, { 0x3225712du } },
+	{ { 0.511990726f, 0.590868831f, -0.623489797f }, { 0x6c14b906u } },
+	{ { 0.408298999f, 0.471202165f, -0.781831503f }, { 0x2703c4d1u } },
+	{ { 0.284133434f, 0.327907443f, -0.90096885f }, { 0x6342a091u } },
+	{ { 0.145720229f, 0.168170094f, -0.974927902f }, { 0x20e1584au } },
+	{ { 1.43185242e-16f, 1.65244587e-16f, -1.0f }, { 0x60100000u } },
+	{ { 0.0924385339f, 0.202412158f, 0.974927902f }, { 0x5f219c2fu } },
+	{ { 0.0f, 0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { 0.180241823f, 0.39467454f, 0.90096885f }, { 0x1cc3285cu } },
+	{ { 0.259007037f, 0.567146301f, 0.781831503f }, { 0x59048884u } },
+	{ { 0.324784547f, 0.711178958f, 0.623489797f }, { 0x13f5aca6u } },
+	{ { 0.374275982f, 0.819550097f, 0.433883727f }, { 0x4de68cbfu } },
+	{ { 0.404999703f, 0.886825621f, 0.222520933f }, { 0x072714cfu } },
+	{ { 0.415415019f, 0.909631968f, 2.18649922e-16f }, { 0x400744d4u } },
+	{ { 0.404999703f, 0.886825621f, -0.222520933f }, { 0x38e714cfu } },
+	{ { 0.374275982f, 0.819550097f, -0.433883727f }, { 0x72268cbfu } },
+	{ { 0.324784547f, 0.711178958f, -0.623489797f }, { 0x2c15aca6u } },
+	{ { 0.259007037f, 0.567146301f, -0.781831503f }, { 0x67048884u } },
+	{ { 0.180241823f, 0.39467454f, -0.90096885f }, { 0x2343285cu } },
+	{ { 0.0924385339f, 0.202412158f, -0.974927902f }, { 0x60e19c2fu } },
+	{ { 9.08304598e-17f, 1.98890959e-16f, -1.0f }, { 0x20100000u } },
+	{ { 0.0316680297f, 0.220255986f, 0.974927902f }, { 0x1f21c410u } },
+	{ { 0.0f, 0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { 0.0617480949f, 0.42946744f, 0.90096885f }, { 0x5cc36c20u } },
+	{ { 0.0887318477f, 0.617143571f, 0.781831503f }, { 0x1904ec2du } },
+	{ { 0.111266218f, 0.773873568f, 0.623489797f }, { 0x53f62c39u } },
+	{ { 0.128221244f, 0.891798317f, 0.433883727f }, { 0x0de72042u } },
+	{ { 0.138746709f, 0.965004563f, 0.222520933f }, { 0x4727b447u } },
+	{ { 0.142314836f, 0.989821434f, 2.18649922e-16f }, { 0x0007e849u } },
+	{ { 0.138746709f, 0.965004563f, -0.222520933f }, { 0x78e7b447u } },
+	{ { 0.128221244f, 0.891798317f, -0.433883727f }, { 0x32272042u } },
+	{ { 0.111266218f, 0.773873568f, -0.623489797f }, { 0x6c162c39u } },
+	{ { 0.0887318477f, 0.617143571f, -0.781831503f }, { 0x2704ec2du } },
+	{ { 0.0617480949f, 0.42946744f, -0.90096885f }, { 0x63436c20u } },
+	{ { 0.0316680297f, 0.220255986f, -0.974927902f }, { 0x20e1c410u } },
+	{ { 3.11171284e-17f, 2.16424383e-16f, -1.0f }, { 0x60100000u } },
+	{ { -0.0316680297f, 0.220255986f, 0.974927902f }, { 0x5f21c7f0u } },
+	{ { -0.0f, 0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { -0.0617480949f, 0.42946744f, 0.90096885f }, { 0x1cc36fe0u } },
+	{ { -0.0887318477f, 0.617143571f, 0.781831503f }, { 0x5904efd3u } },
+	{ { -0.111266218f, 0.773873568f, 0.623489797f }, { 0x13f62fc7u } },
+	{ { -0.128221244f, 0.891798317f, 0.433883727f }, { 0x4de723beu } },
+	{ { -0.138746709f, 0.965004563f, 0.222520933f }, { 0x0727b7b9u } },
+	{ { -0.142314836f, 0.989821434f, 2.18649922e-16f }, { 0x4007ebb7u } },
+	{ { -0.138746709f, 0.965004563f, -0.222520933f }, { 0x38e7b7b9u } },
+	{ { -0.128221244f, 0.891798317f, -0.433883727f }, { 0x722723beu } },
+	{ { -0.111266218f, 0.773873568f, -0.623489797f }, { 0x2c162fc7u } },
+	{ { -0.0887318477f, 0.617143571f, -0.781831503f }, { 0x6704efd3u } },
+	{ { -0.0617480949f, 0.42946744f, -0.90096885f }, { 0x23436fe0u } },
+	{ { -0.0316680297f, 0.220255986f, -0.974927902f }, { 0x60e1c7f0u } },
+	{ { -3.11171284e-17f, 2.16424383e-16f, -1.0f }, { 0x20100000u } },
+	{ { -0.0924385339f, 0.202412158f, 0.974927902f }, { 0x1f219fd1u } },
+	{ { -0.0f, 0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { -0.180241823f, 0.39467454f, 0.90096885f }, { 0x5cc32ba4u } },
+	{ { -0.259007037f, 0.567146301f, 0.781831503f }, { 0x19048b7cu } },
+	{ { -0.324784547f, 0.711178958f, 0.623489797f }, { 0x53f5af5au } },
+	{ { -0.374275982f, 0.819550097f, 0.433883727f }, { 0x0de68f41u } },
+	{ { -0.404999703f, 0.886825621f, 0.222520933f }, { 0x47271731u } },
+	{ { -0.415415019f, 0.909631968f, 2.18649922e-16f }, { 0x0007472cu } },
+	{ { -0.404999703f, 0.886825621f, -0.222520933f }, { 0x78e71731u } },
+	{ { -0.374275982f, 0.819550097f, -0.433883727f }, { 0x32268f41u } },
+	{ { -0.324784547f, 0.711178958f, -0.623489797f }, { 0x6c15af5au } },
+	{ { -0.259007037f, 0.567146301f, -0.781831503f }, { 0x27048b7cu } },
+	{ { -0.180241823f, 0.39467454f, -0.90096885f }, { 0x63432ba4u } },
+	{ { -0.0924385339f, 0.202412158f, -0.974927902f }, { 0x20e19fd1u } },
+	{ { -9.08304598e-17f, 1.98890959e-16f, -1.0f }, { 0x60100000u } },
+	{ { -0.145720229f, 0.168170094f, 0.974927902f }, { 0x5f215bb6u } },
+	{ { -0.0f, 0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { -0.284133434f, 0.327907443f, 0.90096885f }, { 0x1cc2a36fu } },
+	{ { -0.408298999f, 0.471202165f, 0.781831503f }, { 0x5903c72fu } },
+	{ { -0.511990726f, 0.590868831f, 0.623489797f }, { 0x13f4bafau } },
+	{ { -0.590009153f, 0.680906832f, 0.433883727f }, { 0x4de572d3u } },
+	{ { -0.63844198f, 0.736801326f, 0.222520933f }, { 0x0725e6bau } },
+	{ { -0.654860735f, 0.755749583f, 2.18649922e-16f }, { 0x40060ab1u } },
+	{ { -0.63844198f, 0.736801326f, -0.222520933f }, { 0x38e5e6bau } },
+	{ { -0.590009153f, 0.680906832f, -0.433883727f }, { 0x722572d3u } },
+	{ { -0.511990726f, 0.590868831f, -0.623489797f }, { 0x2c14bafau } },
+	{ { -0.408298999f, 0.471202165f, -0.781831503f }, { 0x6703c72fu } },
+	{ { -0.284133434f, 0.327907443f, -0.90096885f }, { 0x2342a36fu } },
+	{ { -0.145720229f, 0.168170094f, -0.974927902f }, { 0x60e15bb6u } },
+	{ { -1.43185242e-16f, 1.65244587e-16f, -1.0f }, { 0x20100000u } },
+	{ { -0.187196523f, 0.120303899f, 0.974927902f }, { 0x1f20f7a0u } },
+	{ { -0.0f, 0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { -0.365006238f, 0.234575257f, 0.90096885f }, { 0x5cc1e345u } },
+	{ { -0.524513006f, 0.337084025f, 0.781831503f }, { 0x1902b2f4u } },
+	{ { -0.65771848f, 0.422690004f, 0.623489797f }, { 0x53f362b0u } },
+	{ { -0.757943273f, 0.487100542f, 0.433883727f }, { 0x0de3e67du } },
+	{ { -0.820161521f, 0.527085841f, 0.222520933f }, { 0x4724365du } },
+	{ { -0.841253519f, 0.540640831f, 2.18649922e-16f }, { 0x00045252u } },
+	{ { -0.820161521f, 0.527085841f, -0.222520933f }, { 0x78e4365du } },
+	{ { -0.757943273f, 0.487100542f, -0.433883727f }, { 0x3223e67du } },
+	{ { -0.65771848f, 0.422690004f, -0.623489797f }, { 0x6c1362b0u } },
+	{ { -0.524513006f, 0.337084025f, -0.781831503f }, { 0x2702b2f4u } },
+	{ { -0.365006238f, 0.234575257f, -0.90096885f }, { 0x6341e345u } },
+	{ { -0.187196523f, 0.120303899f, -0.974927902f }, { 0x20e0f7a0u } },
+	{ { -1.8394002e-16f, 1.18211071e-16f, -1.0f }, { 0x60100000u } },
+	{ { -0.21350728f, 0.0626913905f, 0.974927902f }, { 0x5f208393u } },
+	{ { -0.0f, 0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { -0.416308403f, 0.122239172f, 0.90096885f }, { 0x1cc0fb2bu } },
+	{ { -0.598234057f, 0.175657377f, 0.781831503f }, { 0x59016aceu } },
+	{ { -0.750161827f, 0.220267385f, 0.623489797f }, { 0x13f1c681u } },
+	{ { -0.864473283f, 0.253832251f, 0.433883727f }, { 0x4de20a46u } },
+	{ { -0.935436487f, 0.274668932f, 0.222520933f }, { 0x07223222u } },
+	{ { -0.959492981f, 0.281732559f, 2.18649922e-16f }, { 0x40024216u } },
+	{ { -0.935436487f, 0.274668932f, -0.222520933f }, { 0x38e23222u } },
+	{ { -0.864473283f, 0.253832251f, -0.433883727f }, { 0x72220a46u } },
+	{ { -0.750161827f, 0.220267385f, -0.623489797f }, { 0x2c11c681u } },
+	{ { -0.598234057f, 0.175657377f, -0.781831503f }, { 0x67016aceu } },
+	{ { -0.416308403f, 0.122239172f, -0.90096885f }, { 0x2340fb2bu } },
+	{ { -0.21350728f, 0.0626913905f, -0.974927902f }, { 0x60e08393u } },
+	{ { -2.09793067e-16f, 6.1600802e-17f, -1.0f }, { 0x20100000u } },
+	{ { -0.222520933f, 4.86541846e-17f, 0.974927902f }, { 0x1f20038eu } },
+	{ { -0.0f, 0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { -0.433883727f, 9.4868643e-17f, 0.90096885f }, { 0x5cc00322u } },
+	{ { -0.623489797f, 1.36325996e-16f, 0.781831503f }, { 0x190002c1u } },
+	{ { -0.781831503f, 1.70947395e-16f, 0.623489797f }, { 0x53f00270u } },
+	{ { -0.90096885f, 1.96996769e-16f, 0.433883727f }, { 0x0de00234u } },
+	{ { -0.974927902f, 2.13167911e-16f, 0.222520933f }, { 0x4720020eu } },
+	{ { -1.0f, 2.18649922e-16f, 2.18649922e-16f }, { 0x00000201u } },
+	{ { -0.974927902f, 2.13167911e-16f, -0.222520933f }, { 0x78e0020eu } },
+	{ { -0.90096885f, 1.96996769e-16f, -0.433883727f }, { 0x32200234u } },
+	{ { -0.781831503f, 1.70947395e-16f, -0.623489797f }, { 0x6c100270u } },
+	{ { -0.623489797f, 1.36325996e-16f, -0.781831503f }, { 0x270002c1u } },
+	{ { -0.433883727f, 9.4868643e-17f, -0.90096885f }, { 0x63400322u } },
+	{ { -0.222520933f, 4.86541846e-17f, -0.974927902f }, { 0x20e0038eu } },
+	{ { -2.18649922e-16f, 4.78077872e-32f, -1.0f }, { 0x60100000u } },
+	{ { -0.21350728f, -0.0626913905f, 0.974927902f }, { 0x5f2f8393u } },
+	{ { -0.0f, -0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { -0.416308403f, -0.122239172f, 0.90096885f }, { 0x1ccf0b2bu } },
+	{ { -0.598234057f, -0.175657377f, 0.781831503f }, { 0x590e9aceu } },
+	{ { -0.750161827f, -0.220267385f, 0.623489797f }, { 0x13fe3e81u } },
+	{ { -0.864473283f, -0.253832251f, 0.433883727f }, { 0x4dedfa46u } },
+	{ { -0.935436487f, -0.274668932f, 0.222520933f }, { 0x072dd222u } },
+	{ { -0.959492981f, -0.281732559f, 2.18649922e-16f }, { 0x400dc216u } },
+	{ { -0.935436487f, -0.274668932f, -0.222520933f }, { 0x38edd222u } },
+	{ { -0.864473283f, -0.253832251f, -0.433883727f }, { 0x722dfa46u } },
+	{ { -0.750161827f, -0.220267385f, -0.623489797f }, { 0x2c1e3e81u } },
+	{ { -0.598234057f, -0.175657377f, -0.781831503f }, { 0x670e9aceu } },
+	{ { -0.416308403f, -0.122239172f, -0.90096885f }, { 0x234f0b2bu } },
+	{ { -0.21350728f, -0.0626913905f, -0.974927902f }, { 0x60ef8393u } },
+	{ { -2.09793067e-16f, -6.1600802e-17f, -1.0f }, { 0x20100000u } },
+	{ { -0.187196523f, -0.120303899f, 0.974927902f }, { 0x1f2f0fa0u } },
+	{ { -0.0f, -0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { -0.365006238f, -0.234575257f, 0.90096885f }, { 0x5cce2345u } },
+	{ { -0.524513006f, -0.337084025f, 0.781831503f }, { 0x190d52f4u } },
+	{ { -0.65771848f, -0.422690004f, 0.623489797f }, { 0x53fca2b0u } },
+	{ { -0.757943273f, -0.487100542f, 0.433883727f }, { 0x0dec1e7du } },
+	{ { -0.820161521f, -0.527085841f, 0.222520933f }, { 0x472bce5du } },
+	{ { -0.841253519f, -0.540640831f, 2.18649922e-16f }, { 0x000bb252u } },
+	{ { -0.820161521f, -0.527085841f, -0.222520933f }, { 0x78ebce5du } },
+	{ { -0.757943273f, -0.487100542f, -0.433883727f }, { 0x322c1e7du } },
+	{ { -0.65771848f, -0.422690004f, -0.623489797f }, { 0x6c1ca2b0u } },
+	{ { -0.524513006f, -0.337084025f, -0.781831503f }, { 0x270d52f4u } },
+	{ { -0.365006238f, -0.234575257f, -0.90096885f }, { 0x634e2345u } },
+	{ { -0.187196523f, -0.120303899f, -0.974927902f }, { 0x20ef0fa0u } },
+	{ { -1.8394002e-16f, -1.18211071e-16f, -1.0f }, { 0x60100000u } },
+	{ { -0.145720229f, -0.168170094f, 0.974927902f }, { 0x5f2eabb6u } },
+	{ { -0.0f, -0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { -0.284133434f, -0.327907443f, 0.90096885f }, { 0x1ccd636fu } },
+	{ { -0.408298999f, -0.471202165f, 0.781831503f }, { 0x590c3f2fu } },
+	{ { -0.511990726f, -0.590868831f, 0.623489797f }, { 0x13fb4afau } },
+	{ { -0.590009153f, -0.680906832f, 0.433883727f }, { 0x4dea92d3u } },
+	{ { -0.63844198f, -0.736801326f, 0.222520933f }, { 0x072a1ebau } },
+	{ { -0.654860735f, -0.755749583f, 2.18649922e-16f }, { 0x4009fab1u } },
+	{ { -0.63844198f, -0.736801326f, -0.222520933f }, { 0x38ea1ebau } },
+	{ { -0.590009153f, -0.680906832f, -0.433883727f }, { 0x722a92d3u } },
+	{ { -0.511990726f, -0.590868831f, -0.623489797f }, { 0x2c1b4afau } },
+	{ { -0.408298999f, -0.471202165f, -0.781831503f }, { 0x670c3f2fu } },
+	{ { -0.284133434f, -0.327907443f, -0.90096885f }, { 0x234d636fu } },
+	{ { -0.145720229f, -0.168170094f, -0.974927902f }, { 0x60eeabb6u } },
+	{ { -1.43185242e-16f, -1.65244587e-16f, -1.0f }, { 0x20100000u } },
+	{ { -0.0924385339f, -0.202412158f, 0.974927902f }, { 0x1f2e67d1u } },
+	{ { -0.0f, -0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { -0.180241823f, -0.39467454f, 0.90096885f }, { 0x5cccdba4u } },
+	{ { -0.259007037f, -0.567146301f, 0.781831503f }, { 0x190b7b7cu } },
+	{ { -0.324784547f, -0.711178958f, 0.623489797f }, { 0x53fa575au } },
+	{ { -0.374275982f, -0.819550097f, 0.433883727f }, { 0x0de97741u } },
+	{ { -0.404999703f, -0.886825621f, 0.222520933f }, { 0x4728ef31u } },
+	{ { -0.415415019f, -0.909631968f, 2.18649922e-16f }, { 0x0008bf2cu } },
+	{ { -0.404999703f, -0.886825621f, -0.222520933f }, { 0x78e8ef31u } },
+	{ { -0.374275982f, -0.819550097f, -0.433883727f }, { 0x32297741u } },
+	{ { -0.324784547f, -0.711178958f, -0.623489797f }, { 0x6c1a575au } },
+	{ { -0.259007037f, -0.567146301f, -0.781831503f }, { 0x270b7b7cu } },
+	{ { -0.180241823f, -0.39467454f, -0.90096885f }, { 0x634cdba4u } },
+	{ { -0.0924385339f, -0.202412158f, -0.974927902f }, { 0x20ee67d1u } },
+	{ { -9.08304598e-17f, -1.98890959e-16f, -1.0f }, { 0x60100000u } },
+	{ { -0.0316680297f, -0.220255986f, 0.974927902f }, { 0x5f2e3ff0u } },
+	{ { -0.0f, -0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { -0.0617480949f, -0.42946744f, 0.90096885f }, { 0x1ccc97e0u } },
+	{ { -0.0887318477f, -0.617143571f, 0.781831503f }, { 0x590b17d3u } },
+	{ { -0.111266218f, -0.773873568f, 0.623489797f }, { 0x13f9d7c7u } },
+	{ { -0.128221244f, -0.891798317f, 0.433883727f }, { 0x4de8e3beu } },
+	{ { -0.138746709f, -0.965004563f, 0.222520933f }, { 0x07284fb9u } },
+	{ { -0.142314836f, -0.989821434f, 2.18649922e-16f }, { 0x40081bb7u } },
+	{ { -0.138746709f, -0.965004563f, -0.222520933f }, { 0x38e84fb9u } },
+	{ { -0.128221244f, -0.891798317f, -0.433883727f }, { 0x7228e3beu } },
+	{ { -0.111266218f, -0.773873568f, -0.623489797f }, { 0x2c19d7c7u } },
+	{ { -0.0887318477f, -0.617143571f, -0.781831503f }, { 0x670b17d3u } },
+	{ { -0.0617480949f, -0.42946744f, -0.90096885f }, { 0x234c97e0u } },
+	{ { -0.0316680297f, -0.220255986f, -0.974927902f }, { 0x60ee3ff0u } },
+	{ { -3.11171284e-17f, -2.16424383e-16f, -1.0f }, { 0x20100000u } },
+	{ { 0.0316680297f, -0.220255986f, 0.974927902f }, { 0x1f2e3c10u } },
+	{ { 0.0f, -0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { 0.0617480949f, -0.42946744f, 0.90096885f }, { 0x5ccc9420u } },
+	{ { 0.0887318477f, -0.617143571f, 0.781831503f }, { 0x190b142du } },
+	{ { 0.111266218f, -0.773873568f, 0.623489797f }, { 0x53f9d439u } },
+	{ { 0.128221244f, -0.891798317f, 0.433883727f }, { 0x0de8e042u } },
+	{ { 0.138746709f, -0.965004563f, 0.222520933f }, { 0x47284c47u } },
+	{ { 0.142314836f, -0.989821434f, 2.18649922e-16f }, { 0x00081849u } },
+	{ { 0.138746709f, -0.965004563f, -0.222520933f }, { 0x78e84c47u } },
+	{ { 0.128221244f, -0.891798317f, -0.433883727f }, { 0x3228e042u } },
+	{ { 0.111266218f, -0.773873568f, -0.623489797f }, { 0x6c19d439u } },
+	{ { 0.0887318477f, -0.617143571f, -0.781831503f }, { 0x270b142du } },
+	{ { 0.0617480949f, -0.42946744f, -0.90096885f }, { 0x634c9420u } },
+	{ { 0.0316680297f, -0.220255986f, -0.974927902f }, { 0x20ee3c10u } },
+	{ { 3.11171284e-17f, -2.16424383e-16f, -1.0f }, { 0x60100000u } },
+	{ { 0.0924385339f, -0.202412158f, 0.974927902f }, { 0x5f2e642fu } },
+	{ { 0.0f, -0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { 0.180241823f, -0.39467454f, 0.90096885f }, { 0x1cccd85cu } },
+	{ { 0.259007037f, -0.567146301f, 0.781831503f }, { 0x590b7884u } },
+	{ { 0.324784547f, -0.711178958f, 0.623489797f }, { 0x13fa54a6u } },
+	{ { 0.374275982f, -0.819550097f, 0.433883727f }, { 0x4de974bfu } },
+	{ { 0.404999703f, -0.886825621f, 0.222520933f }, { 0x0728eccfu } },
+	{ { 0.415415019f, -0.909631968f, 2.18649922e-16f }, { 0x4008bcd4u } },
+	{ { 0.404999703f, -0.886825621f, -0.222520933f }, { 0x38e8eccfu } },
+	{ { 0.374275982f, -0.819550097f, -0.433883727f }, { 0x722974bfu } },
+	{ { 0.324784547f, -0.711178958f, -0.623489797f }, { 0x2c1a54a6u } },
+	{ { 0.259007037f, -0.567146301f, -0.781831503f }, { 0x670b7884u } },
+	{ { 0.180241823f, -0.39467454f, -0.90096885f }, { 0x234cd85cu } },
+	{ { 0.0924385339f, -0.202412158f, -0.974927902f }, { 0x60ee642fu } },
+	{ { 9.08304598e-17f, -1.98890959e-16f, -1.0f }, { 0x20100000u } },
+	{ { 0.145720229f, -0.168170094f, 0.974927902f }, { 0x1f2ea84au } },
+	{ { 0.0f, -0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { 0.284133434f, -0.327907443f, 0.90096885f }, { 0x5ccd6091u } },
+	{ { 0.408298999f, -0.471202165f, 0.781831503f }, { 0x190c3cd1u } },
+	{ { 0.511990726f, -0.590868831f, 0.623489797f }, { 0x53fb4906u } },
+	{ { 0.590009153f, -0.680906832f, 0.433883727f }, { 0x0dea912du } },
+	{ { 0.63844198f, -0.736801326f, 0.222520933f }, { 0x472a1d46u } },
+	{ { 0.654860735f, -0.755749583f, 2.18649922e-16f }, { 0x0009f94fu } },
+	{ { 0.63844198f, -0.736801326f, -0.222520933f }, { 0x78ea1d46u } },
+	{ { 0.590009153f, -0.680906832f, -0.433883727f }, { 0x322a912du } },
+	{ { 0.511990726f, -0.590868831f, -0.623489797f }, { 0x6c1b4906u } },
+	{ { 0.408298999f, -0.471202165f, -0.781831503f }, { 0x270c3cd1u } },
+	{ { 0.284133434f, -0.327907443f, -0.90096885f }, { 0x634d6091u } },
+	{ { 0.145720229f, -0.168170094f, -0.974927902f }, { 0x20eea84au } },
+	{ { 1.43185242e-16f, -1.65244587e-16f, -1.0f }, { 0x60100000u } },
+	{ { 0.187196523f, -0.120303899f, 0.974927902f }, { 0x5f2f0c60u } },
+	{ { 0.0f, -0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { 0.365006238f, -0.234575257f, 0.90096885f }, { 0x1cce20bbu } },
+	{ { 0.524513006f, -0.337084025f, 0.781831503f }, { 0x590d510cu } },
+	{ { 0.65771848f, -0.422690004f, 0.623489797f }, { 0x13fca150u } },
+	{ { 0.757943273f, -0.487100542f, 0.433883727f }, { 0x4dec1d83u } },
+	{ { 0.820161521f, -0.527085841f, 0.222520933f }, { 0x072bcda3u } },
+	{ { 0.841253519f, -0.540640831f, 2.18649922e-16f }, { 0x400bb1aeu } },
+	{ { 0.820161521f, -0.527085841f, -0.222520933f }, { 0x38ebcda3u } },
+	{ { 0.757943273f, -0.487100542f, -0.433883727f }, { 0x722c1d83u } },
+	{ { 0.65771848f, -0.422690004f, -0.623489797f }, { 0x2c1ca150u } },
+	{ { 0.524513006f, -0.337084025f, -0.781831503f }, { 0x670d510cu } },
+	{ { 0.365006238f, -0.234575257f, -0.90096885f }, { 0x234e20bbu } },
+	{ { 0.187196523f, -0.120303899f, -0.974927902f }, { 0x60ef0c60u } },
+	{ { 1.8394002e-16f, -1.18211071e-16f, -1.0f }, { 0x20100000u } },
+	{ { 0.21350728f, -0.0626913905f, 0.974927902f }, { 0x1f2f806du } },
+	{ { 0.0f, -0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { 0.416308403f, -0.122239172f, 0.90096885f }, { 0x5ccf08d5u } },
+	{ { 0.598234057f, -0.175657377f, 0.781831503f }, { 0x190e9932u } },
+	{ { 0.750161827f, -0.220267385f, 0.623489797f }, { 0x53fe3d7fu } },
+	{ { 0.864473283f, -0.253832251f, 0.433883727f }, { 0x0dedf9bau } },
+	{ { 0.935436487f, -0.274668932f, 0.222520933f }, { 0x472dd1deu } },
+	{ { 0.959492981f, -0.281732559f, 2.18649922e-16f }, { 0x000dc1eau } },
+	{ { 0.935436487f, -0.274668932f, -0.222520933f }, { 0x78edd1deu } },
+	{ { 0.864473283f, -0.253832251f, -0.433883727f }, { 0x322df9bau } },
+	{ { 0.750161827f, -0.220267385f, -0.623489797f }, { 0x6c1e3d7fu } },
+	{ { 0.598234057f, -0.175657377f, -0.781831503f }, { 0x270e9932u } },
+	{ { 0.416308403f, -0.122239172f, -0.90096885f }, { 0x634f08d5u } },
+	{ { 0.21350728f, -0.0626913905f, -0.974927902f }, { 0x20ef806du } },
+	{ { 2.09793067e-16f, -6.1600802e-17f, -1.0f }, { 0x60100000u } },
+	{ { 0.222520933f, 0.0f, 0.974927902f }, { 0x5f200072u } },
+	{ { 0.0f, 0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { 0.433883727f, 0.0f, 0.90096885f }, { 0x1cc000deu } },
+	{ { 0.623489797f, 0.0f, 0.781831503f }, { 0x5900013fu } },
+	{ { 0.781831503f, 0.0f, 0.623489797f }, { 0x13f00190u } },
+	{ { 0.90096885f, 0.0f, 0.433883727f }, { 0x4de001ccu } },
+	{ { 0.974927902f, 0.0f, 0.222520933f }, { 0x072001f2u } },
+	{ { 1.0f, 0.0f, 2.18649922e-16f }, { 0x400001ffu } },
+	{ { 0.974927902f, 0.0f, -0.222520933f }, { 0x38e001f2u } },
+	{ { 0.90096885f, 0.0f, -0.433883727f }, { 0x722001ccu } },
+	{ { 0.781831503f, 0.0f, -0.623489797f }, { 0x2c100190u } },
+	{ { 0.623489797f, 0.0f, -0.781831503f }, { 0x6700013fu } },
+	{ { 0.433883727f, 0.0f, -0.90096885f }, { 0x234000deu } },
+	{ { 0.222520933f, 0.0f, -0.974927902f }, { 0x60e00072u } },
+	{ { 2.18649922e-16f, 0.0f, -1.0f }, { 0x20100000u } },
+	// ball level 4
+	{ { 0.156434461f, 0.0f, -0.987688363f }, { 0x60700050u } },
+	{ { 2.14448625e-16f, 4.26564833e-17f, -1.0f }, { 0x60100000u } },
+	{ { 2.18649922e-16f, 0.0f, -1.0f }, { 0x20100000u } },
+	{ { 0.153428614f, 0.0305188503f, -0.987688363f }, { 0x2070404eu } },
+	{ { 0.309017003f, 0.0f, -0.95105654f }, { 0x21a0009eu } },
+	{ { 2.02006188e-16f, 8.36736997e-17f, -1.0f }, { 0x20100000u } },
+	{ { 0.303079307f, 0.0602862239f, -0.95105654f }, { 0x61a07c9bu } },
+	{ { 0.453990489f, 0.0f, -0.891006529f }, { 0x639000e8u } },
+	{ { 0.144526601f, 0.0598648787f, -0.987688363f }, { 0x60707c4au } },
+	{ { 1.81800759e-16f, 1.2147539e-16f, -1.0f }, { 0x60100000u } },
+	{ { 0.4452672f, 0.0885691494f, -0.891006529f }, { 0x2390b4e4u } },
+	{ { 0.587785244f, 0.0f, -0.809017003f }, { 0x2630012cu } },
+	{ { 0.285494477f, 0.118255682f, -0.95105654f }, { 0x21a0f092u } },
+	{ { 0.130070508f, 0.0869103298f, -0.987688363f }, { 0x2070b042u } },
+	{ { 1.54608844e-16f, 1.54608844e-16f, -1.0f }, { 0x20100000u } },
+	{ { 0.576491117f, 0.114671215f, -0.809017003f }, { 0x6630ed27u } },
+	{ { 0.707106769f, 0.0f, -0.707106769f }, { 0x69700169u } },
+	{ { 0.110615872f, 0.110615872f, -0.987688363f }, { 0x6070e439u } },
+	{ { 1.2147539e-16f, 1.81800759e-16f, -1.0f }, { 0x60100000u } },
+	{ { 0.256938249f, 0.171680644f, -0.95105654f }, { 0x61a16083u } },
+	{ { 0.419432521f, 0.17373465f, -0.891006529f }, { 0x639164d6u } },
+	{ { 0.0869103298f, 0.130070508f, -0.987688363f }, { 0x2071082cu } },
+	{ { 8.36736997e-17f, 2.02006188e-16f, -1.0f }, { 0x20100000u } },
+	{ { 0.218508005f, 0.218508005f, -0.95105654f }, { 0x21a1c070u } },
+	{ { 0.377479315f, 0.252223611f, -0.891006529f }, { 0x239204c1u } },
+	{ { 0.0598648787f, 0.144526601f, -0.987688363f }, { 0x6071281fu } },
+	{ { 4.26564833e-17f, 2.14448625e-16f, -1.0f }, { 0x60100000u } },
+	{ { 0.171680644f, 0.256938249f, -0.95105654f }, { 0x61a20c58u } },
+	{ { 0.0305188503f, 0.153428614f, -0.987688363f }, { 0x20713810u } },
+	{ { 4.78077872e-32f, 2.18649922e-16f, -1.0f }, { 0x20100000u } },
+	{ { 0.118255682f, 0.285494477f, -0.95105654f }, { 0x21a2483cu } },
+	{ { 0.321019769f, 0.321019769f, -0.891006529f }, { 0x639290a4u } },
+	{ { 0.252223611f, 0.377479315f, -0.891006529f }, { 0x23930481u } },
+	{ { 3.42043849e-17f, 0.156434461f, -0.987688363f }, { 0x60714000u } },
+	{ { -4.26564833e-17f, 2.14448625e-16f, -1.0f }, { 0x60100000u } },
+	{ { 0.0602862239f, 0.303079307f, -0.95105654f }, { 0x61a26c1fu } },
+	{ { -0.0305188503f, 0.153428614f, -0.987688363f }, { 0x20713bf0u } },
+	{ { -8.36736997e-17f, 2.02006188e-16f, -1.0f }, { 0x20100000u } },
+	{ { 6.7566541e-17f, 0.309017003f, -0.95105654f }, { 0x21a27800u } },
+	{ { 0.17373465f, 0.419432521f, -0.891006529f }, { 0x63935859u } },
+	{ { 0.0885691494f, 0.4452672f, -0.891006529f }, { 0x2393902du } },
+	{ { -0.0598648787f, 0.144526601f, -0.987688363f }, { 0x60712be1u } },
+	{ { -1.2147539e-16f, 1.81800759e-16f, -1.0f }, { 0x60100000u } },
+	{ { -0.0602862239f, 0.303079307f, -0.95105654f }, { 0x61a26fe1u } },
+	{ { -0.0869103298f, 0.130070508f, -0.987688363f }, { 0x20710bd4u } },
+	{ { -1.54608844e-16f, 1.54608844e-16f, -1.0f }, { 0x20100000u } },
+	{ { -0.118255682f, 0.285494477f, -0.95105654f }, { 0x21a24bc4u } },
+	{ { 9.92649888e-17f, 0.453990489f, -0.891006529f }, { 0x6393a000u } },
+	{ { -0.0885691494f, 0.4452672f, -0.891006529f }, { 0x239393d3u } },
+	{ { -0.110615872f, 0.110615872f, -0.987688363f }, { 0x6070e7c7u } },
+	{ { -1.81800759e-16f, 1.2147539e-16f, -1.0f }, { 0x60100000u } },
+	{ { -0.171680644f, 0.256938249f, -0.95105654f }, { 0x61a20fa8u } },
+	{ { -0.130070508f, 0.0869103298f, -0.987688363f }, { 0x2070b3beu } },
+	{ { -2.02006188e-16f, 8.36736997e-17f, -1.0f }, { 0x20100000u } },
+	{ { -0.218508005f, 0.218508005f, -0.95105654f }, { 0x21a1c390u } },
+	{ { -0.17373465f, 0.419432521f, -0.891006529f }, { 0x63935ba7u } },
+	{ { -0.252223611f, 0.377479315f, -0.891006529f }, { 0x2393077fu } },
+	{ { -0.144526601f, 0.0598648787f, -0.987688363f }, { 0x60707fb6u } },
+	{ { -2.14448625e-16f, 4.26564833e-17f, -1.0f }, { 0x60100000u } },
+	{ { -0.256938249f, 0.171680644f, -0.95105654f }, { 0x61a1637du } },
+	{ { -0.153428614f, 0.0305188503f, -0.987688363f }, { 0x207043b2u } },
+	{ { -2.18649922e-16f, 4.78077872e-32f, -1.0f }, { 0x20100000u } },
+	{ { -0.285494477f, 0.118255682f, -0.95105654f }, { 0x21a0f36eu } },
+	{ { -0.321019769f, 0.321019769f, -0.891006529f }, { 0x6392935cu } },
+	{ { -0.377479315f, 0.252223611f, -0.891006529f }, { 0x2392073fu } },
+	{ { -0.156434461f, 3.42043849e-17f, -0.987688363f }, { 0x607003b0u } },
+	{ { -2.14448625e-16f, -4.26564833e-17f, -1.0f }, { 0x60100000u } },
+	{ { -0.303079307f, 0.0602862239f, -0.95105654f }, { 0x61a07f65u } },
+	{ { -0.153428614f, -0.0305188503f, -0.987688363f }, { 0x207fc3b2u } },
+	{ { -2.02006188e-16f, -8.36736997e-17f, -1.0f }, { 0x20100000u } },
+	{ { -0.309017003f, 6.7566541e-17f, -0.95105654f }, { 0x21a00362u } },
+	{ { -0.419432521f, 0.17373465f, -0.891006529f }, { 0x6391672au } },
+	{ { -0.4452672f, 0.0885691494f, -0.891006529f }, { 0x2390b71cu } },
+	{ { -0.144526601f, -0.0598648787f, -0.987688363f }, { 0x607f87b6u } },
+	{ { -1.81800759e-16f, -1.2147539e-16f, -1.0f }, { 0x60100000u } },
+	{ { -0.303079307f, -0.0602862239f, -0.95105654f }, { 0x61af8765u } },
+	{ { -0.130070508f, -0.0869103298f, -0.987688363f }, { 0x207f53beu } },
+	{ { -1.54608844e-16f, -1.54608844e-16f, -1.0f }, { 0x20100000u } },
+	{ { -0.285494477f, -0.118255682f, -0.95105654f }, { 0x21af136eu } },
+	{ { -0.453990489f, 9.92649888e-17f, -0.891006529f }, { 0x63900318u } },
+	{ { -0.4452672f, -0.0885691494f, -0.891006529f }, { 0x239f4f1cu } },
+	{ { -0.110615872f, -0.110615872f, -0.987688363f }, { 0x607f1fc7u } },
+	{ { -1.2147539e-16f, -1.81800759e-16f, -1.0f }, { 0x60100000u } },
+	{ { -0.256938249f, -0.171680644f, -0.95105654f }, { 0x61aea37du } },
+	{ { -0.0869103298f, -0.130070508f, -0.987688363f }, { 0x207efbd4u } },
+	{ { -8.36736997e-17f, -2.02006188e-16f, -1.0f }, { 0x20100000u } },
+	{ { -0.218508005f, -0.218508005f, -0.95105654f }, { 0x21ae4390u } },
+	{ { -0.419432521f, -0.17373465f, -0.891006529f }, { 0x639e9f2au } },
+	{ { -0.377479315f, -0.252223611f, -0.891006529f }, { 0x239dff3fu } },
+	{ { -0.0598648787f, -0.144526601f, -0.987688363f }, { 0x607edbe1u } },
+	{ { -4.26564833e-17f, -2.14448625e-16f, -1.0f }, { 0x60100000u } },
+	{ { -0.171680644f, -0.256938249f, -0.95105654f }, { 0x61adf7a8u } },
+	{ { -0.0305188503f, -0.153428614f, -0.987688363f }, { 0x207ecbf0u } },
+	{ { 0.0f, -2.18649922e-16f, -1.0f }, { 0x20100000u } },
+	{ { -0.118255682f, -0.285494477f, -0.95105654f }, { 0x21adbbc4u } },
+	{ { -0.321019769f, -0.321019769f, -0.891006529f }, { 0x639d735cu } },
+	{ { -0.252223611f, -0.377479315f, -0.891006529f }, { 0x239cff7fu } },
+	{ { 0.0f, -0.156434461f, -0.987688363f }, { 0x607ec000u } },
+	{ { 4.26564833e-17f, -2.14448625e-16f, -1.0f }, { 0x60100000u } },
+	{ { -0.0602862239f, -0.303079307f, -0.95105654f }, { 0x61ad97e1u } },
+	{ { 0.0305188503f, -0.153428614f, -0.987688363f }, { 0x207ec810u } },
+	{ { 8.36736997e-17f, -2.02006188e-16f, -1.0f }, { 0x20100000u } },
+	{ { 0.0f, -0.309017003f, -0.95105654f }, { 0x21ad8800u } },
+	{ { -0.17373465f, -0.419432521f, -0.891006529f }, { 0x639caba7u } },
+	{ { -0.0885691494f, -0.4452672f, -0.891006529f }, { 0x239c73d3u } },
+	{ { 0.0598648787f, -0.144526601f, -0.987688363f }, { 0x607ed81fu } },
+	{ { 1.2147539e-16f, -1.81800759e-16f, -1.0f }, { 0x60100000u } },
+	{ { 0.0602862239f, -0.303079307f, -0.95105654f }, { 0x61ad941fu } },
+	{ { 0.0869103298f, -0.130070508f, -0.987688363f }, { 0x207ef82cu } },
+	{ { 1.54608844e-16f, -1.54608844e-16f, -1.0f }, { 0x20100000u } },
+	{ { 0.118255682f, -0.285494477f, -0.95105654f }, { 0x21adb83cu } },
+	{ { 0.0f, -0.453990489f, -0.891006529f }, { 0x639c6000u } },
+	{ { 0.0885691494f, -0.4452672f, -0.891006529f }, { 0x239c702du } },
+	{ { 0.110615872f, -0.110615872f, -0.987688363f }, { 0x607f1c39u } },
+	{ { 1.81800759e-16f, -1.2147539e-16f, -1.0f }, { 0x60100000u } },
+	{ { 0.171680644f, -0.256938249f, -0.95105654f }, { 0x61adf458u } },
+	{ { 0.130070508f, -0.0869103298f, -0.987688363f }, { 0x207f5042u } },
+	{ { 2.02006188e-16f, -8.36736997e-17f, -1.0f }, { 0x20100000u } },
+	{ { 0.218508005f, -0.218508005f, -0.95105654f }, { 0x21ae4070u } },
+	{ { 0.17373465f, -0.419432521f, -0.891006529f }, { 0x639ca859u } },
+	{ { 0.252223611f, -0.377479315f, -0.891006529f }, { 0x239cfc81u } },
+	{ { 0.144526601f, -0.0598648787f, -0.987688363f }, { 0x607f844au } },
+	{ { 2.14448625e-16f, -4.26564833e-17f, -1.0f }, { 0x60100000u } },
+	{ { 0.256938249f, -0.171680644f, -0.95105654f }, { 0x61aea083u } },
+	{ { 0.153428614f, -0.0305188503f, -0.987688363f }, { 0x207fc04eu } },
+	{ { 2.18649922e-16f, 0.0f, -1.0f }, { 0x20100000u } },
+	{ { 0.156434461f, 0.0f, -0.987688363f }, { 0x60700050u } },
+	{ { 0.285494477f, -0.118255682f, -0.95105654f }, { 0x21af1092u } },
+	{ { 0.303079307f, -0.0602862239f, -0.95105654f }, { 0x61af849bu } },
+	{ { 0.309017003f, 0.0f, -0.95105654f }, { 0x21a0009eu } },
+	{ { 0.377479315f, -0.252223611f, -0.891006529f }, { 0x239dfcc1u } },
+	{ { 0.4452672f, -0.0885691494f, -0.891006529f }, { 0x239f4ce4u } },
+	{ { 0.453990489f, 0.0f, -0.891006529f }, { 0x639000e8u } },
+	{ { 0.419432521f, -0.17373465f, -0.891006529f }, { 0x639e9cd6u } },
+	{ { 0.576491117f, -0.114671215f, -0.809017003f }, { 0x663f1527u } },
+	{ { 0.587785244f, 0.0f, -0.809017003f }, { 0x2630012cu } },
+	{ { 0.543042779f, -0.224935681f, -0.809017003f }, { 0x263e3515u } },
+	{ { 0.69351995f, -0.13794969f, -0.707106769f }, { 0x297ee962u } },
+	{ { 0.707106769f, 0.0f, -0.707106769f }, { 0x69700169u } },
+	{ { 0.65328151f, -0.270598054f, -0.707106769f }, { 0x697dd94eu } },
+	{ { 0.488725573f, -0.326555997f, -0.809017003f }, { 0x663d64fau } },
+	{ { 0.587937772f, -0.392847478f, -0.707106769f }, { 0x297cdd2cu } },
+	{ { 0.793471932f, -0.157831386f, -0.587785244f }, { 0x6d4ebd95u } },
+	{ { 0.809017003f, 0.0f, -0.587785244f }, { 0x2d40019du } },
+	{ { 0.747434258f, -0.309597403f, -0.587785244f }, { 0x2d4d897eu } },
+	{ { 0.873886108f, -0.173826754f, -0.453990489f }, { 0x318e9dbfu } },
+	{ { 0.891006529f, 0.0f, -0.453990489f }, { 0x718001c7u } },
+	{ { 0.823182702f, -0.340973437f, -0.453990489f }, { 0x718d49a5u } },
+	{ { 0.672673047f, -0.449465752f, -0.587785244f }, { 0x6d4c6958u } },
+	{ { 0.740844846f, -0.495016694f, -0.453990489f }, { 0x318c0d7bu } },
+	{ { 0.932782233f, -0.185541928f, -0.309017003f }, { 0x762e85ddu } },
+	{ { 0.95105654f, 0.0f, -0.309017003f }, { 0x362001e6u } },
+	{ { 0.878661633f, -0.363953561f, -0.309017003f }, { 0x362d19c1u } },
+	{ { 0.968710184f, -0.192688435f, -0.156434461f }, { 0x3b0e79efu } },
+	{ { 0.987688363f, 0.0f, -0.156434461f }, { 0x7b0001f9u } },
+	{ { 0.912505031f, -0.377971977f, -0.156434461f }, { 0x7b0cfdd2u } },
+	{ { 0.790774584f, -0.528378665f, -0.309017003f }, { 0x762bc994u } },
+	{ { 0.821232855f, -0.548730254f, -0.156434461f }, { 0x3b0ba1a4u } },
+	{ { 0.980785251f, -0.195090324f, 2.18649922e-16f }, { 0x400e71f5u } },
+	{ { 1.0f, 0.0f, 2.18649922e-16f }, { 0x000001ffu } },
+	{ { 0.923879504f, -0.382683426f, 2.18649922e-16f }, { 0x000cf1d8u } },
+	{ { 0.968710184f, -0.192688435f, 0.156434461f }, { 0x050e79efu } },
+	{ { 0.987688363f, 0.0f, 0.156434461f }, { 0x450001f9u } },
+	{ { 0.912505031f, -0.377971977f, 0.156434461f }, { 0x450cfdd2u } },
+	{ { 0.831469595f, -0.555570245f, 2.18649922e-16f }, { 0x400b91a9u } },
+	{ { 0.821232855f, -0.548730254f, 0.156434461f }, { 0x050ba1a4u } },
+	{ { 0.932782233f, -0.185541928f, 0.309017003f }, { 0x49ee85ddu } },
+	{ { 0.95105654f, 0.0f, 0.309017003f }, { 0x09e001e6u } },
+	{ { 0.878661633f, -0.363953561f, 0.309017003f }, { 0x09ed19c1u } },
+	{ { 0.873886108f, -0.173826754f, 0.453990489f }, { 0x0e8e9dbfu } },
+	{ { 0.891006529f, 0.0f, 0.453990489f }, { 0x4e8001c7u } },
+	{ { 0.823182702f, -0.340973437f, 0.453990489f }, { 0x4e8d49a5u } },
+	{ { 0.790774584f, -0.528378665f, 0.309017003f }, { 0x49ebc994u } },
+	{ { 0.740844846f, -0.495016694f, 0.453990489f }, { 0x0e8c0d7bu } },
+	{ { 0.793471932f, -0.157831386f, 0.587785244f }, { 0x52cebd95u } },
+	{ { 0.809017003f, 0.0f, 0.587785244f }, { 0x12c0019du } },
+	{ { 0.747434258f, -0.309597403f, 0.587785244f }, { 0x12cd897eu } },
+	{ { 0.69351995f, -0.13794969f, 0.707106769f }, { 0x169ee962u } },
+	{ { 0.707106769f, 0.0f, 0.707106769f }, { 0x56900169u } },
+	{ { 0.65328151f, -0.270598054f, 0.707106769f }, { 0x569dd94eu } },
+	{ { 0.672673047f, -0.449465752f, 0.587785244f }, { 0x52cc6958u } },
+	{ { 0.587937772f, -0.392847478f, 0.707106769f }, { 0x169cdd2cu } },
+	{ { 0.576491117f, -0.114671215f, 0.809017003f }, { 0x59df1527u } },
+	{ { 0.587785244f, 0.0f, 0.809017003f }, { 0x19d0012cu } },
+	{ { 0.543042779f, -0.224935681f, 0.809017003f }, { 0x19de3515u } },
+	{ { 0.4452672f, -0.0885691494f, 0.891006529f }, { 0x1c7f4ce4u } },
+	{ { 0.453990489f, 0.0f, 0.891006529f }, { 0x5c7000e8u } },
+	{ { 0.419432521f, -0.17373465f, 0.891006529f }, { 0x5c7e9cd6u } },
+	{ { 0.488725573f, -0.326555997f, 0.809017003f }, { 0x59dd64fau } },
+	{ { 0.377479315f, -0.252223611f, 0.891006529f }, { 0x1c7dfcc1u } },
+	{ { 0.303079307f, -0.0602862239f, 0.95105654f }, { 0x5e6f849bu } },
+	{ { 0.309017003f, 0.0f, 0.95105654f }, { 0x1e60009eu } },
+	{ { 0.285494477f, -0.118255682f, 0.95105654f }, { 0x1e6f1092u } },
+	{ { 0.153428614f, -0.0305188503f, 0.987688363f }, { 0x1f9fc04eu } },
+	{ { 0.156434461f, 0.0f, 0.987688363f }, { 0x5f900050u } },
+	{ { 0.0f, -0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { 0.0f, 0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { 0.0f, -0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { 0.144526601f, -0.0598648787f, 0.987688363f }, { 0x5f9f844au } },
+	{ { 0.0f, -0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { 0.130070508f, -0.0869103298f, 0.987688363f }, { 0x1f9f5042u } },
+	{ { 0.0f, -0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { 0.256938249f, -0.171680644f, 0.95105654f }, { 0x5e6ea083u } },
+	{ { 0.110615872f, -0.110615872f, 0.987688363f }, { 0x5f9f1c39u } },
+	{ { 0.0f, -0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { 0.218508005f, -0.218508005f, 0.95105654f }, { 0x1e6e4070u } },
+	{ { 0.0869103298f, -0.130070508f, 0.987688363f }, { 0x1f9ef82cu } },
+	{ { 0.0f, -0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { 0.321019769f, -0.321019769f, 0.891006529f }, { 0x5c7d70a4u } },
+	{ { 0.171680644f, -0.256938249f, 0.95105654f }, { 0x5e6df458u } },
+	{ { 0.0598648787f, -0.144526601f, 0.987688363f }, { 0x5f9ed81fu } },
+	{ { 0.0f, -0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { 0.415626943f, -0.415626943f, 0.809017003f }, { 0x19dcb0d4u } },
+	{ { 0.0305188503f, -0.153428614f, 0.987688363f }, { 0x1f9ec810u } },
+	{ { 0.0f, -0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { 0.118255682f, -0.285494477f, 0.95105654f }, { 0x1e6db83cu } },
+	{ { 0.252223611f, -0.377479315f, 0.891006529f }, { 0x1c7cfc81u } },
+	{ { 0.0f, -0.156434461f, 0.987688363f }, { 0x5f9ec000u } },
+	{ { -0.0f, -0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { 0.0602862239f, -0.303079307f, 0.95105654f }, { 0x5e6d941fu } },
+	{ { 0.17373465f, -0.419432521f, 0.891006529f }, { 0x5c7ca859u } },
+	{ { -0.0305188503f, -0.153428614f, 0.987688363f }, { 0x1f9ecbf0u } },
+	{ { -0.0f, -0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { 0.0f, -0.309017003f, 0.95105654f }, { 0x1e6d8800u } },
+	{ { -0.0598648787f, -0.144526601f, 0.987688363f }, { 0x5f9edbe1u } },
+	{ { -0.0f, -0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { -0.0602862239f, -0.303079307f, 0.95105654f }, { 0x5e6d97e1u } },
+	{ { 0.0885691494f, -0.4452672f, 0.891006529f }, { 0x1c7c702du } },
+	{ { -0.0869103298f, -0.130070508f, 0.987688363f }, { 0x1f9efbd4u } },
+	{ { -0.0f, -0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { -0.118255682f, -0.285494477f, 0.95105654f }, { 0x1e6dbbc4u } },
+	{ { -0.110615872f, -0.110615872f, 0.987688363f }, { 0x5f9f1fc7u } },
+	{ { -0.0f, -0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { -0.171680644f, -0.256938249f, 0.95105654f }, { 0x5e6df7a8u } },
+	{ { -0.130070508f, -0.0869103298f, 0.987688363f }, { 0x1f9f53beu } },
+	{ { -0.0f, -0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { -0.218508005f, -0.218508005f, 0.95105654f }, { 0x1e6e4390u } },
+	{ { -0.144526601f, -0.0598648787f, 0.987688363f }, { 0x5f9f87b6u } },
+	{ { -0.0f, -0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { -0.256938249f, -0.171680644f, 0.95105654f }, { 0x5e6ea37du } },
+	{ { -0.153428614f, -0.0305188503f, 0.987688363f }, { 0x1f9fc3b2u } },
+	{ { -0.0f, 0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { -0.285494477f, -0.118255682f, 0.95105654f }, { 0x1e6f136eu } },
+	{ { -0.156434461f, 3.42043849e-17f, 0.987688363f }, { 0x5f9003b0u } },
+	{ { -0.0f, 0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { -0.303079307f, -0.0602862239f, 0.95105654f }, { 0x5e6f8765u } },
+	{ { -0.153428614f, 0.0305188503f, 0.987688363f }, { 0x1f9043b2u } },
+	{ { -0.0f, 0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { -0.309017003f, 6.7566541e-17f, 0.95105654f }, { 0x1e600362u } },
+	{ { -0.144526601f, 0.0598648787f, 0.987688363f }, { 0x5f907fb6u } },
+	{ { -0.0f, 0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { -0.303079307f, 0.0602862239f, 0.95105654f }, { 0x5e607f65u } },
+	{ { -0.130070508f, 0.0869103298f, 0.987688363f }, { 0x1f90b3beu } },
+	{ { -0.0f, 0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { -0.285494477f, 0.118255682f, 0.95105654f }, { 0x1e60f36eu } },
+	{ { -0.110615872f, 0.110615872f, 0.987688363f }, { 0x5f90e7c7u } },
+	{ { -0.0f, 0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { -0.256938249f, 0.171680644f, 0.95105654f }, { 0x5e61637du } },
+	{ { -0.0869103298f, 0.130070508f, 0.987688363f }, { 0x1f910bd4u } },
+	{ { -0.0f, 0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { -0.218508005f, 0.218508005f, 0.95105654f }, { 0x1e61c390u } },
+	{ { -0.0598648787f, 0.144526601f, 0.987688363f }, { 0x5f912be1u } },
+	{ { -0.0f, 0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { -0.171680644f, 0.256938249f, 0.95105654f }, { 0x5e620fa8u } },
+	{ { -0.0305188503f, 0.153428614f, 0.987688363f }, { 0x1f913bf0u } },
+	{ { 0.0f, 0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { -0.118255682f, 0.285494477f, 0.95105654f }, { 0x1e624bc4u } },
+	{ { 3.42043849e-17f, 0.156434461f, 0.987688363f }, { 0x5f914000u } },
+	{ { 0.0f, 0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { -0.0602862239f, 0.303079307f, 0.95105654f }, { 0x5e626fe1u } },
+	{ { 0.0305188503f, 0.153428614f, 0.987688363f }, { 0x1f913810u } },
+	{ { 0.0f, 0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { 6.7566541e-17f, 0.309017003f, 0.95105654f }, { 0x1e627800u } },
+	{ { 0.0598648787f, 0.144526601f, 0.987688363f }, { 0x5f91281fu } },
+	{ { 0.0f, 0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { 0.0602862239f, 0.303079307f, 0.95105654f }, { 0x5e626c1fu } },
+	{ { 0.0869103298f, 0.130070508f, 0.987688363f }, { 0x1f91082cu } },
+	{ { 0.0f, 0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { 0.118255682f, 0.285494477f, 0.95105654f }, { 0x1e62483cu } },
+	{ { 0.110615872f, 0.110615872f, 0.987688363f }, { 0x5f90e439u } },
+	{ { 0.0f, 0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { 0.171680644f, 0.256938249f, 0.95105654f }, { 0x5e620c58u } },
+	{ { 0.130070508f, 0.0869103298f, 0.987688363f }, { 0x1f90b042u } },
+	{ { 0.0f, 0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { 0.218508005f, 0.218508005f, 0.95105654f }, { 0x1e61c070u } },
+	{ { 0.144526601f, 0.0598648787f, 0.987688363f }, { 0x5f907c4au } },
+	{ { 0.0f, 0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { 0.256938249f, 0.171680644f, 0.95105654f }, { 0x5e616083u } },
+	{ { 0.153428614f, 0.0305188503f, 0.987688363f }, { 0x1f90404eu } },
+	{ { 0.0f, 0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { 0.156434461f, 0.0f, 0.987688363f }, { 0x5f900050u } },
+	{ { 0.285494477f, 0.118255682f, 0.95105654f }, { 0x1e60f092u } },
+	{ { 0.303079307f, 0.0602862239f, 0.95105654f }, { 0x5e607c9bu } },
+	{ { 0.309017003f, 0.0f, 0.95105654f }, { 0x1e60009eu } },
+	{ { 0.377479315f, 0.252223611f, 0.891006529f }, { 0x1c7204c1u } },
+	{ { 0.4452672f, 0.0885691494f, 0.891006529f }, { 0x1c70b4e4u } },
+	{ { 0.453990489f, 0.0f, 0.891006529f }, { 0x5c7000e8u } },
+	{ { 0.419432521f, 0.17373465f, 0.891006529f }, { 0x5c7164d6u } },
+	{ { 0.576491117f, 0.114671215f, 0.809017003f }, { 0x59d0ed27u } },
+	{ { 0.587785244f, 0.0f, 0.809017003f }, { 0x19d0012cu } },
+	{ { 0.543042779f, 0.224935681f, 0.809017003f }, { 0x19d1cd15u } },
+	{ { 0.69351995f, 0.13794969f, 0.707106769f }, { 0x16911962u } },
+	{ { 0.707106769f, 0.0f, 0.707106769f }, { 0x56900169u } },
+	{ { 0.65328151f, 0.270598054f, 0.707106769f }, { 0x5692294eu } },
+	{ { 0.488725573f, 0.326555997f, 0.809017003f }, { 0x59d29cfau } },
+	{ { 0.587937772f, 0.392847478f, 0.707106769f }, { 0x1693252cu } },
+	{ { 0.747434258f, 0.309597403f, 0.587785244f }, { 0x12c2797eu } },
+	{ { 0.793471932f, 0.157831386f, 0.587785244f }, { 0x52c14595u } },
+	{ { 0.809017003f, 0.0f, 0.587785244f }, { 0x12c0019du } },
+	{ { 0.672673047f, 0.449465752f, 0.587785244f }, { 0x52c39958u } },
+	{ { 0.873886108f, 0.173826754f, 0.453990489f }, { 0x0e8165bfu } },
+	{ { 0.891006529f, 0.0f, 0.453990489f }, { 0x4e8001c7u } },
+	{ { 0.823182702f, 0.340973437f, 0.453990489f }, { 0x4e82b9a5u } },
+	{ { 0.932782233f, 0.185541928f, 0.309017003f }, { 0x49e17dddu } },
+	{ { 0.95105654f, 0.0f, 0.309017003f }, { 0x09e001e6u } },
+	{ { 0.878661633f, 0.363953561f, 0.309017003f }, { 0x09e2e9c1u } },
+	{ { 0.740844846f, 0.495016694f, 0.453990489f }, { 0x0e83f57bu } },
+	{ { 0.790774584f, 0.528378665f, 0.309017003f }, { 0x49e43994u } },
+	{ { 0.912505031f, 0.377971977f, 0.156434461f }, { 0x450305d2u } },
+	{ { 0.968710184f, 0.192688435f, 0.156434461f }, { 0x050189efu } },
+	{ { 0.987688363f, 0.0f, 0.156434461f }, { 0x450001f9u } },
+	{ { 0.821232855f, 0.548730254f, 0.156434461f }, { 0x050461a4u } },
+	{ { 0.980785251f, 0.195090324f, 2.18649922e-16f }, { 0x400191f5u } },
+	{ { 1.0f, 0.0f, 2.18649922e-16f }, { 0x000001ffu } },
+	{ { 0.923879504f, 0.382683426f, 2.18649922e-16f }, { 0x000311d8u } },
+	{ { 0.968710184f, 0.192688435f, -0.156434461f }, { 0x3b0189efu } },
+	{ { 0.987688363f, 0.0f, -0.156434461f }, { 0x7b0001f9u } },
+	{ { 0.912505031f, 0.377971977f, -0.156434461f }, { 0x7b0305d2u } },
+	{ { 0.831469595f, 0.555570245f, 2.18649922e-16f }, { 0x400471a9u } },
+	{ { 0.821232855f, 0.548730254f, -0.156434461f }, { 0x3b0461a4u } },
+	{ { 0.878661633f, 0.363953561f, -0.309017003f }, { 0x3622e9c1u } },
+	{ { 0.932782233f, 0.185541928f, -0.309017003f }, { 0x76217dddu } },
+	{ { 0.95105654f, 0.0f, -0.309017003f }, { 0x362001e6u } },
+	{ { 0.790774584f, 0.528378665f, -0.309017003f }, { 0x76243994u } },
+	{ { 0.873886108f, 0.173826754f, -0.453990489f }, { 0x318165bfu } },
+	{ { 0.891006529f, 0.0f, -0.453990489f }, { 0x718001c7u } },
+	{ { 0.823182702f, 0.340973437f, -0.453990489f }, { 0x7182b9a5u } },
+	{ { 0.793471932f, 0.157831386f, -0.587785244f }, { 0x6d414595u } },
+	{ { 0.809017003f, 0.0f, -0.587785244f }, { 0x2d40019du } },
+	{ { 0.747434258f, 0.309597403f, -0.587785244f }, { 0x2d42797eu } },
+	{ { 0.740844846f, 0.495016694f, -0.453990489f }, { 0x3183f57bu } },
+	{ { 0.672673047f, 0.449465752f, -0.587785244f }, { 0x6d439958u } },
+	{ { 0.65328151f, 0.270598054f, -0.707106769f }, { 0x6972294eu } },
+	{ { 0.69351995f, 0.13794969f, -0.707106769f }, { 0x29711962u } },
+	{ { 0.543042779f, 0.224935681f, -0.809017003f }, { 0x2631cd15u } },
+	{ { 0.488725573f, 0.326555997f, -0.809017003f }, { 0x66329cfau } },
+	{ { 0.587937772f, 0.392847478f, -0.707106769f }, { 0x2973252cu } },
+	{ { 0.415626943f, 0.415626943f, -0.809017003f }, { 0x263350d4u } },
+	{ { 0.5f, 0.5f, -0.707106769f }, { 0x69740100u } },
+	{ { 0.326555997f, 0.488725573f, -0.809017003f }, { 0x6633e8a7u } },
+	{ { 0.572061419f, 0.572061419f, -0.587785244f }, { 0x2d449124u } },
+	{ { 0.392847478f, 0.587937772f, -0.707106769f }, { 0x2974b0c9u } },
+	{ { 0.224935681f, 0.543042779f, -0.809017003f }, { 0x26345473u } },
+	{ { 0.630036771f, 0.630036771f, -0.453990489f }, { 0x71850942u } },
+	{ { 0.114671215f, 0.576491117f, -0.809017003f }, { 0x66349c3bu } },
+	{ { 0.270598054f, 0.65328151f, -0.707106769f }, { 0x6975388au } },
+	{ { 0.449465752f, 0.672673047f, -0.587785244f }, { 0x6d4560e6u } },
+	{ { 1.28519197e-16f, 0.587785244f, -0.809017003f }, { 0x2634b000u } },
+	{ { 0.13794969f, 0.69351995f, -0.707106769f }, { 0x29758846u } },
+	{ { 0.309597403f, 0.747434258f, -0.587785244f }, { 0x2d45f89eu } },
+	{ { -0.114671215f, 0.576491117f, -0.809017003f }, { 0x66349fc5u } },
+	{ { 1.54608844e-16f, 0.707106769f, -0.707106769f }, { 0x6975a400u } },
+	{ { -0.224935681f, 0.543042779f, -0.809017003f }, { 0x2634578du } },
+	{ { -0.13794969f, 0.69351995f, -0.707106769f }, { 0x29758bbau } },
+	{ { 0.157831386f, 0.793471932f, -0.587785244f }, { 0x6d465451u } },
+	{ { 1.76891502e-16f, 0.809017003f, -0.587785244f }, { 0x2d467400u } },
+	{ { -0.326555997f, 0.488725573f, -0.809017003f }, { 0x6633eb59u } },
+	{ { -0.270598054f, 0.65328151f, -0.707106769f }, { 0x69753b76u } },
+	{ { -0.415626943f, 0.415626943f, -0.809017003f }, { 0x2633532cu } },
+	{ { -0.392847478f, 0.587937772f, -0.707106769f }, { 0x2974b337u } },
+	{ { -0.157831386f, 0.793471932f, -0.587785244f }, { 0x6d4657afu } },
+	{ { -0.309597403f, 0.747434258f, -0.587785244f }, { 0x2d45fb62u } },
+	{ { -0.488725573f, 0.326555997f, -0.809017003f }, { 0x66329f06u } },
+	{ { -0.5f, 0.5f, -0.707106769f }, { 0x69740300u } },
+	{ { -0.543042779f, 0.224935681f, -0.809017003f }, { 0x2631ceebu } },
+	{ { -0.587937772f, 0.392847478f, -0.707106769f }, { 0x297326d4u } },
+	{ { -0.449465752f, 0.672673047f, -0.587785244f }, { 0x6d45631au } },
+	{ { -0.572061419f, 0.572061419f, -0.587785244f }, { 0x2d4492dcu } },
+	{ { -0.576491117f, 0.114671215f, -0.809017003f }, { 0x6630eed9u } },
+	{ { -0.65328151f, 0.270598054f, -0.707106769f }, { 0x69722ab2u } },
+	{ { -0.587785244f, 1.28519197e-16f, -0.809017003f }, { 0x263002d4u } },
+	{ { -0.69351995f, 0.13794969f, -0.707106769f }, { 0x29711a9eu } },
+	{ { -0.672673047f, 0.449465752f, -0.587785244f }, { 0x6d439aa8u } },
+	{ { -0.747434258f, 0.309597403f, -0.587785244f }, { 0x2d427a82u } },
+	{ { -0.576491117f, -0.114671215f, -0.809017003f }, { 0x663f16d9u } },
+	{ { -0.707106769f, 1.54608844e-16f, -0.707106769f }, { 0x69700297u } },
+	{ { -0.543042779f, -0.224935681f, -0.809017003f }, { 0x263e36ebu } },
+	{ { -0.69351995f, -0.13794969f, -0.707106769f }, { 0x297eea9eu } },
+	{ { -0.793471932f, 0.157831386f, -0.587785244f }, { 0x6d41466bu } },
+	{ { -0.809017003f, 1.76891502e-16f, -0.587785244f }, { 0x2d400263u } },
+	{ { -0.488725573f, -0.326555997f, -0.809017003f }, { 0x663d6706u } },
+	{ { -0.65328151f, -0.270598054f, -0.707106769f }, { 0x697ddab2u } },
+	{ { -0.415626943f, -0.415626943f, -0.809017003f }, { 0x263cb32cu } },
+	{ { -0.587937772f, -0.392847478f, -0.707106769f }, { 0x297cded4u } },
+	{ { -0.793471932f, -0.157831386f, -0.587785244f }, { 0x6d4ebe6bu } },
+	{ { -0.747434258f, -0.309597403f, -0.587785244f }, { 0x2d4d8a82u } },
+	{ { -0.326555997f, -0.488725573f, -0.809017003f }, { 0x663c1b59u } },
+	{ { -0.5f, -0.5f, -0.707106769f }, { 0x697c0300u } },
+	{ { -0.224935681f, -0.543042779f, -0.809017003f }, { 0x263baf8du } },
+	{ { -0.392847478f, -0.587937772f, -0.707106769f }, { 0x297b5337u } },
+	{ { -0.672673047f, -0.449465752f, -0.587785244f }, { 0x6d4c6aa8u } },
+	{ { -0.572061419f, -0.572061419f, -0.587785244f }, { 0x2d4b72dcu } },
+	{ { -0.114671215f, -0.576491117f, -0.809017003f }, { 0x663b67c5u } },
+	{ { -0.270598054f, -0.65328151f, -0.707106769f }, { 0x697acb76u } },
+	{ { 0.0f, -0.587785244f, -0.809017003f }, { 0x263b5000u } },
+	{ { -0.13794969f, -0.69351995f, -0.707106769f }, { 0x297a7bbau } },
+	{ { -0.449465752f, -0.672673047f, -0.587785244f }, { 0x6d4aa31au } },
+	{ { -0.309597403f, -0.747434258f, -0.587785244f }, { 0x2d4a0b62u } },
+	{ { 0.114671215f, -0.576491117f, -0.809017003f }, { 0x663b643bu } },
+	{ { 0.0f, -0.707106769f, -0.707106769f }, { 0x697a5c00u } },
+	{ { 0.224935681f, -0.543042779f, -0.809017003f }, { 0x263bac73u } },
+	{ { 0.13794969f, -0.69351995f, -0.707106769f }, { 0x297a7846u } },
+	{ { -0.157831386f, -0.793471932f, -0.587785244f }, { 0x6d49afafu } },
+	{ { 0.0f, -0.809017003f, -0.587785244f }, { 0x2d498c00u } },
+	{ { 0.270598054f, -0.65328151f, -0.707106769f }, { 0x697ac88au } },
+	{ { -0.340973437f, -0.823182702f, -0.453990489f }, { 0x71896f52u } },
+	{ { 0.157831386f, -0.793471932f, -0.587785244f }, { 0x6d49ac51u } },
+	{ { -0.173826754f, -0.873886108f, -0.453990489f }, { 0x318907a7u } },
+	{ { 0.0f, -0.891006529f, -0.453990489f }, { 0x7188e400u } },
+	{ { -0.495016694f, -0.740844846f, -0.453990489f }, { 0x318a1703u } },
+	{ { -0.363953561f, -0.878661633f, -0.309017003f }, { 0x3628ff46u } },
+	{ { -0.630036771f, -0.630036771f, -0.453990489f }, { 0x718afabeu } },
+	{ { -0.528378665f, -0.790774584f, -0.309017003f }, { 0x7629b2f2u } },
+	{ { -0.672498524f, -0.672498524f, -0.309017003f }, { 0x362aa2a8u } },
+	{ { -0.740844846f, -0.495016694f, -0.453990489f }, { 0x318c0e85u } },
+	{ { -0.790774584f, -0.528378665f, -0.309017003f }, { 0x762bca6cu } },
+	{ { -0.823182702f, -0.340973437f, -0.453990489f }, { 0x718d4a5bu } },
+	{ { -0.878661633f, -0.363953561f, -0.309017003f }, { 0x362d1a3fu } },
+	{ { -0.873886108f, -0.173826754f, -0.453990489f }, { 0x318e9e41u } },
+	{ { -0.932782233f, -0.185541928f, -0.309017003f }, { 0x762e8623u } },
+	{ { -0.891006529f, 1.94818504e-16f, -0.453990489f }, { 0x71800239u } },
+	{ { -0.95105654f, 2.07948428e-16f, -0.309017003f }, { 0x3620021au } },
+	{ { -0.873886108f, 0.173826754f, -0.453990489f }, { 0x31816641u } },
+	{ { -0.932782233f, 0.185541928f, -0.309017003f }, { 0x76217e23u } },
+	{ { -0.823182702f, 0.340973437f, -0.453990489f }, { 0x7182ba5bu } },
+	{ { -0.878661633f, 0.363953561f, -0.309017003f }, { 0x3622ea3fu } },
+	{ { -0.740844846f, 0.495016694f, -0.453990489f }, { 0x3183f685u } },
+	{ { -0.790774584f, 0.528378665f, -0.309017003f }, { 0x76243a6cu } },
+	{ { -0.630036771f, 0.630036771f, -0.453990489f }, { 0x71850abeu } },
+	{ { -0.672498524f, 0.672498524f, -0.309017003f }, { 0x362562a8u } },
+	{ { -0.495016694f, 0.740844846f, -0.453990489f }, { 0x3185ef03u } },
+	{ { -0.528378665f, 0.790774584f, -0.309017003f }, { 0x762652f2u } },
+	{ { -0.340973437f, 0.823182702f, -0.453990489f }, { 0x71869752u } },
+	{ { -0.363953561f, 0.878661633f, -0.309017003f }, { 0x36270746u } },
+	{ { -0.173826754f, 0.873886108f, -0.453990489f }, { 0x3186ffa7u } },
+	{ { -0.185541928f, 0.932782233f, -0.309017003f }, { 0x762777a1u } },
+	{ { 1.94818504e-16f, 0.891006529f, -0.453990489f }, { 0x71871c00u } },
+	{ { 2.07948428e-16f, 0.95105654f, -0.309017003f }, { 0x36279800u } },
+	{ { 0.173826754f, 0.873886108f, -0.453990489f }, { 0x3186fc59u } },
+	{ { 0.185541928f, 0.932782233f, -0.309017003f }, { 0x7627745fu } },
+	{ { 0.340973437f, 0.823182702f, -0.453990489f }, { 0x718694aeu } },
+	{ { 0.363953561f, 0.878661633f, -0.309017003f }, { 0x362704bau } },
+	{ { 0.495016694f, 0.740844846f, -0.453990489f }, { 0x3185ecfdu } },
+	{ { 0.528378665f, 0.790774584f, -0.309017003f }, { 0x7626510eu } },
+	{ { 0.672498524f, 0.672498524f, -0.309017003f }, { 0x36256158u } },
+	{ { 0.698401153f, 0.698401153f, -0.156434461f }, { 0x7b059565u } },
+	{ { 0.548730254f, 0.821232855f, -0.156434461f }, { 0x3b069118u } },
+	{ { 0.707106769f, 0.707106769f, 2.18649922e-16f }, { 0x0005a569u } },
+	{ { 0.377971977f, 0.912505031f, -0.156434461f }, { 0x7b0748c1u } },
+	{ { 0.555570245f, 0.831469595f, 2.18649922e-16f }, { 0x4006a51cu } },
+	{ { 0.698401153f, 0.698401153f, 0.156434461f }, { 0x45059565u } },
+	{ { 0.192688435f, 0.968710184f, -0.156434461f }, { 0x3b07bc62u } },
+	{ { 0.672498524f, 0.672498524f, 0.309017003f }, { 0x09e56158u } },
+	{ { 0.548730254f, 0.821232855f, 0.156434461f }, { 0x05069118u } },
+	{ { 0.382683426f, 0.923879504f, 2.18649922e-16f }, { 0x000760c4u } },
+	{ { 0.630036771f, 0.630036771f, 0.453990489f }, { 0x4e850942u } },
+	{ { 0.528378665f, 0.790774584f, 0.309017003f }, { 0x49e6510eu } },
+	{ { 0.377971977f, 0.912505031f, 0.156434461f }, { 0x450748c1u } },
+	{ { 0.572061419f, 0.572061419f, 0.587785244f }, { 0x12c49124u } },
+	{ { 0.495016694f, 0.740844846f, 0.453990489f }, { 0x0e85ecfdu } },
+	{ { 0.5f, 0.5f, 0.707106769f }, { 0x56940100u } },
+	{ { 0.449465752f, 0.672673047f, 0.587785244f }, { 0x52c560e6u } },
+	{ { 0.363953561f, 0.878661633f, 0.309017003f }, { 0x09e704bau } },
+	{ { 0.415626943f, 0.415626943f, 0.809017003f }, { 0x19d350d4u } },
+	{ { 0.392847478f, 0.587937772f, 0.707106769f }, { 0x1694b0c9u } },
+	{ { 0.340973437f, 0.823182702f, 0.453990489f }, { 0x4e8694aeu } },
+	{ { 0.321019769f, 0.321019769f, 0.891006529f }, { 0x5c7290a4u } },
+	{ { 0.326555997f, 0.488725573f, 0.809017003f }, { 0x59d3e8a7u } },
+	{ { 0.252223611f, 0.377479315f, 0.891006529f }, { 0x1c730481u } },
+	{ { 0.270598054f, 0.65328151f, 0.707106769f }, { 0x5695388au } },
+	{ { 0.17373465f, 0.419432521f, 0.891006529f }, { 0x5c735859u } },
+	{ { 0.224935681f, 0.543042779f, 0.809017003f }, { 0x19d45473u } },
+	{ { 0.0885691494f, 0.4452672f, 0.891006529f }, { 0x1c73902du } },
+	{ { 0.114671215f, 0.576491117f, 0.809017003f }, { 0x59d49c3bu } },
+	{ { 9.92649888e-17f, 0.453990489f, 0.891006529f }, { 0x5c73a000u } },
+	{ { 1.28519197e-16f, 0.587785244f, 0.809017003f }, { 0x19d4b000u } },
+	{ { 0.13794969f, 0.69351995f, 0.707106769f }, { 0x16958846u } },
+	{ { 1.54608844e-16f, 0.707106769f, 0.707106769f }, { 0x5695a400u } },
+	{ { -0.114671215f, 0.576491117f, 0.809017003f }, { 0x59d49fc5u } },
+	{ { -0.0885691494f, 0.4452672f, 0.891006529f }, { 0x1c7393d3u } },
+	{ { -0.13794969f, 0.69351995f, 0.707106769f }, { 0x16958bbau } },
+	{ { -0.17373465f, 0.419432521f, 0.891006529f }, { 0x5c735ba7u } },
+	{ { -0.224935681f, 0.543042779f, 0.809017003f }, { 0x19d4578du } },
+	{ { -0.252223611f, 0.377479315f, 0.891006529f }, { 0x1c73077fu } },
+	{ { -0.326555997f, 0.488725573f, 0.809017003f }, { 0x59d3eb59u } },
+	{ { -0.270598054f, 0.65328151f, 0.707106769f }, { 0x56953b76u } },
+	{ { -0.392847478f, 0.587937772f, 0.707106769f }, { 0x1694b337u } },
+	{ { -0.415626943f, 0.415626943f, 0.809017003f }, { 0x19d3532cu } },
+	{ { -0.321019769f, 0.321019769f, 0.891006529f }, { 0x5c72935cu } },
+	{ { -0.5f, 0.5f, 0.707106769f }, { 0x56940300u } },
+	{ { -0.377479315f, 0.252223611f, 0.891006529f }, { 0x1c72073fu } },
+	{ { -0.488725573f, 0.326555997f, 0.809017003f }, { 0x59d29f06u } },
+	{ { -0.419432521f, 0.17373465f, 0.891006529f }, { 0x5c71672au } },
+	{ { -0.543042779f, 0.224935681f, 0.809017003f }, { 0x19d1ceebu } },
+	{ { -0.587937772f, 0.392847478f, 0.707106769f }, { 0x169326d4u } },
+	{ { -0.65328151f, 0.270598054f, 0.707106769f }, { 0x56922ab2u } },
+	{ { -0.576491117f, 0.114671215f, 0.809017003f }, { 0x59d0eed9u } },
+	{ { -0.4452672f, 0.0885691494f, 0.891006529f }, { 0x1c70b71cu } },
+	{ { -0.69351995f, 0.13794969f, 0.707106769f }, { 0x16911a9eu } },
+	{ { -0.453990489f, 9.92649888e-17f, 0.891006529f }, { 0x5c700318u } },
+	{ { -0.587785244f, 1.28519197e-16f, 0.809017003f }, { 0x19d002d4u } },
+	{ { -0.4452672f, -0.0885691494f, 0.891006529f }, { 0x1c7f4f1cu } },
+	{ { -0.576491117f, -0.114671215f, 0.809017003f }, { 0x59df16d9u } },
+	{ { -0.707106769f, 1.54608844e-16f, 0.707106769f }, { 0x56900297u } },
+	{ { -0.69351995f, -0.13794969f, 0.707106769f }, { 0x169eea9eu } },
+	{ { -0.543042779f, -0.224935681f, 0.809017003f }, { 0x19de36ebu } },
+	{ { -0.419432521f, -0.17373465f, 0.891006529f }, { 0x5c7e9f2au } },
+	{ { -0.65328151f, -0.270598054f, 0.707106769f }, { 0x569ddab2u } },
+	{ { -0.377479315f, -0.252223611f, 0.891006529f }, { 0x1c7dff3fu } },
+	{ { -0.488725573f, -0.326555997f, 0.809017003f }, { 0x59dd6706u } },
+	{ { -0.321019769f, -0.321019769f, 0.891006529f }, { 0x5c7d735cu } },
+	{ { -0.415626943f, -0.415626943f, 0.809017003f }, { 0x19dcb32cu } },
+	{ { -0.587937772f, -0.392847478f, 0.707106769f }, { 0x169cded4u } },
+	{ { -0.5f, -0.5f, 0.707106769f }, { 0x569c0300u } },
+	{ { -0.326555997f, -0.488725573f, 0.809017003f }, { 0x59dc1b59u } },
+	{ { -0.252223611f, -0.377479315f, 0.891006529f }, { 0x1c7cff7fu } },
+	{ { -0.392847478f, -0.587937772f, 0.707106769f }, { 0x169b5337u } },
+	{ { -0.17373465f, -0.419432521f, 0.891006529f }, { 0x5c7caba7u } },
+	{ { -0.224935681f, -0.543042779f, 0.809017003f }, { 0x19dbaf8du } },
+	{ { -0.0885691494f, -0.4452672f, 0.891006529f }, { 0x1c7c73d3u } },
+	{ { -0.114671215f, -0.576491117f, 0.809017003f }, { 0x59db67c5u } },
+	{ { -0.270598054f, -0.65328151f, 0.707106769f }, { 0x569acb76u } },
+	{ { -0.13794969f, -0.69351995f, 0.707106769f }, { 0x169a7bbau } },
+	{ { 0.0f, -0.587785244f, 0.809017003f }, { 0x19db5000u } },
+	{ { 0.0f, -0.453990489f, 0.891006529f }, { 0x5c7c6000u } },
+	{ { 0.0f, -0.707106769f, 0.707106769f }, { 0x569a5c00u } },
+	{ { 0.114671215f, -0.576491117f, 0.809017003f }, { 0x59db643bu } },
+	{ { 0.13794969f, -0.69351995f, 0.707106769f }, { 0x169a7846u } },
+	{ { 0.224935681f, -0.543042779f, 0.809017003f }, { 0x19dbac73u } },
+	{ { 0.270598054f, -0.65328151f, 0.707106769f }, { 0x569ac88au } },
+	{ { 0.326555997f, -0.488725573f, 0.809017003f }, { 0x59dc18a7u } },
+	{ { 0.392847478f, -0.587937772f, 0.707106769f }, { 0x169b50c9u } },
+	{ { 0.5f, -0.5f, 0.707106769f }, { 0x569c0100u } },
+	{ { 0.572061419f, -0.572061419f, 0.587785244f }, { 0x12cb7124u } },
+	{ { 0.449465752f, -0.672673047f, 0.587785244f }, { 0x52caa0e6u } },
+	{ { 0.630036771f, -0.630036771f, 0.453990489f }, { 0x4e8af942u } },
+	{ { 0.309597403f, -0.747434258f, 0.587785244f }, { 0x12ca089eu } },
+	{ { 0.495016694f, -0.740844846f, 0.453990489f }, { 0x0e8a14fdu } },
+	{ { 0.672498524f, -0.672498524f, 0.309017003f }, { 0x09eaa158u } },
+	{ { 0.157831386f, -0.793471932f, 0.587785244f }, { 0x52c9ac51u } },
+	{ { 0.340973437f, -0.823182702f, 0.453990489f }, { 0x4e896caeu } },
+	{ { 0.528378665f, -0.790774584f, 0.309017003f }, { 0x49e9b10eu } },
+	{ { 0.698401153f, -0.698401153f, 0.156434461f }, { 0x450a6d65u } },
+	{ { 0.363953561f, -0.878661633f, 0.309017003f }, { 0x09e8fcbau } },
+	{ { 0.707106769f, -0.707106769f, 2.18649922e-16f }, { 0x000a5d69u } },
+	{ { 0.548730254f, -0.821232855f, 0.156434461f }, { 0x05097118u } },
+	{ { 0.698401153f, -0.698401153f, -0.156434461f }, { 0x7b0a6d65u } },
+	{ { 0.555570245f, -0.831469595f, 2.18649922e-16f }, { 0x40095d1cu } },
+	{ { 0.377971977f, -0.912505031f, 0.156434461f }, { 0x4508b8c1u } },
+	{ { 0.672498524f, -0.672498524f, -0.309017003f }, { 0x362aa158u } },
+	{ { 0.548730254f, -0.821232855f, -0.156434461f }, { 0x3b097118u } },
+	{ { 0.382683426f, -0.923879504f, 2.18649922e-16f }, { 0x0008a0c4u } },
+	{ { 0.630036771f, -0.630036771f, -0.453990489f }, { 0x718af942u } },
+	{ { 0.528378665f, -0.790774584f, -0.309017003f }, { 0x7629b10eu } },
+	{ { 0.377971977f, -0.912505031f, -0.156434461f }, { 0x7b08b8c1u } },
+	{ { 0.572061419f, -0.572061419f, -0.587785244f }, { 0x2d4b7124u } },
+	{ { 0.495016694f, -0.740844846f, -0.453990489f }, { 0x318a14fdu } },
+	{ { 0.363953561f, -0.878661633f, -0.309017003f }, { 0x3628fcbau } },
+	{ { 0.5f, -0.5f, -0.707106769f }, { 0x697c0100u } },
+	{ { 0.449465752f, -0.672673047f, -0.587785244f }, { 0x6d4aa0e6u } },
+	{ { 0.340973437f, -0.823182702f, -0.453990489f }, { 0x71896caeu } },
+	{ { 0.415626943f, -0.415626943f, -0.809017003f }, { 0x263cb0d4u } },
+	{ { 0.392847478f, -0.587937772f, -0.707106769f }, { 0x297b50c9u } },
+	{ { 0.309597403f, -0.747434258f, -0.587785244f }, { 0x2d4a089eu } },
+	{ { 0.321019769f, -0.321019769f, -0.891006529f }, { 0x639d70a4u } },
+	{ { 0.326555997f, -0.488725573f, -0.809017003f }, { 0x663c18a7u } },
+	{ { 0.173826754f, -0.873886108f, -0.453990489f }, { 0x31890459u } },
+	{ { 0.185541928f, -0.932782233f, -0.309017003f }, { 0x76288c5fu } },
+	{ { 0.0f, -0.95105654f, -0.309017003f }, { 0x36286800u } },
+	{ { 0.192688435f, -0.968710184f, -0.156434461f }, { 0x3b084462u } },
+	{ { 0.0f, -0.987688363f, -0.156434461f }, { 0x7b081c00u } },
+	{ { -0.185541928f, -0.932782233f, -0.309017003f }, { 0x76288fa1u } },
+	{ { -0.192688435f, -0.968710184f, -0.156434461f }, { 0x3b08479eu } },
+	{ { -0.377971977f, -0.912505031f, -0.156434461f }, { 0x7b08bb3fu } },
+	{ { -0.548730254f, -0.821232855f, -0.156434461f }, { 0x3b0972e8u } },
+	{ { -0.382683426f, -0.923879504f, 2.18649922e-16f }, { 0x0008a33cu } },
+	{ { -0.698401153f, -0.698401153f, -0.156434461f }, { 0x7b0a6e9bu } },
+	{ { -0.555570245f, -0.831469595f, 2.18649922e-16f }, { 0x40095ee4u } },
+	{ { -0.707106769f, -0.707106769f, 2.18649922e-16f }, { 0x000a5e97u } },
+	{ { -0.821232855f, -0.548730254f, -0.156434461f }, { 0x3b0ba25cu } },
+	{ { -0.831469595f, -0.555570245f, 2.18649922e-16f }, { 0x400b9257u } },
+	{ { -0.912505031f, -0.377971977f, -0.156434461f }, { 0x7b0cfe2eu } },
+	{ { -0.923879504f, -0.382683426f, 2.18649922e-16f }, { 0x000cf228u } },
+	{ { -0.968710184f, -0.192688435f, -0.156434461f }, { 0x3b0e7a11u } },
+	{ { -0.980785251f, -0.195090324f, 2.18649922e-16f }, { 0x400e720bu } },
+	{ { -0.987688363f, 2.15957972e-16f, -0.156434461f }, { 0x7b000207u } },
+	{ { -1.0f, 2.18649922e-16f, 2.18649922e-16f }, { 0x00000201u } },
+	{ { -0.968710184f, 0.192688435f, -0.156434461f }, { 0x3b018a11u } },
+	{ { -0.980785251f, 0.195090324f, 2.18649922e-16f }, { 0x4001920bu } },
+	{ { -0.912505031f, 0.377971977f, -0.156434461f }, { 0x7b03062eu } },
+	{ { -0.923879504f, 0.382683426f, 2.18649922e-16f }, { 0x00031228u } },
+	{ { -0.821232855f, 0.548730254f, -0.156434461f }, { 0x3b04625cu } },
+	{ { -0.831469595f, 0.555570245f, 2.18649922e-16f }, { 0x40047257u } },
+	{ { -0.698401153f, 0.698401153f, -0.156434461f }, { 0x7b05969bu } },
+	{ { -0.707106769f, 0.707106769f, 2.18649922e-16f }, { 0x0005a697u } },
+	{ { -0.548730254f, 0.821232855f, -0.156434461f }, { 0x3b0692e8u } },
+	{ { -0.555570245f, 0.831469595f, 2.18649922e-16f }, { 0x4006a6e4u } },
+	{ { -0.377971977f, 0.912505031f, -0.156434461f }, { 0x7b074b3fu } },
+	{ { -0.382683426f, 0.923879504f, 2.18649922e-16f }, { 0x0007633cu } },
+	{ { -0.192688435f, 0.968710184f, -0.156434461f }, { 0x3b07bf9eu } },
+	{ { -0.195090324f, 0.980785251f, 2.18649922e-16f }, { 0x4007d79cu } },
+	{ { 2.15957972e-16f, 0.987688363f, -0.156434461f }, { 0x7b07e400u } },
+	{ { 2.18649922e-16f, 1.0f, 2.18649922e-16f }, { 0x0007fc00u } },
+	{ { 0.195090324f, 0.980785251f, 2.18649922e-16f }, { 0x4007d464u } },
+	{ { 0.192688435f, 0.968710184f, 0.156434461f }, { 0x0507bc62u } },
+	{ { 2.15957972e-16f, 0.987688363f, 0.156434461f }, { 0x4507e400u } },
+	{ { 0.185541928f, 0.932782233f, 0.309017003f }, { 0x49e7745fu } },
+	{ { -0.192688435f, 0.968710184f, 0.156434461f }, { 0x0507bf9eu } },
+	{ { 2.07948428e-16f, 0.95105654f, 0.309017003f }, { 0x09e79800u } },
+	{ { 0.173826754f, 0.873886108f, 0.453990489f }, { 0x0e86fc59u } },
+	{ { -0.377971977f, 0.912505031f, 0.156434461f }, { 0x45074b3fu } },
+	{ { -0.185541928f, 0.932782233f, 0.309017003f }, { 0x49e777a1u } },
+	{ { -0.548730254f, 0.821232855f, 0.156434461f }, { 0x050692e8u } },
+	{ { -0.363953561f, 0.878661633f, 0.309017003f }, { 0x09e70746u } },
+	{ { 1.94818504e-16f, 0.891006529f, 0.453990489f }, { 0x4e871c00u } },
+	{ { -0.173826754f, 0.873886108f, 0.453990489f }, { 0x0e86ffa7u } },
+	{ { -0.698401153f, 0.698401153f, 0.156434461f }, { 0x4505969bu } },
+	{ { -0.528378665f, 0.790774584f, 0.309017003f }, { 0x49e652f2u } },
+	{ { -0.821232855f, 0.548730254f, 0.156434461f }, { 0x0504625cu } },
+	{ { -0.672498524f, 0.672498524f, 0.309017003f }, { 0x09e562a8u } },
+	{ { -0.340973437f, 0.823182702f, 0.453990489f }, { 0x4e869752u } },
+	{ { -0.495016694f, 0.740844846f, 0.453990489f }, { 0x0e85ef03u } },
+	{ { -0.912505031f, 0.377971977f, 0.156434461f }, { 0x4503062eu } },
+	{ { -0.790774584f, 0.528378665f, 0.309017003f }, { 0x49e43a6cu } },
+	{ { -0.968710184f, 0.192688435f, 0.156434461f }, { 0x05018a11u } },
+	{ { -0.878661633f, 0.363953561f, 0.309017003f }, { 0x09e2ea3fu } },
+	{ { -0.630036771f, 0.630036771f, 0.453990489f }, { 0x4e850abeu } },
+	{ { -0.740844846f, 0.495016694f, 0.453990489f }, { 0x0e83f685u } },
+	{ { -0.987688363f, 2.15957972e-16f, 0.156434461f }, { 0x45000207u } },
+	{ { -0.932782233f, 0.185541928f, 0.309017003f }, { 0x49e17e23u } },
+	{ { -0.968710184f, -0.192688435f, 0.156434461f }, { 0x050e7a11u } },
+	{ { -0.95105654f, 2.07948428e-16f, 0.309017003f }, { 0x09e0021au } },
+	{ { -0.823182702f, 0.340973437f, 0.453990489f }, { 0x4e82ba5bu } },
+	{ { -0.873886108f, 0.173826754f, 0.453990489f }, { 0x0e816641u } },
+	{ { -0.912505031f, -0.377971977f, 0.156434461f }, { 0x450cfe2eu } },
+	{ { -0.932782233f, -0.185541928f, 0.309017003f }, { 0x49ee8623u } },
+	{ { -0.821232855f, -0.548730254f, 0.156434461f }, { 0x050ba25cu } },
+	{ { -0.878661633f, -0.363953561f, 0.309017003f }, { 0x09ed1a3fu } },
+	{ { -0.891006529f, 1.94818504e-16f, 0.453990489f }, { 0x4e800239u } },
+	{ { -0.873886108f, -0.173826754f, 0.453990489f }, { 0x0e8e9e41u } },
+	{ { -0.698401153f, -0.698401153f, 0.156434461f }, { 0x450a6e9bu } },
+	{ { -0.790774584f, -0.528378665f, 0.309017003f }, { 0x49ebca6cu } },
+	{ { -0.548730254f, -0.821232855f, 0.156434461f }, { 0x050972e8u } },
+	{ { -0.672498524f, -0.672498524f, 0.309017003f }, { 0x09eaa2a8u } },
+	{ { -0.823182702f, -0.340973437f, 0.453990489f }, { 0x4e8d4a5bu } },
+	{ { -0.740844846f, -0.495016694f, 0.453990489f }, { 0x0e8c0e85u } },
+	{ { -0.528378665f, -0.790774584f, 0.309017003f }, { 0x49e9b2f2u } },
+	{ { -0.793471932f, -0.157831386f, 0.587785244f }, { 0x52cebe6bu } },
+	{ { -0.630036771f, -0.630036771f, 0.453990489f }, { 0x4e8afabeu } },
+	{ { -0.747434258f, -0.309597403f, 0.587785244f }, { 0x12cd8a82u } },
+	{ { -0.672673047f, -0.449465752f, 0.587785244f }, { 0x52cc6aa8u } },
+	{ { -0.809017003f, 1.76891502e-16f, 0.587785244f }, { 0x12c00263u } },
+	{ { -0.793471932f, 0.157831386f, 0.587785244f }, { 0x52c1466bu } },
+	{ { -0.747434258f, 0.309597403f, 0.587785244f }, { 0x12c27a82u } },
+	{ { -0.672673047f, 0.449465752f, 0.587785244f }, { 0x52c39aa8u } },
+	{ { -0.572061419f, 0.572061419f, 0.587785244f }, { 0x12c492dcu } },
+	{ { -0.449465752f, 0.672673047f, 0.587785244f }, { 0x52c5631au } },
+	{ { -0.309597403f, 0.747434258f, 0.587785244f }, { 0x12c5fb62u } },
+	{ { -0.157831386f, 0.793471932f, 0.587785244f }, { 0x52c657afu } },
+	{ { 1.76891502e-16f, 0.809017003f, 0.587785244f }, { 0x12c67400u } },
+	{ { 0.157831386f, 0.793471932f, 0.587785244f }, { 0x52c65451u } },
+	{ { 0.309597403f, 0.747434258f, 0.587785244f }, { 0x12c5f89eu } },
+	{ { -0.572061419f, -0.572061419f, 0.587785244f }, { 0x12cb72dcu } },
+	{ { -0.449465752f, -0.672673047f, 0.587785244f }, { 0x52caa31au } },
+	{ { -0.495016694f, -0.740844846f, 0.453990489f }, { 0x0e8a1703u } },
+	{ { -0.309597403f, -0.747434258f, 0.587785244f }, { 0x12ca0b62u } },
+	{ { -0.340973437f, -0.823182702f, 0.453990489f }, { 0x4e896f52u } },
+	{ { -0.363953561f, -0.878661633f, 0.309017003f }, { 0x09e8ff46u } },
+	{ { -0.157831386f, -0.793471932f, 0.587785244f }, { 0x52c9afafu } },
+	{ { -0.173826754f, -0.873886108f, 0.453990489f }, { 0x0e8907a7u } },
+	{ { 0.0f, -0.809017003f, 0.587785244f }, { 0x12c98c00u } },
+	{ { 0.0f, -0.891006529f, 0.453990489f }, { 0x4e88e400u } },
+	{ { 0.173826754f, -0.873886108f, 0.453990489f }, { 0x0e890459u } },
+	{ { 0.185541928f, -0.932782233f, 0.309017003f }, { 0x49e88c5fu } },
+	{ { 0.0f, -0.95105654f, 0.309017003f }, { 0x09e86800u } },
+	{ { 0.192688435f, -0.968710184f, 0.156434461f }, { 0x05084462u } },
+	{ { -0.185541928f, -0.932782233f, 0.309017003f }, { 0x49e88fa1u } },
+	{ { 0.0f, -0.987688363f, 0.156434461f }, { 0x45081c00u } },
+	{ { 0.195090324f, -0.980785251f, 2.18649922e-16f }, { 0x40082c64u } },
+	{ { -0.192688435f, -0.968710184f, 0.156434461f }, { 0x0508479eu } },
+	{ { 0.0f, -1.0f, 2.18649922e-16f }, { 0x00080400u } },
+	{ { -0.377971977f, -0.912505031f, 0.156434461f }, { 0x4508bb3fu } },
+	{ { -0.195090324f, -0.980785251f, 2.18649922e-16f }, { 0x40082f9cu } },
+	// ball level 5
+	{ { 0.337084025f, -0.524513006f, -0.781831503f }, { 0x670bd0acu } },
+	{ { 0.408298999f, -0.471202165f, -0.781831503f }, { 0x270c3cd1u } },
+	{ { 0.348406911f, -0.402083009f, -0.846724212f }, { 0x64fcccb2u } },
+	{ { 0.382290781f, -0.594856083f, -0.707106769f }, { 0x297b40c3u } },
+	{ { 0.463056475f, -0.534395635f, -0.707106769f }, { 0x697bbcedu } },
+	{ { 0.293742776f, -0.643206954f, -0.707106769f }, { 0x697adc96u } },
+	{ { 0.422690004f, -0.65771848f, -0.623489797f }, { 0x6c1ac0d8u } },
+	{ { 0.511990726f, -0.590868831f, -0.623489797f }, { 0x2c1b4906u } },
+	{ { 0.324784547f, -0.711178958f, -0.623489797f }, { 0x2c1a54a6u } },
+	{ { 0.457773656f, -0.712309718f, -0.532032073f }, { 0x2f0a50eau } },
+	{ { 0.554486454f, -0.639911473f, -0.532032073f }, { 0x6f0ae51bu } },
+	{ { 0.35174194f, -0.770207405f, -0.532032073f }, { 0x6f09d8b4u } },
+	{ { 0.220267385f, -0.750161827f, -0.623489797f }, { 0x6c1a0471u } },
+	{ { 0.199214995f, -0.678463995f, -0.707106769f }, { 0x297a9466u } },
+	{ { 0.111266218f, -0.773873568f, -0.623489797f }, { 0x2c19d439u } },
+	{ { 0.238549769f, -0.812425911f, -0.532032073f }, { 0x2f09847au } },
+	{ { 0.120501414f, -0.838105738f, -0.532032073f }, { 0x6f09503eu } },
+	{ { 0.0f, -0.846724212f, -0.532032073f }, { 0x2f093c00u } },
+	{ { 0.0f, -0.781831503f, -0.623489797f }, { 0x6c19c000u } },
+	{ { 0.128221244f, -0.891798317f, -0.433883727f }, { 0x3228e042u } },
+	{ { -0.120501414f, -0.838105738f, -0.532032073f }, { 0x6f0953c2u } },
+	{ { -0.111266218f, -0.773873568f, -0.623489797f }, { 0x2c19d7c7u } },
+	{ { 0.0f, -0.90096885f, -0.433883727f }, { 0x7228d000u } },
+	{ { -0.128221244f, -0.891798317f, -0.433883727f }, { 0x3228e3beu } },
+	{ { -0.238549769f, -0.812425911f, -0.532032073f }, { 0x2f098786u } },
+	{ { -0.220267385f, -0.750161827f, -0.623489797f }, { 0x6c1a078fu } },
+	{ { -0.253832251f, -0.864473283f, -0.433883727f }, { 0x72291b7eu } },
+	{ { -0.35174194f, -0.770207405f, -0.532032073f }, { 0x6f09db4cu } },
+	{ { -0.324784547f, -0.711178958f, -0.623489797f }, { 0x2c1a575au } },
+	{ { -0.374275982f, -0.819550097f, -0.433883727f }, { 0x32297741u } },
+	{ { -0.457773656f, -0.712309718f, -0.532032073f }, { 0x2f0a5316u } },
+	{ { -0.422690004f, -0.65771848f, -0.623489797f }, { 0x6c1ac328u } },
+	{ { -0.487100542f, -0.757943273f, -0.433883727f }, { 0x7229f707u } },
+	{ { -0.554486454f, -0.639911473f, -0.532032073f }, { 0x6f0ae6e5u } },
+	{ { -0.511990726f, -0.590868831f, -0.623489797f }, { 0x2c1b4afau } },
+	{ { -0.590009153f, -0.680906832f, -0.433883727f }, { 0x322a92d3u } },
+	{ { -0.639911473f, -0.554486454f, -0.532032073f }, { 0x2f0b96b9u } },
+	{ { -0.590868831f, -0.511990726f, -0.623489797f }, { 0x6c1bead2u } },
+	{ { -0.680906832f, -0.590009153f, -0.433883727f }, { 0x722b4ea4u } },
+	{ { -0.712309718f, -0.457773656f, -0.532032073f }, { 0x6f0c5a94u } },
+	{ { -0.65771848f, -0.422690004f, -0.623489797f }, { 0x2c1ca2b0u } },
+	{ { -0.757943273f, -0.487100542f, -0.433883727f }, { 0x322c1e7du } },
+	{ { -0.770207405f, -0.35174194f, -0.532032073f }, { 0x2f0d3276u } },
+	{ { -0.711178958f, -0.324784547f, -0.623489797f }, { 0x6c1d6a95u } },
+	{ { -0.819550097f, -0.374275982f, -0.433883727f }, { 0x722d065du } },
+	{ { -0.812425911f, -0.238549769f, -0.532032073f }, { 0x6f0e1a61u } },
+	{ { -0.750161827f, -0.220267385f, -0.623489797f }, { 0x2c1e3e81u } },
+	{ { -0.864473283f, -0.253832251f, -0.433883727f }, { 0x322dfa46u } },
+	{ { -0.838105738f, -0.120501414f, -0.532032073f }, { 0x2f0f0a54u } },
+	{ { -0.773873568f, -0.111266218f, -0.623489797f }, { 0x6c1f1e75u } },
+	{ { -0.891798317f, -0.128221244f, -0.433883727f }, { 0x722efa38u } },
+	{ { -0.846724212f, 1.85136177e-16f, -0.532032073f }, { 0x6f00024fu } },
+	{ { -0.781831503f, 1.70947395e-16f, -0.623489797f }, { 0x2c100270u } },
+	{ { -0.90096885f, 1.96996769e-16f, -0.433883727f }, { 0x32200234u } },
+	{ { -0.838105738f, 0.120501414f, -0.532032073f }, { 0x2f00fa54u } },
+	{ { -0.773873568f, 0.111266218f, -0.623489797f }, { 0x6c10e675u } },
+	{ { -0.891798317f, 0.128221244f, -0.433883727f }, { 0x72210a38u } },
+	{ { -0.812425911f, 0.238549769f, -0.532032073f }, { 0x6f01ea61u } },
+	{ { -0.750161827f, 0.220267385f, -0.623489797f }, { 0x2c11c681u } },
+	{ { -0.864473283f, 0.253832251f, -0.433883727f }, { 0x32220a46u } },
+	{ { -0.770207405f, 0.35174194f, -0.532032073f }, { 0x2f02d276u } },
+	{ { -0.711178958f, 0.324784547f, -0.623489797f }, { 0x6c129a95u } },
+	{ { -0.819550097f, 0.374275982f, -0.433883727f }, { 0x7222fe5du } },
+	{ { -0.712309718f, 0.457773656f, -0.532032073f }, { 0x6f03aa94u } },
+	{ { -0.65771848f, 0.422690004f, -0.623489797f }, { 0x2c1362b0u } },
+	{ { -0.757943273f, 0.487100542f, -0.433883727f }, { 0x3223e67du } },
+	{ { -0.639911473f, 0.554486454f, -0.532032073f }, { 0x2f046eb9u } },
+	{ { -0.590868831f, 0.511990726f, -0.623489797f }, { 0x6c141ad2u } },
+	{ { -0.680906832f, 0.590009153f, -0.433883727f }, { 0x7224b6a4u } },
+	{ { -0.554486454f, 0.639911473f, -0.532032073f }, { 0x6f051ee5u } },
+	{ { -0.511990726f, 0.590868831f, -0.623489797f }, { 0x2c14bafau } },
+	{ { -0.590009153f, 0.680906832f, -0.433883727f }, { 0x322572d3u } },
+	{ { -0.457773656f, 0.712309718f, -0.532032073f }, { 0x2f05b316u } },
+	{ { -0.422690004f, 0.65771848f, -0.623489797f }, { 0x6c154328u } },
+	{ { -0.487100542f, 0.757943273f, -0.433883727f }, { 0x72260f07u } },
+	{ { -0.35174194f, 0.770207405f, -0.532032073f }, { 0x6f062b4cu } },
+	{ { -0.324784547f, 0.711178958f, -0.623489797f }, { 0x2c15af5au } },
+	{ { -0.374275982f, 0.819550097f, -0.433883727f }, { 0x32268f41u } },
+	{ { -0.238549769f, 0.812425911f, -0.532032073f }, { 0x2f067f86u } },
+	{ { -0.220267385f, 0.750161827f, -0.623489797f }, { 0x6c15ff8fu } },
+	{ { -0.253832251f, 0.864473283f, -0.433883727f }, { 0x7226eb7eu } },
+	{ { -0.120501414f, 0.838105738f, -0.532032073f }, { 0x6f06b3c2u } },
+	{ { -0.111266218f, 0.773873568f, -0.623489797f }, { 0x2c162fc7u } },
+	{ { -0.128221244f, 0.891798317f, -0.433883727f }, { 0x322723beu } },
+	{ { 1.85136177e-16f, 0.846724212f, -0.532032073f }, { 0x2f06c400u } },
+	{ { 1.70947395e-16f, 0.781831503f, -0.623489797f }, { 0x6c164000u } },
+	{ { 1.96996769e-16f, 0.90096885f, -0.433883727f }, { 0x72273000u } },
+	{ { 0.120501414f, 0.838105738f, -0.532032073f }, { 0x6f06b03eu } },
+	{ { 0.111266218f, 0.773873568f, -0.623489797f }, { 0x2c162c39u } },
+	{ { 0.128221244f, 0.891798317f, -0.433883727f }, { 0x32272042u } },
+	{ { 0.238549769f, 0.812425911f, -0.532032073f }, { 0x2f067c7au } },
+	{ { 0.220267385f, 0.750161827f, -0.623489797f }, { 0x6c15fc71u } },
+	{ { 0.253832251f, 0.864473283f, -0.433883727f }, { 0x7226e882u } },
+	{ { 0.35174194f, 0.770207405f, -0.532032073f }, { 0x6f0628b4u } },
+	{ { 0.324784547f, 0.711178958f, -0.623489797f }, { 0x2c15aca6u } },
+	{ { 0.457773656f, 0.712309718f, -0.532032073f }, { 0x2f05b0eau } },
+	{ { 0.374275982f, 0.819550097f, -0.433883727f }, { 0x32268cbfu } },
+	{ { 0.487100542f, 0.757943273f, -0.433883727f }, { 0x72260cf9u } },
+	{ { 0.590009153f, 0.680906832f, -0.433883727f }, { 0x3225712du } },
+	{ { 0.618112147f, 0.713339448f, -0.330279052f }, { 0x7575b53cu } },
+	{ { 0.510301828f, 0.79404521f, -0.330279052f }, { 0x35765905u } },
+	{ { 0.63844198f, 0.736801326f, -0.222520933f }, { 0x38e5e546u } },
+	{ { 0.392103314f, 0.85858649f, -0.330279052f }, { 0x7576dcc8u } },
+	{ { 0.527085841f, 0.820161521f, -0.222520933f }, { 0x78e68d0du } },
+	{ { 0.650743127f, 0.750997603f, -0.111964479f }, { 0x7c76014du } },
+	{ { 0.265922666f, 0.905649424f, -0.330279052f }, { 0x35773c88u } },
+	{ { 0.404999703f, 0.886825621f, -0.222520933f }, { 0x38e714cfu } },
+	{ { 0.537241399f, 0.835963905f, -0.111964479f }, { 0x3c76ad13u } },
+	{ { 0.654860735f, 0.755749583f, 2.18649922e-16f }, { 0x0006094fu } },
+	{ { 0.134328604f, 0.934275985f, -0.330279052f }, { 0x75777445u } },
+	{ { 0.540640831f, 0.841253519f, 2.18649922e-16f }, { 0x4006b914u } },
+	{ { 0.650743127f, 0.750997603f, 0.111964479f }, { 0x4396014du } },
+	{ { 0.412802964f, 0.903912425f, -0.111964479f }, { 0x7c7738d3u } },
+	{ { 0.274668932f, 0.935436487f, -0.222520933f }, { 0x78e7788cu } },
+	{ { 0.537241399f, 0.835963905f, 0.111964479f }, { 0x0396ad13u } },
+	{ { 0.63844198f, 0.736801326f, 0.222520933f }, { 0x0725e546u } },
+	{ { 0.415415019f, 0.909631968f, 2.18649922e-16f }, { 0x000744d4u } },
+	{ { 0.279961079f, 0.953459859f, -0.111964479f }, { 0x3c779c8fu } },
+	{ { 0.527085841f, 0.820161521f, 0.222520933f }, { 0x47268d0du } },
+	{ { 0.618112147f, 0.713339448f, 0.330279052f }, { 0x4a95b53cu } },
+	{ { 0.412802964f, 0.903912425f, 0.111964479f }, { 0x439738d3u } },
+	{ { 0.510301828f, 0.79404521f, 0.330279052f }, { 0x0a965905u } },
+	{ { 0.590009153f, 0.680906832f, 0.433883727f }, { 0x0de5712du } },
+	{ { 0.404999703f, 0.886825621f, 0.222520933f }, { 0x072714cfu } },
+	{ { 0.281732559f, 0.959492981f, 2.18649922e-16f }, { 0x4007a890u } },
+	{ { 0.487100542f, 0.757943273f, 0.433883727f }, { 0x4de60cf9u } },
+	{ { 0.554486454f, 0.639911473f, 0.532032073f }, { 0x51051d1bu } },
+	{ { 0.392103314f, 0.85858649f, 0.330279052f }, { 0x4a96dcc8u } },
+	{ { 0.279961079f, 0.953459859f, 0.111964479f }, { 0x03979c8fu } },
+	{ { 0.457773656f, 0.712309718f, 0.532032073f }, { 0x1105b0eau } },
+	{ { 0.511990726f, 0.590868831f, 0.623489797f }, { 0x13f4b906u } },
+	{ { 0.374275982f, 0.819550097f, 0.433883727f }, { 0x0de68cbfu } },
+	{ { 0.274668932f, 0.935436487f, 0.222520933f }, { 0x4727788cu } },
+	{ { 0.422690004f, 0.65771848f, 0.623489797f }, { 0x53f540d8u } },
+	{ { 0.463056475f, 0.534395635f, 0.707106769f }, { 0x569444edu } },
+	{ { 0.35174194f, 0.770207405f, 0.532032073f }, { 0x510628b4u } },
+	{ { 0.265922666f, 0.905649424f, 0.330279052f }, { 0x0a973c88u } },
+	{ { 0.253832251f, 0.864473283f, 0.433883727f }, { 0x4de6e882u } },
+	{ { 0.324784547f, 0.711178958f, 0.623489797f }, { 0x13f5aca6u } },
+	{ { 0.238549769f, 0.812425911f, 0.532032073f }, { 0x11067c7au } },
+	{ { 0.382290781f, 0.594856083f, 0.707106769f }, { 0x1694c0c3u } },
+	{ { 0.408298999f, 0.471202165f, 0.781831503f }, { 0x1903c4d1u } },
+	{ { 0.471202165f, 0.408298999f, 0.781831503f }, { 0x590344f1u } },
+	{ { 0.402083009f, 0.348406911f, 0.846724212f }, { 0x1b12c8cdu } },
+	{ { 0.348406911f, 0.402083009f, 0.846724212f }, { 0x5b1334b2u } },
+	{ { 0.337084025f, 0.524513006f, 0.781831503f }, { 0x590430acu } },
+	{ { 0.287638247f, 0.44757387f, 0.846724212f }, { 0x1b139493u } },
+	{ { 0.293742776f, 0.643206954f, 0.707106769f }, { 0x56952496u } },
+	{ { 0.259007037f, 0.567146301f, 0.781831503f }, { 0x19048884u } },
+	{ { 0.221014112f, 0.483953387f, 0.846724212f }, { 0x5b13dc71u } },
+	{ { 0.220267385f, 0.750161827f, 0.623489797f }, { 0x53f5fc71u } },
+	{ { 0.199214995f, 0.678463995f, 0.707106769f }, { 0x16956c66u } },
+	{ { 0.175657377f, 0.598234057f, 0.781831503f }, { 0x5904c85au } },
+	{ { 0.149890751f, 0.51048106f, 0.846724212f }, { 0x1b14144du } },
+	{ { 0.111266218f, 0.773873568f, 0.623489797f }, { 0x13f62c39u } },
+	{ { 0.0887318477f, 0.617143571f, 0.781831503f }, { 0x1904ec2du } },
+	{ { 0.0757160559f, 0.526616752f, 0.846724212f }, { 0x5b143427u } },
+	{ { 0.100631788f, 0.699909449f, 0.707106769f }, { 0x56959833u } },
+	{ { 1.36325996e-16f, 0.623489797f, 0.781831503f }, { 0x5904fc00u } },
+	{ { 1.16328765e-16f, 0.532032073f, 0.846724212f }, { 0x1b144000u } },
+	{ { 1.54608844e-16f, 0.707106769f, 0.707106769f }, { 0x1695a400u } },
+	{ { -0.0887318477f, 0.617143571f, 0.781831503f }, { 0x1904efd3u } },
+	{ { -0.0757160559f, 0.526616752f, 0.846724212f }, { 0x5b1437d9u } },
+	{ { -0.100631788f, 0.699909449f, 0.707106769f }, { 0x56959bcdu } },
+	{ { 1.70947395e-16f, 0.781831503f, 0.623489797f }, { 0x53f64000u } },
+	{ { -0.111266218f, 0.773873568f, 0.623489797f }, { 0x13f62fc7u } },
+	{ { -0.199214995f, 0.678463995f, 0.707106769f }, { 0x16956f9au } },
+	{ { -0.175657377f, 0.598234057f, 0.781831503f }, { 0x5904cba6u } },
+	{ { -0.149890751f, 0.51048106f, 0.846724212f }, { 0x1b1417b3u } },
+	{ { -0.220267385f, 0.750161827f, 0.623489797f }, { 0x53f5ff8fu } },
+	{ { -0.259007037f, 0.567146301f, 0.781831503f }, { 0x19048b7cu } },
+	{ { -0.221014112f, 0.483953387f, 0.846724212f }, { 0x5b13df8fu } },
+	{ { -0.293742776f, 0.643206954f, 0.707106769f }, { 0x5695276au } },
+	{ { -0.337084025f, 0.524513006f, 0.781831503f }, { 0x59043354u } },
+	{ { -0.287638247f, 0.44757387f, 0.846724212f }, { 0x1b13976du } },
+	{ { -0.382290781f, 0.594856083f, 0.707106769f }, { 0x1694c33du } },
+	{ { -0.324784547f, 0.711178958f, 0.623489797f }, { 0x13f5af5au } },
+	{ { -0.422690004f, 0.65771848f, 0.623489797f }, { 0x53f54328u } },
+	{ { -0.463056475f, 0.534395635f, 0.707106769f }, { 0x56944713u } },
+	{ { -0.408298999f, 0.471202165f, 0.781831503f }, { 0x1903c72fu } },
+	{ { -0.348406911f, 0.402083009f, 0.846724212f }, { 0x5b13374eu } },
+	{ { -0.511990726f, 0.590868831f, 0.623489797f }, { 0x13f4bafau } },
+	{ { -0.471202165f, 0.408298999f, 0.781831503f }, { 0x5903470fu } },
+	{ { -0.402083009f, 0.348406911f, 0.846724212f }, { 0x1b12cb33u } },
+	{ { -0.534395635f, 0.463056475f, 0.707106769f }, { 0x1693b6efu } },
+	{ { -0.524513006f, 0.337084025f, 0.781831503f }, { 0x1902b2f4u } },
+	{ { -0.44757387f, 0.287638247f, 0.846724212f }, { 0x5b124f1bu } },
+	{ { -0.594856083f, 0.382290781f, 0.707106769f }, { 0x56930ed0u } },
+	{ { -0.590868831f, 0.511990726f, 0.623489797f }, { 0x53f41ad2u } },
+	{ { -0.65771848f, 0.422690004f, 0.623489797f }, { 0x13f362b0u } },
+	{ { 0.100631788f, -0.699909449f, -0.707106769f }, { 0x697a6833u } },
+	{ { -0.100631788f, -0.699909449f, -0.707106769f }, { 0x697a6bcdu } },
+	{ { 0.0f, -0.707106769f, -0.707106769f }, { 0x297a5c00u } },
+	{ { 0.0f, -0.623489797f, -0.781831503f }, { 0x670b0400u } },
+	{ { -0.0887318477f, -0.617143571f, -0.781831503f }, { 0x270b17d3u } },
+	{ { -0.199214995f, -0.678463995f, -0.707106769f }, { 0x297a979au } },
+	{ { -0.175657377f, -0.598234057f, -0.781831503f }, { 0x670b3ba6u } },
+	{ { -0.293742776f, -0.643206954f, -0.707106769f }, { 0x697adf6au } },
+	{ { -0.259007037f, -0.567146301f, -0.781831503f }, { 0x270b7b7cu } },
+	{ { -0.382290781f, -0.594856083f, -0.707106769f }, { 0x297b433du } },
+	{ { -0.337084025f, -0.524513006f, -0.781831503f }, { 0x670bd354u } },
+	{ { -0.463056475f, -0.534395635f, -0.707106769f }, { 0x697bbf13u } },
+	{ { -0.408298999f, -0.471202165f, -0.781831503f }, { 0x270c3f2fu } },
+	{ { -0.534395635f, -0.463056475f, -0.707106769f }, { 0x297c4eefu } },
+	{ { -0.471202165f, -0.408298999f, -0.781831503f }, { 0x670cbf0fu } },
+	{ { -0.594856083f, -0.382290781f, -0.707106769f }, { 0x697cf6d0u } },
+	{ { -0.524513006f, -0.337084025f, -0.781831503f }, { 0x270d52f4u } },
+	{ { -0.643206954f, -0.293742776f, -0.707106769f }, { 0x297daab7u } },
+	{ { -0.567146301f, -0.259007037f, -0.781831503f }, { 0x670df2deu } },
+	{ { -0.678463995f, -0.199214995f, -0.707106769f }, { 0x697e6aa5u } },
+	{ { -0.598234057f, -0.175657377f, -0.781831503f }, { 0x270e9aceu } },
+	{ { -0.699909449f, -0.100631788f, -0.707106769f }, { 0x297f369au } },
+	{ { -0.617143571f, -0.0887318477f, -0.781831503f }, { 0x670f4ec5u } },
+	{ { -0.707106769f, 1.54608844e-16f, -0.707106769f }, { 0x69700297u } },
+	{ { -0.623489797f, 1.36325996e-16f, -0.781831503f }, { 0x270002c1u } },
+	{ { -0.699909449f, 0.100631788f, -0.707106769f }, { 0x2970ce9au } },
+	{ { -0.617143571f, 0.0887318477f, -0.781831503f }, { 0x6700b6c5u } },
+	{ { -0.678463995f, 0.199214995f, -0.707106769f }, { 0x69719aa5u } },
+	{ { -0.598234057f, 0.175657377f, -0.781831503f }, { 0x27016aceu } },
+	{ { -0.643206954f, 0.293742776f, -0.707106769f }, { 0x29725ab7u } },
+	{ { -0.567146301f, 0.259007037f, -0.781831503f }, { 0x670212deu } },
+	{ { -0.594856083f, 0.382290781f, -0.707106769f }, { 0x69730ed0u } },
+	{ { -0.524513006f, 0.337084025f, -0.781831503f }, { 0x2702b2f4u } },
+	{ { -0.534395635f, 0.463056475f, -0.707106769f }, { 0x2973b6efu } },
+	{ { -0.471202165f, 0.408298999f, -0.781831503f }, { 0x6703470fu } },
+	{ { -0.463056475f, 0.534395635f, -0.707106769f }, { 0x69744713u } },
+	{ { -0.408298999f, 0.471202165f, -0.781831503f }, { 0x2703c72fu } },
+	{ { -0.382290781f, 0.594856083f, -0.707106769f }, { 0x2974c33du } },
+	{ { -0.337084025f, 0.524513006f, -0.781831503f }, { 0x67043354u } },
+	{ { -0.293742776f, 0.643206954f, -0.707106769f }, { 0x6975276au } },
+	{ { -0.259007037f, 0.567146301f, -0.781831503f }, { 0x27048b7cu } },
+	{ { -0.199214995f, 0.678463995f, -0.707106769f }, { 0x29756f9au } },
+	{ { -0.175657377f, 0.598234057f, -0.781831503f }, { 0x6704cba6u } },
+	{ { -0.100631788f, 0.699909449f, -0.707106769f }, { 0x69759bcdu } },
+	{ { -0.0887318477f, 0.617143571f, -0.781831503f }, { 0x2704efd3u } },
+	{ { 1.54608844e-16f, 0.707106769f, -0.707106769f }, { 0x2975a400u } },
+	{ { 1.36325996e-16f, 0.623489797f, -0.781831503f }, { 0x6704fc00u } },
+	{ { 0.100631788f, 0.699909449f, -0.707106769f }, { 0x69759833u } },
+	{ { 0.0887318477f, 0.617143571f, -0.781831503f }, { 0x2704ec2du } },
+	{ { 0.199214995f, 0.678463995f, -0.707106769f }, { 0x29756c66u } },
+	{ { 0.175657377f, 0.598234057f, -0.781831503f }, { 0x6704c85au } },
+	{ { 0.293742776f, 0.643206954f, -0.707106769f }, { 0x69752496u } },
+	{ { 0.259007037f, 0.567146301f, -0.781831503f }, { 0x27048884u } },
+	{ { 0.382290781f, 0.594856083f, -0.707106769f }, { 0x2974c0c3u } },
+	{ { 0.337084025f, 0.524513006f, -0.781831503f }, { 0x670430acu } },
+	{ { 0.422690004f, 0.65771848f, -0.623489797f }, { 0x6c1540d8u } },
+	{ { 0.463056475f, 0.534395635f, -0.707106769f }, { 0x697444edu } },
+	{ { 0.408298999f, 0.471202165f, -0.781831503f }, { 0x2703c4d1u } },
+	{ { 0.511990726f, 0.590868831f, -0.623489797f }, { 0x2c14b906u } },
+	{ { 0.534395635f, 0.463056475f, -0.707106769f }, { 0x2973b511u } },
+	{ { 0.471202165f, 0.408298999f, -0.781831503f }, { 0x670344f1u } },
+	{ { 0.594856083f, 0.382290781f, -0.707106769f }, { 0x69730d30u } },
+	{ { 0.590868831f, 0.511990726f, -0.623489797f }, { 0x6c14192eu } },
+	{ { 0.65771848f, 0.422690004f, -0.623489797f }, { 0x2c136150u } },
+	{ { 0.711178958f, 0.324784547f, -0.623489797f }, { 0x6c12996bu } },
+	{ { 0.770207405f, 0.35174194f, -0.532032073f }, { 0x2f02d18au } },
+	{ { 0.712309718f, 0.457773656f, -0.532032073f }, { 0x6f03a96cu } },
+	{ { 0.819550097f, 0.374275982f, -0.433883727f }, { 0x7222fda3u } },
+	{ { 0.639911473f, 0.554486454f, -0.532032073f }, { 0x2f046d47u } },
+	{ { 0.757943273f, 0.487100542f, -0.433883727f }, { 0x3223e583u } },
+	{ { 0.85858649f, 0.392103314f, -0.330279052f }, { 0x357321b7u } },
+	{ { 0.554486454f, 0.639911473f, -0.532032073f }, { 0x6f051d1bu } },
+	{ { 0.680906832f, 0.590009153f, -0.433883727f }, { 0x7224b55cu } },
+	{ { 0.79404521f, 0.510301828f, -0.330279052f }, { 0x75741596u } },
+	{ { 0.886825621f, 0.404999703f, -0.222520933f }, { 0x78e33dc5u } },
+	{ { 0.820161521f, 0.527085841f, -0.222520933f }, { 0x38e435a3u } },
+	{ { 0.903912425f, 0.412802964f, -0.111964479f }, { 0x3c734dceu } },
+	{ { 0.713339448f, 0.618112147f, -0.330279052f }, { 0x3574f16du } },
+	{ { 0.835963905f, 0.537241399f, -0.111964479f }, { 0x7c744dabu } },
+	{ { 0.909631968f, 0.415415019f, 2.18649922e-16f }, { 0x400351d1u } },
+	{ { 0.736801326f, 0.63844198f, -0.222520933f }, { 0x78e51979u } },
+	{ { 0.841253519f, 0.540640831f, 2.18649922e-16f }, { 0x000451aeu } },
+	{ { 0.903912425f, 0.412802964f, 0.111964479f }, { 0x03934dceu } },
+	{ { 0.750997603f, 0.650743127f, -0.111964479f }, { 0x3c753580u } },
+	{ { 0.835963905f, 0.537241399f, 0.111964479f }, { 0x43944dabu } },
+	{ { 0.886825621f, 0.404999703f, 0.222520933f }, { 0x47233dc5u } },
+	{ { 0.755749583f, 0.654860735f, 2.18649922e-16f }, { 0x40053d82u } },
+	{ { 0.820161521f, 0.527085841f, 0.222520933f }, { 0x072435a3u } },
+	{ { 0.85858649f, 0.392103314f, 0.330279052f }, { 0x0a9321b7u } },
+	{ { 0.750997603f, 0.650743127f, 0.111964479f }, { 0x03953580u } },
+	{ { 0.79404521f, 0.510301828f, 0.330279052f }, { 0x4a941596u } },
+	{ { 0.819550097f, 0.374275982f, 0.433883727f }, { 0x4de2fda3u } },
+	{ { 0.736801326f, 0.63844198f, 0.222520933f }, { 0x47251979u } },
+	{ { 0.757943273f, 0.487100542f, 0.433883727f }, { 0x0de3e583u } },
+	{ { 0.770207405f, 0.35174194f, 0.532032073f }, { 0x1102d18au } },
+	{ { 0.713339448f, 0.618112147f, 0.330279052f }, { 0x0a94f16du } },
+	{ { 0.712309718f, 0.457773656f, 0.532032073f }, { 0x5103a96cu } },
+	{ { 0.711178958f, 0.324784547f, 0.623489797f }, { 0x53f2996bu } },
+	{ { 0.680906832f, 0.590009153f, 0.433883727f }, { 0x4de4b55cu } },
+	{ { 0.65771848f, 0.422690004f, 0.623489797f }, { 0x13f36150u } },
+	{ { 0.643206954f, 0.293742776f, 0.707106769f }, { 0x16925949u } },
+	{ { 0.639911473f, 0.554486454f, 0.532032073f }, { 0x11046d47u } },
+	{ { 0.594856083f, 0.382290781f, 0.707106769f }, { 0x56930d30u } },
+	{ { 0.567146301f, 0.259007037f, 0.781831503f }, { 0x59021122u } },
+	{ { 0.590868831f, 0.511990726f, 0.623489797f }, { 0x53f4192eu } },
+	{ { 0.524513006f, 0.337084025f, 0.781831503f }, { 0x1902b10cu } },
+	{ { 0.483953387f, 0.221014112f, 0.846724212f }, { 0x1b11c4f7u } },
+	{ { 0.534395635f, 0.463056475f, 0.707106769f }, { 0x1693b511u } },
+	{ { 0.44757387f, 0.287638247f, 0.846724212f }, { 0x5b124ce5u } },
+	{ { 0.39467454f, 0.180241823f, 0.90096885f }, { 0x5cc170cau } },
+	{ { 0.365006238f, 0.234575257f, 0.90096885f }, { 0x1cc1e0bbu } },
+	{ { 0.300432414f, 0.137202874f, 0.943883359f }, { 0x1e21189au } },
+	{ { 0.277848423f, 0.178562343f, 0.943883359f }, { 0x5e216c8eu } },
+	{ { 0.202412158f, 0.0924385339f, 0.974927902f }, { 0x5f20bc67u } },
+	{ { 0.187196523f, 0.120303899f, 0.974927902f }, { 0x1f20f460u } },
+	{ { 0.327907443f, 0.284133434f, 0.90096885f }, { 0x5cc244a8u } },
+	{ { 0.249608263f, 0.216286793f, 0.943883359f }, { 0x1e21bc80u } },
+	{ { 0.168170094f, 0.145720229f, 0.974927902f }, { 0x5f212856u } },
+	{ { 0.216286793f, 0.249608263f, 0.943883359f }, { 0x5e22006fu } },
+	{ { 0.145720229f, 0.168170094f, 0.974927902f }, { 0x1f21584au } },
+	{ { 0.284133434f, 0.327907443f, 0.90096885f }, { 0x1cc2a091u } },
+	{ { 0.178562343f, 0.277848423f, 0.943883359f }, { 0x1e22385bu } },
+	{ { 0.120303899f, 0.187196523f, 0.974927902f }, { 0x5f21803du } },
+	{ { 0.234575257f, 0.365006238f, 0.90096885f }, { 0x5cc2ec78u } },
+	{ { 0.137202874f, 0.300432414f, 0.943883359f }, { 0x5e226846u } },
+	{ { 0.0924385339f, 0.202412158f, 0.974927902f }, { 0x1f219c2fu } },
+	{ { 0.180241823f, 0.39467454f, 0.90096885f }, { 0x1cc3285cu } },
+	{ { 0.122239172f, 0.416308403f, 0.90096885f }, { 0x5cc3543eu } },
+	{ { 0.0930503681f, 0.316900432f, 0.943883359f }, { 0x1e228830u } },
+	{ { 0.0626913905f, 0.21350728f, 0.974927902f }, { 0x5f21b420u } },
+	{ { 0.0470036119f, 0.326917291f, 0.943883359f }, { 0x5e229c18u } },
+	{ { 0.0316680297f, 0.220255986f, 0.974927902f }, { 0x1f21c410u } },
+	{ { 0.0617480949f, 0.42946744f, 0.90096885f }, { 0x1cc36c20u } },
+	{ { 7.2215488e-17f, 0.330279052f, 0.943883359f }, { 0x1e22a400u } },
+	{ { 4.86541846e-17f, 0.222520933f, 0.974927902f }, { 0x5f21c800u } },
+	{ { 9.4868643e-17f, 0.433883727f, 0.90096885f }, { 0x5cc37800u } },
+	{ { -0.0617480949f, 0.42946744f, 0.90096885f }, { 0x1cc36fe0u } },
+	{ { -0.0470036119f, 0.326917291f, 0.943883359f }, { 0x5e229fe8u } },
+	{ { -0.0316680297f, 0.220255986f, 0.974927902f }, { 0x1f21c7f0u } },
+	{ { -0.0930503681f, 0.316900432f, 0.943883359f }, { 0x1e228bd0u } },
+	{ { -0.0626913905f, 0.21350728f, 0.974927902f }, { 0x5f21b7e0u } },
+	{ { -0.122239172f, 0.416308403f, 0.90096885f }, { 0x5cc357c2u } },
+	{ { -0.137202874f, 0.300432414f, 0.943883359f }, { 0x5e226bbau } },
+	{ { -0.0924385339f, 0.202412158f, 0.974927902f }, { 0x1f219fd1u } },
+	{ { -0.180241823f, 0.39467454f, 0.90096885f }, { 0x1cc32ba4u } },
+	{ { -0.234575257f, 0.365006238f, 0.90096885f }, { 0x5cc2ef88u } },
+	{ { -0.178562343f, 0.277848423f, 0.943883359f }, { 0x1e223ba5u } },
+	{ { -0.120303899f, 0.187196523f, 0.974927902f }, { 0x5f2183c3u } },
+	{ { -0.216286793f, 0.249608263f, 0.943883359f }, { 0x5e220391u } },
+	{ { -0.145720229f, 0.168170094f, 0.974927902f }, { 0x1f215bb6u } },
+	{ { -0.284133434f, 0.327907443f, 0.90096885f }, { 0x1cc2a36fu } },
+	{ { -0.249608263f, 0.216286793f, 0.943883359f }, { 0x1e21bf80u } },
+	{ { -0.168170094f, 0.145720229f, 0.974927902f }, { 0x5f212baau } },
+	{ { -0.327907443f, 0.284133434f, 0.90096885f }, { 0x5cc24758u } },
+	{ { 0.141419992f, -0.983597636f, 0.111964479f }, { 0x43982448u } },
+	{ { 0.281732559f, -0.959492981f, 2.18649922e-16f }, { 0x40085890u } },
+	{ { 0.142314836f, -0.989821434f, 2.18649922e-16f }, { 0x00081849u } },
+	{ { 0.279961079f, -0.953459859f, 0.111964479f }, { 0x0398648fu } },
+	{ { 0.0f, -0.993712187f, 0.111964479f }, { 0x03981000u } },
+	{ { 0.0f, -1.0f, 2.18649922e-16f }, { 0x40080400u } },
+	{ { 0.138746709f, -0.965004563f, 0.222520933f }, { 0x07284c47u } },
+	{ { 0.274668932f, -0.935436487f, 0.222520933f }, { 0x4728888cu } },
+	{ { 0.0f, -0.974927902f, 0.222520933f }, { 0x47283800u } },
+	{ { 0.134328604f, -0.934275985f, 0.330279052f }, { 0x4a988c45u } },
+	{ { 0.265922666f, -0.905649424f, 0.330279052f }, { 0x0a98c488u } },
+	{ { 0.0f, -0.943883359f, 0.330279052f }, { 0x0a987800u } },
+	{ { 0.128221244f, -0.891798317f, 0.433883727f }, { 0x0de8e042u } },
+	{ { 0.253832251f, -0.864473283f, 0.433883727f }, { 0x4de91882u } },
+	{ { 0.120501414f, -0.838105738f, 0.532032073f }, { 0x5109503eu } },
+	{ { 0.0f, -0.90096885f, 0.433883727f }, { 0x4de8d000u } },
+	{ { 0.0f, -0.846724212f, 0.532032073f }, { 0x11093c00u } },
+	{ { 0.0f, -0.781831503f, 0.623489797f }, { 0x53f9c000u } },
+	{ { -0.111266218f, -0.773873568f, 0.623489797f }, { 0x13f9d7c7u } },
+	{ { -0.120501414f, -0.838105738f, 0.532032073f }, { 0x510953c2u } },
+	{ { -0.220267385f, -0.750161827f, 0.623489797f }, { 0x53fa078fu } },
+	{ { -0.128221244f, -0.891798317f, 0.433883727f }, { 0x0de8e3beu } },
+	{ { -0.238549769f, -0.812425911f, 0.532032073f }, { 0x11098786u } },
+	{ { -0.324784547f, -0.711178958f, 0.623489797f }, { 0x13fa575au } },
+	{ { -0.134328604f, -0.934275985f, 0.330279052f }, { 0x4a988fbbu } },
+	{ { -0.253832251f, -0.864473283f, 0.433883727f }, { 0x4de91b7eu } },
+	{ { -0.35174194f, -0.770207405f, 0.532032073f }, { 0x5109db4cu } },
+	{ { -0.422690004f, -0.65771848f, 0.623489797f }, { 0x53fac328u } },
+	{ { -0.138746709f, -0.965004563f, 0.222520933f }, { 0x07284fb9u } },
+	{ { -0.457773656f, -0.712309718f, 0.532032073f }, { 0x110a5316u } },
+	{ { -0.511990726f, -0.590868831f, 0.623489797f }, { 0x13fb4afau } },
+	{ { -0.374275982f, -0.819550097f, 0.433883727f }, { 0x0de97741u } },
+	{ { -0.265922666f, -0.905649424f, 0.330279052f }, { 0x0a98c778u } },
+	{ { -0.554486454f, -0.639911473f, 0.532032073f }, { 0x510ae6e5u } },
+	{ { -0.590868831f, -0.511990726f, 0.623489797f }, { 0x53fbead2u } },
+	{ { -0.487100542f, -0.757943273f, 0.433883727f }, { 0x4de9f707u } },
+	{ { -0.392103314f, -0.85858649f, 0.330279052f }, { 0x4a992738u } },
+	{ { -0.639911473f, -0.554486454f, 0.532032073f }, { 0x110b96b9u } },
+	{ { -0.65771848f, -0.422690004f, 0.623489797f }, { 0x13fca2b0u } },
+	{ { -0.590009153f, -0.680906832f, 0.433883727f }, { 0x0dea92d3u } },
+	{ { -0.712309718f, -0.457773656f, 0.532032073f }, { 0x510c5a94u } },
+	{ { -0.711178958f, -0.324784547f, 0.623489797f }, { 0x53fd6a95u } },
+	{ { -0.680906832f, -0.590009153f, 0.433883727f }, { 0x4deb4ea4u } },
+	{ { -0.510301828f, -0.79404521f, 0.330279052f }, { 0x0a99aafbu } },
+	{ { -0.770207405f, -0.35174194f, 0.532032073f }, { 0x110d3276u } },
+	{ { -0.750161827f, -0.220267385f, 0.623489797f }, { 0x13fe3e81u } },
+	{ { -0.757943273f, -0.487100542f, 0.433883727f }, { 0x0dec1e7du } },
+	{ { -0.812425911f, -0.238549769f, 0.532032073f }, { 0x510e1a61u } },
+	{ { -0.773873568f, -0.111266218f, 0.623489797f }, { 0x53ff1e75u } },
+	{ { -0.819550097f, -0.374275982f, 0.433883727f }, { 0x4ded065du } },
+	{ { -0.838105738f, -0.120501414f, 0.532032073f }, { 0x110f0a54u } },
+	{ { -0.781831503f, 1.70947395e-16f, 0.623489797f }, { 0x13f00270u } },
+	{ { -0.864473283f, -0.253832251f, 0.433883727f }, { 0x0dedfa46u } },
+	{ { -0.846724212f, 1.85136177e-16f, 0.532032073f }, { 0x5100024fu } },
+	{ { -0.773873568f, 0.111266218f, 0.623489797f }, { 0x53f0e675u } },
+	{ { -0.891798317f, -0.128221244f, 0.433883727f }, { 0x4deefa38u } },
+	{ { -0.838105738f, 0.120501414f, 0.532032073f }, { 0x1100fa54u } },
+	{ { -0.750161827f, 0.220267385f, 0.623489797f }, { 0x13f1c681u } },
+	{ { -0.90096885f, 1.96996769e-16f, 0.433883727f }, { 0x0de00234u } },
+	{ { -0.812425911f, 0.238549769f, 0.532032073f }, { 0x5101ea61u } },
+	{ { -0.711178958f, 0.324784547f, 0.623489797f }, { 0x53f29a95u } },
+	{ { -0.891798317f, 0.128221244f, 0.433883727f }, { 0x4de10a38u } },
+	{ { -0.770207405f, 0.35174194f, 0.532032073f }, { 0x1102d276u } },
+	{ { -0.864473283f, 0.253832251f, 0.433883727f }, { 0x0de20a46u } },
+	{ { -0.712309718f, 0.457773656f, 0.532032073f }, { 0x5103aa94u } },
+	{ { -0.819550097f, 0.374275982f, 0.433883727f }, { 0x4de2fe5du } },
+	{ { -0.639911473f, 0.554486454f, 0.532032073f }, { 0x11046eb9u } },
+	{ { -0.757943273f, 0.487100542f, 0.433883727f }, { 0x0de3e67du } },
+	{ { -0.554486454f, 0.639911473f, 0.532032073f }, { 0x51051ee5u } },
+	{ { -0.680906832f, 0.590009153f, 0.433883727f }, { 0x4de4b6a4u } },
+	{ { -0.457773656f, 0.712309718f, 0.532032073f }, { 0x1105b316u } },
+	{ { -0.590009153f, 0.680906832f, 0.433883727f }, { 0x0de572d3u } },
+	{ { -0.35174194f, 0.770207405f, 0.532032073f }, { 0x51062b4cu } },
+	{ { -0.487100542f, 0.757943273f, 0.433883727f }, { 0x4de60f07u } },
+	{ { -0.238549769f, 0.812425911f, 0.532032073f }, { 0x11067f86u } },
+	{ { -0.374275982f, 0.819550097f, 0.433883727f }, { 0x0de68f41u } },
+	{ { -0.120501414f, 0.838105738f, 0.532032073f }, { 0x5106b3c2u } },
+	{ { -0.253832251f, 0.864473283f, 0.433883727f }, { 0x4de6eb7eu } },
+	{ { 1.85136177e-16f, 0.846724212f, 0.532032073f }, { 0x1106c400u } },
+	{ { -0.128221244f, 0.891798317f, 0.433883727f }, { 0x0de723beu } },
+	{ { 0.120501414f, 0.838105738f, 0.532032073f }, { 0x5106b03eu } },
+	{ { 1.96996769e-16f, 0.90096885f, 0.433883727f }, { 0x4de73000u } },
+	{ { 0.128221244f, 0.891798317f, 0.433883727f }, { 0x0de72042u } },
+	{ { -0.134328604f, 0.934275985f, 0.330279052f }, { 0x4a9777bbu } },
+	{ { 0.134328604f, 0.934275985f, 0.330279052f }, { 0x4a977445u } },
+	{ { 2.06380014e-16f, 0.943883359f, 0.330279052f }, { 0x0a978800u } },
+	{ { 0.138746709f, 0.965004563f, 0.222520933f }, { 0x0727b447u } },
+	{ { 2.13167911e-16f, 0.974927902f, 0.222520933f }, { 0x4727c800u } },
+	{ { 0.141419992f, 0.983597636f, 0.111964479f }, { 0x4397dc48u } },
+	{ { 2.17275095e-16f, 0.993712187f, 0.111964479f }, { 0x0397f000u } },
+	{ { -0.138746709f, 0.965004563f, 0.222520933f }, { 0x0727b7b9u } },
+	{ { -0.141419992f, 0.983597636f, 0.111964479f }, { 0x4397dfb8u } },
+	{ { 2.18649922e-16f, 1.0f, 2.18649922e-16f }, { 0x4007fc00u } },
+	{ { 0.142314836f, 0.989821434f, 2.18649922e-16f }, { 0x0007e849u } },
+	{ { -0.142314836f, 0.989821434f, 2.18649922e-16f }, { 0x0007ebb7u } },
+	{ { 0.141419992f, 0.983597636f, -0.111964479f }, { 0x7c77dc48u } },
+	{ { 2.17275095e-16f, 0.993712187f, -0.111964479f }, { 0x3c77f000u } },
+	{ { 0.138746709f, 0.965004563f, -0.222520933f }, { 0x38e7b447u } },
+	{ { 2.13167911e-16f, 0.974927902f, -0.222520933f }, { 0x78e7c800u } },
+	{ { 2.06380014e-16f, 0.943883359f, -0.330279052f }, { 0x35778800u } },
+	{ { -0.134328604f, 0.934275985f, -0.330279052f }, { 0x757777bbu } },
+	{ { -0.138746709f, 0.965004563f, -0.222520933f }, { 0x38e7b7b9u } },
+	{ { -0.265922666f, 0.905649424f, -0.330279052f }, { 0x35773f78u } },
+	{ { -0.141419992f, 0.983597636f, -0.111964479f }, { 0x7c77dfb8u } },
+	{ { -0.274668932f, 0.935436487f, -0.222520933f }, { 0x78e77b74u } },
+	{ { -0.392103314f, 0.85858649f, -0.330279052f }, { 0x7576df38u } },
+	{ { -0.279961079f, 0.953459859f, -0.111964479f }, { 0x3c779f71u } },
+	{ { -0.265922666f, -0.905649424f, -0.330279052f }, { 0x3578c778u } },
+	{ { -0.134328604f, -0.934275985f, -0.330279052f }, { 0x75788fbbu } },
+	{ { 0.0f, -0.943883359f, -0.330279052f }, { 0x35787800u } },
+	{ { -0.404999703f, -0.886825621f, -0.222520933f }, { 0x38e8ef31u } },
+	{ { -0.274668932f, -0.935436487f, -0.222520933f }, { 0x78e88b74u } },
+	{ { -0.138746709f, -0.965004563f, -0.222520933f }, { 0x38e84fb9u } },
+	{ { 0.0f, -0.974927902f, -0.222520933f }, { 0x78e83800u } },
+	{ { -0.412802964f, -0.903912425f, -0.111964479f }, { 0x7c78cb2du } },
+	{ { -0.537241399f, -0.835963905f, -0.111964479f }, { 0x3c7956edu } },
+	{ { -0.279961079f, -0.953459859f, -0.111964479f }, { 0x3c786771u } },
+	{ { -0.141419992f, -0.983597636f, -0.111964479f }, { 0x7c7827b8u } },
+	{ { 0.0f, -0.993712187f, -0.111964479f }, { 0x3c781000u } },
+	{ { -0.415415019f, -0.909631968f, 2.18649922e-16f }, { 0x0008bf2cu } },
+	{ { -0.142314836f, -0.989821434f, 2.18649922e-16f }, { 0x00081bb7u } },
+	{ { -0.281732559f, -0.959492981f, 2.18649922e-16f }, { 0x40085b70u } },
+	{ { -0.141419992f, -0.983597636f, 0.111964479f }, { 0x439827b8u } },
+	{ { -0.279961079f, -0.953459859f, 0.111964479f }, { 0x03986771u } },
+	{ { -0.274668932f, -0.935436487f, 0.222520933f }, { 0x47288b74u } },
+	{ { -0.404999703f, -0.886825621f, 0.222520933f }, { 0x0728ef31u } },
+	{ { -0.412802964f, -0.903912425f, 0.111964479f }, { 0x4398cb2du } },
+	{ { -0.527085841f, -0.820161521f, 0.222520933f }, { 0x472976f3u } },
+	{ { -0.537241399f, -0.835963905f, 0.111964479f }, { 0x039956edu } },
+	{ { -0.618112147f, -0.713339448f, 0.330279052f }, { 0x4a9a4ec4u } },
+	{ { -0.63844198f, -0.736801326f, 0.222520933f }, { 0x072a1ebau } },
+	{ { -0.713339448f, -0.618112147f, 0.330279052f }, { 0x0a9b1293u } },
+	{ { -0.650743127f, -0.750997603f, 0.111964479f }, { 0x439a02b3u } },
+	{ { -0.79404521f, -0.510301828f, 0.330279052f }, { 0x4a9bee6au } },
+	{ { -0.736801326f, -0.63844198f, 0.222520933f }, { 0x472aea87u } },
+	{ { -0.85858649f, -0.392103314f, 0.330279052f }, { 0x0a9ce249u } },
+	{ { -0.820161521f, -0.527085841f, 0.222520933f }, { 0x072bce5du } },
+	{ { -0.905649424f, -0.265922666f, 0.330279052f }, { 0x4a9de231u } },
+	{ { -0.886825621f, -0.404999703f, 0.222520933f }, { 0x472cc63bu } },
+	{ { -0.750997603f, -0.650743127f, 0.111964479f }, { 0x039ace80u } },
+	{ { -0.934275985f, -0.134328604f, 0.330279052f }, { 0x0a9eee23u } },
+	{ { -0.935436487f, -0.274668932f, 0.222520933f }, { 0x072dd222u } },
+	{ { -0.943883359f, 2.06380014e-16f, 0.330279052f }, { 0x4a90021eu } },
+	{ { -0.965004563f, -0.138746709f, 0.222520933f }, { 0x472ee613u } },
+	{ { -0.934275985f, 0.134328604f, 0.330279052f }, { 0x0a911623u } },
+	{ { -0.974927902f, 2.13167911e-16f, 0.222520933f }, { 0x0720020eu } },
+	{ { -0.905649424f, 0.265922666f, 0.330279052f }, { 0x4a922231u } },
+	{ { -0.965004563f, 0.138746709f, 0.222520933f }, { 0x47211e13u } },
+	{ { -0.85858649f, 0.392103314f, 0.330279052f }, { 0x0a932249u } },
+	{ { -0.935436487f, 0.274668932f, 0.222520933f }, { 0x07223222u } },
+	{ { -0.79404521f, 0.510301828f, 0.330279052f }, { 0x4a94166au } },
+	{ { -0.886825621f, 0.404999703f, 0.222520933f }, { 0x47233e3bu } },
+	{ { -0.713339448f, 0.618112147f, 0.330279052f }, { 0x0a94f293u } },
+	{ { -0.820161521f, 0.527085841f, 0.222520933f }, { 0x0724365du } },
+	{ { -0.618112147f, 0.713339448f, 0.330279052f }, { 0x4a95b6c4u } },
+	{ { -0.736801326f, 0.63844198f, 0.222520933f }, { 0x47251a87u } },
+	{ { -0.510301828f, 0.79404521f, 0.330279052f }, { 0x0a965afbu } },
+	{ { -0.63844198f, 0.736801326f, 0.222520933f }, { 0x0725e6bau } },
+	{ { -0.392103314f, 0.85858649f, 0.330279052f }, { 0x4a96df38u } },
+	{ { -0.527085841f, 0.820161521f, 0.222520933f }, { 0x47268ef3u } },
+	{ { -0.265922666f, 0.905649424f, 0.330279052f }, { 0x0a973f78u } },
+	{ { -0.404999703f, 0.886825621f, 0.222520933f }, { 0x07271731u } },
+	{ { -0.274668932f, 0.935436487f, 0.222520933f }, { 0x47277b74u } },
+	{ { -0.537241399f, 0.835963905f, 0.111964479f }, { 0x0396aeedu } },
+	{ { -0.279961079f, 0.953459859f, 0.111964479f }, { 0x03979f71u } },
+	{ { -0.281732559f, 0.959492981f, 2.18649922e-16f }, { 0x4007ab70u } },
+	{ { -0.412802964f, 0.903912425f, 0.111964479f }, { 0x43973b2du } },
+	{ { -0.415415019f, 0.909631968f, 2.18649922e-16f }, { 0x0007472cu } },
+	{ { -0.412802964f, 0.903912425f, -0.111964479f }, { 0x7c773b2du } },
+	{ { -0.537241399f, 0.835963905f, -0.111964479f }, { 0x3c76aeedu } },
+	{ { -0.540640831f, 0.841253519f, 2.18649922e-16f }, { 0x4006baecu } },
+	{ { -0.650743127f, 0.750997603f, -0.111964479f }, { 0x7c7602b3u } },
+	{ { -0.654860735f, 0.755749583f, 2.18649922e-16f }, { 0x00060ab1u } },
+	{ { -0.750997603f, 0.650743127f, -0.111964479f }, { 0x3c753680u } },
+	{ { -0.650743127f, 0.750997603f, 0.111964479f }, { 0x439602b3u } },
+	{ { -0.755749583f, 0.654860735f, 2.18649922e-16f }, { 0x40053e7eu } },
+	{ { -0.835963905f, 0.537241399f, -0.111964479f }, { 0x7c744e55u } },
+	{ { -0.750997603f, 0.650743127f, 0.111964479f }, { 0x03953680u } },
+	{ { -0.841253519f, 0.540640831f, 2.18649922e-16f }, { 0x00045252u } },
+	{ { 0.0f, -0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { 0.101846471f, -0.0465117246f, 0.993712187f }, { 0x1fcfa034u } },
+	{ { 0.0941905081f, -0.0605325662f, 0.993712187f }, { 0x5fcf8430u } },
+	{ { 0.202412158f, -0.0924385339f, 0.974927902f }, { 0x5f2f4467u } },
+	{ { 0.0f, -0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { 0.187196523f, -0.120303899f, 0.974927902f }, { 0x1f2f0c60u } },
+	{ { 0.300432414f, -0.137202874f, 0.943883359f }, { 0x1e2ee89au } },
+	{ { 0.0846171081f, -0.0733211413f, 0.993712187f }, { 0x1fcf6c2bu } },
+	{ { 0.0f, -0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { 0.277848423f, -0.178562343f, 0.943883359f }, { 0x5e2e948eu } },
+	{ { 0.39467454f, -0.180241823f, 0.90096885f }, { 0x5cce90cau } },
+	{ { 0.168170094f, -0.145720229f, 0.974927902f }, { 0x5f2ed856u } },
+	{ { 0.0733211413f, -0.0846171081f, 0.993712187f }, { 0x5fcf5425u } },
+	{ { 0.0f, -0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { 0.365006238f, -0.234575257f, 0.90096885f }, { 0x1cce20bbu } },
+	{ { 0.483953387f, -0.221014112f, 0.846724212f }, { 0x1b1e3cf7u } },
+	{ { 0.0605325662f, -0.0941905081f, 0.993712187f }, { 0x1fcf401fu } },
+	{ { 0.0f, -0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { 0.145720229f, -0.168170094f, 0.974927902f }, { 0x1f2ea84au } },
+	{ { 0.249608263f, -0.216286793f, 0.943883359f }, { 0x1e2e4480u } },
+	{ { 0.0465117246f, -0.101846471f, 0.993712187f }, { 0x5fcf3018u } },
+	{ { 0.0f, -0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { 0.120303899f, -0.187196523f, 0.974927902f }, { 0x5f2e803du } },
+	{ { 0.216286793f, -0.249608263f, 0.943883359f }, { 0x5e2e006fu } },
+	{ { 0.0315440372f, -0.107429124f, 0.993712187f }, { 0x1fcf2410u } },
+	{ { 0.0f, -0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { 0.0924385339f, -0.202412158f, 0.974927902f }, { 0x1f2e642fu } },
+	{ { 0.0159342065f, -0.110824838f, 0.993712187f }, { 0x5fcf1c08u } },
+	{ { 0.0f, -0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { 0.0626913905f, -0.21350728f, 0.974927902f }, { 0x5f2e4c20u } },
+	{ { 0.178562343f, -0.277848423f, 0.943883359f }, { 0x1e2dc85bu } },
+	{ { 0.0f, -0.111964479f, 0.993712187f }, { 0x1fcf1c00u } },
+	{ { -0.0f, -0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { 0.0316680297f, -0.220255986f, 0.974927902f }, { 0x1f2e3c10u } },
+	{ { -0.0159342065f, -0.110824838f, 0.993712187f }, { 0x5fcf1ff8u } },
+	{ { -0.0f, -0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { 0.0f, -0.222520933f, 0.974927902f }, { 0x5f2e3800u } },
+	{ { -0.0315440372f, -0.107429124f, 0.993712187f }, { 0x1fcf27f0u } },
+	{ { -0.0f, -0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { -0.0316680297f, -0.220255986f, 0.974927902f }, { 0x1f2e3ff0u } },
+	{ { -0.0465117246f, -0.101846471f, 0.993712187f }, { 0x5fcf33e8u } },
+	{ { -0.0f, -0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { -0.0626913905f, -0.21350728f, 0.974927902f }, { 0x5f2e4fe0u } },
+	{ { -0.0605325662f, -0.0941905081f, 0.993712187f }, { 0x1fcf43e1u } },
+	{ { -0.0f, -0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { -0.0924385339f, -0.202412158f, 0.974927902f }, { 0x1f2e67d1u } },
+	{ { -0.0733211413f, -0.0846171081f, 0.993712187f }, { 0x5fcf57dbu } },
+	{ { -0.0f, -0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { -0.120303899f, -0.187196523f, 0.974927902f }, { 0x5f2e83c3u } },
+	{ { -0.0846171081f, -0.0733211413f, 0.993712187f }, { 0x1fcf6fd5u } },
+	{ { -0.0f, -0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { -0.145720229f, -0.168170094f, 0.974927902f }, { 0x1f2eabb6u } },
+	{ { -0.0941905081f, -0.0605325662f, 0.993712187f }, { 0x5fcf87d0u } },
+	{ { -0.0f, -0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { -0.168170094f, -0.145720229f, 0.974927902f }, { 0x5f2edbaau } },
+	{ { -0.101846471f, -0.0465117246f, 0.993712187f }, { 0x1fcfa3ccu } },
+	{ { -0.0f, -0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { -0.187196523f, -0.120303899f, 0.974927902f }, { 0x1f2f0fa0u } },
+	{ { -0.107429124f, -0.0315440372f, 0.993712187f }, { 0x5fcfc3c9u } },
+	{ { -0.0f, -0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { -0.202412158f, -0.0924385339f, 0.974927902f }, { 0x5f2f4799u } },
+	{ { -0.110824838f, -0.0159342065f, 0.993712187f }, { 0x1fcfe3c7u } },
+	{ { -0.0f, 0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { -0.21350728f, -0.0626913905f, 0.974927902f }, { 0x1f2f8393u } },
+	{ { -0.111964479f, 2.4481024e-17f, 0.993712187f }, { 0x5fc003c7u } },
+	{ { -0.0f, 0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { -0.220255986f, -0.0316680297f, 0.974927902f }, { 0x5f2fc38fu } },
+	{ { -0.110824838f, 0.0159342065f, 0.993712187f }, { 0x1fc023c7u } },
+	{ { -0.0f, 0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { -0.222520933f, 4.86541846e-17f, 0.974927902f }, { 0x1f20038eu } },
+	{ { -0.107429124f, 0.0315440372f, 0.993712187f }, { 0x5fc043c9u } },
+	{ { -0.0f, 0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { -0.220255986f, 0.0316680297f, 0.974927902f }, { 0x5f20438fu } },
+	{ { -0.101846471f, 0.0465117246f, 0.993712187f }, { 0x1fc063ccu } },
+	{ { -0.0f, 0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { -0.21350728f, 0.0626913905f, 0.974927902f }, { 0x1f208393u } },
+	{ { -0.0941905081f, 0.0605325662f, 0.993712187f }, { 0x5fc07fd0u } },
+	{ { -0.0f, 0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { -0.202412158f, 0.0924385339f, 0.974927902f }, { 0x5f20bf99u } },
+	{ { -0.0846171081f, 0.0733211413f, 0.993712187f }, { 0x1fc097d5u } },
+	{ { -0.0f, 0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { -0.187196523f, 0.120303899f, 0.974927902f }, { 0x1f20f7a0u } },
+	{ { -0.0733211413f, 0.0846171081f, 0.993712187f }, { 0x5fc0afdbu } },
+	{ { -0.0f, 0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { -0.0605325662f, 0.0941905081f, 0.993712187f }, { 0x1fc0c3e1u } },
+	{ { -0.0f, 0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { -0.0465117246f, 0.101846471f, 0.993712187f }, { 0x5fc0d3e8u } },
+	{ { -0.0f, 0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { -0.0315440372f, 0.107429124f, 0.993712187f }, { 0x1fc0dff0u } },
+	{ { -0.0f, 0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { -0.0159342065f, 0.110824838f, 0.993712187f }, { 0x5fc0e7f8u } },
+	{ { 0.0f, 0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { 2.4481024e-17f, 0.111964479f, 0.993712187f }, { 0x1fc0e400u } },
+	{ { 0.0f, 0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { 0.0159342065f, 0.110824838f, 0.993712187f }, { 0x5fc0e408u } },
+	{ { 0.0f, 0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { 0.0315440372f, 0.107429124f, 0.993712187f }, { 0x1fc0dc10u } },
+	{ { 0.0f, 0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { 0.0465117246f, 0.101846471f, 0.993712187f }, { 0x5fc0d018u } },
+	{ { 0.0f, 0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { 0.0605325662f, 0.0941905081f, 0.993712187f }, { 0x1fc0c01fu } },
+	{ { 0.0f, 0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { 0.0733211413f, 0.0846171081f, 0.993712187f }, { 0x5fc0ac25u } },
+	{ { 0.0f, 0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { 0.0846171081f, 0.0733211413f, 0.993712187f }, { 0x1fc0942bu } },
+	{ { 0.0f, 0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { 0.0941905081f, 0.0605325662f, 0.993712187f }, { 0x5fc07c30u } },
+	{ { 0.0f, 0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { 0.101846471f, 0.0465117246f, 0.993712187f }, { 0x1fc06034u } },
+	{ { 0.0f, 0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { 0.107429124f, 0.0315440372f, 0.993712187f }, { 0x5fc04037u } },
+	{ { 0.0f, 0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { 0.110824838f, 0.0159342065f, 0.993712187f }, { 0x1fc02039u } },
+	{ { 0.0f, 0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { 0.111964479f, 0.0f, 0.993712187f }, { 0x5fc00039u } },
+	{ { 0.21350728f, 0.0626913905f, 0.974927902f }, { 0x1f20806du } },
+	{ { 0.220255986f, 0.0316680297f, 0.974927902f }, { 0x5f204071u } },
+	{ { 0.222520933f, 0.0f, 0.974927902f }, { 0x1f200072u } },
+	{ { 0.326917291f, 0.0470036119f, 0.943883359f }, { 0x1e2060a7u } },
+	{ { 0.330279052f, 0.0f, 0.943883359f }, { 0x5e2000a9u } },
+	{ { 0.316900432f, 0.0930503681f, 0.943883359f }, { 0x5e20c0a2u } },
+	{ { 0.42946744f, 0.0617480949f, 0.90096885f }, { 0x5cc080dbu } },
+	{ { 0.433883727f, 0.0f, 0.90096885f }, { 0x1cc000deu } },
+	{ { 0.416308403f, 0.122239172f, 0.90096885f }, { 0x1cc0f8d5u } },
+	{ { 0.526616752f, 0.0757160559f, 0.846724212f }, { 0x1b109d0du } },
+	{ { 0.532032073f, 0.0f, 0.846724212f }, { 0x5b100110u } },
+	{ { 0.51048106f, 0.149890751f, 0.846724212f }, { 0x5b113505u } },
+	{ { 0.598234057f, 0.175657377f, 0.781831503f }, { 0x19016932u } },
+	{ { 0.617143571f, 0.0887318477f, 0.781831503f }, { 0x5900b53bu } },
+	{ { 0.623489797f, 0.0f, 0.781831503f }, { 0x1900013fu } },
+	{ { 0.699909449f, 0.100631788f, 0.707106769f }, { 0x1690cd66u } },
+	{ { 0.707106769f, 0.0f, 0.707106769f }, { 0x56900169u } },
+	{ { 0.678463995f, 0.199214995f, 0.707106769f }, { 0x5691995bu } },
+	{ { 0.773873568f, 0.111266218f, 0.623489797f }, { 0x53f0e58bu } },
+	{ { 0.781831503f, 0.0f, 0.623489797f }, { 0x13f00190u } },
+	{ { 0.750161827f, 0.220267385f, 0.623489797f }, { 0x13f1c57fu } },
+	{ { 0.812425911f, 0.238549769f, 0.532032073f }, { 0x5101e99fu } },
+	{ { 0.838105738f, 0.120501414f, 0.532032073f }, { 0x1100f9acu } },
+	{ { 0.846724212f, 0.0f, 0.532032073f }, { 0x510001b1u } },
+	{ { 0.891798317f, 0.128221244f, 0.433883727f }, { 0x4de109c8u } },
+	{ { 0.90096885f, 0.0f, 0.433883727f }, { 0x0de001ccu } },
+	{ { 0.864473283f, 0.253832251f, 0.433883727f }, { 0x0de209bau } },
+	{ { 0.934275985f, 0.134328604f, 0.330279052f }, { 0x0a9115ddu } },
+	{ { 0.943883359f, 0.0f, 0.330279052f }, { 0x4a9001e2u } },
+	{ { 0.905649424f, 0.265922666f, 0.330279052f }, { 0x4a9221cfu } },
+	{ { 0.935436487f, 0.274668932f, 0.222520933f }, { 0x072231deu } },
+	{ { 0.965004563f, 0.138746709f, 0.222520933f }, { 0x47211dedu } },
+	{ { 0.974927902f, 0.0f, 0.222520933f }, { 0x072001f2u } },
+	{ { 0.983597636f, 0.141419992f, 0.111964479f }, { 0x039121f7u } },
+	{ { 0.993712187f, 0.0f, 0.111964479f }, { 0x439001fcu } },
+	{ { 0.953459859f, 0.279961079f, 0.111964479f }, { 0x43923de7u } },
+	{ { 0.989821434f, 0.142314836f, 2.18649922e-16f }, { 0x400125fau } },
+	{ { 1.0f, 0.0f, 2.18649922e-16f }, { 0x000001ffu } },
+	{ { 0.959492981f, 0.281732559f, 2.18649922e-16f }, { 0x000241eau } },
+	{ { 0.953459859f, 0.279961079f, -0.111964479f }, { 0x7c723de7u } },
+	{ { 0.983597636f, 0.141419992f, -0.111964479f }, { 0x3c7121f7u } },
+	{ { 0.993712187f, 0.0f, -0.111964479f }, { 0x7c7001fcu } },
+	{ { 0.965004563f, 0.138746709f, -0.222520933f }, { 0x78e11dedu } },
+	{ { 0.974927902f, 0.0f, -0.222520933f }, { 0x38e001f2u } },
+	{ { 0.935436487f, 0.274668932f, -0.222520933f }, { 0x38e231deu } },
+	{ { 0.934275985f, 0.134328604f, -0.330279052f }, { 0x357115ddu } },
+	{ { 0.943883359f, 0.0f, -0.330279052f }, { 0x757001e2u } },
+	{ { 0.905649424f, 0.265922666f, -0.330279052f }, { 0x757221cfu } },
+	{ { 0.864473283f, 0.253832251f, -0.433883727f }, { 0x322209bau } },
+	{ { 0.891798317f, 0.128221244f, -0.433883727f }, { 0x722109c8u } },
+	{ { 0.90096885f, 0.0f, -0.433883727f }, { 0x322001ccu } },
+	{ { 0.838105738f, 0.120501414f, -0.532032073f }, { 0x2f00f9acu } },
+	{ { 0.846724212f, 0.0f, -0.532032073f }, { 0x6f0001b1u } },
+	{ { 0.812425911f, 0.238549769f, -0.532032073f }, { 0x6f01e99fu } },
+	{ { 0.773873568f, 0.111266218f, -0.623489797f }, { 0x6c10e58bu } },
+	{ { 0.781831503f, 0.0f, -0.623489797f }, { 0x2c100190u } },
+	{ { 0.750161827f, 0.220267385f, -0.623489797f }, { 0x2c11c57fu } },
+	{ { 0.678463995f, 0.199214995f, -0.707106769f }, { 0x6971995bu } },
+	{ { 0.699909449f, 0.100631788f, -0.707106769f }, { 0x2970cd66u } },
+	{ { 0.707106769f, 0.0f, -0.707106769f }, { 0x69700169u } },
+	{ { 0.643206954f, 0.293742776f, -0.707106769f }, { 0x29725949u } },
+	{ { 0.617143571f, 0.0887318477f, -0.781831503f }, { 0x6700b53bu } },
+	{ { 0.623489797f, 0.0f, -0.781831503f }, { 0x2700013fu } },
+	{ { 0.598234057f, 0.175657377f, -0.781831503f }, { 0x27016932u } },
+	{ { 0.526616752f, 0.0757160559f, -0.846724212f }, { 0x24f09d0du } },
+	{ { 0.532032073f, 0.0f, -0.846724212f }, { 0x64f00110u } },
+	{ { 0.42946744f, 0.0617480949f, -0.90096885f }, { 0x634080dbu } },
+	{ { 0.51048106f, 0.149890751f, -0.846724212f }, { 0x64f13505u } },
+	{ { 0.416308403f, 0.122239172f, -0.90096885f }, { 0x2340f8d5u } },
+	{ { 0.316900432f, 0.0930503681f, -0.943883359f }, { 0x61e0c0a2u } },
+	{ { 0.300432414f, 0.137202874f, -0.943883359f }, { 0x21e1189au } },
+	{ { 0.39467454f, 0.180241823f, -0.90096885f }, { 0x634170cau } },
+	{ { 0.277848423f, 0.178562343f, -0.943883359f }, { 0x61e16c8eu } },
+	{ { 0.483953387f, 0.221014112f, -0.846724212f }, { 0x24f1c4f7u } },
+	{ { 0.365006238f, 0.234575257f, -0.90096885f }, { 0x2341e0bbu } },
+	{ { 0.249608263f, 0.216286793f, -0.943883359f }, { 0x21e1bc80u } },
+	{ { 0.567146301f, 0.259007037f, -0.781831503f }, { 0x67021122u } },
+	{ { 0.44757387f, 0.287638247f, -0.846724212f }, { 0x64f24ce5u } },
+	{ { 0.327907443f, 0.284133434f, -0.90096885f }, { 0x634244a8u } },
+	{ { 0.216286793f, 0.249608263f, -0.943883359f }, { 0x61e2006fu } },
+	{ { 0.524513006f, 0.337084025f, -0.781831503f }, { 0x2702b10cu } },
+	{ { 0.402083009f, 0.348406911f, -0.846724212f }, { 0x24f2c8cdu } },
+	{ { 0.284133434f, 0.327907443f, -0.90096885f }, { 0x2342a091u } },
+	{ { -0.404999703f, 0.886825621f, -0.222520933f }, { 0x38e71731u } },
+	{ { -0.510301828f, 0.79404521f, -0.330279052f }, { 0x35765afbu } },
+	{ { -0.618112147f, 0.713339448f, -0.330279052f }, { 0x7575b6c4u } },
+	{ { -0.527085841f, 0.820161521f, -0.222520933f }, { 0x78e68ef3u } },
+	{ { -0.713339448f, 0.618112147f, -0.330279052f }, { 0x3574f293u } },
+	{ { -0.63844198f, 0.736801326f, -0.222520933f }, { 0x38e5e6bau } },
+	{ { -0.79404521f, 0.510301828f, -0.330279052f }, { 0x7574166au } },
+	{ { -0.736801326f, 0.63844198f, -0.222520933f }, { 0x78e51a87u } },
+	{ { -0.85858649f, 0.392103314f, -0.330279052f }, { 0x35732249u } },
+	{ { -0.820161521f, 0.527085841f, -0.222520933f }, { 0x38e4365du } },
+	{ { -0.905649424f, 0.265922666f, -0.330279052f }, { 0x75722231u } },
+	{ { -0.886825621f, 0.404999703f, -0.222520933f }, { 0x78e33e3bu } },
+	{ { -0.934275985f, 0.134328604f, -0.330279052f }, { 0x35711623u } },
+	{ { -0.935436487f, 0.274668932f, -0.222520933f }, { 0x38e23222u } },
+	{ { -0.903912425f, 0.412802964f, -0.111964479f }, { 0x3c734e32u } },
+	{ { -0.943883359f, 2.06380014e-16f, -0.330279052f }, { 0x7570021eu } },
+	{ { -0.965004563f, 0.138746709f, -0.222520933f }, { 0x78e11e13u } },
+	{ { -0.934275985f, -0.134328604f, -0.330279052f }, { 0x357eee23u } },
+	{ { -0.974927902f, 2.13167911e-16f, -0.222520933f }, { 0x38e0020eu } },
+	{ { -0.953459859f, 0.279961079f, -0.111964479f }, { 0x7c723e19u } },
+	{ { -0.983597636f, 0.141419992f, -0.111964479f }, { 0x3c712209u } },
+	{ { -0.905649424f, -0.265922666f, -0.330279052f }, { 0x757de231u } },
+	{ { -0.965004563f, -0.138746709f, -0.222520933f }, { 0x78eee613u } },
+	{ { -0.85858649f, -0.392103314f, -0.330279052f }, { 0x357ce249u } },
+	{ { -0.935436487f, -0.274668932f, -0.222520933f }, { 0x38edd222u } },
+	{ { -0.993712187f, 2.17275095e-16f, -0.111964479f }, { 0x7c700204u } },
+	{ { -0.983597636f, -0.141419992f, -0.111964479f }, { 0x3c7ee209u } },
+	{ { -0.79404521f, -0.510301828f, -0.330279052f }, { 0x757bee6au } },
+	{ { -0.886825621f, -0.404999703f, -0.222520933f }, { 0x78ecc63bu } },
+	{ { -0.713339448f, -0.618112147f, -0.330279052f }, { 0x357b1293u } },
+	{ { -0.820161521f, -0.527085841f, -0.222520933f }, { 0x38ebce5du } },
+	{ { -0.953459859f, -0.279961079f, -0.111964479f }, { 0x7c7dc619u } },
+	{ { -0.903912425f, -0.412802964f, -0.111964479f }, { 0x3c7cb632u } },
+	{ { -0.618112147f, -0.713339448f, -0.330279052f }, { 0x757a4ec4u } },
+	{ { -0.736801326f, -0.63844198f, -0.222520933f }, { 0x78eaea87u } },
+	{ { -0.510301828f, -0.79404521f, -0.330279052f }, { 0x3579aafbu } },
+	{ { -0.63844198f, -0.736801326f, -0.222520933f }, { 0x38ea1ebau } },
+	{ { -0.835963905f, -0.537241399f, -0.111964479f }, { 0x7c7bb655u } },
+	{ { -0.750997603f, -0.650743127f, -0.111964479f }, { 0x3c7ace80u } },
+	{ { -0.392103314f, -0.85858649f, -0.330279052f }, { 0x75792738u } },
+	{ { -0.527085841f, -0.820161521f, -0.222520933f }, { 0x78e976f3u } },
+	{ { -0.650743127f, -0.750997603f, -0.111964479f }, { 0x7c7a02b3u } },
+	{ { 0.712309718f, -0.457773656f, 0.532032073f }, { 0x510c596cu } },
+	{ { 0.770207405f, -0.35174194f, 0.532032073f }, { 0x110d318au } },
+	{ { 0.819550097f, -0.374275982f, 0.433883727f }, { 0x4ded05a3u } },
+	{ { 0.463056475f, -0.534395635f, 0.707106769f }, { 0x569bbcedu } },
+	{ { 0.590868831f, -0.511990726f, 0.623489797f }, { 0x53fbe92eu } },
+	{ { 0.511990726f, -0.590868831f, 0.623489797f }, { 0x13fb4906u } },
+	{ { 0.757943273f, -0.487100542f, 0.433883727f }, { 0x0dec1d83u } },
+	{ { 0.85858649f, -0.392103314f, 0.330279052f }, { 0x0a9ce1b7u } },
+	{ { 0.639911473f, -0.554486454f, 0.532032073f }, { 0x110b9547u } },
+	{ { 0.79404521f, -0.510301828f, 0.330279052f }, { 0x4a9bed96u } },
+	{ { 0.886825621f, -0.404999703f, 0.222520933f }, { 0x472cc5c5u } },
+	{ { 0.680906832f, -0.590009153f, 0.433883727f }, { 0x4deb4d5cu } },
+	{ { 0.554486454f, -0.639911473f, 0.532032073f }, { 0x510ae51bu } },
+	{ { 0.820161521f, -0.527085841f, 0.222520933f }, { 0x072bcda3u } },
+	{ { 0.903912425f, -0.412802964f, 0.111964479f }, { 0x039cb5ceu } },
+	{ { 0.713339448f, -0.618112147f, 0.330279052f }, { 0x0a9b116du } },
+	{ { 0.590009153f, -0.680906832f, 0.433883727f }, { 0x0dea912du } },
+	{ { 0.835963905f, -0.537241399f, 0.111964479f }, { 0x439bb5abu } },
+	{ { 0.909631968f, -0.415415019f, 2.18649922e-16f }, { 0x400cb1d1u } },
+	{ { 0.736801326f, -0.63844198f, 0.222520933f }, { 0x472ae979u } },
+	{ { 0.618112147f, -0.713339448f, 0.330279052f }, { 0x4a9a4d3cu } },
+	{ { 0.841253519f, -0.540640831f, 2.18649922e-16f }, { 0x000bb1aeu } },
+	{ { 0.903912425f, -0.412802964f, -0.111964479f }, { 0x3c7cb5ceu } },
+	{ { 0.750997603f, -0.650743127f, 0.111964479f }, { 0x039acd80u } },
+	{ { 0.63844198f, -0.736801326f, 0.222520933f }, { 0x072a1d46u } },
+	{ { 0.835963905f, -0.537241399f, -0.111964479f }, { 0x7c7bb5abu } },
+	{ { 0.886825621f, -0.404999703f, -0.222520933f }, { 0x78ecc5c5u } },
+	{ { 0.755749583f, -0.654860735f, 2.18649922e-16f }, { 0x400ac582u } },
+	{ { 0.650743127f, -0.750997603f, 0.111964479f }, { 0x439a014du } },
+	{ { 0.820161521f, -0.527085841f, -0.222520933f }, { 0x38ebcda3u } },
+	{ { 0.85858649f, -0.392103314f, -0.330279052f }, { 0x357ce1b7u } },
+	{ { 0.750997603f, -0.650743127f, -0.111964479f }, { 0x3c7acd80u } },
+	{ { 0.654860735f, -0.755749583f, 2.18649922e-16f }, { 0x0009f94fu } },
+	{ { 0.79404521f, -0.510301828f, -0.330279052f }, { 0x757bed96u } },
+	{ { 0.819550097f, -0.374275982f, -0.433883727f }, { 0x722d05a3u } },
+	{ { 0.736801326f, -0.63844198f, -0.222520933f }, { 0x78eae979u } },
+	{ { 0.650743127f, -0.750997603f, -0.111964479f }, { 0x7c7a014du } },
+	{ { 0.757943273f, -0.487100542f, -0.433883727f }, { 0x322c1d83u } },
+	{ { 0.770207405f, -0.35174194f, -0.532032073f }, { 0x2f0d318au } },
+	{ { 0.713339448f, -0.618112147f, -0.330279052f }, { 0x357b116du } },
+	{ { 0.63844198f, -0.736801326f, -0.222520933f }, { 0x38ea1d46u } },
+	{ { 0.712309718f, -0.457773656f, -0.532032073f }, { 0x6f0c596cu } },
+	{ { 0.711178958f, -0.324784547f, -0.623489797f }, { 0x6c1d696bu } },
+	{ { 0.680906832f, -0.590009153f, -0.433883727f }, { 0x722b4d5cu } },
+	{ { 0.618112147f, -0.713339448f, -0.330279052f }, { 0x757a4d3cu } },
+	{ { 0.65771848f, -0.422690004f, -0.623489797f }, { 0x2c1ca150u } },
+	{ { 0.643206954f, -0.293742776f, -0.707106769f }, { 0x297da949u } },
+	{ { 0.639911473f, -0.554486454f, -0.532032073f }, { 0x2f0b9547u } },
+	{ { 0.590009153f, -0.680906832f, -0.433883727f }, { 0x322a912du } },
+	{ { 0.594856083f, -0.382290781f, -0.707106769f }, { 0x697cf530u } },
+	{ { 0.567146301f, -0.259007037f, -0.781831503f }, { 0x670df122u } },
+	{ { 0.590868831f, -0.511990726f, -0.623489797f }, { 0x6c1be92eu } },
+	{ { 0.524513006f, -0.337084025f, -0.781831503f }, { 0x270d510cu } },
+	{ { 0.483953387f, -0.221014112f, -0.846724212f }, { 0x24fe3cf7u } },
+	{ { 0.534395635f, -0.463056475f, -0.707106769f }, { 0x297c4d11u } },
+	{ { 0.44757387f, -0.287638247f, -0.846724212f }, { 0x64fdb4e5u } },
+	{ { 0.39467454f, -0.180241823f, -0.90096885f }, { 0x634e90cau } },
+	{ { 0.471202165f, -0.408298999f, -0.781831503f }, { 0x670cbcf1u } },
+	{ { 0.365006238f, -0.234575257f, -0.90096885f }, { 0x234e20bbu } },
+	{ { 0.300432414f, -0.137202874f, -0.943883359f }, { 0x21eee89au } },
+	{ { 0.402083009f, -0.348406911f, -0.846724212f }, { 0x24fd38cdu } },
+	{ { 0.277848423f, -0.178562343f, -0.943883359f }, { 0x61ee948eu } },
+	{ { 0.202412158f, -0.0924385339f, -0.974927902f }, { 0x60ef4467u } },
+	{ { 0.187196523f, -0.120303899f, -0.974927902f }, { 0x20ef0c60u } },
+	{ { 0.249608263f, -0.216286793f, -0.943883359f }, { 0x21ee4480u } },
+	{ { 0.327907443f, -0.284133434f, -0.90096885f }, { 0x634dbca8u } },
+	{ { 0.284133434f, -0.327907443f, -0.90096885f }, { 0x234d6091u } },
+	{ { -0.835963905f, 0.537241399f, 0.111964479f }, { 0x43944e55u } },
+	{ { -0.909631968f, 0.415415019f, 2.18649922e-16f }, { 0x4003522fu } },
+	{ { -0.903912425f, 0.412802964f, 0.111964479f }, { 0x03934e32u } },
+	{ { -0.959492981f, 0.281732559f, 2.18649922e-16f }, { 0x00024216u } },
+	{ { -0.953459859f, 0.279961079f, 0.111964479f }, { 0x43923e19u } },
+	{ { -0.989821434f, 0.142314836f, 2.18649922e-16f }, { 0x40012606u } },
+	{ { -0.983597636f, 0.141419992f, 0.111964479f }, { 0x03912209u } },
+	{ { -1.0f, 2.18649922e-16f, 2.18649922e-16f }, { 0x00000201u } },
+	{ { -0.993712187f, 2.17275095e-16f, 0.111964479f }, { 0x43900204u } },
+	{ { -0.989821434f, -0.142314836f, 2.18649922e-16f }, { 0x400ede06u } },
+	{ { -0.983597636f, -0.141419992f, 0.111964479f }, { 0x039ee209u } },
+	{ { -0.959492981f, -0.281732559f, 2.18649922e-16f }, { 0x000dc216u } },
+	{ { -0.953459859f, -0.279961079f, 0.111964479f }, { 0x439dc619u } },
+	{ { -0.909631968f, -0.415415019f, 2.18649922e-16f }, { 0x400cb22fu } },
+	{ { -0.903912425f, -0.412802964f, 0.111964479f }, { 0x039cb632u } },
+	{ { -0.841253519f, -0.540640831f, 2.18649922e-16f }, { 0x000bb252u } },
+	{ { -0.835963905f, -0.537241399f, 0.111964479f }, { 0x439bb655u } },
+	{ { -0.755749583f, -0.654860735f, 2.18649922e-16f }, { 0x400ac67eu } },
+	{ { -0.654860735f, -0.755749583f, 2.18649922e-16f }, { 0x0009fab1u } },
+	{ { -0.540640831f, -0.841253519f, 2.18649922e-16f }, { 0x40094aecu } },
+	{ { 0.965004563f, -0.138746709f, -0.222520933f }, { 0x78eee5edu } },
+	{ { 0.943883359f, 0.0f, -0.330279052f }, { 0x757001e2u } },
+	{ { 0.934275985f, -0.134328604f, -0.330279052f }, { 0x357eedddu } },
+	{ { 0.974927902f, 0.0f, -0.222520933f }, { 0x38e001f2u } },
+	{ { 0.935436487f, -0.274668932f, -0.222520933f }, { 0x38edd1deu } },
+	{ { 0.905649424f, -0.265922666f, -0.330279052f }, { 0x757de1cfu } },
+	{ { 0.983597636f, -0.141419992f, -0.111964479f }, { 0x3c7ee1f7u } },
+	{ { 0.993712187f, 0.0f, -0.111964479f }, { 0x7c7001fcu } },
+	{ { 0.953459859f, -0.279961079f, -0.111964479f }, { 0x7c7dc5e7u } },
+	{ { 0.989821434f, -0.142314836f, 2.18649922e-16f }, { 0x400eddfau } },
+	{ { 1.0f, 0.0f, 2.18649922e-16f }, { 0x000001ffu } },
+	{ { 0.959492981f, -0.281732559f, 2.18649922e-16f }, { 0x000dc1eau } },
+	{ { 0.983597636f, -0.141419992f, 0.111964479f }, { 0x039ee1f7u } },
+	{ { 0.993712187f, 0.0f, 0.111964479f }, { 0x439001fcu } },
+	{ { 0.953459859f, -0.279961079f, 0.111964479f }, { 0x439dc5e7u } },
+	{ { 0.965004563f, -0.138746709f, 0.222520933f }, { 0x472ee5edu } },
+	{ { 0.974927902f, 0.0f, 0.222520933f }, { 0x072001f2u } },
+	{ { 0.935436487f, -0.274668932f, 0.222520933f }, { 0x072dd1deu } },
+	{ { 0.934275985f, -0.134328604f, 0.330279052f }, { 0x0a9eedddu } },
+	{ { 0.943883359f, 0.0f, 0.330279052f }, { 0x4a9001e2u } },
+	{ { 0.905649424f, -0.265922666f, 0.330279052f }, { 0x4a9de1cfu } },
+	{ { 0.891798317f, -0.128221244f, 0.433883727f }, { 0x4deef9c8u } },
+	{ { 0.90096885f, 0.0f, 0.433883727f }, { 0x0de001ccu } },
+	{ { 0.864473283f, -0.253832251f, 0.433883727f }, { 0x0dedf9bau } },
+	{ { 0.838105738f, -0.120501414f, 0.532032073f }, { 0x110f09acu } },
+	{ { 0.846724212f, 0.0f, 0.532032073f }, { 0x510001b1u } },
+	{ { 0.812425911f, -0.238549769f, 0.532032073f }, { 0x510e199fu } },
+	{ { 0.773873568f, -0.111266218f, 0.623489797f }, { 0x53ff1d8bu } },
+	{ { 0.781831503f, 0.0f, 0.623489797f }, { 0x13f00190u } },
+	{ { 0.750161827f, -0.220267385f, 0.623489797f }, { 0x13fe3d7fu } },
+	{ { 0.699909449f, -0.100631788f, 0.707106769f }, { 0x169f3566u } },
+	{ { 0.707106769f, 0.0f, 0.707106769f }, { 0x56900169u } },
+	{ { 0.678463995f, -0.199214995f, 0.707106769f }, { 0x569e695bu } },
+	{ { 0.711178958f, -0.324784547f, 0.623489797f }, { 0x53fd696bu } },
+	{ { 0.643206954f, -0.293742776f, 0.707106769f }, { 0x169da949u } },
+	{ { 0.617143571f, -0.0887318477f, 0.781831503f }, { 0x590f4d3bu } },
+	{ { 0.623489797f, 0.0f, 0.781831503f }, { 0x1900013fu } },
+	{ { 0.598234057f, -0.175657377f, 0.781831503f }, { 0x190e9932u } },
+	{ { 0.526616752f, -0.0757160559f, 0.846724212f }, { 0x1b1f650du } },
+	{ { 0.532032073f, 0.0f, 0.846724212f }, { 0x5b100110u } },
+	{ { 0.51048106f, -0.149890751f, 0.846724212f }, { 0x5b1ecd05u } },
+	{ { 0.567146301f, -0.259007037f, 0.781831503f }, { 0x590df122u } },
+	{ { 0.42946744f, -0.0617480949f, 0.90096885f }, { 0x5ccf80dbu } },
+	{ { 0.433883727f, 0.0f, 0.90096885f }, { 0x1cc000deu } },
+	{ { 0.416308403f, -0.122239172f, 0.90096885f }, { 0x1ccf08d5u } },
+	{ { 0.326917291f, -0.0470036119f, 0.943883359f }, { 0x1e2fa0a7u } },
+	{ { 0.330279052f, 0.0f, 0.943883359f }, { 0x5e2000a9u } },
+	{ { 0.316900432f, -0.0930503681f, 0.943883359f }, { 0x5e2f40a2u } },
+	{ { 0.220255986f, -0.0316680297f, 0.974927902f }, { 0x5f2fc071u } },
+	{ { 0.222520933f, 0.0f, 0.974927902f }, { 0x1f200072u } },
+	{ { 0.21350728f, -0.0626913905f, 0.974927902f }, { 0x1f2f806du } },
+	{ { 0.110824838f, -0.0159342065f, 0.993712187f }, { 0x1fcfe039u } },
+	{ { 0.111964479f, 0.0f, 0.993712187f }, { 0x5fc00039u } },
+	{ { 0.0f, -0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { 0.0f, 0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { 0.0f, -0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { 0.107429124f, -0.0315440372f, 0.993712187f }, { 0x5fcfc037u } },
+	{ { 0.0f, -0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { -0.643206954f, 0.293742776f, 0.707106769f }, { 0x16925ab7u } },
+	{ { -0.567146301f, 0.259007037f, 0.781831503f }, { 0x590212deu } },
+	{ { -0.483953387f, 0.221014112f, 0.846724212f }, { 0x1b11c709u } },
+	{ { -0.598234057f, 0.175657377f, 0.781831503f }, { 0x19016aceu } },
+	{ { -0.51048106f, 0.149890751f, 0.846724212f }, { 0x5b1136fbu } },
+	{ { -0.678463995f, 0.199214995f, 0.707106769f }, { 0x56919aa5u } },
+	{ { -0.617143571f, 0.0887318477f, 0.781831503f }, { 0x5900b6c5u } },
+	{ { -0.526616752f, 0.0757160559f, 0.846724212f }, { 0x1b109ef3u } },
+	{ { -0.699909449f, 0.100631788f, 0.707106769f }, { 0x1690ce9au } },
+	{ { -0.707106769f, 1.54608844e-16f, 0.707106769f }, { 0x56900297u } },
+	{ { -0.623489797f, 1.36325996e-16f, 0.781831503f }, { 0x190002c1u } },
+	{ { -0.532032073f, 1.16328765e-16f, 0.846724212f }, { 0x5b1002f0u } },
+	{ { -0.617143571f, -0.0887318477f, 0.781831503f }, { 0x590f4ec5u } },
+	{ { -0.526616752f, -0.0757160559f, 0.846724212f }, { 0x1b1f66f3u } },
+	{ { -0.699909449f, -0.100631788f, 0.707106769f }, { 0x169f369au } },
+	{ { -0.598234057f, -0.175657377f, 0.781831503f }, { 0x190e9aceu } },
+	{ { -0.51048106f, -0.149890751f, 0.846724212f }, { 0x5b1ecefbu } },
+	{ { -0.678463995f, -0.199214995f, 0.707106769f }, { 0x569e6aa5u } },
+	{ { -0.643206954f, -0.293742776f, 0.707106769f }, { 0x169daab7u } },
+	{ { -0.567146301f, -0.259007037f, 0.781831503f }, { 0x590df2deu } },
+	{ { -0.483953387f, -0.221014112f, 0.846724212f }, { 0x1b1e3f09u } },
+	{ { -0.524513006f, -0.337084025f, 0.781831503f }, { 0x190d52f4u } },
+	{ { -0.44757387f, -0.287638247f, 0.846724212f }, { 0x5b1db71bu } },
+	{ { -0.594856083f, -0.382290781f, 0.707106769f }, { 0x569cf6d0u } },
+	{ { -0.471202165f, -0.408298999f, 0.781831503f }, { 0x590cbf0fu } },
+	{ { -0.402083009f, -0.348406911f, 0.846724212f }, { 0x1b1d3b33u } },
+	{ { -0.534395635f, -0.463056475f, 0.707106769f }, { 0x169c4eefu } },
+	{ { -0.463056475f, -0.534395635f, 0.707106769f }, { 0x569bbf13u } },
+	{ { -0.408298999f, -0.471202165f, 0.781831503f }, { 0x190c3f2fu } },
+	{ { -0.348406911f, -0.402083009f, 0.846724212f }, { 0x5b1ccf4eu } },
+	{ { -0.337084025f, -0.524513006f, 0.781831503f }, { 0x590bd354u } },
+	{ { -0.287638247f, -0.44757387f, 0.846724212f }, { 0x1b1c6f6du } },
+	{ { -0.382290781f, -0.594856083f, 0.707106769f }, { 0x169b433du } },
+	{ { -0.259007037f, -0.567146301f, 0.781831503f }, { 0x190b7b7cu } },
+	{ { -0.221014112f, -0.483953387f, 0.846724212f }, { 0x5b1c278fu } },
+	{ { -0.293742776f, -0.643206954f, 0.707106769f }, { 0x569adf6au } },
+	{ { -0.199214995f, -0.678463995f, 0.707106769f }, { 0x169a979au } },
+	{ { -0.175657377f, -0.598234057f, 0.781831503f }, { 0x590b3ba6u } },
+	{ { -0.149890751f, -0.51048106f, 0.846724212f }, { 0x1b1befb3u } },
+	{ { -0.0887318477f, -0.617143571f, 0.781831503f }, { 0x190b17d3u } },
+	{ { -0.0757160559f, -0.526616752f, 0.846724212f }, { 0x5b1bcfd9u } },
+	{ { -0.100631788f, -0.699909449f, 0.707106769f }, { 0x569a6bcdu } },
+	{ { 0.0f, -0.623489797f, 0.781831503f }, { 0x590b0400u } },
+	{ { 0.0f, -0.532032073f, 0.846724212f }, { 0x1b1bc000u } },
+	{ { 0.0f, -0.707106769f, 0.707106769f }, { 0x169a5c00u } },
+	{ { 0.178562343f, 0.277848423f, -0.943883359f }, { 0x21e2385bu } },
+	{ { 0.234575257f, 0.365006238f, -0.90096885f }, { 0x6342ec78u } },
+	{ { 0.137202874f, 0.300432414f, -0.943883359f }, { 0x61e26846u } },
+	{ { 0.348406911f, 0.402083009f, -0.846724212f }, { 0x64f334b2u } },
+	{ { 0.180241823f, 0.39467454f, -0.90096885f }, { 0x2343285cu } },
+	{ { 0.0930503681f, 0.316900432f, -0.943883359f }, { 0x21e28830u } },
+	{ { 0.287638247f, 0.44757387f, -0.846724212f }, { 0x24f39493u } },
+	{ { 0.122239172f, 0.416308403f, -0.90096885f }, { 0x6343543eu } },
+	{ { 0.0470036119f, 0.326917291f, -0.943883359f }, { 0x61e29c18u } },
+	{ { 0.221014112f, 0.483953387f, -0.846724212f }, { 0x64f3dc71u } },
+	{ { 0.0617480949f, 0.42946744f, -0.90096885f }, { 0x23436c20u } },
+	{ { 7.2215488e-17f, 0.330279052f, -0.943883359f }, { 0x21e2a400u } },
+	{ { 0.149890751f, 0.51048106f, -0.846724212f }, { 0x24f4144du } },
+	{ { 9.4868643e-17f, 0.433883727f, -0.90096885f }, { 0x63437800u } },
+	{ { -0.0470036119f, 0.326917291f, -0.943883359f }, { 0x61e29fe8u } },
+	{ { 0.0757160559f, 0.526616752f, -0.846724212f }, { 0x64f43427u } },
+	{ { -0.0617480949f, 0.42946744f, -0.90096885f }, { 0x23436fe0u } },
+	{ { -0.0930503681f, 0.316900432f, -0.943883359f }, { 0x21e28bd0u } },
+	{ { 1.16328765e-16f, 0.532032073f, -0.846724212f }, { 0x24f44000u } },
+	{ { -0.122239172f, 0.416308403f, -0.90096885f }, { 0x634357c2u } },
+	{ { -0.137202874f, 0.300432414f, -0.943883359f }, { 0x61e26bbau } },
+	{ { -0.0757160559f, 0.526616752f, -0.846724212f }, { 0x64f437d9u } },
+	{ { -0.180241823f, 0.39467454f, -0.90096885f }, { 0x23432ba4u } },
+	{ { -0.178562343f, 0.277848423f, -0.943883359f }, { 0x21e23ba5u } },
+	{ { -0.149890751f, 0.51048106f, -0.846724212f }, { 0x24f417b3u } },
+	{ { -0.234575257f, 0.365006238f, -0.90096885f }, { 0x6342ef88u } },
+	{ { -0.216286793f, 0.249608263f, -0.943883359f }, { 0x61e20391u } },
+	{ { -0.221014112f, 0.483953387f, -0.846724212f }, { 0x64f3df8fu } },
+	{ { -0.284133434f, 0.327907443f, -0.90096885f }, { 0x2342a36fu } },
+	{ { -0.249608263f, 0.216286793f, -0.943883359f }, { 0x21e1bf80u } },
+	{ { -0.287638247f, 0.44757387f, -0.846724212f }, { 0x24f3976du } },
+	{ { -0.327907443f, 0.284133434f, -0.90096885f }, { 0x63424758u } },
+	{ { -0.277848423f, 0.178562343f, -0.943883359f }, { 0x61e16f72u } },
+	{ { -0.348406911f, 0.402083009f, -0.846724212f }, { 0x64f3374eu } },
+	{ { -0.365006238f, 0.234575257f, -0.90096885f }, { 0x2341e345u } },
+	{ { -0.300432414f, 0.137202874f, -0.943883359f }, { 0x21e11b66u } },
+	{ { -0.402083009f, 0.348406911f, -0.846724212f }, { 0x24f2cb33u } },
+	{ { -0.39467454f, 0.180241823f, -0.90096885f }, { 0x63417336u } },
+	{ { -0.316900432f, 0.0930503681f, -0.943883359f }, { 0x61e0c35eu } },
+	{ { -0.44757387f, 0.287638247f, -0.846724212f }, { 0x64f24f1bu } },
+	{ { -0.416308403f, 0.122239172f, -0.90096885f }, { 0x2340fb2bu } },
+	{ { -0.326917291f, 0.0470036119f, -0.943883359f }, { 0x21e06359u } },
+	{ { -0.483953387f, 0.221014112f, -0.846724212f }, { 0x24f1c709u } },
+	{ { -0.42946744f, 0.0617480949f, -0.90096885f }, { 0x63408325u } },
+	{ { -0.330279052f, 7.2215488e-17f, -0.943883359f }, { 0x61e00357u } },
+	{ { -0.51048106f, 0.149890751f, -0.846724212f }, { 0x64f136fbu } },
+	{ { -0.433883727f, 9.4868643e-17f, -0.90096885f }, { 0x23400322u } },
+	{ { -0.326917291f, -0.0470036119f, -0.943883359f }, { 0x21efa359u } },
+	{ { -0.526616752f, 0.0757160559f, -0.846724212f }, { 0x24f09ef3u } },
+	{ { -0.42946744f, -0.0617480949f, -0.90096885f }, { 0x634f8325u } },
+	{ { -0.316900432f, -0.0930503681f, -0.943883359f }, { 0x61ef435eu } },
+	{ { -0.532032073f, 1.16328765e-16f, -0.846724212f }, { 0x64f002f0u } },
+	{ { -0.416308403f, -0.122239172f, -0.90096885f }, { 0x234f0b2bu } },
+	{ { -0.300432414f, -0.137202874f, -0.943883359f }, { 0x21eeeb66u } },
+	{ { -0.526616752f, -0.0757160559f, -0.846724212f }, { 0x24ff66f3u } },
+	{ { -0.39467454f, -0.180241823f, -0.90096885f }, { 0x634e9336u } },
+	{ { -0.277848423f, -0.178562343f, -0.943883359f }, { 0x61ee9772u } },
+	{ { -0.51048106f, -0.149890751f, -0.846724212f }, { 0x64fecefbu } },
+	{ { -0.365006238f, -0.234575257f, -0.90096885f }, { 0x234e2345u } },
+	{ { -0.249608263f, -0.216286793f, -0.943883359f }, { 0x21ee4780u } },
+	{ { -0.483953387f, -0.221014112f, -0.846724212f }, { 0x24fe3f09u } },
+	{ { 0.0f, -0.111964479f, -0.993712187f }, { 0x204f1c00u } },
+	{ { 0.0159342065f, -0.110824838f, -0.993712187f }, { 0x604f1c08u } },
+	{ { 3.11171284e-17f, -2.16424383e-16f, -1.0f }, { 0x20100000u } },
+	{ { 6.1600802e-17f, -2.09793067e-16f, -1.0f }, { 0x60100000u } },
+	{ { -0.0316680297f, -0.220255986f, -0.974927902f }, { 0x20ee3ff0u } },
+	{ { 0.0f, -0.222520933f, -0.974927902f }, { 0x60ee3800u } },
+	{ { 0.0315440372f, -0.107429124f, -0.993712187f }, { 0x204f2410u } },
+	{ { 9.08304598e-17f, -1.98890959e-16f, -1.0f }, { 0x20100000u } },
+	{ { 0.0316680297f, -0.220255986f, -0.974927902f }, { 0x20ee3c10u } },
+	{ { -0.0470036119f, -0.326917291f, -0.943883359f }, { 0x61ed67e8u } },
+	{ { -0.0930503681f, -0.316900432f, -0.943883359f }, { 0x21ed7bd0u } },
+	{ { 0.0f, -0.330279052f, -0.943883359f }, { 0x21ed5c00u } },
+	{ { 0.0465117246f, -0.101846471f, -0.993712187f }, { 0x604f3018u } },
+	{ { 1.18211071e-16f, -1.8394002e-16f, -1.0f }, { 0x60100000u } },
+	{ { 0.0626913905f, -0.21350728f, -0.974927902f }, { 0x60ee4c20u } },
+	{ { 0.0605325662f, -0.0941905081f, -0.993712187f }, { 0x204f401fu } },
+	{ { 1.43185242e-16f, -1.65244587e-16f, -1.0f }, { 0x20100000u } },
+	{ { 0.0924385339f, -0.202412158f, -0.974927902f }, { 0x20ee642fu } },
+	{ { 0.0470036119f, -0.326917291f, -0.943883359f }, { 0x61ed6418u } },
+	{ { 0.0930503681f, -0.316900432f, -0.943883359f }, { 0x21ed7830u } },
+	{ { 0.0733211413f, -0.0846171081f, -0.993712187f }, { 0x604f5425u } },
+	{ { 1.65244587e-16f, -1.43185242e-16f, -1.0f }, { 0x60100000u } },
+	{ { 0.120303899f, -0.187196523f, -0.974927902f }, { 0x60ee803du } },
+	{ { 0.0846171081f, -0.0733211413f, -0.993712187f }, { 0x204f6c2bu } },
+	{ { 1.8394002e-16f, -1.18211071e-16f, -1.0f }, { 0x20100000u } },
+	{ { 0.145720229f, -0.168170094f, -0.974927902f }, { 0x20eea84au } },
+	{ { 0.137202874f, -0.300432414f, -0.943883359f }, { 0x61ed9846u } },
+	{ { 0.178562343f, -0.277848423f, -0.943883359f }, { 0x21edc85bu } },
+	{ { 0.0941905081f, -0.0605325662f, -0.993712187f }, { 0x604f8430u } },
+	{ { 1.98890959e-16f, -9.08304598e-17f, -1.0f }, { 0x60100000u } },
+	{ { 0.168170094f, -0.145720229f, -0.974927902f }, { 0x60eed856u } },
+	{ { 0.101846471f, -0.0465117246f, -0.993712187f }, { 0x204fa034u } },
+	{ { 2.09793067e-16f, -6.1600802e-17f, -1.0f }, { 0x20100000u } },
+	{ { 0.216286793f, -0.249608263f, -0.943883359f }, { 0x61ee006fu } },
+	{ { 0.107429124f, -0.0315440372f, -0.993712187f }, { 0x604fc037u } },
+	{ { 2.16424383e-16f, -3.11171284e-17f, -1.0f }, { 0x60100000u } },
+	{ { 0.110824838f, -0.0159342065f, -0.993712187f }, { 0x204fe039u } },
+	{ { 2.18649922e-16f, 0.0f, -1.0f }, { 0x20100000u } },
+	{ { 0.111964479f, 0.0f, -0.993712187f }, { 0x60400039u } },
+	{ { 0.21350728f, -0.0626913905f, -0.974927902f }, { 0x20ef806du } },
+	{ { 0.220255986f, -0.0316680297f, -0.974927902f }, { 0x60efc071u } },
+	{ { 0.222520933f, 0.0f, -0.974927902f }, { 0x20e00072u } },
+	{ { 0.326917291f, -0.0470036119f, -0.943883359f }, { 0x21efa0a7u } },
+	{ { 0.330279052f, 0.0f, -0.943883359f }, { 0x61e000a9u } },
+	{ { 0.316900432f, -0.0930503681f, -0.943883359f }, { 0x61ef40a2u } },
+	{ { 0.42946744f, -0.0617480949f, -0.90096885f }, { 0x634f80dbu } },
+	{ { 0.433883727f, 0.0f, -0.90096885f }, { 0x234000deu } },
+	{ { 0.416308403f, -0.122239172f, -0.90096885f }, { 0x234f08d5u } },
+	{ { 0.526616752f, -0.0757160559f, -0.846724212f }, { 0x24ff650du } },
+	{ { 0.532032073f, 0.0f, -0.846724212f }, { 0x64f00110u } },
+	{ { 0.51048106f, -0.149890751f, -0.846724212f }, { 0x64fecd05u } },
+	{ { 0.617143571f, -0.0887318477f, -0.781831503f }, { 0x670f4d3bu } },
+	{ { 0.623489797f, 0.0f, -0.781831503f }, { 0x2700013fu } },
+	{ { 0.598234057f, -0.175657377f, -0.781831503f }, { 0x270e9932u } },
+	{ { 0.699909449f, -0.100631788f, -0.707106769f }, { 0x297f3566u } },
+	{ { 0.707106769f, 0.0f, -0.707106769f }, { 0x69700169u } },
+	{ { 0.678463995f, -0.199214995f, -0.707106769f }, { 0x697e695bu } },
+	{ { 0.773873568f, -0.111266218f, -0.623489797f }, { 0x6c1f1d8bu } },
+	{ { 0.781831503f, 0.0f, -0.623489797f }, { 0x2c100190u } },
+	{ { 0.750161827f, -0.220267385f, -0.623489797f }, { 0x2c1e3d7fu } },
+	{ { 0.838105738f, -0.120501414f, -0.532032073f }, { 0x2f0f09acu } },
+	{ { 0.846724212f, 0.0f, -0.532032073f }, { 0x6f0001b1u } },
+	{ { 0.812425911f, -0.238549769f, -0.532032073f }, { 0x6f0e199fu } },
+	{ { 0.891798317f, -0.128221244f, -0.433883727f }, { 0x722ef9c8u } },
+	{ { 0.90096885f, 0.0f, -0.433883727f }, { 0x322001ccu } },
+	{ { 0.864473283f, -0.253832251f, -0.433883727f }, { 0x322df9bau } },
+	{ { 0.510301828f, -0.79404521f, 0.330279052f }, { 0x0a99a905u } },
+	{ { 0.527085841f, -0.820161521f, 0.222520933f }, { 0x4729750du } },
+	{ { 0.392103314f, -0.85858649f, 0.330279052f }, { 0x4a9924c8u } },
+	{ { 0.537241399f, -0.835963905f, 0.111964479f }, { 0x03995513u } },
+	{ { 0.404999703f, -0.886825621f, 0.222520933f }, { 0x0728eccfu } },
+	{ { 0.540640831f, -0.841253519f, 2.18649922e-16f }, { 0x40094914u } },
+	{ { 0.412802964f, -0.903912425f, 0.111964479f }, { 0x4398c8d3u } },
+	{ { 0.537241399f, -0.835963905f, -0.111964479f }, { 0x3c795513u } },
+	{ { 0.415415019f, -0.909631968f, 2.18649922e-16f }, { 0x0008bcd4u } },
+	{ { 0.527085841f, -0.820161521f, -0.222520933f }, { 0x78e9750du } },
+	{ { 0.412802964f, -0.903912425f, -0.111964479f }, { 0x7c78c8d3u } },
+	{ { 0.510301828f, -0.79404521f, -0.330279052f }, { 0x3579a905u } },
+	{ { 0.404999703f, -0.886825621f, -0.222520933f }, { 0x38e8eccfu } },
+	{ { 0.279961079f, -0.953459859f, -0.111964479f }, { 0x3c78648fu } },
+	{ { 0.487100542f, -0.757943273f, -0.433883727f }, { 0x7229f4f9u } },
+	{ { 0.392103314f, -0.85858649f, -0.330279052f }, { 0x757924c8u } },
+	{ { 0.374275982f, -0.819550097f, -0.433883727f }, { 0x322974bfu } },
+	{ { 0.274668932f, -0.935436487f, -0.222520933f }, { 0x78e8888cu } },
+	{ { 0.265922666f, -0.905649424f, -0.330279052f }, { 0x3578c488u } },
+	{ { 0.253832251f, -0.864473283f, -0.433883727f }, { 0x72291882u } },
+	{ { 0.134328604f, -0.934275985f, -0.330279052f }, { 0x75788c45u } },
+	{ { 0.138746709f, -0.965004563f, -0.222520933f }, { 0x38e84c47u } },
+	{ { 0.141419992f, -0.983597636f, -0.111964479f }, { 0x7c782448u } },
+	{ { -0.327907443f, -0.284133434f, -0.90096885f }, { 0x634dbf58u } },
+	{ { -0.216286793f, -0.249608263f, -0.943883359f }, { 0x61ee0391u } },
+	{ { -0.44757387f, -0.287638247f, -0.846724212f }, { 0x64fdb71bu } },
+	{ { -0.284133434f, -0.327907443f, -0.90096885f }, { 0x234d636fu } },
+	{ { -0.178562343f, -0.277848423f, -0.943883359f }, { 0x21edcba5u } },
+	{ { -0.402083009f, -0.348406911f, -0.846724212f }, { 0x24fd3b33u } },
+	{ { -0.234575257f, -0.365006238f, -0.90096885f }, { 0x634d1788u } },
+	{ { -0.137202874f, -0.300432414f, -0.943883359f }, { 0x61ed9bbau } },
+	{ { -0.348406911f, -0.402083009f, -0.846724212f }, { 0x64fccf4eu } },
+	{ { -0.180241823f, -0.39467454f, -0.90096885f }, { 0x234cdba4u } },
+	{ { -0.287638247f, -0.44757387f, -0.846724212f }, { 0x24fc6f6du } },
+	{ { -0.122239172f, -0.416308403f, -0.90096885f }, { 0x634cafc2u } },
+	{ { -0.221014112f, -0.483953387f, -0.846724212f }, { 0x64fc278fu } },
+	{ { -0.0617480949f, -0.42946744f, -0.90096885f }, { 0x234c97e0u } },
+	{ { -0.149890751f, -0.51048106f, -0.846724212f }, { 0x24fbefb3u } },
+	{ { 0.0f, -0.433883727f, -0.90096885f }, { 0x634c8800u } },
+	{ { -0.0757160559f, -0.526616752f, -0.846724212f }, { 0x64fbcfd9u } },
+	{ { 0.0617480949f, -0.42946744f, -0.90096885f }, { 0x234c9420u } },
+	{ { 0.0f, -0.532032073f, -0.846724212f }, { 0x24fbc000u } },
+	{ { 0.122239172f, -0.416308403f, -0.90096885f }, { 0x634cac3eu } },
+	{ { 0.0757160559f, -0.526616752f, -0.846724212f }, { 0x64fbcc27u } },
+	{ { 0.180241823f, -0.39467454f, -0.90096885f }, { 0x234cd85cu } },
+	{ { 0.149890751f, -0.51048106f, -0.846724212f }, { 0x24fbec4du } },
+	{ { 0.0887318477f, -0.617143571f, -0.781831503f }, { 0x270b142du } },
+	{ { 0.234575257f, -0.365006238f, -0.90096885f }, { 0x634d1478u } },
+	{ { 0.221014112f, -0.483953387f, -0.846724212f }, { 0x64fc2471u } },
+	{ { 0.287638247f, -0.44757387f, -0.846724212f }, { 0x24fc6c93u } },
+	{ { 0.175657377f, -0.598234057f, -0.781831503f }, { 0x670b385au } },
+	{ { 0.259007037f, -0.567146301f, -0.781831503f }, { 0x270b7884u } },
+	{ { -0.0470036119f, -0.326917291f, 0.943883359f }, { 0x5e2d67e8u } },
+	{ { 0.0f, -0.433883727f, 0.90096885f }, { 0x5ccc8800u } },
+	{ { -0.0617480949f, -0.42946744f, 0.90096885f }, { 0x1ccc97e0u } },
+	{ { 0.0f, -0.330279052f, 0.943883359f }, { 0x1e2d5c00u } },
+	{ { 0.0470036119f, -0.326917291f, 0.943883359f }, { 0x5e2d6418u } },
+	{ { 0.0617480949f, -0.42946744f, 0.90096885f }, { 0x1ccc9420u } },
+	{ { 0.0930503681f, -0.316900432f, 0.943883359f }, { 0x1e2d7830u } },
+	{ { 0.122239172f, -0.416308403f, 0.90096885f }, { 0x5cccac3eu } },
+	{ { 0.0757160559f, -0.526616752f, 0.846724212f }, { 0x5b1bcc27u } },
+	{ { 0.149890751f, -0.51048106f, 0.846724212f }, { 0x1b1bec4du } },
+	{ { 0.180241823f, -0.39467454f, 0.90096885f }, { 0x1cccd85cu } },
+	{ { 0.137202874f, -0.300432414f, 0.943883359f }, { 0x5e2d9846u } },
+	{ { 0.221014112f, -0.483953387f, 0.846724212f }, { 0x5b1c2471u } },
+	{ { 0.234575257f, -0.365006238f, 0.90096885f }, { 0x5ccd1478u } },
+	{ { 0.287638247f, -0.44757387f, 0.846724212f }, { 0x1b1c6c93u } },
+	{ { 0.284133434f, -0.327907443f, 0.90096885f }, { 0x1ccd6091u } },
+	{ { 0.348406911f, -0.402083009f, 0.846724212f }, { 0x5b1cccb2u } },
+	{ { 0.327907443f, -0.284133434f, 0.90096885f }, { 0x5ccdbca8u } },
+	{ { 0.402083009f, -0.348406911f, 0.846724212f }, { 0x1b1d38cdu } },
+	{ { 0.44757387f, -0.287638247f, 0.846724212f }, { 0x5b1db4e5u } },
+	{ { 0.524513006f, -0.337084025f, 0.781831503f }, { 0x190d510cu } },
+	{ { 0.471202165f, -0.408298999f, 0.781831503f }, { 0x590cbcf1u } },
+	{ { 0.594856083f, -0.382290781f, 0.707106769f }, { 0x569cf530u } },
+	{ { 0.408298999f, -0.471202165f, 0.781831503f }, { 0x190c3cd1u } },
+	{ { 0.534395635f, -0.463056475f, 0.707106769f }, { 0x169c4d11u } },
+	{ { 0.65771848f, -0.422690004f, 0.623489797f }, { 0x13fca150u } },
+	{ { 0.337084025f, -0.524513006f, 0.781831503f }, { 0x590bd0acu } },
+	{ { -0.365006238f, 0.234575257f, 0.90096885f }, { 0x1cc1e345u } },
+	{ { -0.277848423f, 0.178562343f, 0.943883359f }, { 0x5e216f72u } },
+	{ { -0.300432414f, 0.137202874f, 0.943883359f }, { 0x1e211b66u } },
+	{ { -0.39467454f, 0.180241823f, 0.90096885f }, { 0x5cc17336u } },
+	{ { -0.316900432f, 0.0930503681f, 0.943883359f }, { 0x5e20c35eu } },
+	{ { -0.416308403f, 0.122239172f, 0.90096885f }, { 0x1cc0fb2bu } },
+	{ { -0.42946744f, 0.0617480949f, 0.90096885f }, { 0x5cc08325u } },
+	{ { -0.326917291f, 0.0470036119f, 0.943883359f }, { 0x1e206359u } },
+	{ { -0.330279052f, 7.2215488e-17f, 0.943883359f }, { 0x5e200357u } },
+	{ { -0.433883727f, 9.4868643e-17f, 0.90096885f }, { 0x1cc00322u } },
+	{ { -0.326917291f, -0.0470036119f, 0.943883359f }, { 0x1e2fa359u } },
+	{ { -0.42946744f, -0.0617480949f, 0.90096885f }, { 0x5ccf8325u } },
+	{ { -0.416308403f, -0.122239172f, 0.90096885f }, { 0x1ccf0b2bu } },
+	{ { -0.316900432f, -0.0930503681f, 0.943883359f }, { 0x5e2f435eu } },
+	{ { -0.300432414f, -0.137202874f, 0.943883359f }, { 0x1e2eeb66u } },
+	{ { -0.39467454f, -0.180241823f, 0.90096885f }, { 0x5cce9336u } },
+	{ { -0.277848423f, -0.178562343f, 0.943883359f }, { 0x5e2e9772u } },
+	{ { -0.365006238f, -0.234575257f, 0.90096885f }, { 0x1cce2345u } },
+	{ { -0.327907443f, -0.284133434f, 0.90096885f }, { 0x5ccdbf58u } },
+	{ { -0.249608263f, -0.216286793f, 0.943883359f }, { 0x1e2e4780u } },
+	{ { -0.216286793f, -0.249608263f, 0.943883359f }, { 0x5e2e0391u } },
+	{ { -0.284133434f, -0.327907443f, 0.90096885f }, { 0x1ccd636fu } },
+	{ { -0.178562343f, -0.277848423f, 0.943883359f }, { 0x1e2dcba5u } },
+	{ { -0.234575257f, -0.365006238f, 0.90096885f }, { 0x5ccd1788u } },
+	{ { -0.180241823f, -0.39467454f, 0.90096885f }, { 0x1cccdba4u } },
+	{ { -0.137202874f, -0.300432414f, 0.943883359f }, { 0x5e2d9bbau } },
+	{ { -0.0930503681f, -0.316900432f, 0.943883359f }, { 0x1e2d7bd0u } },
+	{ { -0.122239172f, -0.416308403f, 0.90096885f }, { 0x5cccafc2u } },
+	{ { 0.100631788f, -0.699909449f, 0.707106769f }, { 0x569a6833u } },
+	{ { 0.0887318477f, -0.617143571f, 0.781831503f }, { 0x190b142du } },
+	{ { 0.111266218f, -0.773873568f, 0.623489797f }, { 0x13f9d439u } },
+	{ { 0.175657377f, -0.598234057f, 0.781831503f }, { 0x590b385au } },
+	{ { 0.199214995f, -0.678463995f, 0.707106769f }, { 0x169a9466u } },
+	{ { 0.259007037f, -0.567146301f, 0.781831503f }, { 0x190b7884u } },
+	{ { 0.293742776f, -0.643206954f, 0.707106769f }, { 0x569adc96u } },
+	{ { 0.382290781f, -0.594856083f, 0.707106769f }, { 0x169b40c3u } },
+	{ { 0.422690004f, -0.65771848f, 0.623489797f }, { 0x53fac0d8u } },
+	{ { 0.324784547f, -0.711178958f, 0.623489797f }, { 0x13fa54a6u } },
+	{ { 0.457773656f, -0.712309718f, 0.532032073f }, { 0x110a50eau } },
+	{ { 0.220267385f, -0.750161827f, 0.623489797f }, { 0x53fa0471u } },
+	{ { 0.35174194f, -0.770207405f, 0.532032073f }, { 0x5109d8b4u } },
+	{ { 0.487100542f, -0.757943273f, 0.433883727f }, { 0x4de9f4f9u } },
+	{ { 0.238549769f, -0.812425911f, 0.532032073f }, { 0x1109847au } },
+	{ { 0.374275982f, -0.819550097f, 0.433883727f }, { 0x0de974bfu } },
+	{ { 0.111964479f, 0.0f, -0.993712187f }, { 0x60400039u } },
+	{ { 2.16424383e-16f, 3.11171284e-17f, -1.0f }, { 0x60100000u } },
+	{ { 2.18649922e-16f, 0.0f, -1.0f }, { 0x20100000u } },
+	{ { 0.110824838f, 0.0159342065f, -0.993712187f }, { 0x20402039u } },
+	{ { 0.222520933f, 0.0f, -0.974927902f }, { 0x20e00072u } },
+	{ { 2.09793067e-16f, 6.1600802e-17f, -1.0f }, { 0x20100000u } },
+	{ { 0.220255986f, 0.0316680297f, -0.974927902f }, { 0x60e04071u } },
+	{ { 0.330279052f, 0.0f, -0.943883359f }, { 0x61e000a9u } },
+	{ { 0.107429124f, 0.0315440372f, -0.993712187f }, { 0x60404037u } },
+	{ { 1.98890959e-16f, 9.08304598e-17f, -1.0f }, { 0x60100000u } },
+	{ { 0.326917291f, 0.0470036119f, -0.943883359f }, { 0x21e060a7u } },
+	{ { 0.433883727f, 0.0f, -0.90096885f }, { 0x234000deu } },
+	{ { 0.21350728f, 0.0626913905f, -0.974927902f }, { 0x20e0806du } },
+	{ { 0.101846471f, 0.0465117246f, -0.993712187f }, { 0x20406034u } },
+	{ { 1.8394002e-16f, 1.18211071e-16f, -1.0f }, { 0x20100000u } },
+	{ { 0.0941905081f, 0.0605325662f, -0.993712187f }, { 0x60407c30u } },
+	{ { 1.65244587e-16f, 1.43185242e-16f, -1.0f }, { 0x60100000u } },
+	{ { 0.202412158f, 0.0924385339f, -0.974927902f }, { 0x60e0bc67u } },
+	{ { 0.0846171081f, 0.0733211413f, -0.993712187f }, { 0x2040942bu } },
+	{ { 1.43185242e-16f, 1.65244587e-16f, -1.0f }, { 0x20100000u } },
+	{ { 0.187196523f, 0.120303899f, -0.974927902f }, { 0x20e0f460u } },
+	{ { 0.0733211413f, 0.0846171081f, -0.993712187f }, { 0x6040ac25u } },
+	{ { 1.18211071e-16f, 1.8394002e-16f, -1.0f }, { 0x60100000u } },
+	{ { 0.168170094f, 0.145720229f, -0.974927902f }, { 0x60e12856u } },
+	{ { 0.0605325662f, 0.0941905081f, -0.993712187f }, { 0x2040c01fu } },
+	{ { 9.08304598e-17f, 1.98890959e-16f, -1.0f }, { 0x20100000u } },
+	{ { 0.145720229f, 0.168170094f, -0.974927902f }, { 0x20e1584au } },
+	{ { 0.0465117246f, 0.101846471f, -0.993712187f }, { 0x6040d018u } },
+	{ { 6.1600802e-17f, 2.09793067e-16f, -1.0f }, { 0x60100000u } },
+	{ { 0.120303899f, 0.187196523f, -0.974927902f }, { 0x60e1803du } },
+	{ { 0.0315440372f, 0.107429124f, -0.993712187f }, { 0x2040dc10u } },
+	{ { 3.11171284e-17f, 2.16424383e-16f, -1.0f }, { 0x20100000u } },
+	{ { 0.0924385339f, 0.202412158f, -0.974927902f }, { 0x20e19c2fu } },
+	{ { 0.0159342065f, 0.110824838f, -0.993712187f }, { 0x6040e408u } },
+	{ { 4.78077872e-32f, 2.18649922e-16f, -1.0f }, { 0x60100000u } },
+	{ { 0.0626913905f, 0.21350728f, -0.974927902f }, { 0x60e1b420u } },
+	{ { 2.4481024e-17f, 0.111964479f, -0.993712187f }, { 0x2040e400u } },
+	{ { -3.11171284e-17f, 2.16424383e-16f, -1.0f }, { 0x20100000u } },
+	{ { 0.0316680297f, 0.220255986f, -0.974927902f }, { 0x20e1c410u } },
+	{ { -0.0159342065f, 0.110824838f, -0.993712187f }, { 0x6040e7f8u } },
+	{ { -6.1600802e-17f, 2.09793067e-16f, -1.0f }, { 0x60100000u } },
+	{ { 4.86541846e-17f, 0.222520933f, -0.974927902f }, { 0x60e1c800u } },
+	{ { -0.0315440372f, 0.107429124f, -0.993712187f }, { 0x2040dff0u } },
+	{ { -9.08304598e-17f, 1.98890959e-16f, -1.0f }, { 0x20100000u } },
+	{ { -0.0316680297f, 0.220255986f, -0.974927902f }, { 0x20e1c7f0u } },
+	{ { -0.0465117246f, 0.101846471f, -0.993712187f }, { 0x6040d3e8u } },
+	{ { -1.18211071e-16f, 1.8394002e-16f, -1.0f }, { 0x60100000u } },
+	{ { -0.0626913905f, 0.21350728f, -0.974927902f }, { 0x60e1b7e0u } },
+	{ { -0.0605325662f, 0.0941905081f, -0.993712187f }, { 0x2040c3e1u } },
+	{ { -1.43185242e-16f, 1.65244587e-16f, -1.0f }, { 0x20100000u } },
+	{ { -0.0924385339f, 0.202412158f, -0.974927902f }, { 0x20e19fd1u } },
+	{ { -0.0733211413f, 0.0846171081f, -0.993712187f }, { 0x6040afdbu } },
+	{ { -1.65244587e-16f, 1.43185242e-16f, -1.0f }, { 0x60100000u } },
+	{ { -0.120303899f, 0.187196523f, -0.974927902f }, { 0x60e183c3u } },
+	{ { -0.0846171081f, 0.0733211413f, -0.993712187f }, { 0x204097d5u } },
+	{ { -1.8394002e-16f, 1.18211071e-16f, -1.0f }, { 0x20100000u } },
+	{ { -0.145720229f, 0.168170094f, -0.974927902f }, { 0x20e15bb6u } },
+	{ { -0.0941905081f, 0.0605325662f, -0.993712187f }, { 0x60407fd0u } },
+	{ { -1.98890959e-16f, 9.08304598e-17f, -1.0f }, { 0x60100000u } },
+	{ { -0.168170094f, 0.145720229f, -0.974927902f }, { 0x60e12baau } },
+	{ { -0.101846471f, 0.0465117246f, -0.993712187f }, { 0x204063ccu } },
+	{ { -2.09793067e-16f, 6.1600802e-17f, -1.0f }, { 0x20100000u } },
+	{ { -0.187196523f, 0.120303899f, -0.974927902f }, { 0x20e0f7a0u } },
+	{ { -0.107429124f, 0.0315440372f, -0.993712187f }, { 0x604043c9u } },
+	{ { -2.16424383e-16f, 3.11171284e-17f, -1.0f }, { 0x60100000u } },
+	{ { -0.202412158f, 0.0924385339f, -0.974927902f }, { 0x60e0bf99u } },
+	{ { -0.110824838f, 0.0159342065f, -0.993712187f }, { 0x204023c7u } },
+	{ { -2.18649922e-16f, 4.78077872e-32f, -1.0f }, { 0x20100000u } },
+	{ { -0.21350728f, 0.0626913905f, -0.974927902f }, { 0x20e08393u } },
+	{ { -0.111964479f, 2.4481024e-17f, -0.993712187f }, { 0x604003c7u } },
+	{ { -2.16424383e-16f, -3.11171284e-17f, -1.0f }, { 0x60100000u } },
+	{ { -0.220255986f, 0.0316680297f, -0.974927902f }, { 0x60e0438fu } },
+	{ { -0.110824838f, -0.0159342065f, -0.993712187f }, { 0x204fe3c7u } },
+	{ { -2.09793067e-16f, -6.1600802e-17f, -1.0f }, { 0x20100000u } },
+	{ { -0.222520933f, 4.86541846e-17f, -0.974927902f }, { 0x20e0038eu } },
+	{ { -0.107429124f, -0.0315440372f, -0.993712187f }, { 0x604fc3c9u } },
+	{ { -1.98890959e-16f, -9.08304598e-17f, -1.0f }, { 0x60100000u } },
+	{ { -0.220255986f, -0.0316680297f, -0.974927902f }, { 0x60efc38fu } },
+	{ { -0.101846471f, -0.0465117246f, -0.993712187f }, { 0x204fa3ccu } },
+	{ { -1.8394002e-16f, -1.18211071e-16f, -1.0f }, { 0x20100000u } },
+	{ { -0.21350728f, -0.0626913905f, -0.974927902f }, { 0x20ef8393u } },
+	{ { -0.0941905081f, -0.0605325662f, -0.993712187f }, { 0x604f87d0u } },
+	{ { -1.65244587e-16f, -1.43185242e-16f, -1.0f }, { 0x60100000u } },
+	{ { -0.202412158f, -0.0924385339f, -0.974927902f }, { 0x60ef4799u } },
+	{ { -0.0846171081f, -0.0733211413f, -0.993712187f }, { 0x204f6fd5u } },
+	{ { -1.43185242e-16f, -1.65244587e-16f, -1.0f }, { 0x20100000u } },
+	{ { -0.187196523f, -0.120303899f, -0.974927902f }, { 0x20ef0fa0u } },
+	{ { -0.0733211413f, -0.0846171081f, -0.993712187f }, { 0x604f57dbu } },
+	{ { -1.18211071e-16f, -1.8394002e-16f, -1.0f }, { 0x60100000u } },
+	{ { -0.168170094f, -0.145720229f, -0.974927902f }, { 0x60eedbaau } },
+	{ { -0.0605325662f, -0.0941905081f, -0.993712187f }, { 0x204f43e1u } },
+	{ { -9.08304598e-17f, -1.98890959e-16f, -1.0f }, { 0x20100000u } },
+	{ { -0.145720229f, -0.168170094f, -0.974927902f }, { 0x20eeabb6u } },
+	{ { -0.0465117246f, -0.101846471f, -0.993712187f }, { 0x604f33e8u } },
+	{ { -6.1600802e-17f, -2.09793067e-16f, -1.0f }, { 0x60100000u } },
+	{ { -0.120303899f, -0.187196523f, -0.974927902f }, { 0x60ee83c3u } },
+	{ { -0.0315440372f, -0.107429124f, -0.993712187f }, { 0x204f27f0u } },
+	{ { -3.11171284e-17f, -2.16424383e-16f, -1.0f }, { 0x20100000u } },
+	{ { -0.0924385339f, -0.202412158f, -0.974927902f }, { 0x20ee67d1u } },
+	{ { -0.0159342065f, -0.110824838f, -0.993712187f }, { 0x604f1ff8u } },
+	{ { 0.0f, -2.18649922e-16f, -1.0f }, { 0x60100000u } },
+	{ { -0.0626913905f, -0.21350728f, -0.974927902f }, { 0x60ee4fe0u } },
+	// ball level 6
+	{ { 0.587801754f, -0.482396424f, -0.649448037f }, { 0x2b4c252cu } },
+	{ { 0.587937772f, -0.392847478f, -0.707106769f }, { 0x297cdd2cu } },
+	{ { 0.546600938f, -0.448583782f, -0.707106769f }, { 0x697c6d17u } },
+	{ { 0.539996326f, -0.360814005f, -0.760405958f }, { 0x67bd2114u } },
+	{ { 0.502030134f, -0.412005484f, -0.760405958f }, { 0x27bcb501u } },
+	{ { 0.572061419f, -0.572061419f, -0.587785244f }, { 0x2d4b7124u } },
+	{ { 0.537688196f, -0.537688196f, -0.649448037f }, { 0x6b4bb513u } },
+	{ { 0.5f, -0.5f, -0.707106769f }, { 0x297c0100u } },
+	{ { 0.459229112f, -0.459229112f, -0.760405958f }, { 0x67bc54ebu } },
+	{ { 0.513234973f, -0.625378609f, -0.587785244f }, { 0x6d4b0106u } },
+	{ { 0.540909171f, -0.659099758f, -0.522498548f }, { 0x2f5abd14u } },
+	{ { 0.482396424f, -0.587801754f, -0.649448037f }, { 0x2b4b50f7u } },
+	{ { 0.448583782f, -0.546600938f, -0.707106769f }, { 0x697ba4e5u } },
+	{ { 0.412005484f, -0.502030134f, -0.760405958f }, { 0x27bbfcd3u } },
+	{ { 0.392847478f, -0.587937772f, -0.707106769f }, { 0x297b50c9u } },
+	{ { 0.422458917f, -0.632254481f, -0.649448037f }, { 0x6b4af4d8u } },
+	{ { 0.449465752f, -0.672673047f, -0.587785244f }, { 0x2d4aa0e6u } },
+	{ { 0.473701507f, -0.70894438f, -0.522498548f }, { 0x6f5a58f2u } },
+	{ { 0.358452886f, -0.670618176f, -0.649448037f }, { 0x2b4aa4b7u } },
+	{ { 0.33332783f, -0.623612523f, -0.707106769f }, { 0x697b04aau } },
+	{ { 0.381367981f, -0.713489294f, -0.587785244f }, { 0x6d4a4cc3u } },
+	{ { 0.401931792f, -0.75196147f, -0.522498548f }, { 0x2f5a00cdu } },
+	{ { 0.495016694f, -0.740844846f, -0.453990489f }, { 0x318a14fdu } },
+	{ { 0.565248549f, -0.68875736f, -0.453990489f }, { 0x718a8121u } },
+	{ { 0.42001757f, -0.785797596f, -0.453990489f }, { 0x7189b8d7u } },
+	{ { 0.513279974f, -0.768177748f, -0.382683426f }, { 0x73c9dd06u } },
+	{ { 0.586102962f, -0.714168549f, -0.382683426f }, { 0x33ca4d2bu } },
+	{ { 0.435513794f, -0.814788997f, -0.382683426f }, { 0x33c980dfu } },
+	{ { 0.528378665f, -0.790774584f, -0.309017003f }, { 0x3629b10eu } },
+	{ { 0.603343844f, -0.735176623f, -0.309017003f }, { 0x762a2134u } },
+	{ { 0.448324949f, -0.838756979f, -0.309017003f }, { 0x76294ce5u } },
+	{ { 0.540219784f, -0.808496058f, -0.233445361f }, { 0x78998d14u } },
+	{ { 0.61686492f, -0.751652122f, -0.233445361f }, { 0x389a013bu } },
+	{ { 0.458371997f, -0.85755372f, -0.233445361f }, { 0x389928eau } },
+	{ { 0.548730254f, -0.821232855f, -0.156434461f }, { 0x3b097118u } },
+	{ { 0.626582861f, -0.763493419f, -0.156434461f }, { 0x7b09e940u } },
+	{ { 0.46559307f, -0.871063352f, -0.156434461f }, { 0x7b090ceeu } },
+	{ { 0.553857625f, -0.828906476f, -0.0784590989f }, { 0x7d89611bu } },
+	{ { 0.632437646f, -0.770627499f, -0.0784590989f }, { 0x3d89d943u } },
+	{ { 0.469943583f, -0.879202604f, -0.0784590989f }, { 0x3d88fcf0u } },
+	{ { 0.555570245f, -0.831469595f, 2.18649922e-16f }, { 0x00095d1cu } },
+	{ { 0.634393275f, -0.773010433f, 2.18649922e-16f }, { 0x4009d544u } },
+	{ { 0.471396744f, -0.881921291f, 2.18649922e-16f }, { 0x4008f4f1u } },
+	{ { 0.553857625f, -0.828906476f, 0.0784590989f }, { 0x4289611bu } },
+	{ { 0.632437646f, -0.770627499f, 0.0784590989f }, { 0x0289d943u } },
+	{ { 0.469943583f, -0.879202604f, 0.0784590989f }, { 0x0288fcf0u } },
+	{ { 0.548730254f, -0.821232855f, 0.156434461f }, { 0x05097118u } },
+	{ { 0.626582861f, -0.763493419f, 0.156434461f }, { 0x4509e940u } },
+	{ { 0.46559307f, -0.871063352f, 0.156434461f }, { 0x45090ceeu } },
+	{ { 0.540219784f, -0.808496058f, 0.233445361f }, { 0x47798d14u } },
+	{ { 0.61686492f, -0.751652122f, 0.233445361f }, { 0x077a013bu } },
+	{ { 0.458371997f, -0.85755372f, 0.233445361f }, { 0x077928eau } },
+	{ { 0.528378665f, -0.790774584f, 0.309017003f }, { 0x09e9b10eu } },
+	{ { 0.603343844f, -0.735176623f, 0.309017003f }, { 0x49ea2134u } },
+	{ { 0.448324949f, -0.838756979f, 0.309017003f }, { 0x49e94ce5u } },
+	{ { 0.513279974f, -0.768177748f, 0.382683426f }, { 0x4c49dd06u } },
+	{ { 0.586102962f, -0.714168549f, 0.382683426f }, { 0x0c4a4d2bu } },
+	{ { 0.435513794f, -0.814788997f, 0.382683426f }, { 0x0c4980dfu } },
+	{ { 0.495016694f, -0.740844846f, 0.453990489f }, { 0x0e8a14fdu } },
+	{ { 0.565248549f, -0.68875736f, 0.453990489f }, { 0x4e8a8121u } },
+	{ { 0.42001757f, -0.785797596f, 0.453990489f }, { 0x4e89b8d7u } },
+	{ { 0.473701507f, -0.70894438f, 0.522498548f }, { 0x50ba58f2u } },
+	{ { 0.540909171f, -0.659099758f, 0.522498548f }, { 0x10babd14u } },
+	{ { 0.401931792f, -0.75196147f, 0.522498548f }, { 0x10ba00cdu } },
+	{ { 0.449465752f, -0.672673047f, 0.587785244f }, { 0x12caa0e6u } },
+	{ { 0.513234973f, -0.625378609f, 0.587785244f }, { 0x52cb0106u } },
+	{ { 0.381367981f, -0.713489294f, 0.587785244f }, { 0x52ca4cc3u } },
+	{ { 0.422458917f, -0.632254481f, 0.649448037f }, { 0x54caf4d8u } },
+	{ { 0.482396424f, -0.587801754f, 0.649448037f }, { 0x14cb50f7u } },
+	{ { 0.358452886f, -0.670618176f, 0.649448037f }, { 0x14caa4b7u } },
+	{ { 0.392847478f, -0.587937772f, 0.707106769f }, { 0x169b50c9u } },
+	{ { 0.448583782f, -0.546600938f, 0.707106769f }, { 0x569ba4e5u } },
+	{ { 0.360814005f, -0.539996326f, 0.760405958f }, { 0x585bb0b8u } },
+	{ { 0.33332783f, -0.623612523f, 0.707106769f }, { 0x569b04aau } },
+	{ { 0.306147695f, -0.572762072f, 0.760405958f }, { 0x185b6c9cu } },
+	{ { 0.277080059f, -0.518380284f, 0.809017003f }, { 0x59dbdc8eu } },
+	{ { 0.224935681f, -0.543042779f, 0.809017003f }, { 0x19dbac73u } },
+	{ { 0.24853301f, -0.600011766f, 0.760405958f }, { 0x585b347fu } },
+	{ { 0.170625046f, -0.562475443f, 0.809017003f }, { 0x59db8457u } },
+	{ { 0.270598054f, -0.65328151f, 0.707106769f }, { 0x169ac88au } },
+	{ { 0.188524812f, -0.621483028f, 0.760405958f }, { 0x185b0860u } },
+	{ { 0.114671215f, -0.576491117f, 0.809017003f }, { 0x19db643bu } },
+	{ { 0.290994763f, -0.70252353f, 0.649448037f }, { 0x54ca6495u } },
+	{ { 0.205262259f, -0.676658988f, 0.707106769f }, { 0x569a9869u } },
+	{ { 0.126701027f, -0.63696909f, 0.760405958f }, { 0x585aec41u } },
+	{ { 0.0576130301f, -0.584954917f, 0.809017003f }, { 0x59db541du } },
+	{ { 0.309597403f, -0.747434258f, 0.587785244f }, { 0x12ca089eu } },
+	{ { 0.0636570379f, -0.64632076f, 0.760405958f }, { 0x185ad821u } },
+	{ { 0.0f, -0.587785244f, 0.809017003f }, { 0x19db5000u } },
+	{ { 0.13794969f, -0.69351995f, 0.707106769f }, { 0x169a7846u } },
+	{ { 0.220734194f, -0.727663159f, 0.649448037f }, { 0x14ca3071u } },
+	{ { 0.0f, -0.649448037f, 0.760405958f }, { 0x585ad000u } },
+	{ { -0.0576130301f, -0.584954917f, 0.809017003f }, { 0x59db57e3u } },
+	{ { 0.0693085864f, -0.703701854f, 0.707106769f }, { 0x569a6023u } },
+	{ { 0.14834784f, -0.745794952f, 0.649448037f }, { 0x54ca0c4cu } },
+	{ { -0.0636570379f, -0.64632076f, 0.760405958f }, { 0x185adbdfu } },
+	{ { -0.114671215f, -0.576491117f, 0.809017003f }, { 0x19db67c5u } },
+	{ { 0.0f, -0.707106769f, 0.707106769f }, { 0x169a5c00u } },
+	{ { -0.126701027f, -0.63696909f, 0.760405958f }, { 0x585aefbfu } },
+	{ { -0.170625046f, -0.562475443f, 0.809017003f }, { 0x59db87a9u } },
+	{ { -0.0693085864f, -0.703701854f, 0.707106769f }, { 0x569a63ddu } },
+	{ { 0.0745328218f, -0.756744385f, 0.649448037f }, { 0x14c9f426u } },
+	{ { -0.188524812f, -0.621483028f, 0.760405958f }, { 0x185b0ba0u } },
+	{ { -0.224935681f, -0.543042779f, 0.809017003f }, { 0x19dbaf8du } },
+	{ { -0.13794969f, -0.69351995f, 0.707106769f }, { 0x169a7bbau } },
+	{ { -0.24853301f, -0.600011766f, 0.760405958f }, { 0x585b3781u } },
+	{ { -0.277080059f, -0.518380284f, 0.809017003f }, { 0x59dbdf72u } },
+	{ { -0.205262259f, -0.676658988f, 0.707106769f }, { 0x569a9b97u } },
+	{ { -0.306147695f, -0.572762072f, 0.760405958f }, { 0x185b6f64u } },
+	{ { -0.326555997f, -0.488725573f, 0.809017003f }, { 0x19dc1b59u } },
+	{ { -0.270598054f, -0.65328151f, 0.707106769f }, { 0x169acb76u } },
+	{ { -0.360814005f, -0.539996326f, 0.760405958f }, { 0x585bb348u } },
+	{ { -0.372887015f, -0.454364151f, 0.809017003f }, { 0x59dc6341u } },
+	{ { -0.33332783f, -0.623612523f, 0.707106769f }, { 0x569b0756u } },
+	{ { -0.412005484f, -0.502030134f, 0.760405958f }, { 0x185bff2du } },
+	{ { -0.415626943f, -0.415626943f, 0.809017003f }, { 0x19dcb32cu } },
+	{ { -0.392847478f, -0.587937772f, 0.707106769f }, { 0x169b5337u } },
+	{ { -0.459229112f, -0.459229112f, 0.760405958f }, { 0x585c5715u } },
+	{ { -0.454364151f, -0.372887015f, 0.809017003f }, { 0x59dd0718u } },
+	{ { -0.448583782f, -0.546600938f, 0.707106769f }, { 0x569ba71bu } },
+	{ { -0.502030134f, -0.412005484f, 0.760405958f }, { 0x185cb6ffu } },
+	{ { -0.488725573f, -0.326555997f, 0.809017003f }, { 0x19dd6706u } },
+	{ { -0.5f, -0.5f, 0.707106769f }, { 0x169c0300u } },
+	{ { -0.539996326f, -0.360814005f, 0.760405958f }, { 0x585d22ecu } },
+	{ { -0.518380284f, -0.277080059f, 0.809017003f }, { 0x59ddcaf7u } },
+	{ { -0.546600938f, -0.448583782f, 0.707106769f }, { 0x569c6ee9u } },
+	{ { -0.572762072f, -0.306147695f, 0.760405958f }, { 0x185d92dbu } },
+	{ { -0.543042779f, -0.224935681f, 0.809017003f }, { 0x19de36ebu } },
+	{ { -0.587937772f, -0.392847478f, 0.707106769f }, { 0x169cded4u } },
+	{ { -0.600011766f, -0.24853301f, 0.760405958f }, { 0x585e06cdu } },
+	{ { -0.562475443f, -0.170625046f, 0.809017003f }, { 0x59dea6e1u } },
+	{ { -0.623612523f, -0.33332783f, 0.707106769f }, { 0x569d5ac1u } },
+	{ { -0.621483028f, -0.188524812f, 0.760405958f }, { 0x185e82c2u } },
+	{ { -0.576491117f, -0.114671215f, 0.809017003f }, { 0x19df16d9u } },
+	{ { -0.65328151f, -0.270598054f, 0.707106769f }, { 0x169ddab2u } },
+	{ { -0.63696909f, -0.126701027f, 0.760405958f }, { 0x585efebbu } },
+	{ { -0.584954917f, -0.0576130301f, 0.809017003f }, { 0x59df8ed5u } },
+	{ { -0.676658988f, -0.205262259f, 0.707106769f }, { 0x569e5ea6u } },
+	{ { -0.64632076f, -0.0636570379f, 0.760405958f }, { 0x185f7eb6u } },
+	{ { -0.587785244f, 1.28519197e-16f, 0.809017003f }, { 0x19d002d4u } },
+	{ { -0.69351995f, -0.13794969f, 0.707106769f }, { 0x169eea9eu } },
+	{ { -0.649448037f, 1.42001765e-16f, 0.760405958f }, { 0x585002b4u } },
+	{ { -0.584954917f, 0.0576130301f, 0.809017003f }, { 0x59d076d5u } },
+	{ { -0.703701854f, -0.0693085864f, 0.707106769f }, { 0x569f7698u } },
+	{ { -0.64632076f, 0.0636570379f, 0.760405958f }, { 0x185086b6u } },
+	{ { -0.576491117f, 0.114671215f, 0.809017003f }, { 0x19d0eed9u } },
+	{ { -0.707106769f, 1.54608844e-16f, 0.707106769f }, { 0x16900297u } },
+	{ { -0.63696909f, 0.126701027f, 0.760405958f }, { 0x585106bbu } },
+	{ { -0.562475443f, 0.170625046f, 0.809017003f }, { 0x59d15ee1u } },
+	{ { -0.703701854f, 0.0693085864f, 0.707106769f }, { 0x56908e98u } },
+	{ { -0.621483028f, 0.188524812f, 0.760405958f }, { 0x185182c2u } },
+	{ { -0.543042779f, 0.224935681f, 0.809017003f }, { 0x19d1ceebu } },
+	{ { -0.69351995f, 0.13794969f, 0.707106769f }, { 0x16911a9eu } },
+	{ { -0.600011766f, 0.24853301f, 0.760405958f }, { 0x5851fecdu } },
+	{ { -0.518380284f, 0.277080059f, 0.809017003f }, { 0x59d23af7u } },
+	{ { -0.676658988f, 0.205262259f, 0.707106769f }, { 0x5691a6a6u } },
+	{ { -0.572762072f, 0.306147695f, 0.760405958f }, { 0x185272dbu } },
+	{ { -0.488725573f, 0.326555997f, 0.809017003f }, { 0x19d29f06u } },
+	{ { -0.65328151f, 0.270598054f, 0.707106769f }, { 0x16922ab2u } },
+	{ { -0.539996326f, 0.360814005f, 0.760405958f }, { 0x5852e2ecu } },
+	{ { -0.454364151f, 0.372887015f, 0.809017003f }, { 0x59d2ff18u } },
+	{ { -0.623612523f, 0.33332783f, 0.707106769f }, { 0x5692aac1u } },
+	{ { -0.502030134f, 0.412005484f, 0.760405958f }, { 0x18534effu } },
+	{ { -0.415626943f, 0.415626943f, 0.809017003f }, { 0x19d3532cu } },
+	{ { -0.587937772f, 0.392847478f, 0.707106769f }, { 0x169326d4u } },
+	{ { -0.459229112f, 0.459229112f, 0.760405958f }, { 0x5853af15u } },
+	{ { -0.372887015f, 0.454364151f, 0.809017003f }, { 0x59d3a341u } },
+	{ { -0.546600938f, 0.448583782f, 0.707106769f }, { 0x569396e9u } },
+	{ { -0.412005484f, 0.502030134f, 0.760405958f }, { 0x1854072du } },
+	{ { -0.326555997f, 0.488725573f, 0.809017003f }, { 0x19d3eb59u } },
+	{ { -0.5f, 0.5f, 0.707106769f }, { 0x16940300u } },
+	{ { -0.360814005f, 0.539996326f, 0.760405958f }, { 0x58545348u } },
+	{ { -0.277080059f, 0.518380284f, 0.809017003f }, { 0x59d42772u } },
+	{ { -0.448583782f, 0.546600938f, 0.707106769f }, { 0x56945f1bu } },
+	{ { -0.306147695f, 0.572762072f, 0.760405958f }, { 0x18549764u } },
+	{ { -0.224935681f, 0.543042779f, 0.809017003f }, { 0x19d4578du } },
+	{ { -0.392847478f, 0.587937772f, 0.707106769f }, { 0x1694b337u } },
+	{ { -0.24853301f, 0.600011766f, 0.760405958f }, { 0x5854cf81u } },
+	{ { -0.170625046f, 0.562475443f, 0.809017003f }, { 0x59d47fa9u } },
+	{ { -0.33332783f, 0.623612523f, 0.707106769f }, { 0x5694ff56u } },
+	{ { -0.188524812f, 0.621483028f, 0.760405958f }, { 0x1854fba0u } },
+	{ { -0.114671215f, 0.576491117f, 0.809017003f }, { 0x19d49fc5u } },
+	{ { -0.270598054f, 0.65328151f, 0.707106769f }, { 0x16953b76u } },
+	{ { -0.126701027f, 0.63696909f, 0.760405958f }, { 0x585517bfu } },
+	{ { -0.0576130301f, 0.584954917f, 0.809017003f }, { 0x59d4afe3u } },
+	{ { -0.205262259f, 0.676658988f, 0.707106769f }, { 0x56956b97u } },
+	{ { -0.0636570379f, 0.64632076f, 0.760405958f }, { 0x18552bdfu } },
+	{ { 1.28519197e-16f, 0.587785244f, 0.809017003f }, { 0x19d4b000u } },
+	{ { -0.13794969f, 0.69351995f, 0.707106769f }, { 0x16958bbau } },
+	{ { 1.42001765e-16f, 0.649448037f, 0.760405958f }, { 0x58553000u } },
+	{ { 0.0576130301f, 0.584954917f, 0.809017003f }, { 0x59d4ac1du } },
+	{ { -0.0693085864f, 0.703701854f, 0.707106769f }, { 0x5695a3ddu } },
+	{ { 0.0636570379f, 0.64632076f, 0.760405958f }, { 0x18552821u } },
+	{ { 0.114671215f, 0.576491117f, 0.809017003f }, { 0x19d49c3bu } },
+	{ { 1.54608844e-16f, 0.707106769f, 0.707106769f }, { 0x1695a400u } },
+	{ { 0.126701027f, 0.63696909f, 0.760405958f }, { 0x58551441u } },
+	{ { 0.170625046f, 0.562475443f, 0.809017003f }, { 0x59d47c57u } },
+	{ { 0.0693085864f, 0.703701854f, 0.707106769f }, { 0x5695a023u } },
+	{ { 0.188524812f, 0.621483028f, 0.760405958f }, { 0x1854f860u } },
+	{ { 0.224935681f, 0.543042779f, 0.809017003f }, { 0x19d45473u } },
+	{ { 0.13794969f, 0.69351995f, 0.707106769f }, { 0x16958846u } },
+	{ { 0.24853301f, 0.600011766f, 0.760405958f }, { 0x5854cc7fu } },
+	{ { 0.277080059f, 0.518380284f, 0.809017003f }, { 0x59d4248eu } },
+	{ { 0.205262259f, 0.676658988f, 0.707106769f }, { 0x56956869u } },
+	{ { 0.306147695f, 0.572762072f, 0.760405958f }, { 0x1854949cu } },
+	{ { 0.326555997f, 0.488725573f, 0.809017003f }, { 0x19d3e8a7u } },
+	{ { 0.270598054f, 0.65328151f, 0.707106769f }, { 0x1695388au } },
+	{ { 0.360814005f, 0.539996326f, 0.760405958f }, { 0x585450b8u } },
+	{ { 0.372887015f, 0.454364151f, 0.809017003f }, { 0x59d3a0bfu } },
+	{ { 0.412005484f, 0.502030134f, 0.760405958f }, { 0x185404d3u } },
+	{ { 0.33332783f, 0.623612523f, 0.707106769f }, { 0x5694fcaau } },
+	{ { 0.392847478f, 0.587937772f, 0.707106769f }, { 0x1694b0c9u } },
+	{ { 0.448583782f, 0.546600938f, 0.707106769f }, { 0x56945ce5u } },
+	{ { 0.290994763f, 0.70252353f, 0.649448037f }, { 0x54c59c95u } },
+	{ { 0.422458917f, 0.632254481f, 0.649448037f }, { 0x54c50cd8u } },
+	{ { 0.482396424f, 0.587801754f, 0.649448037f }, { 0x14c4b0f7u } },
+	{ { 0.358452886f, 0.670618176f, 0.649448037f }, { 0x14c55cb7u } },
+	{ { 0.449465752f, 0.672673047f, 0.587785244f }, { 0x12c560e6u } },
+	{ { 0.513234973f, 0.625378609f, 0.587785244f }, { 0x52c50106u } },
+	{ { 0.381367981f, 0.713489294f, 0.587785244f }, { 0x52c5b4c3u } },
+	{ { 0.473701507f, 0.70894438f, 0.522498548f }, { 0x50b5a8f2u } },
+	{ { 0.540909171f, 0.659099758f, 0.522498548f }, { 0x10b54514u } },
+	{ { 0.401931792f, 0.75196147f, 0.522498548f }, { 0x10b600cdu } },
+	{ { 0.309597403f, 0.747434258f, 0.587785244f }, { 0x12c5f89eu } },
+	{ { 0.326291263f, 0.787736773f, 0.522498548f }, { 0x50b64ca7u } },
+	{ { 0.42001757f, 0.785797596f, 0.453990489f }, { 0x4e8648d7u } },
+	{ { 0.495016694f, 0.740844846f, 0.453990489f }, { 0x0e85ecfdu } },
+	{ { 0.565248549f, 0.68875736f, 0.453990489f }, { 0x4e858121u } },
+	{ { 0.340973437f, 0.823182702f, 0.453990489f }, { 0x0e8694aeu } },
+	{ { 0.513279974f, 0.768177748f, 0.382683426f }, { 0x4c462506u } },
+	{ { 0.586102962f, 0.714168549f, 0.382683426f }, { 0x0c45b52bu } },
+	{ { 0.435513794f, 0.814788997f, 0.382683426f }, { 0x0c4680dfu } },
+	{ { 0.528378665f, 0.790774584f, 0.309017003f }, { 0x09e6510eu } },
+	{ { 0.603343844f, 0.735176623f, 0.309017003f }, { 0x49e5e134u } },
+	{ { 0.448324949f, 0.838756979f, 0.309017003f }, { 0x49e6b4e5u } },
+	{ { 0.353553385f, 0.853553414f, 0.382683426f }, { 0x4c46d0b5u } },
+	{ { 0.363953561f, 0.878661633f, 0.309017003f }, { 0x09e704bau } },
+	{ { 0.458371997f, 0.85755372f, 0.233445361f }, { 0x0776d8eau } },
+	{ { 0.540219784f, 0.808496058f, 0.233445361f }, { 0x47767514u } },
+	{ { 0.61686492f, 0.751652122f, 0.233445361f }, { 0x0776013bu } },
+	{ { 0.37210986f, 0.898352683f, 0.233445361f }, { 0x47772cbeu } },
+	{ { 0.548730254f, 0.821232855f, 0.156434461f }, { 0x05069118u } },
+	{ { 0.626582861f, 0.763493419f, 0.156434461f }, { 0x45061940u } },
+	{ { 0.46559307f, 0.871063352f, 0.156434461f }, { 0x4506f4eeu } },
+	{ { 0.553857625f, 0.828906476f, 0.0784590989f }, { 0x4286a11bu } },
+	{ { 0.632437646f, 0.770627499f, 0.0784590989f }, { 0x02862943u } },
+	{ { 0.469943583f, 0.879202604f, 0.0784590989f }, { 0x028704f0u } },
+	{ { 0.377971977f, 0.912505031f, 0.156434461f }, { 0x050748c1u } },
+	{ { 0.381503761f, 0.921031535f, 0.0784590989f }, { 0x42875cc3u } },
+	{ { 0.471396744f, 0.881921291f, 2.18649922e-16f }, { 0x40070cf1u } },
+	{ { 0.555570245f, 0.831469595f, 2.18649922e-16f }, { 0x0006a51cu } },
+	{ { 0.634393275f, 0.773010433f, 2.18649922e-16f }, { 0x40062d44u } },
+	{ { 0.382683426f, 0.923879504f, 2.18649922e-16f }, { 0x000760c4u } },
+	{ { 0.553857625f, 0.828906476f, -0.0784590989f }, { 0x7d86a11bu } },
+	{ { 0.632437646f, 0.770627499f, -0.0784590989f }, { 0x3d862943u } },
+	{ { 0.469943583f, 0.879202604f, -0.0784590989f }, { 0x3d8704f0u } },
+	{ { 0.548730254f, 0.821232855f, -0.156434461f }, { 0x3b069118u } },
+	{ { 0.626582861f, 0.763493419f, -0.156434461f }, { 0x7b061940u } },
+	{ { 0.46559307f, 0.871063352f, -0.156434461f }, { 0x7b06f4eeu } },
+	{ { 0.381503761f, 0.921031535f, -0.0784590989f }, { 0x7d875cc3u } },
+	{ { 0.377971977f, 0.912505031f, -0.156434461f }, { 0x3b0748c1u } },
+	{ { 0.458371997f, 0.85755372f, -0.233445361f }, { 0x3896d8eau } },
+	{ { 0.540219784f, 0.808496058f, -0.233445361f }, { 0x78967514u } },
+	{ { 0.61686492f, 0.751652122f, -0.233445361f }, { 0x3896013bu } },
+	{ { 0.37210986f, 0.898352683f, -0.233445361f }, { 0x78972cbeu } },
+	{ { 0.528378665f, 0.790774584f, -0.309017003f }, { 0x3626510eu } },
+	{ { 0.603343844f, 0.735176623f, -0.309017003f }, { 0x7625e134u } },
+	{ { 0.448324949f, 0.838756979f, -0.309017003f }, { 0x7626b4e5u } },
+	{ { 0.513279974f, 0.768177748f, -0.382683426f }, { 0x73c62506u } },
+	{ { 0.586102962f, 0.714168549f, -0.382683426f }, { 0x33c5b52bu } },
+	{ { 0.435513794f, 0.814788997f, -0.382683426f }, { 0x33c680dfu } },
+	{ { 0.363953561f, 0.878661633f, -0.309017003f }, { 0x362704bau } },
+	{ { 0.353553385f, 0.853553414f, -0.382683426f }, { 0x73c6d0b5u } },
+	{ { 0.42001757f, 0.785797596f, -0.453990489f }, { 0x718648d7u } },
+	{ { 0.495016694f, 0.740844846f, -0.453990489f }, { 0x3185ecfdu } },
+	{ { 0.565248549f, 0.68875736f, -0.453990489f }, { 0x71858121u } },
+	{ { 0.340973437f, 0.823182702f, -0.453990489f }, { 0x318694aeu } },
+	{ { 0.473701507f, 0.70894438f, -0.522498548f }, { 0x6f55a8f2u } },
+	{ { 0.540909171f, 0.659099758f, -0.522498548f }, { 0x2f554514u } },
+	{ { 0.401931792f, 0.75196147f, -0.522498548f }, { 0x2f5600cdu } },
+	{ { 0.449465752f, 0.672673047f, -0.587785244f }, { 0x2d4560e6u } },
+	{ { 0.513234973f, 0.625378609f, -0.587785244f }, { 0x6d450106u } },
+	{ { 0.422458917f, 0.632254481f, -0.649448037f }, { 0x6b450cd8u } },
+	{ { 0.381367981f, 0.713489294f, -0.587785244f }, { 0x6d45b4c3u } },
+	{ { 0.358452886f, 0.670618176f, -0.649448037f }, { 0x2b455cb7u } },
+	{ { 0.33332783f, 0.623612523f, -0.707106769f }, { 0x6974fcaau } },
+	{ { 0.270598054f, 0.65328151f, -0.707106769f }, { 0x2975388au } },
+	{ { 0.290994763f, 0.70252353f, -0.649448037f }, { 0x6b459c95u } },
+	{ { 0.205262259f, 0.676658988f, -0.707106769f }, { 0x69756869u } },
+	{ { 0.309597403f, 0.747434258f, -0.587785244f }, { 0x2d45f89eu } },
+	{ { 0.220734194f, 0.727663159f, -0.649448037f }, { 0x2b45d071u } },
+	{ { 0.13794969f, 0.69351995f, -0.707106769f }, { 0x29758846u } },
+	{ { 0.326291263f, 0.787736773f, -0.522498548f }, { 0x6f564ca7u } },
+	{ { 0.234845236f, 0.774181008f, -0.587785244f }, { 0x6d463078u } },
+	{ { 0.14834784f, 0.745794952f, -0.649448037f }, { 0x6b45f44cu } },
+	{ { 0.0693085864f, 0.703701854f, -0.707106769f }, { 0x6975a023u } },
+	{ { 0.247508377f, 0.815925777f, -0.522498548f }, { 0x2f56847eu } },
+	{ { 0.157831386f, 0.793471932f, -0.587785244f }, { 0x2d465451u } },
+	{ { 0.377479315f, -0.252223611f, -0.891006529f }, { 0x239dfcc1u } },
+	{ { 0.337496668f, -0.180395722f, -0.923879504f }, { 0x228e90acu } },
+	{ { 0.318189651f, -0.212607518f, -0.923879504f }, { 0x628e4ca3u } },
+	{ { 0.350939393f, -0.288008511f, -0.891006529f }, { 0x639db4b3u } },
+	{ { 0.403896838f, -0.331469566f, -0.852640152f }, { 0x24cd5cceu } },
+	{ { 0.434441686f, -0.290284663f, -0.852640152f }, { 0x64cdb0deu } },
+	{ { 0.369462281f, -0.369462281f, -0.852640152f }, { 0x64cd0cbdu } },
+	{ { 0.454364151f, -0.372887015f, -0.809017003f }, { 0x663d04e8u } },
+	{ { 0.488725573f, -0.326555997f, -0.809017003f }, { 0x263d64fau } },
+	{ { 0.415626943f, -0.415626943f, -0.809017003f }, { 0x263cb0d4u } },
+	{ { 0.372887015f, -0.454364151f, -0.809017003f }, { 0x663c60bfu } },
+	{ { 0.331469566f, -0.403896838f, -0.852640152f }, { 0x24ccc8a9u } },
+	{ { 0.326555997f, -0.488725573f, -0.809017003f }, { 0x263c18a7u } },
+	{ { 0.360814005f, -0.539996326f, -0.760405958f }, { 0x67bbb0b8u } },
+	{ { 0.306147695f, -0.572762072f, -0.760405958f }, { 0x27bb6c9cu } },
+	{ { 0.277080059f, -0.518380284f, -0.809017003f }, { 0x663bdc8eu } },
+	{ { 0.24853301f, -0.600011766f, -0.760405958f }, { 0x67bb347fu } },
+	{ { 0.224935681f, -0.543042779f, -0.809017003f }, { 0x263bac73u } },
+	{ { 0.270598054f, -0.65328151f, -0.707106769f }, { 0x297ac88au } },
+	{ { 0.188524812f, -0.621483028f, -0.760405958f }, { 0x27bb0860u } },
+	{ { 0.170625046f, -0.562475443f, -0.809017003f }, { 0x663b8457u } },
+	{ { 0.205262259f, -0.676658988f, -0.707106769f }, { 0x697a9869u } },
+	{ { 0.126701027f, -0.63696909f, -0.760405958f }, { 0x67baec41u } },
+	{ { 0.114671215f, -0.576491117f, -0.809017003f }, { 0x263b643bu } },
+	{ { 0.13794969f, -0.69351995f, -0.707106769f }, { 0x297a7846u } },
+	{ { 0.0636570379f, -0.64632076f, -0.760405958f }, { 0x27bad821u } },
+	{ { 0.0576130301f, -0.584954917f, -0.809017003f }, { 0x663b541du } },
+	{ { 0.0693085864f, -0.703701854f, -0.707106769f }, { 0x697a6023u } },
+	{ { 0.0f, -0.649448037f, -0.760405958f }, { 0x67bad000u } },
+	{ { 0.0f, -0.587785244f, -0.809017003f }, { 0x263b5000u } },
+	{ { 0.0f, -0.707106769f, -0.707106769f }, { 0x297a5c00u } },
+	{ { -0.0636570379f, -0.64632076f, -0.760405958f }, { 0x27badbdfu } },
+	{ { -0.0576130301f, -0.584954917f, -0.809017003f }, { 0x663b57e3u } },
+	{ { -0.0693085864f, -0.703701854f, -0.707106769f }, { 0x697a63ddu } },
+	{ { -0.126701027f, -0.63696909f, -0.760405958f }, { 0x67baefbfu } },
+	{ { -0.114671215f, -0.576491117f, -0.809017003f }, { 0x263b67c5u } },
+	{ { -0.13794969f, -0.69351995f, -0.707106769f }, { 0x297a7bbau } },
+	{ { -0.188524812f, -0.621483028f, -0.760405958f }, { 0x27bb0ba0u } },
+	{ { -0.170625046f, -0.562475443f, -0.809017003f }, { 0x663b87a9u } },
+	{ { -0.205262259f, -0.676658988f, -0.707106769f }, { 0x697a9b97u } },
+	{ { -0.24853301f, -0.600011766f, -0.760405958f }, { 0x67bb3781u } },
+	{ { -0.224935681f, -0.543042779f, -0.809017003f }, { 0x263baf8du } },
+	{ { -0.270598054f, -0.65328151f, -0.707106769f }, { 0x297acb76u } },
+	{ { -0.306147695f, -0.572762072f, -0.760405958f }, { 0x27bb6f64u } },
+	{ { -0.277080059f, -0.518380284f, -0.809017003f }, { 0x663bdf72u } },
+	{ { -0.33332783f, -0.623612523f, -0.707106769f }, { 0x697b0756u } },
+	{ { -0.360814005f, -0.539996326f, -0.760405958f }, { 0x67bbb348u } },
+	{ { -0.326555997f, -0.488725573f, -0.809017003f }, { 0x263c1b59u } },
+	{ { -0.392847478f, -0.587937772f, -0.707106769f }, { 0x297b5337u } },
+	{ { -0.412005484f, -0.502030134f, -0.760405958f }, { 0x27bbff2du } },
+	{ { -0.372887015f, -0.454364151f, -0.809017003f }, { 0x663c6341u } },
+	{ { -0.448583782f, -0.546600938f, -0.707106769f }, { 0x697ba71bu } },
+	{ { -0.459229112f, -0.459229112f, -0.760405958f }, { 0x67bc5715u } },
+	{ { -0.415626943f, -0.415626943f, -0.809017003f }, { 0x263cb32cu } },
+	{ { -0.5f, -0.5f, -0.707106769f }, { 0x297c0300u } },
+	{ { -0.502030134f, -0.412005484f, -0.760405958f }, { 0x27bcb6ffu } },
+	{ { -0.454364151f, -0.372887015f, -0.809017003f }, { 0x663d0718u } },
+	{ { -0.546600938f, -0.448583782f, -0.707106769f }, { 0x697c6ee9u } },
+	{ { -0.539996326f, -0.360814005f, -0.760405958f }, { 0x67bd22ecu } },
+	{ { -0.488725573f, -0.326555997f, -0.809017003f }, { 0x263d6706u } },
+	{ { -0.587937772f, -0.392847478f, -0.707106769f }, { 0x297cded4u } },
+	{ { -0.572762072f, -0.306147695f, -0.760405958f }, { 0x27bd92dbu } },
+	{ { -0.518380284f, -0.277080059f, -0.809017003f }, { 0x663dcaf7u } },
+	{ { -0.623612523f, -0.33332783f, -0.707106769f }, { 0x697d5ac1u } },
+	{ { -0.600011766f, -0.24853301f, -0.760405958f }, { 0x67be06cdu } },
+	{ { -0.543042779f, -0.224935681f, -0.809017003f }, { 0x263e36ebu } },
+	{ { -0.65328151f, -0.270598054f, -0.707106769f }, { 0x297ddab2u } },
+	{ { -0.621483028f, -0.188524812f, -0.760405958f }, { 0x27be82c2u } },
+	{ { -0.562475443f, -0.170625046f, -0.809017003f }, { 0x663ea6e1u } },
+	{ { -0.676658988f, -0.205262259f, -0.707106769f }, { 0x697e5ea6u } },
+	{ { -0.63696909f, -0.126701027f, -0.760405958f }, { 0x67befebbu } },
+	{ { -0.576491117f, -0.114671215f, -0.809017003f }, { 0x263f16d9u } },
+	{ { -0.69351995f, -0.13794969f, -0.707106769f }, { 0x297eea9eu } },
+	{ { -0.64632076f, -0.0636570379f, -0.760405958f }, { 0x27bf7eb6u } },
+	{ { -0.584954917f, -0.0576130301f, -0.809017003f }, { 0x663f8ed5u } },
+	{ { -0.703701854f, -0.0693085864f, -0.707106769f }, { 0x697f7698u } },
+	{ { -0.649448037f, 1.42001765e-16f, -0.760405958f }, { 0x67b002b4u } },
+	{ { -0.587785244f, 1.28519197e-16f, -0.809017003f }, { 0x263002d4u } },
+	{ { -0.707106769f, 1.54608844e-16f, -0.707106769f }, { 0x29700297u } },
+	{ { -0.64632076f, 0.0636570379f, -0.760405958f }, { 0x27b086b6u } },
+	{ { -0.584954917f, 0.0576130301f, -0.809017003f }, { 0x663076d5u } },
+	{ { -0.703701854f, 0.0693085864f, -0.707106769f }, { 0x69708e98u } },
+	{ { -0.63696909f, 0.126701027f, -0.760405958f }, { 0x67b106bbu } },
+	{ { -0.576491117f, 0.114671215f, -0.809017003f }, { 0x2630eed9u } },
+	{ { -0.69351995f, 0.13794969f, -0.707106769f }, { 0x29711a9eu } },
+	{ { -0.621483028f, 0.188524812f, -0.760405958f }, { 0x27b182c2u } },
+	{ { -0.562475443f, 0.170625046f, -0.809017003f }, { 0x66315ee1u } },
+	{ { -0.676658988f, 0.205262259f, -0.707106769f }, { 0x6971a6a6u } },
+	{ { -0.600011766f, 0.24853301f, -0.760405958f }, { 0x67b1fecdu } },
+	{ { -0.543042779f, 0.224935681f, -0.809017003f }, { 0x2631ceebu } },
+	{ { -0.65328151f, 0.270598054f, -0.707106769f }, { 0x29722ab2u } },
+	{ { -0.572762072f, 0.306147695f, -0.760405958f }, { 0x27b272dbu } },
+	{ { -0.518380284f, 0.277080059f, -0.809017003f }, { 0x66323af7u } },
+	{ { -0.623612523f, 0.33332783f, -0.707106769f }, { 0x6972aac1u } },
+	{ { -0.539996326f, 0.360814005f, -0.760405958f }, { 0x67b2e2ecu } },
+	{ { -0.488725573f, 0.326555997f, -0.809017003f }, { 0x26329f06u } },
+	{ { -0.587937772f, 0.392847478f, -0.707106769f }, { 0x297326d4u } },
+	{ { -0.502030134f, 0.412005484f, -0.760405958f }, { 0x27b34effu } },
+	{ { -0.454364151f, 0.372887015f, -0.809017003f }, { 0x6632ff18u } },
+	{ { -0.546600938f, 0.448583782f, -0.707106769f }, { 0x697396e9u } },
+	{ { -0.459229112f, 0.459229112f, -0.760405958f }, { 0x67b3af15u } },
+	{ { -0.415626943f, 0.415626943f, -0.809017003f }, { 0x2633532cu } },
+	{ { -0.5f, 0.5f, -0.707106769f }, { 0x29740300u } },
+	{ { -0.412005484f, 0.502030134f, -0.760405958f }, { 0x27b4072du } },
+	{ { -0.372887015f, 0.454364151f, -0.809017003f }, { 0x6633a341u } },
+	{ { -0.448583782f, 0.546600938f, -0.707106769f }, { 0x69745f1bu } },
+	{ { -0.360814005f, 0.539996326f, -0.760405958f }, { 0x67b45348u } },
+	{ { -0.326555997f, 0.488725573f, -0.809017003f }, { 0x2633eb59u } },
+	{ { -0.392847478f, 0.587937772f, -0.707106769f }, { 0x2974b337u } },
+	{ { -0.306147695f, 0.572762072f, -0.760405958f }, { 0x27b49764u } },
+	{ { -0.277080059f, 0.518380284f, -0.809017003f }, { 0x66342772u } },
+	{ { -0.33332783f, 0.623612523f, -0.707106769f }, { 0x6974ff56u } },
+	{ { -0.24853301f, 0.600011766f, -0.760405958f }, { 0x67b4cf81u } },
+	{ { -0.224935681f, 0.543042779f, -0.809017003f }, { 0x2634578du } },
+	{ { -0.270598054f, 0.65328151f, -0.707106769f }, { 0x29753b76u } },
+	{ { -0.188524812f, 0.621483028f, -0.760405958f }, { 0x27b4fba0u } },
+	{ { -0.170625046f, 0.562475443f, -0.809017003f }, { 0x66347fa9u } },
+	{ { -0.205262259f, 0.676658988f, -0.707106769f }, { 0x69756b97u } },
+	{ { -0.126701027f, 0.63696909f, -0.760405958f }, { 0x67b517bfu } },
+	{ { -0.114671215f, 0.576491117f, -0.809017003f }, { 0x26349fc5u } },
+	{ { -0.13794969f, 0.69351995f, -0.707106769f }, { 0x29758bbau } },
+	{ { -0.0636570379f, 0.64632076f, -0.760405958f }, { 0x27b52bdfu } },
+	{ { -0.0576130301f, 0.584954917f, -0.809017003f }, { 0x6634afe3u } },
+	{ { -0.0693085864f, 0.703701854f, -0.707106769f }, { 0x6975a3ddu } },
+	{ { 1.42001765e-16f, 0.649448037f, -0.760405958f }, { 0x67b53000u } },
+	{ { 1.28519197e-16f, 0.587785244f, -0.809017003f }, { 0x2634b000u } },
+	{ { 1.54608844e-16f, 0.707106769f, -0.707106769f }, { 0x2975a400u } },
+	{ { 0.0636570379f, 0.64632076f, -0.760405958f }, { 0x27b52821u } },
+	{ { 0.0576130301f, 0.584954917f, -0.809017003f }, { 0x6634ac1du } },
+	{ { 0.126701027f, 0.63696909f, -0.760405958f }, { 0x67b51441u } },
+	{ { 0.114671215f, 0.576491117f, -0.809017003f }, { 0x26349c3bu } },
+	{ { 0.188524812f, 0.621483028f, -0.760405958f }, { 0x27b4f860u } },
+	{ { 0.170625046f, 0.562475443f, -0.809017003f }, { 0x66347c57u } },
+	{ { 0.24853301f, 0.600011766f, -0.760405958f }, { 0x67b4cc7fu } },
+	{ { 0.224935681f, 0.543042779f, -0.809017003f }, { 0x26345473u } },
+	{ { 0.306147695f, 0.572762072f, -0.760405958f }, { 0x27b4949cu } },
+	{ { 0.277080059f, 0.518380284f, -0.809017003f }, { 0x6634248eu } },
+	{ { 0.360814005f, 0.539996326f, -0.760405958f }, { 0x67b450b8u } },
+	{ { 0.326555997f, 0.488725573f, -0.809017003f }, { 0x2633e8a7u } },
+	{ { 0.392847478f, 0.587937772f, -0.707106769f }, { 0x2974b0c9u } },
+	{ { 0.412005484f, 0.502030134f, -0.760405958f }, { 0x27b404d3u } },
+	{ { 0.372887015f, 0.454364151f, -0.809017003f }, { 0x6633a0bfu } },
+	{ { 0.448583782f, 0.546600938f, -0.707106769f }, { 0x69745ce5u } },
+	{ { 0.459229112f, 0.459229112f, -0.760405958f }, { 0x67b3acebu } },
+	{ { 0.415626943f, 0.415626943f, -0.809017003f }, { 0x263350d4u } },
+	{ { 0.502030134f, 0.412005484f, -0.760405958f }, { 0x27b34d01u } },
+	{ { 0.5f, 0.5f, -0.707106769f }, { 0x29740100u } },
+	{ { 0.546600938f, 0.448583782f, -0.707106769f }, { 0x69739517u } },
+	{ { 0.587937772f, 0.392847478f, -0.707106769f }, { 0x2973252cu } },
+	{ { 0.632254481f, 0.422458917f, -0.649448037f }, { 0x6b436143u } },
+	{ { 0.587801754f, 0.482396424f, -0.649448037f }, { 0x2b43dd2cu } },
+	{ { 0.672673047f, 0.449465752f, -0.587785244f }, { 0x2d439958u } },
+	{ { 0.537688196f, 0.537688196f, -0.649448037f }, { 0x6b444d13u } },
+	{ { 0.625378609f, 0.513234973f, -0.587785244f }, { 0x6d441940u } },
+	{ { 0.70894438f, 0.473701507f, -0.522498548f }, { 0x6f53c96au } },
+	{ { 0.482396424f, 0.587801754f, -0.649448037f }, { 0x2b44b0f7u } },
+	{ { 0.572061419f, 0.572061419f, -0.587785244f }, { 0x2d449124u } },
+	{ { 0.659099758f, 0.540909171f, -0.522498548f }, { 0x2f545151u } },
+	{ { 0.740844846f, 0.495016694f, -0.453990489f }, { 0x3183f57bu } },
+	{ { 0.68875736f, 0.565248549f, -0.453990489f }, { 0x71848560u } },
+	{ { 0.768177748f, 0.513279974f, -0.382683426f }, { 0x73c41989u } },
+	{ { 0.602907658f, 0.602907658f, -0.522498548f }, { 0x6f54d134u } },
+	{ { 0.714168549f, 0.586102962f, -0.382683426f }, { 0x33c4ad6du } },
+	{ { 0.790774584f, 0.528378665f, -0.309017003f }, { 0x36243994u } },
+	{ { 0.630036771f, 0.630036771f, -0.453990489f }, { 0x31850942u } },
+	{ { 0.735176623f, 0.603343844f, -0.309017003f }, { 0x7624d178u } },
+	{ { 0.808496058f, 0.540219784f, -0.233445361f }, { 0x7894519du } },
+	{ { 0.65328151f, 0.65328151f, -0.382683426f }, { 0x73c5394eu } },
+	{ { 0.751652122f, 0.61686492f, -0.233445361f }, { 0x3894ed80u } },
+	{ { 0.821232855f, 0.548730254f, -0.156434461f }, { 0x3b0461a4u } },
+	{ { 0.672498524f, 0.672498524f, -0.309017003f }, { 0x36256158u } },
+	{ { 0.763493419f, 0.626582861f, -0.156434461f }, { 0x7b050186u } },
+	{ { 0.828906476f, 0.553857625f, -0.0784590989f }, { 0x7d846da8u } },
+	{ { 0.68756938f, 0.68756938f, -0.233445361f }, { 0x78957d5fu } },
+	{ { 0.770627499f, 0.632437646f, -0.0784590989f }, { 0x3d850d8au } },
+	{ { 0.831469595f, 0.555570245f, 2.18649922e-16f }, { 0x000471a9u } },
+	{ { 0.698401153f, 0.698401153f, -0.156434461f }, { 0x3b059565u } },
+	{ { 0.773010433f, 0.634393275f, 2.18649922e-16f }, { 0x4005118bu } },
+	{ { 0.828906476f, 0.553857625f, 0.0784590989f }, { 0x42846da8u } },
+	{ { 0.704927027f, 0.704927027f, -0.0784590989f }, { 0x7d85a168u } },
+	{ { 0.770627499f, 0.632437646f, 0.0784590989f }, { 0x02850d8au } },
+	{ { 0.821232855f, 0.548730254f, 0.156434461f }, { 0x050461a4u } },
+	{ { 0.707106769f, 0.707106769f, 2.18649922e-16f }, { 0x0005a569u } },
+	{ { 0.763493419f, 0.626582861f, 0.156434461f }, { 0x45050186u } },
+	{ { 0.808496058f, 0.540219784f, 0.233445361f }, { 0x4774519du } },
+	{ { 0.704927027f, 0.704927027f, 0.0784590989f }, { 0x4285a168u } },
+	{ { 0.751652122f, 0.61686492f, 0.233445361f }, { 0x0774ed80u } },
+	{ { 0.790774584f, 0.528378665f, 0.309017003f }, { 0x09e43994u } },
+	{ { 0.698401153f, 0.698401153f, 0.156434461f }, { 0x05059565u } },
+	{ { 0.735176623f, 0.603343844f, 0.309017003f }, { 0x49e4d178u } },
+	{ { 0.768177748f, 0.513279974f, 0.382683426f }, { 0x4c441989u } },
+	{ { 0.68756938f, 0.68756938f, 0.233445361f }, { 0x47757d5fu } },
+	{ { 0.714168549f, 0.586102962f, 0.382683426f }, { 0x0c44ad6du } },
+	{ { 0.740844846f, 0.495016694f, 0.453990489f }, { 0x0e83f57bu } },
+	{ { 0.672498524f, 0.672498524f, 0.309017003f }, { 0x09e56158u } },
+	{ { 0.68875736f, 0.565248549f, 0.453990489f }, { 0x4e848560u } },
+	{ { 0.70894438f, 0.473701507f, 0.522498548f }, { 0x50b3c96au } },
+	{ { 0.65328151f, 0.65328151f, 0.382683426f }, { 0x4c45394eu } },
+	{ { 0.659099758f, 0.540909171f, 0.522498548f }, { 0x10b45151u } },
+	{ { 0.672673047f, 0.449465752f, 0.587785244f }, { 0x12c39958u } },
+	{ { 0.630036771f, 0.630036771f, 0.453990489f }, { 0x0e850942u } },
+	{ { 0.625378609f, 0.513234973f, 0.587785244f }, { 0x52c41940u } },
+	{ { 0.632254481f, 0.422458917f, 0.649448037f }, { 0x54c36143u } },
+	{ { 0.602907658f, 0.602907658f, 0.522498548f }, { 0x50b4d134u } },
+	{ { 0.587801754f, 0.482396424f, 0.649448037f }, { 0x14c3dd2cu } },
+	{ { 0.587937772f, 0.392847478f, 0.707106769f }, { 0x1693252cu } },
+	{ { 0.572061419f, 0.572061419f, 0.587785244f }, { 0x12c49124u } },
+	{ { 0.546600938f, 0.448583782f, 0.707106769f }, { 0x56939517u } },
+	{ { 0.539996326f, 0.360814005f, 0.760405958f }, { 0x5852e114u } },
+	{ { 0.537688196f, 0.537688196f, 0.649448037f }, { 0x54c44d13u } },
+	{ { 0.502030134f, 0.412005484f, 0.760405958f }, { 0x18534d01u } },
+	{ { 0.488725573f, 0.326555997f, 0.809017003f }, { 0x19d29cfau } },
+	{ { 0.5f, 0.5f, 0.707106769f }, { 0x16940100u } },
+	{ { 0.454364151f, 0.372887015f, 0.809017003f }, { 0x59d2fce8u } },
+	{ { 0.434441686f, 0.290284663f, 0.852640152f }, { 0x5b4250deu } },
+	{ { 0.459229112f, 0.459229112f, 0.760405958f }, { 0x5853acebu } },
+	{ { 0.415626943f, 0.415626943f, 0.809017003f }, { 0x19d350d4u } },
+	{ { 0.403896838f, 0.331469566f, 0.852640152f }, { 0x1b42a4ceu } },
+	{ { 0.377479315f, 0.252223611f, 0.891006529f }, { 0x1c7204c1u } },
+	{ { 0.40038389f, 0.214009643f, 0.891006529f }, { 0x5c71b4cdu } },
+	{ { 0.337496668f, 0.180395722f, 0.923879504f }, { 0x1d8170acu } },
+	{ { 0.318189651f, 0.212607518f, 0.923879504f }, { 0x5d81b4a3u } },
+	{ { 0.350939393f, 0.288008511f, 0.891006529f }, { 0x5c724cb3u } },
+	{ { 0.295818299f, 0.242771804f, 0.923879504f }, { 0x1d81f097u } },
+	{ { 0.369462281f, 0.369462281f, 0.852640152f }, { 0x5b42f4bdu } },
+	{ { 0.321019769f, 0.321019769f, 0.891006529f }, { 0x1c7290a4u } },
+	{ { 0.270598054f, 0.270598054f, 0.923879504f }, { 0x5d82288au } },
+	{ { 0.331469566f, 0.403896838f, 0.852640152f }, { 0x1b4338a9u } },
+	{ { 0.288008511f, 0.350939393f, 0.891006529f }, { 0x5c72cc93u } },
+	{ { 0.242771804f, 0.295818299f, 0.923879504f }, { 0x1d825c7cu } },
+	{ { 0.252223611f, 0.377479315f, 0.891006529f }, { 0x1c730481u } },
+	{ { 0.212607518f, 0.318189651f, 0.923879504f }, { 0x5d828c6du } },
+	{ { 0.290284663f, 0.434441686f, 0.852640152f }, { 0x5b437894u } },
+	{ { 0.214009643f, 0.40038389f, 0.891006529f }, { 0x5c73346du } },
+	{ { 0.180395722f, 0.337496668f, 0.923879504f }, { 0x1d82b05cu } },
+	{ { 0.246304125f, 0.460802585f, 0.852640152f }, { 0x1b43ac7eu } },
+	{ { 0.17373465f, 0.419432521f, 0.891006529f }, { 0x1c735859u } },
+	{ { 0.146446615f, 0.353553385f, 0.923879504f }, { 0x5d82d44bu } },
+	{ { 0.199951544f, 0.482725739f, 0.852640152f }, { 0x5b43dc66u } },
+	{ { 0.151673332f, 0.49999994f, 0.852640152f }, { 0x1b43fc4eu } },
+	{ { 0.131786481f, 0.434441835f, 0.891006529f }, { 0x5c737843u } },
+	{ { 0.111087136f, 0.366205215f, 0.923879504f }, { 0x1d82ec39u } },
+	{ { 0.0885691494f, 0.4452672f, 0.891006529f }, { 0x1c73902du } },
+	{ { 0.0746578351f, 0.375330269f, 0.923879504f }, { 0x5d830026u } },
+	{ { 0.101934411f, 0.51245892f, 0.852640152f }, { 0x5b441834u } },
+	{ { 0.0444988497f, 0.451804399f, 0.891006529f }, { 0x5c739c17u } },
+	{ { 0.0375095345f, 0.380840719f, 0.923879504f }, { 0x1d830c13u } },
+	{ { 0.0512138158f, 0.519982576f, 0.852640152f }, { 0x1b44281au } },
+	{ { 1.1424427e-16f, 0.522498548f, 0.852640152f }, { 0x5b442c00u } },
+	{ { 9.92649888e-17f, 0.453990489f, 0.891006529f }, { 0x1c73a000u } },
+	{ { 8.36736997e-17f, 0.382683426f, 0.923879504f }, { 0x5d831000u } },
+	{ { -0.0444988497f, 0.451804399f, 0.891006529f }, { 0x5c739fe9u } },
+	{ { -0.0375095345f, 0.380840719f, 0.923879504f }, { 0x1d830fedu } },
+	{ { -0.0512138158f, 0.519982576f, 0.852640152f }, { 0x1b442be6u } },
+	{ { -0.0885691494f, 0.4452672f, 0.891006529f }, { 0x1c7393d3u } },
+	{ { -0.0746578351f, 0.375330269f, 0.923879504f }, { 0x5d8303dau } },
+	{ { -0.101934411f, 0.51245892f, 0.852640152f }, { 0x5b441bccu } },
+	{ { 0.326291263f, -0.787736773f, 0.522498548f }, { 0x50b9b4a7u } },
+	{ { 0.340973437f, -0.823182702f, 0.453990489f }, { 0x0e896caeu } },
+	{ { 0.247508377f, -0.815925777f, 0.522498548f }, { 0x10b97c7eu } },
+	{ { 0.258645535f, -0.852640092f, 0.453990489f }, { 0x4e893084u } },
+	{ { 0.234845236f, -0.774181008f, 0.587785244f }, { 0x52c9d078u } },
+	{ { 0.157831386f, -0.793471932f, 0.587785244f }, { 0x12c9ac51u } },
+	{ { 0.166341841f, -0.836256921f, 0.522498548f }, { 0x50b95455u } },
+	{ { 0.173826754f, -0.873886108f, 0.453990489f }, { 0x0e890459u } },
+	{ { 0.0792975351f, -0.805121362f, 0.587785244f }, { 0x52c99429u } },
+	{ { 0.0835733488f, -0.848534465f, 0.522498548f }, { 0x10b9382bu } },
+	{ { 0.0f, -0.760405958f, 0.649448037f }, { 0x54c9ec00u } },
+	{ { 0.0f, -0.809017003f, 0.587785244f }, { 0x12c98c00u } },
+	{ { -0.0745328218f, -0.756744385f, 0.649448037f }, { 0x14c9f7dau } },
+	{ { 0.0f, -0.852640152f, 0.522498548f }, { 0x50b93000u } },
+	{ { -0.14834784f, -0.745794952f, 0.649448037f }, { 0x54ca0fb4u } },
+	{ { -0.0792975351f, -0.805121362f, 0.587785244f }, { 0x52c997d7u } },
+	{ { -0.220734194f, -0.727663159f, 0.649448037f }, { 0x14ca338fu } },
+	{ { -0.157831386f, -0.793471932f, 0.587785244f }, { 0x12c9afafu } },
+	{ { -0.290994763f, -0.70252353f, 0.649448037f }, { 0x54ca676bu } },
+	{ { -0.234845236f, -0.774181008f, 0.587785244f }, { 0x52c9d388u } },
+	{ { -0.0835733488f, -0.848534465f, 0.522498548f }, { 0x10b93bd5u } },
+	{ { -0.358452886f, -0.670618176f, 0.649448037f }, { 0x14caa749u } },
+	{ { -0.309597403f, -0.747434258f, 0.587785244f }, { 0x12ca0b62u } },
+	{ { -0.422458917f, -0.632254481f, 0.649448037f }, { 0x54caf728u } },
+	{ { -0.381367981f, -0.713489294f, 0.587785244f }, { 0x52ca4f3du } },
+	{ { -0.482396424f, -0.587801754f, 0.649448037f }, { 0x14cb5309u } },
+	{ { -0.449465752f, -0.672673047f, 0.587785244f }, { 0x12caa31au } },
+	{ { -0.537688196f, -0.537688196f, 0.649448037f }, { 0x54cbb6edu } },
+	{ { -0.513234973f, -0.625378609f, 0.587785244f }, { 0x52cb02fau } },
+	{ { -0.587801754f, -0.482396424f, 0.649448037f }, { 0x14cc26d4u } },
+	{ { -0.572061419f, -0.572061419f, 0.587785244f }, { 0x12cb72dcu } },
+	{ { -0.632254481f, -0.422458917f, 0.649448037f }, { 0x54cca2bdu } },
+	{ { -0.625378609f, -0.513234973f, 0.587785244f }, { 0x52cbeac0u } },
+	{ { -0.670618176f, -0.358452886f, 0.649448037f }, { 0x14cd26a9u } },
+	{ { -0.672673047f, -0.449465752f, 0.587785244f }, { 0x12cc6aa8u } },
+	{ { -0.70252353f, -0.290994763f, 0.649448037f }, { 0x54cdae99u } },
+	{ { -0.713489294f, -0.381367981f, 0.587785244f }, { 0x52ccf693u } },
+	{ { -0.727663159f, -0.220734194f, 0.649448037f }, { 0x14ce3e8cu } },
+	{ { -0.747434258f, -0.309597403f, 0.587785244f }, { 0x12cd8a82u } },
+	{ { -0.745794952f, -0.14834784f, 0.649448037f }, { 0x54ced283u } },
+	{ { -0.774181008f, -0.234845236f, 0.587785244f }, { 0x52ce2274u } },
+	{ { -0.756744385f, -0.0745328218f, 0.649448037f }, { 0x14cf6a7du } },
+	{ { -0.793471932f, -0.157831386f, 0.587785244f }, { 0x12cebe6bu } },
+	{ { -0.760405958f, 1.66262708e-16f, 0.649448037f }, { 0x54c0027bu } },
+	{ { -0.805121362f, -0.0792975351f, 0.587785244f }, { 0x52cf5e65u } },
+	{ { -0.756744385f, 0.0745328218f, 0.649448037f }, { 0x14c09a7du } },
+	{ { -0.809017003f, 1.76891502e-16f, 0.587785244f }, { 0x12c00263u } },
+	{ { -0.745794952f, 0.14834784f, 0.649448037f }, { 0x54c13283u } },
+	{ { -0.805121362f, 0.0792975351f, 0.587785244f }, { 0x52c0a665u } },
+	{ { -0.727663159f, 0.220734194f, 0.649448037f }, { 0x14c1c68cu } },
+	{ { -0.793471932f, 0.157831386f, 0.587785244f }, { 0x12c1466bu } },
+	{ { -0.70252353f, 0.290994763f, 0.649448037f }, { 0x54c25699u } },
+	{ { -0.774181008f, 0.234845236f, 0.587785244f }, { 0x52c1e274u } },
+	{ { -0.670618176f, 0.358452886f, 0.649448037f }, { 0x14c2dea9u } },
+	{ { -0.747434258f, 0.309597403f, 0.587785244f }, { 0x12c27a82u } },
+	{ { -0.632254481f, 0.422458917f, 0.649448037f }, { 0x54c362bdu } },
+	{ { -0.713489294f, 0.381367981f, 0.587785244f }, { 0x52c30e93u } },
+	{ { -0.587801754f, 0.482396424f, 0.649448037f }, { 0x14c3ded4u } },
+	{ { -0.672673047f, 0.449465752f, 0.587785244f }, { 0x12c39aa8u } },
+	{ { -0.537688196f, 0.537688196f, 0.649448037f }, { 0x54c44eedu } },
+	{ { -0.625378609f, 0.513234973f, 0.587785244f }, { 0x52c41ac0u } },
+	{ { -0.482396424f, 0.587801754f, 0.649448037f }, { 0x14c4b309u } },
+	{ { -0.572061419f, 0.572061419f, 0.587785244f }, { 0x12c492dcu } },
+	{ { -0.422458917f, 0.632254481f, 0.649448037f }, { 0x54c50f28u } },
+	{ { -0.513234973f, 0.625378609f, 0.587785244f }, { 0x52c502fau } },
+	{ { -0.358452886f, 0.670618176f, 0.649448037f }, { 0x14c55f49u } },
+	{ { -0.449465752f, 0.672673047f, 0.587785244f }, { 0x12c5631au } },
+	{ { -0.290994763f, 0.70252353f, 0.649448037f }, { 0x54c59f6bu } },
+	{ { -0.381367981f, 0.713489294f, 0.587785244f }, { 0x52c5b73du } },
+	{ { -0.220734194f, 0.727663159f, 0.649448037f }, { 0x14c5d38fu } },
+	{ { -0.309597403f, 0.747434258f, 0.587785244f }, { 0x12c5fb62u } },
+	{ { -0.14834784f, 0.745794952f, 0.649448037f }, { 0x54c5f7b4u } },
+	{ { -0.234845236f, 0.774181008f, 0.587785244f }, { 0x52c63388u } },
+	{ { -0.0745328218f, 0.756744385f, 0.649448037f }, { 0x14c60fdau } },
+	{ { -0.157831386f, 0.793471932f, 0.587785244f }, { 0x12c657afu } },
+	{ { 1.66262708e-16f, 0.760405958f, 0.649448037f }, { 0x54c61400u } },
+	{ { -0.0792975351f, 0.805121362f, 0.587785244f }, { 0x52c66fd7u } },
+	{ { 0.0745328218f, 0.756744385f, 0.649448037f }, { 0x14c60c26u } },
+	{ { 1.76891502e-16f, 0.809017003f, 0.587785244f }, { 0x12c67400u } },
+	{ { 0.14834784f, 0.745794952f, 0.649448037f }, { 0x54c5f44cu } },
+	{ { 0.0792975351f, 0.805121362f, 0.587785244f }, { 0x52c66c29u } },
+	{ { 0.220734194f, 0.727663159f, 0.649448037f }, { 0x14c5d071u } },
+	{ { 0.157831386f, 0.793471932f, 0.587785244f }, { 0x12c65451u } },
+	{ { 0.234845236f, 0.774181008f, 0.587785244f }, { 0x52c63078u } },
+	{ { 0.0835733488f, 0.848534465f, 0.522498548f }, { 0x10b6c82bu } },
+	{ { 0.247508377f, 0.815925777f, 0.522498548f }, { 0x10b6847eu } },
+	{ { 0.166341841f, 0.836256921f, 0.522498548f }, { 0x50b6ac55u } },
+	{ { 0.258645535f, 0.852640092f, 0.453990489f }, { 0x4e86d084u } },
+	{ { 0.173826754f, 0.873886108f, 0.453990489f }, { 0x0e86fc59u } },
+	{ { 0.268188059f, 0.884097576f, 0.382683426f }, { 0x0c471089u } },
+	{ { 0.180239961f, 0.906127453f, 0.382683426f }, { 0x4c473c5cu } },
+	{ { 0.0873339102f, 0.886716068f, 0.453990489f }, { 0x4e87142du } },
+	{ { 0.090556033f, 0.919430792f, 0.382683426f }, { 0x0c47582eu } },
+	{ { 0.185541928f, 0.932782233f, 0.309017003f }, { 0x09e7745fu } },
+	{ { 0.276077121f, 0.910104334f, 0.309017003f }, { 0x49e7448du } },
+	{ { 0.093219839f, 0.946476936f, 0.309017003f }, { 0x49e79030u } },
+	{ { 0.282264084f, 0.930499971f, 0.233445361f }, { 0x07776c90u } },
+	{ { 0.189699963f, 0.953686118f, 0.233445361f }, { 0x47779c61u } },
+	{ { 0.286710799f, 0.945158839f, 0.156434461f }, { 0x45078c93u } },
+	{ { 0.192688435f, 0.968710184f, 0.156434461f }, { 0x0507bc62u } },
+	{ { 0.0953089222f, 0.967687666f, 0.233445361f }, { 0x0777b831u } },
+	{ { 0.0968103856f, 0.982932329f, 0.156434461f }, { 0x4507d831u } },
+	{ { 0.194488928f, 0.977761865f, 0.0784590989f }, { 0x4287d063u } },
+	{ { 0.289389819f, 0.9539904f, 0.0784590989f }, { 0x02879c94u } },
+	{ { 0.0977149829f, 0.992116928f, 0.0784590989f }, { 0x0287ec32u } },
+	{ { 0.290284663f, 0.956940353f, 2.18649922e-16f }, { 0x4007a494u } },
+	{ { 0.195090324f, 0.980785251f, 2.18649922e-16f }, { 0x0007d464u } },
+	{ { 0.289389819f, 0.9539904f, -0.0784590989f }, { 0x3d879c94u } },
+	{ { 0.194488928f, 0.977761865f, -0.0784590989f }, { 0x7d87d063u } },
+	{ { 0.0980171412f, 0.99518472f, 2.18649922e-16f }, { 0x4007f432u } },
+	{ { 0.0977149829f, 0.992116928f, -0.0784590989f }, { 0x3d87ec32u } },
+	{ { 0.192688435f, 0.968710184f, -0.156434461f }, { 0x3b07bc62u } },
+	{ { 0.286710799f, 0.945158839f, -0.156434461f }, { 0x7b078c93u } },
+	{ { 0.0968103856f, 0.982932329f, -0.156434461f }, { 0x7b07d831u } },
+	{ { 0.282264084f, 0.930499971f, -0.233445361f }, { 0x38976c90u } },
+	{ { 0.189699963f, 0.953686118f, -0.233445361f }, { 0x78979c61u } },
+	{ { 0.276077121f, 0.910104334f, -0.309017003f }, { 0x7627448du } },
+	{ { 0.185541928f, 0.932782233f, -0.309017003f }, { 0x3627745fu } },
+	{ { 0.0953089222f, 0.967687666f, -0.233445361f }, { 0x3897b831u } },
+	{ { 0.093219839f, 0.946476936f, -0.309017003f }, { 0x76279030u } },
+	{ { 0.180239961f, 0.906127453f, -0.382683426f }, { 0x73c73c5cu } },
+	{ { 0.268188059f, 0.884097576f, -0.382683426f }, { 0x33c71089u } },
+	{ { 0.258645535f, 0.852640092f, -0.453990489f }, { 0x7186d084u } },
+	{ { 0.173826754f, 0.873886108f, -0.453990489f }, { 0x3186fc59u } },
+	{ { 0.166341841f, 0.836256921f, -0.522498548f }, { 0x6f56ac55u } },
+	{ { 0.0835733488f, 0.848534465f, -0.522498548f }, { 0x2f56c82bu } },
+	{ { 0.0873339102f, 0.886716068f, -0.453990489f }, { 0x7187142du } },
+	{ { 1.86429702e-16f, 0.852640152f, -0.522498548f }, { 0x6f56d000u } },
+	{ { 0.090556033f, 0.919430792f, -0.382683426f }, { 0x33c7582eu } },
+	{ { 1.94818504e-16f, 0.891006529f, -0.453990489f }, { 0x31871c00u } },
+	{ { -0.0835733488f, 0.848534465f, -0.522498548f }, { 0x2f56cbd5u } },
+	{ { 2.02006188e-16f, 0.923879504f, -0.382683426f }, { 0x73c76000u } },
+	{ { -0.0873339102f, 0.886716068f, -0.453990489f }, { 0x718717d3u } },
+	{ { -0.166341841f, 0.836256921f, -0.522498548f }, { 0x6f56afabu } },
+	{ { 2.07948428e-16f, 0.95105654f, -0.309017003f }, { 0x36279800u } },
+	{ { -0.090556033f, 0.919430792f, -0.382683426f }, { 0x33c75bd2u } },
+	{ { -0.173826754f, 0.873886108f, -0.453990489f }, { 0x3186ffa7u } },
+	{ { -0.247508377f, 0.815925777f, -0.522498548f }, { 0x2f568782u } },
+	{ { 2.12608605e-16f, 0.972369909f, -0.233445361f }, { 0x7897c400u } },
+	{ { -0.258645535f, 0.852640092f, -0.453990489f }, { 0x7186d37cu } },
+	{ { -0.326291263f, 0.787736773f, -0.522498548f }, { 0x6f564f59u } },
+	{ { -0.180239961f, 0.906127453f, -0.382683426f }, { 0x73c73fa4u } },
+	{ { -0.093219839f, 0.946476936f, -0.309017003f }, { 0x762793d0u } },
+	{ { 0.252223611f, -0.377479315f, -0.891006529f }, { 0x239cfc81u } },
+	{ { 0.242771804f, -0.295818299f, -0.923879504f }, { 0x228da47cu } },
+	{ { 0.212607518f, -0.318189651f, -0.923879504f }, { 0x628d746du } },
+	{ { 0.214009643f, -0.40038389f, -0.891006529f }, { 0x639ccc6du } },
+	{ { 0.218508005f, -0.218508005f, -0.95105654f }, { 0x21ae4070u } },
+	{ { 0.238873363f, -0.196038306f, -0.95105654f }, { 0x61ae707au } },
+	{ { 0.1804557f, -0.148096174f, -0.972369909f }, { 0x20fed05cu } },
+	{ { 0.194102719f, -0.129695296f, -0.972369909f }, { 0x60fef863u } },
+	{ { 0.270598054f, -0.270598054f, -0.923879504f }, { 0x628dd88au } },
+	{ { 0.256938249f, -0.171680644f, -0.95105654f }, { 0x21aea083u } },
+	{ { 0.205880433f, -0.110045381f, -0.972369909f }, { 0x20ff2069u } },
+	{ { 0.295818299f, -0.242771804f, -0.923879504f }, { 0x228e1097u } },
+	{ { 0.288008511f, -0.350939393f, -0.891006529f }, { 0x639d3493u } },
+	{ { 0.321019769f, -0.321019769f, -0.891006529f }, { 0x239d70a4u } },
+	{ { 0.290284663f, -0.434441686f, -0.852640152f }, { 0x64cc8894u } },
+	{ { 0.246304125f, -0.460802585f, -0.852640152f }, { 0x24cc547eu } },
+	{ { 0.199951544f, -0.482725739f, -0.852640152f }, { 0x64cc2466u } },
+	{ { 0.17373465f, -0.419432521f, -0.891006529f }, { 0x239ca859u } },
+	{ { 0.151673332f, -0.49999994f, -0.852640152f }, { 0x24cc044eu } },
+	{ { 0.131786481f, -0.434441835f, -0.891006529f }, { 0x639c8843u } },
+	{ { 0.101934411f, -0.51245892f, -0.852640152f }, { 0x64cbe834u } },
+	{ { 0.0885691494f, -0.4452672f, -0.891006529f }, { 0x239c702du } },
+	{ { 0.0512138158f, -0.519982576f, -0.852640152f }, { 0x24cbd81au } },
+	{ { 0.0444988497f, -0.451804399f, -0.891006529f }, { 0x639c6417u } },
+	{ { 0.0f, -0.522498548f, -0.852640152f }, { 0x64cbd400u } },
+	{ { 0.0f, -0.453990489f, -0.891006529f }, { 0x239c6000u } },
+	{ { -0.0512138158f, -0.519982576f, -0.852640152f }, { 0x24cbdbe6u } },
+	{ { -0.0444988497f, -0.451804399f, -0.891006529f }, { 0x639c67e9u } },
+	{ { -0.101934411f, -0.51245892f, -0.852640152f }, { 0x64cbebccu } },
+	{ { -0.0885691494f, -0.4452672f, -0.891006529f }, { 0x239c73d3u } },
+	{ { -0.151673332f, -0.49999994f, -0.852640152f }, { 0x24cc07b2u } },
+	{ { -0.131786481f, -0.434441835f, -0.891006529f }, { 0x639c8bbdu } },
+	{ { -0.199951544f, -0.482725739f, -0.852640152f }, { 0x64cc279au } },
+	{ { -0.17373465f, -0.419432521f, -0.891006529f }, { 0x239caba7u } },
+	{ { -0.246304125f, -0.460802585f, -0.852640152f }, { 0x24cc5782u } },
+	{ { -0.214009643f, -0.40038389f, -0.891006529f }, { 0x639ccf93u } },
+	{ { -0.290284663f, -0.434441686f, -0.852640152f }, { 0x64cc8b6cu } },
+	{ { -0.252223611f, -0.377479315f, -0.891006529f }, { 0x239cff7fu } },
+	{ { -0.331469566f, -0.403896838f, -0.852640152f }, { 0x24cccb57u } },
+	{ { -0.288008511f, -0.350939393f, -0.891006529f }, { 0x639d376du } },
+	{ { -0.369462281f, -0.369462281f, -0.852640152f }, { 0x64cd0f43u } },
+	{ { -0.321019769f, -0.321019769f, -0.891006529f }, { 0x239d735cu } },
+	{ { -0.403896838f, -0.331469566f, -0.852640152f }, { 0x24cd5f32u } },
+	{ { -0.350939393f, -0.288008511f, -0.891006529f }, { 0x639db74du } },
+	{ { -0.434441686f, -0.290284663f, -0.852640152f }, { 0x64cdb322u } },
+	{ { -0.377479315f, -0.252223611f, -0.891006529f }, { 0x239dff3fu } },
+	{ { -0.460802585f, -0.246304125f, -0.852640152f }, { 0x24ce0b15u } },
+	{ { -0.40038389f, -0.214009643f, -0.891006529f }, { 0x639e4f33u } },
+	{ { -0.482725739f, -0.199951544f, -0.852640152f }, { 0x64ce6b09u } },
+	{ { -0.419432521f, -0.17373465f, -0.891006529f }, { 0x239e9f2au } },
+	{ { -0.49999994f, -0.151673332f, -0.852640152f }, { 0x24cecb01u } },
+	{ { -0.434441835f, -0.131786481f, -0.891006529f }, { 0x639ef722u } },
+	{ { -0.51245892f, -0.101934411f, -0.852640152f }, { 0x64cf32fau } },
+	{ { -0.4452672f, -0.0885691494f, -0.891006529f }, { 0x239f4f1cu } },
+	{ { -0.519982576f, -0.0512138158f, -0.852640152f }, { 0x24cf9af6u } },
+	{ { -0.451804399f, -0.0444988497f, -0.891006529f }, { 0x639fa719u } },
+	{ { -0.522498548f, 1.1424427e-16f, -0.852640152f }, { 0x64c002f5u } },
+	{ { -0.453990489f, 9.92649888e-17f, -0.891006529f }, { 0x23900318u } },
+	{ { -0.519982576f, 0.0512138158f, -0.852640152f }, { 0x24c06af6u } },
+	{ { -0.451804399f, 0.0444988497f, -0.891006529f }, { 0x63905f19u } },
+	{ { -0.51245892f, 0.101934411f, -0.852640152f }, { 0x64c0d2fau } },
+	{ { -0.4452672f, 0.0885691494f, -0.891006529f }, { 0x2390b71cu } },
+	{ { -0.49999994f, 0.151673332f, -0.852640152f }, { 0x24c13b01u } },
+	{ { -0.434441835f, 0.131786481f, -0.891006529f }, { 0x63910f22u } },
+	{ { -0.482725739f, 0.199951544f, -0.852640152f }, { 0x64c19b09u } },
+	{ { -0.419432521f, 0.17373465f, -0.891006529f }, { 0x2391672au } },
+	{ { -0.460802585f, 0.246304125f, -0.852640152f }, { 0x24c1fb15u } },
+	{ { -0.40038389f, 0.214009643f, -0.891006529f }, { 0x6391b733u } },
+	{ { -0.434441686f, 0.290284663f, -0.852640152f }, { 0x64c25322u } },
+	{ { -0.377479315f, 0.252223611f, -0.891006529f }, { 0x2392073fu } },
+	{ { -0.403896838f, 0.331469566f, -0.852640152f }, { 0x24c2a732u } },
+	{ { -0.350939393f, 0.288008511f, -0.891006529f }, { 0x63924f4du } },
+	{ { -0.369462281f, 0.369462281f, -0.852640152f }, { 0x64c2f743u } },
+	{ { -0.321019769f, 0.321019769f, -0.891006529f }, { 0x2392935cu } },
+	{ { -0.331469566f, 0.403896838f, -0.852640152f }, { 0x24c33b57u } },
+	{ { -0.288008511f, 0.350939393f, -0.891006529f }, { 0x6392cf6du } },
+	{ { -0.290284663f, 0.434441686f, -0.852640152f }, { 0x64c37b6cu } },
+	{ { -0.252223611f, 0.377479315f, -0.891006529f }, { 0x2393077fu } },
+	{ { -0.246304125f, 0.460802585f, -0.852640152f }, { 0x24c3af82u } },
+	{ { -0.214009643f, 0.40038389f, -0.891006529f }, { 0x63933793u } },
+	{ { -0.199951544f, 0.482725739f, -0.852640152f }, { 0x64c3df9au } },
+	{ { -0.17373465f, 0.419432521f, -0.891006529f }, { 0x23935ba7u } },
+	{ { -0.151673332f, 0.49999994f, -0.852640152f }, { 0x24c3ffb2u } },
+	{ { -0.131786481f, 0.434441835f, -0.891006529f }, { 0x63937bbdu } },
+	{ { -0.101934411f, 0.51245892f, -0.852640152f }, { 0x64c41bccu } },
+	{ { -0.0885691494f, 0.4452672f, -0.891006529f }, { 0x239393d3u } },
+	{ { -0.0512138158f, 0.519982576f, -0.852640152f }, { 0x24c42be6u } },
+	{ { -0.0444988497f, 0.451804399f, -0.891006529f }, { 0x63939fe9u } },
+	{ { 1.1424427e-16f, 0.522498548f, -0.852640152f }, { 0x64c42c00u } },
+	{ { 9.92649888e-17f, 0.453990489f, -0.891006529f }, { 0x2393a000u } },
+	{ { 0.0512138158f, 0.519982576f, -0.852640152f }, { 0x24c4281au } },
+	{ { 0.0444988497f, 0.451804399f, -0.891006529f }, { 0x63939c17u } },
+	{ { 0.101934411f, 0.51245892f, -0.852640152f }, { 0x64c41834u } },
+	{ { 0.0885691494f, 0.4452672f, -0.891006529f }, { 0x2393902du } },
+	{ { 0.151673332f, 0.49999994f, -0.852640152f }, { 0x24c3fc4eu } },
+	{ { 0.131786481f, 0.434441835f, -0.891006529f }, { 0x63937843u } },
+	{ { 0.199951544f, 0.482725739f, -0.852640152f }, { 0x64c3dc66u } },
+	{ { 0.17373465f, 0.419432521f, -0.891006529f }, { 0x23935859u } },
+	{ { 0.246304125f, 0.460802585f, -0.852640152f }, { 0x24c3ac7eu } },
+	{ { 0.214009643f, 0.40038389f, -0.891006529f }, { 0x6393346du } },
+	{ { 0.290284663f, 0.434441686f, -0.852640152f }, { 0x64c37894u } },
+	{ { 0.252223611f, 0.377479315f, -0.891006529f }, { 0x23930481u } },
+	{ { 0.331469566f, 0.403896838f, -0.852640152f }, { 0x24c338a9u } },
+	{ { 0.288008511f, 0.350939393f, -0.891006529f }, { 0x6392cc93u } },
+	{ { 0.369462281f, 0.369462281f, -0.852640152f }, { 0x64c2f4bdu } },
+	{ { 0.321019769f, 0.321019769f, -0.891006529f }, { 0x239290a4u } },
+	{ { 0.403896838f, 0.331469566f, -0.852640152f }, { 0x24c2a4ceu } },
+	{ { 0.350939393f, 0.288008511f, -0.891006529f }, { 0x63924cb3u } },
+	{ { 0.454364151f, 0.372887015f, -0.809017003f }, { 0x6632fce8u } },
+	{ { 0.434441686f, 0.290284663f, -0.852640152f }, { 0x64c250deu } },
+	{ { 0.377479315f, 0.252223611f, -0.891006529f }, { 0x239204c1u } },
+	{ { 0.488725573f, 0.326555997f, -0.809017003f }, { 0x26329cfau } },
+	{ { 0.460802585f, 0.246304125f, -0.852640152f }, { 0x24c1f8ebu } },
+	{ { 0.40038389f, 0.214009643f, -0.891006529f }, { 0x6391b4cdu } },
+	{ { 0.482725739f, 0.199951544f, -0.852640152f }, { 0x64c198f7u } },
+	{ { 0.518380284f, 0.277080059f, -0.809017003f }, { 0x66323909u } },
+	{ { 0.543042779f, 0.224935681f, -0.809017003f }, { 0x2631cd15u } },
+	{ { 0.562475443f, 0.170625046f, -0.809017003f }, { 0x66315d1fu } },
+	{ { 0.621483028f, 0.188524812f, -0.760405958f }, { 0x27b1813eu } },
+	{ { 0.600011766f, 0.24853301f, -0.760405958f }, { 0x67b1fd33u } },
+	{ { 0.676658988f, 0.205262259f, -0.707106769f }, { 0x6971a55au } },
+	{ { 0.572762072f, 0.306147695f, -0.760405958f }, { 0x27b27125u } },
+	{ { 0.65328151f, 0.270598054f, -0.707106769f }, { 0x2972294eu } },
+	{ { 0.727663159f, 0.220734194f, -0.649448037f }, { 0x2b41c574u } },
+	{ { 0.539996326f, 0.360814005f, -0.760405958f }, { 0x67b2e114u } },
+	{ { 0.623612523f, 0.33332783f, -0.707106769f }, { 0x6972a93fu } },
+	{ { 0.70252353f, 0.290994763f, -0.649448037f }, { 0x6b425567u } },
+	{ { 0.774181008f, 0.234845236f, -0.587785244f }, { 0x6d41e18cu } },
+	{ { 0.747434258f, 0.309597403f, -0.587785244f }, { 0x2d42797eu } },
+	{ { 0.815925777f, 0.247508377f, -0.522498548f }, { 0x2f51f9a1u } },
+	{ { 0.670618176f, 0.358452886f, -0.649448037f }, { 0x2b42dd57u } },
+	{ { 0.787736773f, 0.326291263f, -0.522498548f }, { 0x6f529d93u } },
+	{ { 0.852640092f, 0.258645535f, -0.453990489f }, { 0x718211b4u } },
+	{ { 0.713489294f, 0.381367981f, -0.587785244f }, { 0x6d430d6du } },
+	{ { 0.823182702f, 0.340973437f, -0.453990489f }, { 0x3182b9a5u } },
+	{ { 0.884097576f, 0.268188059f, -0.382683426f }, { 0x33c225c4u } },
+	{ { 0.75196147f, 0.401931792f, -0.522498548f }, { 0x2f533580u } },
+	{ { 0.853553414f, 0.353553385f, -0.382683426f }, { 0x73c2d5b4u } },
+	{ { 0.910104334f, 0.276077121f, -0.309017003f }, { 0x762235d1u } },
+	{ { 0.785797596f, 0.42001757f, -0.453990489f }, { 0x71835d92u } },
+	{ { 0.878661633f, 0.363953561f, -0.309017003f }, { 0x3622e9c1u } },
+	{ { 0.930499971f, 0.282264084f, -0.233445361f }, { 0x389241dbu } },
+	{ { 0.814788997f, 0.435513794f, -0.382683426f }, { 0x33c37da0u } },
+	{ { 0.898352683f, 0.37210986f, -0.233445361f }, { 0x7892f9cbu } },
+	{ { 0.945158839f, 0.286710799f, -0.156434461f }, { 0x7b024de3u } },
+	{ { 0.838756979f, 0.448324949f, -0.309017003f }, { 0x762395adu } },
+	{ { 0.912505031f, 0.377971977f, -0.156434461f }, { 0x3b0305d2u } },
+	{ { 0.9539904f, 0.289389819f, -0.0784590989f }, { 0x3d8251e7u } },
+	{ { 0.85755372f, 0.458371997f, -0.233445361f }, { 0x3893a9b6u } },
+	{ { 0.921031535f, 0.381503761f, -0.0784590989f }, { 0x7d830dd7u } },
+	{ { 0.956940353f, 0.290284663f, 2.18649922e-16f }, { 0x400251e9u } },
+	{ { 0.871063352f, 0.46559307f, -0.156434461f }, { 0x7b03b9bdu } },
+	{ { 0.923879504f, 0.382683426f, 2.18649922e-16f }, { 0x000311d8u } },
+	{ { 0.9539904f, 0.289389819f, 0.0784590989f }, { 0x028251e7u } },
+	{ { 0.879202604f, 0.469943583f, -0.0784590989f }, { 0x3d83c1c1u } },
+	{ { 0.921031535f, 0.381503761f, 0.0784590989f }, { 0x42830dd7u } },
+	{ { 0.945158839f, 0.286710799f, 0.156434461f }, { 0x45024de3u } },
+	{ { 0.881921291f, 0.471396744f, 2.18649922e-16f }, { 0x4003c5c3u } },
+	{ { 0.912505031f, 0.377971977f, 0.156434461f }, { 0x050305d2u } },
+	{ { 0.930499971f, 0.282264084f, 0.233445361f }, { 0x077241dbu } },
+	{ { 0.879202604f, 0.469943583f, 0.0784590989f }, { 0x0283c1c1u } },
+	{ { 0.898352683f, 0.37210986f, 0.233445361f }, { 0x4772f9cbu } },
+	{ { 0.910104334f, 0.276077121f, 0.309017003f }, { 0x49e235d1u } },
+	{ { 0.871063352f, 0.46559307f, 0.156434461f }, { 0x4503b9bdu } },
+	{ { 0.878661633f, 0.363953561f, 0.309017003f }, { 0x09e2e9c1u } },
+	{ { 0.884097576f, 0.268188059f, 0.382683426f }, { 0x0c4225c4u } },
+	{ { 0.85755372f, 0.458371997f, 0.233445361f }, { 0x0773a9b6u } },
+	{ { 0.853553414f, 0.353553385f, 0.382683426f }, { 0x4c42d5b4u } },
+	{ { 0.852640092f, 0.258645535f, 0.453990489f }, { 0x4e8211b4u } },
+	{ { 0.838756979f, 0.448324949f, 0.309017003f }, { 0x49e395adu } },
+	{ { 0.823182702f, 0.340973437f, 0.453990489f }, { 0x0e82b9a5u } },
+	{ { 0.815925777f, 0.247508377f, 0.522498548f }, { 0x10b1f9a1u } },
+	{ { 0.814788997f, 0.435513794f, 0.382683426f }, { 0x0c437da0u } },
+	{ { 0.787736773f, 0.326291263f, 0.522498548f }, { 0x50b29d93u } },
+	{ { 0.774181008f, 0.234845236f, 0.587785244f }, { 0x52c1e18cu } },
+	{ { 0.785797596f, 0.42001757f, 0.453990489f }, { 0x4e835d92u } },
+	{ { 0.747434258f, 0.309597403f, 0.587785244f }, { 0x12c2797eu } },
+	{ { 0.727663159f, 0.220734194f, 0.649448037f }, { 0x14c1c574u } },
+	{ { 0.75196147f, 0.401931792f, 0.522498548f }, { 0x10b33580u } },
+	{ { 0.70252353f, 0.290994763f, 0.649448037f }, { 0x54c25567u } },
+	{ { 0.676658988f, 0.205262259f, 0.707106769f }, { 0x5691a55au } },
+	{ { 0.713489294f, 0.381367981f, 0.587785244f }, { 0x52c30d6du } },
+	{ { 0.65328151f, 0.270598054f, 0.707106769f }, { 0x1692294eu } },
+	{ { 0.621483028f, 0.188524812f, 0.760405958f }, { 0x1851813eu } },
+	{ { 0.670618176f, 0.358452886f, 0.649448037f }, { 0x14c2dd57u } },
+	{ { 0.600011766f, 0.24853301f, 0.760405958f }, { 0x5851fd33u } },
+	{ { 0.562475443f, 0.170625046f, 0.809017003f }, { 0x59d15d1fu } },
+	{ { 0.623612523f, 0.33332783f, 0.707106769f }, { 0x5692a93fu } },
+	{ { 0.543042779f, 0.224935681f, 0.809017003f }, { 0x19d1cd15u } },
+	{ { 0.49999994f, 0.151673332f, 0.852640152f }, { 0x1b4138ffu } },
+	{ { 0.572762072f, 0.306147695f, 0.760405958f }, { 0x18527125u } },
+	{ { 0.482725739f, 0.199951544f, 0.852640152f }, { 0x5b4198f7u } },
+	{ { 0.434441835f, 0.131786481f, 0.891006529f }, { 0x5c710cdeu } },
+	{ { 0.518380284f, 0.277080059f, 0.809017003f }, { 0x59d23909u } },
+	{ { 0.419432521f, 0.17373465f, 0.891006529f }, { 0x1c7164d6u } },
+	{ { 0.366205215f, 0.111087136f, 0.923879504f }, { 0x1d80e4bbu } },
+	{ { 0.460802585f, 0.246304125f, 0.852640152f }, { 0x1b41f8ebu } },
+	{ { 0.353553385f, 0.146446615f, 0.923879504f }, { 0x5d812cb5u } },
+	{ { 0.295710832f, 0.0897028968f, 0.95105654f }, { 0x5e60b897u } },
+	{ { 0.285494477f, 0.118255682f, 0.95105654f }, { 0x1e60f092u } },
+	{ { 0.223393291f, 0.0677656084f, 0.972369909f }, { 0x1f108c72u } },
+	{ { 0.215675399f, 0.0893356726f, 0.972369909f }, { 0x5f10b86eu } },
+	{ { 0.149698451f, 0.0454105288f, 0.987688363f }, { 0x5f905c4cu } },
+	{ { 0.144526601f, 0.0598648787f, 0.987688363f }, { 0x1f907c4au } },
+	{ { 0.272528648f, 0.145669609f, 0.95105654f }, { 0x5e61288bu } },
+	{ { 0.205880433f, 0.110045381f, 0.972369909f }, { 0x1f10e069u } },
+	{ { 0.137962878f, 0.0737426952f, 0.987688363f }, { 0x5f909846u } },
+	{ { 0.194102719f, 0.129695296f, 0.972369909f }, { 0x5f110863u } },
+	{ { 0.130070508f, 0.0869103298f, 0.987688363f }, { 0x1f90b042u } },
+	{ { 0.256938249f, 0.171680644f, 0.95105654f }, { 0x1e616083u } },
+	{ { 0.1804557f, 0.148096174f, 0.972369909f }, { 0x1f11305cu } },
+	{ { 0.120925479f, 0.0992409736f, 0.987688363f }, { 0x5f90cc3eu } },
+	{ { 0.238873363f, 0.196038306f, 0.95105654f }, { 0x5e61907au } },
+	{ { 0.165070802f, 0.165070802f, 0.972369909f }, { 0x5f115054u } },
+	{ { 0.110615872f, 0.110615872f, 0.987688363f }, { 0x1f90e439u } },
+	{ { 0.218508005f, 0.218508005f, 0.95105654f }, { 0x1e61c070u } },
+	{ { 0.196038306f, 0.238873363f, 0.95105654f }, { 0x5e61e864u } },
+	{ { 0.148096174f, 0.1804557f, 0.972369909f }, { 0x1f11704cu } },
+	{ { 0.0992409736f, 0.120925479f, 0.987688363f }, { 0x5f90f833u } },
+	{ { 0.129695296f, 0.194102719f, 0.972369909f }, { 0x5f118c42u } },
+	{ { 0.0869103298f, 0.130070508f, 0.987688363f }, { 0x1f91082cu } },
+	{ { 0.171680644f, 0.256938249f, 0.95105654f }, { 0x1e620c58u } },
+	{ { 0.110045381f, 0.205880433f, 0.972369909f }, { 0x1f11a438u } },
+	{ { 0.0737426952f, 0.137962878f, 0.987688363f }, { 0x5f911826u } },
+	{ { 0.145669609f, 0.272528648f, 0.95105654f }, { 0x5e622c4au } },
+	{ { -0.469943583f, -0.879202604f, -0.0784590989f }, { 0x3d88ff10u } },
+	{ { -0.377971977f, -0.912505031f, -0.156434461f }, { 0x3b08bb3fu } },
+	{ { -0.46559307f, -0.871063352f, -0.156434461f }, { 0x7b090f12u } },
+	{ { -0.553857625f, -0.828906476f, -0.0784590989f }, { 0x7d8962e5u } },
+	{ { -0.282264084f, -0.930499971f, -0.233445361f }, { 0x38989770u } },
+	{ { -0.189699963f, -0.953686118f, -0.233445361f }, { 0x7898679fu } },
+	{ { -0.185541928f, -0.932782233f, -0.309017003f }, { 0x36288fa1u } },
+	{ { -0.093219839f, -0.946476936f, -0.309017003f }, { 0x762873d0u } },
+	{ { -0.0953089222f, -0.967687666f, -0.233445361f }, { 0x38984bcfu } },
+	{ { -0.286710799f, -0.945158839f, -0.156434461f }, { 0x7b08776du } },
+	{ { -0.192688435f, -0.968710184f, -0.156434461f }, { 0x3b08479eu } },
+	{ { -0.0968103856f, -0.982932329f, -0.156434461f }, { 0x7b082bcfu } },
+	{ { -0.381503761f, -0.921031535f, -0.0784590989f }, { 0x7d88a73du } },
+	{ { -0.289389819f, -0.9539904f, -0.0784590989f }, { 0x3d88676cu } },
+	{ { -0.194488928f, -0.977761865f, -0.0784590989f }, { 0x7d88339du } },
+	{ { -0.0977149829f, -0.992116928f, -0.0784590989f }, { 0x3d8817ceu } },
+	{ { -0.382683426f, -0.923879504f, 2.18649922e-16f }, { 0x0008a33cu } },
+	{ { -0.195090324f, -0.980785251f, 2.18649922e-16f }, { 0x00082f9cu } },
+	{ { -0.0980171412f, -0.99518472f, 2.18649922e-16f }, { 0x40080fceu } },
+	{ { -0.290284663f, -0.956940353f, 2.18649922e-16f }, { 0x40085f6cu } },
+	{ { -0.194488928f, -0.977761865f, 0.0784590989f }, { 0x4288339du } },
+	{ { -0.0977149829f, -0.992116928f, 0.0784590989f }, { 0x028817ceu } },
+	{ { -0.289389819f, -0.9539904f, 0.0784590989f }, { 0x0288676cu } },
+	{ { -0.192688435f, -0.968710184f, 0.156434461f }, { 0x0508479eu } },
+	{ { -0.0968103856f, -0.982932329f, 0.156434461f }, { 0x45082bcfu } },
+	{ { -0.286710799f, -0.945158839f, 0.156434461f }, { 0x4508776du } },
+	{ { -0.381503761f, -0.921031535f, 0.0784590989f }, { 0x4288a73du } },
+	{ { -0.377971977f, -0.912505031f, 0.156434461f }, { 0x0508bb3fu } },
+	{ { -0.189699963f, -0.953686118f, 0.233445361f }, { 0x4778679fu } },
+	{ { -0.0953089222f, -0.967687666f, 0.233445361f }, { 0x07784bcfu } },
+	{ { -0.185541928f, -0.932782233f, 0.309017003f }, { 0x09e88fa1u } },
+	{ { -0.282264084f, -0.930499971f, 0.233445361f }, { 0x07789770u } },
+	{ { -0.276077121f, -0.910104334f, 0.309017003f }, { 0x49e8bf73u } },
+	{ { -0.268188059f, -0.884097576f, 0.382683426f }, { 0x0c48f377u } },
+	{ { -0.353553385f, -0.853553414f, 0.382683426f }, { 0x4c49334bu } },
+	{ { -0.363953561f, -0.878661633f, 0.309017003f }, { 0x09e8ff46u } },
+	{ { -0.435513794f, -0.814788997f, 0.382683426f }, { 0x0c498321u } },
+	{ { -0.37210986f, -0.898352683f, 0.233445361f }, { 0x4778d742u } },
+	{ { -0.448324949f, -0.838756979f, 0.309017003f }, { 0x49e94f1bu } },
+	{ { -0.458371997f, -0.85755372f, 0.233445361f }, { 0x07792b16u } },
+	{ { -0.513279974f, -0.768177748f, 0.382683426f }, { 0x4c49defau } },
+	{ { -0.495016694f, -0.740844846f, 0.453990489f }, { 0x0e8a1703u } },
+	{ { -0.565248549f, -0.68875736f, 0.453990489f }, { 0x4e8a82dfu } },
+	{ { -0.528378665f, -0.790774584f, 0.309017003f }, { 0x09e9b2f2u } },
+	{ { -0.586102962f, -0.714168549f, 0.382683426f }, { 0x0c4a4ed5u } },
+	{ { -0.630036771f, -0.630036771f, 0.453990489f }, { 0x0e8afabeu } },
+	{ { -0.540219784f, -0.808496058f, 0.233445361f }, { 0x47798eecu } },
+	{ { -0.65328151f, -0.65328151f, 0.382683426f }, { 0x4c4acab2u } },
+	{ { -0.68875736f, -0.565248549f, 0.453990489f }, { 0x4e8b7ea0u } },
+	{ { -0.603343844f, -0.735176623f, 0.309017003f }, { 0x49ea22ccu } },
+	{ { -0.714168549f, -0.586102962f, 0.382683426f }, { 0x0c4b5693u } },
+	{ { -0.740844846f, -0.495016694f, 0.453990489f }, { 0x0e8c0e85u } },
+	{ { -0.672498524f, -0.672498524f, 0.309017003f }, { 0x09eaa2a8u } },
+	{ { -0.768177748f, -0.513279974f, 0.382683426f }, { 0x4c4bea77u } },
+	{ { -0.785797596f, -0.42001757f, 0.453990489f }, { 0x4e8ca66eu } },
+	{ { -0.735176623f, -0.603343844f, 0.309017003f }, { 0x49eb3288u } },
+	{ { -0.61686492f, -0.751652122f, 0.233445361f }, { 0x077a02c5u } },
+	{ { -0.814788997f, -0.435513794f, 0.382683426f }, { 0x0c4c8660u } },
+	{ { -0.823182702f, -0.340973437f, 0.453990489f }, { 0x0e8d4a5bu } },
+	{ { -0.790774584f, -0.528378665f, 0.309017003f }, { 0x09ebca6cu } },
+	{ { -0.853553414f, -0.353553385f, 0.382683426f }, { 0x4c4d2e4cu } },
+	{ { -0.852640092f, -0.258645535f, 0.453990489f }, { 0x4e8df24cu } },
+	{ { -0.838756979f, -0.448324949f, 0.309017003f }, { 0x49ec6e53u } },
+	{ { -0.884097576f, -0.268188059f, 0.382683426f }, { 0x0c4dde3cu } },
+	{ { -0.873886108f, -0.173826754f, 0.453990489f }, { 0x0e8e9e41u } },
+	{ { -0.878661633f, -0.363953561f, 0.309017003f }, { 0x09ed1a3fu } },
+	{ { -0.906127453f, -0.180239961f, 0.382683426f }, { 0x4c4e9231u } },
+	{ { -0.886716068f, -0.0873339102f, 0.453990489f }, { 0x4e8f4e3bu } },
+	{ { -0.910104334f, -0.276077121f, 0.309017003f }, { 0x49edce2fu } },
+	{ { -0.919430792f, -0.090556033f, 0.382683426f }, { 0x0c4f4a2au } },
+	{ { -0.891006529f, 1.94818504e-16f, 0.453990489f }, { 0x0e800239u } },
+	{ { -0.932782233f, -0.185541928f, 0.309017003f }, { 0x09ee8623u } },
+	{ { -0.923879504f, 2.02006188e-16f, 0.382683426f }, { 0x4c400228u } },
+	{ { -0.886716068f, 0.0873339102f, 0.453990489f }, { 0x4e80b63bu } },
+	{ { -0.946476936f, -0.093219839f, 0.309017003f }, { 0x49ef421cu } },
+	{ { -0.919430792f, 0.090556033f, 0.382683426f }, { 0x0c40ba2au } },
+	{ { -0.873886108f, 0.173826754f, 0.453990489f }, { 0x0e816641u } },
+	{ { -0.95105654f, 2.07948428e-16f, 0.309017003f }, { 0x09e0021au } },
+	{ { -0.906127453f, 0.180239961f, 0.382683426f }, { 0x4c417231u } },
+	{ { -0.852640092f, 0.258645535f, 0.453990489f }, { 0x4e82124cu } },
+	{ { -0.946476936f, 0.093219839f, 0.309017003f }, { 0x49e0c21cu } },
+	{ { -0.884097576f, 0.268188059f, 0.382683426f }, { 0x0c42263cu } },
+	{ { -0.823182702f, 0.340973437f, 0.453990489f }, { 0x0e82ba5bu } },
+	{ { -0.932782233f, 0.185541928f, 0.309017003f }, { 0x09e17e23u } },
+	{ { -0.853553414f, 0.353553385f, 0.382683426f }, { 0x4c42d64cu } },
+	{ { -0.785797596f, 0.42001757f, 0.453990489f }, { 0x4e835e6eu } },
+	{ { -0.910104334f, 0.276077121f, 0.309017003f }, { 0x49e2362fu } },
+	{ { -0.814788997f, 0.435513794f, 0.382683426f }, { 0x0c437e60u } },
+	{ { -0.740844846f, 0.495016694f, 0.453990489f }, { 0x0e83f685u } },
+	{ { -0.878661633f, 0.363953561f, 0.309017003f }, { 0x09e2ea3fu } },
+	{ { -0.768177748f, 0.513279974f, 0.382683426f }, { 0x4c441a77u } },
+	{ { -0.68875736f, 0.565248549f, 0.453990489f }, { 0x4e8486a0u } },
+	{ { -0.838756979f, 0.448324949f, 0.309017003f }, { 0x49e39653u } },
+	{ { -0.714168549f, 0.586102962f, 0.382683426f }, { 0x0c44ae93u } },
+	{ { -0.630036771f, 0.630036771f, 0.453990489f }, { 0x0e850abeu } },
+	{ { -0.790774584f, 0.528378665f, 0.309017003f }, { 0x09e43a6cu } },
+	{ { -0.65328151f, 0.65328151f, 0.382683426f }, { 0x4c453ab2u } },
+	{ { -0.565248549f, 0.68875736f, 0.453990489f }, { 0x4e8582dfu } },
+	{ { -0.735176623f, 0.603343844f, 0.309017003f }, { 0x49e4d288u } },
+	{ { -0.586102962f, 0.714168549f, 0.382683426f }, { 0x0c45b6d5u } },
+	{ { -0.495016694f, 0.740844846f, 0.453990489f }, { 0x0e85ef03u } },
+	{ { -0.672498524f, 0.672498524f, 0.309017003f }, { 0x09e562a8u } },
+	{ { -0.513279974f, 0.768177748f, 0.382683426f }, { 0x4c4626fau } },
+	{ { -0.42001757f, 0.785797596f, 0.453990489f }, { 0x4e864b29u } },
+	{ { -0.603343844f, 0.735176623f, 0.309017003f }, { 0x49e5e2ccu } },
+	{ { -0.435513794f, 0.814788997f, 0.382683426f }, { 0x0c468321u } },
+	{ { -0.340973437f, 0.823182702f, 0.453990489f }, { 0x0e869752u } },
+	{ { -0.528378665f, 0.790774584f, 0.309017003f }, { 0x09e652f2u } },
+	{ { -0.353553385f, 0.853553414f, 0.382683426f }, { 0x4c46d34bu } },
+	{ { -0.258645535f, 0.852640092f, 0.453990489f }, { 0x4e86d37cu } },
+	{ { -0.448324949f, 0.838756979f, 0.309017003f }, { 0x49e6b71bu } },
+	{ { -0.268188059f, 0.884097576f, 0.382683426f }, { 0x0c471377u } },
+	{ { -0.173826754f, 0.873886108f, 0.453990489f }, { 0x0e86ffa7u } },
+	{ { -0.180239961f, 0.906127453f, 0.382683426f }, { 0x4c473fa4u } },
+	{ { -0.363953561f, 0.878661633f, 0.309017003f }, { 0x09e70746u } },
+	{ { -0.276077121f, 0.910104334f, 0.309017003f }, { 0x49e74773u } },
+	{ { -0.185541928f, 0.932782233f, 0.309017003f }, { 0x09e777a1u } },
+	{ { -0.458371997f, 0.85755372f, 0.233445361f }, { 0x0776db16u } },
+	{ { -0.282264084f, 0.930499971f, 0.233445361f }, { 0x07776f70u } },
+	{ { -0.189699963f, 0.953686118f, 0.233445361f }, { 0x47779f9fu } },
+	{ { -0.37210986f, 0.898352683f, 0.233445361f }, { 0x47772f42u } },
+	{ { -0.286710799f, 0.945158839f, 0.156434461f }, { 0x45078f6du } },
+	{ { -0.192688435f, 0.968710184f, 0.156434461f }, { 0x0507bf9eu } },
+	{ { -0.377971977f, 0.912505031f, 0.156434461f }, { 0x05074b3fu } },
+	{ { -0.289389819f, 0.9539904f, 0.0784590989f }, { 0x02879f6cu } },
+	{ { -0.194488928f, 0.977761865f, 0.0784590989f }, { 0x4287d39du } },
+	{ { -0.290284663f, 0.956940353f, 2.18649922e-16f }, { 0x4007a76cu } },
+	{ { -0.381503761f, 0.921031535f, 0.0784590989f }, { 0x42875f3du } },
+	{ { -0.382683426f, 0.923879504f, 2.18649922e-16f }, { 0x0007633cu } },
+	{ { -0.381503761f, 0.921031535f, -0.0784590989f }, { 0x7d875f3du } },
+	{ { -0.469943583f, 0.879202604f, -0.0784590989f }, { 0x3d870710u } },
+	{ { -0.471396744f, 0.881921291f, 2.18649922e-16f }, { 0x40070f0fu } },
+	{ { -0.553857625f, 0.828906476f, -0.0784590989f }, { 0x7d86a2e5u } },
+	{ { -0.469943583f, 0.879202604f, 0.0784590989f }, { 0x02870710u } },
+	{ { -0.555570245f, 0.831469595f, 2.18649922e-16f }, { 0x0006a6e4u } },
+	{ { -0.632437646f, 0.770627499f, -0.0784590989f }, { 0x3d862abdu } },
+	{ { -0.46559307f, 0.871063352f, 0.156434461f }, { 0x4506f712u } },
+	{ { -0.553857625f, 0.828906476f, 0.0784590989f }, { 0x4286a2e5u } },
+	{ { -0.634393275f, 0.773010433f, 2.18649922e-16f }, { 0x40062ebcu } },
+	{ { -0.704927027f, 0.704927027f, -0.0784590989f }, { 0x7d85a298u } },
+	{ { -0.548730254f, 0.821232855f, 0.156434461f }, { 0x050692e8u } },
+	{ { -0.632437646f, 0.770627499f, 0.0784590989f }, { 0x02862abdu } },
+	{ { -0.707106769f, 0.707106769f, 2.18649922e-16f }, { 0x0005a697u } },
+	{ { -0.770627499f, 0.632437646f, -0.0784590989f }, { 0x3d850e76u } },
+	{ { -0.540219784f, 0.808496058f, 0.233445361f }, { 0x477676ecu } },
+	{ { -0.773010433f, 0.634393275f, 2.18649922e-16f }, { 0x40051275u } },
+	{ { -0.828906476f, 0.553857625f, -0.0784590989f }, { 0x7d846e58u } },
+	{ { -0.61686492f, 0.751652122f, 0.233445361f }, { 0x077602c5u } },
+	{ { -0.626582861f, 0.763493419f, 0.156434461f }, { 0x45061ac0u } },
+	{ { -0.68756938f, 0.68756938f, 0.233445361f }, { 0x47757ea1u } },
+	{ { -0.698401153f, 0.698401153f, 0.156434461f }, { 0x0505969bu } },
+	{ { -0.704927027f, 0.704927027f, 0.0784590989f }, { 0x4285a298u } },
+	{ { -0.770627499f, 0.632437646f, 0.0784590989f }, { 0x02850e76u } },
+	{ { -0.763493419f, 0.626582861f, 0.156434461f }, { 0x4505027au } },
+	{ { -0.247508377f, -0.815925777f, 0.522498548f }, { 0x10b97f82u } },
+	{ { -0.173826754f, -0.873886108f, 0.453990489f }, { 0x0e8907a7u } },
+	{ { -0.258645535f, -0.852640092f, 0.453990489f }, { 0x4e89337cu } },
+	{ { -0.180239961f, -0.906127453f, 0.382683426f }, { 0x4c48c7a4u } },
+	{ { -0.326291263f, -0.787736773f, 0.522498548f }, { 0x50b9b759u } },
+	{ { -0.093219839f, -0.946476936f, 0.309017003f }, { 0x49e873d0u } },
+	{ { -0.401931792f, -0.75196147f, 0.522498548f }, { 0x10ba0333u } },
+	{ { -0.340973437f, -0.823182702f, 0.453990489f }, { 0x0e896f52u } },
+	{ { -0.473701507f, -0.70894438f, 0.522498548f }, { 0x50ba5b0eu } },
+	{ { -0.42001757f, -0.785797596f, 0.453990489f }, { 0x4e89bb29u } },
+	{ { -0.540909171f, -0.659099758f, 0.522498548f }, { 0x10babeecu } },
+	{ { -0.602907658f, -0.602907658f, 0.522498548f }, { 0x50bb32ccu } },
+	{ { -0.659099758f, -0.540909171f, 0.522498548f }, { 0x10bbb2afu } },
+	{ { -0.70894438f, -0.473701507f, 0.522498548f }, { 0x50bc3a96u } },
+	{ { -0.75196147f, -0.401931792f, 0.522498548f }, { 0x10bcce80u } },
+	{ { -0.787736773f, -0.326291263f, 0.522498548f }, { 0x50bd666du } },
+	{ { -0.815925777f, -0.247508377f, 0.522498548f }, { 0x10be0a5fu } },
+	{ { -0.836256921f, -0.166341841f, 0.522498548f }, { 0x50beae55u } },
+	{ { -0.848534465f, -0.0835733488f, 0.522498548f }, { 0x10bf564eu } },
+	{ { -0.852640152f, 1.86429702e-16f, 0.522498548f }, { 0x50b0024cu } },
+	{ { -0.848534465f, 0.0835733488f, 0.522498548f }, { 0x10b0ae4eu } },
+	{ { -0.836256921f, 0.166341841f, 0.522498548f }, { 0x50b15655u } },
+	{ { -0.815925777f, 0.247508377f, 0.522498548f }, { 0x10b1fa5fu } },
+	{ { -0.787736773f, 0.326291263f, 0.522498548f }, { 0x50b29e6du } },
+	{ { -0.75196147f, 0.401931792f, 0.522498548f }, { 0x10b33680u } },
+	{ { -0.70894438f, 0.473701507f, 0.522498548f }, { 0x50b3ca96u } },
+	{ { -0.659099758f, 0.540909171f, 0.522498548f }, { 0x10b452afu } },
+	{ { -0.602907658f, 0.602907658f, 0.522498548f }, { 0x50b4d2ccu } },
+	{ { -0.540909171f, 0.659099758f, 0.522498548f }, { 0x10b546ecu } },
+	{ { -0.473701507f, 0.70894438f, 0.522498548f }, { 0x50b5ab0eu } },
+	{ { -0.401931792f, 0.75196147f, 0.522498548f }, { 0x10b60333u } },
+	{ { -0.326291263f, 0.787736773f, 0.522498548f }, { 0x50b64f59u } },
+	{ { -0.247508377f, 0.815925777f, 0.522498548f }, { 0x10b68782u } },
+	{ { -0.166341841f, 0.836256921f, 0.522498548f }, { 0x50b6afabu } },
+	{ { -0.0835733488f, 0.848534465f, 0.522498548f }, { 0x10b6cbd5u } },
+	{ { 1.86429702e-16f, 0.852640152f, 0.522498548f }, { 0x50b6d000u } },
+	{ { -0.0873339102f, 0.886716068f, 0.453990489f }, { 0x4e8717d3u } },
+	{ { 1.94818504e-16f, 0.891006529f, 0.453990489f }, { 0x0e871c00u } },
+	{ { 2.02006188e-16f, 0.923879504f, 0.382683426f }, { 0x4c476000u } },
+	{ { -0.090556033f, 0.919430792f, 0.382683426f }, { 0x0c475bd2u } },
+	{ { 2.07948428e-16f, 0.95105654f, 0.309017003f }, { 0x09e79800u } },
+	{ { -0.093219839f, 0.946476936f, 0.309017003f }, { 0x49e793d0u } },
+	{ { 2.12608605e-16f, 0.972369909f, 0.233445361f }, { 0x4777c400u } },
+	{ { -0.0953089222f, 0.967687666f, 0.233445361f }, { 0x0777bbcfu } },
+	{ { -0.0968103856f, 0.982932329f, 0.156434461f }, { 0x4507dbcfu } },
+	{ { 2.15957972e-16f, 0.987688363f, 0.156434461f }, { 0x0507e400u } },
+	{ { 2.17975895e-16f, 0.996917307f, 0.0784590989f }, { 0x4287f400u } },
+	{ { -0.0977149829f, 0.992116928f, 0.0784590989f }, { 0x0287efceu } },
+	{ { 2.18649922e-16f, 1.0f, 2.18649922e-16f }, { 0x0007fc00u } },
+	{ { -0.0980171412f, 0.99518472f, 2.18649922e-16f }, { 0x4007f7ceu } },
+	{ { -0.195090324f, 0.980785251f, 2.18649922e-16f }, { 0x0007d79cu } },
+	{ { -0.0977149829f, 0.992116928f, -0.0784590989f }, { 0x3d87efceu } },
+	{ { 2.17975895e-16f, 0.996917307f, -0.0784590989f }, { 0x7d87f400u } },
+	{ { -0.194488928f, 0.977761865f, -0.0784590989f }, { 0x7d87d39du } },
+	{ { 2.15957972e-16f, 0.987688363f, -0.156434461f }, { 0x3b07e400u } },
+	{ { -0.0968103856f, 0.982932329f, -0.156434461f }, { 0x7b07dbcfu } },
+	{ { -0.0953089222f, 0.967687666f, -0.233445361f }, { 0x3897bbcfu } },
+	{ { -0.185541928f, 0.932782233f, -0.309017003f }, { 0x362777a1u } },
+	{ { -0.189699963f, 0.953686118f, -0.233445361f }, { 0x78979f9fu } },
+	{ { -0.276077121f, 0.910104334f, -0.309017003f }, { 0x76274773u } },
+	{ { -0.192688435f, 0.968710184f, -0.156434461f }, { 0x3b07bf9eu } },
+	{ { -0.282264084f, 0.930499971f, -0.233445361f }, { 0x38976f70u } },
+	{ { -0.363953561f, 0.878661633f, -0.309017003f }, { 0x36270746u } },
+	{ { -0.286710799f, 0.945158839f, -0.156434461f }, { 0x7b078f6du } },
+	{ { -0.37210986f, 0.898352683f, -0.233445361f }, { 0x78972f42u } },
+	{ { -0.448324949f, 0.838756979f, -0.309017003f }, { 0x7626b71bu } },
+	{ { -0.289389819f, 0.9539904f, -0.0784590989f }, { 0x3d879f6cu } },
+	{ { -0.377971977f, 0.912505031f, -0.156434461f }, { 0x3b074b3fu } },
+	{ { -0.458371997f, 0.85755372f, -0.233445361f }, { 0x3896db16u } },
+	{ { -0.528378665f, 0.790774584f, -0.309017003f }, { 0x362652f2u } },
+	{ { -0.540219784f, 0.808496058f, -0.233445361f }, { 0x789676ecu } },
+	{ { -0.603343844f, 0.735176623f, -0.309017003f }, { 0x7625e2ccu } },
+	{ { -0.46559307f, 0.871063352f, -0.156434461f }, { 0x7b06f712u } },
+	{ { -0.61686492f, 0.751652122f, -0.233445361f }, { 0x389602c5u } },
+	{ { -0.672498524f, 0.672498524f, -0.309017003f }, { 0x362562a8u } },
+	{ { -0.548730254f, 0.821232855f, -0.156434461f }, { 0x3b0692e8u } },
+	{ { -0.68756938f, 0.68756938f, -0.233445361f }, { 0x78957ea1u } },
+	{ { -0.735176623f, 0.603343844f, -0.309017003f }, { 0x7624d288u } },
+	{ { -0.626582861f, 0.763493419f, -0.156434461f }, { 0x7b061ac0u } },
+	{ { -0.751652122f, 0.61686492f, -0.233445361f }, { 0x3894ee80u } },
+	{ { -0.790774584f, 0.528378665f, -0.309017003f }, { 0x36243a6cu } },
+	{ { -0.698401153f, 0.698401153f, -0.156434461f }, { 0x3b05969bu } },
+	{ { -0.808496058f, 0.540219784f, -0.233445361f }, { 0x78945263u } },
+	{ { -0.838756979f, 0.448324949f, -0.309017003f }, { 0x76239653u } },
+	{ { -0.763493419f, 0.626582861f, -0.156434461f }, { 0x7b05027au } },
+	{ { -0.85755372f, 0.458371997f, -0.233445361f }, { 0x3893aa4au } },
+	{ { -0.878661633f, 0.363953561f, -0.309017003f }, { 0x3622ea3fu } },
+	{ { -0.821232855f, 0.548730254f, -0.156434461f }, { 0x3b04625cu } },
+	{ { -0.898352683f, 0.37210986f, -0.233445361f }, { 0x7892fa35u } },
+	{ { -0.910104334f, 0.276077121f, -0.309017003f }, { 0x7622362fu } },
+	{ { -0.871063352f, 0.46559307f, -0.156434461f }, { 0x7b03ba43u } },
+	{ { -0.930499971f, 0.282264084f, -0.233445361f }, { 0x38924225u } },
+	{ { -0.932782233f, 0.185541928f, -0.309017003f }, { 0x36217e23u } },
+	{ { -0.912505031f, 0.377971977f, -0.156434461f }, { 0x3b03062eu } },
+	{ { -0.879202604f, 0.469943583f, -0.0784590989f }, { 0x3d83c23fu } },
+	{ { 0.0f, -0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { 0.0f, -0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { 0.0652363524f, -0.0435895398f, 0.996917307f }, { 0x5fdfa821u } },
+	{ { 0.215675399f, -0.0893356726f, 0.972369909f }, { 0x5f1f486eu } },
+	{ { 0.295710832f, -0.0897028968f, 0.95105654f }, { 0x5e6f4897u } },
+	{ { 0.285494477f, -0.118255682f, 0.95105654f }, { 0x1e6f1092u } },
+	{ { 0.366205215f, -0.111087136f, 0.923879504f }, { 0x1d8f1cbbu } },
+	{ { 0.0606497005f, -0.0497739241f, 0.996917307f }, { 0x1fdf9c1fu } },
+	{ { 0.0f, -0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { 0.137962878f, -0.0737426952f, 0.987688363f }, { 0x5f9f6846u } },
+	{ { 0.130070508f, -0.0869103298f, 0.987688363f }, { 0x1f9f5042u } },
+	{ { 0.205880433f, -0.110045381f, 0.972369909f }, { 0x1f1f2069u } },
+	{ { 0.0554789603f, -0.0554789603f, 0.996917307f }, { 0x5fdf901cu } },
+	{ { 0.0f, -0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { 0.120925479f, -0.0992409736f, 0.987688363f }, { 0x5f9f343eu } },
+	{ { 0.194102719f, -0.129695296f, 0.972369909f }, { 0x5f1ef863u } },
+	{ { 0.0497739241f, -0.0606497005f, 0.996917307f }, { 0x1fdf8419u } },
+	{ { 0.0f, -0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { 0.110615872f, -0.110615872f, 0.987688363f }, { 0x1f9f1c39u } },
+	{ { 0.0435895398f, -0.0652363524f, 0.996917307f }, { 0x5fdf7c16u } },
+	{ { 0.0f, -0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { 0.0992409736f, -0.120925479f, 0.987688363f }, { 0x5f9f0833u } },
+	{ { 0.1804557f, -0.148096174f, 0.972369909f }, { 0x1f1ed05cu } },
+	{ { 0.0369853601f, -0.0691947415f, 0.996917307f }, { 0x1fdf7413u } },
+	{ { 0.0f, -0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { 0.0869103298f, -0.130070508f, 0.987688363f }, { 0x1f9ef82cu } },
+	{ { 0.030024996f, -0.0724867508f, 0.996917307f }, { 0x5fdf6c0fu } },
+	{ { 0.0f, -0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { 0.0737426952f, -0.137962878f, 0.987688363f }, { 0x5f9ee826u } },
+	{ { 0.0227754731f, -0.0750806704f, 0.996917307f }, { 0x1fdf680cu } },
+	{ { 0.0f, -0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { 0.0598648787f, -0.144526601f, 0.987688363f }, { 0x1f9ed81fu } },
+	{ { 0.0153066106f, -0.0769515261f, 0.996917307f }, { 0x5fdf6408u } },
+	{ { 0.0f, -0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { 0.0454105288f, -0.149698451f, 0.987688363f }, { 0x5f9ed017u } },
+	{ { 0.00769033609f, -0.0780812949f, 0.996917307f }, { 0x1fdf6004u } },
+	{ { 0.0f, -0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { 0.0305188503f, -0.153428614f, 0.987688363f }, { 0x1f9ec810u } },
+	{ { 0.0f, -0.0784590989f, 0.996917307f }, { 0x5fdf6000u } },
+	{ { -0.0f, -0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { 0.0153332585f, -0.155681193f, 0.987688363f }, { 0x5f9ec008u } },
+	{ { -0.00769033609f, -0.0780812949f, 0.996917307f }, { 0x1fdf63fcu } },
+	{ { -0.0f, -0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { 0.0f, -0.156434461f, 0.987688363f }, { 0x1f9ec000u } },
+	{ { -0.0153066106f, -0.0769515261f, 0.996917307f }, { 0x5fdf67f8u } },
+	{ { -0.0f, -0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { -0.0153332585f, -0.155681193f, 0.987688363f }, { 0x5f9ec3f8u } },
+	{ { -0.0227754731f, -0.0750806704f, 0.996917307f }, { 0x1fdf6bf4u } },
+	{ { -0.0f, -0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { -0.0305188503f, -0.153428614f, 0.987688363f }, { 0x1f9ecbf0u } },
+	{ { -0.030024996f, -0.0724867508f, 0.996917307f }, { 0x5fdf6ff1u } },
+	{ { -0.0f, -0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { -0.0454105288f, -0.149698451f, 0.987688363f }, { 0x5f9ed3e9u } },
+	{ { -0.0369853601f, -0.0691947415f, 0.996917307f }, { 0x1fdf77edu } },
+	{ { -0.0f, -0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { -0.0598648787f, -0.144526601f, 0.987688363f }, { 0x1f9edbe1u } },
+	{ { -0.0435895398f, -0.0652363524f, 0.996917307f }, { 0x5fdf7feau } },
+	{ { -0.0f, -0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { -0.0737426952f, -0.137962878f, 0.987688363f }, { 0x5f9eebdau } },
+	{ { -0.0497739241f, -0.0606497005f, 0.996917307f }, { 0x1fdf87e7u } },
+	{ { -0.0f, -0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { -0.0869103298f, -0.130070508f, 0.987688363f }, { 0x1f9efbd4u } },
+	{ { -0.0554789603f, -0.0554789603f, 0.996917307f }, { 0x5fdf93e4u } },
+	{ { -0.0f, -0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { -0.0992409736f, -0.120925479f, 0.987688363f }, { 0x5f9f0bcdu } },
+	{ { -0.0606497005f, -0.0497739241f, 0.996917307f }, { 0x1fdf9fe1u } },
+	{ { -0.0f, -0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { -0.110615872f, -0.110615872f, 0.987688363f }, { 0x1f9f1fc7u } },
+	{ { -0.0652363524f, -0.0435895398f, 0.996917307f }, { 0x5fdfabdfu } },
+	{ { -0.0f, -0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { -0.120925479f, -0.0992409736f, 0.987688363f }, { 0x5f9f37c2u } },
+	{ { -0.0691947415f, -0.0369853601f, 0.996917307f }, { 0x1fdfb7ddu } },
+	{ { -0.0f, -0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { -0.130070508f, -0.0869103298f, 0.987688363f }, { 0x1f9f53beu } },
+	{ { -0.0724867508f, -0.030024996f, 0.996917307f }, { 0x5fdfc7dbu } },
+	{ { -0.0f, -0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { -0.137962878f, -0.0737426952f, 0.987688363f }, { 0x5f9f6bbau } },
+	{ { -0.0750806704f, -0.0227754731f, 0.996917307f }, { 0x1fdfd3dau } },
+	{ { -0.0f, -0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { -0.144526601f, -0.0598648787f, 0.987688363f }, { 0x1f9f87b6u } },
+	{ { -0.0769515261f, -0.0153066106f, 0.996917307f }, { 0x5fdfe3d9u } },
+	{ { -0.0f, -0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { -0.149698451f, -0.0454105288f, 0.987688363f }, { 0x5f9fa7b4u } },
+	{ { -0.0780812949f, -0.00769033609f, 0.996917307f }, { 0x1fdff3d8u } },
+	{ { -0.0f, 0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { -0.153428614f, -0.0305188503f, 0.987688363f }, { 0x1f9fc3b2u } },
+	{ { -0.0784590989f, 1.71550757e-17f, 0.996917307f }, { 0x5fd003d8u } },
+	{ { -0.0f, 0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { -0.155681193f, -0.0153332585f, 0.987688363f }, { 0x5f9fe3b0u } },
+	{ { -0.0780812949f, 0.00769033609f, 0.996917307f }, { 0x1fd013d8u } },
+	{ { -0.0f, 0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { -0.156434461f, 3.42043849e-17f, 0.987688363f }, { 0x1f9003b0u } },
+	{ { -0.0769515261f, 0.0153066106f, 0.996917307f }, { 0x5fd023d9u } },
+	{ { -0.0f, 0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { -0.155681193f, 0.0153332585f, 0.987688363f }, { 0x5f9023b0u } },
+	{ { -0.0750806704f, 0.0227754731f, 0.996917307f }, { 0x1fd033dau } },
+	{ { -0.0f, 0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { -0.153428614f, 0.0305188503f, 0.987688363f }, { 0x1f9043b2u } },
+	{ { -0.0724867508f, 0.030024996f, 0.996917307f }, { 0x5fd03fdbu } },
+	{ { -0.0f, 0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { -0.149698451f, 0.0454105288f, 0.987688363f }, { 0x5f905fb4u } },
+	{ { -0.0691947415f, 0.0369853601f, 0.996917307f }, { 0x1fd04fddu } },
+	{ { -0.0f, 0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { -0.144526601f, 0.0598648787f, 0.987688363f }, { 0x1f907fb6u } },
+	{ { -0.0652363524f, 0.0435895398f, 0.996917307f }, { 0x5fd05bdfu } },
+	{ { -0.0f, 0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { -0.137962878f, 0.0737426952f, 0.987688363f }, { 0x5f909bbau } },
+	{ { -0.0606497005f, 0.0497739241f, 0.996917307f }, { 0x1fd067e1u } },
+	{ { -0.0f, 0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { -0.130070508f, 0.0869103298f, 0.987688363f }, { 0x1f90b3beu } },
+	{ { -0.0554789603f, 0.0554789603f, 0.996917307f }, { 0x5fd073e4u } },
+	{ { -0.0f, 0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { -0.120925479f, 0.0992409736f, 0.987688363f }, { 0x5f90cfc2u } },
+	{ { -0.0497739241f, 0.0606497005f, 0.996917307f }, { 0x1fd07fe7u } },
+	{ { -0.0f, 0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { -0.110615872f, 0.110615872f, 0.987688363f }, { 0x1f90e7c7u } },
+	{ { -0.0435895398f, 0.0652363524f, 0.996917307f }, { 0x5fd087eau } },
+	{ { -0.0f, 0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { -0.0992409736f, 0.120925479f, 0.987688363f }, { 0x5f90fbcdu } },
+	{ { -0.0369853601f, 0.0691947415f, 0.996917307f }, { 0x1fd08fedu } },
+	{ { -0.0f, 0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { -0.0869103298f, 0.130070508f, 0.987688363f }, { 0x1f910bd4u } },
+	{ { -0.030024996f, 0.0724867508f, 0.996917307f }, { 0x5fd097f1u } },
+	{ { -0.0f, 0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { -0.0737426952f, 0.137962878f, 0.987688363f }, { 0x5f911bdau } },
+	{ { -0.0227754731f, 0.0750806704f, 0.996917307f }, { 0x1fd09bf4u } },
+	{ { -0.0f, 0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { -0.0598648787f, 0.144526601f, 0.987688363f }, { 0x1f912be1u } },
+	{ { -0.0153066106f, 0.0769515261f, 0.996917307f }, { 0x5fd09ff8u } },
+	{ { -0.0f, 0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { -0.0454105288f, 0.149698451f, 0.987688363f }, { 0x5f9133e9u } },
+	{ { -0.00769033609f, 0.0780812949f, 0.996917307f }, { 0x1fd0a3fcu } },
+	{ { 0.0f, 0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { -0.0305188503f, 0.153428614f, 0.987688363f }, { 0x1f913bf0u } },
+	{ { 1.71550757e-17f, 0.0784590989f, 0.996917307f }, { 0x5fd0a000u } },
+	{ { 0.0f, 0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { -0.0153332585f, 0.155681193f, 0.987688363f }, { 0x5f9143f8u } },
+	{ { 0.00769033609f, 0.0780812949f, 0.996917307f }, { 0x1fd0a004u } },
+	{ { 0.0f, 0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { 3.42043849e-17f, 0.156434461f, 0.987688363f }, { 0x1f914000u } },
+	{ { 0.0153066106f, 0.0769515261f, 0.996917307f }, { 0x5fd09c08u } },
+	{ { 0.0f, 0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { 0.0153332585f, 0.155681193f, 0.987688363f }, { 0x5f914008u } },
+	{ { 0.0227754731f, 0.0750806704f, 0.996917307f }, { 0x1fd0980cu } },
+	{ { 0.0f, 0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { 0.0305188503f, 0.153428614f, 0.987688363f }, { 0x1f913810u } },
+	{ { 0.030024996f, 0.0724867508f, 0.996917307f }, { 0x5fd0940fu } },
+	{ { 0.0f, 0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { 0.0454105288f, 0.149698451f, 0.987688363f }, { 0x5f913017u } },
+	{ { 0.0369853601f, 0.0691947415f, 0.996917307f }, { 0x1fd08c13u } },
+	{ { 0.0f, 0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { 0.0598648787f, 0.144526601f, 0.987688363f }, { 0x1f91281fu } },
+	{ { 0.0435895398f, 0.0652363524f, 0.996917307f }, { 0x5fd08416u } },
+	{ { 0.0f, 0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { 0.0497739241f, 0.0606497005f, 0.996917307f }, { 0x1fd07c19u } },
+	{ { 0.0f, 0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { 0.0554789603f, 0.0554789603f, 0.996917307f }, { 0x5fd0701cu } },
+	{ { 0.0f, 0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { 0.0606497005f, 0.0497739241f, 0.996917307f }, { 0x1fd0641fu } },
+	{ { 0.0f, 0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { 0.0652363524f, 0.0435895398f, 0.996917307f }, { 0x5fd05821u } },
+	{ { 0.0f, 0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { 0.0691947415f, 0.0369853601f, 0.996917307f }, { 0x1fd04c23u } },
+	{ { 0.0f, 0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { 0.0724867508f, 0.030024996f, 0.996917307f }, { 0x5fd03c25u } },
+	{ { 0.0f, 0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { 0.0750806704f, 0.0227754731f, 0.996917307f }, { 0x1fd03026u } },
+	{ { 0.0f, 0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { 0.0769515261f, 0.0153066106f, 0.996917307f }, { 0x5fd02027u } },
+	{ { 0.0f, 0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { 0.0780812949f, 0.00769033609f, 0.996917307f }, { 0x1fd01028u } },
+	{ { 0.0f, 0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { 0.0784590989f, 0.0f, 0.996917307f }, { 0x5fd00028u } },
+	{ { 0.153428614f, 0.0305188503f, 0.987688363f }, { 0x1f90404eu } },
+	{ { 0.155681193f, 0.0153332585f, 0.987688363f }, { 0x5f902050u } },
+	{ { 0.156434461f, 0.0f, 0.987688363f }, { 0x1f900050u } },
+	{ { 0.232321262f, 0.0228816476f, 0.972369909f }, { 0x1f103077u } },
+	{ { 0.233445361f, 0.0f, 0.972369909f }, { 0x5f100077u } },
+	{ { 0.228959784f, 0.045542933f, 0.972369909f }, { 0x5f105c75u } },
+	{ { 0.307529002f, 0.0302889626f, 0.95105654f }, { 0x5e603c9du } },
+	{ { 0.309017003f, 0.0f, 0.95105654f }, { 0x1e60009eu } },
+	{ { 0.303079307f, 0.0602862239f, 0.95105654f }, { 0x1e607c9bu } },
+	{ { 0.380840719f, 0.0375095345f, 0.923879504f }, { 0x1d804cc3u } },
+	{ { 0.382683426f, 0.0f, 0.923879504f }, { 0x5d8000c4u } },
+	{ { 0.375330269f, 0.0746578351f, 0.923879504f }, { 0x5d8098c0u } },
+	{ { 0.4452672f, 0.0885691494f, 0.891006529f }, { 0x1c70b4e4u } },
+	{ { 0.451804399f, 0.0444988497f, 0.891006529f }, { 0x5c705ce7u } },
+	{ { 0.453990489f, 0.0f, 0.891006529f }, { 0x1c7000e8u } },
+	{ { 0.519982576f, 0.0512138158f, 0.852640152f }, { 0x1b40690au } },
+	{ { 0.522498548f, 0.0f, 0.852640152f }, { 0x5b40010bu } },
+	{ { 0.51245892f, 0.101934411f, 0.852640152f }, { 0x5b40d106u } },
+	{ { 0.584954917f, 0.0576130301f, 0.809017003f }, { 0x59d0752bu } },
+	{ { 0.587785244f, 0.0f, 0.809017003f }, { 0x19d0012cu } },
+	{ { 0.576491117f, 0.114671215f, 0.809017003f }, { 0x19d0ed27u } },
+	{ { 0.63696909f, 0.126701027f, 0.760405958f }, { 0x58510545u } },
+	{ { 0.64632076f, 0.0636570379f, 0.760405958f }, { 0x1850854au } },
+	{ { 0.649448037f, 0.0f, 0.760405958f }, { 0x5850014cu } },
+	{ { 0.703701854f, 0.0693085864f, 0.707106769f }, { 0x56908d68u } },
+	{ { 0.707106769f, 0.0f, 0.707106769f }, { 0x16900169u } },
+	{ { 0.69351995f, 0.13794969f, 0.707106769f }, { 0x16911962u } },
+	{ { 0.756744385f, 0.0745328218f, 0.649448037f }, { 0x14c09983u } },
+	{ { 0.760405958f, 0.0f, 0.649448037f }, { 0x54c00185u } },
+	{ { 0.745794952f, 0.14834784f, 0.649448037f }, { 0x54c1317du } },
+	{ { 0.793471932f, 0.157831386f, 0.587785244f }, { 0x12c14595u } },
+	{ { 0.805121362f, 0.0792975351f, 0.587785244f }, { 0x52c0a59bu } },
+	{ { 0.809017003f, 0.0f, 0.587785244f }, { 0x12c0019du } },
+	{ { 0.848534465f, 0.0835733488f, 0.522498548f }, { 0x10b0adb2u } },
+	{ { 0.852640152f, 0.0f, 0.522498548f }, { 0x50b001b4u } },
+	{ { 0.836256921f, 0.166341841f, 0.522498548f }, { 0x50b155abu } },
+	{ { 0.886716068f, 0.0873339102f, 0.453990489f }, { 0x4e80b5c5u } },
+	{ { 0.891006529f, 0.0f, 0.453990489f }, { 0x0e8001c7u } },
+	{ { 0.873886108f, 0.173826754f, 0.453990489f }, { 0x0e8165bfu } },
+	{ { 0.906127453f, 0.180239961f, 0.382683426f }, { 0x4c4171cfu } },
+	{ { 0.919430792f, 0.090556033f, 0.382683426f }, { 0x0c40b9d6u } },
+	{ { 0.923879504f, 0.0f, 0.382683426f }, { 0x4c4001d8u } },
+	{ { 0.946476936f, 0.093219839f, 0.309017003f }, { 0x49e0c1e4u } },
+	{ { 0.95105654f, 0.0f, 0.309017003f }, { 0x09e001e6u } },
+	{ { 0.932782233f, 0.185541928f, 0.309017003f }, { 0x09e17dddu } },
+	{ { 0.967687666f, 0.0953089222f, 0.233445361f }, { 0x0770c5eeu } },
+	{ { 0.972369909f, 0.0f, 0.233445361f }, { 0x477001f1u } },
+	{ { 0.953686118f, 0.189699963f, 0.233445361f }, { 0x477185e7u } },
+	{ { 0.968710184f, 0.192688435f, 0.156434461f }, { 0x050189efu } },
+	{ { 0.982932329f, 0.0968103856f, 0.156434461f }, { 0x4500c5f6u } },
+	{ { 0.987688363f, 0.0f, 0.156434461f }, { 0x050001f9u } },
+	{ { 0.992116928f, 0.0977149829f, 0.0784590989f }, { 0x0280c9fbu } },
+	{ { 0.996917307f, 0.0f, 0.0784590989f }, { 0x428001fdu } },
+	{ { 0.977761865f, 0.194488928f, 0.0784590989f }, { 0x42818df4u } },
+	{ { 0.99518472f, 0.0980171412f, 2.18649922e-16f }, { 0x4000c9fdu } },
+	{ { 1.0f, 0.0f, 2.18649922e-16f }, { 0x000001ffu } },
+	{ { 0.980785251f, 0.195090324f, 2.18649922e-16f }, { 0x000191f5u } },
+	{ { 0.977761865f, 0.194488928f, -0.0784590989f }, { 0x7d818df4u } },
+	{ { 0.992116928f, 0.0977149829f, -0.0784590989f }, { 0x3d80c9fbu } },
+	{ { 0.996917307f, 0.0f, -0.0784590989f }, { 0x7d8001fdu } },
+	{ { 0.982932329f, 0.0968103856f, -0.156434461f }, { 0x7b00c5f6u } },
+	{ { 0.987688363f, 0.0f, -0.156434461f }, { 0x3b0001f9u } },
+	{ { 0.968710184f, 0.192688435f, -0.156434461f }, { 0x3b0189efu } },
+	{ { 0.967687666f, 0.0953089222f, -0.233445361f }, { 0x3890c5eeu } },
+	{ { 0.972369909f, 0.0f, -0.233445361f }, { 0x789001f1u } },
+	{ { 0.953686118f, 0.189699963f, -0.233445361f }, { 0x789185e7u } },
+	{ { 0.932782233f, 0.185541928f, -0.309017003f }, { 0x36217dddu } },
+	{ { 0.946476936f, 0.093219839f, -0.309017003f }, { 0x7620c1e4u } },
+	{ { 0.95105654f, 0.0f, -0.309017003f }, { 0x362001e6u } },
+	{ { 0.919430792f, 0.090556033f, -0.382683426f }, { 0x33c0b9d6u } },
+	{ { 0.923879504f, 0.0f, -0.382683426f }, { 0x73c001d8u } },
+	{ { 0.906127453f, 0.180239961f, -0.382683426f }, { 0x73c171cfu } },
+	{ { 0.886716068f, 0.0873339102f, -0.453990489f }, { 0x7180b5c5u } },
+	{ { 0.891006529f, 0.0f, -0.453990489f }, { 0x318001c7u } },
+	{ { 0.873886108f, 0.173826754f, -0.453990489f }, { 0x318165bfu } },
+	{ { 0.836256921f, 0.166341841f, -0.522498548f }, { 0x6f5155abu } },
+	{ { 0.848534465f, 0.0835733488f, -0.522498548f }, { 0x2f50adb2u } },
+	{ { 0.852640152f, 0.0f, -0.522498548f }, { 0x6f5001b4u } },
+	{ { 0.805121362f, 0.0792975351f, -0.587785244f }, { 0x6d40a59bu } },
+	{ { 0.809017003f, 0.0f, -0.587785244f }, { 0x2d40019du } },
+	{ { 0.793471932f, 0.157831386f, -0.587785244f }, { 0x2d414595u } },
+	{ { 0.756744385f, 0.0745328218f, -0.649448037f }, { 0x2b409983u } },
+	{ { 0.760405958f, 0.0f, -0.649448037f }, { 0x6b400185u } },
+	{ { 0.745794952f, 0.14834784f, -0.649448037f }, { 0x6b41317du } },
+	{ { 0.69351995f, 0.13794969f, -0.707106769f }, { 0x29711962u } },
+	{ { 0.703701854f, 0.0693085864f, -0.707106769f }, { 0x69708d68u } },
+	{ { 0.707106769f, 0.0f, -0.707106769f }, { 0x29700169u } },
+	{ { 0.64632076f, 0.0636570379f, -0.760405958f }, { 0x27b0854au } },
+	{ { 0.649448037f, 0.0f, -0.760405958f }, { 0x67b0014cu } },
+	{ { 0.63696909f, 0.126701027f, -0.760405958f }, { 0x67b10545u } },
+	{ { 0.584954917f, 0.0576130301f, -0.809017003f }, { 0x6630752bu } },
+	{ { 0.587785244f, 0.0f, -0.809017003f }, { 0x2630012cu } },
+	{ { 0.576491117f, 0.114671215f, -0.809017003f }, { 0x2630ed27u } },
+	{ { 0.51245892f, 0.101934411f, -0.852640152f }, { 0x64c0d106u } },
+	{ { 0.519982576f, 0.0512138158f, -0.852640152f }, { 0x24c0690au } },
+	{ { 0.522498548f, 0.0f, -0.852640152f }, { 0x64c0010bu } },
+	{ { 0.49999994f, 0.151673332f, -0.852640152f }, { 0x24c138ffu } },
+	{ { 0.451804399f, 0.0444988497f, -0.891006529f }, { 0x63905ce7u } },
+	{ { 0.453990489f, 0.0f, -0.891006529f }, { 0x239000e8u } },
+	{ { 0.4452672f, 0.0885691494f, -0.891006529f }, { 0x2390b4e4u } },
+	{ { 0.380840719f, 0.0375095345f, -0.923879504f }, { 0x22804cc3u } },
+	{ { 0.382683426f, 0.0f, -0.923879504f }, { 0x628000c4u } },
+	{ { 0.307529002f, 0.0302889626f, -0.95105654f }, { 0x61a03c9du } },
+	{ { 0.375330269f, 0.0746578351f, -0.923879504f }, { 0x628098c0u } },
+	{ { 0.303079307f, 0.0602862239f, -0.95105654f }, { 0x21a07c9bu } },
+	{ { 0.228959784f, 0.045542933f, -0.972369909f }, { 0x60f05c75u } },
+	{ { 0.223393291f, 0.0677656084f, -0.972369909f }, { 0x20f08c72u } },
+	{ { 0.295710832f, 0.0897028968f, -0.95105654f }, { 0x61a0b897u } },
+	{ { 0.215675399f, 0.0893356726f, -0.972369909f }, { 0x60f0b86eu } },
+	{ { 0.366205215f, 0.111087136f, -0.923879504f }, { 0x2280e4bbu } },
+	{ { 0.285494477f, 0.118255682f, -0.95105654f }, { 0x21a0f092u } },
+	{ { 0.205880433f, 0.110045381f, -0.972369909f }, { 0x20f0e069u } },
+	{ { 0.434441835f, 0.131786481f, -0.891006529f }, { 0x63910cdeu } },
+	{ { 0.353553385f, 0.146446615f, -0.923879504f }, { 0x62812cb5u } },
+	{ { 0.272528648f, 0.145669609f, -0.95105654f }, { 0x61a1288bu } },
+	{ { 0.194102719f, 0.129695296f, -0.972369909f }, { 0x60f10863u } },
+	{ { 0.419432521f, 0.17373465f, -0.891006529f }, { 0x239164d6u } },
+	{ { 0.337496668f, 0.180395722f, -0.923879504f }, { 0x228170acu } },
+	{ { 0.256938249f, 0.171680644f, -0.95105654f }, { 0x21a16083u } },
+	{ { 0.1804557f, 0.148096174f, -0.972369909f }, { 0x20f1305cu } },
+	{ { 0.238873363f, 0.196038306f, -0.95105654f }, { 0x61a1907au } },
+	{ { 0.165070802f, 0.165070802f, -0.972369909f }, { 0x60f15054u } },
+	{ { 0.318189651f, 0.212607518f, -0.923879504f }, { 0x6281b4a3u } },
+	{ { -0.953686118f, 0.189699963f, -0.233445361f }, { 0x78918619u } },
+	{ { -0.946476936f, 0.093219839f, -0.309017003f }, { 0x7620c21cu } },
+	{ { -0.945158839f, 0.286710799f, -0.156434461f }, { 0x7b024e1du } },
+	{ { -0.967687666f, 0.0953089222f, -0.233445361f }, { 0x3890c612u } },
+	{ { -0.95105654f, 2.07948428e-16f, -0.309017003f }, { 0x3620021au } },
+	{ { -0.968710184f, 0.192688435f, -0.156434461f }, { 0x3b018a11u } },
+	{ { -0.921031535f, 0.381503761f, -0.0784590989f }, { 0x7d830e29u } },
+	{ { -0.9539904f, 0.289389819f, -0.0784590989f }, { 0x3d825219u } },
+	{ { -0.972369909f, 2.12608605e-16f, -0.233445361f }, { 0x7890020fu } },
+	{ { -0.946476936f, -0.093219839f, -0.309017003f }, { 0x762f421cu } },
+	{ { -0.982932329f, 0.0968103856f, -0.156434461f }, { 0x7b00c60au } },
+	{ { -0.967687666f, -0.0953089222f, -0.233445361f }, { 0x389f3e12u } },
+	{ { -0.932782233f, -0.185541928f, -0.309017003f }, { 0x362e8623u } },
+	{ { -0.987688363f, 2.15957972e-16f, -0.156434461f }, { 0x3b000207u } },
+	{ { -0.977761865f, 0.194488928f, -0.0784590989f }, { 0x7d818e0cu } },
+	{ { -0.992116928f, 0.0977149829f, -0.0784590989f }, { 0x3d80ca05u } },
+	{ { -0.953686118f, -0.189699963f, -0.233445361f }, { 0x789e7e19u } },
+	{ { -0.910104334f, -0.276077121f, -0.309017003f }, { 0x762dce2fu } },
+	{ { -0.982932329f, -0.0968103856f, -0.156434461f }, { 0x7b0f3e0au } },
+	{ { -0.930499971f, -0.282264084f, -0.233445361f }, { 0x389dc225u } },
+	{ { -0.878661633f, -0.363953561f, -0.309017003f }, { 0x362d1a3fu } },
+	{ { -0.968710184f, -0.192688435f, -0.156434461f }, { 0x3b0e7a11u } },
+	{ { -0.996917307f, 2.17975895e-16f, -0.0784590989f }, { 0x7d800203u } },
+	{ { -0.992116928f, -0.0977149829f, -0.0784590989f }, { 0x3d8f3a05u } },
+	{ { -0.898352683f, -0.37210986f, -0.233445361f }, { 0x789d0a35u } },
+	{ { -0.838756979f, -0.448324949f, -0.309017003f }, { 0x762c6e53u } },
+	{ { -0.945158839f, -0.286710799f, -0.156434461f }, { 0x7b0db61du } },
+	{ { -0.85755372f, -0.458371997f, -0.233445361f }, { 0x389c5a4au } },
+	{ { -0.790774584f, -0.528378665f, -0.309017003f }, { 0x362bca6cu } },
+	{ { -0.912505031f, -0.377971977f, -0.156434461f }, { 0x3b0cfe2eu } },
+	{ { -0.977761865f, -0.194488928f, -0.0784590989f }, { 0x7d8e760cu } },
+	{ { -0.9539904f, -0.289389819f, -0.0784590989f }, { 0x3d8db219u } },
+	{ { -0.808496058f, -0.540219784f, -0.233445361f }, { 0x789bb263u } },
+	{ { -0.735176623f, -0.603343844f, -0.309017003f }, { 0x762b3288u } },
+	{ { -0.871063352f, -0.46559307f, -0.156434461f }, { 0x7b0c4a43u } },
+	{ { -0.751652122f, -0.61686492f, -0.233445361f }, { 0x389b1680u } },
+	{ { -0.672498524f, -0.672498524f, -0.309017003f }, { 0x362aa2a8u } },
+	{ { -0.821232855f, -0.548730254f, -0.156434461f }, { 0x3b0ba25cu } },
+	{ { -0.921031535f, -0.381503761f, -0.0784590989f }, { 0x7d8cf629u } },
+	{ { -0.879202604f, -0.469943583f, -0.0784590989f }, { 0x3d8c423fu } },
+	{ { -0.68756938f, -0.68756938f, -0.233445361f }, { 0x789a86a1u } },
+	{ { -0.603343844f, -0.735176623f, -0.309017003f }, { 0x762a22ccu } },
+	{ { -0.763493419f, -0.626582861f, -0.156434461f }, { 0x7b0b027au } },
+	{ { -0.61686492f, -0.751652122f, -0.233445361f }, { 0x389a02c5u } },
+	{ { -0.528378665f, -0.790774584f, -0.309017003f }, { 0x3629b2f2u } },
+	{ { -0.698401153f, -0.698401153f, -0.156434461f }, { 0x3b0a6e9bu } },
+	{ { -0.828906476f, -0.553857625f, -0.0784590989f }, { 0x7d8b9658u } },
+	{ { -0.770627499f, -0.632437646f, -0.0784590989f }, { 0x3d8af676u } },
+	{ { -0.540219784f, -0.808496058f, -0.233445361f }, { 0x78998eecu } },
+	{ { -0.448324949f, -0.838756979f, -0.309017003f }, { 0x76294f1bu } },
+	{ { -0.626582861f, -0.763493419f, -0.156434461f }, { 0x7b09eac0u } },
+	{ { -0.458371997f, -0.85755372f, -0.233445361f }, { 0x38992b16u } },
+	{ { -0.363953561f, -0.878661633f, -0.309017003f }, { 0x3628ff46u } },
+	{ { -0.548730254f, -0.821232855f, -0.156434461f }, { 0x3b0972e8u } },
+	{ { -0.704927027f, -0.704927027f, -0.0784590989f }, { 0x7d8a6298u } },
+	{ { -0.632437646f, -0.770627499f, -0.0784590989f }, { 0x3d89dabdu } },
+	{ { -0.37210986f, -0.898352683f, -0.233445361f }, { 0x7898d742u } },
+	{ { -0.276077121f, -0.910104334f, -0.309017003f }, { 0x7628bf73u } },
+	{ { 0.0745328218f, 0.756744385f, -0.649448037f }, { 0x2b460c26u } },
+	{ { 1.66262708e-16f, 0.760405958f, -0.649448037f }, { 0x6b461400u } },
+	{ { 0.0792975351f, 0.805121362f, -0.587785244f }, { 0x6d466c29u } },
+	{ { -0.0745328218f, 0.756744385f, -0.649448037f }, { 0x2b460fdau } },
+	{ { 1.76891502e-16f, 0.809017003f, -0.587785244f }, { 0x2d467400u } },
+	{ { -0.14834784f, 0.745794952f, -0.649448037f }, { 0x6b45f7b4u } },
+	{ { -0.0792975351f, 0.805121362f, -0.587785244f }, { 0x6d466fd7u } },
+	{ { -0.220734194f, 0.727663159f, -0.649448037f }, { 0x2b45d38fu } },
+	{ { -0.157831386f, 0.793471932f, -0.587785244f }, { 0x2d4657afu } },
+	{ { -0.290994763f, 0.70252353f, -0.649448037f }, { 0x6b459f6bu } },
+	{ { -0.234845236f, 0.774181008f, -0.587785244f }, { 0x6d463388u } },
+	{ { -0.358452886f, 0.670618176f, -0.649448037f }, { 0x2b455f49u } },
+	{ { -0.309597403f, 0.747434258f, -0.587785244f }, { 0x2d45fb62u } },
+	{ { -0.422458917f, 0.632254481f, -0.649448037f }, { 0x6b450f28u } },
+	{ { -0.381367981f, 0.713489294f, -0.587785244f }, { 0x6d45b73du } },
+	{ { -0.482396424f, 0.587801754f, -0.649448037f }, { 0x2b44b309u } },
+	{ { -0.449465752f, 0.672673047f, -0.587785244f }, { 0x2d45631au } },
+	{ { -0.401931792f, 0.75196147f, -0.522498548f }, { 0x2f560333u } },
+	{ { -0.537688196f, 0.537688196f, -0.649448037f }, { 0x6b444eedu } },
+	{ { -0.513234973f, 0.625378609f, -0.587785244f }, { 0x6d4502fau } },
+	{ { -0.587801754f, 0.482396424f, -0.649448037f }, { 0x2b43ded4u } },
+	{ { -0.572061419f, 0.572061419f, -0.587785244f }, { 0x2d4492dcu } },
+	{ { -0.473701507f, 0.70894438f, -0.522498548f }, { 0x6f55ab0eu } },
+	{ { -0.540909171f, 0.659099758f, -0.522498548f }, { 0x2f5546ecu } },
+	{ { -0.632254481f, 0.422458917f, -0.649448037f }, { 0x6b4362bdu } },
+	{ { -0.625378609f, 0.513234973f, -0.587785244f }, { 0x6d441ac0u } },
+	{ { -0.670618176f, 0.358452886f, -0.649448037f }, { 0x2b42dea9u } },
+	{ { -0.672673047f, 0.449465752f, -0.587785244f }, { 0x2d439aa8u } },
+	{ { -0.602907658f, 0.602907658f, -0.522498548f }, { 0x6f54d2ccu } },
+	{ { -0.659099758f, 0.540909171f, -0.522498548f }, { 0x2f5452afu } },
+	{ { -0.70252353f, 0.290994763f, -0.649448037f }, { 0x6b425699u } },
+	{ { -0.713489294f, 0.381367981f, -0.587785244f }, { 0x6d430e93u } },
+	{ { -0.727663159f, 0.220734194f, -0.649448037f }, { 0x2b41c68cu } },
+	{ { -0.747434258f, 0.309597403f, -0.587785244f }, { 0x2d427a82u } },
+	{ { -0.70894438f, 0.473701507f, -0.522498548f }, { 0x6f53ca96u } },
+	{ { -0.75196147f, 0.401931792f, -0.522498548f }, { 0x2f533680u } },
+	{ { -0.745794952f, 0.14834784f, -0.649448037f }, { 0x6b413283u } },
+	{ { -0.774181008f, 0.234845236f, -0.587785244f }, { 0x6d41e274u } },
+	{ { -0.756744385f, 0.0745328218f, -0.649448037f }, { 0x2b409a7du } },
+	{ { -0.793471932f, 0.157831386f, -0.587785244f }, { 0x2d41466bu } },
+	{ { -0.787736773f, 0.326291263f, -0.522498548f }, { 0x6f529e6du } },
+	{ { -0.815925777f, 0.247508377f, -0.522498548f }, { 0x2f51fa5fu } },
+	{ { -0.760405958f, 1.66262708e-16f, -0.649448037f }, { 0x6b40027bu } },
+	{ { -0.805121362f, 0.0792975351f, -0.587785244f }, { 0x6d40a665u } },
+	{ { -0.756744385f, -0.0745328218f, -0.649448037f }, { 0x2b4f6a7du } },
+	{ { -0.809017003f, 1.76891502e-16f, -0.587785244f }, { 0x2d400263u } },
+	{ { -0.836256921f, 0.166341841f, -0.522498548f }, { 0x6f515655u } },
+	{ { -0.848534465f, 0.0835733488f, -0.522498548f }, { 0x2f50ae4eu } },
+	{ { -0.873886108f, -0.173826754f, -0.453990489f }, { 0x318e9e41u } },
+	{ { -0.852640092f, -0.258645535f, -0.453990489f }, { 0x718df24cu } },
+	{ { -0.815925777f, -0.247508377f, -0.522498548f }, { 0x2f5e0a5fu } },
+	{ { -0.787736773f, -0.326291263f, -0.522498548f }, { 0x6f5d666du } },
+	{ { -0.919430792f, -0.090556033f, -0.382683426f }, { 0x33cf4a2au } },
+	{ { -0.906127453f, -0.180239961f, -0.382683426f }, { 0x73ce9231u } },
+	{ { -0.823182702f, -0.340973437f, -0.453990489f }, { 0x318d4a5bu } },
+	{ { -0.75196147f, -0.401931792f, -0.522498548f }, { 0x2f5cce80u } },
+	{ { -0.884097576f, -0.268188059f, -0.382683426f }, { 0x33cdde3cu } },
+	{ { -0.785797596f, -0.42001757f, -0.453990489f }, { 0x718ca66eu } },
+	{ { -0.70894438f, -0.473701507f, -0.522498548f }, { 0x6f5c3a96u } },
+	{ { -0.853553414f, -0.353553385f, -0.382683426f }, { 0x73cd2e4cu } },
+	{ { -0.740844846f, -0.495016694f, -0.453990489f }, { 0x318c0e85u } },
+	{ { -0.659099758f, -0.540909171f, -0.522498548f }, { 0x2f5bb2afu } },
+	{ { -0.814788997f, -0.435513794f, -0.382683426f }, { 0x33cc8660u } },
+	{ { -0.68875736f, -0.565248549f, -0.453990489f }, { 0x718b7ea0u } },
+	{ { -0.602907658f, -0.602907658f, -0.522498548f }, { 0x6f5b32ccu } },
+	{ { -0.768177748f, -0.513279974f, -0.382683426f }, { 0x73cbea77u } },
+	{ { -0.630036771f, -0.630036771f, -0.453990489f }, { 0x318afabeu } },
+	{ { -0.540909171f, -0.659099758f, -0.522498548f }, { 0x2f5abeecu } },
+	{ { -0.714168549f, -0.586102962f, -0.382683426f }, { 0x33cb5693u } },
+	{ { -0.565248549f, -0.68875736f, -0.453990489f }, { 0x718a82dfu } },
+	{ { -0.473701507f, -0.70894438f, -0.522498548f }, { 0x6f5a5b0eu } },
+	{ { -0.65328151f, -0.65328151f, -0.382683426f }, { 0x73cacab2u } },
+	{ { -0.495016694f, -0.740844846f, -0.453990489f }, { 0x318a1703u } },
+	{ { -0.401931792f, -0.75196147f, -0.522498548f }, { 0x2f5a0333u } },
+	{ { -0.586102962f, -0.714168549f, -0.382683426f }, { 0x33ca4ed5u } },
+	{ { -0.42001757f, -0.785797596f, -0.453990489f }, { 0x7189bb29u } },
+	{ { -0.326291263f, -0.787736773f, -0.522498548f }, { 0x6f59b759u } },
+	{ { -0.513279974f, -0.768177748f, -0.382683426f }, { 0x73c9defau } },
+	{ { -0.340973437f, -0.823182702f, -0.453990489f }, { 0x31896f52u } },
+	{ { -0.247508377f, -0.815925777f, -0.522498548f }, { 0x2f597f82u } },
+	{ { -0.435513794f, -0.814788997f, -0.382683426f }, { 0x33c98321u } },
+	{ { -0.258645535f, -0.852640092f, -0.453990489f }, { 0x7189337cu } },
+	{ { -0.166341841f, -0.836256921f, -0.522498548f }, { 0x6f5957abu } },
+	{ { -0.353553385f, -0.853553414f, -0.382683426f }, { 0x73c9334bu } },
+	{ { -0.173826754f, -0.873886108f, -0.453990489f }, { 0x318907a7u } },
+	{ { -0.0835733488f, -0.848534465f, -0.522498548f }, { 0x2f593bd5u } },
+	{ { -0.268188059f, -0.884097576f, -0.382683426f }, { 0x33c8f377u } },
+	{ { -0.0873339102f, -0.886716068f, -0.453990489f }, { 0x7188efd3u } },
+	{ { 0.0f, -0.852640152f, -0.522498548f }, { 0x6f593000u } },
+	{ { -0.180239961f, -0.906127453f, -0.382683426f }, { 0x73c8c7a4u } },
+	{ { 0.0f, -0.891006529f, -0.453990489f }, { 0x3188e400u } },
+	{ { 0.0835733488f, -0.848534465f, -0.522498548f }, { 0x2f59382bu } },
+	{ { -0.090556033f, -0.919430792f, -0.382683426f }, { 0x33c8abd2u } },
+	{ { 0.0873339102f, -0.886716068f, -0.453990489f }, { 0x7188ec2du } },
+	{ { 0.166341841f, -0.836256921f, -0.522498548f }, { 0x6f595455u } },
+	{ { 0.173826754f, -0.873886108f, -0.453990489f }, { 0x31890459u } },
+	{ { 0.0f, -0.923879504f, -0.382683426f }, { 0x73c8a000u } },
+	{ { 0.090556033f, -0.919430792f, -0.382683426f }, { 0x33c8a82eu } },
+	{ { 0.180239961f, -0.906127453f, -0.382683426f }, { 0x73c8c45cu } },
+	{ { -0.340973437f, 0.823182702f, -0.453990489f }, { 0x31869752u } },
+	{ { -0.268188059f, 0.884097576f, -0.382683426f }, { 0x33c71377u } },
+	{ { -0.42001757f, 0.785797596f, -0.453990489f }, { 0x71864b29u } },
+	{ { -0.353553385f, 0.853553414f, -0.382683426f }, { 0x73c6d34bu } },
+	{ { -0.495016694f, 0.740844846f, -0.453990489f }, { 0x3185ef03u } },
+	{ { -0.435513794f, 0.814788997f, -0.382683426f }, { 0x33c68321u } },
+	{ { -0.565248549f, 0.68875736f, -0.453990489f }, { 0x718582dfu } },
+	{ { -0.513279974f, 0.768177748f, -0.382683426f }, { 0x73c626fau } },
+	{ { -0.630036771f, 0.630036771f, -0.453990489f }, { 0x31850abeu } },
+	{ { -0.586102962f, 0.714168549f, -0.382683426f }, { 0x33c5b6d5u } },
+	{ { -0.68875736f, 0.565248549f, -0.453990489f }, { 0x718486a0u } },
+	{ { -0.65328151f, 0.65328151f, -0.382683426f }, { 0x73c53ab2u } },
+	{ { -0.740844846f, 0.495016694f, -0.453990489f }, { 0x3183f685u } },
+	{ { -0.714168549f, 0.586102962f, -0.382683426f }, { 0x33c4ae93u } },
+	{ { -0.785797596f, 0.42001757f, -0.453990489f }, { 0x71835e6eu } },
+	{ { -0.768177748f, 0.513279974f, -0.382683426f }, { 0x73c41a77u } },
+	{ { -0.823182702f, 0.340973437f, -0.453990489f }, { 0x3182ba5bu } },
+	{ { -0.814788997f, 0.435513794f, -0.382683426f }, { 0x33c37e60u } },
+	{ { -0.852640092f, 0.258645535f, -0.453990489f }, { 0x7182124cu } },
+	{ { -0.853553414f, 0.353553385f, -0.382683426f }, { 0x73c2d64cu } },
+	{ { -0.873886108f, 0.173826754f, -0.453990489f }, { 0x31816641u } },
+	{ { -0.884097576f, 0.268188059f, -0.382683426f }, { 0x33c2263cu } },
+	{ { -0.886716068f, 0.0873339102f, -0.453990489f }, { 0x7180b63bu } },
+	{ { -0.852640152f, 1.86429702e-16f, -0.522498548f }, { 0x6f50024cu } },
+	{ { -0.906127453f, 0.180239961f, -0.382683426f }, { 0x73c17231u } },
+	{ { -0.891006529f, 1.94818504e-16f, -0.453990489f }, { 0x31800239u } },
+	{ { -0.848534465f, -0.0835733488f, -0.522498548f }, { 0x2f5f564eu } },
+	{ { -0.919430792f, 0.090556033f, -0.382683426f }, { 0x33c0ba2au } },
+	{ { -0.886716068f, -0.0873339102f, -0.453990489f }, { 0x718f4e3bu } },
+	{ { -0.836256921f, -0.166341841f, -0.522498548f }, { 0x6f5eae55u } },
+	{ { -0.923879504f, 2.02006188e-16f, -0.382683426f }, { 0x73c00228u } },
+	{ { 0.0f, -0.809017003f, -0.587785244f }, { 0x2d498c00u } },
+	{ { -0.0792975351f, -0.805121362f, -0.587785244f }, { 0x6d4997d7u } },
+	{ { 0.0745328218f, -0.756744385f, -0.649448037f }, { 0x2b49f426u } },
+	{ { 0.14834784f, -0.745794952f, -0.649448037f }, { 0x6b4a0c4cu } },
+	{ { 0.0792975351f, -0.805121362f, -0.587785244f }, { 0x6d499429u } },
+	{ { 0.220734194f, -0.727663159f, -0.649448037f }, { 0x2b4a3071u } },
+	{ { 0.157831386f, -0.793471932f, -0.587785244f }, { 0x2d49ac51u } },
+	{ { 0.290994763f, -0.70252353f, -0.649448037f }, { 0x6b4a6495u } },
+	{ { 0.234845236f, -0.774181008f, -0.587785244f }, { 0x6d49d078u } },
+	{ { 0.309597403f, -0.747434258f, -0.587785244f }, { 0x2d4a089eu } },
+	{ { 0.247508377f, -0.815925777f, -0.522498548f }, { 0x2f597c7eu } },
+	{ { 0.326291263f, -0.787736773f, -0.522498548f }, { 0x6f59b4a7u } },
+	{ { 0.340973437f, -0.823182702f, -0.453990489f }, { 0x31896caeu } },
+	{ { 0.258645535f, -0.852640092f, -0.453990489f }, { 0x71893084u } },
+	{ { 0.353553385f, -0.853553414f, -0.382683426f }, { 0x73c930b5u } },
+	{ { 0.268188059f, -0.884097576f, -0.382683426f }, { 0x33c8f089u } },
+	{ { 0.363953561f, -0.878661633f, -0.309017003f }, { 0x3628fcbau } },
+	{ { 0.276077121f, -0.910104334f, -0.309017003f }, { 0x7628bc8du } },
+	{ { 0.185541928f, -0.932782233f, -0.309017003f }, { 0x36288c5fu } },
+	{ { 0.37210986f, -0.898352683f, -0.233445361f }, { 0x7898d4beu } },
+	{ { 0.282264084f, -0.930499971f, -0.233445361f }, { 0x38989490u } },
+	{ { 0.377971977f, -0.912505031f, -0.156434461f }, { 0x3b08b8c1u } },
+	{ { 0.286710799f, -0.945158839f, -0.156434461f }, { 0x7b087493u } },
+	{ { 0.189699963f, -0.953686118f, -0.233445361f }, { 0x78986461u } },
+	{ { 0.192688435f, -0.968710184f, -0.156434461f }, { 0x3b084462u } },
+	{ { 0.381503761f, -0.921031535f, -0.0784590989f }, { 0x7d88a4c3u } },
+	{ { 0.289389819f, -0.9539904f, -0.0784590989f }, { 0x3d886494u } },
+	{ { 0.382683426f, -0.923879504f, 2.18649922e-16f }, { 0x0008a0c4u } },
+	{ { 0.290284663f, -0.956940353f, 2.18649922e-16f }, { 0x40085c94u } },
+	{ { 0.194488928f, -0.977761865f, -0.0784590989f }, { 0x7d883063u } },
+	{ { 0.195090324f, -0.980785251f, 2.18649922e-16f }, { 0x00082c64u } },
+	{ { 0.381503761f, -0.921031535f, 0.0784590989f }, { 0x4288a4c3u } },
+	{ { 0.289389819f, -0.9539904f, 0.0784590989f }, { 0x02886494u } },
+	{ { 0.377971977f, -0.912505031f, 0.156434461f }, { 0x0508b8c1u } },
+	{ { 0.286710799f, -0.945158839f, 0.156434461f }, { 0x45087493u } },
+	{ { 0.194488928f, -0.977761865f, 0.0784590989f }, { 0x42883063u } },
+	{ { 0.192688435f, -0.968710184f, 0.156434461f }, { 0x05084462u } },
+	{ { 0.37210986f, -0.898352683f, 0.233445361f }, { 0x4778d4beu } },
+	{ { 0.282264084f, -0.930499971f, 0.233445361f }, { 0x07789490u } },
+	{ { 0.363953561f, -0.878661633f, 0.309017003f }, { 0x09e8fcbau } },
+	{ { 0.276077121f, -0.910104334f, 0.309017003f }, { 0x49e8bc8du } },
+	{ { 0.189699963f, -0.953686118f, 0.233445361f }, { 0x47786461u } },
+	{ { 0.185541928f, -0.932782233f, 0.309017003f }, { 0x09e88c5fu } },
+	{ { 0.353553385f, -0.853553414f, 0.382683426f }, { 0x4c4930b5u } },
+	{ { 0.268188059f, -0.884097576f, 0.382683426f }, { 0x0c48f089u } },
+	{ { 0.180239961f, -0.906127453f, 0.382683426f }, { 0x4c48c45cu } },
+	{ { -0.745794952f, -0.14834784f, -0.649448037f }, { 0x6b4ed283u } },
+	{ { -0.805121362f, -0.0792975351f, -0.587785244f }, { 0x6d4f5e65u } },
+	{ { -0.727663159f, -0.220734194f, -0.649448037f }, { 0x2b4e3e8cu } },
+	{ { -0.793471932f, -0.157831386f, -0.587785244f }, { 0x2d4ebe6bu } },
+	{ { -0.70252353f, -0.290994763f, -0.649448037f }, { 0x6b4dae99u } },
+	{ { -0.774181008f, -0.234845236f, -0.587785244f }, { 0x6d4e2274u } },
+	{ { -0.670618176f, -0.358452886f, -0.649448037f }, { 0x2b4d26a9u } },
+	{ { -0.747434258f, -0.309597403f, -0.587785244f }, { 0x2d4d8a82u } },
+	{ { -0.632254481f, -0.422458917f, -0.649448037f }, { 0x6b4ca2bdu } },
+	{ { -0.713489294f, -0.381367981f, -0.587785244f }, { 0x6d4cf693u } },
+	{ { -0.587801754f, -0.482396424f, -0.649448037f }, { 0x2b4c26d4u } },
+	{ { -0.672673047f, -0.449465752f, -0.587785244f }, { 0x2d4c6aa8u } },
+	{ { -0.537688196f, -0.537688196f, -0.649448037f }, { 0x6b4bb6edu } },
+	{ { -0.625378609f, -0.513234973f, -0.587785244f }, { 0x6d4beac0u } },
+	{ { -0.482396424f, -0.587801754f, -0.649448037f }, { 0x2b4b5309u } },
+	{ { -0.572061419f, -0.572061419f, -0.587785244f }, { 0x2d4b72dcu } },
+	{ { -0.422458917f, -0.632254481f, -0.649448037f }, { 0x6b4af728u } },
+	{ { -0.513234973f, -0.625378609f, -0.587785244f }, { 0x6d4b02fau } },
+	{ { -0.358452886f, -0.670618176f, -0.649448037f }, { 0x2b4aa749u } },
+	{ { -0.449465752f, -0.672673047f, -0.587785244f }, { 0x2d4aa31au } },
+	{ { -0.290994763f, -0.70252353f, -0.649448037f }, { 0x6b4a676bu } },
+	{ { -0.381367981f, -0.713489294f, -0.587785244f }, { 0x6d4a4f3du } },
+	{ { -0.220734194f, -0.727663159f, -0.649448037f }, { 0x2b4a338fu } },
+	{ { -0.309597403f, -0.747434258f, -0.587785244f }, { 0x2d4a0b62u } },
+	{ { -0.14834784f, -0.745794952f, -0.649448037f }, { 0x6b4a0fb4u } },
+	{ { -0.234845236f, -0.774181008f, -0.587785244f }, { 0x6d49d388u } },
+	{ { -0.0745328218f, -0.756744385f, -0.649448037f }, { 0x2b49f7dau } },
+	{ { -0.157831386f, -0.793471932f, -0.587785244f }, { 0x2d49afafu } },
+	{ { 0.0f, -0.760405958f, -0.649448037f }, { 0x6b49ec00u } },
+	{ { 0.886716068f, -0.0873339102f, -0.453990489f }, { 0x718f4dc5u } },
+	{ { 0.852640152f, 0.0f, -0.522498548f }, { 0x6f5001b4u } },
+	{ { 0.848534465f, -0.0835733488f, -0.522498548f }, { 0x2f5f55b2u } },
+	{ { 0.891006529f, 0.0f, -0.453990489f }, { 0x318001c7u } },
+	{ { 0.873886108f, -0.173826754f, -0.453990489f }, { 0x318e9dbfu } },
+	{ { 0.836256921f, -0.166341841f, -0.522498548f }, { 0x6f5eadabu } },
+	{ { 0.919430792f, -0.090556033f, -0.382683426f }, { 0x33cf49d6u } },
+	{ { 0.923879504f, 0.0f, -0.382683426f }, { 0x73c001d8u } },
+	{ { 0.906127453f, -0.180239961f, -0.382683426f }, { 0x73ce91cfu } },
+	{ { 0.852640092f, -0.258645535f, -0.453990489f }, { 0x718df1b4u } },
+	{ { 0.815925777f, -0.247508377f, -0.522498548f }, { 0x2f5e09a1u } },
+	{ { 0.884097576f, -0.268188059f, -0.382683426f }, { 0x33cdddc4u } },
+	{ { 0.946476936f, -0.093219839f, -0.309017003f }, { 0x762f41e4u } },
+	{ { 0.95105654f, 0.0f, -0.309017003f }, { 0x362001e6u } },
+	{ { 0.932782233f, -0.185541928f, -0.309017003f }, { 0x362e85ddu } },
+	{ { 0.967687666f, -0.0953089222f, -0.233445361f }, { 0x389f3deeu } },
+	{ { 0.972369909f, 0.0f, -0.233445361f }, { 0x789001f1u } },
+	{ { 0.953686118f, -0.189699963f, -0.233445361f }, { 0x789e7de7u } },
+	{ { 0.910104334f, -0.276077121f, -0.309017003f }, { 0x762dcdd1u } },
+	{ { 0.930499971f, -0.282264084f, -0.233445361f }, { 0x389dc1dbu } },
+	{ { 0.982932329f, -0.0968103856f, -0.156434461f }, { 0x7b0f3df6u } },
+	{ { 0.987688363f, 0.0f, -0.156434461f }, { 0x3b0001f9u } },
+	{ { 0.968710184f, -0.192688435f, -0.156434461f }, { 0x3b0e79efu } },
+	{ { 0.992116928f, -0.0977149829f, -0.0784590989f }, { 0x3d8f39fbu } },
+	{ { 0.996917307f, 0.0f, -0.0784590989f }, { 0x7d8001fdu } },
+	{ { 0.977761865f, -0.194488928f, -0.0784590989f }, { 0x7d8e75f4u } },
+	{ { 0.945158839f, -0.286710799f, -0.156434461f }, { 0x7b0db5e3u } },
+	{ { 0.9539904f, -0.289389819f, -0.0784590989f }, { 0x3d8db1e7u } },
+	{ { 0.99518472f, -0.0980171412f, 2.18649922e-16f }, { 0x400f39fdu } },
+	{ { 1.0f, 0.0f, 2.18649922e-16f }, { 0x000001ffu } },
+	{ { 0.980785251f, -0.195090324f, 2.18649922e-16f }, { 0x000e71f5u } },
+	{ { 0.992116928f, -0.0977149829f, 0.0784590989f }, { 0x028f39fbu } },
+	{ { 0.996917307f, 0.0f, 0.0784590989f }, { 0x428001fdu } },
+	{ { 0.977761865f, -0.194488928f, 0.0784590989f }, { 0x428e75f4u } },
+	{ { 0.956940353f, -0.290284663f, 2.18649922e-16f }, { 0x400db1e9u } },
+	{ { 0.9539904f, -0.289389819f, 0.0784590989f }, { 0x028db1e7u } },
+	{ { 0.982932329f, -0.0968103856f, 0.156434461f }, { 0x450f3df6u } },
+	{ { 0.987688363f, 0.0f, 0.156434461f }, { 0x050001f9u } },
+	{ { 0.968710184f, -0.192688435f, 0.156434461f }, { 0x050e79efu } },
+	{ { 0.967687666f, -0.0953089222f, 0.233445361f }, { 0x077f3deeu } },
+	{ { 0.972369909f, 0.0f, 0.233445361f }, { 0x477001f1u } },
+	{ { 0.953686118f, -0.189699963f, 0.233445361f }, { 0x477e7de7u } },
+	{ { 0.945158839f, -0.286710799f, 0.156434461f }, { 0x450db5e3u } },
+	{ { 0.930499971f, -0.282264084f, 0.233445361f }, { 0x077dc1dbu } },
+	{ { 0.946476936f, -0.093219839f, 0.309017003f }, { 0x49ef41e4u } },
+	{ { 0.95105654f, 0.0f, 0.309017003f }, { 0x09e001e6u } },
+	{ { 0.932782233f, -0.185541928f, 0.309017003f }, { 0x09ee85ddu } },
+	{ { 0.919430792f, -0.090556033f, 0.382683426f }, { 0x0c4f49d6u } },
+	{ { 0.923879504f, 0.0f, 0.382683426f }, { 0x4c4001d8u } },
+	{ { 0.906127453f, -0.180239961f, 0.382683426f }, { 0x4c4e91cfu } },
+	{ { 0.910104334f, -0.276077121f, 0.309017003f }, { 0x49edcdd1u } },
+	{ { 0.884097576f, -0.268188059f, 0.382683426f }, { 0x0c4dddc4u } },
+	{ { 0.886716068f, -0.0873339102f, 0.453990489f }, { 0x4e8f4dc5u } },
+	{ { 0.891006529f, 0.0f, 0.453990489f }, { 0x0e8001c7u } },
+	{ { 0.873886108f, -0.173826754f, 0.453990489f }, { 0x0e8e9dbfu } },
+	{ { 0.848534465f, -0.0835733488f, 0.522498548f }, { 0x10bf55b2u } },
+	{ { 0.852640152f, 0.0f, 0.522498548f }, { 0x50b001b4u } },
+	{ { 0.836256921f, -0.166341841f, 0.522498548f }, { 0x50beadabu } },
+	{ { 0.852640092f, -0.258645535f, 0.453990489f }, { 0x4e8df1b4u } },
+	{ { 0.815925777f, -0.247508377f, 0.522498548f }, { 0x10be09a1u } },
+	{ { 0.805121362f, -0.0792975351f, 0.587785244f }, { 0x52cf5d9bu } },
+	{ { 0.809017003f, 0.0f, 0.587785244f }, { 0x12c0019du } },
+	{ { 0.793471932f, -0.157831386f, 0.587785244f }, { 0x12cebd95u } },
+	{ { 0.756744385f, -0.0745328218f, 0.649448037f }, { 0x14cf6983u } },
+	{ { 0.760405958f, 0.0f, 0.649448037f }, { 0x54c00185u } },
+	{ { 0.745794952f, -0.14834784f, 0.649448037f }, { 0x54ced17du } },
+	{ { 0.774181008f, -0.234845236f, 0.587785244f }, { 0x52ce218cu } },
+	{ { 0.68875736f, -0.565248549f, 0.453990489f }, { 0x4e8b7d60u } },
+	{ { 0.768177748f, -0.513279974f, 0.382683426f }, { 0x4c4be989u } },
+	{ { 0.714168549f, -0.586102962f, 0.382683426f }, { 0x0c4b556du } },
+	{ { 0.790774584f, -0.528378665f, 0.309017003f }, { 0x09ebc994u } },
+	{ { 0.602907658f, -0.602907658f, 0.522498548f }, { 0x50bb3134u } },
+	{ { 0.630036771f, -0.630036771f, 0.453990489f }, { 0x0e8af942u } },
+	{ { 0.735176623f, -0.603343844f, 0.309017003f }, { 0x49eb3178u } },
+	{ { 0.808496058f, -0.540219784f, 0.233445361f }, { 0x477bb19du } },
+	{ { 0.65328151f, -0.65328151f, 0.382683426f }, { 0x4c4ac94eu } },
+	{ { 0.751652122f, -0.61686492f, 0.233445361f }, { 0x077b1580u } },
+	{ { 0.821232855f, -0.548730254f, 0.156434461f }, { 0x050ba1a4u } },
+	{ { 0.672498524f, -0.672498524f, 0.309017003f }, { 0x09eaa158u } },
+	{ { 0.763493419f, -0.626582861f, 0.156434461f }, { 0x450b0186u } },
+	{ { 0.828906476f, -0.553857625f, 0.0784590989f }, { 0x428b95a8u } },
+	{ { 0.68756938f, -0.68756938f, 0.233445361f }, { 0x477a855fu } },
+	{ { 0.770627499f, -0.632437646f, 0.0784590989f }, { 0x028af58au } },
+	{ { 0.831469595f, -0.555570245f, 2.18649922e-16f }, { 0x000b91a9u } },
+	{ { 0.698401153f, -0.698401153f, 0.156434461f }, { 0x050a6d65u } },
+	{ { 0.773010433f, -0.634393275f, 2.18649922e-16f }, { 0x400af18bu } },
+	{ { 0.828906476f, -0.553857625f, -0.0784590989f }, { 0x7d8b95a8u } },
+	{ { 0.704927027f, -0.704927027f, 0.0784590989f }, { 0x428a6168u } },
+	{ { 0.770627499f, -0.632437646f, -0.0784590989f }, { 0x3d8af58au } },
+	{ { 0.821232855f, -0.548730254f, -0.156434461f }, { 0x3b0ba1a4u } },
+	{ { 0.707106769f, -0.707106769f, 2.18649922e-16f }, { 0x000a5d69u } },
+	{ { 0.763493419f, -0.626582861f, -0.156434461f }, { 0x7b0b0186u } },
+	{ { 0.808496058f, -0.540219784f, -0.233445361f }, { 0x789bb19du } },
+	{ { 0.704927027f, -0.704927027f, -0.0784590989f }, { 0x7d8a6168u } },
+	{ { 0.751652122f, -0.61686492f, -0.233445361f }, { 0x389b1580u } },
+	{ { 0.790774584f, -0.528378665f, -0.309017003f }, { 0x362bc994u } },
+	{ { 0.698401153f, -0.698401153f, -0.156434461f }, { 0x3b0a6d65u } },
+	{ { 0.735176623f, -0.603343844f, -0.309017003f }, { 0x762b3178u } },
+	{ { 0.768177748f, -0.513279974f, -0.382683426f }, { 0x73cbe989u } },
+	{ { 0.68756938f, -0.68756938f, -0.233445361f }, { 0x789a855fu } },
+	{ { 0.714168549f, -0.586102962f, -0.382683426f }, { 0x33cb556du } },
+	{ { 0.740844846f, -0.495016694f, -0.453990489f }, { 0x318c0d7bu } },
+	{ { 0.672498524f, -0.672498524f, -0.309017003f }, { 0x362aa158u } },
+	{ { 0.68875736f, -0.565248549f, -0.453990489f }, { 0x718b7d60u } },
+	{ { 0.70894438f, -0.473701507f, -0.522498548f }, { 0x6f5c396au } },
+	{ { 0.65328151f, -0.65328151f, -0.382683426f }, { 0x73cac94eu } },
+	{ { 0.659099758f, -0.540909171f, -0.522498548f }, { 0x2f5bb151u } },
+	{ { 0.672673047f, -0.449465752f, -0.587785244f }, { 0x2d4c6958u } },
+	{ { 0.630036771f, -0.630036771f, -0.453990489f }, { 0x318af942u } },
+	{ { 0.625378609f, -0.513234973f, -0.587785244f }, { 0x6d4be940u } },
+	{ { 0.632254481f, -0.422458917f, -0.649448037f }, { 0x6b4ca143u } },
+	{ { 0.602907658f, -0.602907658f, -0.522498548f }, { 0x6f5b3134u } },
+	{ { 0.912505031f, -0.377971977f, -0.156434461f }, { 0x3b0cfdd2u } },
+	{ { 0.898352683f, -0.37210986f, -0.233445361f }, { 0x789d09cbu } },
+	{ { 0.879202604f, -0.469943583f, -0.0784590989f }, { 0x3d8c41c1u } },
+	{ { 0.871063352f, -0.46559307f, -0.156434461f }, { 0x7b0c49bdu } },
+	{ { 0.878661633f, -0.363953561f, -0.309017003f }, { 0x362d19c1u } },
+	{ { 0.85755372f, -0.458371997f, -0.233445361f }, { 0x389c59b6u } },
+	{ { 0.853553414f, -0.353553385f, -0.382683426f }, { 0x73cd2db4u } },
+	{ { 0.838756979f, -0.448324949f, -0.309017003f }, { 0x762c6dadu } },
+	{ { 0.823182702f, -0.340973437f, -0.453990489f }, { 0x318d49a5u } },
+	{ { 0.814788997f, -0.435513794f, -0.382683426f }, { 0x33cc85a0u } },
+	{ { 0.787736773f, -0.326291263f, -0.522498548f }, { 0x6f5d6593u } },
+	{ { 0.774181008f, -0.234845236f, -0.587785244f }, { 0x6d4e218cu } },
+	{ { 0.785797596f, -0.42001757f, -0.453990489f }, { 0x718ca592u } },
+	{ { 0.747434258f, -0.309597403f, -0.587785244f }, { 0x2d4d897eu } },
+	{ { 0.727663159f, -0.220734194f, -0.649448037f }, { 0x2b4e3d74u } },
+	{ { 0.75196147f, -0.401931792f, -0.522498548f }, { 0x2f5ccd80u } },
+	{ { 0.70252353f, -0.290994763f, -0.649448037f }, { 0x6b4dad67u } },
+	{ { 0.676658988f, -0.205262259f, -0.707106769f }, { 0x697e5d5au } },
+	{ { 0.713489294f, -0.381367981f, -0.587785244f }, { 0x6d4cf56du } },
+	{ { 0.65328151f, -0.270598054f, -0.707106769f }, { 0x297dd94eu } },
+	{ { 0.621483028f, -0.188524812f, -0.760405958f }, { 0x27be813eu } },
+	{ { 0.670618176f, -0.358452886f, -0.649448037f }, { 0x2b4d2557u } },
+	{ { 0.600011766f, -0.24853301f, -0.760405958f }, { 0x67be0533u } },
+	{ { 0.562475443f, -0.170625046f, -0.809017003f }, { 0x663ea51fu } },
+	{ { 0.623612523f, -0.33332783f, -0.707106769f }, { 0x697d593fu } },
+	{ { 0.543042779f, -0.224935681f, -0.809017003f }, { 0x263e3515u } },
+	{ { 0.49999994f, -0.151673332f, -0.852640152f }, { 0x24cec8ffu } },
+	{ { 0.572762072f, -0.306147695f, -0.760405958f }, { 0x27bd9125u } },
+	{ { 0.482725739f, -0.199951544f, -0.852640152f }, { 0x64ce68f7u } },
+	{ { 0.434441835f, -0.131786481f, -0.891006529f }, { 0x639ef4deu } },
+	{ { 0.518380284f, -0.277080059f, -0.809017003f }, { 0x663dc909u } },
+	{ { 0.419432521f, -0.17373465f, -0.891006529f }, { 0x239e9cd6u } },
+	{ { 0.366205215f, -0.111087136f, -0.923879504f }, { 0x228f1cbbu } },
+	{ { 0.460802585f, -0.246304125f, -0.852640152f }, { 0x24ce08ebu } },
+	{ { 0.353553385f, -0.146446615f, -0.923879504f }, { 0x628ed4b5u } },
+	{ { 0.295710832f, -0.0897028968f, -0.95105654f }, { 0x61af4897u } },
+	{ { 0.40038389f, -0.214009643f, -0.891006529f }, { 0x639e4ccdu } },
+	{ { 0.285494477f, -0.118255682f, -0.95105654f }, { 0x21af1092u } },
+	{ { 0.223393291f, -0.0677656084f, -0.972369909f }, { 0x20ff7472u } },
+	{ { 0.215675399f, -0.0893356726f, -0.972369909f }, { 0x60ff486eu } },
+	{ { 0.149698451f, -0.0454105288f, -0.987688363f }, { 0x607fa44cu } },
+	{ { 0.144526601f, -0.0598648787f, -0.987688363f }, { 0x207f844au } },
+	{ { 0.272528648f, -0.145669609f, -0.95105654f }, { 0x61aed88bu } },
+	{ { 0.460802585f, -0.246304125f, 0.852640152f }, { 0x1b4e08ebu } },
+	{ { 0.543042779f, -0.224935681f, 0.809017003f }, { 0x19de3515u } },
+	{ { 0.518380284f, -0.277080059f, 0.809017003f }, { 0x59ddc909u } },
+	{ { 0.434441686f, -0.290284663f, 0.852640152f }, { 0x5b4db0deu } },
+	{ { 0.621483028f, -0.188524812f, 0.760405958f }, { 0x185e813eu } },
+	{ { 0.600011766f, -0.24853301f, 0.760405958f }, { 0x585e0533u } },
+	{ { 0.676658988f, -0.205262259f, 0.707106769f }, { 0x569e5d5au } },
+	{ { 0.488725573f, -0.326555997f, 0.809017003f }, { 0x19dd64fau } },
+	{ { 0.65328151f, -0.270598054f, 0.707106769f }, { 0x169dd94eu } },
+	{ { 0.727663159f, -0.220734194f, 0.649448037f }, { 0x14ce3d74u } },
+	{ { 0.572762072f, -0.306147695f, 0.760405958f }, { 0x185d9125u } },
+	{ { 0.70252353f, -0.290994763f, 0.649448037f }, { 0x54cdad67u } },
+	{ { 0.623612523f, -0.33332783f, 0.707106769f }, { 0x569d593fu } },
+	{ { 0.539996326f, -0.360814005f, 0.760405958f }, { 0x585d2114u } },
+	{ { 0.747434258f, -0.309597403f, 0.587785244f }, { 0x12cd897eu } },
+	{ { 0.670618176f, -0.358452886f, 0.649448037f }, { 0x14cd2557u } },
+	{ { 0.587937772f, -0.392847478f, 0.707106769f }, { 0x169cdd2cu } },
+	{ { 0.787736773f, -0.326291263f, 0.522498548f }, { 0x50bd6593u } },
+	{ { 0.713489294f, -0.381367981f, 0.587785244f }, { 0x52ccf56du } },
+	{ { 0.632254481f, -0.422458917f, 0.649448037f }, { 0x54cca143u } },
+	{ { 0.823182702f, -0.340973437f, 0.453990489f }, { 0x0e8d49a5u } },
+	{ { 0.75196147f, -0.401931792f, 0.522498548f }, { 0x10bccd80u } },
+	{ { 0.672673047f, -0.449465752f, 0.587785244f }, { 0x12cc6958u } },
+	{ { 0.853553414f, -0.353553385f, 0.382683426f }, { 0x4c4d2db4u } },
+	{ { 0.785797596f, -0.42001757f, 0.453990489f }, { 0x4e8ca592u } },
+	{ { 0.70894438f, -0.473701507f, 0.522498548f }, { 0x50bc396au } },
+	{ { 0.878661633f, -0.363953561f, 0.309017003f }, { 0x09ed19c1u } },
+	{ { 0.814788997f, -0.435513794f, 0.382683426f }, { 0x0c4c85a0u } },
+	{ { 0.740844846f, -0.495016694f, 0.453990489f }, { 0x0e8c0d7bu } },
+	{ { 0.898352683f, -0.37210986f, 0.233445361f }, { 0x477d09cbu } },
+	{ { 0.838756979f, -0.448324949f, 0.309017003f }, { 0x49ec6dadu } },
+	{ { 0.912505031f, -0.377971977f, 0.156434461f }, { 0x050cfdd2u } },
+	{ { 0.85755372f, -0.458371997f, 0.233445361f }, { 0x077c59b6u } },
+	{ { 0.921031535f, -0.381503761f, 0.0784590989f }, { 0x428cf5d7u } },
+	{ { 0.871063352f, -0.46559307f, 0.156434461f }, { 0x450c49bdu } },
+	{ { 0.923879504f, -0.382683426f, 2.18649922e-16f }, { 0x000cf1d8u } },
+	{ { 0.879202604f, -0.469943583f, 0.0784590989f }, { 0x028c41c1u } },
+	{ { 0.921031535f, -0.381503761f, -0.0784590989f }, { 0x7d8cf5d7u } },
+	{ { 0.881921291f, -0.471396744f, 2.18649922e-16f }, { 0x400c3dc3u } },
+	{ { 0.0f, -0.95105654f, -0.309017003f }, { 0x36286800u } },
+	{ { 0.093219839f, -0.946476936f, -0.309017003f }, { 0x76287030u } },
+	{ { 0.0953089222f, -0.967687666f, -0.233445361f }, { 0x38984831u } },
+	{ { 0.0f, -0.972369909f, -0.233445361f }, { 0x78983c00u } },
+	{ { 0.0968103856f, -0.982932329f, -0.156434461f }, { 0x7b082831u } },
+	{ { 0.0f, -0.987688363f, -0.156434461f }, { 0x3b081c00u } },
+	{ { 0.0977149829f, -0.992116928f, -0.0784590989f }, { 0x3d881432u } },
+	{ { 0.0f, -0.996917307f, -0.0784590989f }, { 0x7d880c00u } },
+	{ { 0.0980171412f, -0.99518472f, 2.18649922e-16f }, { 0x40080c32u } },
+	{ { 0.0f, -1.0f, 2.18649922e-16f }, { 0x00080400u } },
+	{ { 0.0977149829f, -0.992116928f, 0.0784590989f }, { 0x02881432u } },
+	{ { 0.0f, -0.996917307f, 0.0784590989f }, { 0x42880c00u } },
+	{ { 0.0968103856f, -0.982932329f, 0.156434461f }, { 0x45082831u } },
+	{ { 0.0f, -0.987688363f, 0.156434461f }, { 0x05081c00u } },
+	{ { 0.0953089222f, -0.967687666f, 0.233445361f }, { 0x07784831u } },
+	{ { 0.0f, -0.972369909f, 0.233445361f }, { 0x47783c00u } },
+	{ { 0.093219839f, -0.946476936f, 0.309017003f }, { 0x49e87030u } },
+	{ { 0.0f, -0.95105654f, 0.309017003f }, { 0x09e86800u } },
+	{ { 0.090556033f, -0.919430792f, 0.382683426f }, { 0x0c48a82eu } },
+	{ { 0.0f, -0.923879504f, 0.382683426f }, { 0x4c48a000u } },
+	{ { -0.090556033f, -0.919430792f, 0.382683426f }, { 0x0c48abd2u } },
+	{ { 0.0873339102f, -0.886716068f, 0.453990489f }, { 0x4e88ec2du } },
+	{ { 0.0f, -0.891006529f, 0.453990489f }, { 0x0e88e400u } },
+	{ { -0.0873339102f, -0.886716068f, 0.453990489f }, { 0x4e88efd3u } },
+	{ { -0.166341841f, -0.836256921f, 0.522498548f }, { 0x50b957abu } },
+	{ { 0.0677656084f, -0.223393291f, -0.972369909f }, { 0x20fe3823u } },
+	{ { 0.0598648787f, -0.144526601f, -0.987688363f }, { 0x207ed81fu } },
+	{ { 0.0454105288f, -0.149698451f, -0.987688363f }, { 0x607ed017u } },
+	{ { 0.045542933f, -0.228959784f, -0.972369909f }, { 0x60fe2c17u } },
+	{ { 0.0369853601f, -0.0691947415f, -0.996917307f }, { 0x203f7413u } },
+	{ { 0.0435895398f, -0.0652363524f, -0.996917307f }, { 0x603f7c16u } },
+	{ { 1.2147539e-16f, -1.81800759e-16f, -1.0f }, { 0x20100000u } },
+	{ { 1.38710036e-16f, -1.69018675e-16f, -1.0f }, { 0x60100000u } },
+	{ { 0.0737426952f, -0.137962878f, -0.987688363f }, { 0x607ee826u } },
+	{ { 0.0497739241f, -0.0606497005f, -0.996917307f }, { 0x203f8419u } },
+	{ { 1.54608844e-16f, -1.54608844e-16f, -1.0f }, { 0x20100000u } },
+	{ { 0.0869103298f, -0.130070508f, -0.987688363f }, { 0x207ef82cu } },
+	{ { 0.0893356726f, -0.215675399f, -0.972369909f }, { 0x60fe482eu } },
+	{ { 0.110045381f, -0.205880433f, -0.972369909f }, { 0x20fe5c38u } },
+	{ { 0.0554789603f, -0.0554789603f, -0.996917307f }, { 0x603f901cu } },
+	{ { 1.69018675e-16f, -1.38710036e-16f, -1.0f }, { 0x60100000u } },
+	{ { 0.0992409736f, -0.120925479f, -0.987688363f }, { 0x607f0833u } },
+	{ { 0.0606497005f, -0.0497739241f, -0.996917307f }, { 0x203f9c1fu } },
+	{ { 1.81800759e-16f, -1.2147539e-16f, -1.0f }, { 0x20100000u } },
+	{ { 0.110615872f, -0.110615872f, -0.987688363f }, { 0x207f1c39u } },
+	{ { 0.129695296f, -0.194102719f, -0.972369909f }, { 0x60fe7442u } },
+	{ { 0.148096174f, -0.1804557f, -0.972369909f }, { 0x20fe904cu } },
+	{ { 0.0652363524f, -0.0435895398f, -0.996917307f }, { 0x603fa821u } },
+	{ { 1.92832014e-16f, -1.0307086e-16f, -1.0f }, { 0x60100000u } },
+	{ { 0.120925479f, -0.0992409736f, -0.987688363f }, { 0x607f343eu } },
+	{ { 0.0691947415f, -0.0369853601f, -0.996917307f }, { 0x203fb423u } },
+	{ { 2.02006188e-16f, -8.36736997e-17f, -1.0f }, { 0x20100000u } },
+	{ { 0.130070508f, -0.0869103298f, -0.987688363f }, { 0x207f5042u } },
+	{ { 0.165070802f, -0.165070802f, -0.972369909f }, { 0x60feb054u } },
+	{ { 0.0724867508f, -0.030024996f, -0.996917307f }, { 0x603fc425u } },
+	{ { 2.09234926e-16f, -6.34707198e-17f, -1.0f }, { 0x60100000u } },
+	{ { 0.137962878f, -0.0737426952f, -0.987688363f }, { 0x607f6846u } },
+	{ { 0.0750806704f, -0.0227754731f, -0.996917307f }, { 0x203fd026u } },
+	{ { 2.14448625e-16f, -4.26564833e-17f, -1.0f }, { 0x20100000u } },
+	{ { 0.0769515261f, -0.0153066106f, -0.996917307f }, { 0x603fe027u } },
+	{ { 2.1759706e-16f, -2.14314407e-17f, -1.0f }, { 0x60100000u } },
+	{ { 0.0780812949f, -0.00769033609f, -0.996917307f }, { 0x203ff028u } },
+	{ { 2.18649922e-16f, 0.0f, -1.0f }, { 0x20100000u } },
+	{ { 0.0784590989f, 0.0f, -0.996917307f }, { 0x60300028u } },
+	{ { 0.153428614f, -0.0305188503f, -0.987688363f }, { 0x207fc04eu } },
+	{ { 0.155681193f, -0.0153332585f, -0.987688363f }, { 0x607fe050u } },
+	{ { 0.156434461f, 0.0f, -0.987688363f }, { 0x20700050u } },
+	{ { 0.232321262f, -0.0228816476f, -0.972369909f }, { 0x20ffd077u } },
+	{ { 0.233445361f, 0.0f, -0.972369909f }, { 0x60f00077u } },
+	{ { 0.228959784f, -0.045542933f, -0.972369909f }, { 0x60ffa475u } },
+	{ { 0.307529002f, -0.0302889626f, -0.95105654f }, { 0x61afc49du } },
+	{ { 0.309017003f, 0.0f, -0.95105654f }, { 0x21a0009eu } },
+	{ { 0.303079307f, -0.0602862239f, -0.95105654f }, { 0x21af849bu } },
+	{ { 0.380840719f, -0.0375095345f, -0.923879504f }, { 0x228fb4c3u } },
+	{ { 0.382683426f, 0.0f, -0.923879504f }, { 0x628000c4u } },
+	{ { 0.375330269f, -0.0746578351f, -0.923879504f }, { 0x628f68c0u } },
+	{ { 0.451804399f, -0.0444988497f, -0.891006529f }, { 0x639fa4e7u } },
+	{ { 0.453990489f, 0.0f, -0.891006529f }, { 0x239000e8u } },
+	{ { 0.4452672f, -0.0885691494f, -0.891006529f }, { 0x239f4ce4u } },
+	{ { 0.519982576f, -0.0512138158f, -0.852640152f }, { 0x24cf990au } },
+	{ { 0.522498548f, 0.0f, -0.852640152f }, { 0x64c0010bu } },
+	{ { 0.51245892f, -0.101934411f, -0.852640152f }, { 0x64cf3106u } },
+	{ { 0.584954917f, -0.0576130301f, -0.809017003f }, { 0x663f8d2bu } },
+	{ { 0.587785244f, 0.0f, -0.809017003f }, { 0x2630012cu } },
+	{ { 0.576491117f, -0.114671215f, -0.809017003f }, { 0x263f1527u } },
+	{ { 0.64632076f, -0.0636570379f, -0.760405958f }, { 0x27bf7d4au } },
+	{ { 0.649448037f, 0.0f, -0.760405958f }, { 0x67b0014cu } },
+	{ { 0.63696909f, -0.126701027f, -0.760405958f }, { 0x67befd45u } },
+	{ { 0.703701854f, -0.0693085864f, -0.707106769f }, { 0x697f7568u } },
+	{ { 0.707106769f, 0.0f, -0.707106769f }, { 0x29700169u } },
+	{ { 0.69351995f, -0.13794969f, -0.707106769f }, { 0x297ee962u } },
+	{ { 0.756744385f, -0.0745328218f, -0.649448037f }, { 0x2b4f6983u } },
+	{ { 0.760405958f, 0.0f, -0.649448037f }, { 0x6b400185u } },
+	{ { 0.745794952f, -0.14834784f, -0.649448037f }, { 0x6b4ed17du } },
+	{ { 0.805121362f, -0.0792975351f, -0.587785244f }, { 0x6d4f5d9bu } },
+	{ { 0.809017003f, 0.0f, -0.587785244f }, { 0x2d40019du } },
+	{ { 0.793471932f, -0.157831386f, -0.587785244f }, { 0x2d4ebd95u } },
+	{ { -0.49999994f, -0.151673332f, 0.852640152f }, { 0x1b4ecb01u } },
+	{ { -0.482725739f, -0.199951544f, 0.852640152f }, { 0x5b4e6b09u } },
+	{ { -0.419432521f, -0.17373465f, 0.891006529f }, { 0x1c7e9f2au } },
+	{ { -0.460802585f, -0.246304125f, 0.852640152f }, { 0x1b4e0b15u } },
+	{ { -0.353553385f, -0.146446615f, 0.923879504f }, { 0x5d8ed74bu } },
+	{ { -0.40038389f, -0.214009643f, 0.891006529f }, { 0x5c7e4f33u } },
+	{ { -0.337496668f, -0.180395722f, 0.923879504f }, { 0x1d8e9354u } },
+	{ { -0.377479315f, -0.252223611f, 0.891006529f }, { 0x1c7dff3fu } },
+	{ { -0.318189651f, -0.212607518f, 0.923879504f }, { 0x5d8e4f5du } },
+	{ { -0.434441686f, -0.290284663f, 0.852640152f }, { 0x5b4db322u } },
+	{ { -0.350939393f, -0.288008511f, 0.891006529f }, { 0x5c7db74du } },
+	{ { -0.295818299f, -0.242771804f, 0.923879504f }, { 0x1d8e1369u } },
+	{ { -0.403896838f, -0.331469566f, 0.852640152f }, { 0x1b4d5f32u } },
+	{ { -0.369462281f, -0.369462281f, 0.852640152f }, { 0x5b4d0f43u } },
+	{ { -0.321019769f, -0.321019769f, 0.891006529f }, { 0x1c7d735cu } },
+	{ { -0.270598054f, -0.270598054f, 0.923879504f }, { 0x5d8ddb76u } },
+	{ { -0.288008511f, -0.350939393f, 0.891006529f }, { 0x5c7d376du } },
+	{ { -0.242771804f, -0.295818299f, 0.923879504f }, { 0x1d8da784u } },
+	{ { -0.331469566f, -0.403896838f, 0.852640152f }, { 0x1b4ccb57u } },
+	{ { -0.252223611f, -0.377479315f, 0.891006529f }, { 0x1c7cff7fu } },
+	{ { -0.212607518f, -0.318189651f, 0.923879504f }, { 0x5d8d7793u } },
+	{ { -0.290284663f, -0.434441686f, 0.852640152f }, { 0x5b4c8b6cu } },
+	{ { -0.246304125f, -0.460802585f, 0.852640152f }, { 0x1b4c5782u } },
+	{ { -0.214009643f, -0.40038389f, 0.891006529f }, { 0x5c7ccf93u } },
+	{ { -0.180395722f, -0.337496668f, 0.923879504f }, { 0x1d8d53a4u } },
+	{ { -0.17373465f, -0.419432521f, 0.891006529f }, { 0x1c7caba7u } },
+	{ { -0.146446615f, -0.353553385f, 0.923879504f }, { 0x5d8d2fb5u } },
+	{ { -0.199951544f, -0.482725739f, 0.852640152f }, { 0x5b4c279au } },
+	{ { -0.131786481f, -0.434441835f, 0.891006529f }, { 0x5c7c8bbdu } },
+	{ { -0.111087136f, -0.366205215f, 0.923879504f }, { 0x1d8d17c7u } },
+	{ { -0.151673332f, -0.49999994f, 0.852640152f }, { 0x1b4c07b2u } },
+	{ { -0.101934411f, -0.51245892f, 0.852640152f }, { 0x5b4bebccu } },
+	{ { -0.0885691494f, -0.4452672f, 0.891006529f }, { 0x1c7c73d3u } },
+	{ { -0.0746578351f, -0.375330269f, 0.923879504f }, { 0x5d8d03dau } },
+	{ { -0.0444988497f, -0.451804399f, 0.891006529f }, { 0x5c7c67e9u } },
+	{ { -0.0375095345f, -0.380840719f, 0.923879504f }, { 0x1d8cf7edu } },
+	{ { -0.0512138158f, -0.519982576f, 0.852640152f }, { 0x1b4bdbe6u } },
+	{ { 0.0f, -0.453990489f, 0.891006529f }, { 0x1c7c6000u } },
+	{ { 0.0f, -0.382683426f, 0.923879504f }, { 0x5d8cf000u } },
+	{ { 0.0f, -0.522498548f, 0.852640152f }, { 0x5b4bd400u } },
+	{ { 0.0512138158f, -0.519982576f, 0.852640152f }, { 0x1b4bd81au } },
+	{ { 0.0444988497f, -0.451804399f, 0.891006529f }, { 0x5c7c6417u } },
+	{ { 0.0375095345f, -0.380840719f, 0.923879504f }, { 0x1d8cf413u } },
+	{ { 0.0885691494f, -0.4452672f, 0.891006529f }, { 0x1c7c702du } },
+	{ { 0.0746578351f, -0.375330269f, 0.923879504f }, { 0x5d8d0026u } },
+	{ { 0.101934411f, -0.51245892f, 0.852640152f }, { 0x5b4be834u } },
+	{ { 0.131786481f, -0.434441835f, 0.891006529f }, { 0x5c7c8843u } },
+	{ { 0.111087136f, -0.366205215f, 0.923879504f }, { 0x1d8d1439u } },
+	{ { 0.151673332f, -0.49999994f, 0.852640152f }, { 0x1b4c044eu } },
+	{ { 0.199951544f, -0.482725739f, 0.852640152f }, { 0x5b4c2466u } },
+	{ { 0.17373465f, -0.419432521f, 0.891006529f }, { 0x1c7ca859u } },
+	{ { 0.146446615f, -0.353553385f, 0.923879504f }, { 0x5d8d2c4bu } },
+	{ { 0.214009643f, -0.40038389f, 0.891006529f }, { 0x5c7ccc6du } },
+	{ { 0.180395722f, -0.337496668f, 0.923879504f }, { 0x1d8d505cu } },
+	{ { 0.246304125f, -0.460802585f, 0.852640152f }, { 0x1b4c547eu } },
+	{ { 0.252223611f, -0.377479315f, 0.891006529f }, { 0x1c7cfc81u } },
+	{ { 0.212607518f, -0.318189651f, 0.923879504f }, { 0x5d8d746du } },
+	{ { 0.290284663f, -0.434441686f, 0.852640152f }, { 0x5b4c8894u } },
+	{ { -0.151673332f, 0.49999994f, 0.852640152f }, { 0x1b43ffb2u } },
+	{ { -0.131786481f, 0.434441835f, 0.891006529f }, { 0x5c737bbdu } },
+	{ { -0.111087136f, 0.366205215f, 0.923879504f }, { 0x1d82efc7u } },
+	{ { -0.17373465f, 0.419432521f, 0.891006529f }, { 0x1c735ba7u } },
+	{ { -0.146446615f, 0.353553385f, 0.923879504f }, { 0x5d82d7b5u } },
+	{ { -0.199951544f, 0.482725739f, 0.852640152f }, { 0x5b43df9au } },
+	{ { -0.214009643f, 0.40038389f, 0.891006529f }, { 0x5c733793u } },
+	{ { -0.180395722f, 0.337496668f, 0.923879504f }, { 0x1d82b3a4u } },
+	{ { -0.246304125f, 0.460802585f, 0.852640152f }, { 0x1b43af82u } },
+	{ { -0.290284663f, 0.434441686f, 0.852640152f }, { 0x5b437b6cu } },
+	{ { -0.252223611f, 0.377479315f, 0.891006529f }, { 0x1c73077fu } },
+	{ { -0.212607518f, 0.318189651f, 0.923879504f }, { 0x5d828f93u } },
+	{ { -0.288008511f, 0.350939393f, 0.891006529f }, { 0x5c72cf6du } },
+	{ { -0.242771804f, 0.295818299f, 0.923879504f }, { 0x1d825f84u } },
+	{ { -0.331469566f, 0.403896838f, 0.852640152f }, { 0x1b433b57u } },
+	{ { -0.321019769f, 0.321019769f, 0.891006529f }, { 0x1c72935cu } },
+	{ { -0.270598054f, 0.270598054f, 0.923879504f }, { 0x5d822b76u } },
+	{ { -0.369462281f, 0.369462281f, 0.852640152f }, { 0x5b42f743u } },
+	{ { -0.403896838f, 0.331469566f, 0.852640152f }, { 0x1b42a732u } },
+	{ { -0.350939393f, 0.288008511f, 0.891006529f }, { 0x5c724f4du } },
+	{ { -0.295818299f, 0.242771804f, 0.923879504f }, { 0x1d81f369u } },
+	{ { -0.377479315f, 0.252223611f, 0.891006529f }, { 0x1c72073fu } },
+	{ { -0.318189651f, 0.212607518f, 0.923879504f }, { 0x5d81b75du } },
+	{ { -0.434441686f, 0.290284663f, 0.852640152f }, { 0x5b425322u } },
+	{ { -0.40038389f, 0.214009643f, 0.891006529f }, { 0x5c71b733u } },
+	{ { -0.337496668f, 0.180395722f, 0.923879504f }, { 0x1d817354u } },
+	{ { -0.460802585f, 0.246304125f, 0.852640152f }, { 0x1b41fb15u } },
+	{ { -0.482725739f, 0.199951544f, 0.852640152f }, { 0x5b419b09u } },
+	{ { -0.419432521f, 0.17373465f, 0.891006529f }, { 0x1c71672au } },
+	{ { -0.353553385f, 0.146446615f, 0.923879504f }, { 0x5d812f4bu } },
+	{ { -0.434441835f, 0.131786481f, 0.891006529f }, { 0x5c710f22u } },
+	{ { -0.366205215f, 0.111087136f, 0.923879504f }, { 0x1d80e745u } },
+	{ { -0.49999994f, 0.151673332f, 0.852640152f }, { 0x1b413b01u } },
+	{ { -0.4452672f, 0.0885691494f, 0.891006529f }, { 0x1c70b71cu } },
+	{ { -0.375330269f, 0.0746578351f, 0.923879504f }, { 0x5d809b40u } },
+	{ { -0.51245892f, 0.101934411f, 0.852640152f }, { 0x5b40d2fau } },
+	{ { -0.519982576f, 0.0512138158f, 0.852640152f }, { 0x1b406af6u } },
+	{ { -0.451804399f, 0.0444988497f, 0.891006529f }, { 0x5c705f19u } },
+	{ { -0.380840719f, 0.0375095345f, 0.923879504f }, { 0x1d804f3du } },
+	{ { -0.453990489f, 9.92649888e-17f, 0.891006529f }, { 0x1c700318u } },
+	{ { -0.382683426f, 8.36736997e-17f, 0.923879504f }, { 0x5d80033cu } },
+	{ { -0.522498548f, 1.1424427e-16f, 0.852640152f }, { 0x5b4002f5u } },
+	{ { -0.451804399f, -0.0444988497f, 0.891006529f }, { 0x5c7fa719u } },
+	{ { -0.380840719f, -0.0375095345f, 0.923879504f }, { 0x1d8fb73du } },
+	{ { -0.519982576f, -0.0512138158f, 0.852640152f }, { 0x1b4f9af6u } },
+	{ { -0.51245892f, -0.101934411f, 0.852640152f }, { 0x5b4f32fau } },
+	{ { -0.4452672f, -0.0885691494f, 0.891006529f }, { 0x1c7f4f1cu } },
+	{ { -0.375330269f, -0.0746578351f, 0.923879504f }, { 0x5d8f6b40u } },
+	{ { -0.434441835f, -0.131786481f, 0.891006529f }, { 0x5c7ef722u } },
+	{ { -0.366205215f, -0.111087136f, 0.923879504f }, { 0x1d8f1f45u } },
+	{ { 0.703701854f, -0.0693085864f, 0.707106769f }, { 0x569f7568u } },
+	{ { 0.707106769f, 0.0f, 0.707106769f }, { 0x16900169u } },
+	{ { 0.69351995f, -0.13794969f, 0.707106769f }, { 0x169ee962u } },
+	{ { 0.64632076f, -0.0636570379f, 0.760405958f }, { 0x185f7d4au } },
+	{ { 0.649448037f, 0.0f, 0.760405958f }, { 0x5850014cu } },
+	{ { 0.63696909f, -0.126701027f, 0.760405958f }, { 0x585efd45u } },
+	{ { 0.584954917f, -0.0576130301f, 0.809017003f }, { 0x59df8d2bu } },
+	{ { 0.587785244f, 0.0f, 0.809017003f }, { 0x19d0012cu } },
+	{ { 0.576491117f, -0.114671215f, 0.809017003f }, { 0x19df1527u } },
+	{ { 0.519982576f, -0.0512138158f, 0.852640152f }, { 0x1b4f990au } },
+	{ { 0.522498548f, 0.0f, 0.852640152f }, { 0x5b40010bu } },
+	{ { 0.51245892f, -0.101934411f, 0.852640152f }, { 0x5b4f3106u } },
+	{ { 0.562475443f, -0.170625046f, 0.809017003f }, { 0x59dea51fu } },
+	{ { 0.49999994f, -0.151673332f, 0.852640152f }, { 0x1b4ec8ffu } },
+	{ { 0.451804399f, -0.0444988497f, 0.891006529f }, { 0x5c7fa4e7u } },
+	{ { 0.453990489f, 0.0f, 0.891006529f }, { 0x1c7000e8u } },
+	{ { 0.4452672f, -0.0885691494f, 0.891006529f }, { 0x1c7f4ce4u } },
+	{ { 0.380840719f, -0.0375095345f, 0.923879504f }, { 0x1d8fb4c3u } },
+	{ { 0.382683426f, 0.0f, 0.923879504f }, { 0x5d8000c4u } },
+	{ { 0.375330269f, -0.0746578351f, 0.923879504f }, { 0x5d8f68c0u } },
+	{ { 0.434441835f, -0.131786481f, 0.891006529f }, { 0x5c7ef4deu } },
+	{ { 0.307529002f, -0.0302889626f, 0.95105654f }, { 0x5e6fc49du } },
+	{ { 0.309017003f, 0.0f, 0.95105654f }, { 0x1e60009eu } },
+	{ { 0.303079307f, -0.0602862239f, 0.95105654f }, { 0x1e6f849bu } },
+	{ { 0.232321262f, -0.0228816476f, 0.972369909f }, { 0x1f1fd077u } },
+	{ { 0.233445361f, 0.0f, 0.972369909f }, { 0x5f100077u } },
+	{ { 0.228959784f, -0.045542933f, 0.972369909f }, { 0x5f1fa475u } },
+	{ { 0.223393291f, -0.0677656084f, 0.972369909f }, { 0x1f1f7472u } },
+	{ { 0.155681193f, -0.0153332585f, 0.987688363f }, { 0x5f9fe050u } },
+	{ { 0.156434461f, 0.0f, 0.987688363f }, { 0x1f900050u } },
+	{ { 0.153428614f, -0.0305188503f, 0.987688363f }, { 0x1f9fc04eu } },
+	{ { 0.0780812949f, -0.00769033609f, 0.996917307f }, { 0x1fdff028u } },
+	{ { 0.0784590989f, 0.0f, 0.996917307f }, { 0x5fd00028u } },
+	{ { 0.0f, -0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { 0.0f, 0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { 0.0f, -0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { 0.0769515261f, -0.0153066106f, 0.996917307f }, { 0x5fdfe027u } },
+	{ { 0.0f, -0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { 0.0750806704f, -0.0227754731f, 0.996917307f }, { 0x1fdfd026u } },
+	{ { 0.0f, -0.0f, 1.0f }, { 0x1ff00000u } },
+	{ { 0.149698451f, -0.0454105288f, 0.987688363f }, { 0x5f9fa44cu } },
+	{ { 0.0724867508f, -0.030024996f, 0.996917307f }, { 0x5fdfc425u } },
+	{ { 0.0f, -0.0f, 1.0f }, { 0x5ff00000u } },
+	{ { 0.144526601f, -0.0598648787f, 0.987688363f }, { 0x1f9f844au } },
+	{ { 0.0691947415f, -0.0369853601f, 0.996917307f }, { 0x1fdfb423u } },
+	{ { -0.99518472f, 0.0980171412f, 2.18649922e-16f }, { 0x4000ca03u } },
+	{ { -1.0f, 2.18649922e-16f, 2.18649922e-16f }, { 0x00000201u } },
+	{ { -0.992116928f, 0.0977149829f, 0.0784590989f }, { 0x0280ca05u } },
+	{ { -0.930499971f, 0.282264084f, 0.233445361f }, { 0x07724225u } },
+	{ { -0.953686118f, 0.189699963f, 0.233445361f }, { 0x47718619u } },
+	{ { -0.968710184f, 0.192688435f, 0.156434461f }, { 0x05018a11u } },
+	{ { -0.99518472f, -0.0980171412f, 2.18649922e-16f }, { 0x400f3a03u } },
+	{ { -0.967687666f, 0.0953089222f, 0.233445361f }, { 0x0770c612u } },
+	{ { -0.982932329f, 0.0968103856f, 0.156434461f }, { 0x4500c60au } },
+	{ { -0.972369909f, 2.12608605e-16f, 0.233445361f }, { 0x4770020fu } },
+	{ { -0.987688363f, 2.15957972e-16f, 0.156434461f }, { 0x05000207u } },
+	{ { -0.996917307f, 2.17975895e-16f, 0.0784590989f }, { 0x42800203u } },
+	{ { -0.992116928f, -0.0977149829f, 0.0784590989f }, { 0x028f3a05u } },
+	{ { -0.982932329f, -0.0968103856f, 0.156434461f }, { 0x450f3e0au } },
+	{ { -0.967687666f, -0.0953089222f, 0.233445361f }, { 0x077f3e12u } },
+	{ { -0.980785251f, -0.195090324f, 2.18649922e-16f }, { 0x000e720bu } },
+	{ { -0.977761865f, -0.194488928f, 0.0784590989f }, { 0x428e760cu } },
+	{ { -0.956940353f, -0.290284663f, 2.18649922e-16f }, { 0x400db217u } },
+	{ { -0.968710184f, -0.192688435f, 0.156434461f }, { 0x050e7a11u } },
+	{ { -0.9539904f, -0.289389819f, 0.0784590989f }, { 0x028db219u } },
+	{ { -0.923879504f, -0.382683426f, 2.18649922e-16f }, { 0x000cf228u } },
+	{ { -0.953686118f, -0.189699963f, 0.233445361f }, { 0x477e7e19u } },
+	{ { -0.881921291f, -0.471396744f, 2.18649922e-16f }, { 0x400c3e3du } },
+	{ { -0.930499971f, -0.282264084f, 0.233445361f }, { 0x077dc225u } },
+	{ { -0.945158839f, -0.286710799f, 0.156434461f }, { 0x450db61du } },
+	{ { -0.898352683f, -0.37210986f, 0.233445361f }, { 0x477d0a35u } },
+	{ { -0.912505031f, -0.377971977f, 0.156434461f }, { 0x050cfe2eu } },
+	{ { -0.921031535f, -0.381503761f, 0.0784590989f }, { 0x428cf629u } },
+	{ { -0.751652122f, 0.61686492f, 0.233445361f }, { 0x0774ee80u } },
+	{ { -0.831469595f, 0.555570245f, 2.18649922e-16f }, { 0x00047257u } },
+	{ { -0.828906476f, 0.553857625f, 0.0784590989f }, { 0x42846e58u } },
+	{ { -0.881921291f, 0.471396744f, 2.18649922e-16f }, { 0x4003c63du } },
+	{ { -0.821232855f, 0.548730254f, 0.156434461f }, { 0x0504625cu } },
+	{ { -0.879202604f, 0.469943583f, 0.0784590989f }, { 0x0283c23fu } },
+	{ { -0.923879504f, 0.382683426f, 2.18649922e-16f }, { 0x00031228u } },
+	{ { -0.808496058f, 0.540219784f, 0.233445361f }, { 0x47745263u } },
+	{ { -0.956940353f, 0.290284663f, 2.18649922e-16f }, { 0x40025217u } },
+	{ { -0.85755372f, 0.458371997f, 0.233445361f }, { 0x0773aa4au } },
+	{ { -0.871063352f, 0.46559307f, 0.156434461f }, { 0x4503ba43u } },
+	{ { -0.898352683f, 0.37210986f, 0.233445361f }, { 0x4772fa35u } },
+	{ { -0.912505031f, 0.377971977f, 0.156434461f }, { 0x0503062eu } },
+	{ { -0.921031535f, 0.381503761f, 0.0784590989f }, { 0x42830e29u } },
+	{ { -0.9539904f, 0.289389819f, 0.0784590989f }, { 0x02825219u } },
+	{ { -0.945158839f, 0.286710799f, 0.156434461f }, { 0x45024e1du } },
+	{ { -0.980785251f, 0.195090324f, 2.18649922e-16f }, { 0x0001920bu } },
+	{ { -0.977761865f, 0.194488928f, 0.0784590989f }, { 0x42818e0cu } },
+	{ { 0.326555997f, -0.488725573f, 0.809017003f }, { 0x19dc18a7u } },
+	{ { 0.331469566f, -0.403896838f, 0.852640152f }, { 0x1b4cc8a9u } },
+	{ { 0.288008511f, -0.350939393f, 0.891006529f }, { 0x5c7d3493u } },
+	{ { 0.242771804f, -0.295818299f, 0.923879504f }, { 0x1d8da47cu } },
+	{ { 0.372887015f, -0.454364151f, 0.809017003f }, { 0x59dc60bfu } },
+	{ { 0.321019769f, -0.321019769f, 0.891006529f }, { 0x1c7d70a4u } },
+	{ { 0.270598054f, -0.270598054f, 0.923879504f }, { 0x5d8dd88au } },
+	{ { 0.350939393f, -0.288008511f, 0.891006529f }, { 0x5c7db4b3u } },
+	{ { 0.369462281f, -0.369462281f, 0.852640152f }, { 0x5b4d0cbdu } },
+	{ { 0.403896838f, -0.331469566f, 0.852640152f }, { 0x1b4d5cceu } },
+	{ { 0.454364151f, -0.372887015f, 0.809017003f }, { 0x59dd04e8u } },
+	{ { 0.415626943f, -0.415626943f, 0.809017003f }, { 0x19dcb0d4u } },
+	{ { 0.502030134f, -0.412005484f, 0.760405958f }, { 0x185cb501u } },
+	{ { 0.459229112f, -0.459229112f, 0.760405958f }, { 0x585c54ebu } },
+	{ { 0.546600938f, -0.448583782f, 0.707106769f }, { 0x569c6d17u } },
+	{ { 0.412005484f, -0.502030134f, 0.760405958f }, { 0x185bfcd3u } },
+	{ { 0.5f, -0.5f, 0.707106769f }, { 0x169c0100u } },
+	{ { 0.587801754f, -0.482396424f, 0.649448037f }, { 0x14cc252cu } },
+	{ { 0.537688196f, -0.537688196f, 0.649448037f }, { 0x54cbb513u } },
+	{ { 0.625378609f, -0.513234973f, 0.587785244f }, { 0x52cbe940u } },
+	{ { 0.659099758f, -0.540909171f, 0.522498548f }, { 0x10bbb151u } },
+	{ { 0.572061419f, -0.572061419f, 0.587785244f }, { 0x12cb7124u } },
+	{ { -0.337496668f, -0.180395722f, -0.923879504f }, { 0x228e9354u } },
+	{ { -0.353553385f, -0.146446615f, -0.923879504f }, { 0x628ed74bu } },
+	{ { -0.256938249f, -0.171680644f, -0.95105654f }, { 0x21aea37du } },
+	{ { -0.238873363f, -0.196038306f, -0.95105654f }, { 0x61ae7386u } },
+	{ { -0.1804557f, -0.148096174f, -0.972369909f }, { 0x20fed3a4u } },
+	{ { -0.165070802f, -0.165070802f, -0.972369909f }, { 0x60feb3acu } },
+	{ { -0.318189651f, -0.212607518f, -0.923879504f }, { 0x628e4f5du } },
+	{ { -0.218508005f, -0.218508005f, -0.95105654f }, { 0x21ae4390u } },
+	{ { -0.148096174f, -0.1804557f, -0.972369909f }, { 0x20fe93b4u } },
+	{ { -0.295818299f, -0.242771804f, -0.923879504f }, { 0x228e1369u } },
+	{ { -0.196038306f, -0.238873363f, -0.95105654f }, { 0x61ae1b9cu } },
+	{ { -0.129695296f, -0.194102719f, -0.972369909f }, { 0x60fe77beu } },
+	{ { -0.270598054f, -0.270598054f, -0.923879504f }, { 0x628ddb76u } },
+	{ { -0.171680644f, -0.256938249f, -0.95105654f }, { 0x21adf7a8u } },
+	{ { -0.110045381f, -0.205880433f, -0.972369909f }, { 0x20fe5fc8u } },
+	{ { -0.242771804f, -0.295818299f, -0.923879504f }, { 0x228da784u } },
+	{ { -0.145669609f, -0.272528648f, -0.95105654f }, { 0x61add7b6u } },
+	{ { -0.0893356726f, -0.215675399f, -0.972369909f }, { 0x60fe4bd2u } },
+	{ { -0.212607518f, -0.318189651f, -0.923879504f }, { 0x628d7793u } },
+	{ { -0.118255682f, -0.285494477f, -0.95105654f }, { 0x21adbbc4u } },
+	{ { -0.0677656084f, -0.223393291f, -0.972369909f }, { 0x20fe3bddu } },
+	{ { -0.180395722f, -0.337496668f, -0.923879504f }, { 0x228d53a4u } },
+	{ { -0.0897028968f, -0.295710832f, -0.95105654f }, { 0x61ada7d2u } },
+	{ { -0.045542933f, -0.228959784f, -0.972369909f }, { 0x60fe2fe9u } },
+	{ { -0.146446615f, -0.353553385f, -0.923879504f }, { 0x628d2fb5u } },
+	{ { -0.0602862239f, -0.303079307f, -0.95105654f }, { 0x21ad97e1u } },
+	{ { -0.0228816476f, -0.232321262f, -0.972369909f }, { 0x20fe27f4u } },
+	{ { -0.111087136f, -0.366205215f, -0.923879504f }, { 0x228d17c7u } },
+	{ { -0.0302889626f, -0.307529002f, -0.95105654f }, { 0x61ad8ff1u } },
+	{ { 0.0f, -0.233445361f, -0.972369909f }, { 0x60fe2400u } },
+	{ { -0.0746578351f, -0.375330269f, -0.923879504f }, { 0x628d03dau } },
+	{ { 0.0f, -0.309017003f, -0.95105654f }, { 0x21ad8800u } },
+	{ { 0.0228816476f, -0.232321262f, -0.972369909f }, { 0x20fe240cu } },
+	{ { -0.0375095345f, -0.380840719f, -0.923879504f }, { 0x228cf7edu } },
+	{ { 0.0302889626f, -0.307529002f, -0.95105654f }, { 0x61ad8c0fu } },
+	{ { 0.0f, -0.382683426f, -0.923879504f }, { 0x628cf000u } },
+	{ { 0.0602862239f, -0.303079307f, -0.95105654f }, { 0x21ad941fu } },
+	{ { 0.0375095345f, -0.380840719f, -0.923879504f }, { 0x228cf413u } },
+	{ { 0.0897028968f, -0.295710832f, -0.95105654f }, { 0x61ada42eu } },
+	{ { 0.0746578351f, -0.375330269f, -0.923879504f }, { 0x628d0026u } },
+	{ { 0.118255682f, -0.285494477f, -0.95105654f }, { 0x21adb83cu } },
+	{ { 0.111087136f, -0.366205215f, -0.923879504f }, { 0x228d1439u } },
+	{ { 0.145669609f, -0.272528648f, -0.95105654f }, { 0x61add44au } },
+	{ { 0.146446615f, -0.353553385f, -0.923879504f }, { 0x628d2c4bu } },
+	{ { 0.171680644f, -0.256938249f, -0.95105654f }, { 0x21adf458u } },
+	{ { 0.180395722f, -0.337496668f, -0.923879504f }, { 0x228d505cu } },
+	{ { 0.196038306f, -0.238873363f, -0.95105654f }, { 0x61ae1864u } },
+	{ { -0.879202604f, -0.469943583f, 0.0784590989f }, { 0x028c423fu } },
+	{ { -0.871063352f, -0.46559307f, 0.156434461f }, { 0x450c4a43u } },
+	{ { -0.85755372f, -0.458371997f, 0.233445361f }, { 0x077c5a4au } },
+	{ { -0.831469595f, -0.555570245f, 2.18649922e-16f }, { 0x000b9257u } },
+	{ { -0.828906476f, -0.553857625f, 0.0784590989f }, { 0x428b9658u } },
+	{ { -0.773010433f, -0.634393275f, 2.18649922e-16f }, { 0x400af275u } },
+	{ { -0.821232855f, -0.548730254f, 0.156434461f }, { 0x050ba25cu } },
+	{ { -0.770627499f, -0.632437646f, 0.0784590989f }, { 0x028af676u } },
+	{ { -0.707106769f, -0.707106769f, 2.18649922e-16f }, { 0x000a5e97u } },
+	{ { -0.808496058f, -0.540219784f, 0.233445361f }, { 0x477bb263u } },
+	{ { -0.634393275f, -0.773010433f, 2.18649922e-16f }, { 0x4009d6bcu } },
+	{ { -0.751652122f, -0.61686492f, 0.233445361f }, { 0x077b1680u } },
+	{ { -0.763493419f, -0.626582861f, 0.156434461f }, { 0x450b027au } },
+	{ { -0.68756938f, -0.68756938f, 0.233445361f }, { 0x477a86a1u } },
+	{ { -0.698401153f, -0.698401153f, 0.156434461f }, { 0x050a6e9bu } },
+	{ { -0.704927027f, -0.704927027f, 0.0784590989f }, { 0x428a6298u } },
+	{ { -0.626582861f, -0.763493419f, 0.156434461f }, { 0x4509eac0u } },
+	{ { -0.632437646f, -0.770627499f, 0.0784590989f }, { 0x0289dabdu } },
+	{ { -0.555570245f, -0.831469595f, 2.18649922e-16f }, { 0x00095ee4u } },
+	{ { -0.0602862239f, -0.303079307f, 0.95105654f }, { 0x1e6d97e1u } },
+	{ { -0.0302889626f, -0.307529002f, 0.95105654f }, { 0x5e6d8ff1u } },
+	{ { -0.0228816476f, -0.232321262f, 0.972369909f }, { 0x1f1e27f4u } },
+	{ { 0.0f, -0.309017003f, 0.95105654f }, { 0x1e6d8800u } },
+	{ { 0.0f, -0.233445361f, 0.972369909f }, { 0x5f1e2400u } },
+	{ { 0.0228816476f, -0.232321262f, 0.972369909f }, { 0x1f1e240cu } },
+	{ { 0.0302889626f, -0.307529002f, 0.95105654f }, { 0x5e6d8c0fu } },
+	{ { 0.045542933f, -0.228959784f, 0.972369909f }, { 0x5f1e2c17u } },
+	{ { 0.0602862239f, -0.303079307f, 0.95105654f }, { 0x1e6d941fu } },
+	{ { 0.0897028968f, -0.295710832f, 0.95105654f }, { 0x5e6da42eu } },
+	{ { 0.0677656084f, -0.223393291f, 0.972369909f }, { 0x1f1e3823u } },
+	{ { 0.0893356726f, -0.215675399f, 0.972369909f }, { 0x5f1e482eu } },
+	{ { 0.118255682f, -0.285494477f, 0.95105654f }, { 0x1e6db83cu } },
+	{ { 0.110045381f, -0.205880433f, 0.972369909f }, { 0x1f1e5c38u } },
+	{ { 0.145669609f, -0.272528648f, 0.95105654f }, { 0x5e6dd44au } },
+	{ { 0.171680644f, -0.256938249f, 0.95105654f }, { 0x1e6df458u } },
+	{ { 0.129695296f, -0.194102719f, 0.972369909f }, { 0x5f1e7442u } },
+	{ { 0.148096174f, -0.1804557f, 0.972369909f }, { 0x1f1e904cu } },
+	{ { 0.196038306f, -0.238873363f, 0.95105654f }, { 0x5e6e1864u } },
+	{ { 0.165070802f, -0.165070802f, 0.972369909f }, { 0x5f1eb054u } },
+	{ { 0.218508005f, -0.218508005f, 0.95105654f }, { 0x1e6e4070u } },
+	{ { 0.238873363f, -0.196038306f, 0.95105654f }, { 0x5e6e707au } },
+	{ { 0.295818299f, -0.242771804f, 0.923879504f }, { 0x1d8e1097u } },
+	{ { 0.256938249f, -0.171680644f, 0.95105654f }, { 0x1e6ea083u } },
+	{ { 0.318189651f, -0.212607518f, 0.923879504f }, { 0x5d8e4ca3u } },
+	{ { 0.272528648f, -0.145669609f, 0.95105654f }, { 0x5e6ed88bu } },
+	{ { 0.337496668f, -0.180395722f, 0.923879504f }, { 0x1d8e90acu } },
+	{ { 0.353553385f, -0.146446615f, 0.923879504f }, { 0x5d8ed4b5u } },
+	{ { 0.419432521f, -0.17373465f, 0.891006529f }, { 0x1c7e9cd6u } },
+	{ { 0.40038389f, -0.214009643f, 0.891006529f }, { 0x5c7e4ccdu } },
+	{ { 0.482725739f, -0.199951544f, 0.852640152f }, { 0x5b4e68f7u } },
+	{ { 0.377479315f, -0.252223611f, 0.891006529f }, { 0x1c7dfcc1u } },
+	{ { -0.171680644f, 0.256938249f, -0.95105654f }, { 0x21a20fa8u } },
+	{ { -0.196038306f, 0.238873363f, -0.95105654f }, { 0x61a1eb9cu } },
+	{ { -0.148096174f, 0.1804557f, -0.972369909f }, { 0x20f173b4u } },
+	{ { -0.165070802f, 0.165070802f, -0.972369909f }, { 0x60f153acu } },
+	{ { -0.180395722f, 0.337496668f, -0.923879504f }, { 0x2282b3a4u } },
+	{ { -0.212607518f, 0.318189651f, -0.923879504f }, { 0x62828f93u } },
+	{ { -0.218508005f, 0.218508005f, -0.95105654f }, { 0x21a1c390u } },
+	{ { -0.1804557f, 0.148096174f, -0.972369909f }, { 0x20f133a4u } },
+	{ { -0.242771804f, 0.295818299f, -0.923879504f }, { 0x22825f84u } },
+	{ { -0.238873363f, 0.196038306f, -0.95105654f }, { 0x61a19386u } },
+	{ { -0.194102719f, 0.129695296f, -0.972369909f }, { 0x60f10b9du } },
+	{ { -0.270598054f, 0.270598054f, -0.923879504f }, { 0x62822b76u } },
+	{ { -0.256938249f, 0.171680644f, -0.95105654f }, { 0x21a1637du } },
+	{ { -0.205880433f, 0.110045381f, -0.972369909f }, { 0x20f0e397u } },
+	{ { -0.295818299f, 0.242771804f, -0.923879504f }, { 0x2281f369u } },
+	{ { -0.272528648f, 0.145669609f, -0.95105654f }, { 0x61a12b75u } },
+	{ { -0.215675399f, 0.0893356726f, -0.972369909f }, { 0x60f0bb92u } },
+	{ { -0.318189651f, 0.212607518f, -0.923879504f }, { 0x6281b75du } },
+	{ { -0.285494477f, 0.118255682f, -0.95105654f }, { 0x21a0f36eu } },
+	{ { -0.223393291f, 0.0677656084f, -0.972369909f }, { 0x20f08f8eu } },
+	{ { -0.337496668f, 0.180395722f, -0.923879504f }, { 0x22817354u } },
+	{ { -0.295710832f, 0.0897028968f, -0.95105654f }, { 0x61a0bb69u } },
+	{ { -0.228959784f, 0.045542933f, -0.972369909f }, { 0x60f05f8bu } },
+	{ { -0.353553385f, 0.146446615f, -0.923879504f }, { 0x62812f4bu } },
+	{ { -0.303079307f, 0.0602862239f, -0.95105654f }, { 0x21a07f65u } },
+	{ { -0.232321262f, 0.0228816476f, -0.972369909f }, { 0x20f03389u } },
+	{ { -0.366205215f, 0.111087136f, -0.923879504f }, { 0x2280e745u } },
+	{ { -0.307529002f, 0.0302889626f, -0.95105654f }, { 0x61a03f63u } },
+	{ { -0.233445361f, 5.10428109e-17f, -0.972369909f }, { 0x60f00389u } },
+	{ { -0.375330269f, 0.0746578351f, -0.923879504f }, { 0x62809b40u } },
+	{ { -0.309017003f, 6.7566541e-17f, -0.95105654f }, { 0x21a00362u } },
+	{ { -0.232321262f, -0.0228816476f, -0.972369909f }, { 0x20ffd389u } },
+	{ { -0.380840719f, 0.0375095345f, -0.923879504f }, { 0x22804f3du } },
+	{ { -0.307529002f, -0.0302889626f, -0.95105654f }, { 0x61afc763u } },
+	{ { -0.228959784f, -0.045542933f, -0.972369909f }, { 0x60ffa78bu } },
+	{ { -0.382683426f, 8.36736997e-17f, -0.923879504f }, { 0x6280033cu } },
+	{ { -0.303079307f, -0.0602862239f, -0.95105654f }, { 0x21af8765u } },
+	{ { -0.223393291f, -0.0677656084f, -0.972369909f }, { 0x20ff778eu } },
+	{ { -0.380840719f, -0.0375095345f, -0.923879504f }, { 0x228fb73du } },
+	{ { -0.295710832f, -0.0897028968f, -0.95105654f }, { 0x61af4b69u } },
+	{ { -0.215675399f, -0.0893356726f, -0.972369909f }, { 0x60ff4b92u } },
+	{ { -0.375330269f, -0.0746578351f, -0.923879504f }, { 0x628f6b40u } },
+	{ { -0.285494477f, -0.118255682f, -0.95105654f }, { 0x21af136eu } },
+	{ { -0.205880433f, -0.110045381f, -0.972369909f }, { 0x20ff2397u } },
+	{ { -0.366205215f, -0.111087136f, -0.923879504f }, { 0x228f1f45u } },
+	{ { -0.272528648f, -0.145669609f, -0.95105654f }, { 0x61aedb75u } },
+	{ { -0.194102719f, -0.129695296f, -0.972369909f }, { 0x60fefb9du } },
+	{ { 0.218508005f, 0.218508005f, -0.95105654f }, { 0x21a1c070u } },
+	{ { 0.148096174f, 0.1804557f, -0.972369909f }, { 0x20f1704cu } },
+	{ { 0.295818299f, 0.242771804f, -0.923879504f }, { 0x2281f097u } },
+	{ { 0.196038306f, 0.238873363f, -0.95105654f }, { 0x61a1e864u } },
+	{ { 0.129695296f, 0.194102719f, -0.972369909f }, { 0x60f18c42u } },
+	{ { 0.270598054f, 0.270598054f, -0.923879504f }, { 0x6282288au } },
+	{ { 0.171680644f, 0.256938249f, -0.95105654f }, { 0x21a20c58u } },
+	{ { 0.110045381f, 0.205880433f, -0.972369909f }, { 0x20f1a438u } },
+	{ { 0.242771804f, 0.295818299f, -0.923879504f }, { 0x22825c7cu } },
+	{ { 0.145669609f, 0.272528648f, -0.95105654f }, { 0x61a22c4au } },
+	{ { 0.0893356726f, 0.215675399f, -0.972369909f }, { 0x60f1b82eu } },
+	{ { 0.212607518f, 0.318189651f, -0.923879504f }, { 0x62828c6du } },
+	{ { 0.118255682f, 0.285494477f, -0.95105654f }, { 0x21a2483cu } },
+	{ { 0.0677656084f, 0.223393291f, -0.972369909f }, { 0x20f1c823u } },
+	{ { 0.180395722f, 0.337496668f, -0.923879504f }, { 0x2282b05cu } },
+	{ { 0.0897028968f, 0.295710832f, -0.95105654f }, { 0x61a25c2eu } },
+	{ { 0.045542933f, 0.228959784f, -0.972369909f }, { 0x60f1d417u } },
+	{ { 0.146446615f, 0.353553385f, -0.923879504f }, { 0x6282d44bu } },
+	{ { 0.0602862239f, 0.303079307f, -0.95105654f }, { 0x21a26c1fu } },
+	{ { 0.0228816476f, 0.232321262f, -0.972369909f }, { 0x20f1dc0cu } },
+	{ { 0.111087136f, 0.366205215f, -0.923879504f }, { 0x2282ec39u } },
+	{ { 0.0302889626f, 0.307529002f, -0.95105654f }, { 0x61a2740fu } },
+	{ { 5.10428109e-17f, 0.233445361f, -0.972369909f }, { 0x60f1dc00u } },
+	{ { 0.0746578351f, 0.375330269f, -0.923879504f }, { 0x62830026u } },
+	{ { 6.7566541e-17f, 0.309017003f, -0.95105654f }, { 0x21a27800u } },
+	{ { -0.0228816476f, 0.232321262f, -0.972369909f }, { 0x20f1dff4u } },
+	{ { 0.0375095345f, 0.380840719f, -0.923879504f }, { 0x22830c13u } },
+	{ { -0.0302889626f, 0.307529002f, -0.95105654f }, { 0x61a277f1u } },
+	{ { -0.045542933f, 0.228959784f, -0.972369909f }, { 0x60f1d7e9u } },
+	{ { 8.36736997e-17f, 0.382683426f, -0.923879504f }, { 0x62831000u } },
+	{ { -0.0602862239f, 0.303079307f, -0.95105654f }, { 0x21a26fe1u } },
+	{ { -0.0677656084f, 0.223393291f, -0.972369909f }, { 0x20f1cbddu } },
+	{ { -0.0375095345f, 0.380840719f, -0.923879504f }, { 0x22830fedu } },
+	{ { -0.0897028968f, 0.295710832f, -0.95105654f }, { 0x61a25fd2u } },
+	{ { -0.0893356726f, 0.215675399f, -0.972369909f }, { 0x60f1bbd2u } },
+	{ { -0.0746578351f, 0.375330269f, -0.923879504f }, { 0x628303dau } },
+	{ { -0.118255682f, 0.285494477f, -0.95105654f }, { 0x21a24bc4u } },
+	{ { -0.110045381f, 0.205880433f, -0.972369909f }, { 0x20f1a7c8u } },
+	{ { -0.111087136f, 0.366205215f, -0.923879504f }, { 0x2282efc7u } },
+	{ { -0.145669609f, 0.272528648f, -0.95105654f }, { 0x61a22fb6u } },
+	{ { -0.129695296f, 0.194102719f, -0.972369909f }, { 0x60f18fbeu } },
+	{ { -0.146446615f, 0.353553385f, -0.923879504f }, { 0x6282d7b5u } },
+	{ { -0.285494477f, 0.118255682f, 0.95105654f }, { 0x1e60f36eu } },
+	{ { -0.295710832f, 0.0897028968f, 0.95105654f }, { 0x5e60bb69u } },
+	{ { -0.223393291f, 0.0677656084f, 0.972369909f }, { 0x1f108f8eu } },
+	{ { -0.303079307f, 0.0602862239f, 0.95105654f }, { 0x1e607f65u } },
+	{ { -0.228959784f, 0.045542933f, 0.972369909f }, { 0x5f105f8bu } },
+	{ { -0.232321262f, 0.0228816476f, 0.972369909f }, { 0x1f103389u } },
+	{ { -0.307529002f, 0.0302889626f, 0.95105654f }, { 0x5e603f63u } },
+	{ { -0.233445361f, 5.10428109e-17f, 0.972369909f }, { 0x5f100389u } },
+	{ { -0.309017003f, 6.7566541e-17f, 0.95105654f }, { 0x1e600362u } },
+	{ { -0.307529002f, -0.0302889626f, 0.95105654f }, { 0x5e6fc763u } },
+	{ { -0.232321262f, -0.0228816476f, 0.972369909f }, { 0x1f1fd389u } },
+	{ { -0.228959784f, -0.045542933f, 0.972369909f }, { 0x5f1fa78bu } },
+	{ { -0.303079307f, -0.0602862239f, 0.95105654f }, { 0x1e6f8765u } },
+	{ { -0.223393291f, -0.0677656084f, 0.972369909f }, { 0x1f1f778eu } },
+	{ { -0.295710832f, -0.0897028968f, 0.95105654f }, { 0x5e6f4b69u } },
+	{ { -0.285494477f, -0.118255682f, 0.95105654f }, { 0x1e6f136eu } },
+	{ { -0.215675399f, -0.0893356726f, 0.972369909f }, { 0x5f1f4b92u } },
+	{ { -0.205880433f, -0.110045381f, 0.972369909f }, { 0x1f1f2397u } },
+	{ { -0.272528648f, -0.145669609f, 0.95105654f }, { 0x5e6edb75u } },
+	{ { -0.194102719f, -0.129695296f, 0.972369909f }, { 0x5f1efb9du } },
+	{ { -0.256938249f, -0.171680644f, 0.95105654f }, { 0x1e6ea37du } },
+	{ { -0.238873363f, -0.196038306f, 0.95105654f }, { 0x5e6e7386u } },
+	{ { -0.1804557f, -0.148096174f, 0.972369909f }, { 0x1f1ed3a4u } },
+	{ { -0.165070802f, -0.165070802f, 0.972369909f }, { 0x5f1eb3acu } },
+	{ { -0.218508005f, -0.218508005f, 0.95105654f }, { 0x1e6e4390u } },
+	{ { -0.148096174f, -0.1804557f, 0.972369909f }, { 0x1f1e93b4u } },
+	{ { -0.196038306f, -0.238873363f, 0.95105654f }, { 0x5e6e1b9cu } },
+	{ { -0.171680644f, -0.256938249f, 0.95105654f }, { 0x1e6df7a8u } },
+	{ { -0.129695296f, -0.194102719f, 0.972369909f }, { 0x5f1e77beu } },
+	{ { -0.110045381f, -0.205880433f, 0.972369909f }, { 0x1f1e5fc8u } },
+	{ { -0.145669609f, -0.272528648f, 0.95105654f }, { 0x5e6dd7b6u } },
+	{ { -0.0893356726f, -0.215675399f, 0.972369909f }, { 0x5f1e4bd2u } },
+	{ { -0.118255682f, -0.285494477f, 0.95105654f }, { 0x1e6dbbc4u } },
+	{ { -0.0897028968f, -0.295710832f, 0.95105654f }, { 0x5e6da7d2u } },
+	{ { -0.0677656084f, -0.223393291f, 0.972369909f }, { 0x1f1e3bddu } },
+	{ { -0.045542933f, -0.228959784f, 0.972369909f }, { 0x5f1e2fe9u } },
+	{ { 0.118255682f, 0.285494477f, 0.95105654f }, { 0x1e62483cu } },
+	{ { 0.0893356726f, 0.215675399f, 0.972369909f }, { 0x5f11b82eu } },
+	{ { 0.0677656084f, 0.223393291f, 0.972369909f }, { 0x1f11c823u } },
+	{ { 0.0897028968f, 0.295710832f, 0.95105654f }, { 0x5e625c2eu } },
+	{ { 0.045542933f, 0.228959784f, 0.972369909f }, { 0x5f11d417u } },
+	{ { 0.0602862239f, 0.303079307f, 0.95105654f }, { 0x1e626c1fu } },
+	{ { 0.0302889626f, 0.307529002f, 0.95105654f }, { 0x5e62740fu } },
+	{ { 0.0228816476f, 0.232321262f, 0.972369909f }, { 0x1f11dc0cu } },
+	{ { 5.10428109e-17f, 0.233445361f, 0.972369909f }, { 0x5f11dc00u } },
+	{ { 6.7566541e-17f, 0.309017003f, 0.95105654f }, { 0x1e627800u } },
+	{ { -0.0228816476f, 0.232321262f, 0.972369909f }, { 0x1f11dff4u } },
+	{ { -0.0302889626f, 0.307529002f, 0.95105654f }, { 0x5e6277f1u } },
+	{ { -0.0602862239f, 0.303079307f, 0.95105654f }, { 0x1e626fe1u } },
+	{ { -0.045542933f, 0.228959784f, 0.972369909f }, { 0x5f11d7e9u } },
+	{ { -0.0677656084f, 0.223393291f, 0.972369909f }, { 0x1f11cbddu } },
+	{ { -0.0897028968f, 0.295710832f, 0.95105654f }, { 0x5e625fd2u } },
+	{ { -0.0893356726f, 0.215675399f, 0.972369909f }, { 0x5f11bbd2u } },
+	{ { -0.118255682f, 0.285494477f, 0.95105654f }, { 0x1e624bc4u } },
+	{ { -0.145669609f, 0.272528648f, 0.95105654f }, { 0x5e622fb6u } },
+	{ { -0.110045381f, 0.205880433f, 0.972369909f }, { 0x1f11a7c8u } },
+	{ { -0.129695296f, 0.194102719f, 0.972369909f }, { 0x5f118fbeu } },
+	{ { -0.171680644f, 0.256938249f, 0.95105654f }, { 0x1e620fa8u } },
+	{ { -0.148096174f, 0.1804557f, 0.972369909f }, { 0x1f1173b4u } },
+	{ { -0.196038306f, 0.238873363f, 0.95105654f }, { 0x5e61eb9cu } },
+	{ { -0.218508005f, 0.218508005f, 0.95105654f }, { 0x1e61c390u } },
+	{ { -0.165070802f, 0.165070802f, 0.972369909f }, { 0x5f1153acu } },
+	{ { -0.1804557f, 0.148096174f, 0.972369909f }, { 0x1f1133a4u } },
+	{ { -0.238873363f, 0.196038306f, 0.95105654f }, { 0x5e619386u } },
+	{ { -0.194102719f, 0.129695296f, 0.972369909f }, { 0x5f110b9du } },
+	{ { -0.256938249f, 0.171680644f, 0.95105654f }, { 0x1e61637du } },
+	{ { -0.272528648f, 0.145669609f, 0.95105654f }, { 0x5e612b75u } },
+	{ { -0.205880433f, 0.110045381f, 0.972369909f }, { 0x1f10e397u } },
+	{ { -0.215675399f, 0.0893356726f, 0.972369909f }, { 0x5f10bb92u } },
+	{ { -0.553857625f, -0.828906476f, 0.0784590989f }, { 0x428962e5u } },
+	{ { -0.471396744f, -0.881921291f, 2.18649922e-16f }, { 0x4008f70fu } },
+	{ { -0.469943583f, -0.879202604f, 0.0784590989f }, { 0x0288ff10u } },
+	{ { -0.548730254f, -0.821232855f, 0.156434461f }, { 0x050972e8u } },
+	{ { -0.46559307f, -0.871063352f, 0.156434461f }, { 0x45090f12u } },
+	{ { 0.0784590989f, 0.0f, -0.996917307f }, { 0x60300028u } },
+	{ { 2.1759706e-16f, 2.14314407e-17f, -1.0f }, { 0x60100000u } },
+	{ { 2.18649922e-16f, 0.0f, -1.0f }, { 0x20100000u } },
+	{ { 0.0780812949f, 0.00769033609f, -0.996917307f }, { 0x20301028u } },
+	{ { 0.156434461f, 0.0f, -0.987688363f }, { 0x20700050u } },
+	{ { 2.14448625e-16f, 4.26564833e-17f, -1.0f }, { 0x20100000u } },
+	{ { 0.155681193f, 0.0153332585f, -0.987688363f }, { 0x60702050u } },
+	{ { 0.233445361f, 0.0f, -0.972369909f }, { 0x60f00077u } },
+	{ { 0.0769515261f, 0.0153066106f, -0.996917307f }, { 0x60302027u } },
+	{ { 2.09234926e-16f, 6.34707198e-17f, -1.0f }, { 0x60100000u } },
+	{ { 0.232321262f, 0.0228816476f, -0.972369909f }, { 0x20f03077u } },
+	{ { 0.309017003f, 0.0f, -0.95105654f }, { 0x21a0009eu } },
+	{ { 0.153428614f, 0.0305188503f, -0.987688363f }, { 0x2070404eu } },
+	{ { 0.0750806704f, 0.0227754731f, -0.996917307f }, { 0x20303026u } },
+	{ { 2.02006188e-16f, 8.36736997e-17f, -1.0f }, { 0x20100000u } },
+	{ { 0.0724867508f, 0.030024996f, -0.996917307f }, { 0x60303c25u } },
+	{ { 1.92832014e-16f, 1.0307086e-16f, -1.0f }, { 0x60100000u } },
+	{ { 0.149698451f, 0.0454105288f, -0.987688363f }, { 0x60705c4cu } },
+	{ { 0.0691947415f, 0.0369853601f, -0.996917307f }, { 0x20304c23u } },
+	{ { 1.81800759e-16f, 1.2147539e-16f, -1.0f }, { 0x20100000u } },
+	{ { 0.144526601f, 0.0598648787f, -0.987688363f }, { 0x20707c4au } },
+	{ { 0.0652363524f, 0.0435895398f, -0.996917307f }, { 0x60305821u } },
+	{ { 1.69018675e-16f, 1.38710036e-16f, -1.0f }, { 0x60100000u } },
+	{ { 0.137962878f, 0.0737426952f, -0.987688363f }, { 0x60709846u } },
+	{ { 0.0606497005f, 0.0497739241f, -0.996917307f }, { 0x2030641fu } },
+	{ { 1.54608844e-16f, 1.54608844e-16f, -1.0f }, { 0x20100000u } },
+	{ { 0.130070508f, 0.0869103298f, -0.987688363f }, { 0x2070b042u } },
+	{ { 0.0554789603f, 0.0554789603f, -0.996917307f }, { 0x6030701cu } },
+	{ { 1.38710036e-16f, 1.69018675e-16f, -1.0f }, { 0x60100000u } },
+	{ { 0.120925479f, 0.0992409736f, -0.987688363f }, { 0x6070cc3eu } },
+	{ { 0.0497739241f, 0.0606497005f, -0.996917307f }, { 0x20307c19u } },
+	{ { 1.2147539e-16f, 1.81800759e-16f, -1.0f }, { 0x20100000u } },
+	{ { 0.110615872f, 0.110615872f, -0.987688363f }, { 0x2070e439u } },
+	{ { 0.0435895398f, 0.0652363524f, -0.996917307f }, { 0x60308416u } },
+	{ { 1.0307086e-16f, 1.92832014e-16f, -1.0f }, { 0x60100000u } },
+	{ { 0.0992409736f, 0.120925479f, -0.987688363f }, { 0x6070f833u } },
+	{ { 0.0369853601f, 0.0691947415f, -0.996917307f }, { 0x20308c13u } },
+	{ { 8.36736997e-17f, 2.02006188e-16f, -1.0f }, { 0x20100000u } },
+	{ { 0.0869103298f, 0.130070508f, -0.987688363f }, { 0x2071082cu } },
+	{ { 0.030024996f, 0.0724867508f, -0.996917307f }, { 0x6030940fu } },
+	{ { 6.34707198e-17f, 2.09234926e-16f, -1.0f }, { 0x60100000u } },
+	{ { 0.0737426952f, 0.137962878f, -0.987688363f }, { 0x60711826u } },
+	{ { 0.0227754731f, 0.0750806704f, -0.996917307f }, { 0x2030980cu } },
+	{ { 4.26564833e-17f, 2.14448625e-16f, -1.0f }, { 0x20100000u } },
+	{ { 0.0598648787f, 0.144526601f, -0.987688363f }, { 0x2071281fu } },
+	{ { 0.0153066106f, 0.0769515261f, -0.996917307f }, { 0x60309c08u } },
+	{ { 2.14314407e-17f, 2.1759706e-16f, -1.0f }, { 0x60100000u } },
+	{ { 0.0454105288f, 0.149698451f, -0.987688363f }, { 0x60713017u } },
+	{ { 0.00769033609f, 0.0780812949f, -0.996917307f }, { 0x2030a004u } },
+	{ { 4.78077872e-32f, 2.18649922e-16f, -1.0f }, { 0x20100000u } },
+	{ { 0.0305188503f, 0.153428614f, -0.987688363f }, { 0x20713810u } },
+	{ { 1.71550757e-17f, 0.0784590989f, -0.996917307f }, { 0x6030a000u } },
+	{ { -2.14314407e-17f, 2.1759706e-16f, -1.0f }, { 0x60100000u } },
+	{ { 0.0153332585f, 0.155681193f, -0.987688363f }, { 0x60714008u } },
+	{ { -0.00769033609f, 0.0780812949f, -0.996917307f }, { 0x2030a3fcu } },
+	{ { -4.26564833e-17f, 2.14448625e-16f, -1.0f }, { 0x20100000u } },
+	{ { 3.42043849e-17f, 0.156434461f, -0.987688363f }, { 0x20714000u } },
+	{ { -0.0153066106f, 0.0769515261f, -0.996917307f }, { 0x60309ff8u } },
+	{ { -6.34707198e-17f, 2.09234926e-16f, -1.0f }, { 0x60100000u } },
+	{ { -0.0153332585f, 0.155681193f, -0.987688363f }, { 0x607143f8u } },
+	{ { -0.0227754731f, 0.0750806704f, -0.996917307f }, { 0x20309bf4u } },
+	{ { -8.36736997e-17f, 2.02006188e-16f, -1.0f }, { 0x20100000u } },
+	{ { -0.0305188503f, 0.153428614f, -0.987688363f }, { 0x20713bf0u } },
+	{ { -0.030024996f, 0.0724867508f, -0.996917307f }, { 0x603097f1u } },
+	{ { -1.0307086e-16f, 1.92832014e-16f, -1.0f }, { 0x60100000u } },
+	{ { -0.0454105288f, 0.149698451f, -0.987688363f }, { 0x607133e9u } },
+	{ { -0.0369853601f, 0.0691947415f, -0.996917307f }, { 0x20308fedu } },
+	{ { -1.2147539e-16f, 1.81800759e-16f, -1.0f }, { 0x20100000u } },
+	{ { -0.0598648787f, 0.144526601f, -0.987688363f }, { 0x20712be1u } },
+	{ { -0.0435895398f, 0.0652363524f, -0.996917307f }, { 0x603087eau } },
+	{ { -1.38710036e-16f, 1.69018675e-16f, -1.0f }, { 0x60100000u } },
+	{ { -0.0737426952f, 0.137962878f, -0.987688363f }, { 0x60711bdau } },
+	{ { -0.0497739241f, 0.0606497005f, -0.996917307f }, { 0x20307fe7u } },
+	{ { -1.54608844e-16f, 1.54608844e-16f, -1.0f }, { 0x20100000u } },
+	{ { -0.0869103298f, 0.130070508f, -0.987688363f }, { 0x20710bd4u } },
+	{ { -0.0554789603f, 0.0554789603f, -0.996917307f }, { 0x603073e4u } },
+	{ { -1.69018675e-16f, 1.38710036e-16f, -1.0f }, { 0x60100000u } },
+	{ { -0.0992409736f, 0.120925479f, -0.987688363f }, { 0x6070fbcdu } },
+	{ { -0.0606497005f, 0.0497739241f, -0.996917307f }, { 0x203067e1u } },
+	{ { -1.81800759e-16f, 1.2147539e-16f, -1.0f }, { 0x20100000u } },
+	{ { -0.110615872f, 0.110615872f, -0.987688363f }, { 0x2070e7c7u } },
+	{ { -0.0652363524f, 0.0435895398f, -0.996917307f }, { 0x60305bdfu } },
+	{ { -1.92832014e-16f, 1.0307086e-16f, -1.0f }, { 0x60100000u } },
+	{ { -0.120925479f, 0.0992409736f, -0.987688363f }, { 0x6070cfc2u } },
+	{ { -0.0691947415f, 0.0369853601f, -0.996917307f }, { 0x20304fddu } },
+	{ { -2.02006188e-16f, 8.36736997e-17f, -1.0f }, { 0x20100000u } },
+	{ { -0.130070508f, 0.0869103298f, -0.987688363f }, { 0x2070b3beu } },
+	{ { -0.0724867508f, 0.030024996f, -0.996917307f }, { 0x60303fdbu } },
+	{ { -2.09234926e-16f, 6.34707198e-17f, -1.0f }, { 0x60100000u } },
+	{ { -0.137962878f, 0.0737426952f, -0.987688363f }, { 0x60709bbau } },
+	{ { -0.0750806704f, 0.0227754731f, -0.996917307f }, { 0x203033dau } },
+	{ { -2.14448625e-16f, 4.26564833e-17f, -1.0f }, { 0x20100000u } },
+	{ { -0.144526601f, 0.0598648787f, -0.987688363f }, { 0x20707fb6u } },
+	{ { -0.0769515261f, 0.0153066106f, -0.996917307f }, { 0x603023d9u } },
+	{ { -2.1759706e-16f, 2.14314407e-17f, -1.0f }, { 0x60100000u } },
+	{ { -0.149698451f, 0.0454105288f, -0.987688363f }, { 0x60705fb4u } },
+	{ { -0.0780812949f, 0.00769033609f, -0.996917307f }, { 0x203013d8u } },
+	{ { -2.18649922e-16f, 4.78077872e-32f, -1.0f }, { 0x20100000u } },
+	{ { -0.153428614f, 0.0305188503f, -0.987688363f }, { 0x207043b2u } },
+	{ { -0.0784590989f, 1.71550757e-17f, -0.996917307f }, { 0x603003d8u } },
+	{ { -2.1759706e-16f, -2.14314407e-17f, -1.0f }, { 0x60100000u } },
+	{ { -0.155681193f, 0.0153332585f, -0.987688363f }, { 0x607023b0u } },
+	{ { -0.0780812949f, -0.00769033609f, -0.996917307f }, { 0x203ff3d8u } },
+	{ { -2.14448625e-16f, -4.26564833e-17f, -1.0f }, { 0x20100000u } },
+	{ { -0.156434461f, 3.42043849e-17f, -0.987688363f }, { 0x207003b0u } },
+	{ { -0.0769515261f, -0.0153066106f, -0.996917307f }, { 0x603fe3d9u } },
+	{ { -2.09234926e-16f, -6.34707198e-17f, -1.0f }, { 0x60100000u } },
+	{ { -0.155681193f, -0.0153332585f, -0.987688363f }, { 0x607fe3b0u } },
+	{ { -0.0750806704f, -0.0227754731f, -0.996917307f }, { 0x203fd3dau } },
+	{ { -2.02006188e-16f, -8.36736997e-17f, -1.0f }, { 0x20100000u } },
+	{ { -0.153428614f, -0.0305188503f, -0.987688363f }, { 0x207fc3b2u } },
+	{ { -0.0724867508f, -0.030024996f, -0.996917307f }, { 0x603fc7dbu } },
+	{ { -1.92832014e-16f, -1.0307086e-16f, -1.0f }, { 0x60100000u } },
+	{ { -0.149698451f, -0.0454105288f, -0.987688363f }, { 0x607fa7b4u } },
+	{ { -0.0691947415f, -0.0369853601f, -0.996917307f }, { 0x203fb7ddu } },
+	{ { -1.81800759e-16f, -1.2147539e-16f, -1.0f }, { 0x20100000u } },
+	{ { -0.144526601f, -0.0598648787f, -0.987688363f }, { 0x207f87b6u } },
+	{ { -0.0652363524f, -0.0435895398f, -0.996917307f }, { 0x603fabdfu } },
+	{ { -1.69018675e-16f, -1.38710036e-16f, -1.0f }, { 0x60100000u } },
+	{ { -0.137962878f, -0.0737426952f, -0.987688363f }, { 0x607f6bbau } },
+	{ { -0.0606497005f, -0.0497739241f, -0.996917307f }, { 0x203f9fe1u } },
+	{ { -1.54608844e-16f, -1.54608844e-16f, -1.0f }, { 0x20100000u } },
+	{ { -0.130070508f, -0.0869103298f, -0.987688363f }, { 0x207f53beu } },
+	{ { -0.0554789603f, -0.0554789603f, -0.996917307f }, { 0x603f93e4u } },
+	{ { -1.38710036e-16f, -1.69018675e-16f, -1.0f }, { 0x60100000u } },
+	{ { -0.120925479f, -0.0992409736f, -0.987688363f }, { 0x607f37c2u } },
+	{ { -0.0497739241f, -0.0606497005f, -0.996917307f }, { 0x203f87e7u } },
+	{ { -1.2147539e-16f, -1.81800759e-16f, -1.0f }, { 0x20100000u } },
+	{ { -0.110615872f, -0.110615872f, -0.987688363f }, { 0x207f1fc7u } },
+	{ { -0.0435895398f, -0.0652363524f, -0.996917307f }, { 0x603f7feau } },
+	{ { -1.0307086e-16f, -1.92832014e-16f, -1.0f }, { 0x60100000u } },
+	{ { -0.0992409736f, -0.120925479f, -0.987688363f }, { 0x607f0bcdu } },
+	{ { -0.0369853601f, -0.0691947415f, -0.996917307f }, { 0x203f77edu } },
+	{ { -8.36736997e-17f, -2.02006188e-16f, -1.0f }, { 0x20100000u } },
+	{ { -0.0869103298f, -0.130070508f, -0.987688363f }, { 0x207efbd4u } },
+	{ { -0.030024996f, -0.0724867508f, -0.996917307f }, { 0x603f6ff1u } },
+	{ { -6.34707198e-17f, -2.09234926e-16f, -1.0f }, { 0x60100000u } },
+	{ { -0.0737426952f, -0.137962878f, -0.987688363f }, { 0x607eebdau } },
+	{ { -0.0227754731f, -0.0750806704f, -0.996917307f }, { 0x203f6bf4u } },
+	{ { -4.26564833e-17f, -2.14448625e-16f, -1.0f }, { 0x20100000u } },
+	{ { -0.0598648787f, -0.144526601f, -0.987688363f }, { 0x207edbe1u } },
+	{ { -0.0153066106f, -0.0769515261f, -0.996917307f }, { 0x603f67f8u } },
+	{ { -2.14314407e-17f, -2.1759706e-16f, -1.0f }, { 0x60100000u } },
+	{ { -0.0454105288f, -0.149698451f, -0.987688363f }, { 0x607ed3e9u } },
+	{ { -0.00769033609f, -0.0780812949f, -0.996917307f }, { 0x203f63fcu } },
+	{ { 0.0f, -2.18649922e-16f, -1.0f }, { 0x20100000u } },
+	{ { -0.0305188503f, -0.153428614f, -0.987688363f }, { 0x207ecbf0u } },
+	{ { 0.0f, -0.0784590989f, -0.996917307f }, { 0x603f6000u } },
+	{ { 2.14314407e-17f, -2.1759706e-16f, -1.0f }, { 0x60100000u } },
+	{ { -0.0153332585f, -0.155681193f, -0.987688363f }, { 0x607ec3f8u } },
+	{ { 0.00769033609f, -0.0780812949f, -0.996917307f }, { 0x203f6004u } },
+	{ { 4.26564833e-17f, -2.14448625e-16f, -1.0f }, { 0x20100000u } },
+	{ { 0.0f, -0.156434461f, -0.987688363f }, { 0x207ec000u } },
+	{ { 0.0153066106f, -0.0769515261f, -0.996917307f }, { 0x603f6408u } },
+	{ { 6.34707198e-17f, -2.09234926e-16f, -1.0f }, { 0x60100000u } },
+	{ { 0.0153332585f, -0.155681193f, -0.987688363f }, { 0x607ec008u } },
+	{ { 0.0227754731f, -0.0750806704f, -0.996917307f }, { 0x203f680cu } },
+	{ { 8.36736997e-17f, -2.02006188e-16f, -1.0f }, { 0x20100000u } },
+	{ { 0.0305188503f, -0.153428614f, -0.987688363f }, { 0x207ec810u } },
+	{ { 0.030024996f, -0.0724867508f, -0.996917307f }, { 0x603f6c0fu } },
+	{ { 1.0307086e-16f, -1.92832014e-16f, -1.0f }, { 0x60100000u } },
+};
+
+static const unsigned short bakedIndices[40560] = {
+	// ground quad
+	0, 1, 2, 0, 3, 1,
+	// wall quad
+	0, 1, 2, 0, 3, 1,
+	// ground grid
+	0, 1, 2, 0, 3, 1, 4, 3, 0, 3, 5, 1, 4, 6, 3, 7,
+	6, 4, 3, 8, 5, 6, 8, 3, 8, 9, 5, 7, 10, 6, 11, 10,
+	7, 6, 12, 8, 10, 12, 6, 8, 13, 9, 12, 13, 8, 13, 14, 9,
+	11, 15, 10, 16, 15, 11, 13, 17, 14, 17, 18, 14, 12, 19, 13, 19,
+	17, 13, 10, 20, 12, 20, 19, 12, 15, 20, 10, 17, 21, 18, 21, 22,
+	18, 19, 23, 17, 23, 21, 17, 20, 24, 19, 24, 23, 19, 21, 25, 22,
+	25, 26, 22, 23, 27, 21, 27, 25, 21, 25, 28, 26, 28, 29, 26, 27,
+	30, 25, 30, 28, 25, 31, 27, 23, 24, 31, 23, 32, 30, 27, 31, 32,
+	27, 28, 33, 29, 33, 34, 29, 30, 35, 28, 35, 33, 28, 33, 36, 34,
+	36, 37, 34, 35, 38, 33, 38, 36, 33, 39, 35, 30, 32, 39, 30, 40,
+	38, 35, 39, 40, 35, 36, 41, 37, 41, 42, 37, 38, 43, 36, 43, 41,
+	36, 41, 44, 42, 44, 45, 42, 43, 46, 41, 46, 44, 41, 47, 43, 38,
+	40, 47, 38, 48, 46, 43, 47, 48, 43, 44, 49, 45, 49, 50, 45, 46,
+	51, 44, 51, 49, 44, 49, 52, 50, 52, 53, 50, 51, 54, 49, 54, 52,
+	49, 55, 51, 46, 48, 55, 46, 56, 54, 51, 55, 56, 51, 52, 57, 53,
+	57, 58, 53, 54, 59, 52, 59, 57, 52, 57, 60, 58, 60, 61, 58, 59,
+	62, 57, 62, 60, 57, 63, 59, 54, 56, 63, 54, 64, 62, 59, 63, 64,
+	59, 60, 65, 61, 65, 66, 61, 62, 67, 60, 67, 65, 60, 65, 68, 66,
+	68, 69, 66, 67, 70, 65, 70, 68, 65, 71, 67, 62, 64, 71, 62, 72,
+	70, 67, 71, 72, 67, 68, 73, 69, 73, 74, 69, 70, 75, 68, 75, 73,
+	68, 73, 76, 74, 76, 77, 74, 75, 78, 73, 78, 76, 73, 79, 75, 70,
+	72, 79, 70, 80, 78, 75, 79, 80, 75, 76, 81, 77, 81, 82, 77, 78,
+	83, 76, 83, 81, 76, 81, 84, 82, 84, 85, 82, 83, 86, 81, 86, 84,
+	81, 87, 83, 78, 80, 87, 78, 88, 86, 83, 87, 88, 83, 84, 89, 85,
+	89, 90, 85, 86, 91, 84, 91, 89, 84, 89, 92, 90, 92, 93, 90, 91,
+	94, 89, 94, 92, 89, 95, 91, 86, 88, 95, 86, 96, 94, 91, 95, 96,
+	91, 92, 97, 93, 97, 98, 93, 94, 99, 92, 99, 97, 92, 97, 100, 98,
+	100, 101, 98, 99, 102, 97, 102, 100, 97, 103, 99, 94, 96, 103, 94, 104,
+	102, 99, 103, 104, 99, 100, 105, 101, 105, 106, 101, 102, 107, 100, 107, 105,
+	100, 105, 108, 106, 108, 109, 106, 107, 110, 105, 110, 108, 105, 111, 107, 102,
+	104, 111, 102, 112, 110, 107, 111, 112, 107, 108, 113, 109, 113, 114, 109, 110,
+	115, 108, 115, 113, 108, 113, 116, 114, 116, 117, 114, 116, 118, 117, 119, 116,
+	113, 115, 119, 113, 120, 118, 116, 119, 120, 116, 120, 121, 118, 122, 119, 115,
+	123, 121, 120, 123, 124, 121, 125, 120, 119, 125, 123, 120, 122, 125, 119, 126,
+	124, 123, 126, 127, 124, 128, 123, 125, 128, 126, 123, 129, 127, 126, 129, 130,
+	127, 131, 126, 128, 131, 129, 126, 132, 128, 125, 132, 125, 122, 133, 131, 128,
+	133, 128, 132, 134, 130, 129, 134, 135, 130, 136, 129, 131, 136, 134, 129, 137,
+	135, 134, 137, 138, 135, 139, 134, 136, 139, 137, 134, 140, 136, 131, 140, 131,
+	133, 141, 139, 136, 141, 136, 140, 142, 138, 137, 142, 143, 138, 144, 137, 139,
+	144, 142, 137, 145, 143, 142, 145, 146, 143, 147, 142, 144, 147, 145, 142, 148,
+	144, 139, 148, 139, 141, 149, 147, 144, 149, 144, 148, 150, 146, 145, 150, 151,
+	146, 152, 145, 147, 152, 150, 145, 153, 151, 150, 153, 154, 151, 155, 150, 152,
+	155, 153, 150, 156, 152, 147, 156, 147, 149, 157, 155, 152, 157, 152, 156, 158,
+	154, 153, 158, 159, 154, 160, 153, 155, 160, 158, 153, 161, 159, 158, 161, 162,
+	159, 163, 158, 160, 163, 161, 158, 164, 160, 155, 164, 155, 157, 165, 163, 160,
+	165, 160, 164, 166, 162, 161, 166, 167, 162, 168, 161, 163, 168, 166, 161, 169,
+	167, 166, 169, 170, 167, 171, 166, 168, 171, 169, 166, 172, 168, 163, 172, 163,
+	165, 173, 171, 168, 173, 168, 172, 174, 170, 169, 174, 175, 170, 176, 169, 171,
+	176, 174, 169, 177, 175, 174, 177, 178, 175, 179, 174, 176, 179, 177, 174, 180,
+	176, 171, 180, 171, 173, 181, 179, 176, 181, 176, 180, 182, 178, 177, 182, 183,
+	178, 184, 177, 179, 184, 182, 177, 185, 183, 182, 185, 186, 183, 187, 182, 184,
+	187, 185, 182, 188, 184, 179, 188, 179, 181, 189, 187, 184, 189, 184, 188, 190,
+	186, 185, 190, 191, 186, 192, 185, 187, 192, 190, 185, 193, 191, 190, 193, 194,
+	191, 195, 190, 192, 195, 193, 190, 196, 192, 187, 196, 187, 189, 197, 195, 192,
+	197, 192, 196, 198, 194, 193, 198, 199, 194, 200, 193, 195, 200, 198, 193, 201,
+	199, 198, 201, 202, 199, 203, 198, 200, 203, 201, 198, 204, 200, 195, 204, 195,
+	197, 205, 203, 200, 205, 200, 204, 206, 202, 201, 206, 207, 202, 208, 201, 203,
+	208, 206, 201, 209, 207, 206, 209, 210, 207, 211, 206, 208, 211, 209, 206, 212,
+	208, 203, 212, 203, 205, 213, 211, 208, 213, 208, 212, 214, 210, 209, 214, 215,
+	210, 216, 209, 211, 216, 214, 209, 217, 215, 214, 217, 218, 215, 219, 214, 216,
+	219, 217, 214, 220, 216, 211, 220, 211, 213, 221, 219, 216, 221, 216, 220, 222,
+	218, 217, 222, 223, 218, 224, 217, 219, 224, 222, 217, 225, 223, 222, 225, 226,
+	223, 227, 228, 226, 227, 226, 225, 229, 227, 225, 230, 225, 222, 229, 225, 230,
+	230, 222, 224, 231, 229, 230, 231, 230, 232, 232, 230, 224, 233, 231, 232, 234,
+	224, 219, 232, 224, 234, 234, 219, 221, 233, 232, 235, 235, 232, 234, 236, 233,
+	235, 237, 234, 221, 235, 234, 237, 236, 235, 238, 238, 235, 237, 239, 236, 238,
+	237, 221, 240, 240, 221, 220, 238, 237, 241, 241, 237, 240, 239, 238, 242, 242,
+	238, 241, 243, 239, 242, 240, 220, 244, 244, 220, 213, 243, 242, 245, 246, 243,
+	245, 242, 241, 247, 245, 242, 247, 241, 240, 248, 247, 241, 248, 248, 240, 244,
+	246, 245, 249, 250, 246, 249, 245, 247, 251, 249, 245, 251, 247, 248, 252, 251,
+	247, 252, 250, 249, 253, 254, 250, 253, 249, 251, 255, 253, 249, 255, 254, 253,
+	256, 257, 254, 256, 253, 255, 258, 256, 253, 258, 255, 251, 259, 251, 252, 259,
+	257, 256, 260, 261, 257, 260, 260, 256, 262, 256, 258, 262, 261, 260, 263, 264,
+	261, 263, 260, 262, 265, 263, 260, 265, 264, 263, 266, 267, 264, 266, 263, 265,
+	268, 266, 263, 268, 267, 266, 269, 270, 267, 269, 266, 268, 271, 269, 266, 271,
+	270, 269, 272, 273, 270, 272, 269, 271, 274, 272, 269, 274, 273, 272, 275, 276,
+	273, 275, 272, 274, 277, 275, 272, 277, 276, 275, 278, 279, 276, 278, 275, 277,
+	280, 278, 275, 280, 279, 278, 281, 282, 279, 281, 278, 280, 283, 281, 278, 283,
+	282, 281, 284, 285, 282, 284, 281, 283, 286, 284, 281, 286, 285, 284, 287, 288,
+	285, 287, 284, 286, 289, 287, 284, 289, 288, 287, 290, 291, 288, 290, 287, 289,
+	292, 290, 287, 292, 291, 290, 293, 294, 291, 293, 290, 292, 295, 293, 290, 295,
+	294, 293, 296, 297, 294, 296, 293, 295, 298, 296, 293, 298, 297, 296, 299, 300,
+	297, 299, 296, 298, 301, 299, 296, 301, 300, 299, 302, 303, 300, 302, 299, 301,
+	304, 302, 299, 304, 303, 302, 305, 306, 303, 305, 302, 304, 307, 305, 302, 307,
+	306, 305, 308, 309, 306, 308, 305, 307, 310, 308, 305, 310, 309, 308, 311, 312,
+	309, 311, 308, 310, 313, 311, 308, 313, 312, 311, 314, 315, 312, 314, 315, 314,
+	316, 314, 311, 317, 311, 313, 317, 316, 314, 318, 314, 317, 318, 316, 318, 319,
+	317, 313, 320, 319, 318, 321, 319, 321, 322, 318, 317, 323, 318, 323, 321, 317,
+	320, 323, 322, 321, 324, 322, 324, 325, 321, 323, 326, 321, 326, 324, 325, 324,
+	327, 325, 327, 328, 324, 326, 329, 324, 329, 327, 323, 330, 326, 323, 320, 330,
+	326, 331, 329, 326, 330, 331, 327, 329, 332, 328, 327, 333, 327, 332, 333, 328,
+	333, 334, 329, 335, 332, 329, 331, 335, 334, 333, 336, 334, 336, 337, 333, 332,
+	338, 333, 338, 336, 337, 336, 339, 337, 339, 340, 336, 338, 341, 336, 341, 339,
+	332, 342, 338, 332, 335, 342, 338, 343, 341, 338, 342, 343, 339, 341, 344, 340,
+	339, 345, 339, 344, 345, 340, 345, 346, 341, 347, 344, 341, 343, 347, 346, 345,
+	348, 346, 348, 349, 345, 344, 350, 345, 350, 348, 349, 348, 351, 349, 351, 352,
+	348, 350, 353, 348, 353, 351, 344, 354, 350, 344, 347, 354, 350, 355, 353, 350,
+	354, 355, 351, 353, 356, 352, 351, 357, 351, 356, 357, 352, 357, 358, 353, 359,
+	356, 353, 355, 359, 358, 357, 360, 358, 360, 361, 357, 356, 362, 357, 362, 360,
+	361, 360, 363, 361, 363, 364, 360, 362, 365, 360, 365, 363, 356, 366, 362, 356,
+	359, 366, 362, 367, 365, 362, 366, 367, 363, 365, 368, 364, 363, 369, 363, 368,
+	369, 364, 369, 370, 365, 371, 368, 365, 367, 371, 370, 369, 372, 370, 372, 373,
+	369, 368, 374, 369, 374, 372, 373, 372, 375, 373, 375, 376, 372, 374, 377, 372,
+	377, 375, 368, 378, 374, 368, 371, 378, 374, 379, 377, 374, 378, 379, 375, 377,
+	380, 376, 375, 381, 375, 380, 381, 376, 381, 382, 377, 383, 380, 377, 379, 383,
+	382, 381, 384, 382, 384, 385, 381, 380, 386, 381, 386, 384, 385, 384, 387, 385,
+	387, 388, 384, 386, 389, 384, 389, 387, 380, 390, 386, 380, 383, 390, 386, 391,
+	389, 386, 390, 391, 387, 389, 392, 388, 387, 393, 387, 392, 393, 388, 393, 394,
+	389, 395, 392, 389, 391, 395, 394, 393, 396, 394, 396, 397, 393, 392, 398, 393,
+	398, 396, 397, 396, 399, 397, 399, 400, 396, 398, 401, 396, 401, 399, 392, 402,
+	398, 392, 395, 402, 398, 403, 401, 398, 402, 403, 399, 401, 404, 400, 399, 405,
+	399, 404, 405, 400, 405, 406, 401, 407, 404, 401, 403, 407, 406, 405, 408, 406,
+	408, 16, 16, 408, 15, 405, 404, 409, 405, 409, 408, 408, 410, 15, 408, 409,
+	410, 15, 410, 20, 410, 24, 20, 410, 411, 24, 409, 411, 410, 411, 31, 24,
+	404, 412, 409, 409, 412, 411, 404, 407, 412, 411, 413, 31, 412, 413, 411, 413,
+	32, 31, 407, 414, 412, 412, 414, 413, 413, 415, 32, 414, 415, 413, 415, 39,
+	32, 407, 416, 414, 403, 416, 407, 414, 417, 415, 416, 417, 414, 415, 418, 39,
+	417, 418, 415, 418, 40, 39, 403, 419, 416, 402, 419, 403, 418, 420, 40, 420,
+	47, 40, 417, 421, 418, 421, 420, 418, 416, 422, 417, 422, 421, 417, 419, 422,
+	416, 420, 423, 47, 423, 48, 47, 421, 424, 420, 424, 423, 420, 422, 425, 421,
+	425, 424, 421, 423, 426, 48, 426, 55, 48, 424, 427, 423, 427, 426, 423, 426,
+	428, 55, 428, 56, 55, 427, 429, 426, 429, 428, 426, 430, 427, 424, 425, 430,
+	424, 431, 429, 427, 430, 431, 427, 428, 432, 56, 432, 63, 56, 429, 433, 428,
+	433, 432, 428, 432, 434, 63, 434, 64, 63, 433, 435, 432, 435, 434, 432, 436,
+	433, 429, 431, 436, 429, 437, 435, 433, 436, 437, 433, 434, 438, 64, 438, 71,
+	64, 435, 439, 434, 439, 438, 434, 438, 440, 71, 440, 72, 71, 439, 441, 438,
+	441, 440, 438, 442, 439, 435, 437, 442, 435, 443, 441, 439, 442, 443, 439, 440,
+	444, 72, 444, 79, 72, 441, 445, 440, 445, 444, 440, 444, 446, 79, 446, 80,
+	79, 445, 447, 444, 447, 446, 444, 448, 445, 441, 443, 448, 441, 449, 447, 445,
+	448, 449, 445, 446, 450, 80, 450, 87, 80, 447, 451, 446, 451, 450, 446, 450,
+	452, 87, 452, 88, 87, 451, 453, 450, 453, 452, 450, 454, 451, 447, 449, 454,
+	447, 455, 453, 451, 454, 455, 451, 452, 456, 88, 456, 95, 88, 453, 457, 452,
+	457, 456, 452, 456, 458, 95, 458, 96, 95, 457, 459, 456, 459, 458, 456, 460,
+	457, 453, 455, 460, 453, 461, 459, 457, 460, 461, 457, 458, 462, 96, 462, 103,
+	96, 459, 463, 458, 463, 462, 458, 462, 464, 103, 464, 104, 103, 463, 465, 462,
+	465, 464, 462, 466, 463, 459, 461, 466, 459, 467, 465, 463, 466, 467, 463, 464,
+	468, 104, 468, 111, 104, 465, 469, 464, 469, 468, 464, 468, 470, 111, 470, 112,
+	111, 469, 471, 468, 471, 470, 468, 472, 469, 465, 467, 472, 465, 473, 471, 469,
+	472, 473, 469, 471, 474, 470, 475, 472, 467, 473, 476, 471, 476, 474, 471, 477,
+	473, 472, 475, 477, 472, 478, 476, 473, 477, 478, 473, 479, 475, 467, 479, 467,
+	466, 480, 477, 475, 481, 479, 466, 481, 466, 461, 482, 475, 479, 482, 480, 475,
+	483, 479, 481, 483, 482, 479, 484, 481, 461, 484, 461, 460, 485, 483, 481, 485,
+	481, 484, 486, 484, 460, 486, 460, 455, 487, 485, 484, 487, 484, 486, 488, 486,
+	455, 488, 455, 454, 489, 487, 486, 489, 486, 488, 490, 488, 454, 490, 454, 449,
+	491, 489, 488, 491, 488, 490, 492, 490, 449, 492, 449, 448, 493, 491, 490, 493,
+	490, 492, 494, 492, 448, 494, 448, 443, 495, 493, 492, 495, 492, 494, 496, 494,
+	443, 496, 443, 442, 497, 495, 494, 497, 494, 496, 498, 496, 442, 498, 442, 437,
+	499, 497, 496, 499, 496, 498, 500, 498, 437, 500, 437, 436, 501, 499, 498, 501,
+	498, 500, 502, 500, 436, 502, 436, 431, 503, 501, 500, 503, 500, 502, 504, 502,
+	431, 504, 431, 430, 505, 503, 502, 505, 502, 504, 506, 504, 430, 506, 430, 425,
+	507, 505, 504, 507, 504, 506, 508, 506, 425, 508, 425, 422, 419, 508, 422, 509,
+	506, 508, 509, 507, 506, 510, 508, 419, 510, 509, 508, 402, 510, 419, 395, 510,
+	402, 395, 511, 510, 511, 509, 510, 391, 511, 395, 512, 507, 509, 511, 512, 509,
+	391, 513, 511, 513, 512, 511, 390, 513, 391, 512, 514, 507, 514, 505, 507, 513,
+	515, 512, 515, 514, 512, 390, 516, 513, 516, 515, 513, 383, 516, 390, 514, 517,
+	505, 517, 503, 505, 383, 518, 516, 379, 518, 383, 516, 519, 515, 518, 519, 516,
+	515, 520, 514, 519, 520, 515, 520, 517, 514, 379, 521, 518, 378, 521, 379, 518,
+	522, 519, 521, 522, 518, 519, 523, 520, 522, 523, 519, 378, 524, 521, 371, 524,
+	378, 521, 525, 522, 524, 525, 521, 371, 526, 524, 367, 526, 371, 524, 527, 525,
+	526, 527, 524, 525, 528, 522, 522, 528, 523, 367, 529, 526, 366, 529, 367, 526,
+	530, 527, 529, 530, 526, 527, 531, 525, 525, 531, 528, 366, 532, 529, 359, 532,
+	366, 529, 533, 530, 532, 533, 529, 530, 534, 527, 527, 534, 531, 359, 535, 532,
+	355, 535, 359, 532, 536, 533, 535, 536, 532, 533, 537, 530, 530, 537, 534, 355,
+	538, 535, 354, 538, 355, 535, 539, 536, 538, 539, 535, 536, 540, 533, 533, 540,
+	537, 354, 541, 538, 347, 541, 354, 538, 542, 539, 541, 542, 538, 539, 543, 536,
+	536, 543, 540, 347, 544, 541, 343, 544, 347, 541, 545, 542, 544, 545, 541, 542,
+	546, 539, 539, 546, 543, 343, 547, 544, 342, 547, 343, 544, 548, 545, 547, 548,
+	544, 545, 549, 542, 542, 549, 546, 342, 550, 547, 335, 550, 342, 547, 551, 548,
+	550, 551, 547, 548, 552, 545, 545, 552, 549, 335, 553, 550, 331, 553, 335, 550,
+	554, 551, 553, 554, 550, 551, 555, 548, 548, 555, 552, 331, 556, 553, 330, 556,
+	331, 553, 557, 554, 556, 557, 553, 554, 558, 551, 551, 558, 555, 330, 559, 556,
+	320, 559, 330, 556, 560, 557, 559, 560, 556, 557, 561, 554, 554, 561, 558, 320,
+	562, 559, 313, 562, 320, 313, 310, 562, 562, 563, 559, 559, 563, 560, 310, 564,
+	562, 562, 564, 563, 310, 307, 564, 563, 565, 560, 307, 566, 564, 307, 304, 566,
+	564, 567, 563, 564, 566, 567, 563, 567, 565, 304, 568, 566, 304, 301, 568, 566,
+	569, 567, 566, 568, 569, 301, 570, 568, 301, 298, 570, 568, 571, 569, 568, 570,
+	571, 567, 569, 572, 567, 572, 565, 569, 571, 573, 569, 573, 572, 570, 574, 571,
+	298, 575, 570, 570, 575, 574, 298, 295, 575, 571, 574, 576, 571, 576, 573, 295,
+	577, 575, 295, 292, 577, 575, 578, 574, 575, 577, 578, 292, 579, 577, 292, 289,
+	579, 577, 580, 578, 577, 579, 580, 574, 578, 581, 574, 581, 576, 578, 580, 582,
+	578, 582, 581, 579, 583, 580, 289, 584, 579, 579, 584, 583, 289, 286, 584, 580,
+	583, 585, 580, 585, 582, 286, 586, 584, 286, 283, 586, 584, 587, 583, 584, 586,
+	587, 283, 588, 586, 283, 280, 588, 586, 589, 587, 586, 588, 589, 583, 587, 590,
+	583, 590, 585, 587, 589, 591, 587, 591, 590, 588, 592, 589, 280, 593, 588, 588,
+	593, 592, 280, 277, 593, 589, 592, 594, 589, 594, 591, 277, 595, 593, 277, 274,
+	595, 593, 596, 592, 593, 595, 596, 274, 597, 595, 274, 271, 597, 595, 598, 596,
+	595, 597, 598, 592, 596, 599, 592, 599, 594, 596, 598, 600, 596, 600, 599, 597,
+	601, 598, 271, 602, 597, 597, 602, 601, 271, 268, 602, 598, 601, 603, 598, 603,
+	600, 268, 604, 602, 268, 265, 604, 602, 605, 601, 602, 604, 605, 265, 606, 604,
+	265, 262, 606, 604, 607, 605, 604, 606, 607, 601, 605, 608, 601, 608, 603, 605,
+	607, 609, 605, 609, 608, 606, 610, 607, 262, 611, 606, 606, 611, 610, 262, 258,
+	611, 607, 610, 612, 607, 612, 609, 258, 613, 611, 258, 255, 613, 255, 259, 613,
+	611, 614, 610, 611, 613, 614, 613, 259, 615, 613, 615, 614, 610, 614, 616, 610,
+	616, 612, 614, 615, 617, 614, 617, 616, 259, 618, 615, 259, 252, 618, 615, 619,
+	617, 615, 618, 619, 252, 620, 618, 252, 248, 620, 248, 244, 620, 618, 620, 621,
+	618, 621, 619, 620, 244, 622, 620, 622, 621, 244, 213, 622, 622, 213, 212, 622,
+	212, 623, 621, 622, 623, 623, 212, 205, 621, 623, 624, 619, 621, 624, 623, 205,
+	625, 624, 623, 625, 625, 205, 204, 619, 624, 626, 617, 619, 626, 624, 625, 627,
+	626, 624, 627, 625, 204, 628, 627, 625, 628, 628, 204, 197, 617, 626, 629, 616,
+	617, 629, 626, 627, 630, 629, 626, 630, 627, 628, 631, 630, 627, 631, 628, 197,
+	632, 631, 628, 632, 632, 197, 196, 630, 631, 633, 632, 196, 634, 634, 196, 189,
+	631, 632, 635, 635, 632, 634, 633, 631, 635, 634, 189, 636, 636, 189, 188, 635,
+	634, 637, 637, 634, 636, 633, 635, 638, 638, 635, 637, 636, 188, 639, 639, 188,
+	181, 637, 636, 640, 640, 636, 639, 638, 637, 641, 641, 637, 640, 639, 181, 642,
+	642, 181, 180, 640, 639, 643, 643, 639, 642, 641, 640, 644, 644, 640, 643, 642,
+	180, 645, 645, 180, 173, 643, 642, 646, 646, 642, 645, 644, 643, 647, 647, 643,
+	646, 645, 173, 648, 648, 173, 172, 646, 645, 649, 649, 645, 648, 647, 646, 650,
+	650, 646, 649, 648, 172, 651, 651, 172, 165, 649, 648, 652, 652, 648, 651, 650,
+	649, 653, 653, 649, 652, 651, 165, 654, 654, 165, 164, 652, 651, 655, 655, 651,
+	654, 653, 652, 656, 656, 652, 655, 654, 164, 657, 657, 164, 157, 655, 654, 658,
+	658, 654, 657, 656, 655, 659, 659, 655, 658, 657, 157, 660, 660, 157, 156, 658,
+	657, 661, 661, 657, 660, 659, 658, 662, 662, 658, 661, 660, 156, 663, 663, 156,
+	149, 661, 660, 664, 664, 660, 663, 662, 661, 665, 665, 661, 664, 663, 149, 666,
+	666, 149, 148, 664, 663, 667, 667, 663, 666, 665, 664, 668, 668, 664, 667, 666,
+	148, 669, 669, 148, 141, 667, 666, 670, 670, 666, 669, 668, 667, 671, 671, 667,
+	670, 669, 141, 672, 672, 141, 140, 670, 669, 673, 673, 669, 672, 671, 670, 674,
+	674, 670, 673, 672, 140, 675, 675, 140, 133, 673, 672, 676, 676, 672, 675, 674,
+	673, 677, 677, 673, 676, 675, 133, 678, 678, 133, 132, 676, 675, 679, 679, 675,
+	678, 677, 676, 680, 680, 676, 679, 678, 132, 681, 681, 132, 122, 679, 678, 682,
+	682, 678, 681, 680, 679, 683, 683, 679, 682, 681, 122, 684, 684, 122, 115, 684,
+	115, 110, 112, 684, 110, 685, 681, 684, 685, 684, 112, 682, 681, 685, 470, 685,
+	112, 474, 685, 470, 474, 682, 685, 683, 682, 474, 476, 683, 474, 686, 683, 476,
+	686, 680, 683, 478, 686, 476, 687, 680, 686, 687, 677, 680, 688, 686, 478, 688,
+	687, 686, 689, 677, 687, 689, 674, 677, 690, 687, 688, 690, 689, 687, 691, 688,
+	478, 691, 478, 477, 480, 691, 477, 692, 688, 691, 692, 690, 688, 693, 691, 480,
+	693, 692, 691, 694, 693, 480, 694, 480, 482, 695, 692, 693, 696, 694, 482, 696,
+	482, 483, 697, 693, 694, 697, 695, 693, 698, 694, 696, 698, 697, 694, 699, 696,
+	483, 699, 483, 485, 700, 698, 696, 700, 696, 699, 701, 699, 485, 701, 485, 487,
+	702, 700, 699, 702, 699, 701, 703, 701, 487, 703, 487, 489, 704, 702, 701, 704,
+	701, 703, 705, 703, 489, 705, 489, 491, 706, 704, 703, 706, 703, 705, 707, 705,
+	491, 707, 491, 493, 708, 706, 705, 708, 705, 707, 709, 707, 493, 709, 493, 495,
+	710, 708, 707, 710, 707, 709, 711, 709, 495, 711, 495, 497, 712, 710, 709, 712,
+	709, 711, 713, 711, 497, 713, 497, 499, 714, 712, 711, 714, 711, 713, 715, 713,
+	499, 715, 499, 501, 716, 714, 713, 716, 713, 715, 717, 715, 501, 717, 501, 503,
+	517, 717, 503, 718, 715, 717, 718, 716, 715, 719, 717, 517, 719, 718, 717, 520,
+	719, 517, 523, 719, 520, 523, 720, 719, 720, 718, 719, 528, 720, 523, 721, 716,
+	718, 720, 721, 718, 528, 722, 720, 722, 721, 720, 531, 722, 528, 721, 723, 716,
+	723, 714, 716, 722, 724, 721, 724, 723, 721, 531, 725, 722, 725, 724, 722, 534,
+	725, 531, 723, 726, 714, 726, 712, 714, 534, 727, 725, 537, 727, 534, 725, 728,
+	724, 727, 728, 725, 724, 729, 723, 728, 729, 724, 729, 726, 723, 537, 730, 727,
+	540, 730, 537, 727, 731, 728, 730, 731, 727, 728, 732, 729, 731, 732, 728, 540,
+	733, 730, 543, 733, 540, 730, 734, 731, 733, 734, 730, 543, 735, 733, 546, 735,
+	543, 733, 736, 734, 735, 736, 733, 734, 737, 731, 731, 737, 732, 546, 738, 735,
+	549, 738, 546, 735, 739, 736, 738, 739, 735, 736, 740, 734, 734, 740, 737, 549,
+	741, 738, 552, 741, 549, 738, 742, 739, 741, 742, 738, 739, 743, 736, 736, 743,
+	740, 552, 744, 741, 555, 744, 552, 741, 745, 742, 744, 745, 741, 742, 746, 739,
+	739, 746, 743, 555, 747, 744, 558, 747, 555, 744, 748, 745, 747, 748, 744, 745,
+	749, 742, 742, 749, 746, 558, 750, 747, 561, 750, 558, 747, 751, 748, 750, 751,
+	747, 748, 752, 745, 745, 752, 749, 751, 753, 748, 748, 753, 752, 750, 754, 751,
+	751, 755, 753, 754, 755, 751, 561, 756, 750, 756, 754, 750, 757, 756, 561, 557,
+	757, 561, 560, 757, 557, 560, 565, 757, 565, 758, 757, 757, 758, 756, 565, 572,
+	758, 756, 759, 754, 758, 759, 756, 572, 760, 758, 758, 760, 759, 572, 573, 760,
+	759, 761, 754, 754, 761, 755, 760, 762, 759, 759, 762, 761, 573, 763, 760, 760,
+	763, 762, 573, 576, 763, 762, 764, 761, 576, 765, 763, 576, 581, 765, 763, 766,
+	762, 763, 765, 766, 762, 766, 764, 581, 767, 765, 581, 582, 767, 765, 768, 766,
+	765, 767, 768, 582, 769, 767, 582, 585, 769, 767, 770, 768, 767, 769, 770, 766,
+	768, 771, 766, 771, 764, 768, 770, 772, 768, 772, 771, 769, 773, 770, 585, 774,
+	769, 769, 774, 773, 585, 590, 774, 770, 773, 775, 770, 775, 772, 590, 776, 774,
+	590, 591, 776, 774, 777, 773, 774, 776, 777, 591, 778, 776, 591, 594, 778, 776,
+	779, 777, 776, 778, 779, 773, 777, 780, 773, 780, 775, 777, 779, 781, 777, 781,
+	780, 778, 782, 779, 594, 783, 778, 778, 783, 782, 594, 599, 783, 779, 782, 784,
+	779, 784, 781, 599, 785, 783, 599, 600, 785, 783, 786, 782, 783, 785, 786, 600,
+	787, 785, 600, 603, 787, 785, 788, 786, 785, 787, 788, 782, 786, 789, 782, 789,
+	784, 786, 788, 790, 786, 790, 789, 787, 791, 788, 603, 792, 787, 787, 792, 791,
+	603, 608, 792, 788, 791, 793, 788, 793, 790, 608, 794, 792, 608, 609, 794, 792,
+	795, 791, 792, 794, 795, 609, 796, 794, 609, 612, 796, 794, 797, 795, 794, 796,
+	797, 791, 795, 798, 791, 798, 793, 795, 797, 799, 795, 799, 798, 796, 800, 797,
+	612, 801, 796, 796, 801, 800, 612, 616, 801, 616, 629, 801, 801, 629, 802, 801,
+	802, 800, 629, 630, 802, 802, 630, 633, 802, 633, 803, 800, 802, 803, 803, 633,
+	638, 797, 800, 804, 800, 803, 804, 797, 804, 799, 803, 638, 805, 804, 803, 805,
+	805, 638, 641, 799, 804, 806, 804, 805, 806, 805, 641, 807, 806, 805, 807, 807,
+	641, 644, 799, 806, 808, 798, 799, 808, 806, 807, 809, 808, 806, 809, 807, 644,
+	810, 809, 807, 810, 810, 644, 647, 798, 808, 811, 793, 798, 811, 808, 809, 812,
+	811, 808, 812, 809, 810, 813, 812, 809, 813, 810, 647, 814, 813, 810, 814, 814,
+	647, 650, 812, 813, 815, 814, 650, 816, 816, 650, 653, 813, 814, 817, 817, 814,
+	816, 815, 813, 817, 816, 653, 818, 818, 653, 656, 817, 816, 819, 819, 816, 818,
+	815, 817, 820, 820, 817, 819, 818, 656, 821, 821, 656, 659, 819, 818, 822, 822,
+	818, 821, 820, 819, 823, 823, 819, 822, 821, 659, 824, 824, 659, 662, 822, 821,
+	825, 825, 821, 824, 823, 822, 826, 826, 822, 825, 824, 662, 827, 827, 662, 665,
+	825, 824, 828, 828, 824, 827, 826, 825, 829, 829, 825, 828, 827, 665, 830, 830,
+	665, 668, 828, 827, 831, 831, 827, 830, 829, 828, 832, 832, 828, 831, 830, 668,
+	833, 833, 668, 671, 831, 830, 834, 834, 830, 833, 832, 831, 835, 835, 831, 834,
+	833, 671, 836, 836, 671, 674, 836, 674, 689, 834, 833, 837, 837, 833, 836, 838,
+	836, 689, 837, 836, 838, 838, 689, 690, 839, 834, 837, 835, 834, 839, 840, 837,
+	838, 839, 837, 840, 841, 838, 690, 840, 838, 841, 841, 690, 692, 695, 841, 692,
+	842, 840, 841, 842, 841, 695, 843, 839, 840, 843, 840, 842, 844, 835, 839, 844,
+	839, 843, 845, 842, 695, 845, 695, 697, 846, 843, 842, 846, 842, 845, 847, 844,
+	843, 847, 843, 846, 848, 835, 844, 848, 832, 835, 849, 844, 847, 849, 848, 844,
+	850, 832, 848, 850, 829, 832, 851, 848, 849, 851, 850, 848, 852, 829, 850, 852,
+	826, 829, 853, 850, 851, 853, 852, 850, 854, 826, 852, 854, 823, 826, 855, 852,
+	853, 855, 854, 852, 856, 823, 854, 856, 820, 823, 857, 854, 855, 857, 856, 854,
+	858, 820, 856, 858, 815, 820, 859, 856, 857, 859, 858, 856, 860, 815, 858, 860,
+	812, 815, 811, 812, 860, 861, 860, 858, 861, 858, 859, 862, 811, 860, 862, 860,
+	861, 793, 811, 862, 790, 793, 862, 790, 862, 863, 863, 862, 861, 789, 790, 863,
+	863, 861, 864, 864, 861, 859, 789, 863, 865, 865, 863, 864, 784, 789, 865, 864,
+	859, 866, 866, 859, 857, 865, 864, 867, 867, 864, 866, 784, 865, 868, 868, 865,
+	867, 781, 784, 868, 866, 857, 869, 869, 857, 855, 781, 868, 870, 780, 781, 870,
+	868, 867, 871, 870, 868, 871, 867, 866, 872, 871, 867, 872, 872, 866, 869, 780,
+	870, 873, 775, 780, 873, 870, 871, 874, 873, 870, 874, 871, 872, 875, 874, 871,
+	875, 775, 873, 876, 772, 775, 876, 873, 874, 877, 876, 873, 877, 772, 876, 878,
+	771, 772, 878, 876, 877, 879, 878, 876, 879, 877, 874, 880, 874, 875, 880, 771,
+	878, 881, 764, 771, 881, 881, 878, 882, 878, 879, 882, 764, 881, 883, 761, 764,
+	883, 761, 883, 755, 883, 881, 884, 881, 882, 884, 755, 883, 885, 883, 884, 885,
+	755, 885, 753, 884, 882, 886, 753, 885, 887, 753, 887, 752, 885, 884, 888, 885,
+	888, 887, 884, 886, 888, 752, 887, 889, 752, 889, 749, 887, 888, 890, 887, 890,
+	889, 749, 889, 891, 749, 891, 746, 889, 890, 892, 889, 892, 891, 888, 893, 890,
+	888, 886, 893, 890, 894, 892, 890, 893, 894, 891, 892, 895, 746, 891, 896, 891,
+	895, 896, 746, 896, 743, 892, 897, 895, 892, 894, 897, 743, 896, 898, 743, 898,
+	740, 896, 895, 899, 896, 899, 898, 740, 898, 900, 740, 900, 737, 898, 899, 901,
+	898, 901, 900, 895, 902, 899, 895, 897, 902, 899, 903, 901, 899, 902, 903, 900,
+	901, 904, 737, 900, 905, 900, 904, 905, 737, 905, 732, 901, 906, 904, 901, 903,
+	906, 732, 905, 907, 732, 907, 729, 729, 907, 726, 905, 904, 908, 905, 908, 907,
+	907, 909, 726, 907, 908, 909, 726, 909, 712, 909, 710, 712, 909, 910, 710, 908,
+	910, 909, 910, 708, 710, 904, 911, 908, 908, 911, 910, 904, 906, 911, 910, 912,
+	708, 911, 912, 910, 912, 706, 708, 906, 913, 911, 911, 913, 912, 912, 914, 706,
+	913, 914, 912, 914, 704, 706, 906, 915, 913, 903, 915, 906, 913, 916, 914, 915,
+	916, 913, 914, 917, 704, 916, 917, 914, 917, 702, 704, 903, 918, 915, 902, 918,
+	903, 917, 919, 702, 919, 700, 702, 916, 920, 917, 920, 919, 917, 915, 921, 916,
+	921, 920, 916, 918, 921, 915, 919, 922, 700, 922, 698, 700, 920, 923, 919, 923,
+	922, 919, 921, 924, 920, 924, 923, 920, 922, 925, 698, 925, 697, 698, 925, 845,
+	697, 923, 926, 922, 926, 925, 922, 927, 845, 925, 926, 927, 925, 927, 846, 845,
+	928, 926, 923, 924, 928, 923, 929, 927, 926, 928, 929, 926, 930, 846, 927, 929,
+	930, 927, 930, 847, 846, 931, 929, 928, 932, 847, 930, 932, 849, 847, 933, 930,
+	929, 933, 932, 930, 931, 933, 929, 934, 849, 932, 934, 851, 849, 935, 932, 933,
+	935, 934, 932, 936, 851, 934, 936, 853, 851, 937, 934, 935, 937, 936, 934, 938,
+	935, 933, 938, 933, 931, 939, 937, 935, 939, 935, 938, 940, 853, 936, 940, 855,
+	853, 869, 855, 940, 941, 936, 937, 941, 940, 936, 942, 869, 940, 942, 940, 941,
+	872, 869, 942, 875, 872, 942, 875, 942, 943, 943, 942, 941, 880, 875, 943, 944,
+	941, 937, 943, 941, 944, 944, 937, 939, 880, 943, 945, 945, 943, 944, 946, 944,
+	939, 945, 944, 946, 947, 880, 945, 877, 880, 947, 879, 877, 947, 947, 945, 948,
+	948, 945, 946, 879, 947, 949, 949, 947, 948, 882, 879, 949, 882, 949, 886, 886,
+	949, 950, 949, 948, 950, 886, 950, 893, 950, 948, 951, 948, 946, 951, 893, 950,
+	952, 950, 951, 952, 893, 952, 894, 951, 946, 953, 946, 939, 953, 953, 939, 938,
+	952, 951, 954, 951, 953, 954, 894, 952, 955, 952, 954, 955, 894, 955, 897, 953,
+	938, 956, 954, 953, 956, 956, 938, 931, 955, 954, 957, 954, 956, 957, 897, 955,
+	958, 955, 957, 958, 897, 958, 902, 902, 958, 918, 956, 931, 959, 957, 956, 959,
+	959, 931, 928, 959, 928, 924, 958, 957, 960, 957, 959, 960, 958, 960, 918, 960,
+	959, 924, 918, 960, 921, 960, 924, 921,
+	// wall grid
+	0, 1, 2, 0, 3, 1, 4, 3, 0, 3, 5, 1, 4, 6, 3, 7,
+	6, 4, 3, 8, 5, 6, 8, 3, 8, 9, 5, 7, 10, 6, 11, 10,
+	7, 6, 12, 8, 10, 12, 6, 8, 13, 9, 12, 13, 8, 13, 14, 9,
+	11, 15, 10, 16, 15, 11, 13, 17, 14, 17, 18, 14, 12, 19, 13, 19,
+	17, 13, 10, 20, 12, 20, 19, 12, 15, 20, 10, 17, 21, 18, 21, 22,
+	18, 19, 23, 17, 23, 21, 17, 20, 24, 19, 24, 23, 19, 21, 25, 22,
+	25, 26, 22, 23, 27, 21, 27, 25, 21, 25, 28, 26, 28, 29, 26, 27,
+	30, 25, 30, 28, 25, 31, 27, 23, 24, 31, 23, 32, 30, 27, 31, 32,
+	27, 28, 33, 29, 33, 34, 29, 30, 35, 28, 35, 33, 28, 33, 36, 34,
+	36, 37, 34, 35, 38, 33, 38, 36, 33, 39, 35, 30, 32, 39, 30, 40,
+	38, 35, 39, 40, 35, 36, 41, 37, 41, 42, 37, 38, 43, 36, 43, 41,
+	36, 41, 44, 42, 44, 45, 42, 43, 46, 41, 46, 44, 41, 47, 43, 38,
+	40, 47, 38, 48, 46, 43, 47, 48, 43, 44, 49, 45, 49, 50, 45, 46,
+	51, 44, 51, 49, 44, 49, 52, 50, 52, 53, 50, 51, 54, 49, 54, 52,
+	49, 55, 51, 46, 48, 55, 46, 56, 54, 51, 55, 56, 51, 52, 57, 53,
+	57, 58, 53, 54, 59, 52, 59, 57, 52, 57, 60, 58, 60, 61, 58, 59,
+	62, 57, 62, 60, 57, 63, 59, 54, 56, 63, 54, 64, 62, 59, 63, 64,
+	59, 60, 65, 61, 65, 66, 61, 62, 67, 60, 67, 65, 60, 65, 68, 66,
+	68, 69, 66, 67, 70, 65, 70, 68, 65, 71, 67, 62, 64, 71, 62, 72,
+	70, 67, 71, 72, 67, 68, 73, 69, 73, 74, 69, 70, 75, 68, 75, 73,
+	68, 73, 76, 74, 76, 77, 74, 75, 78, 73, 78, 76, 73, 79, 75, 70,
+	72, 79, 70, 80, 78, 75, 79, 80, 75, 76, 81, 77, 81, 82, 77, 78,
+	83, 76, 83, 81, 76, 81, 84, 82, 84, 85, 82, 83, 86, 81, 86, 84,
+	81, 87, 83, 78, 80, 87, 78, 88, 86, 83, 87, 88, 83, 84, 89, 85,
+	89, 90, 85, 86, 91, 84, 91, 89, 84, 89, 92, 90, 92, 93, 90, 91,
+	94, 89, 94, 92, 89, 95, 91, 86, 88, 95, 86, 96, 94, 91, 95, 96,
+	91, 92, 97, 93, 97, 98, 93, 94, 99, 92, 99, 97, 92, 97, 100, 98,
+	100, 101, 98, 99, 102, 97, 102, 100, 97, 103, 99, 94, 96, 103, 94, 104,
+	102, 99, 103, 104, 99, 100, 105, 101, 105, 106, 101, 102, 107, 100, 107, 105,
+	100, 105, 108, 106, 108, 109, 106, 107, 110, 105, 110, 108, 105, 111, 107, 102,
+	104, 111, 102, 112, 110, 107, 111, 112, 107, 108, 113, 109, 113, 114, 109, 110,
+	115, 108, 115, 113, 108, 113, 116, 114, 116, 117, 114, 116, 118, 117, 119, 116,
+	113, 115, 119, 113, 120, 118, 116, 119, 120, 116, 120, 121, 118, 122, 119, 115,
+	123, 121, 120, 123, 124, 121, 125, 120, 119, 125, 123, 120, 122, 125, 119, 126,
+	124, 123, 126, 127, 124, 128, 123, 125, 128, 126, 123, 129, 127, 126, 129, 130,
+	127, 131, 126, 128, 131, 129, 126, 132, 128, 125, 132, 125, 122, 133, 131, 128,
+	133, 128, 132, 134, 130, 129, 134, 135, 130, 136, 129, 131, 136, 134, 129, 137,
+	135, 134, 137, 138, 135, 139, 134, 136, 139, 137, 134, 140, 136, 131, 140, 131,
+	133, 141, 139, 136, 141, 136, 140, 142, 138, 137, 142, 143, 138, 144, 137, 139,
+	144, 142, 137, 145, 143, 142, 145, 146, 143, 147, 142, 144, 147, 145, 142, 148,
+	144, 139, 148, 139, 141, 149, 147, 144, 149, 144, 148, 150, 146, 145, 150, 151,
+	146, 152, 145, 147, 152, 150, 145, 153, 151, 150, 153, 154, 151, 155, 150, 152,
+	155, 153, 150, 156, 152, 147, 156, 147, 149, 157, 155, 152, 157, 152, 156, 158,
+	154, 153, 158, 159, 154, 160, 153, 155, 160, 158, 153, 161, 159, 158, 161, 162,
+	159, 163, 158, 160, 163, 161, 158, 164, 160, 155, 164, 155, 157, 165, 163, 160,
+	165, 160, 164, 166, 162, 161, 166, 167, 162, 168, 161, 163, 168, 166, 161, 169,
+	167, 166, 169, 170, 167, 171, 166, 168, 171, 169, 166, 172, 168, 163, 172, 163,
+	165, 173, 171, 168, 173, 168, 172, 174, 170, 169, 174, 175, 170, 176, 169, 171,
+	176, 174, 169, 177, 175, 174, 177, 178, 175, 179, 174, 176, 179, 177, 174, 180,
+	176, 171, 180, 171, 173, 181, 179, 176, 181, 176, 180, 182, 178, 177, 182, 183,
+	178, 184, 177, 179, 184, 182, 177, 185, 183, 182, 185, 186, 183, 187, 182, 184,
+	187, 185, 182, 188, 184, 179, 188, 179, 181, 189, 187, 184, 189, 184, 188, 190,
+	186, 185, 190, 191, 186, 192, 185, 187, 192, 190, 185, 193, 191, 190, 193, 194,
+	191, 195, 190, 192, 195, 193, 190, 196, 192, 187, 196, 187, 189, 197, 195, 192,
+	197, 192, 196, 198, 194, 193, 198, 199, 194, 200, 193, 195, 200, 198, 193, 201,
+	199, 198, 201, 202, 199, 203, 198, 200, 203, 201, 198, 204, 200, 195, 204, 195,
+	197, 205, 203, 200, 205, 200, 204, 206, 202, 201, 206, 207, 202, 208, 201, 203,
+	208, 206, 201, 209, 207, 206, 209, 210, 207, 211, 206, 208, 211, 209, 206, 212,
+	208, 203, 212, 203, 205, 213, 211, 208, 213, 208, 212, 214, 210, 209, 214, 215,
+	210, 216, 209, 211, 216, 214, 209, 217, 215, 214, 217, 218, 215, 219, 214, 216,
+	219, 217, 214, 220, 216, 211, 220, 211, 213, 221, 219, 216, 221, 216, 220, 222,
+	218, 217, 222, 223, 218, 224, 217, 219, 224, 222, 217, 225, 223, 222, 225, 226,
+	223, 227, 228, 226, 227, 226, 225, 229, 227, 225, 230, 225, 222, 229, 225, 230,
+	230, 222, 224, 231, 229, 230, 231, 230, 232, 232, 230, 224, 233, 231, 232, 234,
+	224, 219, 232, 224, 234, 234, 219, 221, 233, 232, 235, 235, 232, 234, 236, 233,
+	235, 237, 234, 221, 235, 234, 237, 236, 235, 238, 238, 235, 237, 239, 236, 238,
+	237, 221, 240, 240, 221, 220, 238, 237, 241, 241, 237, 240, 239, 238, 242, 242,
+	238, 241, 243, 239, 242, 240, 220, 244, 244, 220, 213, 243, 242, 245, 246, 243,
+	245, 242, 241, 247, 245, 242, 247, 241, 240, 248, 247, 241, 248, 248, 240, 244,
+	246, 245, 249, 250, 246, 249, 245, 247, 251, 249, 245, 251, 247, 248, 252, 251,
+	247, 252, 250, 249, 253, 254, 250, 253, 249, 251, 255, 253, 249, 255, 254, 253,
+	256, 257, 254, 256, 253, 255, 258, 256, 253, 258, 255, 251, 259, 251, 252, 259,
+	257, 256, 260, 261, 257, 260, 260, 256, 262, 256, 258, 262, 261, 260, 263, 264,
+	261, 263, 260, 262, 265, 263, 260, 265, 264, 263, 266, 267, 264, 266, 263, 265,
+	268, 266, 263, 268, 267, 266, 269, 270, 267, 269, 266, 268, 271, 269, 266, 271,
+	270, 269, 272, 273, 270, 272, 269, 271, 274, 272, 269, 274, 273, 272, 275, 276,
+	273, 275, 272, 274, 277, 275, 272, 277, 276, 275, 278, 279, 276, 278, 275, 277,
+	280, 278, 275, 280, 279, 278, 281, 282, 279, 281, 278, 280, 283, 281, 278, 283,
+	282, 281, 284, 285, 282, 284, 281, 283, 286, 284, 281, 286, 285, 284, 287, 288,
+	285, 287, 284, 286, 289, 287, 284, 289, 288, 287, 290, 291, 288, 290, 287, 289,
+	292, 290, 287, 292, 291, 290, 293, 294, 291, 293, 290, 292, 295, 293, 290, 295,
+	294, 293, 296, 297, 294, 296, 293, 295, 298, 296, 293, 298, 297, 296, 299, 300,
+	297, 299, 296, 298, 301, 299, 296, 301, 300, 299, 302, 303, 300, 302, 299, 301,
+	304, 302, 299, 304, 303, 302, 305, 306, 303, 305, 302, 304, 307, 305, 302, 307,
+	306, 305, 308, 309, 306, 308, 305, 307, 310, 308, 305, 310, 309, 308, 311, 312,
+	309, 311, 308, 310, 313, 311, 308, 313, 312, 311, 314, 315, 312, 314, 315, 314,
+	316, 314, 311, 317, 311, 313, 317, 316, 314, 318, 314, 317, 318, 316, 318, 319,
+	317, 313, 320, 319, 318, 321, 319, 321, 322, 318, 317, 323, 318, 323, 321, 317,
+	320, 323, 322, 321, 324, 322, 324, 325, 321, 323, 326, 321, 326, 324, 325, 324,
+	327, 325, 327, 328, 324, 326, 329, 324, 329, 327, 323, 330, 326, 323, 320, 330,
+	326, 331, 329, 326, 330, 331, 327, 329, 332, 328, 327, 333, 327, 332, 333, 328,
+	333, 334, 329, 335, 332, 329, 331, 335, 334, 333, 336, 334, 336, 337, 333, 332,
+	338, 333, 338, 336, 337, 336, 339, 337, 339, 340, 336, 338, 341, 336, 341, 339,
+	332, 342, 338, 332, 335, 342, 338, 343, 341, 338, 342, 343, 339, 341, 344, 340,
+	339, 345, 339, 344, 345, 340, 345, 346, 341, 347, 344, 341, 343, 347, 346, 345,
+	348, 346, 348, 349, 345, 344, 350, 345, 350, 348, 349, 348, 351, 349, 351, 352,
+	348, 350, 353, 348, 353, 351, 344, 354, 350, 344, 347, 354, 350, 355, 353, 350,
+	354, 355, 351, 353, 356, 352, 351, 357, 351, 356, 357, 352, 357, 358, 353, 359,
+	356, 353, 355, 359, 358, 357, 360, 358, 360, 361, 357, 356, 362, 357, 362, 360,
+	361, 360, 363, 361, 363, 364, 360, 362, 365, 360, 365, 363, 356, 366, 362, 356,
+	359, 366, 362, 367, 365, 362, 366, 367, 363, 365, 368, 364, 363, 369, 363, 368,
+	369, 364, 369, 370, 365, 371, 368, 365, 367, 371, 370, 369, 372, 370, 372, 373,
+	369, 368, 374, 369, 374, 372, 373, 372, 375, 373, 375, 376, 372, 374, 377, 372,
+	377, 375, 368, 378, 374, 368, 371, 378, 374, 379, 377, 374, 378, 379, 375, 377,
+	380, 376, 375, 381, 375, 380, 381, 376, 381, 382, 377, 383, 380, 377, 379, 383,
+	382, 381, 384, 382, 384, 385, 381, 380, 386, 381, 386, 384, 385, 384, 387, 385,
+	387, 388, 384, 386, 389, 384, 389, 387, 380, 390, 386, 380, 383, 390, 386, 391,
+	389, 386, 390, 391, 387, 389, 392, 388, 387, 393, 387, 392, 393, 388, 393, 394,
+	389, 395, 392, 389, 391, 395, 394, 393, 396, 394, 396, 397, 393, 392, 398, 393,
+	398, 396, 397, 396, 399, 397, 399, 400, 396, 398, 401, 396, 401, 399, 392, 402,
+	398, 392, 395, 402, 398, 403, 401, 398, 402, 403, 399, 401, 404, 400, 399, 405,
+	399, 404, 405, 400, 405, 406, 401, 407, 404, 401, 403, 407, 406, 405, 408, 406,
+	408, 16, 16, 408, 15, 405, 404, 409, 405, 409, 408, 408, 410, 15, 408, 409,
+	410, 15, 410, 20, 410, 24, 20, 410, 411, 24, 409, 411, 410, 411, 31, 24,
+	404, 412, 409, 409, 412, 411, 404, 407, 412, 411, 413, 31, 412, 413, 411, 413,
+	32, 31, 407, 414, 412, 412, 414, 413, 413, 415, 32, 414, 415, 413, 415, 39,
+	32, 407, 416, 414, 403, 416, 407, 414, 417, 415, 416, 417, 414, 415, 418, 39,
+	417, 418, 415, 418, 40, 39, 403, 419, 416, 402, 419, 403, 418, 420, 40, 420,
+	47, 40, 417, 421, 418, 421, 420, 418, 416, 422, 417, 422, 421, 417, 419, 422,
+	416, 420, 423, 47, 423, 48, 47, 421, 424, 420, 424, 423, 420, 422, 425, 421,
+	425, 424, 421, 423, 426, 48, 426, 55, 48, 424, 427, 423, 427, 426, 423, 426,
+	428, 55, 428, 56, 55, 427, 429, 426, 429, 428, 426, 430, 427, 424, 425, 430,
+	424, 431, 429, 427, 430, 431, 427, 428, 432, 56, 432, 63, 56, 429, 433, 428,
+	433, 432, 428, 432, 434, 63, 434, 64, 63, 433, 435, 432, 435, 434, 432, 436,
+	433, 429, 431, 436, 429, 437, 435, 433, 436, 437, 433, 434, 438, 64, 438, 71,
+	64, 435, 439, 434, 439, 438, 434, 438, 440, 71, 440, 72, 71, 439, 441, 438,
+	441, 440, 438, 442, 439, 435, 437, 442, 435, 443, 441, 439, 442, 443, 439, 440,
+	444, 72, 444, 79, 72, 441, 445, 440, 445, 444, 440, 444, 446, 79, 446, 80,
+	79, 445, 447, 444, 447, 446, 444, 448, 445, 441, 443, 448, 441, 449, 447, 445,
+	448, 449, 445, 446, 450, 80, 450, 87, 80, 447, 451, 446, 451, 450, 446, 450,
+	452, 87, 452, 88, 87, 451, 453, 450, 453, 452, 450, 454, 451, 447, 449, 454,
+	447, 455, 453, 451, 454, 455, 451, 452, 456, 88, 456, 95, 88, 453, 457, 452,
+	457, 456, 452, 456, 458, 95, 458, 96, 95, 457, 459, 456, 459, 458, 456, 460,
+	457, 453, 455, 460, 453, 461, 459, 457, 460, 461, 457, 458, 462, 96, 462, 103,
+	96, 459, 463, 458, 463, 462, 458, 462, 464, 103, 464, 104, 103, 463, 465, 462,
+	465, 464, 462, 466, 463, 459, 461, 466, 459, 467, 465, 463, 466, 467, 463, 464,
+	468, 104, 468, 111, 104, 465, 469, 464, 469, 468, 464, 468, 470, 111, 470, 112,
+	111, 469, 471, 468, 471, 470, 468, 472, 469, 465, 467, 472, 465, 473, 471, 469,
+	472, 473, 469, 471, 474, 470, 475, 472, 467, 473, 476, 471, 476, 474, 471, 477,
+	473, 472, 475, 477, 472, 478, 476, 473, 477, 478, 473, 479, 475, 467, 479, 467,
+	466, 480, 477, 475, 481, 479, 466, 481, 466, 461, 482, 475, 479, 482, 480, 475,
+	483, 479, 481, 483, 482, 479, 484, 481, 461, 484, 461, 460, 485, 483, 481, 485,
+	481, 484, 486, 484, 460, 486, 460, 455, 487, 485, 484, 487, 484, 486, 488, 486,
+	455, 488, 455, 454, 489, 487, 486, 489, 486, 488, 490, 488, 454, 490, 454, 449,
+	491, 489, 488, 491, 488, 490, 492, 490, 449, 492, 449, 448, 493, 491, 490, 493,
+	490, 492, 494, 492, 448, 494, 448, 443, 495, 493, 492, 495, 492, 494, 496, 494,
+	443, 496, 443, 442, 497, 495, 494, 497, 494, 496, 498, 496, 442, 498, 442, 437,
+	499, 497, 496, 499, 496, 498, 500, 498, 437, 500, 437, 436, 501, 499, 498, 501,
+	498, 500, 502, 500, 436, 502, 436, 431, 503, 501, 500, 503, 500, 502, 504, 502,
+	431, 504, 431, 430, 505, 503, 502, 505, 502, 504, 506, 504, 430, 506, 430, 425,
+	507, 505, 504, 507, 504, 506, 508, 506, 425, 508, 425, 422, 419, 508, 422, 509,
+	506, 508, 509, 507, 506, 510, 508, 419, 510, 509, 508, 402, 510, 419, 395, 510,
+	402, 395, 511, 510, 511, 509, 510, 391, 511, 395, 512, 507, 509, 511, 512, 509,
+	391, 513, 511, 513, 512, 511, 390, 513, 391, 512, 514, 507, 514, 505, 507, 513,
+	515, 512, 515, 514, 512, 390, 516, 513, 516, 515, 513, 383, 516, 390, 514, 517,
+	505, 517, 503, 505, 383, 518, 516, 379, 518, 383, 516, 519, 515, 518, 519, 516,
+	515, 520, 514, 519, 520, 515, 520, 517, 514, 379, 521, 518, 378, 521, 379, 518,
+	522, 519, 521, 522, 518, 519, 523, 520, 522, 523, 519, 378, 524, 521, 371, 524,
+	378, 521, 525, 522, 524, 525, 521, 371, 526, 524, 367, 526, 371, 524, 527, 525,
+	526, 527, 524, 525, 528, 522, 522, 528, 523, 367, 529, 526, 366, 529, 367, 526,
+	530, 527, 529, 530, 526, 527, 531, 525, 525, 531, 528, 366, 532, 529, 359, 532,
+	366, 529, 533, 530, 532, 533, 529, 530, 534, 527, 527, 534, 531, 359, 535, 532,
+	355, 535, 359, 532, 536, 533, 535, 536, 532, 533, 537, 530, 530, 537, 534, 355,
+	538, 535, 354, 538, 355, 535, 539, 536, 538, 539, 535, 536, 540, 533, 533, 540,
+	537, 354, 541, 538, 347, 541, 354, 538, 542, 539, 541, 542, 538, 539, 543, 536,
+	536, 543, 540, 347, 544, 541, 343, 544, 347, 541, 545, 542, 544, 545, 541, 542,
+	546, 539, 539, 546, 543, 343, 547, 544, 342, 547, 343, 544, 548, 545, 547, 548,
+	544, 545, 549, 542, 542, 549, 546, 342, 550, 547, 335, 550, 342, 547, 551, 548,
+	550, 551, 547, 548, 552, 545, 545, 552, 549, 335, 553, 550, 331, 553, 335, 550,
+	554, 551, 553, 554, 550, 551, 555, 548, 548, 555, 552, 331, 556, 553, 330, 556,
+	331, 553, 557, 554, 556, 557, 553, 554, 558, 551, 551, 558, 555, 330, 559, 556,
+	320, 559, 330, 556, 560, 557, 559, 560, 556, 557, 561, 554, 554, 561, 558, 320,
+	562, 559, 313, 562, 320, 313, 310, 562, 562, 563, 559, 559, 563, 560, 310, 564,
+	562, 562, 564, 563, 310, 307, 564, 563, 565, 560, 307, 566, 564, 307, 304, 566,
+	564, 567, 563, 564, 566, 567, 563, 567, 565, 304, 568, 566, 304, 301, 568, 566,
+	569, 567, 566, 568, 569, 301, 570, 568, 301, 298, 570, 568, 571, 569, 568, 570,
+	571, 567, 569, 572, 567, 572, 565, 569, 571, 573, 569, 573, 572, 570, 574, 571,
+	298, 575, 570, 570, 575, 574, 298, 295, 575, 571, 574, 576, 571, 576, 573, 295,
+	577, 575, 295, 292, 577, 575, 578, 574, 575, 577, 578, 292, 579, 577, 292, 289,
+	579, 577, 580, 578, 577, 579, 580, 574, 578, 581, 574, 581, 576, 578, 580, 582,
+	578, 582, 581, 579, 583, 580, 289, 584, 579, 579, 584, 583, 289, 286, 584, 580,
+	583, 585, 580, 585, 582, 286, 586, 584, 286, 283, 586, 584, 587, 583, 584, 586,
+	587, 283, 588, 586, 283, 280, 588, 586, 589, 587, 586, 588, 589, 583, 587, 590,
+	583, 590, 585, 587, 589, 591, 587, 591, 590, 588, 592, 589, 280, 593, 588, 588,
+	593, 592, 280, 277, 593, 589, 592, 594, 589, 594, 591, 277, 595, 593, 277, 274,
+	595, 593, 596, 592, 593, 595, 596, 274, 597, 595, 274, 271, 597, 595, 598, 596,
+	595, 597, 598, 592, 596, 599, 592, 599, 594, 596, 598, 600, 596, 600, 599, 597,
+	601, 598, 271, 602, 597, 597, 602, 601, 271, 268, 602, 598, 601, 603, 598, 603,
+	600, 268, 604, 602, 268, 265, 604, 602, 605, 601, 602, 604, 605, 265, 606, 604,
+	265, 262, 606, 604, 607, 605, 604, 606, 607, 601, 605, 608, 601, 608, 603, 605,
+	607, 609, 605, 609, 608, 606, 610, 607, 262, 611, 606, 606, 611, 610, 262, 258,
+	611, 607, 610, 612, 607, 612, 609, 258, 613, 611, 258, 255, 613, 255, 259, 613,
+	611, 614, 610, 611, 613, 614, 613, 259, 615, 613, 615, 614, 610, 614, 616, 610,
+	616, 612, 614, 615, 617, 614, 617, 616, 259, 618, 615, 259, 252, 618, 615, 619,
+	617, 615, 618, 619, 252, 620, 618, 252, 248, 620, 248, 244, 620, 618, 620, 621,
+	618, 621, 619, 620, 244, 622, 620, 622, 621, 244, 213, 622, 622, 213, 212, 622,
+	212, 623, 621, 622, 623, 623, 212, 205, 621, 623, 624, 619, 621, 624, 623, 205,
+	625, 624, 623, 625, 625, 205, 204, 619, 624, 626, 617, 619, 626, 624, 625, 627,
+	626, 624, 627, 625, 204, 628, 627, 625, 628, 628, 204, 197, 617, 626, 629, 616,
+	617, 629, 626, 627, 630, 629, 626, 630, 627, 628, 631, 630, 627, 631, 628, 197,
+	632, 631, 628, 632, 632, 197, 196, 630, 631, 633, 632, 196, 634, 634, 196, 189,
+	631, 632, 635, 635, 632, 634, 633, 631, 635, 634, 189, 636, 636, 189, 188, 635,
+	634, 637, 637, 634, 636, 633, 635, 638, 638, 635, 637, 636, 188, 639, 639, 188,
+	181, 637, 636, 640, 640, 636, 639, 638, 637, 641, 641, 637, 640, 639, 181, 642,
+	642, 181, 180, 640, 639, 643, 643, 639, 642, 641, 640, 644, 644, 640, 643, 642,
+	180, 645, 645, 180, 173, 643, 642, 646, 646, 642, 645, 644, 643, 647, 647, 643,
+	646, 645, 173, 648, 648, 173, 172, 646, 645, 649, 649, 645, 648, 647, 646, 650,
+	650, 646, 649, 648, 172, 651, 651, 172, 165, 649, 648, 652, 652, 648, 651, 650,
+	649, 653, 653, 649, 652, 651, 165, 654, 654, 165, 164, 652, 651, 655, 655, 651,
+	654, 653, 652, 656, 656, 652, 655, 654, 164, 657, 657, 164, 157, 655, 654, 658,
+	658, 654, 657, 656, 655, 659, 659, 655, 658, 657, 157, 660, 660, 157, 156, 658,
+	657, 661, 661, 657, 660, 659, 658, 662, 662, 658, 661, 660, 156, 663, 663, 156,
+	149, 661, 660, 664, 664, 660, 663, 662, 661, 665, 665, 661, 664, 663, 149, 666,
+	666, 149, 148, 664, 663, 667, 667, 663, 666, 665, 664, 668, 668, 664, 667, 666,
+	148, 669, 669, 148, 141, 667, 666, 670, 670, 666, 669, 668, 667, 671, 671, 667,
+	670, 669, 141, 672, 672, 141, 140, 670, 669, 673, 673, 669, 672, 671, 670, 674,
+	674, 670, 673, 672, 140, 675, 675, 140, 133, 673, 672, 676, 676, 672, 675, 674,
+	673, 677, 677, 673, 676, 675, 133, 678, 678, 133, 132, 676, 675, 679, 679, 675,
+	678, 677, 676, 680, 680, 676, 679, 678, 132, 681, 681, 132, 122, 679, 678, 682,
+	682, 678, 681, 680, 679, 683, 683, 679, 682, 681, 122, 684, 684, 122, 115, 684,
+	115, 110, 112, 684, 110, 685, 681, 684, 685, 684, 112, 682, 681, 685, 470, 685,
+	112, 474, 685, 470, 474, 682, 685, 683, 682, 474, 476, 683, 474, 686, 683, 476,
+	686, 680, 683, 478, 686, 476, 687, 680, 686, 687, 677, 680, 688, 686, 478, 688,
+	687, 686, 689, 677, 687, 689, 674, 677, 690, 687, 688, 690, 689, 687, 691, 688,
+	478, 691, 478, 477, 480, 691, 477, 692, 688, 691, 692, 690, 688, 693, 691, 480,
+	693, 692, 691, 694, 693, 480, 694, 480, 482, 695, 692, 693, 696, 694, 482, 696,
+	482, 483, 697, 693, 694, 697, 695, 693, 698, 694, 696, 698, 697, 694, 699, 696,
+	483, 699, 483, 485, 700, 698, 696, 700, 696, 699, 701, 699, 485, 701, 485, 487,
+	702, 700, 699, 702, 699, 701, 703, 701, 487, 703, 487, 489, 704, 702, 701, 704,
+	701, 703, 705, 703, 489, 705, 489, 491, 706, 704, 703, 706, 703, 705, 707, 705,
+	491, 707, 491, 493, 708, 706, 705, 708, 705, 707, 709, 707, 493, 709, 493, 495,
+	710, 708, 707, 710, 707, 709, 711, 709, 495, 711, 495, 497, 712, 710, 709, 712,
+	709, 711, 713, 711, 497, 713, 497, 499, 714, 712, 711, 714, 711, 713, 715, 713,
+	499, 715, 499, 501, 716, 714, 713, 716, 713, 715, 717, 715, 501, 717, 501, 503,
+	517, 717, 503, 718, 715, 717, 718, 716, 715, 719, 717, 517, 719, 718, 717, 520,
+	719, 517, 523, 719, 520, 523, 720, 719, 720, 718, 719, 528, 720, 523, 721, 716,
+	718, 720, 721, 718, 528, 722, 720, 722, 721, 720, 531, 722, 528, 721, 723, 716,
+	723, 714, 716, 722, 724, 721, 724, 723, 721, 531, 725, 722, 725, 724, 722, 534,
+	725, 531, 723, 726, 714, 726, 712, 714, 534, 727, 725, 537, 727, 534, 725, 728,
+	724, 727, 728, 725, 724, 729, 723, 728, 729, 724, 729, 726, 723, 537, 730, 727,
+	540, 730, 537, 727, 731, 728, 730, 731, 727, 728, 732, 729, 731, 732, 728, 540,
+	733, 730, 543, 733, 540, 730, 734, 731, 733, 734, 730, 543, 735, 733, 546, 735,
+	543, 733, 736, 734, 735, 736, 733, 734, 737, 731, 731, 737, 732, 546, 738, 735,
+	549, 738, 546, 735, 739, 736, 738, 739, 735, 736, 740, 734, 734, 740, 737, 549,
+	741, 738, 552, 741, 549, 738, 742, 739, 741, 742, 738, 739, 743, 736, 736, 743,
+	740, 552, 744, 741, 555, 744, 552, 741, 745, 742, 744, 745, 741, 742, 746, 739,
+	739, 746, 743, 555, 747, 744, 558, 747, 555, 744, 748, 745, 747, 748, 744, 745,
+	749, 742, 742, 749, 746, 558, 750, 747, 561, 750, 558, 747, 751, 748, 750, 751,
+	747, 748, 752, 745, 745, 752, 749, 751, 753, 748, 748, 753, 752, 750, 754, 751,
+	751, 755, 753, 754, 755, 751, 561, 756, 750, 756, 754, 750, 757, 756, 561, 557,
+	757, 561, 560, 757, 557, 560, 565, 757, 565, 758, 757, 757, 758, 756, 565, 572,
+	758, 756, 759, 754, 758, 759, 756, 572, 760, 758, 758, 760, 759, 572, 573, 760,
+	759, 761, 754, 754, 761, 755, 760, 762, 759, 759, 762, 761, 573, 763, 760, 760,
+	763, 762, 573, 576, 763, 762, 764, 761, 576, 765, 763, 576, 581, 765, 763, 766,
+	762, 763, 765, 766, 762, 766, 764, 581, 767, 765, 581, 582, 767, 765, 768, 766,
+	765, 767, 768, 582, 769, 767, 582, 585, 769, 767, 770, 768, 767, 769, 770, 766,
+	768, 771, 766, 771, 764, 768, 770, 772, 768, 772, 771, 769, 773, 770, 585, 774,
+	769, 769, 774, 773, 585, 590, 774, 770, 773, 775, 770, 775, 772, 590, 776, 774,
+	590, 591, 776, 774, 777, 773, 774, 776, 777, 591, 778, 776, 591, 594, 778, 776,
+	779, 777, 776, 778, 779, 773, 777, 780, 773, 780, 775, 777, 779, 781, 777, 781,
+	780, 778, 782, 779, 594, 783, 778, 778, 783, 782, 594, 599, 783, 779, 782, 784,
+	779, 784, 781, 599, 785, 783, 599, 600, 785, 783, 786, 782, 783, 785, 786, 600,
+	787, 785, 600, 603, 787, 785, 788, 786, 785, 787, 788, 782, 786, 789, 782, 789,
+	784, 786, 788, 790, 786, 790, 789, 787, 791, 788, 603, 792, 787, 787, 792, 791,
+	603, 608, 792, 788, 791, 793, 788, 793, 790, 608, 794, 792, 608, 609, 794, 792,
+	795, 791, 792, 794, 795, 609, 796, 794, 609, 612, 796, 794, 797, 795, 794, 796,
+	797, 791, 795, 798, 791, 798, 793, 795, 797, 799, 795, 799, 798, 796, 800, 797,
+	612, 801, 796, 796, 801, 800, 612, 616, 801, 616, 629, 801, 801, 629, 802, 801,
+	802, 800, 629, 630, 802, 802, 630, 633, 802, 633, 803, 800, 802, 803, 803, 633,
+	638, 797, 800, 804, 800, 803, 804, 797, 804, 799, 803, 638, 805, 804, 803, 805,
+	805, 638, 641, 799, 804, 806, 804, 805, 806, 805, 641, 807, 806, 805, 807, 807,
+	641, 644, 799, 806, 808, 798, 799, 808, 806, 807, 809, 808, 806, 809, 807, 644,
+	810, 809, 807, 810, 810, 644, 647, 798, 808, 811, 793, 798, 811, 808, 809, 812,
+	811, 808, 812, 809, 810, 813, 812, 809, 813, 810, 647, 814, 813, 810, 814, 814,
+	647, 650, 812, 813, 815, 814, 650, 816, 816, 650, 653, 813, 814, 817, 817, 814,
+	816, 815, 813, 817, 816, 653, 818, 818, 653, 656, 817, 816, 819, 819, 816, 818,
+	815, 817, 820, 820, 817, 819, 818, 656, 821, 821, 656, 659, 819, 818, 822, 822,
+	818, 821, 820, 819, 823, 823, 819, 822, 821, 659, 824, 824, 659, 662, 822, 821,
+	825, 825, 821, 824, 823, 822, 826, 826, 822, 825, 824, 662, 827, 827, 662, 665,
+	825, 824, 828, 828, 824, 827, 826, 825, 829, 829, 825, 828, 827, 665, 830, 830,
+	665, 668, 828, 827, 831, 831, 827, 830, 829, 828, 832, 832, 828, 831, 830, 668,
+	833, 833, 668, 671, 831, 830, 834, 834, 830, 833, 832, 831, 835, 835, 831, 834,
+	833, 671, 836, 836, 671, 674, 836, 674, 689, 834, 833, 837, 837, 833, 836, 838,
+	836, 689, 837, 836, 838, 838, 689, 690, 839, 834, 837, 835, 834, 839, 840, 837,
+	838, 839, 837, 840, 841, 838, 690, 840, 838, 841, 841, 690, 692, 695, 841, 692,
+	842, 840, 841, 842, 841, 695, 843, 839, 840, 843, 840, 842, 844, 835, 839, 844,
+	839, 843, 845, 842, 695, 845, 695, 697, 846, 843, 842, 846, 842, 845, 847, 844,
+	843, 847, 843, 846, 848, 835, 844, 848, 832, 835, 849, 844, 847, 849, 848, 844,
+	850, 832, 848, 850, 829, 832, 851, 848, 849, 851, 850, 848, 852, 829, 850, 852,
+	826, 829, 853, 850, 851, 853, 852, 850, 854, 826, 852, 854, 823, 826, 855, 852,
+	853, 855, 854, 852, 856, 823, 854, 856, 820, 823, 857, 854, 855, 857, 856, 854,
+	858, 820, 856, 858, 815, 820, 859, 856, 857, 859, 858, 856, 860, 815, 858, 860,
+	812, 815, 811, 812, 860, 861, 860, 858, 861, 858, 859, 862, 811, 860, 862, 860,
+	861, 793, 811, 862, 790, 793, 862, 790, 862, 863, 863, 862, 861, 789, 790, 863,
+	863, 861, 864, 864, 861, 859, 789, 863, 865, 865, 863, 864, 784, 789, 865, 864,
+	859, 866, 866, 859, 857, 865, 864, 867, 867, 864, 866, 784, 865, 868, 868, 865,
+	867, 781, 784, 868, 866, 857, 869, 869, 857, 855, 781, 868, 870, 780, 781, 870,
+	868, 867, 871, 870, 868, 871, 867, 866, 872, 871, 867, 872, 872, 866, 869, 780,
+	870, 873, 775, 780, 873, 870, 871, 874, 873, 870, 874, 871, 872, 875, 874, 871,
+	875, 775, 873, 876, 772, 775, 876, 873, 874, 877, 876, 873, 877, 772, 876, 878,
+	771, 772, 878, 876, 877, 879, 878, 876, 879, 877, 874, 880, 874, 875, 880, 771,
+	878, 881, 764, 771, 881, 881, 878, 882, 878, 879, 882, 764, 881, 883, 761, 764,
+	883, 761, 883, 755, 883, 881, 884, 881, 882, 884, 755, 883, 885, 883, 884, 885,
+	755, 885, 753, 884, 882, 886, 753, 885, 887, 753, 887, 752, 885, 884, 888, 885,
+	888, 887, 884, 886, 888, 752, 887, 889, 752, 889, 749, 887, 888, 890, 887, 890,
+	889, 749, 889, 891, 749, 891, 746, 889, 890, 892, 889, 892, 891, 888, 893, 890,
+	888, 886, 893, 890, 894, 892, 890, 893, 894, 891, 892, 895, 746, 891, 896, 891,
+	895, 896, 746, 896, 743, 892, 897, 895, 892, 894, 897, 743, 896, 898, 743, 898,
+	740, 896, 895, 899, 896, 899, 898, 740, 898, 900, 740, 900, 737, 898, 899, 901,
+	898, 901, 900, 895, 902, 899, 895, 897, 902, 899, 903, 901, 899, 902, 903, 900,
+	901, 904, 737, 900, 905, 900, 904, 905, 737, 905, 732, 901, 906, 904, 901, 903,
+	906, 732, 905, 907, 732, 907, 729, 729, 907, 726, 905, 904, 908, 905, 908, 907,
+	907, 909, 726, 907, 908, 909, 726, 909, 712, 909, 710, 712, 909, 910, 710, 908,
+	910, 909, 910, 708, 710, 904, 911, 908, 908, 911, 910, 904, 906, 911, 910, 912,
+	708, 911, 912, 910, 912, 706, 708, 906, 913, 911, 911, 913, 912, 912, 914, 706,
+	913, 914, 912, 914, 704, 706, 906, 915, 913, 903, 915, 906, 913, 916, 914, 915,
+	916, 913, 914, 917, 704, 916, 917, 914, 917, 702, 704, 903, 918, 915, 902, 918,
+	903, 917, 919, 702, 919, 700, 702, 916, 920, 917, 920, 919, 917, 915, 921, 916,
+	921, 920, 916, 918, 921, 915, 919, 922, 700, 922, 698, 700, 920, 923, 919, 923,
+	922, 919, 921, 924, 920, 924, 923, 920, 922, 925, 698, 925, 697, 698, 925, 845,
+	697, 923, 926, 922, 926, 925, 922, 927, 845, 925, 926, 927, 925, 927, 846, 845,
+	928, 926, 923, 924, 928, 923, 929, 927, 926, 928, 929, 926, 930, 846, 927, 929,
+	930, 927, 930, 847, 846, 931, 929, 928, 932, 847, 930, 932, 849, 847, 933, 930,
+	929, 933, 932, 930, 931, 933, 929, 934, 849, 932, 934, 851, 849, 935, 932, 933,
+	935, 934, 932, 936, 851, 934, 936, 853, 851, 937, 934, 935, 937, 936, 934, 938,
+	935, 933, 938, 933, 931, 939, 937, 935, 939, 935, 938, 940, 853, 936, 940, 855,
+	853, 869, 855, 940, 941, 936, 937, 941, 940, 936, 942, 869, 940, 942, 940, 941,
+	872, 869, 942, 875, 872, 942, 875, 942, 943, 943, 942, 941, 880, 875, 943, 944,
+	941, 937, 943, 941, 944, 944, 937, 939, 880, 943, 945, 945, 943, 944, 946, 944,
+	939, 945, 944, 946, 947, 880, 945, 877, 880, 947, 879, 877, 947, 947, 945, 948,
+	948, 945, 946, 879, 947, 949, 949, 947, 948, 882, 879, 949, 882, 949, 886, 886,
+	949, 950, 949, 948, 950, 886, 950, 893, 950, 948, 951, 948, 946, 951, 893, 950,
+	952, 950, 951, 952, 893, 952, 894, 951, 946, 953, 946, 939, 953, 953, 939, 938,
+	952, 951, 954, 951, 953, 954, 894, 952, 955, 952, 954, 955, 894, 955, 897, 953,
+	938, 956, 954, 953, 956, 956, 938, 931, 955, 954, 957, 954, 956, 957, 897, 955,
+	958, 955, 957, 958, 897, 958, 902, 902, 958, 918, 956, 931, 959, 957, 956, 959,
+	959, 931, 928, 959, 928, 924, 958, 957, 960, 957, 959, 960, 958, 960, 918, 960,
+	959, 924, 918, 960, 921, 960, 924, 921,
+	// ground shadow
+	0, 0, 1, 0, 1, 2, 0, 2, 3, 0, 3, 4, 0, 4, 5, 0,
+	5, 6, 0, 6, 7, 0, 7, 8, 0, 8, 9, 0, 9, 10, 0, 10,
+	11, 0, 11, 12, 0, 12, 13, 0, 13, 14, 0, 14, 15, 0, 15, 16,
+	0, 16, 17, 0, 17, 18, 0, 18, 19, 0, 19, 20, 0, 20, 21, 0,
+	21, 22,
+	// wall shadow
+	0, 0, 1, 0, 1, 2, 0, 2, 3, 0, 3, 4, 0, 4, 5, 0,
+	5, 6, 0, 6, 7, 0, 7, 8, 0, 8, 9, 0, 9, 10, 0, 10,
+	11, 0, 11, 12, 0, 12, 13, 0, 13, 14, 0, 14, 15, 0, 15, 16,
+	0, 16, 17, 0, 17, 18, 0, 18, 19, 0, 19, 20, 0, 20, 21, 0,
+	21, 22,
+	// ball level 0
+	0, 1, 2, 0, 3, 1, 2, 4, 5, 2, 1, 4, 5, 6, 7, 5,
+	4, 6, 7, 8, 9, 7, 6, 8, 3, 10, 1, 3, 11, 10, 1, 12,
+	4, 1, 10, 12, 4, 13, 6, 4, 12, 13, 6, 14, 8, 6, 13, 14,
+	11, 15, 10, 11, 16, 15, 10, 17, 12, 10, 15, 17, 12, 18, 13, 12,
+	17, 18, 13, 19, 14, 13, 18, 19, 16, 20, 15, 16, 21, 20, 15, 22,
+	17, 15, 20, 22, 17, 23, 18, 17, 22, 23, 18, 24, 19, 18, 23, 24,
+	21, 25, 20, 21, 26, 25, 20, 27, 22, 20, 25, 27, 22, 28, 23, 22,
+	27, 28, 23, 29, 24, 23, 28, 29, 26, 30, 25, 26, 31, 30, 25, 32,
+	27, 25, 30, 32, 27, 33, 28, 27, 32, 33, 28, 34, 29, 28, 33, 34,
+	// ball level 1
+	0, 1, 2, 0, 3, 1, 2, 4, 5, 2, 1, 4, 5, 6, 7, 5,
+	4, 6, 7, 8, 9, 7, 6, 8, 9, 10, 11, 9, 8, 10, 11, 12,
+	13, 11, 10, 12, 3, 14, 1, 3, 15, 14, 1, 16, 4, 1, 14, 16,
+	4, 17, 6, 4, 16, 17, 6, 18, 8, 6, 17, 18, 8, 19, 10, 8,
+	18, 19, 10, 20, 12, 10, 19, 20, 15, 21, 14, 15, 22, 21, 14, 23,
+	16, 14, 21, 23, 16, 24, 17, 16, 23, 24, 17, 25, 18, 17, 24, 25,
+	18, 26, 19, 18, 25, 26, 19, 27, 20, 19, 26, 27, 22, 28, 21, 22,
+	29, 28, 21, 30, 23, 21, 28, 30, 23, 31, 24, 23, 30, 31, 24, 32,
+	25, 24, 31, 32, 25, 33, 26, 25, 32, 33, 26, 34, 27, 26, 33, 34,
+	29, 35, 28, 29, 36, 35, 28, 37, 30, 28, 35, 37, 30, 38, 31, 30,
+	37, 38, 31, 39, 32, 31, 38, 39, 32, 40, 33, 32, 39, 40, 33, 41,
+	34, 33, 40, 41, 36, 42, 35, 36, 43, 42, 35, 44, 37, 35, 42, 44,
+	37, 45, 38, 37, 44, 45, 38, 46, 39, 38, 45, 46, 39, 47, 40, 39,
+	46, 47, 40, 48, 41, 40, 47, 48, 43, 49, 42, 43, 50, 49, 42, 51,
+	44, 42, 49, 51, 44, 52, 45, 44, 51, 52, 45, 53, 46, 45, 52, 53,
+	46, 54, 47, 46, 53, 54, 47, 55, 48, 47, 54, 55, 50, 56, 49, 50,
+	57, 56, 49, 58, 51, 49, 56, 58, 51, 59, 52, 51, 58, 59, 52, 60,
+	53, 52, 59, 60, 53, 61, 54, 53, 60, 61, 54, 62, 55, 54, 61, 62,
+	57, 63, 56, 57, 64, 63, 56, 65, 58, 56, 63, 65, 58, 66, 59, 58,
+	65, 66, 59, 67, 60, 59, 66, 67, 60, 68, 61, 60, 67, 68, 61, 69,
+	62, 61, 68, 69, 64, 70, 63, 64, 71, 70, 63, 72, 65, 63, 70, 72,
+	65, 73, 66, 65, 72, 73, 66, 74, 67, 66, 73, 74, 67, 75, 68, 67,
+	74, 75, 68, 76, 69, 68, 75, 76,
+	// ball level 2
+	0, 1, 2, 0, 3, 1, 2, 4, 5, 2, 1, 4, 5, 6, 7, 5,
+	4, 6, 7, 8, 9, 7, 6, 8, 9, 10, 11, 9, 8, 10, 11, 12,
+	13, 11, 10, 12, 13, 14, 15, 13, 12, 14, 15, 16, 17, 15, 14, 16,
+	3, 18, 1, 3, 19, 18, 1, 20, 4, 1, 18, 20, 4, 21, 6, 4,
+	20, 21, 6, 22, 8, 6, 21, 22, 8, 23, 10, 8, 22, 23, 10, 24,
+	12, 10, 23, 24, 12, 25, 14, 12, 24, 25, 14, 26, 16, 14, 25, 26,
+	19, 27, 18, 19, 28, 27, 18, 29, 20, 18, 27, 29, 20, 30, 21, 20,
+	29, 30, 21, 31, 22, 21, 30, 31, 22, 32, 23, 22, 31, 32, 23, 33,
+	24, 23, 32, 33, 24, 34, 25, 24, 33, 34, 25, 35, 26, 25, 34, 35,
+	28, 36, 27, 28, 37, 36, 27, 38, 29, 27, 36, 38, 29, 39, 30, 29,
+	38, 39, 30, 40, 31, 30, 39, 40, 31, 41, 32, 31, 40, 41, 32, 42,
+	33, 32, 41, 42, 33, 43, 34, 33, 42, 43, 34, 44, 35, 34, 43, 44,
+	37, 45, 36, 37, 46, 45, 36, 47, 38, 36, 45, 47, 38, 48, 39, 38,
+	47, 48, 39, 49, 40, 39, 48, 49, 40, 50, 41, 40, 49, 50, 41, 51,
+	42, 41, 50, 51, 42, 52, 43, 42, 51, 52, 43, 53, 44, 43, 52, 53,
+	46, 54, 45, 46, 55, 54, 45, 56, 47, 45, 54, 56, 47, 57, 48, 47,
+	56, 57, 48, 58, 49, 48, 57, 58, 49, 59, 50, 49, 58, 59, 50, 60,
+	51, 50, 59, 60, 51, 61, 52, 51, 60, 61, 52, 62, 53, 52, 61, 62,
+	55, 63, 54, 55, 64, 63, 54, 65, 56, 54, 63, 65, 56, 66, 57, 56,
+	65, 66, 57, 67, 58, 57, 66, 67, 58, 68, 59, 58, 67, 68, 59, 69,
+	60, 59, 68, 69, 60, 70, 61, 60, 69, 70, 61, 71, 62, 61, 70, 71,
+	64, 72, 63, 64, 73, 72, 63, 74, 65, 63, 72, 74, 65, 75, 66, 65,
+	74, 75, 66, 76, 67, 66, 75, 76, 67, 77, 68, 67, 76, 77, 68, 78,
+	69, 68, 77, 78, 69, 79, 70, 69, 78, 79, 70, 80, 71, 70, 79, 80,
+	73, 81, 72, 73, 82, 81, 72, 83, 74, 72, 81, 83, 74, 84, 75, 74,
+	83, 84, 75, 85, 76, 75, 84, 85, 76, 86, 77, 76, 85, 86, 77, 87,
+	78, 77, 86, 87, 78, 88, 79, 78, 87, 88, 79, 89, 80, 79, 88, 89,
+	82, 90, 81, 82, 91, 90, 81, 92, 83, 81, 90, 92, 83, 93, 84, 83,
+	92, 93, 84, 94, 85, 84, 93, 94, 85, 95, 86, 85, 94, 95, 86, 96,
+	87, 86, 95, 96, 87, 97, 88, 87, 96, 97, 88, 98, 89, 88, 97, 98,
+	91, 99, 90, 91, 100, 99, 90, 101, 92, 90, 99, 101, 92, 102, 93, 92,
+	101, 102, 93, 103, 94, 93, 102, 103, 94, 104, 95, 94, 103, 104, 95, 105,
+	96, 95, 104, 105, 96, 106, 97, 96, 105, 106, 97, 107, 98, 97, 106, 107,
+	100, 108, 99, 100, 109, 108, 99, 110, 101, 99, 108, 110, 101, 111, 102, 101,
+	110, 111, 102, 112, 103, 102, 111, 112, 103, 113, 104, 103, 112, 113, 104, 114,
+	105, 104, 113, 114, 105, 115, 106, 105, 114, 115, 106, 116, 107, 106, 115, 116,
+	109, 117, 108, 109, 118, 117, 108, 119, 110, 108, 117, 119, 110, 120, 111, 110,
+	119, 120, 111, 121, 112, 111, 120, 121, 112, 122, 113, 112, 121, 122, 113, 123,
+	114, 113, 122, 123, 114, 124, 115, 114, 123, 124, 115, 125, 116, 115, 124, 125,
+	118, 126, 117, 118, 127, 126, 117, 128, 119, 117, 126, 128, 119, 129, 120, 119,
+	128, 129, 120, 130, 121, 120, 129, 130, 121, 131, 122, 121, 130, 131, 122, 132,
+	123, 122, 131, 132, 123, 133, 124, 123, 132, 133, 124, 134, 125, 124, 133, 134,
+	// ball level 3
+	0, 1, 2, 0, 3, 1, 2, 4, 5, 2, 1, 4, 5, 6, 7, 5,
+	4, 6, 7, 8, 9, 7, 6, 8, 9, 10, 11, 9, 8, 10, 11, 12,
+	13, 11, 10, 12, 13, 14, 15, 13, 12, 14, 15, 16, 17, 15, 14, 16,
+	17, 18, 19, 17, 16, 18, 19, 20, 21, 19, 18, 20, 21, 22, 23, 21,
+	20, 22, 23, 24, 25, 23, 22, 24, 25, 26, 27, 25, 24, 26, 27, 28,
+	29, 27, 26, 28, 3, 30, 1, 3, 31, 30, 1, 32, 4, 1, 30, 32,
+	4, 33, 6, 4, 32, 33, 6, 34, 8, 6, 33, 34, 8, 35, 10, 8,
+	34, 35, 10, 36, 12, 10, 35, 36, 12, 37, 14, 12, 36, 37, 14, 38,
+	16, 14, 37, 38, 16, 39, 18, 16, 38, 39, 18, 40, 20, 18, 39, 40,
+	20, 41, 22, 20, 40, 41, 22, 42, 24, 22, 41, 42, 24, 43, 26, 24,
+	42, 43, 26, 44, 28, 26, 43, 44, 31, 45, 30, 31, 46, 45, 30, 47,
+	32, 30, 45, 47, 32, 48, 33, 32, 47, 48, 33, 49, 34, 33, 48, 49,
+	34, 50, 35, 34, 49, 50, 35, 51, 36, 35, 50, 51, 36, 52, 37, 36,
+	51, 52, 37, 53, 38, 37, 52, 53, 38, 54, 39, 38, 53, 54, 39, 55,
+	40, 39, 54, 55, 40, 56, 41, 40, 55, 56, 41, 57, 42, 41, 56, 57,
+	42, 58, 43, 42, 57, 58, 43, 59, 44, 43, 58, 59, 46, 60, 45, 46,
+	61, 60, 45, 62, 47, 45, 60, 62, 47, 63, 48, 47, 62, 63, 48, 64,
+	49, 48, 63, 64, 49, 65, 50, 49, 64, 65, 50, 66, 51, 50, 65, 66,
+	51, 67, 52, 51, 66, 67, 52, 68, 53, 52, 67, 68, 53, 69, 54, 53,
+	68, 69, 54, 70, 55, 54, 69, 70, 55, 71, 56, 55, 70, 71, 56, 72,
+	57, 56, 71, 72, 57, 73, 58, 57, 72, 73, 58, 74, 59, 58, 73, 74,
+	61, 75, 60, 61, 76, 75, 60, 77, 62, 60, 75, 77, 62, 78, 63, 62,
+	77, 78, 63, 79, 64, 63, 78, 79, 64, 80, 65, 64, 79, 80, 65, 81,
+	66, 65, 80, 81, 66, 82, 67, 66, 81, 82, 67, 83, 68, 67, 82, 83,
+	68, 84, 69, 68, 83, 84, 69, 85, 70, 69, 84, 85, 70, 86, 71, 70,
+	85, 86, 71, 87, 72, 71, 86, 87, 72, 88, 73, 72, 87, 88, 73, 89,
+	74, 73, 88, 89, 76, 90, 75, 76, 91, 90, 75, 92, 77, 75, 90, 92,
+	77, 93, 78, 77, 92, 93, 78, 94, 79, 78, 93, 94, 79, 95, 80, 79,
+	94, 95, 80, 96, 81, 80, 95, 96, 81, 97, 82, 81, 96, 97, 82, 98,
+	83, 82, 97, 98, 83, 99, 84, 83, 98, 99, 84, 100, 85, 84, 99, 100,
+	85, 101, 86, 85, 100, 101, 86, 102, 87, 86, 101, 102, 87, 103, 88, 87,
+	102, 103, 88, 104, 89, 88, 103, 104, 91, 105, 90, 91, 106, 105, 90, 107,
+	92, 90, 105, 107, 92, 108, 93, 92, 107, 108, 93, 109, 94, 93, 108, 109,
+	94, 110, 95, 94, 109, 110, 95, 111, 96, 95, 110, 111, 96, 112, 97, 96,
+	111, 112, 97, 113, 98, 97, 112, 113, 98, 114, 99, 98, 113, 114, 99, 115,
+	100, 99, 114, 115, 100, 116, 101, 100, 115, 116, 101, 117, 102, 101, 116, 117,
+	102, 118, 103, 102, 117, 118, 103, 119, 104, 103, 118, 119, 106, 120, 105, 106,
+	121, 120, 105, 122, 107, 105, 120, 122, 107, 123, 108, 107, 122, 123, 108, 124,
+	109, 108, 123, 124, 109, 125, 110, 109, 124, 125, 110, 126, 111, 110, 125, 126,
+	111, 127, 112, 111, 126, 127, 112, 128, 113, 112, 127, 128, 113, 129, 114, 113,
+	128, 129, 114, 130, 115, 114, 129, 130, 115, 131, 116, 115, 130, 131, 116, 132,
+	117, 116, 131, 132, 117, 133, 118, 117, 132, 133, 118, 134, 119, 118, 133, 134,
+	121, 135, 120, 121, 136, 135, 120, 137, 122, 120, 135, 137, 122, 138, 123, 122,
+	137, 138, 123, 139, 124, 123, 138, 139, 124, 140, 125, 124, 139, 140, 125, 141,
+	126, 125, 140, 141, 126, 142, 127, 126, 141, 142, 127, 143, 128, 127, 142, 143,
+	128, 144, 129, 128, 143, 144, 129, 145, 130, 129, 144, 145, 130, 146, 131, 130,
+	145, 146, 131, 147, 132, 131, 146, 147, 132, 148, 133, 132, 147, 148, 133, 149,
+	134, 133, 148, 149, 136, 150, 135, 136, 151, 150, 135, 152, 137, 135, 150, 152,
+	137, 153, 138, 137, 152, 153, 138, 154, 139, 138, 153, 154, 139, 155, 140, 139,
+	154, 155, 140, 156, 141, 140, 155, 156, 141, 157, 142, 141, 156, 157, 142, 158,
+	143, 142, 157, 158, 143, 159, 144, 143, 158, 159, 144, 160, 145, 144, 159, 160,
+	145, 161, 146, 145, 160, 161, 146, 162, 147, 146, 161, 162, 147, 163, 148, 147,
+	162, 163, 148, 164, 149, 148, 163, 164, 151, 165, 150, 151, 166, 165, 150, 167,
+	152, 150, 165, 167, 152, 168, 153, 152, 167, 168, 153, 169, 154, 153, 168, 169,
+	154, 170, 155, 154, 169, 170, 155, 171, 156, 155, 170, 171, 156, 172, 157, 156,
+	171, 172, 157, 173, 158, 157, 172, 173, 158, 174, 159, 158, 173, 174, 159, 175,
+	160, 159, 174, 175, 160, 176, 161, 160, 175, 176, 161, 177, 162, 161, 176, 177,
+	162, 178, 163, 162, 177, 178, 163, 179, 164, 163, 178, 179, 166, 180, 165, 166,
+	181, 180, 165, 182, 167, 165, 180, 182, 167, 183, 168, 167, 182, 183, 168, 184,
+	169, 168, 183, 184, 169, 185, 170, 169, 184, 185, 170, 186, 171, 170, 185, 186,
+	171, 187, 172, 171, 186, 187, 172, 188, 173, 172, 187, 188, 173, 189, 174, 173,
+	188, 189, 174, 190, 175, 174, 189, 190, 175, 191, 176, 175, 190, 191, 176, 192,
+	177, 176, 191, 192, 177, 193, 178, 177, 192, 193, 178, 194, 179, 178, 193, 194,
+	181, 195, 180, 181, 196, 195, 180, 197, 182, 180, 195, 197, 182, 198, 183, 182,
+	197, 198, 183, 199, 184, 183, 198, 199, 184, 200, 185, 184, 199, 200, 185, 201,
+	186, 185, 200, 201, 186, 202, 187, 186, 201, 202, 187, 203, 188, 187, 202, 203,
+	188, 204, 189, 188, 203, 204, 189, 205, 190, 189, 204, 205, 190, 206, 191, 190,
+	205, 206, 191, 207, 192, 191, 206, 207, 192, 208, 193, 192, 207, 208, 193, 209,
+	194, 193, 208, 209, 196, 210, 195, 196, 211, 210, 195, 212, 197, 195, 210, 212,
+	197, 213, 198, 197, 212, 213, 198, 214, 199, 198, 213, 214, 199, 215, 200, 199,
+	214, 215, 200, 216, 201, 200, 215, 216, 201, 217, 202, 201, 216, 217, 202, 218,
+	203, 202, 217, 218, 203, 219, 204, 203, 218, 219, 204, 220, 205, 204, 219, 220,
+	205, 221, 206, 205, 220, 221, 206, 222, 207, 206, 221, 222, 207, 223, 208, 207,
+	222, 223, 208, 224, 209, 208, 223, 224, 211, 225, 210, 211, 226, 225, 210, 227,
+	212, 210, 225, 227, 212, 228, 213, 212, 227, 228, 213, 229, 214, 213, 228, 229,
+	214, 230, 215, 214, 229, 230, 215, 231, 216, 215, 230, 231, 216, 232, 217, 216,
+	231, 232, 217, 233, 218, 217, 232, 233, 218, 234, 219, 218, 233, 234, 219, 235,
+	220, 219, 234, 235, 220, 236, 221, 220, 235, 236, 221, 237, 222, 221, 236, 237,
+	222, 238, 223, 222, 237, 238, 223, 239, 224, 223, 238, 239, 226, 240, 225, 226,
+	241, 240, 225, 242, 227, 225, 240, 242, 227, 243, 228, 227, 242, 243, 228, 244,
+	229, 228, 243, 244, 229, 245, 230, 229, 244, 245, 230, 246, 231, 230, 245, 246,
+	231, 247, 232, 231, 246, 247, 232, 248, 233, 232, 247, 248, 233, 249, 234, 233,
+	248, 249, 234, 250, 235, 234, 249, 250, 235, 251, 236, 235, 250, 251, 236, 252,
+	237, 236, 251, 252, 237, 253, 238, 237, 252, 253, 238, 254, 239, 238, 253, 254,
+	241, 255, 240, 241, 256, 255, 240, 257, 242, 240, 255, 257, 242, 258, 243, 242,
+	257, 258, 243, 259, 244, 243, 258, 259, 244, 260, 245, 244, 259, 260, 245, 261,
+	246, 245, 260, 261, 246, 262, 247, 246, 261, 262, 247, 263, 248, 247, 262, 263,
+	248, 264, 249, 248, 263, 264, 249, 265, 250, 249, 264, 265, 250, 266, 251, 250,
+	265, 266, 251, 267, 252, 251, 266, 267, 252, 268, 253, 252, 267, 268, 253, 269,
+	254, 253, 268, 269, 256, 270, 255, 256, 271, 270, 255, 272, 257, 255, 270, 272,
+	257, 273, 258, 257, 272, 273, 258, 274, 259, 258, 273, 274, 259, 275, 260, 259,
+	274, 275, 260, 276, 261, 260, 275, 276, 261, 277, 262, 261, 276, 277, 262, 278,
+	263, 262, 277, 278, 263, 279, 264, 263, 278, 279, 264, 280, 265, 264, 279, 280,
+	265, 281, 266, 265, 280, 281, 266, 282, 267, 266, 281, 282, 267, 283, 268, 267,
+	282, 283, 268, 284, 269, 268, 283, 284, 271, 285, 270, 271, 286, 285, 270, 287,
+	272, 270, 285, 287, 272, 288, 273, 272, 287, 288, 273, 289, 274, 273, 288, 289,
+	274, 290, 275, 274, 289, 290, 275, 291, 276, 275, 290, 291, 276, 292, 277, 276,
+	291, 292, 277, 293, 278, 277, 292, 293, 278, 294, 279, 278, 293, 294, 279, 295,
+	280, 279, 294, 295, 280, 296, 281, 280, 295, 296, 281, 297, 282, 281, 296, 297,
+	282, 298, 283, 282, 297, 298, 283, 299, 284, 283, 298, 299, 286, 300, 285, 286,
+	301, 300, 285, 302, 287, 285, 300, 302, 287, 303, 288, 287, 302, 303, 288, 304,
+	289, 288, 303, 304, 289, 305, 290, 289, 304, 305, 290, 306, 291, 290, 305, 306,
+	291, 307, 292, 291, 306, 307, 292, 308, 293, 292, 307, 308, 293, 309, 294, 293,
+	308, 309, 294, 310, 295, 294, 309, 310, 295, 311, 296, 295, 310, 311, 296, 312,
+	297, 296, 311, 312, 297, 313, 298, 297, 312, 313, 298, 314, 299, 298, 313, 314,
+	301, 315, 300, 301, 316, 315, 300, 317, 302, 300, 315, 317, 302, 318, 303, 302,
+	317, 318, 303, 319, 304, 303, 318, 319, 304, 320, 305, 304, 319, 320, 305, 321,
+	306, 305, 320, 321, 306, 322, 307, 306, 321, 322, 307, 323, 308, 307, 322, 323,
+	308, 324, 309, 308, 323, 324, 309, 325, 310, 309, 324, 325, 310, 326, 311, 310,
+	325, 326, 311, 327, 312, 311, 326, 327, 312, 328, 313, 312, 327, 328, 313, 329,
+	314, 313, 328, 329, 316, 330, 315, 316, 331, 330, 315, 332, 317, 315, 330, 332,
+	317, 333, 318, 317, 332, 333, 318, 334, 319, 318, 333, 334, 319, 335, 320, 319,
+	334, 335, 320, 336, 321, 320, 335, 336, 321, 337, 322, 321, 336, 337, 322, 338,
+	323, 322, 337, 338, 323, 339, 324, 323, 338, 339, 324, 340, 325, 324, 339, 340,
+	325, 341, 326, 325, 340, 341, 326, 342, 327, 326, 341, 342, 327, 343, 328, 327,
+	342, 343, 328, 344, 329, 328, 343, 344,
+	// ball level 4
+	0, 1, 2, 0, 3, 1, 4, 3, 0, 3, 5, 1, 4, 6, 3, 7,
+	6, 4, 3, 8, 5, 6, 8, 3, 8, 9, 5, 7, 10, 6, 11, 10,
+	7, 6, 12, 8, 10, 12, 6, 8, 13, 9, 12, 13, 8, 13, 14, 9,
+	11, 15, 10, 16, 15, 11, 13, 17, 14, 17, 18, 14, 12, 19, 13, 19,
+	17, 13, 10, 20, 12, 20, 19, 12, 15, 20, 10, 17, 21, 18, 21, 22,
+	18, 19, 23, 17, 23, 21, 17, 20, 24, 19, 24, 23, 19, 21, 25, 22,
+	25, 26, 22, 23, 27, 21, 27, 25, 21, 25, 28, 26, 28, 29, 26, 27,
+	30, 25, 30, 28, 25, 31, 27, 23, 24, 31, 23, 32, 30, 27, 31, 32,
+	27, 28, 33, 29, 33, 34, 29, 30, 35, 28, 35, 33, 28, 33, 36, 34,
+	36, 37, 34, 35, 38, 33, 38, 36, 33, 39, 35, 30, 32, 39, 30, 40,
+	38, 35, 39, 40, 35, 36, 41, 37, 41, 42, 37, 38, 43, 36, 43, 41,
+	36, 41, 44, 42, 44, 45, 42, 43, 46, 41, 46, 44, 41, 47, 43, 38,
+	40, 47, 38, 48, 46, 43, 47, 48, 43, 44, 49, 45, 49, 50, 45, 46,
+	51, 44, 51, 49, 44, 49, 52, 50, 52, 53, 50, 51, 54, 49, 54, 52,
+	49, 55, 51, 46, 48, 55, 46, 56, 54, 51, 55, 56, 51, 52, 57, 53,
+	57, 58, 53, 54, 59, 52, 59, 57, 52, 57, 60, 58, 60, 61, 58, 59,
+	62, 57, 62, 60, 57, 63, 59, 54, 56, 63, 54, 64, 62, 59, 63, 64,
+	59, 60, 65, 61, 65, 66, 61, 62, 67, 60, 67, 65, 60, 65, 68, 66,
+	68, 69, 66, 67, 70, 65, 70, 68, 65, 71, 67, 62, 64, 71, 62, 72,
+	70, 67, 71, 72, 67, 68, 73, 69, 73, 74, 69, 70, 75, 68, 75, 73,
+	68, 73, 76, 74, 76, 77, 74, 75, 78, 73, 78, 76, 73, 79, 75, 70,
+	72, 79, 70, 80, 78, 75, 79, 80, 75, 76, 81, 77, 81, 82, 77, 78,
+	83, 76, 83, 81, 76, 81, 84, 82, 84, 85, 82, 83, 86, 81, 86, 84,
+	81, 87, 83, 78, 80, 87, 78, 88, 86, 83, 87, 88, 83, 84, 89, 85,
+	89, 90, 85, 86, 91, 84, 91, 89, 84, 89, 92, 90, 92, 93, 90, 91,
+	94, 89, 94, 92, 89, 95, 91, 86, 88, 95, 86, 96, 94, 91, 95, 96,
+	91, 92, 97, 93, 97, 98, 93, 94, 99, 92, 99, 97, 92, 97, 100, 98,
+	100, 101, 98, 99, 102, 97, 102, 100, 97, 103, 99, 94, 96, 103, 94, 104,
+	102, 99, 103, 104, 99, 100, 105, 101, 105, 106, 101, 102, 107, 100, 107, 105,
+	100, 105, 108, 106, 108, 109, 106, 107, 110, 105, 110, 108, 105, 111, 107, 102,
+	104, 111, 102, 112, 110, 107, 111, 112, 107, 108, 113, 109, 113, 114, 109, 110,
+	115, 108, 115, 113, 108, 113, 116, 114, 116, 117, 114, 115, 118, 113, 118, 116,
+	113, 119, 115, 110, 112, 119, 110, 120, 118, 115, 119, 120, 115, 116, 121, 117,
+	121, 122, 117, 118, 123, 116, 123, 121, 116, 121, 124, 122, 124, 125, 122, 124,
+	126, 125, 127, 124, 121, 123, 127, 121, 128, 126, 124, 127, 128, 124, 128, 129,
+	126, 130, 127, 123, 131, 129, 128, 131, 132, 129, 133, 128, 127, 133, 131, 128,
+	130, 133, 127, 134, 132, 131, 134, 135, 132, 136, 131, 133, 136, 134, 131, 137,
+	135, 134, 137, 138, 135, 139, 134, 136, 139, 137, 134, 140, 136, 133, 140, 133,
+	130, 141, 139, 136, 141, 136, 140, 142, 138, 137, 142, 143, 138, 144, 137, 139,
+	144, 142, 137, 145, 143, 142, 145, 146, 143, 147, 142, 144, 147, 145, 142, 148,
+	144, 139, 148, 139, 141, 149, 147, 144, 149, 144, 148, 150, 146, 145, 150, 151,
+	146, 152, 145, 147, 152, 150, 145, 153, 151, 150, 153, 154, 151, 155, 150, 152,
+	155, 153, 150, 156, 152, 147, 156, 147, 149, 157, 155, 152, 157, 152, 156, 158,
+	154, 153, 158, 159, 154, 160, 153, 155, 160, 158, 153, 161, 159, 158, 161, 162,
+	159, 163, 158, 160, 163, 161, 158, 164, 160, 155, 164, 155, 157, 165, 163, 160,
+	165, 160, 164, 166, 162, 161, 166, 167, 162, 168, 161, 163, 168, 166, 161, 169,
+	167, 166, 169, 170, 167, 171, 166, 168, 171, 169, 166, 172, 168, 163, 172, 163,
+	165, 173, 171, 168, 173, 168, 172, 174, 170, 169, 174, 175, 170, 176, 169, 171,
+	176, 174, 169, 177, 175, 174, 177, 178, 175, 179, 174, 176, 179, 177, 174, 180,
+	176, 171, 180, 171, 173, 181, 179, 176, 181, 176, 180, 182, 178, 177, 182, 183,
+	178, 184, 177, 179, 184, 182, 177, 185, 183, 182, 185, 186, 183, 187, 182, 184,
+	187, 185, 182, 188, 184, 179, 188, 179, 181, 189, 187, 184, 189, 184, 188, 190,
+	186, 185, 190, 191, 186, 192, 185, 187, 192, 190, 185, 193, 191, 190, 193, 194,
+	191, 195, 196, 194, 195, 194, 193, 197, 195, 193, 198, 193, 190, 197, 193, 198,
+	198, 190, 192, 199, 197, 198, 199, 198, 200, 200, 198, 192, 201, 199, 200, 202,
+	192, 187, 200, 192, 202, 202, 187, 189, 201, 200, 203, 203, 200, 202, 204, 201,
+	203, 205, 202, 189, 203, 202, 205, 204, 203, 206, 206, 203, 205, 207, 204, 206,
+	205, 189, 208, 208, 189, 188, 206, 205, 209, 209, 205, 208, 207, 206, 210, 210,
+	206, 209, 211, 207, 210, 208, 188, 212, 212, 188, 181, 211, 210, 213, 214, 211,
+	213, 210, 209, 215, 213, 210, 215, 209, 208, 216, 215, 209, 216, 216, 208, 212,
+	214, 213, 217, 218, 214, 217, 213, 215, 219, 217, 213, 219, 215, 216, 220, 219,
+	215, 220, 218, 217, 221, 222, 218, 221, 217, 219, 223, 221, 217, 223, 222, 221,
+	224, 225, 222, 224, 221, 223, 226, 224, 221, 226, 223, 219, 227, 219, 220, 227,
+	225, 224, 228, 229, 225, 228, 228, 224, 230, 224, 226, 230, 229, 228, 231, 232,
+	229, 231, 228, 230, 233, 231, 228, 233, 232, 231, 234, 235, 232, 234, 231, 233,
+	236, 234, 231, 236, 235, 234, 237, 238, 235, 237, 234, 236, 239, 237, 234, 239,
+	238, 237, 240, 241, 238, 240, 237, 239, 242, 240, 237, 242, 241, 240, 243, 244,
+	241, 243, 240, 242, 245, 243, 240, 245, 244, 243, 246, 247, 244, 246, 243, 245,
+	248, 246, 243, 248, 247, 246, 249, 250, 247, 249, 246, 248, 251, 249, 246, 251,
+	250, 249, 252, 253, 250, 252, 249, 251, 254, 252, 249, 254, 253, 252, 255, 256,
+	253, 255, 252, 254, 257, 255, 252, 257, 256, 255, 258, 259, 256, 258, 255, 257,
+	260, 258, 255, 260, 259, 258, 261, 262, 259, 261, 258, 260, 263, 261, 258, 263,
+	262, 261, 264, 265, 262, 264, 261, 263, 266, 264, 261, 266, 265, 264, 267, 268,
+	265, 267, 264, 266, 269, 267, 264, 269, 268, 267, 270, 271, 268, 270, 267, 269,
+	272, 270, 267, 272, 271, 270, 273, 274, 271, 273, 270, 272, 275, 273, 270, 275,
+	274, 273, 276, 277, 274, 276, 273, 275, 278, 276, 273, 278, 277, 276, 279, 280,
+	277, 279, 276, 278, 281, 279, 276, 281, 280, 279, 282, 283, 280, 282, 279, 281,
+	284, 282, 279, 284, 283, 282, 285, 286, 283, 285, 282, 284, 287, 285, 282, 287,
+	286, 285, 288, 289, 286, 288, 289, 288, 290, 288, 285, 291, 285, 287, 291, 290,
+	288, 292, 288, 291, 292, 290, 292, 293, 291, 287, 294, 293, 292, 295, 293, 295,
+	296, 292, 291, 297, 292, 297, 295, 291, 294, 297, 296, 295, 298, 296, 298, 299,
+	295, 297, 300, 295, 300, 298, 299, 298, 301, 299, 301, 302, 298, 300, 303, 298,
+	303, 301, 297, 304, 300, 297, 294, 304, 300, 305, 303, 300, 304, 305, 301, 303,
+	306, 302, 301, 307, 301, 306, 307, 302, 307, 308, 303, 309, 306, 303, 305, 309,
+	308, 307, 310, 308, 310, 311, 307, 306, 312, 307, 312, 310, 311, 310, 313, 311,
+	313, 314, 310, 312, 315, 310, 315, 313, 306, 316, 312, 306, 309, 316, 312, 317,
+	315, 312, 316, 317, 313, 315, 318, 314, 313, 319, 313, 318, 319, 314, 319, 320,
+	315, 321, 318, 315, 317, 321, 320, 319, 322, 320, 322, 323, 319, 318, 324, 319,
+	324, 322, 323, 322, 325, 323, 325, 326, 322, 324, 327, 322, 327, 325, 318, 328,
+	324, 318, 321, 328, 324, 329, 327, 324, 328, 329, 325, 327, 330, 326, 325, 331,
+	325, 330, 331, 326, 331, 332, 327, 333, 330, 327, 329, 333, 332, 331, 334, 332,
+	334, 335, 331, 330, 336, 331, 336, 334, 335, 334, 337, 335, 337, 338, 334, 336,
+	339, 334, 339, 337, 330, 340, 336, 330, 333, 340, 336, 341, 339, 336, 340, 341,
+	337, 339, 342, 338, 337, 343, 337, 342, 343, 338, 343, 16, 16, 343, 15, 343,
+	344, 15, 343, 342, 344, 15, 344, 20, 344, 24, 20, 344, 345, 24, 342, 345,
+	344, 345, 31, 24, 339, 346, 342, 342, 346, 345, 339, 341, 346, 345, 347, 31,
+	346, 347, 345, 347, 32, 31, 341, 348, 346, 346, 348, 347, 347, 349, 32, 348,
+	349, 347, 349, 39, 32, 341, 350, 348, 340, 350, 341, 348, 351, 349, 350, 351,
+	348, 349, 352, 39, 351, 352, 349, 352, 40, 39, 340, 353, 350, 333, 353, 340,
+	352, 354, 40, 354, 47, 40, 351, 355, 352, 355, 354, 352, 350, 356, 351, 356,
+	355, 351, 353, 356, 350, 354, 357, 47, 357, 48, 47, 355, 358, 354, 358, 357,
+	354, 356, 359, 355, 359, 358, 355, 357, 360, 48, 360, 55, 48, 358, 361, 357,
+	361, 360, 357, 360, 362, 55, 362, 56, 55, 361, 363, 360, 363, 362, 360, 364,
+	361, 358, 359, 364, 358, 365, 363, 361, 364, 365, 361, 362, 366, 56, 366, 63,
+	56, 363, 367, 362, 367, 366, 362, 366, 368, 63, 368, 64, 63, 367, 369, 366,
+	369, 368, 366, 370, 367, 363, 365, 370, 363, 371, 369, 367, 370, 371, 367, 368,
+	372, 64, 372, 71, 64, 369, 373, 368, 373, 372, 368, 372, 374, 71, 374, 72,
+	71, 373, 375, 372, 375, 374, 372, 376, 373, 369, 371, 376, 369, 377, 375, 373,
+	376, 377, 373, 374, 378, 72, 378, 79, 72, 375, 379, 374, 379, 378, 374, 378,
+	380, 79, 380, 80, 79, 379, 381, 378, 381, 380, 378, 382, 379, 375, 377, 382,
+	375, 383, 381, 379, 382, 383, 379, 380, 384, 80, 384, 87, 80, 381, 385, 380,
+	385, 384, 380, 384, 386, 87, 386, 88, 87, 385, 387, 384, 387, 386, 384, 388,
+	385, 381, 383, 388, 381, 389, 387, 385, 388, 389, 385, 386, 390, 88, 390, 95,
+	88, 387, 391, 386, 391, 390, 386, 390, 392, 95, 392, 96, 95, 391, 393, 390,
+	393, 392, 390, 394, 391, 387, 389, 394, 387, 395, 393, 391, 394, 395, 391, 392,
+	396, 96, 396, 103, 96, 393, 397, 392, 397, 396, 392, 396, 398, 103, 398, 104,
+	103, 397, 399, 396, 399, 398, 396, 400, 397, 393, 395, 400, 393, 401, 399, 397,
+	400, 401, 397, 398, 402, 104, 402, 111, 104, 399, 403, 398, 403, 402, 398, 402,
+	404, 111, 404, 112, 111, 403, 405, 402, 405, 404, 402, 406, 403, 399, 401, 406,
+	399, 407, 405, 403, 406, 407, 403, 404, 408, 112, 408, 119, 112, 405, 409, 404,
+	409, 408, 404, 408, 410, 119, 410, 120, 119, 409, 411, 408, 411, 410, 408, 412,
+	409, 405, 407, 412, 405, 413, 411, 409, 412, 413, 409, 411, 414, 410, 415, 412,
+	407, 413, 416, 411, 416, 414, 411, 417, 413, 412, 415, 417, 412, 418, 416, 413,
+	417, 418, 413, 419, 415, 407, 419, 407, 406, 420, 417, 415, 421, 419, 406, 421,
+	406, 401, 422, 415, 419, 422, 420, 415, 423, 419, 421, 423, 422, 419, 424, 421,
+	401, 424, 401, 400, 425, 423, 421, 425, 421, 424, 426, 424, 400, 426, 400, 395,
+	427, 425, 424, 427, 424, 426, 428, 426, 395, 428, 395, 394, 429, 427, 426, 429,
+	426, 428, 430, 428, 394, 430, 394, 389, 431, 429, 428, 431, 428, 430, 432, 430,
+	389, 432, 389, 388, 433, 431, 430, 433, 430, 432, 434, 432, 388, 434, 388, 383,
+	435, 433, 432, 435, 432, 434, 436, 434, 383, 436, 383, 382, 437, 435, 434, 437,
+	434, 436, 438, 436, 382, 438, 382, 377, 439, 437, 436, 439, 436, 438, 440, 438,
+	377, 440, 377, 376, 441, 439, 438, 441, 438, 440, 442, 440, 376, 442, 376, 371,
+	443, 441, 440, 443, 440, 442, 444, 442, 371, 444, 371, 370, 445, 443, 442, 445,
+	442, 444, 446, 444, 370, 446, 370, 365, 447, 445, 444, 447, 444, 446, 448, 446,
+	365, 448, 365, 364, 449, 447, 446, 449, 446, 448, 450, 448, 364, 450, 364, 359,
+	451, 449, 448, 451, 448, 450, 452, 450, 359, 452, 359, 356, 353, 452, 356, 453,
+	450, 452, 453, 451, 450, 454, 452, 353, 454, 453, 452, 333, 454, 353, 329, 454,
+	333, 329, 455, 454, 455, 453, 454, 328, 455, 329, 456, 451, 453, 455, 456, 453,
+	328, 457, 455, 457, 456, 455, 321, 457, 328, 456, 458, 451, 458, 449, 451, 457,
+	459, 456, 459, 458, 456, 321, 460, 457, 460, 459, 457, 317, 460, 321, 458, 461,
+	449, 461, 447, 449, 317, 462, 460, 316, 462, 317, 460, 463, 459, 462, 463, 460,
+	459, 464, 458, 463, 464, 459, 464, 461, 458, 316, 465, 462, 309, 465, 316, 462,
+	466, 463, 465, 466, 462, 463, 467, 464, 466, 467, 463, 309, 468, 465, 305, 468,
+	309, 465, 469, 466, 468, 469, 465, 305, 470, 468, 304, 470, 305, 468, 471, 469,
+	470, 471, 468, 469, 472, 466, 466, 472, 467, 304, 473, 470, 294, 473, 304, 470,
+	474, 471, 473, 474, 470, 471, 475, 469, 469, 475, 472, 294, 476, 473, 287, 476,
+	294, 287, 284, 476, 476, 477, 473, 473, 477, 474, 284, 478, 476, 476, 478, 477,
+	284, 281, 478, 477, 479, 474, 281, 480, 478, 281, 278, 480, 478, 481, 477, 478,
+	480, 481, 477, 481, 479, 278, 482, 480, 278, 275, 482, 480, 483, 481, 480, 482,
+	483, 275, 484, 482, 275, 272, 484, 482, 485, 483, 482, 484, 485, 481, 483, 486,
+	481, 486, 479, 483, 485, 487, 483, 487, 486, 484, 488, 485, 272, 489, 484, 484,
+	489, 488, 272, 269, 489, 485, 488, 490, 485, 490, 487, 269, 491, 489, 269, 266,
+	491, 489, 492, 488, 489, 491, 492, 266, 493, 491, 266, 263, 493, 491, 494, 492,
+	491, 493, 494, 488, 492, 495, 488, 495, 490, 492, 494, 496, 492, 496, 495, 493,
+	497, 494, 263, 498, 493, 493, 498, 497, 263, 260, 498, 494, 497, 499, 494, 499,
+	496, 260, 500, 498, 260, 257, 500, 498, 501, 497, 498, 500, 501, 257, 502, 500,
+	257, 254, 502, 500, 503, 501, 500, 502, 503, 497, 501, 504, 497, 504, 499, 501,
+	503, 505, 501, 505, 504, 502, 506, 503, 254, 507, 502, 502, 507, 506, 254, 251,
+	507, 503, 506, 508, 503, 508, 505, 251, 509, 507, 251, 248, 509, 507, 510, 506,
+	507, 509, 510, 248, 511, 509, 248, 245, 511, 509, 512, 510, 509, 511, 512, 506,
+	510, 513, 506, 513, 508, 510, 512, 514, 510, 514, 513, 511, 515, 512, 245, 516,
+	511, 511, 516, 515, 245, 242, 516, 512, 515, 517, 512, 517, 514, 242, 518, 516,
+	242, 239, 518, 516, 519, 515, 516, 518, 519, 239, 520, 518, 239, 236, 520, 518,
+	521, 519, 518, 520, 521, 515, 519, 522, 515, 522, 517, 519, 521, 523, 519, 523,
+	522, 520, 524, 521, 236, 525, 520, 520, 525, 524, 236, 233, 525, 521, 524, 526,
+	521, 526, 523, 233, 527, 525, 233, 230, 527, 525, 528, 524, 525, 527, 528, 230,
+	529, 527, 230, 226, 529, 527, 530, 528, 527, 529, 530, 524, 528, 531, 524, 531,
+	526, 528, 530, 532, 528, 532, 531, 529, 533, 530, 226, 534, 529, 529, 534, 533,
+	226, 223, 534, 223, 227, 534, 530, 533, 535, 530, 535, 532, 534, 536, 533, 534,
+	227, 536, 533, 537, 535, 533, 536, 537, 227, 538, 536, 227, 220, 538, 536, 539,
+	537, 536, 538, 539, 220, 540, 538, 220, 216, 540, 216, 212, 540, 538, 540, 541,
+	538, 541, 539, 540, 212, 542, 540, 542, 541, 212, 181, 542, 542, 181, 180, 542,
+	180, 543, 541, 542, 543, 543, 180, 173, 541, 543, 544, 539, 541, 544, 543, 173,
+	545, 544, 543, 545, 545, 173, 172, 539, 544, 546, 537, 539, 546, 544, 545, 547,
+	546, 544, 547, 545, 172, 548, 547, 545, 548, 548, 172, 165, 537, 546, 549, 535,
+	537, 549, 546, 547, 550, 549, 546, 550, 547, 548, 551, 550, 547, 551, 548, 165,
+	552, 551, 548, 552, 552, 165, 164, 550, 551, 553, 552, 164, 554, 554, 164, 157,
+	551, 552, 555, 555, 552, 554, 553, 551, 555, 554, 157, 556, 556, 157, 156, 555,
+	554, 557, 557, 554, 556, 553, 555, 558, 558, 555, 557, 556, 156, 559, 559, 156,
+	149, 557, 556, 560, 560, 556, 559, 558, 557, 561, 561, 557, 560, 559, 149, 562,
+	562, 149, 148, 560, 559, 563, 563, 559, 562, 561, 560, 564, 564, 560, 563, 562,
+	148, 565, 565, 148, 141, 563, 562, 566, 566, 562, 565, 564, 563, 567, 567, 563,
+	566, 565, 141, 568, 568, 141, 140, 566, 565, 569, 569, 565, 568, 567, 566, 570,
+	570, 566, 569, 568, 140, 571, 571, 140, 130, 569, 568, 572, 572, 568, 571, 570,
+	569, 573, 573, 569, 572, 571, 130, 574, 574, 130, 123, 574, 123, 118, 120, 574,
+	118, 575, 571, 574, 575, 574, 120, 572, 571, 575, 410, 575, 120, 414, 575, 410,
+	414, 572, 575, 573, 572, 414, 416, 573, 414, 576, 573, 416, 576, 570, 573, 418,
+	576, 416, 577, 570, 576, 577, 567, 570, 578, 576, 418, 578, 577, 576, 579, 567,
+	577, 579, 564, 567, 580, 577, 578, 580, 579, 577, 581, 578, 418, 581, 418, 417,
+	420, 581, 417, 582, 578, 581, 582, 580, 578, 583, 581, 420, 583, 582, 581, 584,
+	583, 420, 584, 420, 422, 585, 582, 583, 586, 584, 422, 586, 422, 423, 587, 583,
+	584, 587, 585, 583, 588, 584, 586, 588, 587, 584, 589, 586, 423, 589, 423, 425,
+	590, 588, 586, 590, 586, 589, 591, 589, 425, 591, 425, 427, 592, 590, 589, 592,
+	589, 591, 593, 591, 427, 593, 427, 429, 594, 592, 591, 594, 591, 593, 595, 593,
+	429, 595, 429, 431, 596, 594, 593, 596, 593, 595, 597, 595, 431, 597, 431, 433,
+	598, 596, 595, 598, 595, 597, 599, 597, 433, 599, 433, 435, 600, 598, 597, 600,
+	597, 599, 601, 599, 435, 601, 435, 437, 602, 600, 599, 602, 599, 601, 603, 601,
+	437, 603, 437, 439, 604, 602, 601, 604, 601, 603, 605, 603, 439, 605, 439, 441,
+	606, 604, 603, 606, 603, 605, 607, 605, 441, 607, 441, 443, 608, 606, 605, 608,
+	605, 607, 609, 607, 443, 609, 443, 445, 610, 608, 607, 610, 607, 609, 611, 609,
+	445, 611, 445, 447, 461, 611, 447, 612, 609, 611, 612, 610, 609, 613, 611, 461,
+	613, 612, 611, 464, 613, 461, 467, 613, 464, 467, 614, 613, 614, 612, 613, 472,
+	614, 467, 615, 610, 612, 614, 615, 612, 472, 616, 614, 616, 615, 614, 475, 616,
+	472, 615, 617, 610, 617, 608, 610, 616, 618, 615, 618, 617, 615, 475, 619, 616,
+	619, 618, 616, 617, 620, 608, 620, 606, 608, 618, 621, 617, 621, 620, 617, 620,
+	622, 606, 622, 604, 606, 621, 623, 620, 623, 622, 620, 624, 621, 618, 619, 624,
+	618, 625, 623, 621, 624, 625, 621, 622, 626, 604, 626, 602, 604, 623, 627, 622,
+	627, 626, 622, 626, 628, 602, 628, 600, 602, 627, 629, 626, 629, 628, 626, 630,
+	627, 623, 625, 630, 623, 631, 629, 627, 630, 631, 627, 628, 632, 600, 632, 598,
+	600, 629, 633, 628, 633, 632, 628, 632, 634, 598, 634, 596, 598, 633, 635, 632,
+	635, 634, 632, 636, 633, 629, 631, 636, 629, 637, 635, 633, 636, 637, 633, 634,
+	638, 596, 638, 594, 596, 635, 639, 634, 639, 638, 634, 638, 640, 594, 640, 592,
+	594, 639, 641, 638, 641, 640, 638, 642, 639, 635, 637, 642, 635, 643, 641, 639,
+	642, 643, 639, 640, 644, 592, 644, 590, 592, 641, 645, 640, 645, 644, 640, 644,
+	646, 590, 646, 588, 590, 645, 647, 644, 647, 646, 644, 648, 645, 641, 643, 648,
+	641, 649, 647, 645, 648, 649, 645, 646, 650, 588, 650, 587, 588, 647, 651, 646,
+	651, 650, 646, 650, 652, 587, 652, 585, 587, 651, 653, 650, 653, 652, 650, 654,
+	651, 647, 649, 654, 647, 655, 653, 651, 654, 655, 651, 653, 656, 652, 657, 654,
+	649, 655, 658, 653, 658, 656, 653, 659, 655, 654, 657, 659, 654, 660, 658, 655,
+	659, 660, 655, 514, 659, 657, 514, 517, 659, 517, 660, 659, 513, 514, 657, 517,
+	522, 660, 513, 657, 661, 661, 657, 649, 508, 513, 661, 661, 649, 648, 508, 661,
+	662, 662, 661, 648, 505, 508, 662, 662, 648, 643, 505, 662, 663, 663, 662, 643,
+	504, 505, 663, 663, 643, 642, 504, 663, 664, 664, 663, 642, 499, 504, 664, 664,
+	642, 637, 499, 664, 665, 665, 664, 637, 496, 499, 665, 665, 637, 636, 496, 665,
+	666, 666, 665, 636, 495, 496, 666, 666, 636, 631, 495, 666, 667, 667, 666, 631,
+	490, 495, 667, 667, 631, 630, 490, 667, 668, 668, 667, 630, 487, 490, 668, 668,
+	630, 625, 487, 668, 669, 669, 668, 625, 486, 487, 669, 669, 625, 624, 486, 669,
+	670, 670, 669, 624, 479, 486, 670, 670, 624, 619, 479, 670, 671, 671, 670, 619,
+	474, 479, 671, 671, 619, 475, 474, 671, 471, 471, 671, 475, 522, 672, 660, 522,
+	523, 672, 660, 672, 658, 523, 673, 672, 523, 526, 673, 672, 674, 658, 672, 673,
+	674, 658, 674, 656, 526, 675, 673, 526, 531, 675, 673, 676, 674, 673, 675, 676,
+	674, 677, 656, 674, 676, 677, 531, 678, 675, 531, 532, 678, 675, 679, 676, 675,
+	678, 679, 532, 680, 678, 532, 535, 680, 535, 549, 680, 678, 680, 681, 678, 681,
+	679, 680, 549, 682, 680, 682, 681, 549, 550, 682, 682, 550, 553, 682, 553, 683,
+	681, 682, 683, 683, 553, 558, 681, 683, 684, 679, 681, 684, 683, 558, 685, 684,
+	683, 685, 685, 558, 561, 679, 684, 686, 676, 679, 686, 676, 686, 677, 684, 685,
+	687, 686, 684, 687, 685, 561, 688, 687, 685, 688, 688, 561, 564, 688, 564, 579,
+	686, 687, 689, 677, 686, 689, 687, 688, 690, 690, 688, 579, 689, 687, 690, 690,
+	579, 580, 677, 689, 691, 656, 677, 691, 656, 691, 652, 652, 691, 585, 689, 690,
+	692, 691, 689, 692, 692, 690, 580, 691, 692, 585, 692, 580, 582, 585, 692, 582,
+	// ball level 5
+	0, 1, 2, 3, 1, 0, 3, 4, 1, 5, 3, 0, 6, 4, 3, 6,
+	7, 4, 8, 3, 5, 8, 6, 3, 9, 7, 6, 9, 10, 7, 11, 6,
+	8, 11, 9, 6, 12, 8, 5, 12, 5, 13, 14, 12, 13, 15, 8, 12,
+	15, 11, 8, 16, 12, 14, 16, 15, 12, 17, 16, 14, 17, 14, 18, 19,
+	15, 16, 20, 17, 18, 20, 18, 21, 22, 16, 17, 22, 19, 16, 23, 17,
+	20, 23, 22, 17, 24, 20, 21, 24, 21, 25, 26, 23, 20, 26, 20, 24,
+	27, 24, 25, 27, 25, 28, 29, 26, 24, 29, 24, 27, 30, 27, 28, 30,
+	28, 31, 32, 29, 27, 32, 27, 30, 33, 30, 31, 33, 31, 34, 35, 32,
+	30, 35, 30, 33, 36, 33, 34, 36, 34, 37, 38, 35, 33, 38, 33, 36,
+	39, 36, 37, 39, 37, 40, 41, 38, 36, 41, 36, 39, 42, 39, 40, 42,
+	40, 43, 44, 41, 39, 44, 39, 42, 45, 42, 43, 45, 43, 46, 47, 44,
+	42, 47, 42, 45, 48, 45, 46, 48, 46, 49, 50, 47, 45, 50, 45, 48,
+	51, 48, 49, 51, 49, 52, 53, 50, 48, 53, 48, 51, 54, 51, 52, 54,
+	52, 55, 56, 53, 51, 56, 51, 54, 57, 54, 55, 57, 55, 58, 59, 56,
+	54, 59, 54, 57, 60, 57, 58, 60, 58, 61, 62, 59, 57, 62, 57, 60,
+	63, 60, 61, 63, 61, 64, 65, 62, 60, 65, 60, 63, 66, 63, 64, 66,
+	64, 67, 68, 65, 63, 68, 63, 66, 69, 66, 67, 69, 67, 70, 71, 68,
+	66, 71, 66, 69, 72, 69, 70, 72, 70, 73, 74, 71, 69, 74, 69, 72,
+	75, 72, 73, 75, 73, 76, 77, 74, 72, 77, 72, 75, 78, 75, 76, 78,
+	76, 79, 80, 77, 75, 80, 75, 78, 81, 78, 79, 81, 79, 82, 83, 80,
+	78, 83, 78, 81, 84, 81, 82, 84, 82, 85, 86, 83, 81, 86, 81, 84,
+	87, 84, 85, 87, 85, 88, 89, 86, 84, 89, 84, 87, 90, 87, 88, 90,
+	88, 91, 92, 89, 87, 92, 87, 90, 93, 90, 91, 93, 91, 94, 95, 93,
+	94, 96, 90, 93, 96, 92, 90, 97, 93, 95, 97, 96, 93, 98, 97, 95,
+	99, 97, 98, 99, 100, 97, 100, 96, 97, 101, 100, 99, 102, 92, 96, 100,
+	102, 96, 101, 103, 100, 103, 102, 100, 104, 103, 101, 102, 105, 92, 105, 89,
+	92, 103, 106, 102, 106, 105, 102, 104, 107, 103, 107, 106, 103, 108, 107, 104,
+	105, 109, 89, 109, 86, 89, 108, 110, 107, 111, 110, 108, 107, 112, 106, 110,
+	112, 107, 106, 113, 105, 112, 113, 106, 113, 109, 105, 111, 114, 110, 115, 114,
+	111, 110, 116, 112, 114, 116, 110, 112, 117, 113, 116, 117, 112, 115, 118, 114,
+	119, 118, 115, 114, 120, 116, 118, 120, 114, 119, 121, 118, 122, 121, 119, 118,
+	123, 120, 121, 123, 118, 120, 124, 116, 116, 124, 117, 122, 125, 121, 126, 125,
+	122, 121, 127, 123, 125, 127, 121, 123, 128, 120, 120, 128, 124, 126, 129, 125,
+	130, 129, 126, 125, 131, 127, 129, 131, 125, 127, 132, 123, 123, 132, 128, 130,
+	133, 129, 134, 133, 130, 129, 135, 131, 133, 135, 129, 131, 136, 127, 127, 136,
+	132, 135, 137, 131, 131, 137, 136, 133, 138, 135, 135, 139, 137, 138, 139, 135,
+	134, 140, 133, 140, 138, 133, 141, 140, 134, 142, 141, 134, 143, 141, 142, 143,
+	144, 141, 144, 145, 141, 141, 145, 140, 144, 146, 145, 140, 147, 138, 145, 147,
+	140, 146, 148, 145, 145, 148, 147, 146, 149, 148, 147, 150, 138, 138, 150, 139,
+	148, 151, 147, 147, 151, 150, 149, 152, 148, 148, 152, 151, 149, 153, 152, 151,
+	154, 150, 153, 155, 152, 153, 156, 155, 152, 157, 151, 152, 155, 157, 151, 157,
+	154, 156, 158, 155, 156, 159, 158, 155, 160, 157, 155, 158, 160, 159, 161, 158,
+	159, 162, 161, 158, 163, 160, 158, 161, 163, 157, 160, 164, 157, 164, 154, 160,
+	163, 165, 160, 165, 164, 161, 166, 163, 162, 167, 161, 161, 167, 166, 162, 168,
+	167, 163, 166, 169, 163, 169, 165, 168, 170, 167, 168, 171, 170, 167, 172, 166,
+	167, 170, 172, 171, 173, 170, 171, 174, 173, 170, 175, 172, 170, 173, 175, 166,
+	172, 176, 166, 176, 169, 172, 175, 177, 172, 177, 176, 173, 178, 175, 174, 179,
+	173, 173, 179, 178, 174, 180, 179, 175, 178, 181, 175, 181, 177, 180, 182, 179,
+	180, 183, 182, 179, 184, 178, 179, 182, 184, 183, 185, 182, 183, 186, 185, 182,
+	187, 184, 182, 185, 187, 178, 184, 188, 178, 188, 181, 184, 187, 189, 184, 189,
+	188, 14, 13, 190, 191, 192, 193, 191, 193, 194, 18, 190, 192, 18, 14, 190,
+	21, 192, 191, 21, 18, 192, 195, 191, 194, 195, 194, 196, 25, 21, 191, 25,
+	191, 195, 197, 195, 196, 197, 196, 198, 28, 25, 195, 28, 195, 197, 199, 197,
+	198, 199, 198, 200, 31, 28, 197, 31, 197, 199, 201, 199, 200, 201, 200, 202,
+	34, 31, 199, 34, 199, 201, 203, 201, 202, 203, 202, 204, 37, 34, 201, 37,
+	201, 203, 205, 203, 204, 205, 204, 206, 40, 37, 203, 40, 203, 205, 207, 205,
+	206, 207, 206, 208, 43, 40, 205, 43, 205, 207, 209, 207, 208, 209, 208, 210,
+	46, 43, 207, 46, 207, 209, 211, 209, 210, 211, 210, 212, 49, 46, 209, 49,
+	209, 211, 213, 211, 212, 213, 212, 214, 52, 49, 211, 52, 211, 213, 215, 213,
+	214, 215, 214, 216, 55, 52, 213, 55, 213, 215, 217, 215, 216, 217, 216, 218,
+	58, 55, 215, 58, 215, 217, 219, 217, 218, 219, 218, 220, 61, 58, 217, 61,
+	217, 219, 221, 219, 220, 221, 220, 222, 64, 61, 219, 64, 219, 221, 223, 221,
+	222, 223, 222, 224, 67, 64, 221, 67, 221, 223, 225, 223, 224, 225, 224, 226,
+	70, 67, 223, 70, 223, 225, 227, 225, 226, 227, 226, 228, 73, 70, 225, 73,
+	225, 227, 229, 227, 228, 229, 228, 230, 76, 73, 227, 76, 227, 229, 231, 229,
+	230, 231, 230, 232, 79, 76, 229, 79, 229, 231, 233, 231, 232, 233, 232, 234,
+	82, 79, 231, 82, 231, 233, 235, 233, 234, 235, 234, 236, 85, 82, 233, 85,
+	233, 235, 237, 235, 236, 237, 236, 238, 88, 85, 235, 88, 235, 237, 239, 237,
+	238, 239, 238, 240, 91, 88, 237, 91, 237, 239, 241, 239, 240, 241, 240, 242,
+	94, 91, 239, 94, 239, 241, 243, 241, 242, 243, 242, 244, 245, 94, 241, 245,
+	241, 243, 246, 243, 244, 246, 244, 247, 248, 245, 243, 248, 243, 246, 249, 246,
+	247, 249, 247, 250, 251, 249, 250, 252, 246, 249, 252, 248, 246, 253, 249, 251,
+	253, 252, 249, 254, 253, 251, 255, 253, 254, 255, 256, 253, 256, 252, 253, 257,
+	256, 255, 258, 248, 252, 256, 258, 252, 257, 259, 256, 259, 258, 256, 260, 259,
+	257, 258, 261, 248, 261, 245, 248, 259, 262, 258, 262, 261, 258, 260, 263, 259,
+	263, 262, 259, 264, 263, 260, 261, 95, 245, 95, 94, 245, 264, 265, 263, 266,
+	265, 264, 263, 267, 262, 265, 267, 263, 262, 98, 261, 267, 98, 262, 98, 95,
+	261, 266, 268, 265, 269, 268, 266, 265, 270, 267, 268, 270, 265, 267, 99, 98,
+	270, 99, 267, 269, 271, 268, 272, 271, 269, 268, 273, 270, 271, 273, 268, 272,
+	274, 271, 275, 274, 272, 271, 276, 273, 274, 276, 271, 273, 101, 270, 270, 101,
+	99, 275, 277, 274, 278, 277, 275, 274, 279, 276, 277, 279, 274, 276, 104, 273,
+	273, 104, 101, 278, 280, 277, 281, 280, 278, 277, 282, 279, 280, 282, 277, 279,
+	108, 276, 276, 108, 104, 281, 283, 280, 284, 283, 281, 280, 285, 282, 283, 285,
+	280, 282, 111, 279, 279, 111, 108, 284, 286, 283, 287, 286, 284, 283, 288, 285,
+	286, 288, 283, 285, 115, 282, 282, 115, 111, 287, 289, 286, 290, 289, 287, 286,
+	291, 288, 289, 291, 286, 288, 119, 285, 285, 119, 115, 290, 292, 289, 293, 292,
+	290, 289, 294, 291, 292, 294, 289, 291, 122, 288, 288, 122, 119, 293, 295, 292,
+	296, 295, 293, 292, 297, 294, 295, 297, 292, 294, 126, 291, 291, 126, 122, 296,
+	298, 295, 299, 298, 296, 295, 142, 297, 298, 142, 295, 297, 130, 294, 294, 130,
+	126, 299, 300, 298, 301, 300, 299, 298, 143, 142, 300, 143, 298, 142, 134, 297,
+	297, 134, 130, 301, 302, 300, 303, 302, 301, 303, 304, 302, 302, 305, 300, 300,
+	305, 143, 304, 306, 302, 302, 306, 305, 304, 307, 306, 305, 144, 143, 307, 308,
+	306, 307, 309, 308, 306, 310, 305, 306, 308, 310, 305, 310, 144, 309, 311, 308,
+	309, 312, 311, 308, 313, 310, 308, 311, 313, 312, 314, 311, 312, 315, 314, 311,
+	316, 313, 311, 314, 316, 310, 313, 146, 310, 146, 144, 313, 316, 149, 313, 149,
+	146, 314, 317, 316, 315, 318, 314, 314, 318, 317, 315, 319, 318, 316, 317, 153,
+	316, 153, 149, 319, 320, 318, 319, 321, 320, 318, 322, 317, 318, 320, 322, 321,
+	323, 320, 321, 324, 323, 320, 325, 322, 320, 323, 325, 317, 322, 156, 317, 156,
+	153, 322, 325, 159, 322, 159, 156, 323, 326, 325, 324, 327, 323, 323, 327, 326,
+	324, 328, 327, 325, 326, 162, 325, 162, 159, 328, 329, 327, 328, 330, 329, 327,
+	331, 326, 327, 329, 331, 330, 332, 329, 330, 333, 332, 329, 334, 331, 329, 332,
+	334, 326, 331, 168, 326, 168, 162, 331, 334, 171, 331, 171, 168, 332, 335, 334,
+	333, 336, 332, 332, 336, 335, 333, 337, 336, 334, 335, 174, 334, 174, 171, 337,
+	338, 336, 337, 339, 338, 336, 340, 335, 336, 338, 340, 339, 341, 338, 339, 342,
+	341, 338, 343, 340, 338, 341, 343, 335, 340, 180, 335, 180, 174, 340, 343, 183,
+	340, 183, 180, 344, 345, 346, 344, 347, 345, 348, 346, 349, 348, 344, 346, 350,
+	347, 344, 350, 351, 347, 352, 344, 348, 352, 350, 344, 353, 351, 350, 353, 354,
+	351, 355, 350, 352, 355, 353, 350, 356, 354, 353, 356, 357, 354, 358, 357, 356,
+	359, 356, 353, 359, 353, 355, 360, 358, 356, 360, 356, 359, 361, 358, 360, 362,
+	361, 360, 362, 360, 363, 363, 360, 359, 364, 362, 363, 363, 359, 365, 365, 359,
+	355, 364, 363, 366, 366, 363, 365, 367, 364, 366, 365, 355, 368, 368, 355, 352,
+	366, 365, 369, 369, 365, 368, 367, 366, 370, 370, 366, 369, 371, 367, 370, 368,
+	352, 372, 372, 352, 348, 371, 370, 373, 374, 371, 373, 370, 369, 375, 373, 370,
+	375, 369, 368, 376, 375, 369, 376, 376, 368, 372, 374, 373, 377, 378, 374, 377,
+	373, 375, 379, 377, 373, 379, 375, 376, 380, 379, 375, 380, 378, 377, 381, 382,
+	378, 381, 377, 379, 383, 381, 377, 383, 382, 381, 384, 385, 382, 384, 381, 383,
+	386, 384, 381, 386, 383, 379, 387, 379, 380, 387, 385, 384, 388, 389, 385, 388,
+	388, 384, 390, 384, 386, 390, 389, 388, 391, 392, 389, 391, 388, 390, 393, 391,
+	388, 393, 392, 391, 394, 395, 392, 394, 391, 393, 396, 394, 391, 396, 395, 394,
+	397, 398, 395, 397, 394, 396, 399, 397, 394, 399, 398, 397, 400, 401, 398, 400,
+	397, 399, 402, 400, 397, 402, 401, 400, 403, 404, 401, 403, 400, 402, 405, 403,
+	400, 405, 404, 403, 406, 189, 404, 406, 403, 405, 407, 406, 403, 407, 189, 406,
+	408, 188, 189, 408, 406, 407, 409, 408, 406, 409, 188, 408, 410, 181, 188, 410,
+	408, 409, 411, 410, 408, 411, 181, 410, 412, 177, 181, 412, 410, 411, 413, 412,
+	410, 413, 177, 412, 414, 176, 177, 414, 412, 413, 415, 414, 412, 415, 176, 414,
+	416, 169, 176, 416, 414, 415, 417, 416, 414, 417, 169, 416, 418, 165, 169, 418,
+	416, 417, 419, 418, 416, 419, 165, 418, 420, 164, 165, 420, 418, 419, 421, 420,
+	418, 421, 164, 420, 422, 154, 164, 422, 420, 421, 423, 422, 420, 423, 154, 422,
+	424, 150, 154, 424, 150, 424, 139, 424, 422, 425, 422, 423, 425, 139, 424, 426,
+	424, 425, 426, 139, 426, 137, 425, 423, 427, 137, 426, 428, 137, 428, 136, 426,
+	425, 429, 426, 429, 428, 425, 427, 429, 136, 428, 430, 136, 430, 132, 428, 429,
+	431, 428, 431, 430, 132, 430, 432, 132, 432, 128, 430, 431, 433, 430, 433, 432,
+	429, 434, 431, 429, 427, 434, 431, 435, 433, 431, 434, 435, 432, 433, 436, 128,
+	432, 437, 432, 436, 437, 128, 437, 124, 433, 438, 436, 433, 435, 438, 124, 437,
+	439, 124, 439, 117, 437, 436, 440, 437, 440, 439, 117, 439, 441, 117, 441, 113,
+	113, 441, 109, 439, 442, 441, 439, 440, 442, 441, 443, 109, 441, 442, 443, 109,
+	443, 86, 443, 83, 86, 443, 444, 83, 442, 444, 443, 444, 80, 83, 442, 445,
+	444, 440, 445, 442, 444, 446, 80, 445, 446, 444, 446, 77, 80, 440, 447, 445,
+	436, 447, 440, 436, 438, 447, 445, 448, 446, 447, 448, 445, 446, 449, 77, 448,
+	449, 446, 449, 74, 77, 447, 450, 448, 438, 450, 447, 451, 452, 23, 452, 22,
+	23, 452, 453, 22, 454, 455, 451, 455, 452, 451, 456, 453, 452, 455, 456, 452,
+	456, 457, 453, 458, 455, 454, 459, 458, 454, 460, 456, 455, 458, 460, 455, 461,
+	457, 456, 460, 461, 456, 461, 462, 457, 463, 460, 458, 464, 462, 461, 464, 349,
+	462, 465, 461, 460, 465, 464, 461, 463, 465, 460, 466, 349, 464, 466, 348, 349,
+	372, 348, 466, 467, 464, 465, 467, 466, 464, 468, 372, 466, 468, 466, 467, 376,
+	372, 468, 380, 376, 468, 380, 468, 469, 469, 468, 467, 387, 380, 469, 470, 467,
+	465, 469, 467, 470, 470, 465, 463, 387, 469, 471, 471, 469, 470, 472, 470, 463,
+	471, 470, 472, 473, 387, 471, 383, 387, 473, 386, 383, 473, 473, 471, 474, 474,
+	471, 472, 386, 473, 475, 475, 473, 474, 390, 386, 475, 474, 472, 476, 390, 475,
+	477, 393, 390, 477, 475, 474, 478, 477, 475, 478, 478, 474, 476, 393, 477, 479,
+	396, 393, 479, 477, 478, 480, 479, 477, 480, 396, 479, 481, 399, 396, 481, 479,
+	480, 482, 481, 479, 482, 480, 478, 483, 478, 476, 483, 399, 481, 484, 402, 399,
+	484, 484, 481, 485, 481, 482, 485, 402, 484, 486, 405, 402, 486, 484, 485, 487,
+	486, 484, 487, 405, 486, 488, 407, 405, 488, 486, 487, 489, 488, 486, 489, 407,
+	488, 490, 409, 407, 490, 488, 489, 491, 490, 488, 491, 409, 490, 492, 411, 409,
+	492, 490, 491, 493, 492, 490, 493, 411, 492, 494, 413, 411, 494, 492, 493, 495,
+	494, 492, 495, 413, 494, 496, 415, 413, 496, 494, 495, 497, 496, 494, 497, 415,
+	496, 498, 417, 415, 498, 496, 497, 499, 498, 496, 499, 417, 498, 500, 419, 417,
+	500, 498, 499, 501, 500, 498, 501, 419, 500, 502, 421, 419, 502, 500, 501, 503,
+	502, 500, 503, 421, 502, 504, 423, 421, 504, 423, 504, 427, 504, 502, 505, 502,
+	503, 505, 427, 504, 506, 504, 505, 506, 427, 506, 434, 505, 503, 507, 434, 506,
+	508, 434, 508, 435, 435, 508, 509, 506, 505, 510, 506, 510, 508, 505, 507, 510,
+	508, 511, 509, 508, 510, 511, 509, 511, 512, 511, 513, 512, 510, 514, 511, 511,
+	514, 513, 510, 507, 514, 514, 515, 513, 514, 516, 515, 507, 516, 514, 516, 517,
+	515, 507, 518, 516, 503, 518, 507, 503, 501, 518, 516, 519, 517, 518, 519, 516,
+	519, 520, 517, 501, 521, 518, 518, 521, 519, 501, 499, 521, 519, 522, 520, 521,
+	522, 519, 523, 524, 525, 525, 524, 526, 527, 523, 525, 528, 526, 529, 525, 526,
+	528, 527, 525, 530, 530, 525, 528, 531, 527, 530, 528, 529, 532, 532, 529, 533,
+	530, 528, 534, 534, 528, 532, 531, 530, 535, 535, 530, 534, 536, 531, 535, 532,
+	533, 537, 537, 533, 538, 536, 535, 539, 540, 536, 539, 535, 534, 541, 539, 535,
+	541, 534, 532, 542, 541, 534, 542, 542, 532, 537, 540, 539, 543, 544, 540, 543,
+	539, 541, 545, 543, 539, 545, 541, 542, 546, 545, 541, 546, 544, 543, 547, 548,
+	544, 547, 543, 545, 549, 547, 543, 549, 548, 547, 550, 551, 548, 550, 547, 549,
+	552, 550, 547, 552, 549, 545, 553, 545, 546, 553, 551, 550, 554, 555, 551, 554,
+	554, 550, 556, 550, 552, 556, 555, 554, 557, 558, 555, 557, 554, 556, 559, 557,
+	554, 559, 558, 557, 560, 561, 558, 560, 557, 559, 562, 560, 557, 562, 561, 560,
+	563, 564, 561, 563, 560, 562, 565, 563, 560, 565, 564, 563, 566, 567, 564, 566,
+	563, 565, 568, 566, 563, 568, 567, 566, 569, 570, 567, 569, 566, 568, 571, 569,
+	566, 571, 570, 569, 572, 573, 570, 572, 569, 571, 574, 572, 569, 574, 573, 572,
+	575, 576, 573, 575, 572, 574, 577, 575, 572, 577, 576, 575, 578, 579, 576, 578,
+	575, 577, 580, 578, 575, 580, 579, 578, 581, 582, 579, 581, 578, 580, 583, 581,
+	578, 583, 582, 581, 584, 585, 582, 584, 581, 583, 586, 584, 581, 586, 585, 584,
+	587, 588, 585, 587, 584, 586, 589, 587, 584, 589, 588, 587, 590, 591, 588, 590,
+	587, 589, 592, 590, 587, 592, 591, 590, 593, 594, 591, 593, 590, 592, 595, 593,
+	590, 595, 594, 593, 596, 597, 594, 596, 593, 595, 598, 596, 593, 598, 597, 596,
+	599, 600, 597, 599, 596, 598, 601, 599, 596, 601, 600, 599, 602, 603, 600, 602,
+	599, 601, 604, 602, 599, 604, 603, 602, 605, 606, 603, 605, 602, 604, 342, 605,
+	602, 342, 606, 605, 607, 608, 606, 607, 605, 342, 339, 607, 605, 339, 608, 607,
+	609, 610, 608, 609, 607, 339, 337, 609, 607, 337, 610, 609, 611, 612, 610, 611,
+	609, 337, 333, 611, 609, 333, 612, 611, 613, 614, 612, 613, 611, 333, 330, 613,
+	611, 330, 614, 613, 615, 616, 614, 615, 613, 330, 328, 615, 613, 328, 616, 615,
+	617, 618, 616, 617, 615, 328, 324, 617, 615, 324, 618, 617, 619, 620, 618, 619,
+	617, 324, 321, 619, 617, 321, 620, 619, 621, 622, 620, 621, 619, 321, 319, 621,
+	619, 319, 622, 621, 623, 624, 622, 623, 621, 319, 315, 623, 621, 315, 624, 623,
+	625, 626, 624, 625, 623, 315, 312, 625, 623, 312, 626, 625, 627, 628, 626, 627,
+	625, 312, 309, 627, 625, 309, 628, 627, 629, 630, 628, 629, 627, 309, 307, 629,
+	627, 307, 630, 629, 631, 632, 630, 631, 629, 307, 304, 631, 629, 304, 632, 631,
+	633, 634, 632, 633, 631, 304, 303, 633, 631, 303, 634, 633, 635, 636, 634, 635,
+	636, 635, 637, 635, 633, 638, 633, 303, 638, 637, 635, 639, 635, 638, 639, 637,
+	639, 640, 638, 303, 301, 640, 639, 641, 640, 641, 642, 639, 638, 643, 639, 643,
+	641, 638, 301, 643, 642, 641, 644, 642, 644, 645, 641, 643, 646, 641, 646, 644,
+	645, 644, 647, 645, 647, 648, 644, 646, 649, 644, 649, 647, 643, 299, 646, 643,
+	301, 299, 646, 296, 649, 646, 299, 296, 647, 649, 650, 648, 647, 651, 647, 650,
+	651, 648, 651, 652, 649, 293, 650, 649, 296, 293, 652, 651, 653, 652, 653, 654,
+	651, 650, 655, 651, 655, 653, 654, 653, 656, 654, 656, 657, 653, 655, 658, 653,
+	658, 656, 650, 290, 655, 650, 293, 290, 655, 287, 658, 655, 290, 287, 656, 658,
+	659, 657, 656, 660, 656, 659, 660, 657, 660, 661, 658, 284, 659, 658, 287, 284,
+	661, 660, 662, 661, 662, 663, 660, 659, 664, 660, 664, 662, 663, 662, 665, 663,
+	665, 666, 662, 664, 667, 662, 667, 665, 659, 281, 664, 659, 284, 281, 664, 278,
+	667, 664, 281, 278, 665, 667, 668, 666, 665, 669, 665, 668, 669, 666, 669, 670,
+	667, 275, 668, 667, 278, 275, 670, 669, 671, 670, 671, 672, 669, 668, 673, 669,
+	673, 671, 672, 671, 674, 672, 674, 675, 671, 673, 676, 671, 676, 674, 668, 272,
+	673, 668, 275, 272, 673, 269, 676, 673, 272, 269, 674, 676, 677, 675, 674, 678,
+	674, 677, 678, 675, 678, 679, 676, 266, 677, 676, 269, 266, 679, 678, 680, 679,
+	680, 681, 678, 677, 682, 678, 682, 680, 681, 680, 683, 681, 683, 684, 680, 682,
+	685, 680, 685, 683, 677, 264, 682, 677, 266, 264, 682, 260, 685, 682, 264, 260,
+	683, 685, 686, 684, 683, 687, 683, 686, 687, 684, 687, 688, 685, 257, 686, 685,
+	260, 257, 688, 687, 689, 688, 689, 690, 687, 686, 691, 687, 691, 689, 690, 689,
+	692, 690, 692, 693, 689, 691, 694, 689, 694, 692, 686, 255, 691, 686, 257, 255,
+	691, 254, 694, 691, 255, 254, 692, 694, 695, 693, 692, 696, 692, 695, 696, 693,
+	696, 697, 694, 698, 695, 694, 254, 698, 697, 696, 699, 697, 699, 700, 696, 695,
+	701, 696, 701, 699, 700, 699, 702, 700, 702, 703, 703, 702, 704, 699, 705, 702,
+	699, 701, 705, 702, 706, 704, 702, 705, 706, 704, 706, 707, 706, 708, 707, 706,
+	709, 708, 705, 709, 706, 709, 710, 708, 705, 711, 709, 701, 711, 705, 709, 712,
+	710, 711, 712, 709, 712, 713, 710, 701, 714, 711, 695, 714, 701, 695, 698, 714,
+	711, 715, 712, 714, 715, 711, 712, 716, 713, 715, 716, 712, 716, 717, 713, 714,
+	718, 715, 698, 718, 714, 715, 719, 716, 718, 719, 715, 716, 720, 717, 719, 720,
+	716, 448, 721, 449, 450, 721, 448, 449, 722, 74, 721, 722, 449, 722, 71, 74,
+	438, 509, 450, 435, 509, 438, 722, 723, 71, 723, 68, 71, 721, 724, 722, 724,
+	723, 722, 450, 512, 721, 512, 724, 721, 509, 512, 450, 723, 725, 68, 725, 65,
+	68, 724, 726, 723, 726, 725, 723, 512, 513, 724, 513, 726, 724, 725, 727, 65,
+	727, 62, 65, 726, 728, 725, 728, 727, 725, 727, 729, 62, 729, 59, 62, 728,
+	730, 727, 730, 729, 727, 515, 728, 726, 513, 515, 726, 517, 730, 728, 515, 517,
+	728, 729, 731, 59, 731, 56, 59, 730, 732, 729, 732, 731, 729, 731, 733, 56,
+	733, 53, 56, 732, 734, 731, 734, 733, 731, 520, 732, 730, 517, 520, 730, 735,
+	734, 732, 520, 735, 732, 733, 736, 53, 736, 50, 53, 734, 737, 733, 737, 736,
+	733, 736, 738, 50, 738, 47, 50, 737, 739, 736, 739, 738, 736, 740, 737, 734,
+	735, 740, 734, 741, 739, 737, 740, 741, 737, 738, 742, 47, 742, 44, 47, 739,
+	743, 738, 743, 742, 738, 742, 744, 44, 744, 41, 44, 743, 745, 742, 745, 744,
+	742, 746, 743, 739, 741, 746, 739, 747, 745, 743, 746, 747, 743, 744, 748, 41,
+	748, 38, 41, 745, 749, 744, 749, 748, 744, 748, 750, 38, 750, 35, 38, 749,
+	751, 748, 751, 750, 748, 752, 749, 745, 747, 752, 745, 753, 751, 749, 752, 753,
+	749, 750, 754, 35, 754, 32, 35, 751, 755, 750, 755, 754, 750, 754, 756, 32,
+	756, 29, 32, 755, 757, 754, 757, 756, 754, 758, 755, 751, 753, 758, 751, 759,
+	757, 755, 758, 759, 755, 756, 760, 29, 760, 26, 29, 757, 761, 756, 761, 760,
+	756, 760, 451, 26, 451, 23, 26, 761, 454, 760, 454, 451, 760, 762, 761, 757,
+	759, 762, 757, 459, 454, 761, 762, 459, 761, 763, 764, 765, 766, 767, 768, 763,
+	765, 769, 769, 765, 770, 767, 763, 771, 771, 763, 769, 768, 767, 771, 769, 770,
+	772, 772, 770, 773, 771, 769, 774, 774, 769, 772, 768, 771, 775, 775, 771, 774,
+	772, 773, 776, 776, 773, 777, 774, 772, 778, 778, 772, 776, 775, 774, 779, 779,
+	774, 778, 776, 777, 780, 780, 777, 781, 778, 776, 782, 782, 776, 780, 779, 778,
+	783, 783, 778, 782, 780, 781, 784, 784, 781, 785, 782, 780, 786, 786, 780, 784,
+	783, 782, 787, 787, 782, 786, 784, 785, 788, 788, 785, 789, 786, 784, 790, 790,
+	784, 788, 787, 786, 791, 791, 786, 790, 788, 789, 792, 792, 789, 793, 790, 788,
+	794, 794, 788, 792, 791, 790, 795, 795, 790, 794, 792, 793, 796, 796, 793, 797,
+	794, 792, 798, 798, 792, 796, 795, 794, 799, 799, 794, 798, 796, 797, 800, 800,
+	797, 801, 798, 796, 802, 802, 796, 800, 799, 798, 803, 803, 798, 802, 800, 801,
+	804, 804, 801, 805, 802, 800, 806, 806, 800, 804, 803, 802, 807, 807, 802, 806,
+	804, 805, 808, 808, 805, 809, 806, 804, 810, 810, 804, 808, 807, 806, 811, 811,
+	806, 810, 808, 809, 812, 812, 809, 813, 810, 808, 814, 814, 808, 812, 811, 810,
+	10, 10, 810, 814, 812, 813, 815, 815, 813, 816, 814, 812, 817, 817, 812, 815,
+	10, 814, 7, 7, 814, 817, 815, 816, 818, 818, 816, 819, 817, 815, 820, 820,
+	815, 818, 7, 817, 4, 4, 817, 820, 818, 819, 821, 821, 819, 822, 820, 818,
+	823, 823, 818, 821, 4, 820, 1, 1, 820, 823, 821, 822, 824, 824, 822, 825,
+	824, 825, 826, 827, 824, 826, 828, 821, 824, 828, 824, 827, 823, 821, 828, 829,
+	828, 827, 2, 828, 829, 2, 823, 828, 1, 823, 2, 522, 735, 520, 499, 830,
+	521, 521, 830, 522, 499, 497, 830, 522, 831, 735, 830, 831, 522, 831, 740, 735,
+	497, 832, 830, 830, 832, 831, 497, 495, 832, 831, 833, 740, 832, 833, 831, 833,
+	741, 740, 495, 834, 832, 832, 834, 833, 495, 493, 834, 833, 835, 741, 834, 835,
+	833, 835, 746, 741, 493, 836, 834, 834, 836, 835, 493, 491, 836, 835, 837, 746,
+	836, 837, 835, 837, 747, 746, 491, 838, 836, 836, 838, 837, 491, 489, 838, 837,
+	839, 747, 838, 839, 837, 839, 752, 747, 489, 840, 838, 838, 840, 839, 489, 487,
+	840, 839, 841, 752, 840, 841, 839, 841, 753, 752, 487, 842, 840, 840, 842, 841,
+	487, 485, 842, 841, 843, 753, 842, 843, 841, 843, 758, 753, 485, 844, 842, 842,
+	844, 843, 485, 482, 844, 843, 845, 758, 844, 845, 843, 845, 759, 758, 482, 846,
+	844, 844, 846, 845, 482, 480, 846, 480, 483, 846, 845, 847, 759, 846, 847, 845,
+	846, 483, 847, 847, 762, 759, 483, 848, 847, 847, 848, 762, 483, 476, 848, 848,
+	459, 762, 476, 849, 848, 848, 849, 459, 476, 472, 849, 849, 458, 459, 472, 463,
+	849, 849, 463, 458, 850, 851, 852, 850, 853, 851, 854, 852, 855, 854, 850, 852,
+	856, 853, 850, 856, 857, 853, 858, 850, 854, 858, 856, 850, 789, 854, 855, 789,
+	855, 793, 785, 858, 854, 785, 854, 789, 859, 857, 856, 859, 860, 857, 861, 856,
+	858, 861, 859, 856, 862, 860, 859, 862, 863, 860, 864, 859, 861, 864, 862, 859,
+	781, 861, 858, 781, 858, 785, 777, 864, 861, 777, 861, 781, 865, 863, 862, 865,
+	866, 863, 867, 862, 864, 867, 865, 862, 868, 866, 865, 868, 869, 866, 870, 865,
+	867, 870, 868, 865, 773, 867, 864, 773, 864, 777, 770, 870, 867, 770, 867, 773,
+	871, 869, 868, 871, 872, 869, 873, 868, 870, 873, 871, 868, 874, 872, 871, 874,
+	875, 872, 876, 871, 873, 876, 874, 871, 765, 873, 870, 765, 870, 770, 764, 876,
+	873, 764, 873, 765, 877, 875, 874, 877, 878, 875, 879, 874, 876, 879, 877, 874,
+	880, 878, 877, 880, 881, 878, 882, 877, 879, 882, 880, 877, 883, 879, 876, 883,
+	876, 764, 884, 882, 879, 884, 879, 883, 885, 881, 880, 885, 886, 881, 887, 880,
+	882, 887, 885, 880, 888, 886, 885, 888, 889, 886, 890, 885, 887, 890, 888, 885,
+	891, 887, 882, 891, 882, 884, 538, 890, 887, 538, 887, 891, 892, 889, 888, 892,
+	893, 889, 894, 888, 890, 894, 892, 888, 895, 893, 892, 895, 896, 893, 897, 892,
+	894, 897, 895, 892, 533, 894, 890, 533, 890, 538, 529, 897, 894, 529, 894, 533,
+	898, 896, 895, 898, 899, 896, 900, 895, 897, 900, 898, 895, 901, 899, 898, 901,
+	902, 899, 903, 904, 902, 903, 902, 901, 905, 903, 901, 906, 901, 898, 905, 901,
+	906, 906, 898, 900, 907, 905, 906, 907, 906, 524, 524, 906, 900, 523, 907, 524,
+	526, 900, 897, 524, 900, 526, 526, 897, 529, 185, 908, 187, 186, 909, 185, 185,
+	909, 908, 186, 910, 909, 187, 908, 404, 187, 404, 189, 910, 911, 909, 910, 912,
+	911, 909, 913, 908, 909, 911, 913, 912, 914, 911, 912, 915, 914, 911, 916, 913,
+	911, 914, 916, 908, 913, 401, 908, 401, 404, 913, 916, 398, 913, 398, 401, 914,
+	917, 916, 915, 918, 914, 914, 918, 917, 915, 919, 918, 916, 917, 395, 916, 395,
+	398, 919, 920, 918, 919, 921, 920, 918, 922, 917, 918, 920, 922, 921, 923, 920,
+	921, 924, 923, 920, 925, 922, 920, 923, 925, 917, 922, 392, 917, 392, 395, 922,
+	925, 389, 922, 389, 392, 923, 926, 925, 924, 927, 923, 923, 927, 926, 924, 928,
+	927, 925, 926, 385, 925, 385, 389, 928, 929, 927, 928, 930, 929, 927, 931, 926,
+	927, 929, 931, 930, 932, 929, 930, 933, 932, 929, 934, 931, 929, 932, 934, 926,
+	931, 382, 926, 382, 385, 931, 934, 378, 931, 378, 382, 932, 935, 934, 933, 936,
+	932, 932, 936, 935, 933, 937, 936, 934, 935, 374, 934, 374, 378, 937, 938, 936,
+	937, 939, 938, 936, 940, 935, 936, 938, 940, 939, 941, 938, 939, 942, 941, 938,
+	943, 940, 938, 941, 943, 935, 940, 371, 935, 371, 374, 940, 943, 367, 940, 367,
+	371, 941, 944, 943, 942, 945, 941, 941, 945, 944, 942, 946, 945, 943, 944, 364,
+	943, 364, 367, 946, 947, 945, 946, 948, 947, 945, 949, 944, 945, 947, 949, 948,
+	950, 947, 948, 951, 950, 947, 952, 949, 947, 950, 952, 944, 949, 362, 944, 362,
+	364, 949, 952, 361, 949, 361, 362, 720, 953, 717, 698, 251, 718, 254, 251, 698,
+	720, 954, 953, 954, 955, 953, 719, 956, 720, 956, 954, 720, 718, 250, 719, 250,
+	956, 719, 251, 250, 718, 954, 957, 955, 957, 958, 955, 956, 959, 954, 959, 957,
+	954, 250, 247, 956, 247, 959, 956, 957, 960, 958, 960, 961, 958, 959, 962, 957,
+	962, 960, 957, 960, 963, 961, 963, 964, 961, 962, 965, 960, 965, 963, 960, 244,
+	962, 959, 247, 244, 959, 242, 965, 962, 244, 242, 962, 963, 966, 964, 966, 967,
+	964, 965, 968, 963, 968, 966, 963, 966, 969, 967, 969, 970, 967, 968, 971, 966,
+	971, 969, 966, 240, 968, 965, 242, 240, 965, 238, 971, 968, 240, 238, 968, 969,
+	972, 970, 972, 973, 970, 971, 974, 969, 974, 972, 969, 972, 975, 973, 975, 976,
+	973, 974, 977, 972, 977, 975, 972, 236, 974, 971, 238, 236, 971, 234, 977, 974,
+	236, 234, 974, 975, 978, 976, 978, 979, 976, 977, 980, 975, 980, 978, 975, 978,
+	981, 979, 981, 982, 979, 980, 983, 978, 983, 981, 978, 232, 980, 977, 234, 232,
+	977, 230, 983, 980, 232, 230, 980, 981, 984, 982, 984, 985, 982, 983, 986, 981,
+	986, 984, 981, 984, 987, 985, 987, 988, 985, 986, 989, 984, 989, 987, 984, 228,
+	986, 983, 230, 228, 983, 226, 989, 986, 228, 226, 986, 987, 990, 988, 990, 991,
+	988, 989, 992, 987, 992, 990, 987, 990, 993, 991, 993, 994, 991, 992, 995, 990,
+	995, 993, 990, 224, 992, 989, 226, 224, 989, 222, 995, 992, 224, 222, 992, 993,
+	996, 994, 996, 997, 994, 995, 998, 993, 998, 996, 993, 996, 999, 997, 999, 1000,
+	997, 998, 1001, 996, 1001, 999, 996, 220, 998, 995, 222, 220, 995, 218, 1001, 998,
+	220, 218, 998, 999, 1002, 1000, 1002, 1003, 1000, 1001, 1004, 999, 1004, 1002, 999, 1002,
+	1005, 1003, 1005, 1006, 1003, 1004, 1007, 1002, 1007, 1005, 1002, 216, 1004, 1001, 218, 216,
+	1001, 214, 1007, 1004, 216, 214, 1004, 1005, 1008, 1006, 1008, 1009, 1006, 1007, 1010, 1005,
+	1010, 1008, 1005, 1008, 1011, 1009, 1011, 1012, 1009, 1010, 1013, 1008, 1013, 1011, 1008, 212,
+	1010, 1007, 214, 212, 1007, 210, 1013, 1010, 212, 210, 1010, 1014, 1015, 1016, 1015, 1017,
+	1016, 1018, 1019, 1014, 1019, 1015, 1014, 1015, 1020, 1017, 1020, 1021, 1017, 1019, 1022, 1015,
+	1022, 1020, 1015, 1023, 1019, 1018, 1024, 1023, 1018, 1025, 1022, 1019, 1023, 1025, 1019, 1020,
+	1026, 1021, 1026, 1027, 1021, 1022, 1028, 1020, 1028, 1026, 1020, 1026, 1029, 1027, 1029, 1030,
+	1027, 1028, 1031, 1026, 1031, 1029, 1026, 1032, 1028, 1022, 1025, 1032, 1022, 1033, 1031, 1028,
+	1032, 1033, 1028, 1029, 1034, 1030, 1034, 1035, 1030, 1031, 1036, 1029, 1036, 1034, 1029, 1034,
+	1037, 1035, 1037, 1038, 1035, 1036, 1039, 1034, 1039, 1037, 1034, 1040, 1036, 1031, 1033, 1040,
+	1031, 1041, 1039, 1036, 1040, 1041, 1036, 1037, 1042, 1038, 1042, 1043, 1038, 1039, 1044, 1037,
+	1044, 1042, 1037, 1042, 1045, 1043, 1045, 1046, 1043, 1044, 826, 1042, 826, 1045, 1042, 1047,
+	1044, 1039, 1041, 1047, 1039, 827, 826, 1044, 1047, 827, 1044, 1045, 1048, 1046, 1048, 1049,
+	1046, 826, 825, 1045, 825, 1048, 1045, 1048, 1050, 1049, 1050, 1051, 1049, 1050, 1052, 1051,
+	1053, 1050, 1048, 825, 1053, 1048, 1054, 1052, 1050, 1053, 1054, 1050, 1054, 1055, 1052, 822,
+	1053, 825, 1056, 1055, 1054, 1056, 1057, 1055, 1058, 1054, 1053, 1058, 1056, 1054, 822, 1058,
+	1053, 1059, 1057, 1056, 1059, 1060, 1057, 1061, 1056, 1058, 1061, 1059, 1056, 1062, 1060, 1059,
+	1062, 1063, 1060, 1064, 1059, 1061, 1064, 1062, 1059, 819, 1061, 1058, 819, 1058, 822, 816,
+	1064, 1061, 816, 1061, 819, 1065, 1063, 1062, 1065, 1066, 1063, 1067, 1062, 1064, 1067, 1065,
+	1062, 1068, 1066, 1065, 1068, 1069, 1066, 1070, 1065, 1067, 1070, 1068, 1065, 813, 1067, 1064,
+	813, 1064, 816, 809, 1070, 1067, 809, 1067, 813, 1071, 1069, 1068, 1071, 1072, 1069, 1073,
+	1068, 1070, 1073, 1071, 1068, 1074, 1072, 1071, 1074, 1075, 1072, 1076, 1071, 1073, 1076, 1074,
+	1071, 805, 1073, 1070, 805, 1070, 809, 801, 1076, 1073, 801, 1073, 805, 1077, 1075, 1074,
+	1077, 1078, 1075, 1079, 1074, 1076, 1079, 1077, 1074, 852, 1078, 1077, 852, 851, 1078, 855,
+	1077, 1079, 855, 852, 1077, 797, 1079, 1076, 797, 1076, 801, 793, 855, 1079, 793, 1079,
+	797, 1080, 787, 1081, 1082, 1080, 1081, 1081, 787, 791, 357, 1082, 354, 1081, 791, 1083,
+	1083, 791, 795, 1082, 1081, 1084, 1084, 1081, 1083, 354, 1082, 1084, 1083, 795, 1085, 1085,
+	795, 799, 1084, 1083, 1086, 1086, 1083, 1085, 354, 1084, 351, 351, 1084, 1086, 1085, 799,
+	1087, 1087, 799, 803, 1086, 1085, 1088, 1088, 1085, 1087, 351, 1086, 347, 347, 1086, 1088,
+	1087, 803, 1089, 1089, 803, 807, 1088, 1087, 1090, 1090, 1087, 1089, 347, 1088, 345, 345,
+	1088, 1090, 1089, 807, 1091, 1091, 807, 811, 1090, 1089, 1092, 1092, 1089, 1091, 345, 1090,
+	1093, 1093, 1090, 1092, 1091, 811, 1094, 1094, 811, 10, 1094, 10, 9, 1092, 1091, 1095,
+	1095, 1091, 1094, 1096, 1094, 9, 1095, 1094, 1096, 1096, 9, 11, 1097, 1092, 1095, 1093,
+	1092, 1097, 1098, 1095, 1096, 1097, 1095, 1098, 1099, 1096, 11, 1098, 1096, 1099, 1099, 11,
+	15, 19, 1099, 15, 1100, 1098, 1099, 1100, 1099, 19, 1101, 1097, 1098, 1101, 1098, 1100,
+	1102, 1093, 1097, 1102, 1097, 1101, 453, 1100, 19, 453, 19, 22, 457, 1101, 1100, 457,
+	1100, 453, 462, 1102, 1101, 462, 1101, 457, 346, 1093, 1102, 346, 345, 1093, 349, 1102,
+	462, 349, 346, 1102, 1011, 1103, 1012, 1103, 1104, 1012, 1013, 1105, 1011, 1105, 1103, 1011,
+	1103, 1106, 1104, 1106, 1107, 1104, 1105, 1108, 1103, 1108, 1106, 1103, 208, 1105, 1013, 210,
+	208, 1013, 206, 1108, 1105, 208, 206, 1105, 1106, 1109, 1107, 1109, 1110, 1107, 1108, 1111,
+	1106, 1111, 1109, 1106, 1109, 1112, 1110, 1112, 1024, 1110, 1111, 1113, 1109, 1113, 1112, 1109,
+	204, 1111, 1108, 206, 204, 1108, 202, 1113, 1111, 204, 202, 1111, 1112, 1114, 1024, 1114,
+	1023, 1024, 1113, 1115, 1112, 1115, 1114, 1112, 1114, 1116, 1023, 1116, 1025, 1023, 1115, 1117,
+	1114, 1117, 1116, 1114, 200, 1115, 1113, 202, 200, 1113, 198, 1117, 1115, 200, 198, 1115,
+	1116, 1118, 1025, 1118, 1032, 1025, 1117, 1119, 1116, 1119, 1118, 1116, 1118, 1120, 1032, 1120,
+	1033, 1032, 1119, 1121, 1118, 1121, 1120, 1118, 196, 1119, 1117, 198, 196, 1117, 194, 1121,
+	1119, 196, 194, 1119, 1120, 1122, 1033, 1122, 1040, 1033, 1121, 1123, 1120, 1123, 1122, 1120,
+	1122, 1124, 1040, 1124, 1041, 1040, 1123, 1125, 1122, 1125, 1124, 1122, 193, 1123, 1121, 194,
+	193, 1121, 1126, 1125, 1123, 193, 1126, 1123, 1124, 1127, 1041, 1127, 1047, 1041, 1125, 1128,
+	1124, 1128, 1127, 1124, 1127, 829, 1047, 829, 827, 1047, 1128, 1129, 1127, 1129, 829, 1127,
+	1130, 1128, 1125, 1126, 1130, 1125, 1131, 1129, 1128, 1130, 1131, 1128, 1129, 2, 829, 190,
+	1130, 1126, 1131, 0, 1129, 0, 2, 1129, 13, 1131, 1130, 190, 13, 1130, 5, 0,
+	1131, 13, 5, 1131, 192, 190, 1126, 192, 1126, 193, 1132, 1133, 1134, 562, 1135, 1132,
+	1132, 1135, 1133, 562, 559, 1135, 1134, 1133, 951, 1134, 951, 948, 559, 1136, 1135, 559,
+	556, 1136, 1135, 1137, 1133, 1135, 1136, 1137, 556, 1138, 1136, 556, 552, 1138, 1136, 1139,
+	1137, 1136, 1138, 1139, 1133, 1137, 1140, 1133, 1140, 951, 1137, 1139, 1141, 1137, 1141, 1140,
+	1138, 1142, 1139, 552, 1143, 1138, 1138, 1143, 1142, 552, 549, 1143, 549, 553, 1143, 1139,
+	1142, 1144, 1139, 1144, 1141, 1143, 1145, 1142, 1143, 553, 1145, 1142, 1146, 1144, 1142, 1145,
+	1146, 553, 1147, 1145, 553, 546, 1147, 1145, 1148, 1146, 1145, 1147, 1148, 546, 1149, 1147,
+	546, 542, 1149, 542, 537, 1149, 1147, 1149, 1150, 1147, 1150, 1148, 1149, 537, 1151, 1149,
+	1151, 1150, 537, 538, 1151, 1151, 538, 891, 1151, 891, 1152, 1150, 1151, 1152, 1152, 891,
+	884, 1150, 1152, 1153, 1148, 1150, 1153, 1152, 884, 1154, 1153, 1152, 1154, 1154, 884, 883,
+	1148, 1153, 1155, 1146, 1148, 1155, 1153, 1154, 1156, 1155, 1153, 1156, 1154, 883, 1157, 1156,
+	1154, 1157, 1157, 883, 764, 1146, 1155, 1158, 1144, 1146, 1158, 1155, 1156, 766, 1158, 1155,
+	766, 1156, 1157, 767, 766, 1156, 767, 1157, 764, 763, 767, 1157, 763, 341, 1159, 343,
+	342, 1160, 341, 341, 1160, 1159, 342, 604, 1160, 343, 1159, 186, 343, 186, 183, 604,
+	1161, 1160, 604, 601, 1161, 1160, 1162, 1159, 1160, 1161, 1162, 601, 1163, 1161, 601, 598,
+	1163, 1161, 1164, 1162, 1161, 1163, 1164, 1159, 1162, 910, 1159, 910, 186, 1162, 1164, 912,
+	1162, 912, 910, 1163, 1165, 1164, 598, 1166, 1163, 1163, 1166, 1165, 598, 595, 1166, 1164,
+	1165, 915, 1164, 915, 912, 595, 1167, 1166, 595, 592, 1167, 1166, 1168, 1165, 1166, 1167,
+	1168, 592, 1169, 1167, 592, 589, 1169, 1167, 1170, 1168, 1167, 1169, 1170, 1165, 1168, 919,
+	1165, 919, 915, 1168, 1170, 921, 1168, 921, 919, 1169, 1171, 1170, 589, 1172, 1169, 1169,
+	1172, 1171, 589, 586, 1172, 1170, 1171, 924, 1170, 924, 921, 586, 1173, 1172, 586, 583,
+	1173, 1172, 1174, 1171, 1172, 1173, 1174, 583, 1175, 1173, 583, 580, 1175, 1173, 1176, 1174,
+	1173, 1175, 1176, 1171, 1174, 928, 1171, 928, 924, 1174, 1176, 930, 1174, 930, 928, 1175,
+	1177, 1176, 580, 1178, 1175, 1175, 1178, 1177, 580, 577, 1178, 1176, 1177, 933, 1176, 933,
+	930, 577, 1179, 1178, 577, 574, 1179, 1178, 1180, 1177, 1178, 1179, 1180, 574, 1181, 1179,
+	574, 571, 1181, 1179, 1182, 1180, 1179, 1181, 1182, 1177, 1180, 937, 1177, 937, 933, 1180,
+	1182, 939, 1180, 939, 937, 1181, 1183, 1182, 571, 1184, 1181, 1181, 1184, 1183, 571, 568,
+	1184, 1182, 1183, 942, 1182, 942, 939, 568, 1185, 1184, 568, 565, 1185, 1184, 1186, 1183,
+	1184, 1185, 1186, 565, 1132, 1185, 565, 562, 1132, 1185, 1134, 1186, 1185, 1132, 1134, 1183,
+	1186, 946, 1183, 946, 942, 1186, 1134, 948, 1186, 948, 946, 950, 1187, 952, 951, 1188,
+	950, 950, 1188, 1187, 951, 1140, 1188, 952, 1187, 1189, 952, 1189, 361, 1140, 1190, 1188,
+	1140, 1141, 1190, 1188, 1191, 1187, 1188, 1190, 1191, 1141, 1192, 1190, 1141, 1144, 1192, 1144,
+	1158, 1192, 1190, 1192, 1193, 1190, 1193, 1191, 1192, 1158, 1194, 1192, 1194, 1193, 1158, 766,
+	1194, 1194, 766, 768, 1194, 768, 1195, 1193, 1194, 1195, 1195, 768, 775, 1193, 1195, 1196,
+	1191, 1193, 1196, 1195, 775, 1197, 1196, 1195, 1197, 1197, 775, 779, 1191, 1196, 1198, 1187,
+	1191, 1198, 1187, 1198, 1189, 1196, 1197, 1199, 1198, 1196, 1199, 1197, 779, 1200, 1199, 1197,
+	1200, 1200, 779, 783, 1198, 1199, 1201, 1189, 1198, 1201, 1199, 1200, 1202, 1201, 1199, 1202,
+	1200, 783, 1080, 1202, 1200, 1080, 1080, 783, 787, 1189, 1201, 358, 361, 1189, 358, 1201,
+	1202, 357, 358, 1201, 357, 1202, 1080, 1082, 357, 1202, 1082, 1203, 1204, 1205, 1203, 1206,
+	1204, 1207, 1206, 1203, 1206, 1208, 1204, 1207, 1209, 1206, 1210, 1209, 1207, 1206, 1211, 1208,
+	1209, 1211, 1206, 1211, 1212, 1208, 1210, 1213, 1209, 1214, 1213, 1210, 1209, 1215, 1211, 1213,
+	1215, 1209, 1211, 1216, 1212, 1215, 1216, 1211, 1216, 1217, 1212, 1214, 704, 1213, 703, 704,
+	1214, 1216, 1218, 1217, 1218, 1219, 1217, 1215, 1220, 1216, 1220, 1218, 1216, 1213, 707, 1215,
+	707, 1220, 1215, 704, 707, 1213, 1218, 1221, 1219, 1221, 1222, 1219, 1220, 1223, 1218, 1223,
+	1221, 1218, 707, 708, 1220, 708, 1223, 1220, 1221, 1224, 1222, 1224, 1225, 1222, 1223, 1226,
+	1221, 1226, 1224, 1221, 1224, 1227, 1225, 1227, 1228, 1225, 1226, 1229, 1224, 1229, 1227, 1224,
+	710, 1226, 1223, 708, 710, 1223, 713, 1229, 1226, 710, 713, 1226, 1227, 1230, 1228, 1230,
+	1231, 1228, 1229, 1232, 1227, 1232, 1230, 1227, 1230, 1233, 1231, 1233, 1234, 1231, 1232, 1235,
+	1230, 1235, 1233, 1230, 717, 1232, 1229, 713, 717, 1229, 953, 1235, 1232, 717, 953, 1232,
+	1233, 1236, 1234, 1236, 1237, 1234, 1235, 1238, 1233, 1238, 1236, 1233, 1236, 1239, 1237, 1239,
+	1240, 1237, 1238, 1241, 1236, 1241, 1239, 1236, 955, 1238, 1235, 953, 955, 1235, 958, 1241,
+	1238, 955, 958, 1238, 1239, 1242, 1240, 1242, 1243, 1240, 1241, 1244, 1239, 1244, 1242, 1239,
+	1242, 1245, 1243, 1245, 1246, 1243, 1244, 1247, 1242, 1247, 1245, 1242, 961, 1244, 1241, 958,
+	961, 1241, 964, 1247, 1244, 961, 964, 1244, 1245, 1248, 1246, 1248, 1249, 1246, 1247, 1250,
+	1245, 1250, 1248, 1245, 1248, 1251, 1249, 1251, 1252, 1249, 1250, 1253, 1248, 1253, 1251, 1248,
+	967, 1250, 1247, 964, 967, 1247, 970, 1253, 1250, 967, 970, 1250, 1251, 1254, 1252, 1254,
+	1255, 1252, 1253, 1256, 1251, 1256, 1254, 1251, 1254, 1257, 1255, 1257, 1258, 1255, 1256, 1259,
+	1254, 1259, 1257, 1254, 973, 1256, 1253, 970, 973, 1253, 976, 1259, 1256, 973, 976, 1256,
+	1257, 1260, 1258, 1260, 1261, 1258, 1259, 1262, 1257, 1262, 1260, 1257, 1260, 1263, 1261, 1263,
+	1264, 1261, 1262, 1265, 1260, 1265, 1263, 1260, 979, 1262, 1259, 976, 979, 1259, 982, 1265,
+	1262, 979, 982, 1262, 1263, 1266, 1264, 1266, 1267, 1264, 1265, 1268, 1263, 1268, 1266, 1263,
+	1266, 1269, 1267, 1269, 1270, 1267, 1268, 1271, 1266, 1271, 1269, 1266, 985, 1268, 1265, 982,
+	985, 1265, 988, 1271, 1268, 985, 988, 1268, 1269, 1272, 1270, 1272, 1273, 1270, 1271, 1274,
+	1269, 1274, 1272, 1269, 1272, 1275, 1273, 1275, 1276, 1273, 1274, 1277, 1272, 1277, 1275, 1272,
+	991, 1274, 1271, 988, 991, 1271, 994, 1277, 1274, 991, 994, 1274, 1275, 1278, 1276, 1278,
+	1279, 1276, 1277, 1280, 1275, 1280, 1278, 1275, 1278, 1281, 1279, 1281, 1282, 1279, 1280, 1283,
+	1278, 1283, 1281, 1278, 997, 1280, 1277, 994, 997, 1277, 1000, 1283, 1280, 997, 1000, 1280,
+	1281, 1284, 1282, 1284, 1285, 1282, 1283, 1286, 1281, 1286, 1284, 1281, 1284, 1287, 1285, 1287,
+	1288, 1285, 1286, 1289, 1284, 1289, 1287, 1284, 1003, 1286, 1283, 1000, 1003, 1283, 1006, 1289,
+	1286, 1003, 1006, 1286, 1287, 1290, 1288, 1290, 1291, 1288, 1289, 1292, 1287, 1292, 1290, 1287,
+	1290, 1293, 1291, 1293, 1294, 1291, 1292, 1295, 1290, 1295, 1293, 1290, 1009, 1292, 1289, 1006,
+	1009, 1289, 1012, 1295, 1292, 1009, 1012, 1292, 1293, 1296, 1294, 1296, 1297, 1294, 1295, 1298,
+	1293, 1298, 1296, 1293, 1296, 1299, 1297, 1299, 1300, 1297, 1298, 1301, 1296, 1301, 1299, 1296,
+	1104, 1298, 1295, 1012, 1104, 1295, 1107, 1301, 1298, 1104, 1107, 1298, 1299, 1302, 1300, 1302,
+	1303, 1300, 1301, 1304, 1299, 1304, 1302, 1299, 1302, 1014, 1303, 1014, 1016, 1303, 1304, 1018,
+	1302, 1018, 1014, 1302, 1110, 1304, 1301, 1107, 1110, 1301, 1024, 1018, 1304, 1110, 1024, 1304,
+	// ball level 6
+	0, 1, 2, 2, 1, 3, 2, 3, 4, 5, 0, 6, 6, 0, 2, 7,
+	2, 4, 6, 2, 7, 7, 4, 8, 9, 5, 6, 10, 5, 9, 11, 6,
+	7, 9, 6, 11, 12, 7, 8, 11, 7, 12, 12, 8, 13, 14, 12, 13,
+	15, 11, 12, 15, 12, 14, 16, 9, 11, 16, 11, 15, 17, 10, 9, 17,
+	9, 16, 18, 15, 14, 18, 14, 19, 20, 16, 15, 20, 15, 18, 21, 17,
+	16, 21, 16, 20, 22, 10, 17, 22, 23, 10, 24, 17, 21, 24, 22, 17,
+	25, 23, 22, 25, 26, 23, 27, 22, 24, 27, 25, 22, 28, 26, 25, 28,
+	29, 26, 30, 25, 27, 30, 28, 25, 31, 29, 28, 31, 32, 29, 33, 28,
+	30, 33, 31, 28, 34, 32, 31, 34, 35, 32, 36, 31, 33, 36, 34, 31,
+	37, 35, 34, 37, 38, 35, 39, 34, 36, 39, 37, 34, 40, 38, 37, 40,
+	41, 38, 42, 37, 39, 42, 40, 37, 43, 41, 40, 43, 44, 41, 45, 40,
+	42, 45, 43, 40, 46, 44, 43, 46, 47, 44, 48, 43, 45, 48, 46, 43,
+	49, 47, 46, 49, 50, 47, 51, 46, 48, 51, 49, 46, 52, 50, 49, 52,
+	53, 50, 54, 49, 51, 54, 52, 49, 55, 53, 52, 55, 56, 53, 57, 52,
+	54, 57, 55, 52, 58, 56, 55, 58, 59, 56, 60, 55, 57, 60, 58, 55,
+	61, 59, 58, 61, 62, 59, 63, 58, 60, 63, 61, 58, 64, 62, 61, 64,
+	65, 62, 66, 61, 63, 66, 64, 61, 67, 65, 64, 67, 68, 65, 69, 64,
+	66, 69, 67, 64, 70, 68, 67, 70, 71, 68, 72, 71, 70, 73, 70, 67,
+	73, 67, 69, 74, 72, 70, 74, 70, 73, 75, 72, 74, 76, 75, 74, 76,
+	74, 77, 77, 74, 73, 78, 76, 77, 77, 73, 79, 79, 73, 69, 78, 77,
+	80, 80, 77, 79, 81, 78, 80, 79, 69, 82, 82, 69, 66, 80, 79, 83,
+	83, 79, 82, 81, 80, 84, 84, 80, 83, 85, 81, 84, 82, 66, 86, 86,
+	66, 63, 85, 84, 87, 88, 85, 87, 84, 83, 89, 87, 84, 89, 83, 82,
+	90, 89, 83, 90, 90, 82, 86, 88, 87, 91, 92, 88, 91, 87, 89, 93,
+	91, 87, 93, 89, 90, 94, 93, 89, 94, 92, 91, 95, 96, 92, 95, 91,
+	93, 97, 95, 91, 97, 96, 95, 98, 99, 96, 98, 95, 97, 100, 98, 95,
+	100, 97, 93, 101, 93, 94, 101, 99, 98, 102, 103, 99, 102, 102, 98, 104,
+	98, 100, 104, 103, 102, 105, 106, 103, 105, 102, 104, 107, 105, 102, 107, 106,
+	105, 108, 109, 106, 108, 105, 107, 110, 108, 105, 110, 109, 108, 111, 112, 109,
+	111, 108, 110, 113, 111, 108, 113, 112, 111, 114, 115, 112, 114, 111, 113, 116,
+	114, 111, 116, 115, 114, 117, 118, 115, 117, 114, 116, 119, 117, 114, 119, 118,
+	117, 120, 121, 118, 120, 117, 119, 122, 120, 117, 122, 121, 120, 123, 124, 121,
+	123, 120, 122, 125, 123, 120, 125, 124, 123, 126, 127, 124, 126, 123, 125, 128,
+	126, 123, 128, 127, 126, 129, 130, 127, 129, 126, 128, 131, 129, 126, 131, 130,
+	129, 132, 133, 130, 132, 129, 131, 134, 132, 129, 134, 133, 132, 135, 136, 133,
+	135, 132, 134, 137, 135, 132, 137, 136, 135, 138, 139, 136, 138, 135, 137, 140,
+	138, 135, 140, 139, 138, 141, 142, 139, 141, 138, 140, 143, 141, 138, 143, 142,
+	141, 144, 145, 142, 144, 141, 143, 146, 144, 141, 146, 145, 144, 147, 148, 145,
+	147, 144, 146, 149, 147, 144, 149, 148, 147, 150, 151, 148, 150, 147, 149, 152,
+	150, 147, 152, 151, 150, 153, 154, 151, 153, 150, 152, 155, 153, 150, 155, 154,
+	153, 156, 157, 154, 156, 153, 155, 158, 156, 153, 158, 157, 156, 159, 160, 157,
+	159, 156, 158, 161, 159, 156, 161, 160, 159, 162, 163, 160, 162, 159, 161, 164,
+	162, 159, 164, 163, 162, 165, 166, 163, 165, 162, 164, 167, 165, 162, 167, 166,
+	165, 168, 169, 166, 168, 165, 167, 170, 168, 165, 170, 169, 168, 171, 172, 169,
+	171, 168, 170, 173, 171, 168, 173, 172, 171, 174, 175, 172, 174, 171, 173, 176,
+	174, 171, 176, 175, 174, 177, 178, 175, 177, 174, 176, 179, 177, 174, 179, 178,
+	177, 180, 181, 178, 180, 177, 179, 182, 180, 177, 182, 181, 180, 183, 184, 181,
+	183, 180, 182, 185, 183, 180, 185, 184, 183, 186, 187, 184, 186, 183, 185, 188,
+	186, 183, 188, 187, 186, 189, 190, 187, 189, 186, 188, 191, 189, 186, 191, 190,
+	189, 192, 193, 190, 192, 189, 191, 194, 192, 189, 194, 193, 192, 195, 196, 193,
+	195, 192, 194, 197, 195, 192, 197, 196, 195, 198, 199, 196, 198, 195, 197, 200,
+	198, 195, 200, 199, 198, 201, 202, 199, 201, 198, 200, 203, 201, 198, 203, 202,
+	201, 204, 205, 202, 204, 201, 203, 206, 204, 201, 206, 205, 204, 207, 208, 205,
+	207, 208, 207, 209, 207, 204, 210, 204, 206, 210, 209, 207, 211, 207, 210, 211,
+	209, 211, 212, 210, 206, 213, 212, 211, 214, 212, 214, 215, 211, 210, 216, 211,
+	216, 214, 210, 213, 216, 215, 214, 217, 215, 217, 218, 214, 216, 219, 214, 219,
+	217, 218, 217, 220, 218, 220, 221, 217, 219, 222, 217, 222, 220, 216, 223, 219,
+	216, 213, 223, 219, 224, 222, 219, 223, 224, 220, 222, 225, 221, 220, 226, 220,
+	225, 226, 221, 226, 227, 222, 228, 225, 222, 224, 228, 227, 226, 229, 227, 229,
+	230, 226, 225, 231, 226, 231, 229, 230, 229, 232, 230, 232, 233, 229, 231, 234,
+	229, 234, 232, 225, 235, 231, 225, 228, 235, 231, 236, 234, 231, 235, 236, 232,
+	234, 237, 233, 232, 238, 232, 237, 238, 233, 238, 239, 234, 240, 237, 234, 236,
+	240, 239, 238, 241, 239, 241, 242, 238, 237, 243, 238, 243, 241, 242, 241, 244,
+	242, 244, 245, 241, 243, 246, 241, 246, 244, 237, 247, 243, 237, 240, 247, 243,
+	248, 246, 243, 247, 248, 244, 246, 249, 245, 244, 250, 244, 249, 250, 245, 250,
+	251, 246, 252, 249, 246, 248, 252, 251, 250, 253, 251, 253, 254, 250, 249, 255,
+	250, 255, 253, 254, 253, 256, 254, 256, 257, 253, 255, 258, 253, 258, 256, 249,
+	259, 255, 249, 252, 259, 255, 260, 258, 255, 259, 260, 256, 258, 261, 257, 256,
+	262, 256, 261, 262, 257, 262, 263, 258, 264, 261, 258, 260, 264, 263, 262, 265,
+	263, 265, 266, 262, 261, 267, 262, 267, 265, 266, 265, 268, 266, 268, 269, 265,
+	267, 270, 265, 270, 268, 261, 271, 267, 261, 264, 271, 267, 272, 270, 267, 271,
+	272, 268, 270, 273, 269, 268, 274, 268, 273, 274, 269, 274, 275, 270, 276, 273,
+	270, 272, 276, 275, 274, 277, 275, 277, 278, 274, 273, 279, 274, 279, 277, 278,
+	277, 280, 278, 280, 281, 281, 280, 282, 277, 283, 280, 277, 279, 283, 280, 284,
+	282, 280, 283, 284, 282, 284, 285, 284, 286, 285, 284, 287, 286, 283, 287, 284,
+	287, 288, 286, 283, 289, 287, 279, 289, 283, 287, 290, 288, 289, 290, 287, 290,
+	291, 288, 279, 292, 289, 273, 292, 279, 273, 276, 292, 289, 293, 290, 292, 293,
+	289, 290, 294, 291, 293, 294, 290, 294, 295, 291, 292, 296, 293, 276, 296, 292,
+	293, 297, 294, 296, 297, 293, 298, 299, 300, 301, 298, 300, 302, 298, 301, 302,
+	303, 298, 304, 302, 301, 305, 303, 302, 305, 306, 303, 307, 302, 304, 307, 305,
+	302, 4, 306, 305, 4, 3, 306, 8, 305, 307, 8, 4, 305, 308, 307, 304,
+	308, 304, 309, 310, 308, 309, 13, 307, 308, 13, 8, 307, 311, 308, 310, 311,
+	13, 308, 312, 311, 310, 312, 310, 313, 14, 13, 311, 314, 312, 313, 314, 313,
+	315, 19, 311, 312, 19, 14, 311, 316, 312, 314, 316, 19, 312, 317, 314, 315,
+	317, 315, 318, 319, 316, 314, 319, 314, 317, 320, 317, 318, 320, 318, 321, 322,
+	319, 317, 322, 317, 320, 323, 320, 321, 323, 321, 324, 325, 322, 320, 325, 320,
+	323, 326, 323, 324, 326, 324, 327, 328, 325, 323, 328, 323, 326, 329, 326, 327,
+	329, 327, 330, 331, 328, 326, 331, 326, 329, 332, 329, 330, 332, 330, 333, 334,
+	331, 329, 334, 329, 332, 335, 332, 333, 335, 333, 336, 337, 334, 332, 337, 332,
+	335, 338, 335, 336, 338, 336, 339, 340, 337, 335, 340, 335, 338, 341, 338, 339,
+	341, 339, 342, 343, 340, 338, 343, 338, 341, 344, 341, 342, 344, 342, 345, 346,
+	343, 341, 346, 341, 344, 347, 344, 345, 347, 345, 348, 349, 346, 344, 349, 344,
+	347, 350, 347, 348, 350, 348, 351, 352, 349, 347, 352, 347, 350, 353, 350, 351,
+	353, 351, 354, 355, 352, 350, 355, 350, 353, 356, 353, 354, 356, 354, 357, 358,
+	355, 353, 358, 353, 356, 359, 356, 357, 359, 357, 360, 361, 358, 356, 361, 356,
+	359, 362, 359, 360, 362, 360, 363, 364, 361, 359, 364, 359, 362, 365, 362, 363,
+	365, 363, 366, 367, 364, 362, 367, 362, 365, 368, 365, 366, 368, 366, 369, 370,
+	367, 365, 370, 365, 368, 371, 368, 369, 371, 369, 372, 373, 370, 368, 373, 368,
+	371, 374, 371, 372, 374, 372, 375, 376, 373, 371, 376, 371, 374, 377, 374, 375,
+	377, 375, 378, 379, 376, 374, 379, 374, 377, 380, 377, 378, 380, 378, 381, 382,
+	379, 377, 382, 377, 380, 383, 380, 381, 383, 381, 384, 385, 382, 380, 385, 380,
+	383, 386, 383, 384, 386, 384, 387, 388, 385, 383, 388, 383, 386, 389, 386, 387,
+	389, 387, 390, 391, 388, 386, 391, 386, 389, 392, 389, 390, 392, 390, 393, 394,
+	391, 389, 394, 389, 392, 395, 392, 393, 395, 393, 396, 397, 394, 392, 397, 392,
+	395, 398, 395, 396, 398, 396, 399, 400, 397, 395, 400, 395, 398, 401, 398, 399,
+	401, 399, 402, 403, 400, 398, 403, 398, 401, 404, 401, 402, 404, 402, 405, 406,
+	403, 401, 406, 401, 404, 407, 404, 405, 407, 405, 408, 409, 406, 404, 409, 404,
+	407, 410, 407, 408, 410, 408, 411, 412, 409, 407, 412, 407, 410, 413, 410, 411,
+	413, 411, 414, 415, 412, 410, 415, 410, 413, 416, 413, 414, 416, 414, 417, 418,
+	415, 413, 418, 413, 416, 419, 416, 417, 419, 417, 420, 421, 418, 416, 421, 416,
+	419, 422, 419, 420, 422, 420, 423, 424, 421, 419, 424, 419, 422, 425, 422, 423,
+	425, 423, 426, 295, 424, 422, 295, 422, 425, 427, 425, 426, 427, 426, 428, 291,
+	295, 425, 291, 425, 427, 429, 427, 428, 429, 428, 430, 288, 291, 427, 288, 427,
+	429, 431, 429, 430, 431, 430, 432, 286, 288, 429, 286, 429, 431, 433, 431, 432,
+	433, 432, 434, 285, 286, 431, 285, 431, 433, 435, 433, 434, 435, 434, 436, 437,
+	285, 433, 437, 433, 435, 438, 435, 436, 438, 436, 439, 440, 437, 435, 440, 435,
+	438, 441, 438, 439, 441, 439, 442, 443, 441, 442, 444, 438, 441, 444, 440, 438,
+	445, 441, 443, 445, 444, 441, 446, 445, 443, 447, 445, 446, 447, 448, 445, 448,
+	444, 445, 449, 448, 447, 450, 440, 444, 448, 450, 444, 449, 451, 448, 451, 450,
+	448, 452, 451, 449, 450, 453, 440, 453, 437, 440, 451, 454, 450, 454, 453, 450,
+	452, 455, 451, 455, 454, 451, 456, 455, 452, 453, 282, 437, 282, 285, 437, 456,
+	457, 455, 458, 457, 456, 455, 459, 454, 457, 459, 455, 454, 281, 453, 459, 281,
+	454, 281, 282, 453, 458, 460, 457, 461, 460, 458, 457, 462, 459, 460, 462, 457,
+	459, 278, 281, 462, 278, 459, 461, 463, 460, 464, 463, 461, 460, 465, 462, 463,
+	465, 460, 464, 466, 463, 467, 466, 464, 463, 468, 465, 466, 468, 463, 465, 275,
+	462, 462, 275, 278, 467, 469, 466, 470, 469, 467, 466, 471, 468, 469, 471, 466,
+	468, 269, 465, 465, 269, 275, 470, 472, 469, 473, 472, 470, 469, 474, 471, 472,
+	474, 469, 471, 266, 468, 468, 266, 269, 473, 475, 472, 476, 475, 473, 472, 477,
+	474, 475, 477, 472, 474, 263, 471, 471, 263, 266, 476, 478, 475, 479, 478, 476,
+	475, 480, 477, 478, 480, 475, 477, 257, 474, 474, 257, 263, 479, 481, 478, 482,
+	481, 479, 478, 483, 480, 481, 483, 478, 480, 254, 477, 477, 254, 257, 482, 484,
+	481, 485, 484, 482, 481, 486, 483, 484, 486, 481, 483, 251, 480, 480, 251, 254,
+	485, 487, 484, 488, 487, 485, 484, 489, 486, 487, 489, 484, 486, 245, 483, 483,
+	245, 251, 488, 490, 487, 491, 490, 488, 487, 492, 489, 490, 492, 487, 489, 242,
+	486, 486, 242, 245, 491, 493, 490, 494, 493, 491, 490, 495, 492, 493, 495, 490,
+	492, 239, 489, 489, 239, 242, 494, 496, 493, 497, 496, 494, 493, 498, 495, 496,
+	498, 493, 495, 233, 492, 492, 233, 239, 497, 499, 496, 500, 499, 497, 496, 501,
+	498, 499, 501, 496, 498, 230, 495, 495, 230, 233, 500, 502, 499, 503, 502, 500,
+	499, 504, 501, 502, 504, 499, 501, 227, 498, 498, 227, 230, 503, 505, 502, 506,
+	505, 503, 502, 507, 504, 505, 507, 502, 504, 221, 501, 501, 221, 227, 506, 508,
+	505, 509, 508, 506, 505, 510, 507, 508, 510, 505, 507, 218, 504, 504, 218, 221,
+	509, 511, 508, 512, 511, 509, 508, 513, 510, 511, 513, 508, 510, 215, 507, 507,
+	215, 218, 513, 212, 510, 510, 212, 215, 511, 514, 513, 513, 209, 212, 514, 209,
+	513, 512, 515, 511, 515, 514, 511, 516, 515, 512, 517, 516, 512, 518, 516, 517,
+	518, 519, 516, 519, 520, 516, 516, 520, 515, 519, 521, 520, 515, 522, 514, 520,
+	522, 515, 521, 523, 520, 520, 523, 522, 521, 524, 523, 522, 208, 514, 514, 208,
+	209, 523, 525, 522, 522, 525, 208, 524, 526, 523, 523, 526, 525, 524, 527, 526,
+	525, 205, 208, 527, 528, 526, 527, 529, 528, 526, 530, 525, 526, 528, 530, 525,
+	530, 205, 529, 531, 528, 529, 532, 531, 528, 533, 530, 528, 531, 533, 532, 534,
+	531, 532, 535, 534, 531, 536, 533, 531, 534, 536, 530, 533, 202, 530, 202, 205,
+	533, 536, 199, 533, 199, 202, 534, 537, 536, 535, 538, 534, 534, 538, 537, 535,
+	539, 538, 536, 537, 196, 536, 196, 199, 539, 540, 538, 539, 541, 540, 538, 542,
+	537, 538, 540, 542, 541, 543, 540, 541, 544, 543, 540, 545, 542, 540, 543, 545,
+	537, 542, 193, 537, 193, 196, 542, 545, 190, 542, 190, 193, 543, 546, 545, 544,
+	547, 543, 543, 547, 546, 544, 548, 547, 545, 546, 187, 545, 187, 190, 548, 549,
+	547, 548, 550, 549, 547, 551, 546, 547, 549, 551, 550, 552, 549, 550, 553, 552,
+	549, 554, 551, 549, 552, 554, 546, 551, 184, 546, 184, 187, 555, 60, 556, 555,
+	63, 60, 86, 63, 555, 557, 556, 558, 557, 555, 556, 559, 86, 555, 559, 555,
+	557, 90, 86, 559, 94, 90, 559, 94, 559, 560, 560, 559, 557, 101, 94, 560,
+	561, 557, 558, 560, 557, 561, 561, 558, 562, 101, 560, 563, 563, 560, 561, 564,
+	561, 562, 563, 561, 564, 565, 101, 563, 97, 101, 565, 100, 97, 565, 565, 563,
+	566, 566, 563, 564, 100, 565, 567, 567, 565, 566, 104, 100, 567, 566, 564, 568,
+	104, 567, 569, 107, 104, 569, 567, 566, 570, 569, 567, 570, 570, 566, 568, 107,
+	569, 571, 110, 107, 571, 569, 570, 572, 571, 569, 572, 110, 571, 573, 113, 110,
+	573, 571, 572, 574, 573, 571, 574, 572, 570, 575, 570, 568, 575, 113, 573, 576,
+	116, 113, 576, 576, 573, 577, 573, 574, 577, 116, 576, 578, 119, 116, 578, 576,
+	577, 579, 578, 576, 579, 119, 578, 580, 122, 119, 580, 578, 579, 581, 580, 578,
+	581, 122, 580, 582, 125, 122, 582, 580, 581, 583, 582, 580, 583, 125, 582, 584,
+	128, 125, 584, 582, 583, 585, 584, 582, 585, 128, 584, 586, 131, 128, 586, 584,
+	585, 587, 586, 584, 587, 131, 586, 588, 134, 131, 588, 586, 587, 589, 588, 586,
+	589, 134, 588, 590, 137, 134, 590, 588, 589, 591, 590, 588, 591, 137, 590, 592,
+	140, 137, 592, 590, 591, 593, 592, 590, 593, 140, 592, 594, 143, 140, 594, 592,
+	593, 595, 594, 592, 595, 143, 594, 596, 146, 143, 596, 594, 595, 597, 596, 594,
+	597, 146, 596, 598, 149, 146, 598, 596, 597, 599, 598, 596, 599, 149, 598, 600,
+	152, 149, 600, 598, 599, 601, 600, 598, 601, 152, 600, 602, 155, 152, 602, 600,
+	601, 603, 602, 600, 603, 155, 602, 604, 158, 155, 604, 602, 603, 605, 604, 602,
+	605, 158, 604, 606, 161, 158, 606, 604, 605, 607, 606, 604, 607, 161, 606, 608,
+	164, 161, 608, 606, 607, 609, 608, 606, 609, 164, 608, 610, 167, 164, 610, 608,
+	609, 611, 610, 608, 611, 167, 610, 612, 170, 167, 612, 610, 611, 613, 612, 610,
+	613, 170, 612, 614, 173, 170, 614, 612, 613, 615, 614, 612, 615, 173, 614, 616,
+	176, 173, 616, 614, 615, 617, 616, 614, 617, 176, 616, 618, 179, 176, 618, 616,
+	617, 619, 618, 616, 619, 179, 618, 620, 182, 179, 620, 618, 619, 621, 620, 618,
+	621, 182, 620, 622, 185, 182, 622, 620, 621, 623, 622, 620, 623, 185, 622, 624,
+	188, 185, 624, 622, 623, 625, 624, 622, 625, 188, 624, 626, 191, 188, 626, 624,
+	625, 627, 626, 624, 627, 191, 626, 628, 194, 191, 628, 626, 627, 629, 628, 626,
+	629, 194, 628, 630, 197, 194, 630, 628, 629, 631, 630, 628, 631, 197, 630, 632,
+	200, 197, 632, 630, 631, 633, 632, 630, 633, 200, 632, 634, 203, 200, 634, 632,
+	633, 635, 634, 632, 635, 203, 634, 636, 206, 203, 636, 206, 636, 213, 636, 634,
+	637, 634, 635, 637, 213, 636, 638, 636, 637, 638, 213, 638, 223, 637, 635, 639,
+	223, 638, 640, 223, 640, 224, 638, 637, 641, 638, 641, 640, 637, 639, 641, 224,
+	640, 642, 224, 642, 228, 640, 641, 643, 640, 643, 642, 228, 642, 644, 228, 644,
+	235, 642, 643, 645, 642, 645, 644, 641, 646, 643, 641, 639, 646, 643, 647, 645,
+	643, 646, 647, 644, 645, 648, 235, 644, 649, 644, 648, 649, 235, 649, 236, 645,
+	650, 648, 645, 647, 650, 236, 649, 651, 236, 651, 240, 649, 648, 652, 649, 652,
+	651, 240, 651, 653, 240, 653, 247, 651, 652, 654, 651, 654, 653, 648, 655, 652,
+	648, 650, 655, 652, 656, 654, 652, 655, 656, 653, 654, 657, 247, 653, 658, 653,
+	657, 658, 247, 658, 248, 654, 659, 657, 654, 656, 659, 248, 658, 660, 248, 660,
+	252, 658, 657, 661, 658, 661, 660, 252, 660, 662, 252, 662, 259, 660, 661, 663,
+	660, 663, 662, 657, 664, 661, 657, 659, 664, 661, 665, 663, 661, 664, 665, 662,
+	663, 666, 259, 662, 667, 662, 666, 667, 259, 667, 260, 663, 668, 666, 663, 665,
+	668, 260, 667, 669, 260, 669, 264, 667, 666, 670, 667, 670, 669, 264, 669, 671,
+	264, 671, 271, 669, 670, 672, 669, 672, 671, 666, 673, 670, 666, 668, 673, 670,
+	674, 672, 670, 673, 674, 671, 672, 675, 271, 671, 676, 671, 675, 676, 271, 676,
+	272, 272, 676, 677, 676, 678, 677, 676, 675, 678, 677, 678, 679, 678, 680, 679,
+	678, 681, 680, 675, 681, 678, 681, 682, 680, 672, 683, 675, 675, 683, 681, 672,
+	674, 683, 681, 684, 682, 683, 684, 681, 684, 685, 682, 674, 686, 683, 683, 686,
+	684, 684, 687, 685, 686, 687, 684, 687, 688, 685, 674, 689, 686, 673, 689, 674,
+	686, 690, 687, 689, 690, 686, 687, 691, 688, 690, 691, 687, 691, 692, 688, 673,
+	693, 689, 668, 693, 673, 691, 694, 692, 694, 695, 692, 690, 696, 691, 696, 694,
+	691, 689, 697, 690, 697, 696, 690, 693, 697, 689, 698, 699, 700, 701, 698, 700,
+	702, 703, 704, 703, 705, 704, 699, 706, 702, 706, 703, 702, 703, 707, 705, 707,
+	708, 705, 706, 709, 703, 709, 707, 703, 710, 706, 699, 698, 710, 699, 711, 709,
+	706, 710, 711, 706, 709, 300, 707, 712, 710, 698, 711, 301, 709, 301, 300, 709,
+	309, 711, 710, 712, 309, 710, 304, 301, 711, 309, 304, 711, 713, 712, 698, 713,
+	698, 701, 310, 309, 712, 714, 713, 701, 714, 701, 715, 313, 712, 713, 313, 310,
+	712, 315, 713, 714, 315, 313, 713, 716, 714, 715, 716, 715, 717, 318, 315, 714,
+	318, 714, 716, 718, 716, 717, 718, 717, 719, 321, 318, 716, 321, 716, 718, 720,
+	718, 719, 720, 719, 721, 324, 321, 718, 324, 718, 720, 722, 720, 721, 722, 721,
+	723, 327, 324, 720, 327, 720, 722, 724, 722, 723, 724, 723, 725, 330, 327, 722,
+	330, 722, 724, 726, 724, 725, 726, 725, 727, 333, 330, 724, 333, 724, 726, 728,
+	726, 727, 728, 727, 729, 336, 333, 726, 336, 726, 728, 730, 728, 729, 730, 729,
+	731, 339, 336, 728, 339, 728, 730, 732, 730, 731, 732, 731, 733, 342, 339, 730,
+	342, 730, 732, 734, 732, 733, 734, 733, 735, 345, 342, 732, 345, 732, 734, 736,
+	734, 735, 736, 735, 737, 348, 345, 734, 348, 734, 736, 738, 736, 737, 738, 737,
+	739, 351, 348, 736, 351, 736, 738, 740, 738, 739, 740, 739, 741, 354, 351, 738,
+	354, 738, 740, 742, 740, 741, 742, 741, 743, 357, 354, 740, 357, 740, 742, 744,
+	742, 743, 744, 743, 745, 360, 357, 742, 360, 742, 744, 746, 744, 745, 746, 745,
+	747, 363, 360, 744, 363, 744, 746, 748, 746, 747, 748, 747, 749, 366, 363, 746,
+	366, 746, 748, 750, 748, 749, 750, 749, 751, 369, 366, 748, 369, 748, 750, 752,
+	750, 751, 752, 751, 753, 372, 369, 750, 372, 750, 752, 754, 752, 753, 754, 753,
+	755, 375, 372, 752, 375, 752, 754, 756, 754, 755, 756, 755, 757, 378, 375, 754,
+	378, 754, 756, 758, 756, 757, 758, 757, 759, 381, 378, 756, 381, 756, 758, 760,
+	758, 759, 760, 759, 761, 384, 381, 758, 384, 758, 760, 762, 760, 761, 762, 761,
+	763, 387, 384, 760, 387, 760, 762, 764, 762, 763, 764, 763, 765, 390, 387, 762,
+	390, 762, 764, 766, 764, 765, 766, 765, 767, 393, 390, 764, 393, 764, 766, 768,
+	766, 767, 768, 767, 769, 396, 393, 766, 396, 766, 768, 770, 768, 769, 770, 769,
+	771, 399, 396, 768, 399, 768, 770, 772, 770, 771, 772, 771, 773, 402, 399, 770,
+	402, 770, 772, 774, 772, 773, 774, 773, 775, 405, 402, 772, 405, 772, 774, 776,
+	774, 775, 776, 775, 777, 408, 405, 774, 408, 774, 776, 778, 776, 777, 778, 777,
+	779, 411, 408, 776, 411, 776, 778, 780, 778, 779, 780, 779, 781, 414, 411, 778,
+	414, 778, 780, 782, 780, 781, 782, 781, 783, 417, 414, 780, 417, 780, 782, 784,
+	782, 783, 784, 783, 785, 420, 417, 782, 420, 782, 784, 786, 784, 785, 786, 785,
+	787, 423, 420, 784, 423, 784, 786, 788, 786, 787, 788, 787, 789, 426, 423, 786,
+	426, 786, 788, 790, 788, 789, 790, 789, 791, 428, 426, 788, 428, 788, 790, 792,
+	790, 791, 792, 791, 793, 430, 428, 790, 430, 790, 792, 794, 792, 793, 794, 793,
+	795, 432, 430, 792, 432, 792, 794, 796, 794, 795, 796, 795, 797, 434, 432, 794,
+	434, 794, 796, 798, 796, 797, 798, 797, 799, 436, 434, 796, 436, 796, 798, 800,
+	798, 799, 800, 799, 801, 439, 436, 798, 439, 798, 800, 802, 800, 801, 802, 801,
+	803, 442, 439, 800, 442, 800, 802, 804, 802, 803, 804, 803, 805, 806, 442, 802,
+	806, 802, 804, 807, 804, 805, 807, 805, 808, 809, 806, 804, 809, 804, 807, 810,
+	807, 808, 810, 808, 811, 812, 810, 811, 813, 807, 810, 813, 809, 807, 814, 810,
+	812, 814, 813, 810, 815, 814, 812, 816, 814, 815, 816, 817, 814, 817, 813, 814,
+	818, 817, 816, 819, 809, 813, 817, 819, 813, 818, 820, 817, 820, 819, 817, 821,
+	820, 818, 819, 822, 809, 822, 806, 809, 820, 823, 819, 823, 822, 819, 821, 824,
+	820, 824, 823, 820, 825, 824, 821, 822, 443, 806, 443, 442, 806, 825, 826, 824,
+	827, 826, 825, 824, 828, 823, 826, 828, 824, 823, 446, 822, 828, 446, 823, 446,
+	443, 822, 827, 829, 826, 830, 829, 827, 826, 831, 828, 829, 831, 826, 828, 447,
+	446, 831, 447, 828, 830, 832, 829, 833, 832, 830, 829, 834, 831, 832, 834, 829,
+	833, 835, 832, 836, 835, 833, 832, 837, 834, 835, 837, 832, 834, 449, 831, 831,
+	449, 447, 836, 838, 835, 839, 838, 836, 835, 840, 837, 838, 840, 835, 837, 452,
+	834, 834, 452, 449, 839, 841, 838, 842, 841, 839, 838, 843, 840, 841, 843, 838,
+	840, 456, 837, 837, 456, 452, 842, 844, 841, 845, 844, 842, 841, 846, 843, 844,
+	846, 841, 843, 458, 840, 840, 458, 456, 845, 847, 844, 848, 847, 845, 844, 849,
+	846, 847, 849, 844, 846, 461, 843, 843, 461, 458, 848, 850, 847, 851, 850, 848,
+	847, 852, 849, 850, 852, 847, 849, 464, 846, 846, 464, 461, 851, 853, 850, 854,
+	853, 851, 850, 855, 852, 853, 855, 850, 852, 467, 849, 849, 467, 464, 854, 856,
+	853, 857, 856, 854, 853, 858, 855, 856, 858, 853, 855, 470, 852, 852, 470, 467,
+	857, 859, 856, 860, 859, 857, 856, 861, 858, 859, 861, 856, 858, 473, 855, 855,
+	473, 470, 860, 862, 859, 863, 862, 860, 859, 864, 861, 862, 864, 859, 861, 476,
+	858, 858, 476, 473, 863, 865, 862, 866, 865, 863, 862, 867, 864, 865, 867, 862,
+	864, 479, 861, 861, 479, 476, 866, 868, 865, 869, 868, 866, 865, 870, 867, 868,
+	870, 865, 867, 482, 864, 864, 482, 479, 869, 871, 868, 872, 871, 869, 868, 873,
+	870, 871, 873, 868, 870, 485, 867, 867, 485, 482, 872, 874, 871, 875, 874, 872,
+	871, 876, 873, 874, 876, 871, 873, 488, 870, 870, 488, 485, 875, 877, 874, 878,
+	877, 875, 874, 879, 876, 877, 879, 874, 876, 491, 873, 873, 491, 488, 878, 880,
+	877, 881, 880, 878, 877, 882, 879, 880, 882, 877, 879, 494, 876, 876, 494, 491,
+	881, 883, 880, 884, 883, 881, 880, 885, 882, 883, 885, 880, 882, 497, 879, 879,
+	497, 494, 884, 886, 883, 887, 886, 884, 883, 888, 885, 886, 888, 883, 885, 500,
+	882, 882, 500, 497, 887, 889, 886, 890, 889, 887, 886, 891, 888, 889, 891, 886,
+	888, 503, 885, 885, 503, 500, 890, 892, 889, 893, 892, 890, 889, 894, 891, 892,
+	894, 889, 891, 506, 888, 888, 506, 503, 893, 895, 892, 896, 895, 893, 892, 517,
+	894, 895, 517, 892, 894, 509, 891, 891, 509, 506, 896, 897, 895, 898, 897, 896,
+	895, 518, 517, 897, 518, 895, 517, 512, 894, 894, 512, 509, 898, 899, 897, 900,
+	899, 898, 900, 901, 899, 899, 902, 897, 897, 902, 518, 901, 903, 899, 899, 903,
+	902, 901, 904, 903, 902, 519, 518, 904, 905, 903, 904, 906, 905, 903, 907, 902,
+	903, 905, 907, 902, 907, 519, 906, 908, 905, 906, 909, 908, 905, 910, 907, 905,
+	908, 910, 909, 911, 908, 909, 912, 911, 908, 913, 910, 908, 911, 913, 907, 910,
+	521, 907, 521, 519, 910, 913, 524, 910, 524, 521, 911, 914, 913, 912, 915, 911,
+	911, 915, 914, 912, 916, 915, 913, 914, 527, 913, 527, 524, 916, 917, 915, 916,
+	918, 917, 915, 919, 914, 915, 917, 919, 918, 920, 917, 918, 921, 920, 917, 922,
+	919, 917, 920, 922, 914, 919, 529, 914, 529, 527, 923, 924, 925, 926, 923, 925,
+	927, 928, 929, 928, 930, 929, 928, 931, 930, 924, 932, 927, 932, 928, 927, 933,
+	931, 928, 932, 933, 928, 933, 934, 931, 935, 932, 924, 923, 935, 924, 936, 933,
+	932, 935, 936, 932, 937, 934, 933, 936, 937, 933, 937, 938, 934, 939, 936, 935,
+	940, 938, 937, 940, 941, 938, 942, 937, 936, 942, 940, 937, 939, 942, 936, 943,
+	941, 940, 943, 944, 941, 945, 940, 942, 945, 943, 940, 946, 944, 943, 946, 947,
+	944, 948, 943, 945, 948, 946, 943, 949, 945, 942, 949, 942, 939, 950, 948, 945,
+	950, 945, 949, 951, 947, 946, 951, 952, 947, 953, 952, 951, 954, 946, 948, 954,
+	951, 946, 955, 953, 951, 955, 951, 954, 956, 953, 955, 957, 956, 955, 957, 955,
+	958, 958, 955, 954, 959, 957, 958, 960, 954, 948, 958, 954, 960, 960, 948, 950,
+	959, 958, 961, 961, 958, 960, 962, 960, 950, 961, 960, 962, 963, 959, 961, 964,
+	959, 963, 965, 964, 963, 963, 961, 966, 966, 961, 962, 965, 963, 967, 967, 963,
+	966, 968, 965, 967, 966, 962, 969, 968, 967, 970, 971, 968, 970, 967, 966, 972,
+	970, 967, 972, 972, 966, 969, 971, 970, 973, 974, 971, 973, 970, 972, 975, 973,
+	970, 975, 974, 973, 976, 977, 974, 976, 973, 975, 978, 976, 973, 978, 975, 972,
+	979, 972, 969, 979, 977, 976, 980, 981, 977, 980, 980, 976, 982, 976, 978, 982,
+	981, 980, 983, 984, 981, 983, 980, 982, 985, 983, 980, 985, 984, 983, 986, 987,
+	984, 986, 983, 985, 988, 986, 983, 988, 987, 986, 989, 990, 987, 989, 986, 988,
+	991, 989, 986, 991, 990, 989, 992, 993, 990, 992, 989, 991, 994, 992, 989, 994,
+	993, 992, 995, 996, 993, 995, 992, 994, 997, 995, 992, 997, 996, 995, 998, 999,
+	996, 998, 995, 997, 1000, 998, 995, 1000, 999, 998, 1001, 1002, 999, 1001, 998, 1000,
+	1003, 1001, 998, 1003, 1002, 1001, 1004, 1005, 1002, 1004, 1001, 1003, 1006, 1004, 1001, 1006,
+	1005, 1004, 1007, 1008, 1005, 1007, 1004, 1006, 1009, 1007, 1004, 1009, 1008, 1007, 1010, 1011,
+	1008, 1010, 1007, 1009, 1012, 1010, 1007, 1012, 1011, 1010, 1013, 1014, 1011, 1013, 1010, 1012,
+	1015, 1013, 1010, 1015, 1014, 1013, 1016, 1017, 1014, 1016, 1013, 1015, 1018, 1016, 1013, 1018,
+	1017, 1016, 1019, 1020, 1017, 1019, 1016, 1018, 1021, 1019, 1016, 1021, 1020, 1019, 1022, 1023,
+	1020, 1022, 1019, 1021, 1024, 1022, 1019, 1024, 1023, 1022, 1025, 1026, 1023, 1025, 1022, 1024,
+	1027, 1025, 1022, 1027, 1026, 1025, 1028, 1029, 1026, 1028, 1025, 1027, 1030, 1028, 1025, 1030,
+	1029, 1028, 1031, 1032, 1029, 1031, 1028, 1030, 1033, 1031, 1028, 1033, 1032, 1031, 1034, 1035,
+	1032, 1034, 1035, 1034, 1036, 1034, 1031, 1037, 1031, 1033, 1037, 1036, 1034, 1038, 1034, 1037,
+	1038, 1036, 1038, 1039, 1037, 1033, 1040, 1039, 1038, 1041, 1039, 1041, 1042, 1038, 1037, 1043,
+	1038, 1043, 1041, 1037, 1040, 1043, 1042, 1041, 1044, 1042, 1044, 1045, 1041, 1043, 1046, 1041,
+	1046, 1044, 1045, 1044, 1047, 1045, 1047, 1048, 1048, 1047, 1049, 1044, 1050, 1047, 1044, 1046,
+	1050, 1047, 1051, 1049, 1047, 1050, 1051, 1049, 1051, 1052, 1051, 1053, 1052, 1051, 1054, 1053,
+	1050, 1054, 1051, 1054, 1055, 1053, 1050, 1056, 1054, 1046, 1056, 1050, 1054, 1057, 1055, 1056,
+	1057, 1054, 1057, 1058, 1055, 1046, 1059, 1056, 1043, 1059, 1046, 1043, 1040, 1059, 1056, 1060,
+	1057, 1059, 1060, 1056, 1057, 1061, 1058, 1060, 1061, 1057, 1061, 1062, 1058, 1059, 1063, 1060,
+	1040, 1063, 1059, 1060, 1064, 1061, 1063, 1064, 1060, 1061, 1065, 1062, 1064, 1065, 1061, 1065,
+	1066, 1062, 1040, 1067, 1063, 1033, 1067, 1040, 1033, 1030, 1067, 1065, 1068, 1066, 1068, 1069,
+	1066, 1030, 1070, 1067, 1030, 1027, 1070, 1067, 1071, 1063, 1067, 1070, 1071, 1063, 1071, 1064,
+	1027, 1072, 1070, 1027, 1024, 1072, 1070, 1073, 1071, 1070, 1072, 1073, 1071, 1074, 1064, 1064,
+	1074, 1065, 1071, 1073, 1074, 1074, 1068, 1065, 1073, 1075, 1074, 1074, 1075, 1068, 1072, 1076,
+	1073, 1073, 1076, 1075, 1077, 1078, 1079, 1079, 1078, 1080, 577, 1077, 1081, 1081, 1077, 1079,
+	579, 577, 1081, 1080, 1082, 953, 953, 1082, 952, 579, 1081, 1083, 581, 579, 1083, 1081,
+	1079, 1084, 1083, 1081, 1084, 1079, 1080, 956, 1084, 1079, 956, 956, 1080, 953, 581, 1083,
+	1085, 583, 581, 1085, 1083, 1084, 1086, 1085, 1083, 1086, 1084, 956, 957, 1086, 1084, 957,
+	583, 1085, 1087, 585, 583, 1087, 1085, 1086, 964, 1087, 1085, 964, 585, 1087, 1088, 587,
+	585, 1088, 1087, 964, 965, 1088, 1087, 965, 964, 1086, 959, 1086, 957, 959, 587, 1088,
+	1089, 589, 587, 1089, 1089, 1088, 968, 1088, 965, 968, 589, 1089, 1090, 591, 589, 1090,
+	1089, 968, 971, 1090, 1089, 971, 591, 1090, 1091, 593, 591, 1091, 1090, 971, 974, 1091,
+	1090, 974, 593, 1091, 1092, 595, 593, 1092, 1091, 974, 977, 1092, 1091, 977, 595, 1092,
+	1093, 597, 595, 1093, 1092, 977, 981, 1093, 1092, 981, 597, 1093, 1094, 599, 597, 1094,
+	1093, 981, 984, 1094, 1093, 984, 599, 1094, 1095, 601, 599, 1095, 1094, 984, 987, 1095,
+	1094, 987, 601, 1095, 1096, 603, 601, 1096, 1095, 987, 990, 1096, 1095, 990, 603, 1096,
+	1097, 605, 603, 1097, 1096, 990, 993, 1097, 1096, 993, 605, 1097, 1098, 607, 605, 1098,
+	1097, 993, 996, 1098, 1097, 996, 607, 1098, 1099, 609, 607, 1099, 1098, 996, 999, 1099,
+	1098, 999, 609, 1099, 1100, 611, 609, 1100, 1099, 999, 1002, 1100, 1099, 1002, 611, 1100,
+	1101, 613, 611, 1101, 1100, 1002, 1005, 1101, 1100, 1005, 613, 1101, 1102, 615, 613, 1102,
+	1101, 1005, 1008, 1102, 1101, 1008, 615, 1102, 1103, 617, 615, 1103, 1102, 1008, 1011, 1103,
+	1102, 1011, 617, 1103, 1104, 619, 617, 1104, 1103, 1011, 1014, 1104, 1103, 1014, 619, 1104,
+	1105, 621, 619, 1105, 1104, 1014, 1017, 1105, 1104, 1017, 621, 1105, 1106, 623, 621, 1106,
+	1105, 1017, 1020, 1106, 1105, 1020, 623, 1106, 1107, 625, 623, 1107, 1106, 1020, 1023, 1107,
+	1106, 1023, 625, 1107, 1108, 627, 625, 1108, 1107, 1023, 1026, 1108, 1107, 1026, 627, 1108,
+	1109, 629, 627, 1109, 1108, 1026, 1029, 1109, 1108, 1029, 629, 1109, 1110, 631, 629, 1110,
+	1109, 1029, 1032, 1110, 1109, 1032, 631, 1110, 1111, 633, 631, 1111, 1110, 1032, 1035, 1111,
+	1110, 1035, 633, 1111, 1112, 635, 633, 1112, 635, 1112, 639, 1112, 1111, 1113, 1111, 1035,
+	1113, 639, 1112, 1114, 1112, 1113, 1114, 639, 1114, 646, 1113, 1035, 1036, 646, 1114, 1115,
+	646, 1115, 647, 1114, 1113, 1116, 1114, 1116, 1115, 1113, 1036, 1116, 647, 1115, 1117, 647,
+	1117, 650, 1115, 1116, 1118, 1115, 1118, 1117, 650, 1117, 1119, 650, 1119, 655, 1117, 1118,
+	1120, 1117, 1120, 1119, 1116, 1039, 1118, 1116, 1036, 1039, 1118, 1042, 1120, 1118, 1039, 1042,
+	1119, 1120, 1121, 655, 1119, 1122, 1119, 1121, 1122, 655, 1122, 656, 1120, 1045, 1121, 1120,
+	1042, 1045, 656, 1122, 1123, 656, 1123, 659, 1122, 1121, 1124, 1122, 1124, 1123, 659, 1123,
+	1125, 659, 1125, 664, 1123, 1124, 1126, 1123, 1126, 1125, 1121, 1048, 1124, 1121, 1045, 1048,
+	1124, 1127, 1126, 1124, 1048, 1127, 1125, 1126, 1128, 664, 1125, 1129, 1125, 1128, 1129, 664,
+	1129, 665, 1126, 1130, 1128, 1126, 1127, 1130, 665, 1129, 1131, 665, 1131, 668, 668, 1131,
+	693, 1129, 1128, 1132, 1129, 1132, 1131, 1131, 1133, 693, 1131, 1132, 1133, 693, 1133, 697,
+	1133, 1134, 697, 1133, 1135, 1134, 1132, 1135, 1133, 1135, 1136, 1134, 1128, 1137, 1132, 1132,
+	1137, 1135, 1128, 1130, 1137, 1135, 1138, 1136, 1137, 1138, 1135, 1138, 1139, 1136, 1130, 1140,
+	1137, 1137, 1140, 1138, 1138, 1141, 1139, 1140, 1141, 1138, 1141, 1142, 1139, 1130, 1143, 1140,
+	1127, 1143, 1130, 1140, 1144, 1141, 1143, 1144, 1140, 1141, 1145, 1142, 1144, 1145, 1141, 1145,
+	1146, 1142, 1127, 1049, 1143, 1048, 1049, 1127, 1145, 1147, 1146, 1147, 1148, 1146, 1144, 1149,
+	1145, 1149, 1147, 1145, 1143, 1052, 1144, 1052, 1149, 1144, 1049, 1052, 1143, 1147, 1150, 1148,
+	1150, 1151, 1148, 1149, 1152, 1147, 1152, 1150, 1147, 1052, 1053, 1149, 1053, 1152, 1149, 1150,
+	1153, 1151, 1153, 1154, 1151, 1152, 1155, 1150, 1155, 1153, 1150, 1153, 1156, 1154, 1156, 1157,
+	1154, 1155, 1158, 1153, 1158, 1156, 1153, 1055, 1155, 1152, 1053, 1055, 1152, 1058, 1158, 1155,
+	1055, 1058, 1155, 1156, 1159, 1157, 1159, 1160, 1157, 1158, 1161, 1156, 1161, 1159, 1156, 1159,
+	1162, 1160, 1162, 1163, 1160, 1161, 1164, 1159, 1164, 1162, 1159, 1062, 1161, 1158, 1058, 1062,
+	1158, 1066, 1164, 1161, 1062, 1066, 1161, 1162, 1165, 1163, 1165, 1166, 1163, 1164, 1167, 1162,
+	1167, 1165, 1162, 1165, 1168, 1166, 1168, 1169, 1166, 1167, 1170, 1165, 1170, 1168, 1165, 1069,
+	1167, 1164, 1066, 1069, 1164, 1171, 1170, 1167, 1069, 1171, 1167, 1172, 1173, 1174, 1175, 1176,
+	1177, 1177, 1176, 1178, 1172, 1174, 1179, 1180, 1172, 1179, 1174, 1181, 1182, 1179, 1174, 1182,
+	1181, 1175, 1183, 1182, 1181, 1183, 1183, 1175, 1177, 1180, 1179, 1184, 1185, 1180, 1184, 1179,
+	1182, 1186, 1184, 1179, 1186, 1182, 1183, 1187, 1186, 1182, 1187, 1185, 1184, 1188, 1189, 1185,
+	1188, 1184, 1186, 1190, 1188, 1184, 1190, 1189, 1188, 1191, 1192, 1189, 1191, 1188, 1190, 1193,
+	1191, 1188, 1193, 1190, 1186, 1194, 1186, 1187, 1194, 1192, 1191, 1195, 1196, 1192, 1195, 1195,
+	1191, 1197, 1191, 1193, 1197, 1196, 1195, 1198, 1199, 1196, 1198, 1195, 1197, 1200, 1198, 1195,
+	1200, 1199, 1198, 1201, 1202, 1199, 1201, 1198, 1200, 1203, 1201, 1198, 1203, 1202, 1201, 1204,
+	1205, 1202, 1204, 1201, 1203, 1206, 1204, 1201, 1206, 1205, 1204, 1207, 1208, 1205, 1207, 1204,
+	1206, 1209, 1207, 1204, 1209, 1208, 1207, 1210, 1211, 1208, 1210, 1207, 1209, 1212, 1210, 1207,
+	1212, 1211, 1210, 1213, 1214, 1211, 1213, 1210, 1212, 1215, 1213, 1210, 1215, 1214, 1213, 1216,
+	1217, 1214, 1216, 1213, 1215, 1218, 1216, 1213, 1218, 1217, 1216, 1219, 1220, 1217, 1219, 1216,
+	1218, 1221, 1219, 1216, 1221, 1220, 1219, 1222, 1223, 1220, 1222, 1219, 1221, 1224, 1222, 1219,
+	1224, 1223, 1222, 1225, 1226, 1223, 1225, 1222, 1224, 1227, 1225, 1222, 1227, 1226, 1225, 1228,
+	1229, 1226, 1228, 1225, 1227, 1230, 1228, 1225, 1230, 1229, 1228, 1231, 1232, 1229, 1231, 1228,
+	1230, 1233, 1231, 1228, 1233, 1232, 1231, 1234, 1235, 1232, 1234, 1231, 1233, 1236, 1234, 1231,
+	1236, 1235, 1234, 1237, 1238, 1235, 1237, 1234, 1236, 1239, 1237, 1234, 1239, 1238, 1237, 1240,
+	1241, 1238, 1240, 1237, 1239, 1242, 1240, 1237, 1242, 1241, 1240, 1243, 1244, 1241, 1243, 1240,
+	1242, 1245, 1243, 1240, 1245, 1244, 1243, 1246, 1247, 1244, 1246, 1243, 1245, 1248, 1246, 1243,
+	1248, 1247, 1246, 1249, 1250, 1247, 1249, 1246, 1248, 1251, 1249, 1246, 1251, 1250, 1249, 1252,
+	1253, 1250, 1252, 1249, 1251, 1254, 1252, 1249, 1254, 1253, 1252, 1255, 1256, 1253, 1255, 1252,
+	1254, 1257, 1255, 1252, 1257, 1256, 1255, 1258, 1259, 1256, 1258, 1255, 1257, 1260, 1258, 1255,
+	1260, 1259, 1258, 1261, 1262, 1259, 1261, 1258, 1260, 1263, 1261, 1258, 1263, 1262, 1261, 1264,
+	1265, 1262, 1264, 1261, 1263, 1266, 1264, 1261, 1266, 1265, 1264, 1267, 1268, 1265, 1267, 1264,
+	1266, 1269, 1267, 1264, 1269, 1268, 1267, 1270, 1271, 1268, 1270, 1267, 1269, 1272, 1270, 1267,
+	1272, 1271, 1270, 1273, 1274, 1271, 1273, 1270, 1272, 1275, 1273, 1270, 1275, 1274, 1273, 1276,
+	1277, 1274, 1276, 1273, 1275, 1278, 1276, 1273, 1278, 1277, 1276, 1279, 1280, 1277, 1279, 1276,
+	1278, 1281, 1279, 1276, 1281, 1280, 1279, 1282, 1283, 1280, 1282, 1279, 1281, 1284, 1282, 1279,
+	1284, 1283, 1282, 1285, 1286, 1283, 1285, 1282, 1284, 1287, 1285, 1282, 1287, 1286, 1285, 1288,
+	1289, 1286, 1288, 1285, 1287, 1290, 1288, 1285, 1290, 1289, 1288, 1291, 1292, 1289, 1291, 1288,
+	1290, 1293, 1291, 1288, 1293, 1292, 1291, 1294, 1295, 1292, 1294, 1291, 1293, 1296, 1294, 1291,
+	1296, 1295, 1294, 1297, 1298, 1295, 1297, 1294, 1296, 1299, 1297, 1294, 1299, 1298, 1297, 1300,
+	1301, 1298, 1300, 1297, 1299, 1302, 1300, 1297, 1302, 1301, 1300, 1303, 1304, 1301, 1303, 1300,
+	1302, 1305, 1303, 1300, 1305, 1304, 1303, 1306, 1307, 1304, 1306, 1303, 1305, 1308, 1306, 1303,
+	1308, 1307, 1306, 1309, 1310, 1307, 1309, 1306, 1308, 1311, 1309, 1306, 1311, 1310, 1309, 1312,
+	1313, 1310, 1312, 1309, 1311, 1314, 1312, 1309, 1314, 1313, 1312, 1315, 1316, 1313, 1315, 1312,
+	1314, 1317, 1315, 1312, 1317, 1316, 1315, 1318, 1319, 1316, 1318, 1315, 1317, 1320, 1318, 1315,
+	1320, 1319, 1318, 1321, 1322, 1319, 1321, 1318, 1320, 1323, 1321, 1318, 1323, 1322, 1321, 1324,
+	1325, 1322, 1324, 1321, 1323, 921, 1324, 1321, 921, 1325, 1324, 1326, 1327, 1325, 1326, 1324,
+	921, 918, 1326, 1324, 918, 1327, 1326, 1328, 1329, 1327, 1328, 1326, 918, 916, 1328, 1326,
+	916, 1329, 1328, 1330, 1331, 1329, 1330, 1328, 916, 912, 1330, 1328, 912, 1331, 1330, 1332,
+	1333, 1331, 1332, 1330, 912, 909, 1332, 1330, 909, 1333, 1332, 1334, 1335, 1333, 1334, 1332,
+	909, 906, 1334, 1332, 906, 1335, 1334, 1336, 1337, 1335, 1336, 1334, 906, 904, 1336, 1334,
+	904, 1337, 1336, 1338, 1339, 1337, 1338, 1336, 904, 901, 1338, 1336, 901, 1339, 1338, 1340,
+	1341, 1339, 1340, 1338, 901, 900, 1340, 1338, 900, 1341, 1340, 1342, 1343, 1341, 1342, 1343,
+	1342, 1344, 1342, 1340, 1345, 1340, 900, 1345, 1344, 1342, 1346, 1342, 1345, 1346, 1344, 1346,
+	1347, 1345, 900, 898, 1347, 1346, 1348, 1347, 1348, 1349, 1346, 1345, 1350, 1346, 1350, 1348,
+	1345, 898, 1350, 1349, 1348, 1351, 1349, 1351, 1352, 1348, 1350, 1353, 1348, 1353, 1351, 1352,
+	1351, 1354, 1352, 1354, 1355, 1351, 1353, 1356, 1351, 1356, 1354, 1350, 896, 1353, 1350, 898,
+	896, 1353, 893, 1356, 1353, 896, 893, 1354, 1356, 1357, 1355, 1354, 1358, 1354, 1357, 1358,
+	1355, 1358, 1359, 1356, 890, 1357, 1356, 893, 890, 1359, 1358, 1360, 1359, 1360, 1361, 1358,
+	1357, 1362, 1358, 1362, 1360, 1361, 1360, 1363, 1361, 1363, 1364, 1360, 1362, 1365, 1360, 1365,
+	1363, 1357, 887, 1362, 1357, 890, 887, 1362, 884, 1365, 1362, 887, 884, 1363, 1365, 1366,
+	1364, 1363, 1367, 1363, 1366, 1367, 1364, 1367, 1368, 1365, 881, 1366, 1365, 884, 881, 1368,
+	1367, 1369, 1368, 1369, 1370, 1367, 1366, 1371, 1367, 1371, 1369, 1370, 1369, 1372, 1370, 1372,
+	1373, 1369, 1371, 1374, 1369, 1374, 1372, 1366, 878, 1371, 1366, 881, 878, 1371, 875, 1374,
+	1371, 878, 875, 1372, 1374, 1375, 1373, 1372, 1376, 1372, 1375, 1376, 1373, 1376, 1377, 1374,
+	872, 1375, 1374, 875, 872, 1377, 1376, 1378, 1377, 1378, 1379, 1376, 1375, 1380, 1376, 1380,
+	1378, 1379, 1378, 1381, 1379, 1381, 1382, 1378, 1380, 1383, 1378, 1383, 1381, 1375, 869, 1380,
+	1375, 872, 869, 1380, 866, 1383, 1380, 869, 866, 1381, 1383, 1384, 1382, 1381, 1385, 1381,
+	1384, 1385, 1382, 1385, 1386, 1383, 863, 1384, 1383, 866, 863, 1386, 1385, 1387, 1386, 1387,
+	1388, 1385, 1384, 1389, 1385, 1389, 1387, 1388, 1387, 1390, 1388, 1390, 1391, 1387, 1389, 1392,
+	1387, 1392, 1390, 1384, 860, 1389, 1384, 863, 860, 1389, 857, 1392, 1389, 860, 857, 1390,
+	1392, 1393, 1391, 1390, 1394, 1390, 1393, 1394, 1391, 1394, 1395, 1392, 854, 1393, 1392, 857,
+	854, 1395, 1394, 1396, 1395, 1396, 1397, 1394, 1393, 1398, 1394, 1398, 1396, 1397, 1396, 1399,
+	1397, 1399, 1400, 1396, 1398, 1401, 1396, 1401, 1399, 1393, 851, 1398, 1393, 854, 851, 1398,
+	848, 1401, 1398, 851, 848, 1399, 1401, 1402, 1400, 1399, 1403, 1399, 1402, 1403, 1400, 1403,
+	1404, 1401, 845, 1402, 1401, 848, 845, 1404, 1403, 1405, 1404, 1405, 1406, 1403, 1402, 1407,
+	1403, 1407, 1405, 1406, 1405, 1408, 1406, 1408, 1409, 1405, 1407, 1410, 1405, 1410, 1408, 1402,
+	842, 1407, 1402, 845, 842, 1407, 839, 1410, 1407, 842, 839, 1408, 1410, 1411, 1409, 1408,
+	1412, 1408, 1411, 1412, 1409, 1412, 1413, 1410, 836, 1411, 1410, 839, 836, 1413, 1412, 1414,
+	1413, 1414, 1415, 1412, 1411, 1416, 1412, 1416, 1414, 1415, 1414, 1417, 1415, 1417, 1418, 1414,
+	1416, 1419, 1414, 1419, 1417, 1411, 833, 1416, 1411, 836, 833, 1416, 830, 1419, 1416, 833,
+	830, 1417, 1419, 1420, 1418, 1417, 1421, 1417, 1420, 1421, 1418, 1421, 1422, 1419, 827, 1420,
+	1419, 830, 827, 1422, 1421, 1423, 1422, 1423, 1424, 1421, 1420, 1425, 1421, 1425, 1423, 1424,
+	1423, 1426, 1424, 1426, 1427, 1423, 1425, 1428, 1423, 1428, 1426, 1420, 825, 1425, 1420, 827,
+	825, 1425, 821, 1428, 1425, 825, 821, 1426, 1428, 1429, 1427, 1426, 1430, 1426, 1429, 1430,
+	1427, 1430, 1431, 1428, 818, 1429, 1428, 821, 818, 1431, 1430, 1432, 1431, 1432, 1433, 1430,
+	1429, 1434, 1430, 1434, 1432, 1433, 1432, 1435, 1433, 1435, 1436, 1432, 1434, 1437, 1432, 1437,
+	1435, 1429, 816, 1434, 1429, 818, 816, 1434, 815, 1437, 1434, 816, 815, 1435, 1437, 1438,
+	1436, 1435, 1439, 1435, 1438, 1439, 1436, 1439, 1440, 1437, 1441, 1438, 1437, 815, 1441, 1440,
+	1439, 1442, 1440, 1442, 1443, 1439, 1438, 1444, 1439, 1444, 1442, 1443, 1442, 1445, 1443, 1445,
+	1446, 1446, 1445, 1447, 1442, 1448, 1445, 1442, 1444, 1448, 1445, 1449, 1447, 1445, 1448, 1449,
+	1447, 1449, 1450, 1449, 1451, 1450, 1449, 1452, 1451, 1448, 1452, 1449, 1452, 1453, 1451, 1448,
+	1454, 1452, 1444, 1454, 1448, 1452, 1455, 1453, 1454, 1455, 1452, 1455, 1456, 1453, 1444, 1457,
+	1454, 1438, 1457, 1444, 1438, 1441, 1457, 1454, 1458, 1455, 1457, 1458, 1454, 1455, 1459, 1456,
+	1458, 1459, 1455, 1459, 1460, 1456, 1457, 1461, 1458, 1441, 1461, 1457, 1458, 1462, 1459, 1461,
+	1462, 1458, 1459, 1463, 1460, 1462, 1463, 1459, 1463, 1464, 1460, 1441, 812, 1461, 815, 812,
+	1441, 1463, 1465, 1464, 1465, 1466, 1464, 1462, 1467, 1463, 1467, 1465, 1463, 1461, 811, 1462,
+	811, 1467, 1462, 812, 811, 1461, 1168, 1468, 1169, 1468, 1469, 1169, 1170, 1470, 1168, 1470,
+	1468, 1168, 1468, 1471, 1469, 1471, 1472, 1469, 1470, 1473, 1468, 1473, 1471, 1468, 1474, 1470,
+	1170, 1171, 1474, 1170, 1475, 1473, 1470, 1474, 1475, 1470, 1471, 1476, 1472, 1476, 1477, 1472,
+	1473, 1478, 1471, 1478, 1476, 1471, 1476, 1479, 1477, 1479, 1480, 1477, 1478, 1481, 1476, 1481,
+	1479, 1476, 1482, 1478, 1473, 1475, 1482, 1473, 1483, 1481, 1478, 1482, 1483, 1478, 1479, 1484,
+	1480, 1484, 1485, 1480, 1481, 1486, 1479, 1486, 1484, 1479, 1484, 1487, 1485, 1487, 1488, 1485,
+	1486, 1489, 1484, 1489, 1487, 1484, 1490, 1486, 1481, 1483, 1490, 1481, 1491, 1489, 1486, 1490,
+	1491, 1486, 1487, 1492, 1488, 1492, 1493, 1488, 1489, 1494, 1487, 1494, 1492, 1487, 1492, 1495,
+	1493, 1495, 1496, 1493, 1494, 1497, 1492, 1497, 1495, 1492, 1498, 1494, 1489, 1491, 1498, 1489,
+	1499, 1497, 1494, 1498, 1499, 1494, 1495, 1500, 1496, 1500, 1501, 1496, 1497, 1502, 1495, 1502,
+	1500, 1495, 1500, 1503, 1501, 1503, 1504, 1501, 1502, 1505, 1500, 1505, 1503, 1500, 1506, 1502,
+	1497, 1499, 1506, 1497, 1507, 1505, 1502, 1506, 1507, 1502, 1503, 1508, 1504, 1508, 1509, 1504,
+	1505, 1510, 1503, 1510, 1508, 1503, 1508, 1511, 1509, 1511, 1512, 1509, 1510, 1513, 1508, 1513,
+	1511, 1508, 1514, 1510, 1505, 1507, 1514, 1505, 1515, 1513, 1510, 1514, 1515, 1510, 1511, 1516,
+	1512, 1516, 1517, 1512, 1513, 1518, 1511, 1518, 1516, 1511, 1516, 1519, 1517, 1519, 1520, 1517,
+	1518, 1521, 1516, 1521, 1519, 1516, 1522, 1518, 1513, 1515, 1522, 1513, 1523, 1521, 1518, 1522,
+	1523, 1518, 1519, 1524, 1520, 1524, 1525, 1520, 1521, 925, 1519, 925, 1524, 1519, 1524, 927,
+	1525, 927, 929, 1525, 925, 924, 1524, 924, 927, 1524, 926, 925, 1521, 1523, 926, 1521,
+	294, 1526, 295, 297, 1526, 294, 1526, 424, 295, 276, 677, 296, 272, 677, 276, 1526,
+	1527, 424, 1527, 421, 424, 297, 1528, 1526, 1528, 1527, 1526, 296, 679, 297, 679, 1528,
+	297, 677, 679, 296, 1527, 1529, 421, 1529, 418, 421, 1528, 1530, 1527, 1530, 1529, 1527,
+	679, 680, 1528, 680, 1530, 1528, 1529, 1531, 418, 1531, 415, 418, 1530, 1532, 1529, 1532,
+	1531, 1529, 1531, 1533, 415, 1533, 412, 415, 1532, 1534, 1531, 1534, 1533, 1531, 682, 1532,
+	1530, 680, 682, 1530, 685, 1534, 1532, 682, 685, 1532, 1533, 1535, 412, 1535, 409, 412,
+	1534, 1536, 1533, 1536, 1535, 1533, 1535, 1537, 409, 1537, 406, 409, 1536, 1538, 1535, 1538,
+	1537, 1535, 688, 1536, 1534, 685, 688, 1534, 692, 1538, 1536, 688, 692, 1536, 1537, 1539,
+	406, 1539, 403, 406, 1538, 1540, 1537, 1540, 1539, 1537, 1539, 1541, 403, 1541, 400, 403,
+	1540, 1542, 1539, 1542, 1541, 1539, 695, 1540, 1538, 692, 695, 1538, 1543, 1542, 1540, 695,
+	1543, 1540, 1541, 1544, 400, 1544, 397, 400, 1542, 1545, 1541, 1545, 1544, 1541, 1544, 1546,
+	397, 1546, 394, 397, 1545, 1547, 1544, 1547, 1546, 1544, 1548, 1545, 1542, 1543, 1548, 1542,
+	1549, 1547, 1545, 1548, 1549, 1545, 1546, 1550, 394, 1550, 391, 394, 1547, 1551, 1546, 1551,
+	1550, 1546, 1550, 1552, 391, 1552, 388, 391, 1551, 1553, 1550, 1553, 1552, 1550, 1554, 1551,
+	1547, 1549, 1554, 1547, 1555, 1553, 1551, 1554, 1555, 1551, 1552, 1556, 388, 1556, 385, 388,
+	1553, 1557, 1552, 1557, 1556, 1552, 1556, 1558, 385, 1558, 382, 385, 1557, 1559, 1556, 1559,
+	1558, 1556, 1560, 1557, 1553, 1555, 1560, 1553, 1561, 1559, 1557, 1560, 1561, 1557, 1558, 1562,
+	382, 1562, 379, 382, 1559, 1563, 1558, 1563, 1562, 1558, 1562, 1564, 379, 1564, 376, 379,
+	1563, 1565, 1562, 1565, 1564, 1562, 1566, 1563, 1559, 1561, 1566, 1559, 1567, 1565, 1563, 1566,
+	1567, 1563, 1564, 1568, 376, 1568, 373, 376, 1565, 1569, 1564, 1569, 1568, 1564, 1568, 1570,
+	373, 1570, 370, 373, 1569, 1571, 1568, 1571, 1570, 1568, 1572, 1569, 1565, 1567, 1572, 1565,
+	1573, 1571, 1569, 1572, 1573, 1569, 1574, 1575, 1576, 1575, 1577, 1576, 1578, 1579, 1574, 1579,
+	1575, 1574, 1575, 1580, 1577, 1580, 1581, 1577, 1579, 1582, 1575, 1582, 1580, 1575, 1477, 1579,
+	1578, 1472, 1477, 1578, 1480, 1582, 1579, 1477, 1480, 1579, 1580, 1583, 1581, 1583, 1584, 1581,
+	1582, 1585, 1580, 1585, 1583, 1580, 1583, 1586, 1584, 1586, 1587, 1584, 1585, 1588, 1583, 1588,
+	1586, 1583, 1485, 1585, 1582, 1480, 1485, 1582, 1488, 1588, 1585, 1485, 1488, 1585, 1586, 1589,
+	1587, 1589, 1590, 1587, 1588, 1591, 1586, 1591, 1589, 1586, 1589, 1592, 1590, 1592, 1593, 1590,
+	1591, 1594, 1589, 1594, 1592, 1589, 1493, 1591, 1588, 1488, 1493, 1588, 1496, 1594, 1591, 1493,
+	1496, 1591, 1592, 1595, 1593, 1595, 1596, 1593, 1594, 1597, 1592, 1597, 1595, 1592, 1595, 1598,
+	1596, 1598, 1599, 1596, 1597, 1600, 1595, 1600, 1598, 1595, 1501, 1597, 1594, 1496, 1501, 1594,
+	1504, 1600, 1597, 1501, 1504, 1597, 1598, 1601, 1599, 1601, 1602, 1599, 1600, 1603, 1598, 1603,
+	1601, 1598, 1601, 1604, 1602, 1604, 1605, 1602, 1603, 1606, 1601, 1606, 1604, 1601, 1509, 1603,
+	1600, 1504, 1509, 1600, 1512, 1606, 1603, 1509, 1512, 1603, 1604, 1607, 1605, 1607, 1608, 1605,
+	1606, 1609, 1604, 1609, 1607, 1604, 1607, 1610, 1608, 1610, 1611, 1608, 1609, 1612, 1607, 1612,
+	1610, 1607, 1517, 1609, 1606, 1512, 1517, 1606, 1520, 1612, 1609, 1517, 1520, 1609, 1610, 1613,
+	1611, 1613, 1614, 1611, 1612, 1615, 1610, 1615, 1613, 1610, 1613, 1616, 1614, 1616, 1617, 1614,
+	1615, 1618, 1613, 1618, 1616, 1613, 1525, 1615, 1612, 1520, 1525, 1612, 929, 1618, 1615, 1525,
+	929, 1615, 1616, 1619, 1617, 1619, 1620, 1617, 1619, 1621, 1620, 1618, 1622, 1616, 1622, 1619,
+	1616, 1623, 1621, 1619, 1622, 1623, 1619, 1623, 1624, 1621, 930, 1622, 1618, 929, 930, 1618,
+	694, 1625, 695, 1625, 1543, 695, 696, 1626, 694, 1626, 1625, 694, 697, 1134, 696, 1134,
+	1626, 696, 1625, 1627, 1543, 1627, 1548, 1543, 1626, 1628, 1625, 1628, 1627, 1625, 1627, 1629,
+	1548, 1629, 1549, 1548, 1628, 1630, 1627, 1630, 1629, 1627, 1136, 1628, 1626, 1134, 1136, 1626,
+	1139, 1630, 1628, 1136, 1139, 1628, 1629, 1631, 1549, 1631, 1554, 1549, 1630, 1632, 1629, 1632,
+	1631, 1629, 1631, 1633, 1554, 1633, 1555, 1554, 1632, 1634, 1631, 1634, 1633, 1631, 1142, 1632,
+	1630, 1139, 1142, 1630, 1146, 1634, 1632, 1142, 1146, 1632, 1633, 1635, 1555, 1635, 1560, 1555,
+	1634, 1636, 1633, 1636, 1635, 1633, 1635, 1637, 1560, 1637, 1561, 1560, 1636, 1638, 1635, 1638,
+	1637, 1635, 1148, 1636, 1634, 1146, 1148, 1634, 1151, 1638, 1636, 1148, 1151, 1636, 1637, 1639,
+	1561, 1639, 1566, 1561, 1638, 1640, 1637, 1640, 1639, 1637, 1639, 1641, 1566, 1641, 1567, 1566,
+	1640, 1642, 1639, 1642, 1641, 1639, 1154, 1640, 1638, 1151, 1154, 1638, 1157, 1642, 1640, 1154,
+	1157, 1640, 1641, 1643, 1567, 1643, 1572, 1567, 1642, 1644, 1641, 1644, 1643, 1641, 1643, 1645,
+	1572, 1645, 1573, 1572, 1644, 1646, 1643, 1646, 1645, 1643, 1160, 1644, 1642, 1157, 1160, 1642,
+	1163, 1646, 1644, 1160, 1163, 1644, 1645, 1647, 1573, 1647, 1648, 1573, 1646, 1649, 1645, 1649,
+	1647, 1645, 1647, 1650, 1648, 1650, 1651, 1648, 1649, 1652, 1647, 1652, 1650, 1647, 1166, 1649,
+	1646, 1163, 1166, 1646, 1169, 1652, 1649, 1166, 1169, 1649, 1650, 1653, 1651, 1653, 1654, 1651,
+	1652, 1655, 1650, 1655, 1653, 1650, 1653, 1574, 1654, 1574, 1576, 1654, 1655, 1578, 1653, 1578,
+	1574, 1653, 1469, 1655, 1652, 1169, 1469, 1652, 1472, 1578, 1655, 1469, 1472, 1655, 1611, 1656,
+	1657, 1608, 1611, 1657, 1658, 1659, 322, 1659, 319, 322, 1656, 1660, 1658, 1660, 1659, 1658,
+	1659, 1661, 319, 1661, 316, 319, 1660, 1662, 1659, 1662, 1661, 1659, 1614, 1660, 1656, 1611,
+	1614, 1656, 1617, 1662, 1660, 1614, 1617, 1660, 1661, 1663, 316, 1663, 19, 316, 1663, 18,
+	19, 1662, 1664, 1661, 1664, 1663, 1661, 1665, 18, 1663, 1664, 1665, 1663, 1665, 20, 18,
+	1620, 1664, 1662, 1617, 1620, 1662, 1666, 1665, 1664, 1620, 1666, 1664, 1667, 20, 1665, 1666,
+	1667, 1665, 1667, 21, 20, 1621, 1666, 1620, 1668, 21, 1667, 1668, 24, 21, 1669, 1667,
+	1666, 1669, 1668, 1667, 1621, 1669, 1666, 1670, 24, 1668, 1670, 27, 24, 1671, 1668, 1669,
+	1671, 1670, 1668, 1672, 27, 1670, 1672, 30, 27, 1673, 1670, 1671, 1673, 1672, 1670, 1624,
+	1671, 1669, 1624, 1669, 1621, 1674, 1673, 1671, 1674, 1671, 1624, 1675, 30, 1672, 1675, 33,
+	30, 1676, 1672, 1673, 1676, 1675, 1672, 1677, 33, 1675, 1677, 36, 33, 1678, 1675, 1676,
+	1678, 1677, 1675, 1679, 1676, 1673, 1679, 1673, 1674, 1680, 1678, 1676, 1680, 1676, 1679, 1681,
+	36, 1677, 1681, 39, 36, 1682, 1677, 1678, 1682, 1681, 1677, 1683, 39, 1681, 1683, 42,
+	39, 1684, 1681, 1682, 1684, 1683, 1681, 1685, 1682, 1678, 1685, 1678, 1680, 1686, 1684, 1682,
+	1686, 1682, 1685, 1687, 42, 1683, 1687, 45, 42, 1688, 1683, 1684, 1688, 1687, 1683, 1689,
+	45, 1687, 1689, 48, 45, 1690, 1687, 1688, 1690, 1689, 1687, 1691, 1688, 1684, 1691, 1684,
+	1686, 1692, 1690, 1688, 1692, 1688, 1691, 1693, 48, 1689, 1693, 51, 48, 1694, 1689, 1690,
+	1694, 1693, 1689, 1695, 51, 1693, 1695, 54, 51, 1696, 1693, 1694, 1696, 1695, 1693, 1697,
+	1694, 1690, 1697, 1690, 1692, 1698, 1696, 1694, 1698, 1694, 1697, 1699, 54, 1695, 1699, 57,
+	54, 1700, 1695, 1696, 1700, 1699, 1695, 556, 57, 1699, 556, 60, 57, 558, 1699, 1700,
+	558, 556, 1699, 1701, 1700, 1696, 1701, 1696, 1698, 562, 558, 1700, 562, 1700, 1701, 1570,
+	1702, 370, 1702, 367, 370, 1571, 1703, 1570, 1703, 1702, 1570, 1702, 1704, 367, 1704, 364,
+	367, 1703, 1705, 1702, 1705, 1704, 1702, 1648, 1703, 1571, 1573, 1648, 1571, 1651, 1705, 1703,
+	1648, 1651, 1703, 1704, 1706, 364, 1706, 361, 364, 1705, 1707, 1704, 1707, 1706, 1704, 1706,
+	1708, 361, 1708, 358, 361, 1707, 1709, 1706, 1709, 1708, 1706, 1654, 1707, 1705, 1651, 1654,
+	1705, 1576, 1709, 1707, 1654, 1576, 1707, 1708, 1710, 358, 1710, 355, 358, 1709, 1711, 1708,
+	1711, 1710, 1708, 1710, 1712, 355, 1712, 352, 355, 1711, 1713, 1710, 1713, 1712, 1710, 1577,
+	1711, 1709, 1576, 1577, 1709, 1581, 1713, 1711, 1577, 1581, 1711, 1712, 1714, 352, 1714, 349,
+	352, 1713, 1715, 1712, 1715, 1714, 1712, 1714, 1716, 349, 1716, 346, 349, 1715, 1717, 1714,
+	1717, 1716, 1714, 1584, 1715, 1713, 1581, 1584, 1713, 1587, 1717, 1715, 1584, 1587, 1715, 1716,
+	1718, 346, 1718, 343, 346, 1717, 1719, 1716, 1719, 1718, 1716, 1718, 1720, 343, 1720, 340,
+	343, 1719, 1721, 1718, 1721, 1720, 1718, 1590, 1719, 1717, 1587, 1590, 1717, 1593, 1721, 1719,
+	1590, 1593, 1719, 1720, 1722, 340, 1722, 337, 340, 1721, 1723, 1720, 1723, 1722, 1720, 1722,
+	1724, 337, 1724, 334, 337, 1723, 1725, 1722, 1725, 1724, 1722, 1596, 1723, 1721, 1593, 1596,
+	1721, 1599, 1725, 1723, 1596, 1599, 1723, 1724, 1726, 334, 1726, 331, 334, 1725, 1727, 1724,
+	1727, 1726, 1724, 1726, 1728, 331, 1728, 328, 331, 1727, 1729, 1726, 1729, 1728, 1726, 1602,
+	1727, 1725, 1599, 1602, 1725, 1605, 1729, 1727, 1602, 1605, 1727, 1728, 1730, 328, 1730, 325,
+	328, 1729, 1657, 1728, 1657, 1730, 1728, 1730, 1658, 325, 1658, 322, 325, 1657, 1656, 1730,
+	1656, 1658, 1730, 1608, 1657, 1729, 1605, 1608, 1729, 1731, 1732, 1733, 1731, 1734, 1732, 1735,
+	1733, 1736, 1735, 1731, 1733, 1737, 1734, 1731, 1737, 1738, 1734, 1739, 1731, 1735, 1739, 1737,
+	1731, 1740, 1735, 1736, 1740, 1736, 1741, 1742, 1739, 1735, 1742, 1735, 1740, 1743, 1738, 1737,
+	1743, 1744, 1738, 1745, 1737, 1739, 1745, 1743, 1737, 1746, 1744, 1743, 1746, 1747, 1744, 1748,
+	1743, 1745, 1748, 1746, 1743, 1749, 1745, 1739, 1749, 1739, 1742, 1750, 1748, 1745, 1750, 1745,
+	1749, 1751, 1747, 1746, 1751, 1752, 1747, 1753, 1746, 1748, 1753, 1751, 1746, 1754, 1752, 1751,
+	1754, 1755, 1752, 1756, 1751, 1753, 1756, 1754, 1751, 1757, 1753, 1748, 1757, 1748, 1750, 1758,
+	1756, 1753, 1758, 1753, 1757, 1759, 1755, 1754, 1759, 1760, 1755, 1761, 1754, 1756, 1761, 1759,
+	1754, 1762, 1760, 1759, 1762, 1763, 1760, 1764, 1759, 1761, 1764, 1762, 1759, 1765, 1761, 1756,
+	1765, 1756, 1758, 1766, 1764, 1761, 1766, 1761, 1765, 1767, 1763, 1762, 1767, 1768, 1763, 1769,
+	1762, 1764, 1769, 1767, 1762, 1770, 1768, 1767, 1770, 1771, 1768, 1772, 1767, 1769, 1772, 1770,
+	1767, 1773, 1769, 1764, 1773, 1764, 1766, 1774, 1772, 1769, 1774, 1769, 1773, 1775, 1771, 1770,
+	1775, 1776, 1771, 1777, 1770, 1772, 1777, 1775, 1770, 1778, 1776, 1775, 1778, 1779, 1776, 1780,
+	1775, 1777, 1780, 1778, 1775, 1781, 1777, 1772, 1781, 1772, 1774, 1782, 1780, 1777, 1782, 1777,
+	1781, 1783, 1779, 1778, 1783, 1784, 1779, 1785, 1778, 1780, 1785, 1783, 1778, 1786, 1784, 1783,
+	1786, 1787, 1784, 1788, 1783, 1785, 1788, 1786, 1783, 1789, 1785, 1780, 1789, 1780, 1782, 1790,
+	1788, 1785, 1790, 1785, 1789, 1791, 1787, 1786, 1791, 1792, 1787, 1793, 1786, 1788, 1793, 1791,
+	1786, 1794, 1792, 1791, 1794, 1795, 1792, 1796, 1791, 1793, 1796, 1794, 1791, 1797, 1793, 1788,
+	1797, 1788, 1790, 1798, 1799, 1800, 1800, 1799, 1801, 1802, 1798, 1803, 1803, 1798, 1800, 65,
+	1802, 62, 62, 1802, 1803, 1800, 1801, 1804, 1804, 1801, 1805, 1803, 1800, 1806, 1806, 1800,
+	1804, 62, 1803, 59, 59, 1803, 1806, 1804, 1805, 1807, 1807, 1805, 1808, 1806, 1804, 1809,
+	1809, 1804, 1807, 59, 1806, 56, 56, 1806, 1809, 1807, 1808, 1810, 1810, 1808, 1811, 1809,
+	1807, 1812, 1812, 1807, 1810, 56, 1809, 53, 53, 1809, 1812, 1810, 1811, 1813, 1813, 1811,
+	1814, 1812, 1810, 1815, 1815, 1810, 1813, 53, 1812, 50, 50, 1812, 1815, 1813, 1814, 1816,
+	1816, 1814, 1817, 1815, 1813, 1818, 1818, 1813, 1816, 50, 1815, 47, 47, 1815, 1818, 1816,
+	1817, 1819, 1819, 1817, 1820, 1818, 1816, 1821, 1821, 1816, 1819, 47, 1818, 44, 44, 1818,
+	1821, 1819, 1820, 1822, 1822, 1820, 1823, 1821, 1819, 1824, 1824, 1819, 1822, 44, 1821, 41,
+	41, 1821, 1824, 1822, 1823, 1825, 1825, 1823, 1826, 1824, 1822, 1827, 1827, 1822, 1825, 41,
+	1824, 38, 38, 1824, 1827, 1825, 1826, 1828, 1828, 1826, 1829, 1827, 1825, 1830, 1830, 1825,
+	1828, 38, 1827, 35, 35, 1827, 1830, 1828, 1829, 1831, 1831, 1829, 1832, 1830, 1828, 1833,
+	1833, 1828, 1831, 35, 1830, 32, 32, 1830, 1833, 1831, 1832, 1834, 1834, 1832, 1835, 1833,
+	1831, 1836, 1836, 1831, 1834, 32, 1833, 29, 29, 1833, 1836, 1834, 1835, 1837, 1837, 1835,
+	1838, 1836, 1834, 1839, 1839, 1834, 1837, 29, 1836, 26, 26, 1836, 1839, 1837, 1838, 1840,
+	1840, 1838, 1841, 1839, 1837, 1842, 1842, 1837, 1840, 26, 1839, 23, 23, 1839, 1842, 1840,
+	1841, 0, 0, 1841, 1, 1842, 1840, 5, 5, 1840, 0, 23, 1842, 10, 10, 1842,
+	5, 1843, 1750, 1844, 1844, 1750, 1749, 1845, 1843, 1846, 1846, 1843, 1844, 1814, 1845, 1817,
+	1817, 1845, 1846, 1844, 1749, 1847, 1847, 1749, 1742, 1846, 1844, 1848, 1848, 1844, 1847, 1817,
+	1846, 1820, 1820, 1846, 1848, 1847, 1742, 1849, 1849, 1742, 1740, 1848, 1847, 1850, 1850, 1847,
+	1849, 1820, 1848, 1823, 1823, 1848, 1850, 1849, 1740, 1851, 1851, 1740, 1741, 1850, 1849, 1852,
+	1852, 1849, 1851, 1823, 1850, 1826, 1826, 1850, 1852, 1851, 1741, 1853, 1853, 1741, 1854, 1852,
+	1851, 1855, 1855, 1851, 1853, 1826, 1852, 1829, 1829, 1852, 1855, 1853, 1854, 1856, 1856, 1854,
+	1857, 1855, 1853, 1858, 1858, 1853, 1856, 1829, 1855, 1832, 1832, 1855, 1858, 1856, 1857, 1859,
+	1859, 1857, 1860, 1858, 1856, 1861, 1861, 1856, 1859, 1832, 1858, 1835, 1835, 1858, 1861, 1859,
+	1860, 1862, 1862, 1860, 1863, 1861, 1859, 1864, 1864, 1859, 1862, 1835, 1861, 1838, 1838, 1861,
+	1864, 1862, 1863, 1865, 1865, 1863, 1866, 1864, 1862, 1867, 1867, 1862, 1865, 1838, 1864, 1841,
+	1841, 1864, 1867, 1865, 1866, 1868, 1868, 1866, 1869, 1867, 1865, 1870, 1870, 1865, 1868, 1841,
+	1867, 1, 1, 1867, 1870, 1868, 1869, 1871, 1871, 1869, 1872, 1870, 1868, 1873, 1873, 1868,
+	1871, 1, 1870, 3, 3, 1870, 1873, 1871, 1872, 1874, 1874, 1872, 1875, 1873, 1871, 1876,
+	1876, 1871, 1874, 3, 1873, 306, 306, 1873, 1876, 1874, 1875, 1877, 1877, 1875, 1878, 1876,
+	1874, 1879, 1879, 1874, 1877, 306, 1876, 303, 303, 1876, 1879, 1877, 1878, 1880, 1880, 1878,
+	1881, 1879, 1877, 299, 299, 1877, 1880, 303, 1879, 298, 298, 1879, 299, 1880, 1881, 1882,
+	1882, 1881, 1883, 1882, 1883, 1884, 708, 1882, 1884, 1885, 1880, 1882, 1885, 1882, 708, 299,
+	1880, 1885, 707, 1885, 708, 300, 1885, 707, 300, 299, 1885, 1886, 1887, 1888, 1889, 1886,
+	1888, 1887, 1890, 1891, 1888, 1887, 1891, 1891, 1890, 1892, 1889, 1888, 1893, 1891, 1892, 1894,
+	1894, 1892, 1895, 1888, 1891, 1896, 1896, 1891, 1894, 1893, 1888, 1896, 1894, 1895, 1897, 1897,
+	1895, 1797, 1896, 1894, 1898, 1898, 1894, 1897, 1893, 1896, 1899, 1899, 1896, 1898, 1897, 1797,
+	1900, 1900, 1797, 1790, 1898, 1897, 1901, 1901, 1897, 1900, 1899, 1898, 1902, 1902, 1898, 1901,
+	1900, 1790, 1903, 1903, 1790, 1789, 1901, 1900, 1904, 1904, 1900, 1903, 1902, 1901, 1905, 1905,
+	1901, 1904, 1903, 1789, 1906, 1906, 1789, 1782, 1904, 1903, 1907, 1907, 1903, 1906, 1905, 1904,
+	1908, 1908, 1904, 1907, 1906, 1782, 1909, 1909, 1782, 1781, 1907, 1906, 1910, 1910, 1906, 1909,
+	1908, 1907, 1911, 1911, 1907, 1910, 1909, 1781, 1912, 1912, 1781, 1774, 1910, 1909, 1913, 1913,
+	1909, 1912, 1911, 1910, 1914, 1914, 1910, 1913, 1912, 1774, 1915, 1915, 1774, 1773, 1913, 1912,
+	1916, 1916, 1912, 1915, 1914, 1913, 1799, 1799, 1913, 1916, 1915, 1773, 1917, 1917, 1773, 1766,
+	1916, 1915, 1918, 1918, 1915, 1917, 1799, 1916, 1801, 1801, 1916, 1918, 1917, 1766, 1919, 1919,
+	1766, 1765, 1918, 1917, 1920, 1920, 1917, 1919, 1801, 1918, 1805, 1805, 1918, 1920, 1919, 1765,
+	1921, 1921, 1765, 1758, 1920, 1919, 1922, 1922, 1919, 1921, 1805, 1920, 1808, 1808, 1920, 1922,
+	1921, 1758, 1923, 1923, 1758, 1757, 1922, 1921, 1924, 1924, 1921, 1923, 1808, 1922, 1811, 1811,
+	1922, 1924, 1923, 1757, 1843, 1843, 1757, 1750, 1924, 1923, 1845, 1845, 1923, 1843, 1811, 1924,
+	1814, 1814, 1924, 1845, 1925, 1623, 1622, 930, 1925, 1622, 1926, 1624, 1623, 1925, 1926, 1623,
+	1926, 1674, 1624, 931, 1925, 930, 1927, 1674, 1926, 1927, 1679, 1674, 1928, 1926, 1925, 1928,
+	1927, 1926, 931, 1928, 1925, 1929, 1679, 1927, 1929, 1680, 1679, 1930, 1927, 1928, 1930, 1929,
+	1927, 1931, 1680, 1929, 1931, 1685, 1680, 1932, 1929, 1930, 1932, 1931, 1929, 934, 1930, 1928,
+	934, 1928, 931, 938, 1932, 1930, 938, 1930, 934, 1933, 1685, 1931, 1933, 1686, 1685, 1934,
+	1931, 1932, 1934, 1933, 1931, 1935, 1686, 1933, 1935, 1691, 1686, 1936, 1933, 1934, 1936, 1935,
+	1933, 941, 1934, 1932, 941, 1932, 938, 944, 1936, 1934, 944, 1934, 941, 1937, 1691, 1935,
+	1937, 1692, 1691, 1938, 1935, 1936, 1938, 1937, 1935, 1939, 1692, 1937, 1939, 1697, 1692, 1940,
+	1937, 1938, 1940, 1939, 1937, 947, 1938, 1936, 947, 1936, 944, 952, 1940, 1938, 952, 1938,
+	947, 1941, 1697, 1939, 1941, 1698, 1697, 1942, 1939, 1940, 1942, 1941, 1939, 1943, 1698, 1941,
+	1943, 1701, 1698, 1944, 1941, 1942, 1944, 1943, 1941, 1082, 1942, 1940, 1082, 1940, 952, 1945,
+	1944, 1942, 1945, 1942, 1082, 1946, 1701, 1943, 1946, 562, 1701, 564, 562, 1946, 568, 564,
+	1946, 1947, 1946, 1943, 568, 1946, 1947, 1947, 1943, 1944, 575, 568, 1947, 1948, 1947, 1944,
+	575, 1947, 1948, 1948, 1944, 1945, 1949, 575, 1948, 572, 575, 1949, 574, 572, 1949, 1078,
+	1948, 1945, 1949, 1948, 1078, 574, 1949, 1077, 1077, 1949, 1078, 577, 574, 1077, 1078, 1945,
+	1080, 1080, 1945, 1082, 1950, 1951, 1952, 1953, 1950, 1952, 1954, 1955, 1956, 1955, 1957, 1956,
+	1951, 1958, 1954, 1958, 1955, 1954, 1955, 1959, 1957, 1959, 1960, 1957, 1958, 1961, 1955, 1961,
+	1959, 1955, 1962, 1958, 1951, 1950, 1962, 1951, 1963, 1961, 1958, 1962, 1963, 1958, 1959, 1964,
+	1960, 1964, 1965, 1960, 1961, 1966, 1959, 1966, 1964, 1959, 1964, 1967, 1965, 1967, 1968, 1965,
+	1966, 1969, 1964, 1969, 1967, 1964, 1970, 1966, 1961, 1963, 1970, 1961, 1971, 1969, 1966, 1970,
+	1971, 1966, 1967, 1972, 1968, 1972, 1973, 1968, 1969, 1974, 1967, 1974, 1972, 1967, 1972, 1975,
+	1973, 1975, 1976, 1973, 1974, 1977, 1972, 1977, 1975, 1972, 1978, 1974, 1969, 1971, 1978, 1969,
+	704, 1977, 1974, 1978, 704, 1974, 1975, 1979, 1976, 1979, 1980, 1976, 1977, 1981, 1975, 1981,
+	1979, 1975, 1979, 1982, 1980, 1982, 1983, 1980, 1981, 1884, 1979, 1884, 1982, 1979, 705, 1981,
+	1977, 704, 705, 1977, 708, 1884, 1981, 705, 708, 1981, 1982, 1984, 1983, 1984, 1985, 1983,
+	1884, 1883, 1982, 1883, 1984, 1982, 1984, 1986, 1985, 1986, 1987, 1985, 1986, 1988, 1987, 1989,
+	1986, 1984, 1883, 1989, 1984, 1990, 1988, 1986, 1989, 1990, 1986, 1990, 1991, 1988, 1881, 1989,
+	1883, 1992, 1991, 1990, 1992, 1993, 1991, 1994, 1990, 1989, 1994, 1992, 1990, 1881, 1994, 1989,
+	1995, 1993, 1992, 1995, 1996, 1993, 1997, 1992, 1994, 1997, 1995, 1992, 1998, 1996, 1995, 1998,
+	1999, 1996, 2000, 1995, 1997, 2000, 1998, 1995, 1878, 1997, 1994, 1878, 1994, 1881, 1875, 2000,
+	1997, 1875, 1997, 1878, 2001, 1999, 1998, 2001, 2002, 1999, 2003, 1998, 2000, 2003, 2001, 1998,
+	2004, 2002, 2001, 2004, 2005, 2002, 2006, 2001, 2003, 2006, 2004, 2001, 1872, 2003, 2000, 1872,
+	2000, 1875, 1869, 2006, 2003, 1869, 2003, 1872, 2007, 2005, 2004, 2007, 2008, 2005, 2009, 2004,
+	2006, 2009, 2007, 2004, 2010, 2008, 2007, 2010, 2011, 2008, 2012, 2007, 2009, 2012, 2010, 2007,
+	1866, 2009, 2006, 1866, 2006, 1869, 1863, 2012, 2009, 1863, 2009, 1866, 2013, 2011, 2010, 2013,
+	2014, 2011, 2015, 2010, 2012, 2015, 2013, 2010, 2016, 2014, 2013, 2016, 2017, 2014, 2018, 2013,
+	2015, 2018, 2016, 2013, 1860, 2015, 2012, 1860, 2012, 1863, 1857, 2018, 2015, 1857, 2015, 1860,
+	2019, 2017, 2016, 2019, 2020, 2017, 2021, 2016, 2018, 2021, 2019, 2016, 1733, 2020, 2019, 1733,
+	1732, 2020, 1736, 2019, 2021, 1736, 1733, 2019, 1854, 2021, 2018, 1854, 2018, 1857, 1741, 1736,
+	2021, 1741, 2021, 1854, 2022, 2023, 127, 2022, 127, 130, 2024, 2025, 2023, 2026, 2027, 2024,
+	2024, 2027, 2025, 2026, 2028, 2027, 2023, 2025, 124, 2023, 124, 127, 2028, 2029, 2027, 2028,
+	2030, 2029, 2027, 2031, 2025, 2027, 2029, 2031, 2030, 2032, 2029, 2030, 2033, 2032, 2029, 2034,
+	2031, 2029, 2032, 2034, 2025, 2031, 121, 2025, 121, 124, 2031, 2034, 118, 2031, 118, 121,
+	2032, 2035, 2034, 2033, 2036, 2032, 2032, 2036, 2035, 2033, 2037, 2036, 2034, 2035, 115, 2034,
+	115, 118, 2037, 2038, 2036, 2037, 2039, 2038, 2036, 2040, 2035, 2036, 2038, 2040, 2039, 2041,
+	2038, 2039, 2042, 2041, 2038, 2043, 2040, 2038, 2041, 2043, 2035, 2040, 112, 2035, 112, 115,
+	2040, 2043, 109, 2040, 109, 112, 2041, 2044, 2043, 2042, 2045, 2041, 2041, 2045, 2044, 2042,
+	2046, 2045, 2043, 2044, 106, 2043, 106, 109, 2046, 2047, 2045, 2046, 2048, 2047, 2045, 2049,
+	2044, 2045, 2047, 2049, 2048, 2050, 2047, 2048, 2051, 2050, 2047, 2052, 2049, 2047, 2050, 2052,
+	2044, 2049, 103, 2044, 103, 106, 2049, 2052, 99, 2049, 99, 103, 2050, 2053, 2052, 2051,
+	2054, 2050, 2050, 2054, 2053, 2051, 2055, 2054, 2052, 2053, 96, 2052, 96, 99, 2055, 2056,
+	2054, 2055, 2057, 2056, 2054, 2058, 2053, 2054, 2056, 2058, 2057, 2059, 2056, 2057, 2060, 2059,
+	2056, 2061, 2058, 2056, 2059, 2061, 2053, 2058, 92, 2053, 92, 96, 2058, 2061, 88, 2058,
+	88, 92, 2059, 2062, 2061, 2060, 2063, 2059, 2059, 2063, 2062, 2060, 2064, 2063, 2061, 2062,
+	85, 2061, 85, 88, 2064, 2065, 2063, 2064, 2066, 2065, 2063, 2067, 2062, 2063, 2065, 2067,
+	2066, 2068, 2065, 2066, 2069, 2068, 2065, 2070, 2067, 2065, 2068, 2070, 2062, 2067, 81, 2062,
+	81, 85, 2067, 2070, 78, 2067, 78, 81, 2068, 2071, 2070, 2069, 2072, 2068, 2068, 2072,
+	2071, 2069, 2073, 2072, 2070, 2071, 76, 2070, 76, 78, 2073, 2074, 2072, 2073, 2075, 2074,
+	2072, 2076, 2071, 2072, 2074, 2076, 2075, 2077, 2074, 2075, 2078, 2077, 2074, 2079, 2076, 2074,
+	2077, 2079, 2071, 2076, 75, 2071, 75, 76, 551, 554, 181, 551, 181, 184, 552, 2080,
+	554, 553, 2081, 552, 552, 2081, 2080, 553, 2082, 2081, 554, 2080, 178, 554, 178, 181,
+	2082, 2083, 2081, 2082, 2084, 2083, 2081, 2085, 2080, 2081, 2083, 2085, 2084, 2086, 2083, 2084,
+	2087, 2086, 2083, 2088, 2085, 2083, 2086, 2088, 2080, 2085, 175, 2080, 175, 178, 2085, 2088,
+	172, 2085, 172, 175, 2086, 2089, 2088, 2087, 2090, 2086, 2086, 2090, 2089, 2087, 2091, 2090,
+	2088, 2089, 169, 2088, 169, 172, 2091, 2092, 2090, 2091, 2093, 2092, 2090, 2094, 2089, 2090,
+	2092, 2094, 2093, 2095, 2092, 2093, 2096, 2095, 2092, 2097, 2094, 2092, 2095, 2097, 2089, 2094,
+	166, 2089, 166, 169, 2094, 2097, 163, 2094, 163, 166, 2095, 2098, 2097, 2096, 2099, 2095,
+	2095, 2099, 2098, 2096, 2100, 2099, 2097, 2098, 160, 2097, 160, 163, 2100, 2101, 2099, 2100,
+	2102, 2101, 2099, 2103, 2098, 2099, 2101, 2103, 2102, 2104, 2101, 2102, 2105, 2104, 2101, 2106,
+	2103, 2101, 2104, 2106, 2098, 2103, 157, 2098, 157, 160, 2103, 2106, 154, 2103, 154, 157,
+	2104, 2107, 2106, 2105, 2108, 2104, 2104, 2108, 2107, 2105, 2109, 2108, 2106, 2107, 151, 2106,
+	151, 154, 2109, 2110, 2108, 2109, 2111, 2110, 2108, 2112, 2107, 2108, 2110, 2112, 2111, 2113,
+	2110, 2111, 2114, 2113, 2110, 2115, 2112, 2110, 2113, 2115, 2107, 2112, 148, 2107, 148, 151,
+	2112, 2115, 145, 2112, 145, 148, 2113, 2116, 2115, 2114, 2117, 2113, 2113, 2117, 2116, 2114,
+	2118, 2117, 2115, 2116, 142, 2115, 142, 145, 2118, 2119, 2117, 2118, 2120, 2119, 2117, 2121,
+	2116, 2117, 2119, 2121, 2120, 2122, 2119, 2120, 2123, 2122, 2119, 2124, 2121, 2119, 2122, 2124,
+	2116, 2121, 139, 2116, 139, 142, 2121, 2124, 136, 2121, 136, 139, 2122, 2125, 2124, 2123,
+	2126, 2122, 2122, 2126, 2125, 2123, 2127, 2126, 2124, 2125, 133, 2124, 133, 136, 2127, 2128,
+	2126, 2127, 2129, 2128, 2126, 2022, 2125, 2126, 2128, 2022, 2129, 2024, 2128, 2129, 2026, 2024,
+	2128, 2023, 2022, 2128, 2024, 2023, 2125, 2022, 130, 2125, 130, 133, 1895, 1796, 1793, 1895,
+	1793, 1797, 2130, 1795, 1794, 2130, 2131, 1795, 2132, 1794, 1796, 2132, 2130, 1794, 2133, 2131,
+	2130, 2133, 2134, 2131, 2135, 2130, 2132, 2135, 2133, 2130, 1892, 2132, 1796, 1892, 1796, 1895,
+	1890, 2135, 2132, 1890, 2132, 1892, 2136, 2134, 2133, 2136, 2137, 2134, 2138, 2133, 2135, 2138,
+	2136, 2133, 2139, 2137, 2136, 2139, 2140, 2137, 2141, 2136, 2138, 2141, 2139, 2136, 2142, 2138,
+	2135, 2142, 2135, 1890, 2143, 2141, 2138, 2143, 2138, 2142, 2144, 2140, 2139, 2144, 2145, 2140,
+	2146, 2139, 2141, 2146, 2144, 2139, 2147, 2145, 2144, 2147, 2148, 2145, 2149, 2144, 2146, 2149,
+	2147, 2144, 2150, 2146, 2141, 2150, 2141, 2143, 1178, 2149, 2146, 1178, 2146, 2150, 2151, 2148,
+	2147, 2151, 2152, 2148, 2153, 2147, 2149, 2153, 2151, 2147, 2154, 2152, 2151, 2154, 2155, 2152,
+	2156, 2151, 2153, 2156, 2154, 2151, 1176, 2153, 2149, 1176, 2149, 1178, 2157, 2156, 2153, 2157,
+	2153, 1176, 2158, 2155, 2154, 2158, 2159, 2155, 2160, 2154, 2156, 2160, 2158, 2154, 2161, 2159,
+	2158, 2161, 2162, 2159, 2163, 2164, 2162, 2163, 2162, 2161, 2165, 2163, 2161, 2166, 2161, 2158,
+	2165, 2161, 2166, 2166, 2158, 2160, 2167, 2165, 2166, 2167, 2166, 2168, 2168, 2166, 2160, 2169,
+	2167, 2168, 2170, 2160, 2156, 2168, 2160, 2170, 2170, 2156, 2157, 2169, 2168, 2171, 2171, 2168,
+	2170, 2172, 2169, 2171, 2173, 2170, 2157, 2171, 2170, 2173, 2172, 2171, 2174, 2174, 2171, 2173,
+	1173, 2172, 2174, 2173, 2157, 1175, 1175, 2157, 1176, 2174, 2173, 1181, 1181, 2173, 1175, 1173,
+	2174, 1174, 1174, 2174, 1181, 2175, 2176, 1490, 2177, 2176, 2175, 2176, 1491, 1490, 2178, 2179,
+	2180, 1009, 2179, 2178, 1009, 1006, 2179, 2176, 2181, 1491, 2181, 1498, 1491, 1006, 2182, 2179,
+	1006, 1003, 2182, 2179, 2183, 2180, 2179, 2182, 2183, 2180, 2183, 2177, 1003, 2184, 2182, 1003,
+	1000, 2184, 2182, 2185, 2183, 2182, 2184, 2185, 2183, 2186, 2177, 2177, 2186, 2176, 2183, 2185,
+	2186, 2186, 2181, 2176, 2185, 2187, 2186, 2186, 2187, 2181, 2184, 2188, 2185, 2185, 2188, 2187,
+	1000, 2189, 2184, 2184, 2189, 2188, 1000, 997, 2189, 2187, 2190, 2181, 2181, 2190, 1498, 2190,
+	1499, 1498, 2187, 2191, 2190, 2188, 2191, 2187, 2190, 2192, 1499, 2191, 2192, 2190, 2192, 1506,
+	1499, 2188, 2193, 2191, 2189, 2193, 2188, 2191, 2194, 2192, 2193, 2194, 2191, 2192, 2195, 1506,
+	2194, 2195, 2192, 2195, 1507, 1506, 2189, 2196, 2193, 997, 2196, 2189, 997, 994, 2196, 2195,
+	2197, 1507, 2197, 1514, 1507, 994, 2198, 2196, 994, 991, 2198, 2196, 2199, 2193, 2196, 2198,
+	2199, 2193, 2199, 2194, 991, 2200, 2198, 991, 988, 2200, 2198, 2201, 2199, 2198, 2200, 2201,
+	2199, 2202, 2194, 2194, 2202, 2195, 2199, 2201, 2202, 2202, 2197, 2195, 1024, 2203, 1072, 1072,
+	2203, 1076, 1024, 1021, 2203, 1075, 2204, 1068, 1068, 2204, 1069, 2204, 1171, 1069, 1075, 2205,
+	2204, 1076, 2205, 1075, 2204, 2206, 1171, 2205, 2206, 2204, 2206, 1474, 1171, 1076, 2207, 2205,
+	2203, 2207, 1076, 2205, 2208, 2206, 2207, 2208, 2205, 2206, 2209, 1474, 2208, 2209, 2206, 2209,
+	1475, 1474, 2203, 2210, 2207, 1021, 2210, 2203, 1021, 1018, 2210, 2209, 2211, 1475, 2211, 1482,
+	1475, 1018, 2212, 2210, 1018, 1015, 2212, 2210, 2213, 2207, 2210, 2212, 2213, 2207, 2213, 2208,
+	1015, 2214, 2212, 1015, 1012, 2214, 2212, 2215, 2213, 2212, 2214, 2215, 2213, 2216, 2208, 2208,
+	2216, 2209, 2213, 2215, 2216, 2216, 2211, 2209, 2215, 2217, 2216, 2216, 2217, 2211, 2214, 2218,
+	2215, 2215, 2218, 2217, 1012, 2178, 2214, 2214, 2178, 2218, 1012, 1009, 2178, 2217, 2219, 2211,
+	2211, 2219, 1482, 2219, 1483, 1482, 2217, 2220, 2219, 2218, 2220, 2217, 2219, 2175, 1483, 2220,
+	2175, 2219, 2175, 1490, 1483, 2218, 2180, 2220, 2178, 2180, 2218, 2220, 2177, 2175, 2180, 2177,
+	2220, 2076, 2079, 2221, 2076, 2221, 75, 2077, 2222, 2079, 2078, 2223, 2077, 2077, 2223, 2222,
+	2078, 2224, 2223, 2079, 2222, 2225, 2079, 2225, 2221, 2224, 2226, 2223, 2224, 2227, 2226, 2227,
+	2228, 2226, 2223, 2229, 2222, 2223, 2226, 2229, 2226, 2228, 2230, 2226, 2230, 2229, 2228, 1889,
+	2230, 2230, 1889, 1893, 2230, 1893, 2231, 2229, 2230, 2231, 2231, 1893, 1899, 2222, 2229, 2232,
+	2229, 2231, 2232, 2222, 2232, 2225, 2231, 1899, 2233, 2232, 2231, 2233, 2233, 1899, 1902, 2225,
+	2232, 2234, 2232, 2233, 2234, 2233, 1902, 2235, 2234, 2233, 2235, 2235, 1902, 1905, 2225, 2234,
+	2236, 2221, 2225, 2236, 2234, 2235, 2237, 2236, 2234, 2237, 2235, 1905, 2238, 2237, 2235, 2238,
+	2238, 1905, 1908, 2221, 2236, 72, 75, 2221, 72, 2236, 2237, 71, 72, 2236, 71, 2237,
+	2238, 2239, 71, 2237, 2239, 2238, 1908, 2240, 2239, 2238, 2240, 2240, 1908, 1911, 71, 2239,
+	68, 2240, 1911, 2241, 2241, 1911, 1914, 2239, 2240, 2242, 2242, 2240, 2241, 68, 2239, 2242,
+	2241, 1914, 1798, 1798, 1914, 1799, 2242, 2241, 1802, 1802, 2241, 1798, 68, 2242, 65, 65,
+	2242, 1802, 747, 2243, 2244, 749, 747, 2244, 2245, 2246, 2247, 2246, 2248, 2247, 2243, 2249,
+	2245, 2249, 2246, 2245, 2246, 2250, 2248, 2250, 2251, 2248, 2249, 2252, 2246, 2252, 2250, 2246,
+	745, 2249, 2243, 747, 745, 2243, 743, 2252, 2249, 745, 743, 2249, 2250, 2253, 2251, 2253,
+	2254, 2251, 2252, 2255, 2250, 2255, 2253, 2250, 2253, 2256, 2254, 2256, 2257, 2254, 2255, 2258,
+	2253, 2258, 2256, 2253, 741, 2255, 2252, 743, 741, 2252, 739, 2258, 2255, 741, 739, 2255,
+	2256, 2259, 2257, 2259, 2260, 2257, 2258, 2261, 2256, 2261, 2259, 2256, 2259, 2262, 2260, 2262,
+	2263, 2260, 2261, 2264, 2259, 2264, 2262, 2259, 737, 2261, 2258, 739, 737, 2258, 735, 2264,
+	2261, 737, 735, 2261, 2262, 2265, 2263, 2265, 2266, 2263, 2264, 2267, 2262, 2267, 2265, 2262,
+	2265, 2268, 2266, 2268, 2269, 2266, 2267, 2270, 2265, 2270, 2268, 2265, 733, 2267, 2264, 735,
+	733, 2264, 731, 2270, 2267, 733, 731, 2267, 2268, 2271, 2269, 2271, 2272, 2269, 2270, 2273,
+	2268, 2273, 2271, 2268, 2271, 2274, 2272, 2274, 2275, 2272, 2273, 2276, 2271, 2276, 2274, 2271,
+	729, 2273, 2270, 731, 729, 2270, 727, 2276, 2273, 729, 727, 2273, 2274, 2277, 2275, 2277,
+	1953, 2275, 2276, 2278, 2274, 2278, 2277, 2274, 2277, 2279, 1953, 2279, 1950, 1953, 2278, 2280,
+	2277, 2280, 2279, 2277, 725, 2278, 2276, 727, 725, 2276, 723, 2280, 2278, 725, 723, 2278,
+	2279, 2281, 1950, 2281, 1962, 1950, 2280, 2282, 2279, 2282, 2281, 2279, 2281, 2283, 1962, 2283,
+	1963, 1962, 2282, 2284, 2281, 2284, 2283, 2281, 721, 2282, 2280, 723, 721, 2280, 719, 2284,
+	2282, 721, 719, 2282, 2283, 2285, 1963, 2285, 1970, 1963, 2284, 2286, 2283, 2286, 2285, 2283,
+	2285, 2287, 1970, 2287, 1971, 1970, 2286, 2288, 2285, 2288, 2287, 2285, 717, 2286, 2284, 719,
+	717, 2284, 715, 2288, 2286, 717, 715, 2286, 2287, 2289, 1971, 2289, 1978, 1971, 2288, 700,
+	2287, 700, 2289, 2287, 2289, 702, 1978, 702, 704, 1978, 700, 699, 2289, 699, 702, 2289,
+	701, 700, 2288, 715, 701, 2288, 2201, 2290, 2202, 2202, 2290, 2197, 2200, 2291, 2201, 2201,
+	2291, 2290, 988, 2292, 2200, 2200, 2292, 2291, 988, 985, 2292, 2290, 2293, 2197, 2197, 2293,
+	1514, 2293, 1515, 1514, 2290, 2294, 2293, 2291, 2294, 2290, 2293, 2295, 1515, 2294, 2295, 2293,
+	2295, 1522, 1515, 2291, 2296, 2294, 2292, 2296, 2291, 2294, 2297, 2295, 2296, 2297, 2294, 2295,
+	2298, 1522, 2297, 2298, 2295, 2298, 1523, 1522, 2292, 2299, 2296, 985, 2299, 2292, 985, 982,
+	2299, 2298, 2300, 1523, 2300, 926, 1523, 982, 2301, 2299, 982, 978, 2301, 2299, 2302, 2296,
+	2299, 2301, 2302, 2296, 2302, 2297, 978, 2303, 2301, 978, 975, 2303, 975, 979, 2303, 2301,
+	2304, 2302, 2301, 2303, 2304, 2302, 2305, 2297, 2302, 2304, 2305, 2297, 2305, 2298, 2305, 2300,
+	2298, 2303, 2306, 2304, 2303, 979, 2306, 2304, 2307, 2305, 2305, 2307, 2300, 2304, 2306, 2307,
+	2307, 2308, 2300, 2300, 2308, 926, 2309, 2310, 2057, 2309, 2057, 2055, 2311, 2312, 2310, 1218,
+	2313, 2311, 2311, 2313, 2312, 1218, 1215, 2313, 2310, 2312, 2060, 2310, 2060, 2057, 1215, 2314,
+	2313, 1215, 1212, 2314, 2313, 2315, 2312, 2313, 2314, 2315, 1212, 2316, 2314, 1212, 1209, 2316,
+	2314, 2317, 2315, 2314, 2316, 2317, 2312, 2315, 2064, 2312, 2064, 2060, 2315, 2317, 2066, 2315,
+	2066, 2064, 2316, 2318, 2317, 1209, 2319, 2316, 2316, 2319, 2318, 1209, 1206, 2319, 2317, 2318,
+	2069, 2317, 2069, 2066, 1206, 2320, 2319, 1206, 1203, 2320, 2319, 2321, 2318, 2319, 2320, 2321,
+	1203, 2322, 2320, 1203, 1200, 2322, 2320, 2323, 2321, 2320, 2322, 2323, 2318, 2321, 2073, 2318,
+	2073, 2069, 2321, 2323, 2075, 2321, 2075, 2073, 2322, 2324, 2323, 1200, 2325, 2322, 2322, 2325,
+	2324, 1200, 1197, 2325, 2323, 2324, 2078, 2323, 2078, 2075, 1197, 2326, 2325, 1197, 1193, 2326,
+	2325, 2327, 2324, 2325, 2326, 2327, 1193, 2328, 2326, 1193, 1190, 2328, 1190, 1194, 2328, 2326,
+	2328, 2329, 2326, 2329, 2327, 2328, 1194, 2330, 2328, 2330, 2329, 2324, 2327, 2224, 2324, 2224,
+	2078, 2327, 2329, 2227, 2327, 2227, 2224, 2329, 2330, 2331, 2329, 2331, 2227, 1194, 2332, 2330,
+	1194, 1187, 2332, 2330, 2333, 2331, 2330, 2332, 2333, 1187, 2334, 2332, 1187, 1183, 2334, 1183,
+	1177, 2334, 2332, 2334, 2335, 2332, 2335, 2333, 2334, 1177, 2336, 2334, 2336, 2335, 1177, 1178,
+	2336, 2336, 1178, 2150, 2336, 2150, 2337, 2335, 2336, 2337, 2337, 2150, 2143, 2335, 2337, 2338,
+	2333, 2335, 2338, 2337, 2143, 2339, 2338, 2337, 2339, 2339, 2143, 2142, 2333, 2338, 2340, 2331,
+	2333, 2340, 2338, 2339, 1886, 2340, 2338, 1886, 2339, 2142, 1887, 1886, 2339, 1887, 1887, 2142,
+	1890, 2331, 2340, 2228, 2227, 2331, 2228, 2340, 1886, 1889, 2228, 2340, 1889, 2341, 2342, 2343,
+	2342, 2344, 2343, 2345, 2346, 2341, 2346, 2342, 2341, 2342, 2347, 2344, 2347, 2348, 2344, 2346,
+	2349, 2342, 2349, 2347, 2342, 777, 2346, 2345, 779, 777, 2345, 775, 2349, 2346, 777, 775,
+	2346, 2347, 2350, 2348, 2350, 2351, 2348, 2349, 2352, 2347, 2352, 2350, 2347, 2350, 2353, 2351,
+	2353, 2354, 2351, 2352, 2355, 2350, 2355, 2353, 2350, 773, 2352, 2349, 775, 773, 2349, 771,
+	2355, 2352, 773, 771, 2352, 2353, 2356, 2354, 2356, 2357, 2354, 2355, 2358, 2353, 2358, 2356,
+	2353, 2356, 2359, 2357, 2359, 2360, 2357, 2358, 2361, 2356, 2361, 2359, 2356, 769, 2358, 2355,
+	771, 769, 2355, 767, 2361, 2358, 769, 767, 2358, 2359, 2362, 2360, 2362, 2363, 2360, 2361,
+	2364, 2359, 2364, 2362, 2359, 2362, 2365, 2363, 2365, 2366, 2363, 2364, 2367, 2362, 2367, 2365,
+	2362, 765, 2364, 2361, 767, 765, 2361, 763, 2367, 2364, 765, 763, 2364, 2365, 2368, 2366,
+	2368, 2369, 2366, 2367, 2370, 2365, 2370, 2368, 2365, 2368, 2371, 2369, 2371, 2372, 2369, 2370,
+	2373, 2368, 2373, 2371, 2368, 761, 2370, 2367, 763, 761, 2367, 759, 2373, 2370, 761, 759,
+	2370, 2371, 2374, 2372, 2374, 2375, 2372, 2373, 2376, 2371, 2376, 2374, 2371, 2374, 2377, 2375,
+	2377, 2378, 2375, 2376, 2379, 2374, 2379, 2377, 2374, 757, 2376, 2373, 759, 757, 2373, 755,
+	2379, 2376, 757, 755, 2376, 2377, 2380, 2378, 2380, 2381, 2378, 2379, 2382, 2377, 2382, 2380,
+	2377, 2380, 2383, 2381, 2383, 2384, 2381, 2382, 2385, 2380, 2385, 2383, 2380, 753, 2382, 2379,
+	755, 753, 2379, 751, 2385, 2382, 753, 751, 2382, 2383, 2386, 2384, 2386, 2387, 2384, 2385,
+	2244, 2383, 2244, 2386, 2383, 2386, 2245, 2387, 2245, 2247, 2387, 2244, 2243, 2386, 2243, 2245,
+	2386, 749, 2244, 2385, 751, 749, 2385, 1465, 2388, 1466, 2388, 2389, 1466, 1467, 2390, 1465,
+	2390, 2388, 1465, 811, 808, 1467, 808, 2390, 1467, 2388, 2391, 2389, 2391, 2392, 2389, 2390,
+	2393, 2388, 2393, 2391, 2388, 2391, 2394, 2392, 2394, 2395, 2392, 2393, 2396, 2391, 2396, 2394,
+	2391, 805, 2393, 2390, 808, 805, 2390, 803, 2396, 2393, 805, 803, 2393, 2394, 2397, 2395,
+	2397, 2398, 2395, 2396, 2399, 2394, 2399, 2397, 2394, 2397, 2400, 2398, 2400, 2401, 2398, 2399,
+	2402, 2397, 2402, 2400, 2397, 801, 2399, 2396, 803, 801, 2396, 799, 2402, 2399, 801, 799,
+	2399, 2400, 2403, 2401, 2403, 2404, 2401, 2402, 2405, 2400, 2405, 2403, 2400, 2403, 2406, 2404,
+	2406, 2407, 2404, 2405, 2408, 2403, 2408, 2406, 2403, 797, 2405, 2402, 799, 797, 2402, 795,
+	2408, 2405, 797, 795, 2405, 2406, 2409, 2407, 2409, 2410, 2407, 2408, 2411, 2406, 2411, 2409,
+	2406, 2409, 2412, 2410, 2412, 2413, 2410, 2411, 2414, 2409, 2414, 2412, 2409, 793, 2411, 2408,
+	795, 793, 2408, 791, 2414, 2411, 793, 791, 2411, 2412, 2415, 2413, 2415, 2416, 2413, 2414,
+	2417, 2412, 2417, 2415, 2412, 2415, 2418, 2416, 2418, 2419, 2416, 2417, 2420, 2415, 2420, 2418,
+	2415, 789, 2417, 2414, 791, 789, 2414, 787, 2420, 2417, 789, 787, 2417, 2418, 2421, 2419,
+	2421, 2422, 2419, 2420, 2423, 2418, 2423, 2421, 2418, 2421, 2424, 2422, 2424, 2425, 2422, 2423,
+	2426, 2421, 2426, 2424, 2421, 785, 2423, 2420, 787, 785, 2420, 783, 2426, 2423, 785, 783,
+	2423, 2424, 2427, 2425, 2427, 2428, 2425, 2426, 2429, 2424, 2429, 2427, 2424, 2427, 2341, 2428,
+	2341, 2343, 2428, 2429, 2345, 2427, 2345, 2341, 2427, 781, 2429, 2426, 783, 781, 2426, 779,
+	2345, 2429, 781, 779, 2429, 2430, 2431, 2111, 2430, 2111, 2109, 2432, 2433, 2431, 1272, 2434,
+	2432, 2432, 2434, 2433, 1272, 1269, 2434, 2431, 2433, 2114, 2431, 2114, 2111, 1269, 2435, 2434,
+	1269, 1266, 2435, 2434, 2436, 2433, 2434, 2435, 2436, 1266, 2437, 2435, 1266, 1263, 2437, 2435,
+	2438, 2436, 2435, 2437, 2438, 2433, 2436, 2118, 2433, 2118, 2114, 2436, 2438, 2120, 2436, 2120,
+	2118, 2437, 2439, 2438, 1263, 2440, 2437, 2437, 2440, 2439, 1263, 1260, 2440, 2438, 2439, 2123,
+	2438, 2123, 2120, 1260, 2441, 2440, 1260, 1257, 2441, 2440, 2442, 2439, 2440, 2441, 2442, 1257,
+	2443, 2441, 1257, 1254, 2443, 2441, 2444, 2442, 2441, 2443, 2444, 2439, 2442, 2127, 2439, 2127,
+	2123, 2442, 2444, 2129, 2442, 2129, 2127, 2443, 2445, 2444, 1254, 2446, 2443, 2443, 2446, 2445,
+	1254, 1251, 2446, 2444, 2445, 2026, 2444, 2026, 2129, 1251, 2447, 2446, 1251, 1248, 2447, 2446,
+	2448, 2445, 2446, 2447, 2448, 1248, 2449, 2447, 1248, 1245, 2449, 2447, 2450, 2448, 2447, 2449,
+	2450, 2445, 2448, 2028, 2445, 2028, 2026, 2448, 2450, 2030, 2448, 2030, 2028, 2449, 2451, 2450,
+	1245, 2452, 2449, 2449, 2452, 2451, 1245, 1242, 2452, 2450, 2451, 2033, 2450, 2033, 2030, 1242,
+	2453, 2452, 1242, 1239, 2453, 2452, 2454, 2451, 2452, 2453, 2454, 1239, 2455, 2453, 1239, 1236,
+	2455, 2453, 2456, 2454, 2453, 2455, 2456, 2451, 2454, 2037, 2451, 2037, 2033, 2454, 2456, 2039,
+	2454, 2039, 2037, 2455, 2457, 2456, 1236, 2458, 2455, 2455, 2458, 2457, 1236, 1233, 2458, 2456,
+	2457, 2042, 2456, 2042, 2039, 1233, 2459, 2458, 1233, 1230, 2459, 2458, 2460, 2457, 2458, 2459,
+	2460, 1230, 2461, 2459, 1230, 1227, 2461, 2459, 2462, 2460, 2459, 2461, 2462, 2457, 2460, 2046,
+	2457, 2046, 2042, 2460, 2462, 2048, 2460, 2048, 2046, 2461, 2463, 2462, 1227, 2464, 2461, 2461,
+	2464, 2463, 1227, 1224, 2464, 2462, 2463, 2051, 2462, 2051, 2048, 1224, 2465, 2464, 1224, 1221,
+	2465, 2464, 2309, 2463, 2464, 2465, 2309, 1221, 2311, 2465, 1221, 1218, 2311, 2465, 2310, 2309,
+	2465, 2311, 2310, 2463, 2309, 2055, 2463, 2055, 2051, 919, 922, 532, 919, 532, 529, 920,
+	2466, 922, 921, 2467, 920, 920, 2467, 2466, 921, 1323, 2467, 922, 2466, 535, 922, 535,
+	532, 1323, 2468, 2467, 1323, 1320, 2468, 2467, 2469, 2466, 2467, 2468, 2469, 1320, 2470, 2468,
+	1320, 1317, 2470, 2468, 2471, 2469, 2468, 2470, 2471, 2466, 2469, 539, 2466, 539, 535, 2469,
+	2471, 541, 2469, 541, 539, 2470, 2472, 2471, 1317, 2473, 2470, 2470, 2473, 2472, 1317, 1314,
+	2473, 2471, 2472, 544, 2471, 544, 541, 1314, 2474, 2473, 1314, 1311, 2474, 2473, 2475, 2472,
+	2473, 2474, 2475, 1311, 2476, 2474, 1311, 1308, 2476, 2474, 2477, 2475, 2474, 2476, 2477, 2472,
+	2475, 548, 2472, 548, 544, 2475, 2477, 550, 2475, 550, 548, 2476, 2478, 2477, 1308, 2479,
+	2476, 2476, 2479, 2478, 1308, 1305, 2479, 2477, 2478, 553, 2477, 553, 550, 1305, 2480, 2479,
+	1305, 1302, 2480, 2479, 2481, 2478, 2479, 2480, 2481, 1302, 2482, 2480, 1302, 1299, 2482, 2480,
+	2483, 2481, 2480, 2482, 2483, 2478, 2481, 2082, 2478, 2082, 553, 2481, 2483, 2084, 2481, 2084,
+	2082, 2482, 2484, 2483, 1299, 2485, 2482, 2482, 2485, 2484, 1299, 1296, 2485, 2483, 2484, 2087,
+	2483, 2087, 2084, 1296, 2486, 2485, 1296, 1293, 2486, 2485, 2487, 2484, 2485, 2486, 2487, 1293,
+	2488, 2486, 1293, 1290, 2488, 2486, 2489, 2487, 2486, 2488, 2489, 2484, 2487, 2091, 2484, 2091,
+	2087, 2487, 2489, 2093, 2487, 2093, 2091, 2488, 2490, 2489, 1290, 2491, 2488, 2488, 2491, 2490,
+	1290, 1287, 2491, 2489, 2490, 2096, 2489, 2096, 2093, 1287, 2492, 2491, 1287, 1284, 2492, 2491,
+	2493, 2490, 2491, 2492, 2493, 1284, 2494, 2492, 1284, 1281, 2494, 2492, 2495, 2493, 2492, 2494,
+	2495, 2490, 2493, 2100, 2490, 2100, 2096, 2493, 2495, 2102, 2493, 2102, 2100, 2494, 2496, 2495,
+	1281, 2497, 2494, 2494, 2497, 2496, 1281, 1278, 2497, 2495, 2496, 2105, 2495, 2105, 2102, 1278,
+	2498, 2497, 1278, 1275, 2498, 2497, 2430, 2496, 2497, 2498, 2430, 1275, 2432, 2498, 1275, 1272,
+	2432, 2498, 2431, 2430, 2498, 2432, 2431, 2496, 2430, 2109, 2496, 2109, 2105, 2308, 923, 926,
+	2306, 2499, 2307, 2307, 2499, 2308, 2308, 2500, 923, 2499, 2500, 2308, 2500, 935, 923, 2500,
+	939, 935, 2501, 939, 2500, 2499, 2501, 2500, 2501, 949, 939, 2306, 2502, 2499, 2502, 2501,
+	2499, 979, 2502, 2306, 979, 969, 2502, 2503, 949, 2501, 2502, 2503, 2501, 969, 2503, 2502,
+	2503, 950, 949, 969, 962, 2503, 962, 950, 2503, 2504, 2505, 2506, 2504, 2507, 2505, 2508,
+	2507, 2504, 2507, 2509, 2505, 2508, 2510, 2507, 2511, 2510, 2508, 2507, 2512, 2509, 2510, 2512,
+	2507, 2512, 2513, 2509, 2511, 2514, 2510, 2515, 2514, 2511, 2510, 2516, 2512, 2514, 2516, 2510,
+	2512, 2517, 2513, 2516, 2517, 2512, 2517, 2518, 2513, 2515, 1447, 2514, 1446, 1447, 2515, 2517,
+	2519, 2518, 2519, 2520, 2518, 2516, 2521, 2517, 2521, 2519, 2517, 2514, 1450, 2516, 1450, 2521,
+	2516, 1447, 1450, 2514, 2519, 2522, 2520, 2522, 2523, 2520, 2521, 2524, 2519, 2524, 2522, 2519,
+	1450, 1451, 2521, 1451, 2524, 2521, 2522, 2525, 2523, 2525, 2526, 2523, 2524, 2527, 2522, 2527,
+	2525, 2522, 2525, 2528, 2526, 2528, 2529, 2526, 2527, 2530, 2525, 2530, 2528, 2525, 1453, 2527,
+	2524, 1451, 1453, 2524, 1456, 2530, 2527, 1453, 1456, 2527, 2528, 2531, 2529, 2531, 2532, 2529,
+	2530, 2533, 2528, 2533, 2531, 2528, 2531, 2534, 2532, 2534, 2535, 2532, 2533, 2536, 2531, 2536,
+	2534, 2531, 1460, 2533, 2530, 1456, 1460, 2530, 1464, 2536, 2533, 1460, 1464, 2533, 2534, 2537,
+	2535, 2537, 2538, 2535, 2536, 2539, 2534, 2539, 2537, 2534, 2537, 2540, 2538, 2540, 2541, 2538,
+	2539, 2542, 2537, 2542, 2540, 2537, 1466, 2539, 2536, 1464, 1466, 2536, 2389, 2542, 2539, 1466,
+	2389, 2539, 2540, 2543, 2541, 2543, 2544, 2541, 2542, 2545, 2540, 2545, 2543, 2540, 2543, 2546,
+	2544, 2546, 2547, 2544, 2545, 2548, 2543, 2548, 2546, 2543, 2392, 2545, 2542, 2389, 2392, 2542,
+	2395, 2548, 2545, 2392, 2395, 2545, 2546, 2549, 2547, 2549, 2550, 2547, 2548, 2551, 2546, 2551,
+	2549, 2546, 2549, 2552, 2550, 2552, 2553, 2550, 2551, 2554, 2549, 2554, 2552, 2549, 2398, 2551,
+	2548, 2395, 2398, 2548, 2401, 2554, 2551, 2398, 2401, 2551, 2552, 2555, 2553, 2555, 2556, 2553,
+	2554, 2557, 2552, 2557, 2555, 2552, 2555, 2558, 2556, 2558, 2559, 2556, 2557, 2560, 2555, 2560,
+	2558, 2555, 2404, 2557, 2554, 2401, 2404, 2554, 2407, 2560, 2557, 2404, 2407, 2557, 2558, 2561,
+	2559, 2561, 2562, 2559, 2560, 2563, 2558, 2563, 2561, 2558, 2561, 2564, 2562, 2564, 2565, 2562,
+	2563, 2566, 2561, 2566, 2564, 2561, 2410, 2563, 2560, 2407, 2410, 2560, 2413, 2566, 2563, 2410,
+	2413, 2563, 2564, 2567, 2565, 2567, 2568, 2565, 2566, 2569, 2564, 2569, 2567, 2564, 2567, 2570,
+	2568, 2570, 2571, 2568, 2569, 2572, 2567, 2572, 2570, 2567, 2416, 2569, 2566, 2413, 2416, 2566,
+	2419, 2572, 2569, 2416, 2419, 2569, 2570, 2573, 2571, 2573, 2574, 2571, 2572, 2575, 2570, 2575,
+	2573, 2570, 2573, 2576, 2574, 2576, 2577, 2574, 2575, 2578, 2573, 2578, 2576, 2573, 2422, 2575,
+	2572, 2419, 2422, 2572, 2425, 2578, 2575, 2422, 2425, 2575, 2576, 2579, 2577, 2579, 2580, 2577,
+	2578, 2581, 2576, 2581, 2579, 2576, 2579, 2582, 2580, 2582, 2583, 2580, 2581, 2584, 2579, 2584,
+	2582, 2579, 2428, 2581, 2578, 2425, 2428, 2578, 2343, 2584, 2581, 2428, 2343, 2581, 2582, 2585,
+	2583, 2585, 2586, 2583, 2584, 2587, 2582, 2587, 2585, 2582, 2585, 2588, 2586, 2588, 2589, 2586,
+	2587, 2590, 2585, 2590, 2588, 2585, 2344, 2587, 2584, 2343, 2344, 2584, 2348, 2590, 2587, 2344,
+	2348, 2587, 2588, 2591, 2589, 2591, 2592, 2589, 2590, 2593, 2588, 2593, 2591, 2588, 2591, 2594,
+	2592, 2594, 2595, 2592, 2593, 2596, 2591, 2596, 2594, 2591, 2351, 2593, 2590, 2348, 2351, 2590,
+	2354, 2596, 2593, 2351, 2354, 2593, 2594, 2597, 2595, 2597, 2598, 2595, 2596, 2599, 2594, 2599,
+	2597, 2594, 2597, 2600, 2598, 2600, 2601, 2598, 2599, 2602, 2597, 2602, 2600, 2597, 2357, 2599,
+	2596, 2354, 2357, 2596, 2360, 2602, 2599, 2357, 2360, 2599, 2600, 2603, 2601, 2603, 2604, 2601,
+	2602, 2605, 2600, 2605, 2603, 2600, 2603, 2606, 2604, 2606, 2607, 2604, 2605, 2608, 2603, 2608,
+	2606, 2603, 2363, 2605, 2602, 2360, 2363, 2602, 2366, 2608, 2605, 2363, 2366, 2605, 2606, 2609,
+	2607, 2609, 2610, 2607, 2608, 2611, 2606, 2611, 2609, 2606, 2609, 2612, 2610, 2612, 2613, 2610,
+	2611, 2614, 2609, 2614, 2612, 2609, 2369, 2611, 2608, 2366, 2369, 2608, 2372, 2614, 2611, 2369,
+	2372, 2611, 2612, 2615, 2613, 2615, 2616, 2613, 2614, 2617, 2612, 2617, 2615, 2612, 2615, 2618,
+	2616, 2618, 2619, 2616, 2617, 2620, 2615, 2620, 2618, 2615, 2375, 2617, 2614, 2372, 2375, 2614,
+	2378, 2620, 2617, 2375, 2378, 2617, 2618, 2621, 2619, 2621, 2622, 2619, 2620, 2623, 2618, 2623,
+	2621, 2618, 2621, 2624, 2622, 2624, 2625, 2622, 2623, 2626, 2621, 2626, 2624, 2621, 2381, 2623,
+	2620, 2378, 2381, 2620, 2384, 2626, 2623, 2381, 2384, 2623, 2624, 2627, 2625, 2627, 2628, 2625,
+	2626, 2629, 2624, 2629, 2627, 2624, 2627, 2630, 2628, 2630, 2631, 2628, 2629, 2632, 2627, 2632,
+	2630, 2627, 2387, 2629, 2626, 2384, 2387, 2626, 2247, 2632, 2629, 2387, 2247, 2629, 2630, 2633,
+	2631, 2633, 2634, 2631, 2632, 2635, 2630, 2635, 2633, 2630, 2633, 2636, 2634, 2636, 2637, 2634,
+	2635, 2638, 2633, 2638, 2636, 2633, 2248, 2635, 2632, 2247, 2248, 2632, 2251, 2638, 2635, 2248,
+	2251, 2635, 2636, 2639, 2637, 2639, 2640, 2637, 2638, 2641, 2636, 2641, 2639, 2636, 2639, 2642,
+	2640, 2642, 2643, 2640, 2641, 2644, 2639, 2644, 2642, 2639, 2254, 2641, 2638, 2251, 2254, 2638,
+	2257, 2644, 2641, 2254, 2257, 2641, 2642, 2645, 2643, 2645, 2646, 2643, 2644, 2647, 2642, 2647,
+	2645, 2642, 2645, 2648, 2646, 2648, 2649, 2646, 2647, 2650, 2645, 2650, 2648, 2645, 2260, 2647,
+	2644, 2257, 2260, 2644, 2263, 2650, 2647, 2260, 2263, 2647, 2648, 2651, 2649, 2651, 2652, 2649,
+	2650, 2653, 2648, 2653, 2651, 2648, 2651, 2654, 2652, 2654, 2655, 2652, 2653, 2656, 2651, 2656,
+	2654, 2651, 2266, 2653, 2650, 2263, 2266, 2650, 2269, 2656, 2653, 2266, 2269, 2653, 2654, 2657,
+	2655, 2657, 2658, 2655, 2656, 2659, 2654, 2659, 2657, 2654, 2657, 2660, 2658, 2660, 2661, 2658,
+	2659, 2662, 2657, 2662, 2660, 2657, 2272, 2659, 2656, 2269, 2272, 2656, 2275, 2662, 2659, 2272,
+	2275, 2659, 2660, 2663, 2661, 2663, 2664, 2661, 2662, 1952, 2660, 1952, 2663, 2660, 2663, 1954,
+	2664, 1954, 1956, 2664, 1952, 1951, 2663, 1951, 1954, 2663, 1953, 1952, 2662, 2275, 1953, 2662,
+};
+
+#endif // BAKEDMESHES_H
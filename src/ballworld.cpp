@@ -0,0 +1,1128 @@
+#include "ballworld.h"
+#include "impact.h"
+#include "stepkernel.h"
+#include "threadpool.h"
+
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <cstring>
+
+BallWorld::BallWorld()
+	: gravity(-0.0002f * 9.8f), room(defaultRoom()),
+	collideBalls(false), restitution(1.0f), broadphaseType(GridBroadphase),
+	contactSolver(PairwiseContacts), solverIterations(2), warmStart(true),
+	allowSleep(false), sleepSpeed(0.01f), sleepSteps(30), threadPool(0), stats(0)
+{
+}
+
+void
+BallWorld::reserve(int n)
+{
+	x.reserve(n); y.reserve(n); z.reserve(n);
+	vx.reserve(n); vy.reserve(n); vz.reserve(n);
+	radius.reserve(n);
+	restFlag.reserve(n);
+	quietSteps.reserve(n);
+	nextInIsland.reserve(n);
+}
+
+void
+BallWorld::clear()
+{
+	x.clear(); y.clear(); z.clear();
+	vx.clear(); vy.clear(); vz.clear();
+	radius.clear();
+	restFlag.clear();
+	quietSteps.clear();
+	nextInIsland.clear();
+}
+
+int
+BallWorld::addBall(const glm::vec3& position, const glm::vec3& velocity, float r)
+{
+	x.push_back(position.x);
+	y.push_back(position.y);
+	z.push_back(position.z);
+	vx.push_back(velocity.x);
+	vy.push_back(velocity.y);
+	vz.push_back(velocity.z);
+	radius.push_back(r);
+	restFlag.push_back(0);
+	quietSteps.push_back(0);
+	nextInIsland.push_back(size() - 1);
+	return size() - 1;
+}
+
+void
+BallWorld::step()
+{
+	findAwakeRuns();
+	if (stats) {
+		stats->clear();
+		addSleepingStats();
+	}
+	if (awakeRuns.empty()) {
+		return;
+	}
+
+	stepAwake();
+
+	if (collideBalls) {
+		if (threadPool && broadphaseType == GridBroadphase) {
+			collideInParallel(findNearAwake() ? &nearAwake : 0);
+		} else {
+			collide();
+		}
+		if (stats) {
+			stats->contacts = (long long)pairs.size();
+		}
+	}
+	if (allowSleep) {
+		updateSleep();
+	}
+}
+
+// Move every awake ball, cutting the runs of awake balls into blocks that
+// are shared out among the threads when there is a pool
+void
+BallWorld::stepAwake()
+{
+	const int grain = 4096;
+	stepChunks.clear();
+	for (size_t k = 0; k < awakeRuns.size(); k += 2) {
+		for (int b = awakeRuns[k]; b < awakeRuns[k + 1]; b += grain) {
+			stepChunks.push_back(b);
+			stepChunks.push_back(std::min(b + grain, awakeRuns[k + 1]));
+		}
+	}
+
+	const int chunks = int(stepChunks.size() / 2);
+	if (stats) {
+		chunkStats.assign(chunks, StepStats());
+	}
+
+	auto run = [this](int first, int last) {
+		for (int k = first; k < last; k++) {
+			const int b = stepChunks[2 * k];
+			if (stats) {
+				stepBallsMonitored(stepChunks[2 * k + 1] - b, gravity, room,
+					&x[b], &y[b], &z[b],
+					&vx[b], &vy[b], &vz[b],
+					&radius[b], &restFlag[b], chunkStats[k]);
+				continue;
+			}
+			stepBalls(stepChunks[2 * k + 1] - b, gravity, room,
+				&x[b], &y[b], &z[b],
+				&vx[b], &vy[b], &vz[b],
+				&radius[b], &restFlag[b]);
+		}
+	};
+	if (threadPool) {
+		threadPool->parallelFor(0, chunks, 1, run);
+	} else {
+		run(0, chunks);
+	}
+
+	if (stats) {
+		for (int k = 0; k < chunks; k++) {
+			stats->add(chunkStats[k]);
+		}
+	}
+}
+
+// Balls outside the awake runs do not go through the kernel, but still
+// weigh on the ground
+void
+BallWorld::addSleepingStats()
+{
+	const double gAbs = std::abs(gravity);
+	const int n = size();
+	size_t run = 0;
+	for (int i = 0; i < n; i++) {
+		if (run < awakeRuns.size() && i == awakeRuns[run]) {
+			i = awakeRuns[run + 1] - 1;
+			run += 2;
+			continue;
+		}
+		const double m = double(radius[i]) * radius[i] * radius[i];
+		stats->potential += m * gAbs * (y[i] - room.ground);
+		stats->balls++;
+	}
+}
+
+// What the kernel adds to stats for ball i, for a ball that went round it
+// in the last step and touched nothing
+void
+BallWorld::addBallStats(int i)
+{
+	const double m = double(radius[i]) * radius[i] * radius[i];
+	stats->potential += m * std::abs(gravity) * (y[i] - room.ground);
+	if (!restFlag[i]) {
+		const glm::dvec3 v(vx[i], vy[i], vz[i]);
+		stats->kinetic += 0.5 * m * glm::dot(v, v);
+		stats->momentum += m * v;
+	}
+	stats->balls++;
+}
+
+// Find the runs of blocks of balls that have at least one awake ball, so
+// a step can skip sleeping balls and still hand long runs to stepBalls().
+// Sleeping balls inside a run are cheaper to step over than to cut out.
+void
+BallWorld::findAwakeRuns()
+{
+	const int block = 256;
+	awakeRuns.clear();
+	const int n = size();
+	const unsigned char* flags = restFlag.data();
+
+	for (int begin = 0; begin < n; begin += block) {
+		const int end = std::min(begin + block, n);
+		if (!std::memchr(flags + begin, 0, end - begin)) {
+			continue;
+		}
+		if (!awakeRuns.empty() && awakeRuns.back() == begin) {
+			awakeRuns.back() = end;
+		} else {
+			awakeRuns.push_back(begin);
+			awakeRuns.push_back(end);
+		}
+	}
+}
+
+int
+BallWorld::awakeCount() const
+{
+	return int(std::count(restFlag.begin(), restFlag.end(), 0));
+}
+
+bool
+BallWorld::moving(int i) const
+{
+	return vx[i] * vx[i] + vy[i] * vy[i] + vz[i] * vz[i] >= sleepSpeed * sleepSpeed;
+}
+
+static int
+findIsland(std::vector<int>& parent, int i)
+{
+	while (parent[i] != i) {
+		parent[i] = parent[parent[i]];
+		i = parent[i];
+	}
+	return i;
+}
+
+// Count how long every awake ball has been slow, join the balls touching
+// in this step into islands, and put the islands that are all slow to sleep
+void
+BallWorld::updateSleep()
+{
+	findAwakeRuns();
+	islandParent.resize(size());
+	islandQuiet.resize(size());
+
+	for (size_t k = 0; k < awakeRuns.size(); k += 2) {
+		for (int i = awakeRuns[k]; i < awakeRuns[k + 1]; i++) {
+			if (restFlag[i]) {
+				continue;
+			}
+			quietSteps[i] = moving(i) ? 0 : quietSteps[i] + 1;
+			islandParent[i] = i;
+			islandQuiet[i] = INT_MAX;
+		}
+	}
+
+	// contacts with sleeping balls do not join islands, those act like the ground
+	const int count = int(pairs.size());
+	for (int k = 0; k < count; k++) {
+		const int a = pairs[k].a, b = pairs[k].b;
+		if (!restFlag[a] && !restFlag[b]) {
+			islandParent[findIsland(islandParent, a)] = findIsland(islandParent, b);
+		}
+	}
+
+	for (size_t k = 0; k < awakeRuns.size(); k += 2) {
+		for (int i = awakeRuns[k]; i < awakeRuns[k + 1]; i++) {
+			if (restFlag[i]) {
+				continue;
+			}
+			int root = findIsland(islandParent, i);
+			islandQuiet[root] = std::min(islandQuiet[root], quietSteps[i]);
+		}
+	}
+
+	// Link every sleeping island into a ring through its root
+	for (size_t k = 0; k < awakeRuns.size(); k += 2) {
+		for (int i = awakeRuns[k]; i < awakeRuns[k + 1]; i++) {
+			if (restFlag[i]) {
+				continue;
+			}
+			const int root = findIsland(islandParent, i);
+			if (islandQuiet[root] < sleepSteps) {
+				continue;
+			}
+			if (i != root) {
+				nextInIsland[i] = nextInIsland[root];
+				nextInIsland[root] = i;
+			}
+			restFlag[i] = 1;
+			vx[i] = 0; vy[i] = 0; vz[i] = 0;
+		}
+	}
+}
+
+void
+BallWorld::wake(int i)
+{
+	if (!restFlag[i]) {
+		return;
+	}
+	int j = i;
+	do {
+		const int next = nextInIsland[j];
+		restFlag[j] = 0;
+		quietSteps[j] = 0;
+		nextInIsland[j] = j;
+		j = next;
+	} while (j != i);
+}
+
+void
+BallWorld::applyImpulse(int i, const glm::vec3& dv)
+{
+	wake(i);
+	vx[i] += dv.x;
+	vy[i] += dv.y;
+	vz[i] += dv.z;
+}
+
+// Keep a jumping ball this far from anything it could hit, so the float
+// rounding of stepping one step at a time could not have made it touch
+const float JUMP_MARGIN = 1e-3f;
+
+// A ball whose jump could reach more grid cells than this takes the steps,
+// keeping the others out of them would cost more than it saves
+const int JUMP_CELLS = 64;
+
+// How stepAdaptive() moves each ball
+enum
+{
+	SteppedBall = 0, // one step at a time with stepBalls()
+	JumpingBall = 1, // all the steps at once
+	RestingBall = 2  // not at all
+};
+
+// Find the balls that cannot reach the room in the next steps: n steps of
+// step() away from the room take a ball to
+//   x + n vx, y + n vy + g n (n + 1) / 2, z + n vz
+// and its vertical speed to vy + n g. Between the steps the height is a
+// parabola in the step number, so it is lowest and highest at the ends or
+// at the vertex, and x and z are straight lines. move is set to JumpingBall
+// for them, RestingBall for the balls at rest and SteppedBall for the rest.
+static void
+findClearBalls(int count, int steps, float g, const Room& room,
+	const float* __restrict px, const float* __restrict py, const float* __restrict pz,
+	const float* __restrict pvx, const float* __restrict pvy, const float* __restrict pvz,
+	const float* __restrict pr, const unsigned char* __restrict rest, unsigned char* __restrict move)
+{
+	const float n = float(steps);
+	const float fall = g * n * (n + 1.0f) * 0.5f;
+	const float half = 0.5f * g;
+	const float toVertex = half != 0.0f ? -0.5f / half : 0.0f;
+	const float loX = room.walls[leftWall] + JUMP_MARGIN, hiX = room.walls[rightWall] - JUMP_MARGIN;
+	const float loZ = room.walls[farWall] + JUMP_MARGIN, hiZ = room.walls[nearWall] - JUMP_MARGIN;
+	const float loY = room.ground + JUMP_MARGIN, hiY = room.ceiling - JUMP_MARGIN;
+
+	for (int i = 0; i < count; i++) {
+		const float r = pr[i];
+		const float x0 = px[i], y0 = py[i], z0 = pz[i];
+		const float xn = x0 + pvx[i] * n;
+		const float zn = z0 + pvz[i] * n;
+		const float yn = y0 + (pvy[i] * n + fall);
+		const float a = pvy[i] + half;
+		const float k = std::min(std::max(a * toVertex, 0.0f), n);
+		const float yv = y0 + (a + half * k) * k;
+		const float lowY = std::min(std::min(y0, yn), yv), highY = std::max(std::max(y0, yn), yv);
+
+		// Multiplying by 0 or 1 rather than picking keeps the loop vectorized
+		float jump = rest[i] ? 0.0f : 1.0f;
+		jump = std::min(x0, xn) > loX + r ? jump : 0.0f;
+		jump = std::max(x0, xn) < hiX - r ? jump : 0.0f;
+		jump = std::min(z0, zn) > loZ + r ? jump : 0.0f;
+		jump = std::max(z0, zn) < hiZ - r ? jump : 0.0f;
+		jump = lowY > loY + r ? jump : 0.0f;
+		jump = highY < hiY - r ? jump : 0.0f;
+		move[i] = (unsigned char)((rest[i] ? RestingBall : SteppedBall) | (jump > 0.5f ? JumpingBall : SteppedBall));
+	}
+}
+
+// Take the balls findClearBalls() found over all the steps at once
+static void
+jumpBalls(int count, int steps, float g,
+	float* __restrict px, float* __restrict py, float* __restrict pz,
+	const float* __restrict pvx, float* __restrict pvy, const float* __restrict pvz,
+	const unsigned char* __restrict move)
+{
+	const float n = float(steps);
+	const float fall = g * n * (n + 1.0f) * 0.5f;
+
+	for (int i = 0; i < count; i++) {
+		const float jump = move[i] == JumpingBall ? 1.0f : 0.0f;
+		px[i] += pvx[i] * n * jump;
+		py[i] += (pvy[i] * n + fall) * jump;
+		pz[i] += pvz[i] * n * jump;
+		pvy[i] += g * n * jump;
+	}
+}
+
+// Call f with every cell from first to last along each axis
+template <class F>
+static void
+forEachCell(const UniformGrid& grid, const int first[3], const int last[3], F f)
+{
+	for (int z = first[2]; z <= last[2]; z++) {
+		for (int y = first[1]; y <= last[1]; y++) {
+			for (int x = first[0]; x <= last[0]; x++) {
+				f(grid.cellAt(x, y, z));
+			}
+		}
+	}
+}
+
+static bool
+boxesOverlap(const float* aLo, const float* aHi, const float* bLo, const float* bHi)
+{
+	return aLo[0] <= bHi[0] && bLo[0] <= aHi[0] && aLo[1] <= bHi[1] && bLo[1] <= aHi[1]
+		&& aLo[2] <= bHi[2] && bLo[2] <= aHi[2];
+}
+
+// The box of the positions ball i passes through when it jumps the steps,
+// or of where it is when it rests, grown by its radius and JUMP_MARGIN:
+// two balls whose boxes stay apart cannot touch
+void
+BallWorld::reachBox(int i, int steps, float lo[3], float hi[3]) const
+{
+	const float n = jumped[i] == JumpingBall ? float(steps) : 0.0f;
+	const float half = 0.5f * gravity;
+	const float toVertex = half != 0.0f ? -0.5f / half : 0.0f;
+	const float xn = x[i] + vx[i] * n;
+	const float zn = z[i] + vz[i] * n;
+	const float yn = y[i] + (vy[i] * n + gravity * n * (n + 1.0f) * 0.5f);
+	const float a = vy[i] + half;
+	const float k = std::min(std::max(a * toVertex, 0.0f), n);
+	const float yv = y[i] + (a + half * k) * k;
+
+	const float reach = radius[i] + JUMP_MARGIN;
+	lo[0] = std::min(x[i], xn) - reach;
+	lo[1] = std::min(std::min(y[i], yn), yv) - reach;
+	lo[2] = std::min(z[i], zn) - reach;
+	hi[0] = std::max(x[i], xn) + reach;
+	hi[1] = std::max(std::max(y[i], yn), yv) + reach;
+	hi[2] = std::max(z[i], zn) + reach;
+}
+
+// With collideBalls, leave jumping or resting only the balls with no other
+// ball, or the reach of another of them, in their reach, and list them by
+// the cells of their reach
+void
+BallWorld::keepJumpsApart(int steps)
+{
+	if (threadPool) {
+		grid.build(*this, *threadPool);
+	} else {
+		grid.build(*this);
+	}
+	const int count = size();
+
+	// The boxes are worked out in the order of the balls, then taken in the
+	// order of the cells, so the balls looked at together are close in memory
+	ballBoxes.resize(6 * count);
+	for (int i = 0; i < count; i++) {
+		if (jumped[i] != SteppedBall) {
+			reachBox(i, steps, &ballBoxes[6 * i], &ballBoxes[6 * i + 3]);
+		}
+	}
+	const int cells = grid.cellCount();
+	farBalls.clear();
+	farBoxes.resize(6 * count);
+	farCellStart.assign(cells + 1, 0);
+	int first[3], last[3];
+	for (int c = 0; c < cells; c++) {
+		for (int b = 0; b < grid.ballsInCell(c); b++) {
+			const int i = grid.ballInCell(c, b);
+			if (jumped[i] == SteppedBall) {
+				continue;
+			}
+			const float* box = &ballBoxes[6 * i];
+			grid.cellsOfBox(box, box + 3, first, last);
+			if ((last[0] - first[0] + 1) * (last[1] - first[1] + 1) * (last[2] - first[2] + 1) > JUMP_CELLS) {
+				jumped[i] = SteppedBall;
+				continue;
+			}
+			// counted into the end of every cell, then filled from the end back
+			forEachCell(grid, first, last, [&](int cell) { farCellStart[cell]++; });
+			std::copy(box, box + 6, &farBoxes[6 * farBalls.size()]);
+			farBalls.push_back(i);
+		}
+	}
+
+	const int far = int(farBalls.size());
+	for (int c = 1; c < cells; c++) {
+		farCellStart[c] += farCellStart[c - 1];
+	}
+	farCellStart[cells] = farCellStart[cells - 1];
+	farCellBalls.resize(farCellStart[cells]);
+	for (int k = 0; k < far; k++) {
+		grid.cellsOfBox(&farBoxes[6 * k], &farBoxes[6 * k + 3], first, last);
+		forEachCell(grid, first, last, [&](int c) { farCellBalls[--farCellStart[c]] = k; });
+	}
+
+	// Whichever stays has no other reach box in its own. The stepped balls
+	// are looked for after every step, by bringInReached
+	for (int k = 0; k < far; k++) {
+		const int i = farBalls[k];
+		const float* lo = &farBoxes[6 * k];
+		const float* hi = lo + 3;
+		grid.cellsOfBox(lo, hi, first, last);
+		bool alone = true;
+		forEachCell(grid, first, last, [&](int c) {
+			for (int e = farCellStart[c]; e < farCellStart[c + 1] && alone; e++) {
+				const int other = farCellBalls[e];
+				alone = other == k || !boxesOverlap(lo, hi, &farBoxes[6 * other], &farBoxes[6 * other + 3]);
+			}
+		});
+		if (!alone) {
+			jumped[i] = SteppedBall;
+		}
+	}
+}
+
+// After step s, bring the jumping and resting balls that a stepped ball
+// came in reach of in with the stepped ones, where their jump has taken them
+void
+BallWorld::bringInReached(int s, int steps)
+{
+	const int stepped = int(nearBalls.size());
+	const float n = float(s);
+	int first[3], last[3];
+	for (int k = 0; k < stepped; k++) {
+		const int i = nearBalls[k];
+		const float lo[3] = { x[i] - radius[i], y[i] - radius[i], z[i] - radius[i] };
+		const float hi[3] = { x[i] + radius[i], y[i] + radius[i], z[i] + radius[i] };
+		grid.cellsOfBox(lo, hi, first, last);
+		forEachCell(grid, first, last, [&](int c) {
+			for (int e = farCellStart[c]; e < farCellStart[c + 1]; e++) {
+				const int f = farCellBalls[e];
+				const int j = farBalls[f];
+				if (jumped[j] == SteppedBall || !boxesOverlap(&farBoxes[6 * f], &farBoxes[6 * f + 3], lo, hi)) {
+					continue;
+				}
+				if (jumped[j] == JumpingBall) {
+					x[j] += vx[j] * n;
+					y[j] += vy[j] * n + gravity * n * (n + 1.0f) * 0.5f;
+					z[j] += vz[j] * n;
+					vy[j] += gravity * n;
+				}
+				jumped[j] = SteppedBall;
+				nearBalls.push_back(j);
+				if (stats && s == steps) {
+					addBallStats(j); // it did not go through the kernel in the last step
+				}
+			}
+		});
+	}
+}
+
+// Copy the stepped balls from the world into the arrays stepNear() works
+// on, or back
+void
+BallWorld::copyNear(bool fromWorld)
+{
+	const int m = int(nearBalls.size());
+	if (fromWorld) {
+		nearX.resize(m); nearY.resize(m); nearZ.resize(m);
+		nearVX.resize(m); nearVY.resize(m); nearVZ.resize(m);
+		nearRadius.resize(m);
+		nearRest.resize(m);
+	}
+
+	auto run = [&](int begin, int end) {
+		for (int k = begin; k < end; k++) {
+			const int i = nearBalls[k];
+			if (fromWorld) {
+				nearX[k] = x[i]; nearY[k] = y[i]; nearZ[k] = z[i];
+				nearVX[k] = vx[i]; nearVY[k] = vy[i]; nearVZ[k] = vz[i];
+				nearRadius[k] = radius[i];
+				nearRest[k] = restFlag[i];
+			} else {
+				x[i] = nearX[k]; y[i] = nearY[k]; z[i] = nearZ[k];
+				vx[i] = nearVX[k]; vy[i] = nearVY[k]; vz[i] = nearVZ[k];
+				restFlag[i] = nearRest[k];
+			}
+		}
+	};
+	if (threadPool) {
+		threadPool->parallelFor(0, m, 16384, run);
+	} else {
+		run(0, m);
+	}
+}
+
+// One step of the stepped balls, in blocks shared out among the threads
+// when there is a pool as in stepAwake(). With monitor they are added to
+// stats.
+void
+BallWorld::stepNear(bool monitor)
+{
+	const int grain = 4096;
+	const int m = int(nearBalls.size());
+	const int chunks = (m + grain - 1) / grain;
+	if (monitor) {
+		chunkStats.assign(chunks, StepStats());
+	}
+
+	auto run = [&](int first, int last) {
+		for (int k = first; k < last; k++) {
+			const int b = k * grain;
+			const int n = std::min(b + grain, m) - b;
+			if (monitor) {
+				stepBallsMonitored(n, gravity, room, &nearX[b], &nearY[b], &nearZ[b],
+					&nearVX[b], &nearVY[b], &nearVZ[b], &nearRadius[b], &nearRest[b], chunkStats[k]);
+				continue;
+			}
+			stepBalls(n, gravity, room, &nearX[b], &nearY[b], &nearZ[b],
+				&nearVX[b], &nearVY[b], &nearVZ[b], &nearRadius[b], &nearRest[b]);
+		}
+	};
+	if (threadPool) {
+		threadPool->parallelFor(0, chunks, 1, run);
+	} else {
+		run(0, chunks);
+	}
+
+	if (monitor) {
+		for (int k = 0; k < chunks; k++) {
+			stats->add(chunkStats[k]);
+		}
+	}
+}
+
+int
+BallWorld::stepAdaptive(int steps)
+{
+	if (allowSleep || steps <= 1) {
+		for (int s = 0; s < steps; s++) {
+			step();
+		}
+		return 0;
+	}
+	if (stats) {
+		stats->clear();
+	}
+
+	const int count = size();
+	jumped.resize(count);
+	findClearBalls(count, steps, gravity, room, x.data(), y.data(), z.data(),
+		vx.data(), vy.data(), vz.data(), radius.data(), restFlag.data(), jumped.data());
+	if (collideBalls) {
+		keepJumpsApart(steps);
+		if (2 * std::count(jumped.begin(), jumped.end(), (unsigned char)SteppedBall) > count) {
+			for (int s = 0; s < steps; s++) {
+				step(); // most balls are close to another, gathering them would only cost more
+			}
+			return 0;
+		}
+	}
+
+	// The others take every step, gathered so stepBalls() gets them in one piece
+	nearBalls.clear();
+	const unsigned char* move = jumped.data();
+	for (const unsigned char* p = move; (p = static_cast<const unsigned char*>(std::memchr(p, SteppedBall, move + count - p))) != 0; p++) {
+		nearBalls.push_back(int(p - move));
+	}
+	copyNear(true);
+	for (int s = 1; s <= steps; s++) {
+		stepNear(stats && s == steps);
+		if (!collideBalls) {
+			continue;
+		}
+		// they collide in the world, only among themselves
+		copyNear(false);
+		bringInReached(s, steps);
+		if (threadPool && broadphaseType == GridBroadphase) {
+			collideInParallel(&nearBalls);
+		} else {
+			collideListed(&nearBalls);
+		}
+		if (s < steps) {
+			copyNear(true);
+		}
+	}
+	if (!collideBalls) {
+		copyNear(false);
+	}
+
+	jumpBalls(count, steps, gravity, x.data(), y.data(), z.data(),
+		vx.data(), vy.data(), vz.data(), jumped.data());
+	if (stats) {
+		for (int i = 0; i < count; i++) {
+			if (jumped[i] != SteppedBall) {
+				addBallStats(i);
+			}
+		}
+		if (collideBalls) {
+			stats->contacts = (long long)pairs.size();
+		}
+	}
+	return int(std::count(jumped.begin(), jumped.end(), (unsigned char)JumpingBall));
+}
+
+// Bounces after which the rest of a continuous step is dropped,
+// only reached by a ball trapped in a gap about as wide as itself
+const int MAX_BOUNCES = 16;
+
+void
+BallWorld::stepContinuous(float dt)
+{
+	const int n = size();
+	const float g = gravity;
+	const float gAbs = std::abs(g);
+
+	for (int i = 0; i < n; i++) {
+		if (restFlag[i]) {
+			continue;
+		}
+
+		const float r = radius[i];
+		const float loX = room.walls[leftWall] + r, hiX = room.walls[rightWall] - r;
+		const float loY = room.ground + r, hiY = room.ceiling - r;
+		const float loZ = room.walls[farWall] + r, hiZ = room.walls[nearWall] - r;
+
+		// Contacts may have pushed the ball a little out of the room
+		float px = std::min(std::max(x[i], loX), hiX);
+		float py = std::min(std::max(y[i], loY), hiY);
+		float pz = std::min(std::max(z[i], loZ), hiZ);
+		float pvx = vx[i], pvy = vy[i], pvz = vz[i];
+
+		float remaining = dt;
+		for (int bounce = 0; bounce <= MAX_BOUNCES && remaining > 0.0f; bounce++) {
+			// earliest plane in the way
+			float t = remaining;
+			int plane = hitNothing;
+
+			float tHit = timeToFall(py - loY, pvy, g, t);
+			if (tHit >= 0.0f) {
+				t = tHit; plane = hitGroundPlane;
+			}
+			tHit = timeToRise(hiY - py, pvy, g, t);
+			if (tHit >= 0.0f && tHit < t) {
+				t = tHit; plane = hitCeilingPlane;
+			}
+			tHit = timeToWall(px, pvx, loX, hiX, t);
+			if (tHit >= 0.0f && tHit < t) {
+				t = tHit; plane = hitXPlane;
+			}
+			tHit = timeToWall(pz, pvz, loZ, hiZ, t);
+			if (tHit >= 0.0f && tHit < t) {
+				t = tHit; plane = hitZPlane;
+			}
+			if (bounce == MAX_BOUNCES) {
+				plane = hitNothing; // out of bounces, the ball just stops short
+			}
+
+			// follow the arc up to there
+			px += pvx * t;
+			py += (pvy + 0.5f * g * t) * t;
+			pz += pvz * t;
+			pvy += g * t;
+			remaining -= t;
+
+			// and bounce, landing exactly on the plane
+			if (plane == hitGroundPlane) {
+				py = loY;
+				pvy = -pvy;
+				if (std::abs(pvy) <= gAbs) {
+					restFlag[i] = 1;
+					pvx = 0; pvy = g; pvz = 0; // as left by step()
+					break;
+				}
+			}
+			else if (plane == hitCeilingPlane) {
+				py = hiY;
+				pvy = -pvy;
+			}
+			else if (plane == hitXPlane) {
+				px = pvx > 0.0f ? hiX : loX;
+				pvx = -pvx;
+			}
+			else if (plane == hitZPlane) {
+				pz = pvz > 0.0f ? hiZ : loZ;
+				pvz = -pvz;
+			}
+			else {
+				break;
+			}
+		}
+
+		x[i] = px; y[i] = py; z[i] = pz;
+		vx[i] = pvx; vy[i] = pvy; vz[i] = pvz;
+	}
+
+	if (collideBalls) {
+		collide();
+	}
+	if (allowSleep) {
+		updateSleep();
+	}
+}
+
+void
+BallWorld::collide()
+{
+	collideListed(findNearAwake() ? &nearAwake : 0);
+}
+
+// collide() among the listed balls, or all of them when balls is null
+void
+BallWorld::collideListed(const std::vector<int>* balls)
+{
+	Broadphase& bp = broadphase();
+	if (balls) {
+		bp.build(*this, *balls);
+	} else {
+		bp.build(*this);
+	}
+	bp.findPairs(pairs);
+	if (contactSolver == SequentialImpulses) {
+		solveContacts(pairs);
+	} else {
+		resolveContacts(pairs);
+	}
+}
+
+// With most balls asleep, fill nearAwake with the balls the broadphase
+// should take in. Otherwise that costs more than it saves.
+bool
+BallWorld::findNearAwake()
+{
+	if (2 * awakeCount() >= size()) {
+		return false;
+	}
+	grid.findNearAwake(*this, nearAwake);
+	return true;
+}
+
+// collideListed() on the threads of threadPool with the grid
+void
+BallWorld::collideInParallel(const std::vector<int>* balls)
+{
+	ThreadPool& pool = *threadPool;
+	if (balls) {
+		grid.build(*this, *balls);
+	} else {
+		grid.build(*this, pool);
+	}
+
+	// Blocks of rows find their pairs on their own, joined in row order
+	// they are the same pairs in the same order as grid.findPairs()
+	const int rows = grid.rowCount();
+	const int blocks = std::min(rows, 8 * pool.threadCount());
+	rowPairs.resize(blocks);
+	pool.parallelFor(0, blocks, 1, [&](int first, int last) {
+		for (int k = first; k < last; k++) {
+			rowPairs[k].clear();
+			grid.findPairsInRows(int(static_cast<long long>(rows) * k / blocks),
+				int(static_cast<long long>(rows) * (k + 1) / blocks), rowPairs[k]);
+		}
+	});
+	pairs.clear();
+	for (int k = 0; k < blocks; k++) {
+		pairs.insert(pairs.end(), rowPairs[k].begin(), rowPairs[k].end());
+	}
+	if (contactSolver == SequentialImpulses) {
+		solveContacts(pairs);
+		return;
+	}
+
+	// The pairs come grouped by the lower cell of the two balls, sort the
+	// groups by the colour of that cell
+	for (int c = 0; c < UniformGrid::colourCount; c++) {
+		colourSpans[c].clear();
+	}
+	const int count = int(pairs.size());
+	for (int begin = 0; begin < count; ) {
+		const int cell = std::min(grid.cellOfBall(pairs[begin].a), grid.cellOfBall(pairs[begin].b));
+		int end = begin + 1;
+		while (end < count && std::min(grid.cellOfBall(pairs[end].a), grid.cellOfBall(pairs[end].b)) == cell) {
+			end++;
+		}
+		std::vector<int>& spans = colourSpans[grid.colourOf(cell)];
+		spans.push_back(begin);
+		spans.push_back(end);
+		begin = end;
+	}
+
+	// Waking walks whole islands, which may be anywhere, so do it first
+	for (int k = 0; k < count; k++) {
+		const int a = pairs[k].a, b = pairs[k].b;
+		if (restFlag[a] != restFlag[b]) {
+			const int sleeper = restFlag[a] ? a : b;
+			if (!allowSleep || moving(sleeper == a ? b : a)) {
+				wake(sleeper);
+			}
+		}
+	}
+
+	for (int c = 0; c < UniformGrid::colourCount; c++) {
+		const std::vector<int>& spans = colourSpans[c];
+		pool.parallelFor(0, int(spans.size() / 2), 64, [&](int first, int last) {
+			for (int k = first; k < last; k++) {
+				for (int p = spans[2 * k]; p < spans[2 * k + 1]; p++) {
+					resolveContact(pairs[p].a, pairs[p].b, false);
+				}
+			}
+		});
+	}
+}
+
+Broadphase&
+BallWorld::broadphase()
+{
+	if (broadphaseType == SweepAndPruneBroadphase) {
+		return sweepAndPrune;
+	}
+	return grid;
+}
+
+void
+BallWorld::resolveContacts(const std::vector<BallPair>& contacts)
+{
+	const int count = int(contacts.size());
+	for (int k = 0; k < count; k++) {
+		resolveContact(contacts[k].a, contacts[k].b, true);
+	}
+}
+
+// Only reads and writes balls a and b, unless it may wake an island
+void
+BallWorld::resolveContact(int a, int b, bool canWake)
+{
+	// a settled pile costs nothing, a fast ball wakes what it hits,
+	// a slow one just lands on it as if it were the ground
+	bool asleepA = restFlag[a] != 0, asleepB = restFlag[b] != 0;
+	if (asleepA && asleepB) {
+		return;
+	}
+
+	glm::vec3 d = position(b) - position(a);
+	float dist2 = glm::dot(d, d);
+	float reach = radius[a] + radius[b];
+	if (dist2 >= reach * reach || dist2 == 0.0f) {
+		return; // moved apart by an earlier contact, or no direction to push
+	}
+	float dist = std::sqrt(dist2);
+	glm::vec3 n = d / dist;
+
+	if (canWake && asleepA && (!allowSleep || moving(b))) {
+		wake(a);
+		asleepA = false;
+	}
+	if (canWake && asleepB && (!allowSleep || moving(a))) {
+		wake(b);
+		asleepB = false;
+	}
+
+	// mass grows with volume, a sleeping ball cannot be moved
+	float wa = asleepA ? 0.0f : 1.0f / (radius[a] * radius[a] * radius[a]);
+	float wb = asleepB ? 0.0f : 1.0f / (radius[b] * radius[b] * radius[b]);
+	float w = wa + wb;
+
+	// separate
+	glm::vec3 push = n * ((reach - dist) / w);
+	x[a] -= push.x * wa; y[a] -= push.y * wa; z[a] -= push.z * wa;
+	x[b] += push.x * wb; y[b] += push.y * wb; z[b] += push.z * wb;
+
+	// bounce, only if still moving towards each other
+	float approach = glm::dot(velocity(b) - velocity(a), n);
+	if (approach < 0.0f) {
+		glm::vec3 j = n * (-(1.0f + restitution) * approach / w);
+		vx[a] -= j.x * wa; vy[a] -= j.y * wa; vz[a] -= j.z * wa;
+		vx[b] += j.x * wb; vy[b] += j.y * wb; vz[b] += j.z * wb;
+	}
+}
+
+// Overlap left in place by solveContacts(), so a pile resting on itself
+// keeps the same contacts from step to step, and the part of the rest
+// that is pushed out per step
+const float CONTACT_SLOP = 1e-4f;
+const float CONTACT_PUSH = 0.8f;
+
+// A sleeping ball touched by a moving one wakes up, as in resolveContact()
+void
+BallWorld::wakeTouching(int a, int b)
+{
+	if (restFlag[a] && !restFlag[b] && (!allowSleep || moving(b))) {
+		wake(a);
+	}
+	else if (restFlag[b] && !restFlag[a] && (!allowSleep || moving(a))) {
+		wake(b);
+	}
+}
+
+// Where ball i goes in the next step: its velocity plus the gravity the
+// step adds to the position, nothing for a ball at rest
+glm::vec3
+BallWorld::displacement(int i) const
+{
+	return restFlag[i] ? glm::vec3(0.0f) : velocity(i) + glm::vec3(0.0f, gravity, 0.0f);
+}
+
+static unsigned long long
+contactKey(int a, int b)
+{
+	return (static_cast<unsigned long long>(a) << 32) | static_cast<unsigned>(b);
+}
+
+void
+BallWorld::getCachedImpulses(unsigned long long* keys, float* impulses) const
+{
+	for (size_t k = 0; k < impulseCache.size(); k++) {
+		keys[k] = impulseCache[k].key;
+		impulses[k] = impulseCache[k].impulse;
+	}
+}
+
+void
+BallWorld::setCachedImpulses(int count, const unsigned long long* keys, const float* impulses)
+{
+	impulseCache.resize(count);
+	for (int k = 0; k < count; k++) {
+		impulseCache[k].key = keys[k];
+		impulseCache[k].impulse = impulses[k];
+	}
+}
+
+void
+BallWorld::solveContacts(const std::vector<BallPair>& contacts)
+{
+	// approaching slower than this a contact does not bounce, so a pile
+	// does not hop on the gravity of one step
+	const float restingSpeed = 2.0f * std::abs(gravity);
+	const int count = int(contacts.size());
+	solverContacts.clear();
+	onGround.assign(size(), 0);
+
+	auto addGround = [&](int i) {
+		const float gap = y[i] - radius[i] - room.ground;
+		const float fall = displacement(i).y;
+		if (restFlag[i] || onGround[i] || gap + fall > 0.0f) {
+			return;
+		}
+		onGround[i] = 1;
+		SolverContact c = { i, -1, glm::vec3(0.0f, -1.0f, 0.0f),
+			1.0f / (radius[i] * radius[i] * radius[i]), 0.0f, -std::max(gap, 0.0f), 0.0f };
+		solverContacts.push_back(c);
+	};
+
+	// Waking walks whole islands, so do it before any ball is taken as
+	// awake or asleep
+	for (int k = 0; k < count; k++) {
+		wakeTouching(contacts[k].a, contacts[k].b);
+	}
+
+	for (int k = 0; k < count; k++) {
+		const int a = contacts[k].a, b = contacts[k].b;
+		if (restFlag[a] && restFlag[b]) {
+			continue;
+		}
+		glm::vec3 d = position(b) - position(a);
+		float dist2 = glm::dot(d, d);
+		float reach = radius[a] + radius[b];
+		if (dist2 >= reach * reach || dist2 == 0.0f) {
+			continue;
+		}
+
+		SolverContact c;
+		c.a = a;
+		c.b = b;
+		c.n = d / std::sqrt(dist2);
+		c.wa = restFlag[a] ? 0.0f : 1.0f / (radius[a] * radius[a] * radius[a]);
+		c.wb = restFlag[b] ? 0.0f : 1.0f / (radius[b] * radius[b] * radius[b]);
+		const float approach = glm::dot(displacement(b) - displacement(a), c.n);
+		c.target = approach < -restingSpeed ? -restitution * approach : 0.0f;
+		c.impulse = 0.0f;
+		solverContacts.push_back(c);
+
+		addGround(a);
+		addGround(b);
+	}
+
+	auto apply = [&](const SolverContact& c, float impulse) {
+		const glm::vec3 p = c.n * impulse;
+		vx[c.a] -= p.x * c.wa; vy[c.a] -= p.y * c.wa; vz[c.a] -= p.z * c.wa;
+		if (c.b >= 0) {
+			vx[c.b] += p.x * c.wb; vy[c.b] += p.y * c.wb; vz[c.b] += p.z * c.wb;
+		}
+	};
+
+	// start from the impulses of the last step
+	const int contactCount = int(solverContacts.size());
+	if (warmStart && !impulseCache.empty()) {
+		for (int k = 0; k < contactCount; k++) {
+			SolverContact& c = solverContacts[k];
+			CachedImpulse key = { contactKey(c.a, c.b), 0.0f };
+			std::vector<CachedImpulse>::const_iterator it = std::lower_bound(impulseCache.begin(), impulseCache.end(),
+				key, [](const CachedImpulse& l, const CachedImpulse& r) { return l.key < r.key; });
+			if (it != impulseCache.end() && it->key == key.key) {
+				c.impulse = it->impulse;
+				apply(c, c.impulse);
+			}
+		}
+	}
+
+	// projected Gauss-Seidel: bring every contact to its target speed
+	// with the others as they are, never pulling the balls together
+	for (int iteration = 0; iteration < solverIterations; iteration++) {
+		for (int k = 0; k < contactCount; k++) {
+			SolverContact& c = solverContacts[k];
+			const glm::vec3 ub = c.b >= 0 ? displacement(c.b) : glm::vec3(0.0f);
+			const float speed = glm::dot(ub - displacement(c.a), c.n);
+			const float impulse = std::max(c.impulse + (c.target - speed) / (c.wa + c.wb), 0.0f);
+			apply(c, impulse - c.impulse);
+			c.impulse = impulse;
+		}
+	}
+
+	nextImpulseCache.clear();
+	for (int k = 0; k < contactCount; k++) {
+		const SolverContact& c = solverContacts[k];
+		if (c.impulse > 0.0f) {
+			CachedImpulse cached = { contactKey(c.a, c.b), c.impulse };
+			nextImpulseCache.push_back(cached);
+		}
+	}
+	std::sort(nextImpulseCache.begin(), nextImpulseCache.end(),
+		[](const CachedImpulse& l, const CachedImpulse& r) { return l.key < r.key; });
+	impulseCache.swap(nextImpulseCache);
+
+	// Then push the balls apart, which does not change their speed. A ball
+	// on the ground is not pushed, as it would only be pushed into it.
+	for (int k = 0; k < contactCount; k++) {
+		const SolverContact& c = solverContacts[k];
+		if (c.b < 0) {
+			continue;
+		}
+		const float wa = onGround[c.a] && !onGround[c.b] ? 0.0f : c.wa;
+		const float wb = onGround[c.b] && !onGround[c.a] ? 0.0f : c.wb;
+		glm::vec3 d = position(c.b) - position(c.a);
+		float dist = std::sqrt(glm::dot(d, d));
+		float depth = radius[c.a] + radius[c.b] - dist - CONTACT_SLOP;
+		if (depth <= 0.0f || dist == 0.0f || wa + wb == 0.0f) {
+			continue;
+		}
+		glm::vec3 push = d * (CONTACT_PUSH * depth / (dist * (wa + wb)));
+		x[c.a] -= push.x * wa; y[c.a] -= push.y * wa; z[c.a] -= push.z * wa;
+		x[c.b] += push.x * wb; y[c.b] += push.y * wb; z[c.b] += push.z * wb;
+	}
+}
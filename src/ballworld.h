@@ -0,0 +1,216 @@
+#ifndef BALLWORLD_H
+#define BALLWORLD_H
+
+#include <glm/glm.hpp>
+
+#include "grid.h"
+#include "monitor.h"
+#include "room.h"
+#include "sweepprune.h"
+
+#include <vector>
+
+class ThreadPool;
+
+// How BallWorld pushes touching balls apart
+enum ContactSolverType
+{
+	PairwiseContacts = 0,   // every pair once, in the order found
+	SequentialImpulses = 1  // projected Gauss-Seidel over all contacts, warm started
+};
+
+// Many balls bouncing in the same room.
+// Every ball follows the rules of update() in run.cpp, but the state is kept
+// as a structure of arrays so a step walks each field as one contiguous block.
+class BallWorld
+{
+public:
+	// One entry per ball, velocities are per step
+	std::vector<float> x, y, z;
+	std::vector<float> vx, vy, vz;
+	std::vector<float> radius;
+	std::vector<unsigned char> restFlag;
+
+	float gravity;
+	Room room;
+
+	// Ball-ball collisions, off by default so a single ball behaves like update()
+	bool collideBalls;
+	float restitution;
+	BroadphaseType broadphaseType; // can be changed between steps
+	UniformGrid grid;
+	SweepAndPrune sweepAndPrune;
+	std::vector<BallPair> pairs; // touching balls found in the last step
+
+	// With SequentialImpulses every contact, and the ground under a ball that
+	// rests on it in a pile, is one constraint: the balls may not come closer
+	// in the next step. solverIterations sweeps over all of them solve for
+	// the impulses together, so a ball at the bottom of a stack holds up the
+	// ones above it. The impulse of every pair is kept for the next step and
+	// applied first (warmStart), so a settled pile starts out solved and needs
+	// one or two sweeps instead of ten or more. Runs on one thread.
+	ContactSolverType contactSolver;
+	int solverIterations;
+	bool warmStart;
+
+	// Sleeping. A ball with restFlag set is not moved by a step. Besides
+	// stopping on the ground like in update(), a group of touching balls
+	// (an island) that have all been slower than sleepSpeed for sleepSteps
+	// steps falls asleep together. A moving ball that hits a sleeping one,
+	// or an impulse, wakes its whole island. When everything is asleep a
+	// step does nothing. With most balls asleep the broadphase only takes in
+	// the awake balls and the sleeping ones in or next to their grid cells,
+	// so a big sleeping pile is not sorted or searched for pairs every step.
+	// A ball woken in a step meets the sleeping balls further out in the
+	// next one.
+	bool allowSleep;
+	float sleepSpeed;
+	int sleepSteps;
+	std::vector<int> quietSteps;   // steps each ball has been slower than sleepSpeed
+	std::vector<int> nextInIsland; // the balls of a sleeping island form a ring, others point at themselves
+
+	// When set, a step runs on the threads of this pool. Moving the balls is
+	// split by index ranges. With the grid broadphase, rows of cells find
+	// pairs in parallel and contacts are resolved one grid colour at a time,
+	// so no two threads touch the same ball. The result does not depend on
+	// the number of threads, but contacts are resolved in a different order
+	// than without a pool. Sleeping and other broadphases stay on one thread.
+	ThreadPool* threadPool;
+
+	// When set, step() fills it with the energy, momentum, penetration and
+	// bounces of every ball after the move through the room, and the pairs
+	// found. Contacts resolved afterwards are not in it. The sums are done
+	// per block of balls and added in order, so they are the same on any
+	// number of threads. Null (the default) steps with the kernel that has
+	// none of it compiled in.
+	StepStats* stats;
+
+	BallWorld();
+
+	int size() const { return int(x.size()); }
+	void reserve(int n);
+	void clear();
+
+	// Returns the index of the new ball
+	int addBall(const glm::vec3& position, const glm::vec3& velocity, float r);
+
+	glm::vec3 position(int i) const { return glm::vec3(x[i], y[i], z[i]); }
+	glm::vec3 velocity(int i) const { return glm::vec3(vx[i], vy[i], vz[i]); }
+
+	// Advance every ball that is not at rest by one step
+	void step();
+
+	// Advance by dt steps (may be fractional or many steps at once) following
+	// the exact arc of every ball. Instead of clamping to the room afterwards,
+	// the time of impact with each of the six room planes is found and the
+	// rest of the motion continues from the bounce, so nothing tunnels through
+	// a wall and no time is lost however big dt is.
+	void stepContinuous(float dt);
+
+	// Advance by steps calls of step() at once, doing the work only where it
+	// is needed. A ball that cannot reach the room in that time takes all the
+	// steps in one jump, the sum of the steps in closed form, which is the
+	// same as stepping up to float rounding. The others, fast or close to a
+	// wall, are gathered into arrays of their own and take every step with
+	// stepBalls(), so its SIMD lanes stay full. Returns the balls that jumped.
+	// With collideBalls a ball only jumps, and a ball at rest only stays out
+	// of the steps, when the box it could reach in them meets no other such
+	// box. The stepped balls collide among themselves after every step, and
+	// one that comes into the box of a jumping or resting ball brings it
+	// in: it is put where its jump has taken it by then and takes the rest
+	// of the steps with them. With allowSleep every ball takes every step.
+	// stats and threadPool are used as step() uses them, stats being those
+	// of the last step.
+	int stepAdaptive(int steps);
+
+	// The broadphase picked by broadphaseType
+	Broadphase& broadphase();
+
+	// Find and resolve touching balls at the current positions,
+	// done at the end of a step when collideBalls is set
+	void collide();
+
+	// Push apart and bounce off every pair of touching balls.
+	// Heavier (bigger) balls move less. A sleeping ball does not move unless
+	// the other ball is fast enough to wake it.
+	void resolveContacts(const std::vector<BallPair>& contacts);
+
+	// The same with the contact solver, see contactSolver
+	void solveContacts(const std::vector<BallPair>& contacts);
+
+	// Wake ball i and every ball asleep in the same island
+	void wake(int i);
+
+	// Change the velocity of ball i, e.g. from the keyboard, waking it up
+	void applyImpulse(int i, const glm::vec3& dv);
+
+	int awakeCount() const;
+
+	// The impulses the contact solver keeps for the warm start, by the key
+	// (a << 32) | b of every pair in increasing order, e.g. for a snapshot
+	int cachedImpulseCount() const { return int(impulseCache.size()); }
+	void getCachedImpulses(unsigned long long* keys, float* impulses) const;
+	void setCachedImpulses(int count, const unsigned long long* keys, const float* impulses);
+
+private:
+	void findAwakeRuns();
+	void stepAwake();
+	void addSleepingStats();
+	void addBallStats(int i);
+	bool findNearAwake();
+	void collideListed(const std::vector<int>* balls);
+	void collideInParallel(const std::vector<int>* balls);
+	void keepJumpsApart(int steps);
+	void reachBox(int i, int steps, float lo[3], float hi[3]) const;
+	void bringInReached(int s, int steps);
+	void copyNear(bool fromWorld);
+	void stepNear(bool monitor);
+	void resolveContact(int a, int b, bool canWake);
+	void wakeTouching(int a, int b);
+	glm::vec3 displacement(int i) const;
+	void updateSleep();
+	bool moving(int i) const;
+
+	std::vector<int> awakeRuns; // begin and end of every run of blocks with awake balls
+	std::vector<int> nearAwake; // the balls the broadphase takes in while most sleep
+	std::vector<int> islandParent, islandQuiet;
+
+	// Scratch for the steps run on threadPool
+	std::vector<int> stepChunks;                    // begin and end of every block of awake balls
+	std::vector<StepStats> chunkStats;              // what each block added to stats
+	std::vector<std::vector<BallPair> > rowPairs;   // pairs found by every block of grid rows
+	std::vector<int> colourSpans[UniformGrid::colourCount]; // begin and end of the pairs of each cell
+
+	// A contact of solveContacts(), b is -1 for the ground
+	struct SolverContact
+	{
+		int a, b;
+		glm::vec3 n;     // from a to b
+		float wa, wb;    // inverse masses
+		float target;    // lowest speed along n the solver allows
+		float impulse;   // summed over the sweeps, never negative
+	};
+	struct CachedImpulse
+	{
+		unsigned long long key; // a and b, sorted by it
+		float impulse;
+	};
+	std::vector<SolverContact> solverContacts;
+	std::vector<CachedImpulse> impulseCache, nextImpulseCache;
+	std::vector<unsigned char> onGround; // by ball, has a ground contact this step
+
+	// The balls stepAdaptive() steps one by one, and their state while it does
+	std::vector<unsigned char> jumped; // by ball, how it takes the steps
+	std::vector<int> nearBalls;
+	std::vector<float> nearX, nearY, nearZ, nearVX, nearVY, nearVZ, nearRadius;
+	std::vector<unsigned char> nearRest;
+
+	// With collideBalls, the balls that jump or rest, their reach boxes
+	// (6 floats each), and by grid cell the ones whose reach is in it:
+	// farBalls[farCellBalls[farCellStart[c] ... farCellStart[c + 1] - 1]]
+	std::vector<int> farBalls;
+	std::vector<float> farBoxes, ballBoxes; // the same by ball
+	std::vector<int> farCellStart, farCellBalls;
+};
+
+#endif // BALLWORLD_H
@@ -0,0 +1,35 @@
+#ifndef BROADPHASE_H
+#define BROADPHASE_H
+
+#include <vector>
+
+class BallWorld;
+
+// Two balls whose bounds overlap, a < b
+struct BallPair
+{
+	int a, b;
+};
+
+// Finds the pairs of balls that may touch, so the narrowphase does not have
+// to test every ball against every other one.
+class Broadphase
+{
+public:
+	virtual ~Broadphase() {}
+
+	// Take in the current positions and sizes of the balls
+	virtual void build(const BallWorld& world) = 0;
+
+	// The same with only the listed balls, in increasing order, e.g. the
+	// ones that may touch an awake ball. The others are not looked at.
+	virtual void build(const BallWorld& world, const std::vector<int>& balls) = 0;
+
+	// Replaces the contents of pairs with every pair of balls that
+	// overlapped when build() was last called
+	virtual void findPairs(std::vector<BallPair>& pairs) const = 0;
+};
+
+enum BroadphaseType { GridBroadphase = 0, SweepAndPruneBroadphase = 1, NumBroadphases = 2 };
+
+#endif // BROADPHASE_H
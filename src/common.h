@@ -23,9 +23,12 @@ extern GLuint InitShader(const char* vShaderFile, const char* fShaderFile);
 
 extern const char *WINDOW_TITLE;
 extern const double FRAME_RATE_MS;
+extern const double PHYSICS_STEP_MS;
 
+extern void setOptions(int argc, char** argv);
 extern void init(void);
 extern void update(void);
+extern void interpolate(double alpha);
 extern void display(void);
 extern void keyboard(unsigned char key, int x, int y);
 extern void mouse(int button, int state, int x, int y);
@@ -0,0 +1,112 @@
+#include "ensemble.h"
+#include "stepkernel.h"
+
+#include <algorithm>
+
+GameEnsemble::GameEnsemble(const GameConstants& c, int count)
+	: c(c), steps(0), active(0)
+{
+	x.resize(count); y.resize(count); z.resize(count);
+	vx.resize(count); vy.resize(count); vz.resize(count);
+	radius.assign(count, c.radius);
+	spin.resize(count);
+	turn.resize(count);
+	rest.resize(count);
+	copyOf.resize(count);
+	slot.resize(count);
+	restSteps.resize(count);
+	others.resize(count);
+
+	const GameState s = startState(c);
+	for (int i = 0; i < count; i++) {
+		copyOf[i] = slot[i] = i;
+		setState(i, s);
+	}
+}
+
+void
+GameEnsemble::setState(int copy, const GameState& s)
+{
+	// Paused copies are kept with the resting ones, stepGame() skips both
+	const bool still = s.rest || s.pause;
+	int i = slot[copy];
+	if (i < active && still) {
+		swapSlots(i, --active);
+		i = active;
+	}
+	else if (i >= active && !still) {
+		swapSlots(i, active++);
+		i = active - 1;
+	}
+	x[i] = s.position.x; y[i] = s.position.y; z[i] = s.position.z;
+	vx[i] = s.velocity.x; vy[i] = s.velocity.y; vz[i] = s.velocity.z;
+	spin[i] = s.theta[1];
+	turn[i] = s.clockwise ? -c.spin : c.spin;
+	rest[i] = still;
+	restSteps[copy] = s.rest ? steps : -1;
+	others[copy] = s;
+}
+
+GameState
+GameEnsemble::state(int copy) const
+{
+	const int i = slot[copy];
+	GameState s = others[copy];
+	s.position = glm::vec3(x[i], y[i], z[i]);
+	s.velocity = glm::vec3(vx[i], vy[i], vz[i]);
+	s.theta[1] = spin[i];
+	s.rest = s.rest || restSteps[copy] >= 0;
+	return s;
+}
+
+void
+GameEnsemble::swapSlots(int a, int b)
+{
+	std::swap(x[a], x[b]); std::swap(y[a], y[b]); std::swap(z[a], z[b]);
+	std::swap(vx[a], vx[b]); std::swap(vy[a], vy[b]); std::swap(vz[a], vz[b]);
+	std::swap(radius[a], radius[b]);
+	std::swap(spin[a], spin[b]);
+	std::swap(turn[a], turn[b]);
+	std::swap(rest[a], rest[b]);
+	std::swap(copyOf[a], copyOf[b]);
+	slot[copyOf[a]] = a;
+	slot[copyOf[b]] = b;
+}
+
+int
+GameEnsemble::step()
+{
+	steps++;
+
+	// The turn of the ball as in stepGame(). Its double compare and subtract
+	// on a float give the same bits as the float ones here.
+	for (int i = 0; i < active; i++) {
+		float theta = spin[i] + turn[i];
+		theta = theta > 360.0f ? theta - 360.0f : theta;
+		theta = theta < 0.0f ? theta + 360.0f : theta;
+		spin[i] = theta;
+	}
+
+	stepBalls(active, c.gravity, c.room, x.data(), y.data(), z.data(),
+		vx.data(), vy.data(), vz.data(), radius.data(), rest.data());
+
+	// Move the copies that stopped behind the moving ones
+	for (int i = active - 1; i >= 0; i--) {
+		if (rest[i]) {
+			restSteps[copyOf[i]] = steps;
+			swapSlots(i, --active);
+		}
+	}
+	return active;
+}
+
+int
+GameEnsemble::run(int maxSteps)
+{
+	int taken = 0;
+	while (active > 0 && taken < maxSteps) {
+		step();
+		taken++;
+	}
+	return taken;
+}
@@ -0,0 +1,60 @@
+#ifndef ENSEMBLE_H
+#define ENSEMBLE_H
+
+#include "game.h"
+
+#include <vector>
+
+// Many independent copies of the game ball, each in a room of its own, for
+// Monte Carlo studies of stepGame(). All copies share the constants and
+// differ in their state. The states are kept as a structure of arrays and
+// stepped by stepBalls(), so every SIMD lane carries one copy and the
+// results are those of stepGame() to the bit.
+//
+// A copy that comes to rest is masked out of the step and swapped behind
+// the moving ones, so a step only costs as much as the copies still moving.
+class GameEnsemble
+{
+public:
+	// count copies, all in startState(c)
+	GameEnsemble(const GameConstants& c, int count);
+
+	int size() const { return int(slot.size()); }
+	const GameConstants& constants() const { return c; }
+
+	// Copies keep their index however they are stored
+	void setState(int copy, const GameState& s);
+	GameState state(int copy) const;
+
+	// One stepGame() for every copy. Returns the copies still moving.
+	int step();
+
+	// Step until every copy rests or maxSteps steps were taken, and return
+	// the steps taken
+	int run(int maxSteps);
+
+	int moving() const { return active; }
+
+	// Steps each copy took to come to rest, -1 while it moves
+	int restStep(int copy) const { return restSteps[copy]; }
+
+private:
+	void swapSlots(int a, int b);
+
+	GameConstants c;
+	int steps;
+	int active; // copies stored in [0, active) are moving
+
+	// Stored by slot
+	std::vector<float> x, y, z, vx, vy, vz, radius;
+	std::vector<float> spin, turn; // theta[1] and what a step adds to it
+	std::vector<unsigned char> rest;
+	std::vector<int> copyOf;
+
+	// By copy
+	std::vector<int> slot;
+	std::vector<int> restSteps;
+	std::vector<GameState> others; // what stepGame() leaves alone: the rest of theta, pause, clockwise, view
+};
+
+#endif // ENSEMBLE_H
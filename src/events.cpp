@@ -0,0 +1,157 @@
+#include "events.h"
+#include "ballworld.h"
+#include "impact.h"
+
+#include <algorithm>
+#include <cfloat>
+
+EventSimulator::EventSimulator(const BallWorld& world)
+	: room(world.room), gravity(world.gravity), time(0.0), processed(0)
+{
+	const int n = world.size();
+	balls.resize(n);
+	for (int i = 0; i < n; i++) {
+		Ball& b = balls[i];
+		b.s.time = 0.0;
+		b.s.position = glm::dvec3(world.position(i));
+		b.s.velocity = glm::dvec3(world.velocity(i));
+		b.s.rest = world.restFlag[i] != 0;
+		b.radius = world.radius[i];
+		b.bounces = 0;
+		b.restTime = b.s.rest ? 0.0 : -1.0;
+
+		// start inside the room
+		glm::dvec3& p = b.s.position;
+		p.x = std::min(std::max(p.x, room.walls[leftWall] + b.radius), room.walls[rightWall] - b.radius);
+		p.y = std::min(std::max(p.y, room.ground + b.radius), room.ceiling - b.radius);
+		p.z = std::min(std::max(p.z, room.walls[farWall] + b.radius), room.walls[nearWall] - b.radius);
+
+		schedule(i);
+	}
+}
+
+BallState
+flyTo(const BallState& s, double t, double gravity)
+{
+	BallState to = s;
+	to.time = t;
+	if (s.rest) {
+		return to;
+	}
+	const double dt = t - s.time;
+	to.position.x += s.velocity.x * dt;
+	to.position.y += (s.velocity.y + 0.5 * gravity * dt) * dt;
+	to.position.z += s.velocity.z * dt;
+	to.velocity.y += gravity * dt;
+	return to;
+}
+
+// Find the first impact of ball i after its last one
+void
+EventSimulator::schedule(int i)
+{
+	const Ball& b = balls[i];
+	const BallState& s = b.s;
+	if (s.rest) {
+		return;
+	}
+
+	const double r = b.radius;
+	double t = DBL_MAX;
+	int plane = hitNothing;
+
+	double tHit = timeToFall(s.position.y - (room.ground + r), s.velocity.y, gravity, t);
+	if (tHit >= 0.0) {
+		t = tHit; plane = hitGroundPlane;
+	}
+	tHit = timeToRise((room.ceiling - r) - s.position.y, s.velocity.y, gravity, t);
+	if (tHit >= 0.0 && tHit < t) {
+		t = tHit; plane = hitCeilingPlane;
+	}
+	tHit = timeToWall(s.position.x, s.velocity.x, room.walls[leftWall] + r, room.walls[rightWall] - r, t);
+	if (tHit >= 0.0 && tHit < t) {
+		t = tHit; plane = hitXPlane;
+	}
+	tHit = timeToWall(s.position.z, s.velocity.z, room.walls[farWall] + r, room.walls[nearWall] - r, t);
+	if (tHit >= 0.0 && tHit < t) {
+		t = tHit; plane = hitZPlane;
+	}
+
+	if (plane != hitNothing) {
+		Event e = { s.time + t, i, plane };
+		queue.push(e);
+	}
+}
+
+// Move ball e.ball onto the plane it hits and bounce it
+void
+EventSimulator::process(const Event& e)
+{
+	Ball& b = balls[e.ball];
+	const double r = b.radius;
+	b.s = flyTo(b.s, e.time, gravity);
+	b.bounces++;
+
+	glm::dvec3& p = b.s.position;
+	glm::dvec3& v = b.s.velocity;
+	if (e.plane == hitGroundPlane) {
+		p.y = room.ground + r;
+		v.y = -v.y;
+		if (std::abs(v.y) <= std::abs(gravity)) {
+			b.s.rest = true;
+			b.restTime = e.time;
+			v = glm::dvec3(0.0, gravity, 0.0); // as left by BallWorld::step()
+		}
+	}
+	else if (e.plane == hitCeilingPlane) {
+		p.y = room.ceiling - r;
+		v.y = -v.y;
+	}
+	else if (e.plane == hitXPlane) {
+		p.x = v.x > 0.0 ? room.walls[rightWall] - r : room.walls[leftWall] + r;
+		v.x = -v.x;
+	}
+	else {
+		p.z = v.z > 0.0 ? room.walls[nearWall] - r : room.walls[farWall] + r;
+		v.z = -v.z;
+	}
+
+	processed++;
+	schedule(e.ball);
+}
+
+void
+EventSimulator::advanceTo(double t)
+{
+	while (!queue.empty() && queue.top().time <= t) {
+		Event e = queue.top();
+		queue.pop();
+		process(e);
+	}
+	time = std::max(time, t);
+}
+
+bool
+EventSimulator::advanceToNextEvent()
+{
+	if (queue.empty()) {
+		return false;
+	}
+	Event e = queue.top();
+	queue.pop();
+	time = std::max(time, e.time);
+	process(e);
+	return true;
+}
+
+void
+EventSimulator::writeTo(BallWorld& world) const
+{
+	for (int i = 0; i < size(); i++) {
+		glm::dvec3 p = position(i);
+		glm::dvec3 v = velocity(i);
+		world.x[i] = float(p.x); world.y[i] = float(p.y); world.z[i] = float(p.z);
+		world.vx[i] = float(v.x); world.vy[i] = float(v.y); world.vz[i] = float(v.z);
+		world.restFlag[i] = balls[i].s.rest ? 1 : 0;
+	}
+}
@@ -0,0 +1,96 @@
+#ifndef EVENTS_H
+#define EVENTS_H
+
+#include <glm/glm.hpp>
+
+#include "room.h"
+
+#include <functional>
+#include <queue>
+#include <vector>
+
+class BallWorld;
+
+// Where a ball is at some time
+struct BallState
+{
+	double time;
+	glm::dvec3 position, velocity;
+	bool rest;
+};
+
+// Follow the parabola of a ball in state s up to time t, assuming it hits nothing
+BallState flyTo(const BallState& s, double t, double gravity);
+
+// Event driven version of BallWorld::stepContinuous() for long offline runs.
+// Between bounces a ball follows a known parabola, so instead of stepping
+// every ball at a fixed rate, the time of each ball's next impact with the
+// room is solved for and kept in a priority queue, and the simulation jumps
+// from one impact straight to the next. Balls do not collide with each other.
+// Times are in steps of update(), kept in double so long runs stay exact.
+class EventSimulator
+{
+public:
+	explicit EventSimulator(const BallWorld& world);
+
+	double now() const { return time; }
+	int size() const { return int(balls.size()); }
+
+	// Process every impact up to t, and move the clock to t
+	void advanceTo(double t);
+
+	// Process the next impact and move the clock to it, false if every ball is at rest
+	bool advanceToNextEvent();
+
+	long long processedEvents() const { return processed; }
+	int pendingEvents() const { return int(queue.size()); }
+
+	// State of ball i at now()
+	BallState state(int i) const { return flyTo(balls[i].s, time, gravity); }
+	glm::dvec3 position(int i) const { return state(i).position; }
+	glm::dvec3 velocity(int i) const { return state(i).velocity; }
+	bool atRest(int i) const { return balls[i].s.rest; }
+
+	// State of ball i right after its last impact (or at the start)
+	const BallState& lastImpact(int i) const { return balls[i].s; }
+
+	// Statistics for batch runs
+	int bounces(int i) const { return balls[i].bounces; }
+	double restTime(int i) const { return balls[i].restTime; } // -1 while moving
+
+	// Copy the state at now() into a world with the same balls
+	void writeTo(BallWorld& world) const;
+
+private:
+	struct Ball
+	{
+		BallState s; // right after the last impact
+		double radius;
+		int bounces;
+		double restTime;
+	};
+
+	struct Event
+	{
+		double time;
+		int ball;
+		int plane;
+		bool operator>(const Event& other) const
+		{
+			// ties go to the lower ball so runs are repeatable
+			return time > other.time || (time == other.time && ball > other.ball);
+		}
+	};
+
+	void schedule(int i);
+	void process(const Event& e);
+
+	Room room;
+	double gravity;
+	double time;
+	long long processed;
+	std::vector<Ball> balls;
+	std::priority_queue<Event, std::vector<Event>, std::greater<Event> > queue;
+};
+
+#endif // EVENTS_H
@@ -12,18 +12,63 @@ flat in float Shininess;
 
 uniform bool UseLighting;
 
+// See vshader.glsl
+in vec2 checker;
+flat in int blackTiles;
+in vec3 ballPoint;
+flat in int redTiles;
+uniform vec2 BallTiles;
+
+const float PI = 3.1415926;
+
+// The material of the vertex, or black_rubber() or red_rubber() of
+// vshader.glsl on the black or red tiles
+vec4 Colour, Ambient, Diffuse, Specular;
+
+void material()
+{
+	Colour = f_colour;
+	Ambient = AmbientMaterial;
+	Diffuse = DiffuseMaterial;
+	Specular = SpecularMaterial;
+
+	vec2 tile = floor(checker);
+	if (blackTiles >= 0 && int(mod(tile.x + tile.y, 2.0)) == blackTiles) {
+		Colour = vec4(		0.02,	0.02,	0.02,	1);
+		Ambient = vec4(		0.02,	0.02,	0.02,	1.0);
+		Diffuse = vec4(		0.11,	0.11,	0.31,	1.0);
+		Specular = vec4(	0.4,	0.4,	0.4,	1.0);
+	}
+
+	if (redTiles < 0) {
+		return;
+	}
+	// Tiles of longitude and latitude
+	float phi = atan(ballPoint.y, ballPoint.x);
+	float theta = acos(clamp(ballPoint.z / length(ballPoint), -1.0, 1.0));
+	vec2 ballTile = floor(vec2((phi < 0.0 ? phi + 2.0 * PI : phi) / (2.0 * PI), theta / PI) * BallTiles);
+	if (int(mod(ballTile.x + ballTile.y, 2.0)) == redTiles) {
+		Colour = vec4(		0.05,	0.0,	0.0,	1);
+		Ambient = vec4(		0.05,	0.0,	0.0,	1.0);
+		Diffuse = vec4(		0.8,	0.1,	0.1,	1.0);
+		Specular = vec4(	0.7,	0.04,	0.04,	1.0);
+	}
+}
+
 void main() 
 {
+	material();
+
 	if (!UseLighting) {
-		out_colour = f_colour;
+		out_colour = Colour;
 	} else {
 		vec3 H = normalize( L + E );
 		vec3 H2 = normalize( L2 + E2 );
 
-		vec4 ambient = AmbientLight*AmbientMaterial;
+		vec4 ambient = AmbientLight*Ambient;
 
-		vec4 DiffuseProduct= DiffuseLight*DiffuseMaterial;
-		vec4 SpecularProduct= SpecularLight*SpecularMaterial;
+		vec4 DiffuseProduct= DiffuseLight*Diffuse;
+		vec4 SpecularProduct= SpecularLight*Specular;
 		
 		float Kd = max( dot(L, N), 0.0 );
 		vec4  diffuse = Kd * DiffuseProduct;
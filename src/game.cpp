@@ -0,0 +1,179 @@
+#include "game.h"
+
+#include <cmath>
+
+GameConstants
+defaultConstants()
+{
+	const float g = 9.8f;
+	const float mass = 0.0002f;
+	const float velocity = 150;
+
+	GameConstants c;
+	c.gravity = -mass * g;
+	c.impulse = mass * velocity;
+	c.radius = 0.5f;
+	c.spin = 2;
+	c.start = glm::vec3(0, 1, -1);
+	c.room = defaultRoom();
+	return c;
+}
+
+GameState
+startState(const GameConstants& c)
+{
+	GameState s;
+	s.position = c.start;
+	s.velocity = glm::vec3(c.impulse, c.impulse, c.impulse);
+	s.theta[0] = s.theta[1] = s.theta[2] = 0;
+	s.rest = false;
+	s.pause = false;
+	s.clockwise = true;
+	s.view = 0;
+	return s;
+}
+
+template <class Integrator>
+void
+stepGameWith(GameState& s, const GameConstants& c, float dt)
+{
+	if (s.pause || s.rest) {
+		return;
+	}
+
+	float& spin = s.theta[1];
+	if (s.clockwise) {
+		spin -= c.spin * dt;
+	}
+	else {
+		spin += c.spin * dt;
+	}
+
+	if (spin > 360.0) {
+		spin -= 360.0;
+	}
+	else if (spin < 0) {
+		spin += 360.0;
+	}
+
+	const float radius = c.radius;
+	const float ground = c.room.ground;
+	const float* walls = c.room.walls;
+	glm::vec3& position = s.position;
+	glm::vec3& velocity = s.velocity;
+
+	// apply forces to move
+	Integrator::move(position, velocity, c.gravity, dt);
+
+	// collision detection
+	if (position.y <= ground + radius) {
+		position.y = ground + radius;
+		velocity.y = -velocity.y;
+		if (std::abs(velocity.y) <= std::abs(c.gravity * dt))
+		{
+			s.rest = true;
+			velocity = glm::vec3(0, 0, 0);
+		}
+	}
+	if (position.x >= walls[rightWall] - radius) {
+		position.x = walls[rightWall] - radius;
+		velocity.x = -velocity.x;
+	}
+	else if (position.x <= walls[leftWall] + radius) {
+		position.x = walls[leftWall] + radius;
+		velocity.x = -velocity.x;
+	}
+
+	if (position.z >= walls[nearWall] - radius) {
+		position.z = walls[nearWall] - radius;
+		velocity.z = -velocity.z;
+	}
+	else if (position.z <= walls[farWall] + radius) {
+		position.z = walls[farWall] + radius;
+		velocity.z = -velocity.z;
+	}
+
+	// apply gravity to a new force
+	Integrator::accelerate(velocity, c.gravity, dt);
+}
+
+template void stepGameWith<ExplicitEuler>(GameState&, const GameConstants&, float);
+template void stepGameWith<SemiImplicitEuler>(GameState&, const GameConstants&, float);
+template void stepGameWith<VelocityVerlet>(GameState&, const GameConstants&, float);
+template void stepGameWith<RungeKutta4>(GameState&, const GameConstants&, float);
+
+void
+stepGame(GameState& s, const GameConstants& c)
+{
+	stepGameWith<SemiImplicitEuler>(s, c, 1.0f);
+}
+
+bool
+gameKey(GameState& s, const GameConstants& c, unsigned char key)
+{
+	switch (key) {
+	case ' ':  // hold
+		s.view++;
+		if (s.view > 2) {
+			s.view = 0;
+		}
+		break;
+	case 'e':  // hold
+		s.pause = !s.pause;
+		break;
+	case 'w':
+		s.rest = false;
+		s.velocity.z -= c.impulse;
+		break;
+	case 'a':
+		s.rest = false;
+		s.velocity.x -= c.impulse;
+		break;
+	case 's':
+		s.rest = false;
+		s.velocity.z += c.impulse;
+		break;
+	case 'd':
+		s.rest = false;
+		s.velocity.x += c.impulse;
+		break;
+	case 'j':
+		s.rest = false;
+		s.velocity.y += c.impulse;
+		break;
+	case 'k':
+		s.rest = false;
+		s.velocity = glm::vec3(0, 0, 0);
+		break;
+	case 'r': // restart
+		s.rest = false;
+		s.position = c.start;
+		s.velocity = glm::vec3(c.impulse, c.impulse, c.impulse);
+		break;
+	default:
+		return false;
+	}
+	return true;
+}
+
+static unsigned long long
+hashBytes(const void* data, size_t size, unsigned long long h)
+{
+	const unsigned char* p = static_cast<const unsigned char*>(data);
+	for (size_t i = 0; i < size; i++) {
+		h = (h ^ p[i]) * 1099511628211ull;
+	}
+	return h;
+}
+
+unsigned long long
+hashState(const GameState& s)
+{
+	const unsigned char flags[3] = { s.rest, s.pause, s.clockwise };
+	unsigned long long h = 14695981039346656037ull;
+	h = hashBytes(&s.position, sizeof(s.position), h);
+	h = hashBytes(&s.velocity, sizeof(s.velocity), h);
+	h = hashBytes(s.theta, sizeof(s.theta), h);
+	h = hashBytes(flags, sizeof(flags), h);
+	return hashBytes(&s.view, sizeof(s.view), h);
+}
@@ -0,0 +1,109 @@
+#ifndef GAME_H
+#define GAME_H
+
+#include <glm/glm.hpp>
+
+#include "room.h"
+
+// The single ball of run.cpp without anything of GL or GLUT, so the window
+// and the programs in tools/ run the very same physics.
+
+// Fixed for a whole game, all per step
+struct GameConstants
+{
+	float gravity;
+	float impulse;   // speed added by a key
+	float radius;
+	float spin;      // degrees the ball turns around y
+	glm::vec3 start; // where 'r' puts the ball back
+	Room room;
+};
+
+// Everything a step or a key can change
+struct GameState
+{
+	glm::vec3 position;
+	glm::vec3 velocity;
+	float theta[3]; // rotation around each axis, in degrees
+	bool rest;
+	bool pause;
+	bool clockwise;
+	int view;
+};
+
+// The constants run.cpp has always used
+GameConstants defaultConstants();
+
+// The ball at the start position, thrown with the impulse along every axis
+GameState startState(const GameConstants& c);
+
+// One step of the ball: move, bounce off the room, stop on the ground
+void stepGame(GameState& s, const GameConstants& c);
+
+// Integrators for stepGameWith(). A step moves the ball with move(), lets
+// the room turn it around, then changes its velocity with accelerate(), so
+// every integrator meets the walls the same way. g is the gravity along y
+// and dt the length of the step in steps of stepGame().
+
+// x += v dt, v += g dt
+struct ExplicitEuler
+{
+	static void move(glm::vec3& p, const glm::vec3& v, float, float dt) { p += v * dt; }
+	static void accelerate(glm::vec3& v, float g, float dt) { v.y += g * dt; }
+};
+
+// v += g dt, x += v dt: what stepGame() does, with the gravity going into the
+// position and then into the velocity
+struct SemiImplicitEuler
+{
+	static void move(glm::vec3& p, const glm::vec3& v, float g, float dt) { p += v * dt; p.y += g * dt * dt; }
+	static void accelerate(glm::vec3& v, float g, float dt) { v.y += g * dt; }
+};
+
+// x += v dt + g dt^2 / 2, v += g dt, exact between bounces under constant gravity
+struct VelocityVerlet
+{
+	static void move(glm::vec3& p, const glm::vec3& v, float g, float dt) { p += v * dt; p.y += 0.5f * g * dt * dt; }
+	static void accelerate(glm::vec3& v, float g, float dt) { v.y += g * dt; }
+};
+
+// Classic fourth order Runge-Kutta on x' = v, v' = a with a the gravity.
+// With a constant the stages sum to x += v dt + a dt^2 / 2 and v += a dt,
+// the same step as VelocityVerlet up to rounding. It would only differ for
+// forces that change along the path, which the game has none of.
+struct RungeKutta4
+{
+	static glm::vec3 acceleration(float g) { return glm::vec3(0, g, 0); }
+
+	static void
+	move(glm::vec3& p, const glm::vec3& v, float g, float dt)
+	{
+		const glm::vec3 k1 = v;
+		const glm::vec3 k2 = v + acceleration(g) * (0.5f * dt);
+		const glm::vec3 k3 = v + acceleration(g) * (0.5f * dt);
+		const glm::vec3 k4 = v + acceleration(g) * dt;
+		p += (k1 + 2.0f * k2 + 2.0f * k3 + k4) * (dt / 6.0f);
+	}
+
+	static void
+	accelerate(glm::vec3& v, float g, float dt)
+	{
+		const glm::vec3 a = acceleration(g);
+		v += (a + 2.0f * a + 2.0f * a + a) * (dt / 6.0f);
+	}
+};
+
+// stepGame() with another integrator and a step of dt. stepGame() is
+// stepGameWith<SemiImplicitEuler>(s, c, 1). Defined in game.cpp for the
+// four integrators above.
+template <class Integrator>
+void stepGameWith(GameState& s, const GameConstants& c, float dt);
+
+// Apply a key of keyboard() that changes the state. Returns false for keys
+// that do nothing to it (like quitting), so they need not be recorded.
+bool gameKey(GameState& s, const GameConstants& c, unsigned char key);
+
+// FNV-1a of the bits of the state, equal only for states equal to the bit
+unsigned long long hashState(const GameState& s);
+
+#endif // GAME_H
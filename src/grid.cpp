@@ -0,0 +1,252 @@
+#include "grid.h"
+#include "ballworld.h"
+#include "threadpool.h"
+
+#include <algorithm>
+#include <cmath>
+
+// Rows of cells next to the current one that are not visited from the
+// other side. Along x a row is contiguous, so each row is tested as one span.
+static const int forwardRows[4][2] = {
+	{ 1, 0 }, { -1, 1 }, { 0, 1 }, { 1, 1 }, // dy, dz
+};
+
+UniformGrid::UniformGrid()
+	: invCellSize(1.0f)
+{
+	origin[0] = origin[1] = origin[2] = 0.0f;
+	dims[0] = dims[1] = dims[2] = 1;
+}
+
+void
+UniformGrid::build(const BallWorld& world)
+{
+	setup(world);
+	const int n = world.size();
+	for (int i = 0; i < n; i++) {
+		ballCell[i] = cellOf(world.x[i], world.y[i], world.z[i]);
+	}
+	sort(world, NULL, n);
+}
+
+void
+UniformGrid::build(const BallWorld& world, const std::vector<int>& balls)
+{
+	setup(world);
+	const int count = int(balls.size());
+	for (int k = 0; k < count; k++) {
+		const int i = balls[k];
+		ballCell[i] = cellOf(world.x[i], world.y[i], world.z[i]);
+	}
+	sort(world, balls.data(), count);
+}
+
+void
+UniformGrid::build(const BallWorld& world, ThreadPool& pool)
+{
+	setup(world);
+	pool.parallelFor(0, world.size(), 16384, [&](int begin, int end) {
+		for (int i = begin; i < end; i++) {
+			ballCell[i] = cellOf(world.x[i], world.y[i], world.z[i]);
+		}
+	});
+	sort(world, NULL, world.size());
+}
+
+void
+UniformGrid::findNearAwake(const BallWorld& world, std::vector<int>& balls)
+{
+	setup(world);
+	const int n = world.size();
+	const unsigned char* rest = world.restFlag.data();
+
+	nearAwake.assign(cellCount(), 0);
+	for (int i = 0; i < n; i++) {
+		if (rest[i]) {
+			continue;
+		}
+		const int c = cellOf(world.x[i], world.y[i], world.z[i]);
+		const int x = c % dims[0], y = c / dims[0] % dims[1], z = c / (dims[0] * dims[1]);
+		const int x0 = std::max(x - 1, 0), x1 = std::min(x + 1, dims[0] - 1);
+		for (int nz = std::max(z - 1, 0); nz <= std::min(z + 1, dims[2] - 1); nz++) {
+			for (int ny = std::max(y - 1, 0); ny <= std::min(y + 1, dims[1] - 1); ny++) {
+				unsigned char* row = &nearAwake[dims[0] * (ny + dims[1] * nz)];
+				std::fill(row + x0, row + x1 + 1, 1);
+			}
+		}
+	}
+
+	balls.clear();
+	for (int i = 0; i < n; i++) {
+		if (!rest[i] || nearAwake[cellOf(world.x[i], world.y[i], world.z[i])]) {
+			balls.push_back(i);
+		}
+	}
+}
+
+// Size the cells for the balls and the room
+void
+UniformGrid::setup(const BallWorld& world)
+{
+	const int n = world.size();
+	const Room& room = world.room;
+
+	float maxRadius = 0.0f;
+	for (int i = 0; i < n; i++) {
+		maxRadius = std::max(maxRadius, world.radius[i]);
+	}
+
+	const float width = room.walls[rightWall] - room.walls[leftWall];
+	const float depth = room.walls[nearWall] - room.walls[farWall];
+	const float height = std::max(width, depth); // nothing stops a ball going up
+	const float extent[3] = { width, height, depth };
+
+	// Cells must fit the biggest ball, but many tiny balls would give far
+	// more cells than balls, so aim for about one ball per cell at least
+	float cellSize = 2.0f * maxRadius;
+	if (n > 0) {
+		cellSize = std::max(cellSize, std::cbrt(width * height * depth / n));
+	}
+	if (cellSize <= 0.0f) {
+		cellSize = height;
+	}
+	invCellSize = 1.0f / cellSize;
+
+	origin[0] = room.walls[leftWall];
+	origin[1] = room.ground;
+	origin[2] = room.walls[farWall];
+	for (int k = 0; k < 3; k++) {
+		dims[k] = std::max(1, int(std::ceil(extent[k] * invCellSize)));
+	}
+	ballCell.resize(n);
+}
+
+// Counting sort by the cells in ballCell of the listed balls, or of all
+// of them when balls is null
+void
+UniformGrid::sort(const BallWorld& world, const int* balls, int count)
+{
+	const int cells = cellCount();
+	cellStart.assign(cells + 1, 0);
+	cellBalls.resize(count);
+	sortedX.resize(count);
+	sortedY.resize(count);
+	sortedZ.resize(count);
+	sortedRadius.resize(count);
+
+	for (int k = 0; k < count; k++) {
+		cellStart[ballCell[balls ? balls[k] : k] + 1]++;
+	}
+	for (int c = 0; c < cells; c++) {
+		cellStart[c + 1] += cellStart[c];
+	}
+	cellFill.assign(cellStart.begin(), cellStart.end() - 1);
+	for (int k = 0; k < count; k++) {
+		const int i = balls ? balls[k] : k;
+		int slot = cellFill[ballCell[i]]++;
+		cellBalls[slot] = i;
+		sortedX[slot] = world.x[i];
+		sortedY[slot] = world.y[i];
+		sortedZ[slot] = world.z[i];
+		sortedRadius[slot] = world.radius[i];
+	}
+}
+
+// The cell along axis k of coordinate p
+int
+UniformGrid::cellAlong(int k, float p) const
+{
+	float t = (p - origin[k]) * invCellSize;
+	t = std::min(std::max(t, 0.0f), float(dims[k] - 1));
+	return int(t);
+}
+
+int
+UniformGrid::cellOf(float x, float y, float z) const
+{
+	return cellAt(cellAlong(0, x), cellAlong(1, y), cellAlong(2, z));
+}
+
+void
+UniformGrid::cellsOfBox(const float lo[3], const float hi[3], int first[3], int last[3]) const
+{
+	for (int k = 0; k < 3; k++) {
+		first[k] = cellAlong(k, lo[k]);
+		last[k] = cellAlong(k, hi[k]);
+	}
+}
+
+int
+UniformGrid::colourOf(int cell) const
+{
+	const int x = cell % dims[0];
+	const int y = cell / dims[0] % dims[1];
+	const int z = cell / (dims[0] * dims[1]);
+	return x % 3 + 3 * (y % 3) + 9 * (z % 3);
+}
+
+void
+UniformGrid::addPairs(int ia, int begin, int end, std::vector<BallPair>& pairs) const
+{
+	const float ax = sortedX[ia], ay = sortedY[ia], az = sortedZ[ia];
+	const float ar = sortedRadius[ia];
+
+	for (int ib = begin; ib < end; ib++) {
+		const float dx = sortedX[ib] - ax;
+		const float dy = sortedY[ib] - ay;
+		const float dz = sortedZ[ib] - az;
+		const float reach = ar + sortedRadius[ib];
+
+		if (dx * dx + dy * dy + dz * dz < reach * reach) {
+			const int a = cellBalls[ia], b = cellBalls[ib];
+			BallPair pair = { std::min(a, b), std::max(a, b) };
+			pairs.push_back(pair);
+		}
+	}
+}
+
+void
+UniformGrid::findPairs(std::vector<BallPair>& pairs) const
+{
+	pairs.clear();
+	findPairsInRows(0, rowCount(), pairs);
+}
+
+void
+UniformGrid::findPairsInRows(int rowBegin, int rowEnd, std::vector<BallPair>& pairs) const
+{
+	for (int r = rowBegin; r < rowEnd; r++) {
+		const int y = r % dims[1], z = r / dims[1];
+		const int row = dims[0] * r;
+
+		for (int x = 0; x < dims[0]; x++) {
+			const int c = row + x;
+			const int begin = cellStart[c], end = cellStart[c + 1];
+			if (begin == end) {
+				continue;
+			}
+
+			// the rest of this cell and the next one in the row
+			const int sameRowEnd = cellStart[x + 1 < dims[0] ? c + 2 : c + 1];
+			for (int ia = begin; ia < end; ia++) {
+				addPairs(ia, ia + 1, sameRowEnd, pairs);
+			}
+
+			const int x0 = std::max(x - 1, 0);
+			const int x1 = std::min(x + 1, dims[0] - 1);
+			for (int k = 0; k < 4; k++) {
+				const int ny = y + forwardRows[k][0];
+				const int nz = z + forwardRows[k][1];
+				if (ny < 0 || ny >= dims[1] || nz >= dims[2]) {
+					continue;
+				}
+				const int nrow = dims[0] * (ny + dims[1] * nz);
+				const int spanBegin = cellStart[nrow + x0];
+				const int spanEnd = cellStart[nrow + x1 + 1];
+				for (int ia = begin; ia < end; ia++) {
+					addPairs(ia, spanBegin, spanEnd, pairs);
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,85 @@
+#ifndef GRID_H
+#define GRID_H
+
+#include "broadphase.h"
+
+#include <vector>
+
+class ThreadPool;
+
+// Uniform grid over the room for finding balls that may touch.
+// Balls are binned by a counting sort on their cell index, so a rebuild is
+// O(n + cells) and only allocates when the world or the room grows.
+// Cells are at least as wide as the diameter of the biggest ball, wider
+// when there are few balls for the room, so a ball can only touch balls in
+// its own cell or the 26 around it. Anything outside the room (e.g. high
+// above the ground) is clamped into the border cells.
+class UniformGrid : public Broadphase
+{
+public:
+	UniformGrid();
+
+	void build(const BallWorld& world);
+	void build(const BallWorld& world, const std::vector<int>& balls);
+	void findPairs(std::vector<BallPair>& pairs) const;
+
+	// Same as build(), binning the balls on the threads of pool
+	void build(const BallWorld& world, ThreadPool& pool);
+
+	// Replaces the contents of balls with the awake balls and the sleeping
+	// ones in the cell of an awake ball or a cell next to it, in index
+	// order. A sleeping ball costs a cell lookup here, but far from the awake
+	// balls it is not binned or tested against its neighbours.
+	void findNearAwake(const BallWorld& world, std::vector<int>& balls);
+
+	// Appends the pairs found from the cells of rows [rowBegin, rowEnd),
+	// a row being the cells along x at one y and z. Rows only look forward,
+	// so running all rows in order gives the same pairs as findPairs().
+	void findPairsInRows(int rowBegin, int rowEnd, std::vector<BallPair>& pairs) const;
+
+	int cellCount() const { return dims[0] * dims[1] * dims[2]; }
+	int rowCount() const { return dims[1] * dims[2]; }
+	int cellOfBall(int i) const { return ballCell[i]; }
+
+	// The cell of a point, clamped into the grid like the balls are
+	int cellOf(float x, float y, float z) const;
+	int cellAt(int x, int y, int z) const { return x + dims[0] * (y + dims[1] * z); }
+
+	// The first and last cell along each axis of the cells a box from lo
+	// to hi overlaps, so a point in the box is in one of them
+	void cellsOfBox(const float lo[3], const float hi[3], int first[3], int last[3]) const;
+
+	// The balls binned in cell c by the last build(), ballInCell(c, 0) up to
+	// ballInCell(c, ballsInCell(c) - 1)
+	int ballsInCell(int c) const { return cellStart[c + 1] - cellStart[c]; }
+	int ballInCell(int c, int k) const { return cellBalls[cellStart[c] + k]; }
+
+	// Pairs are found from the lower of the two cells, which is next to the
+	// other one. Cells of the same colour are at least 3 cells apart along
+	// some axis, so pairs found from different cells of one colour never
+	// share a ball and can be resolved at the same time.
+	static const int colourCount = 27;
+	int colourOf(int cell) const;
+
+private:
+	int cellAlong(int k, float p) const;
+	void setup(const BallWorld& world);
+	void sort(const BallWorld& world, const int* balls, int count);
+	void addPairs(int ia, int begin, int end, std::vector<BallPair>& pairs) const;
+
+	float origin[3];
+	float invCellSize;
+	int dims[3];
+
+	std::vector<int> ballCell;  // cell of every ball binned
+	std::vector<int> cellStart; // balls of cell c are cellBalls[cellStart[c] .. cellStart[c + 1])
+	std::vector<int> cellFill;
+	std::vector<int> cellBalls;
+	std::vector<unsigned char> nearAwake; // by cell, an awake ball is in it or next to it
+
+	// Positions and sizes copied in cellBalls order, so that testing
+	// neighbouring cells reads memory in order instead of jumping around
+	std::vector<float> sortedX, sortedY, sortedZ, sortedRadius;
+};
+
+#endif // GRID_H
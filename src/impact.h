@@ -0,0 +1,71 @@
+#ifndef IMPACT_H
+#define IMPACT_H
+
+// Times of impact of a ball flying along a parabola, used by the continuous
+// and the event driven simulations. All return the first time in [0, tMax]
+// at which the ball gets there, or -1 if it does not in time.
+
+#include <cmath>
+
+// Comes down by h >= 0 going up at vy with acceleration g <= 0
+template <typename T>
+T
+timeToFall(T h, T vy, T g, T tMax)
+{
+	T t;
+	if (g < T(0)) {
+		t = (vy + std::sqrt(vy * vy - T(2) * g * h)) / -g; // later root of h + vy t + g t^2 / 2 = 0
+	}
+	else if (vy < T(0)) {
+		t = h / -vy;
+	}
+	else {
+		return T(-1);
+	}
+	return t <= tMax ? t : T(-1);
+}
+
+// Rises by h >= 0, same ball
+template <typename T>
+T
+timeToRise(T h, T vy, T g, T tMax)
+{
+	if (vy <= T(0)) {
+		return T(-1);
+	}
+	T t;
+	if (g < T(0)) {
+		T d = vy * vy + T(2) * g * h;
+		if (d < T(0)) {
+			return T(-1); // turns before getting there
+		}
+		t = (vy - std::sqrt(d)) / -g; // earlier root of -h + vy t + g t^2 / 2 = 0
+	}
+	else {
+		t = h / vy;
+	}
+	return t <= tMax ? t : T(-1);
+}
+
+// Reaches lo or hi from p moving at a constant v
+template <typename T>
+T
+timeToWall(T p, T v, T lo, T hi, T tMax)
+{
+	T t;
+	if (v > T(0)) {
+		t = (hi - p) / v;
+	}
+	else if (v < T(0)) {
+		t = (lo - p) / v;
+	}
+	else {
+		return T(-1);
+	}
+	return t <= tMax ? t : T(-1);
+}
+
+// Planes a ball can hit
+enum { hitNothing, hitGroundPlane, hitCeilingPlane, hitXPlane, hitZPlane };
+
+#endif // IMPACT_H
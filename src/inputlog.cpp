@@ -0,0 +1,261 @@
+#include "inputlog.h"
+
+#include <cstdio>
+#include <cstring>
+
+static const char MAGIC[4] = { 'B', 'L', 'O', 'G' };
+static const unsigned VERSION = 1;
+
+InputLog::InputLog()
+	: constants(defaultConstants()), steps(0)
+{
+	start = end = startState(constants);
+}
+
+void
+InputLog::begin(const GameConstants& c, const GameState& s)
+{
+	constants = c;
+	start = end = s;
+	steps = 0;
+	events.clear();
+}
+
+void
+InputLog::record(unsigned step, unsigned char key)
+{
+	Event e = { step, key };
+	events.push_back(e);
+}
+
+void
+InputLog::finish(unsigned step, const GameState& s)
+{
+	steps = step;
+	end = s;
+}
+
+//----------------------------------------------------------------------------
+
+// Fixed size little endian fields, so a log reads back the same on any machine
+static void
+putU32(std::vector<unsigned char>& out, unsigned v)
+{
+	for (int i = 0; i < 4; i++) {
+		out.push_back((unsigned char)(v >> (8 * i)));
+	}
+}
+
+static void
+putF32(std::vector<unsigned char>& out, float f)
+{
+	unsigned v;
+	std::memcpy(&v, &f, 4);
+	putU32(out, v);
+}
+
+static void
+putVarint(std::vector<unsigned char>& out, unsigned v)
+{
+	while (v >= 0x80) {
+		out.push_back((unsigned char)(v | 0x80));
+		v >>= 7;
+	}
+	out.push_back((unsigned char)v);
+}
+
+static void
+putState(std::vector<unsigned char>& out, const GameState& s)
+{
+	const float* f[9] = { &s.position.x, &s.position.y, &s.position.z,
+		&s.velocity.x, &s.velocity.y, &s.velocity.z, &s.theta[0], &s.theta[1], &s.theta[2] };
+	for (int i = 0; i < 9; i++) {
+		putF32(out, *f[i]);
+	}
+	out.push_back(s.rest);
+	out.push_back(s.pause);
+	out.push_back(s.clockwise);
+	out.push_back((unsigned char)s.view);
+}
+
+// Reads fields back, remembers if it ran past the end
+class Reader
+{
+public:
+	Reader(const std::vector<unsigned char>& data) : data(data), at(0), failed(false) {}
+
+	bool ok() const { return !failed; }
+
+	unsigned char
+	u8()
+	{
+		if (at >= data.size()) {
+			failed = true;
+			return 0;
+		}
+		return data[at++];
+	}
+
+	unsigned
+	u32()
+	{
+		unsigned v = 0;
+		for (int i = 0; i < 4; i++) {
+			v |= unsigned(u8()) << (8 * i);
+		}
+		return v;
+	}
+
+	float
+	f32()
+	{
+		unsigned v = u32();
+		float f;
+		std::memcpy(&f, &v, 4);
+		return f;
+	}
+
+	unsigned
+	varint()
+	{
+		unsigned v = 0;
+		for (int shift = 0; shift < 35; shift += 7) {
+			unsigned char b = u8();
+			v |= unsigned(b & 0x7f) << shift;
+			if (!(b & 0x80)) {
+				return v;
+			}
+		}
+		failed = true;
+		return 0;
+	}
+
+	void
+	state(GameState& s)
+	{
+		float* f[9] = { &s.position.x, &s.position.y, &s.position.z,
+			&s.velocity.x, &s.velocity.y, &s.velocity.z, &s.theta[0], &s.theta[1], &s.theta[2] };
+		for (int i = 0; i < 9; i++) {
+			*f[i] = f32();
+		}
+		s.rest = u8() != 0;
+		s.pause = u8() != 0;
+		s.clockwise = u8() != 0;
+		s.view = u8();
+	}
+
+private:
+	const std::vector<unsigned char>& data;
+	size_t at;
+	bool failed;
+};
+
+bool
+InputLog::save(const std::string& path) const
+{
+	std::vector<unsigned char> out(MAGIC, MAGIC + 4);
+	putU32(out, VERSION);
+
+	const GameConstants& c = constants;
+	const float fields[13] = { c.gravity, c.impulse, c.radius, c.spin, c.start.x, c.start.y, c.start.z,
+		c.room.ground, c.room.walls[0], c.room.walls[1], c.room.walls[2], c.room.walls[3], c.room.ceiling };
+	for (int i = 0; i < 13; i++) {
+		putF32(out, fields[i]);
+	}
+	putState(out, start);
+	putState(out, end);
+
+	putU32(out, steps);
+	putU32(out, unsigned(events.size()));
+	unsigned last = 0;
+	for (size_t i = 0; i < events.size(); i++) {
+		putVarint(out, events[i].step - last);
+		out.push_back(events[i].key);
+		last = events[i].step;
+	}
+
+	FILE* fp = fopen(path.c_str(), "wb");
+	if (!fp) {
+		return false;
+	}
+	bool written = fwrite(out.data(), 1, out.size(), fp) == out.size();
+	return fclose(fp) == 0 && written;
+}
+
+bool
+InputLog::load(const std::string& path)
+{
+	FILE* fp = fopen(path.c_str(), "rb");
+	if (!fp) {
+		return false;
+	}
+	std::vector<unsigned char> data;
+	unsigned char buffer[4096];
+	size_t got;
+	while ((got = fread(buffer, 1, sizeof(buffer), fp)) > 0) {
+		data.insert(data.end(), buffer, buffer + got);
+	}
+	fclose(fp);
+
+	if (data.size() < 8 || std::memcmp(data.data(), MAGIC, 4) != 0) {
+		return false;
+	}
+	Reader in(data);
+	for (int i = 0; i < 4; i++) {
+		in.u8();
+	}
+	if (in.u32() != VERSION) {
+		return false;
+	}
+
+	GameConstants c;
+	float* fields[13] = { &c.gravity, &c.impulse, &c.radius, &c.spin, &c.start.x, &c.start.y, &c.start.z,
+		&c.room.ground, &c.room.walls[0], &c.room.walls[1], &c.room.walls[2], &c.room.walls[3], &c.room.ceiling };
+	for (int i = 0; i < 13; i++) {
+		*fields[i] = in.f32();
+	}
+	GameState first, last;
+	in.state(first);
+	in.state(last);
+
+	const unsigned stepCount = in.u32();
+	const unsigned count = in.u32();
+	std::vector<Event> read;
+	unsigned step = 0;
+	for (unsigned i = 0; i < count && in.ok(); i++) {
+		step += in.varint();
+		Event e = { step, in.u8() };
+		read.push_back(e);
+	}
+	if (!in.ok()) {
+		return false;
+	}
+
+	constants = c;
+	start = first;
+	end = last;
+	steps = stepCount;
+	events.swap(read);
+	return true;
+}
+
+//----------------------------------------------------------------------------
+
+GameState
+replay(const InputLog& log)
+{
+	GameState s = log.start;
+	size_t next = 0;
+	const size_t count = log.events.size();
+
+	for (unsigned step = 0; step < log.steps; step++) {
+		while (next < count && log.events[next].step == step) {
+			gameKey(s, log.constants, log.events[next++].key);
+		}
+		stepGame(s, log.constants);
+	}
+	while (next < count) {
+		gameKey(s, log.constants, log.events[next++].key);
+	}
+	return s;
+}
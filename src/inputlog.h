@@ -0,0 +1,55 @@
+#ifndef INPUTLOG_H
+#define INPUTLOG_H
+
+#include "game.h"
+
+#include <string>
+#include <vector>
+
+// A recorded game: the constants and the state it started from, every key
+// that changed the state with the step it came before, and the state it
+// ended in. Replaying the keys at the same steps gives the same end state
+// to the bit, since a step only depends on the state and the constants.
+//
+// File layout, little endian:
+//   "BLOG", u32 version
+//   GameConstants as 13 f32: gravity impulse radius spin start.xyz
+//                            ground walls[4] ceiling
+//   start and end GameState as 9 f32 position.xyz velocity.xyz theta[3]
+//                            and 4 u8 rest pause clockwise view
+//   u32 steps, u32 events
+//   events: step difference to the previous event as a varint, then the key
+class InputLog
+{
+public:
+	struct Event
+	{
+		unsigned step;
+		unsigned char key;
+	};
+
+	GameConstants constants;
+	GameState start;
+	GameState end;
+	unsigned steps; // steps from start to end
+	std::vector<Event> events;
+
+	InputLog();
+
+	// Start a new recording from this state
+	void begin(const GameConstants& c, const GameState& s);
+
+	// Key pressed after the given number of steps
+	void record(unsigned step, unsigned char key);
+
+	// End of the recording
+	void finish(unsigned step, const GameState& s);
+
+	bool save(const std::string& path) const;
+	bool load(const std::string& path); // false if missing, not a log or a version we cannot read
+};
+
+// Run a log from its start state, with no rendering. Returns the end state.
+GameState replay(const InputLog& log);
+
+#endif // INPUTLOG_H
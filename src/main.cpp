@@ -96,10 +96,30 @@ InitShader(const char* vShaderFile, const char* fShaderFile)
    return program;
 }
 
+// Physics runs in fixed PHYSICS_STEP_MS steps no matter how late a frame is,
+// the leftover time is passed on to display() as an interpolation factor
+static int    previousTime = 0;
+static double accumulator = 0.0;
+
+// Don't try to catch up on more than this, e.g. after the window was dragged
+const double MAX_FRAME_TIME_MS = 250.0;
+
 void
 timer(int unused)
 {
-   update();
+   int currentTime = glutGet( GLUT_ELAPSED_TIME );
+   double frameTime = currentTime - previousTime;
+   previousTime = currentTime;
+
+   if ( frameTime > MAX_FRAME_TIME_MS ) { frameTime = MAX_FRAME_TIME_MS; }
+   accumulator += frameTime;
+
+   while ( accumulator >= PHYSICS_STEP_MS ) {
+      update();
+      accumulator -= PHYSICS_STEP_MS;
+   }
+   interpolate( accumulator / PHYSICS_STEP_MS );
+
    glutPostRedisplay();
    glutTimerFunc( FRAME_RATE_MS, timer, 0 );
 }
@@ -108,6 +128,7 @@ int
 main( int argc, char **argv )
 {
    glutInit( &argc, argv );
+   setOptions( argc, argv );
    glutInitDisplayMode( GLUT_RGBA | GLUT_DOUBLE | GLUT_DEPTH );
    glutInitWindowSize( 712, 712 );
    glutInitContextVersion( 3, 2 );
@@ -122,6 +143,7 @@ main( int argc, char **argv )
    glutKeyboardFunc( keyboard );
    glutMouseFunc( mouse );
    glutReshapeFunc( reshape );
+   previousTime = glutGet( GLUT_ELAPSED_TIME );
    glutTimerFunc( FRAME_RATE_MS, timer, 0 );
    
    glutMainLoop();
@@ -0,0 +1,13 @@
+#include "meshes.h"
+
+void
+sphereLods(MeshView* lods)
+{
+	lods[0] = MeshTables<BallLod0>::view();
+	lods[1] = MeshTables<BallLod1>::view();
+	lods[2] = MeshTables<BallLod2>::view();
+	lods[3] = MeshTables<BallLod3>::view();
+	lods[4] = MeshTables<BallLod4>::view();
+	lods[5] = MeshTables<BallLod5>::view();
+	lods[6] = MeshTables<BallLod6>::view();
+}
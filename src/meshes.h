@@ -0,0 +1,338 @@
+#ifndef MESHES_H
+#define MESHES_H
+
+// The meshes of the window as tables the compiler works out, so they sit in
+// read-only data and go to the GPU from there: nothing is built, and no sin
+// or cos runs, at startup. Every mesh is a template on its tessellation with
+// constexpr functions giving float k of its positions (x, y, z, w per vertex)
+// and normals (x, y, z), and index k of its triangles. MeshTables expands
+// them into arrays, and into the interleaved PackedVertex the window draws.
+// Plain C++11 and no GL, so the benchmarks can use it.
+
+// 0, 1, ..., N - 1 as a pack. Built by halves, so a table of thousands of
+// floats stays far from the compilers' limits on template depth.
+template <int... I>
+struct IndexList {};
+
+template <class A, class B>
+struct JoinIndices;
+
+template <int... A, int... B>
+struct JoinIndices<IndexList<A...>, IndexList<B...> >
+{
+	typedef IndexList<A..., int(sizeof...(A)) + B...> type;
+};
+
+template <int N>
+struct MakeIndices
+{
+	typedef typename JoinIndices<typename MakeIndices<N / 2>::type,
+		typename MakeIndices<N - N / 2>::type>::type type;
+};
+
+template <> struct MakeIndices<0> { typedef IndexList<> type; };
+template <> struct MakeIndices<1> { typedef IndexList<0> type; };
+
+// sin and cos as sums of their series, which is exact to a float for the
+// angles of a circle, as std::sin is not constexpr
+constexpr double MESH_PI = 3.14159265358979323846;
+
+constexpr double
+sinSeries(double x2, double term, double sum, int k)
+{
+	return k == 14 ? sum : sinSeries(x2, -term * x2 / ((2 * k + 2) * (2 * k + 3)), sum + term, k + 1);
+}
+
+constexpr double
+meshSin(double x)
+{
+	return x > MESH_PI ? meshSin(x - 2 * MESH_PI) : sinSeries(x * x, x, 0.0, 0);
+}
+
+constexpr double
+meshCos(double x)
+{
+	return meshSin(x + MESH_PI / 2);
+}
+
+// sin and cos of Count angles n / Divisions of HalfTurns half turns. The
+// sphere looks them up, which the compiler works out much faster than the
+// series for every coordinate.
+template <int Count, int Divisions, int HalfTurns, class N = typename MakeIndices<Count>::type>
+struct AngleTable;
+
+template <int Count, int Divisions, int HalfTurns, int... N>
+struct AngleTable<Count, Divisions, HalfTurns, IndexList<N...> >
+{
+	static constexpr double sine[sizeof...(N)] = { meshSin(double(N) / Divisions * HalfTurns * MESH_PI)... };
+	static constexpr double cosine[sizeof...(N)] = { meshCos(double(N) / Divisions * HalfTurns * MESH_PI)... };
+};
+
+template <int Count, int Divisions, int HalfTurns, int... N>
+constexpr double AngleTable<Count, Divisions, HalfTurns, IndexList<N...> >::sine[sizeof...(N)];
+template <int Count, int Divisions, int HalfTurns, int... N>
+constexpr double AngleTable<Count, Divisions, HalfTurns, IndexList<N...> >::cosine[sizeof...(N)];
+
+// Two triangles for square q of a grid of rows of width points, from the
+// vertex at its corner. The order run.cpp has always used.
+constexpr unsigned
+gridIndex(int k, int width)
+{
+	return unsigned((k / 6) / (width - 1) * width + (k / 6) % (width - 1)
+		+ (k % 6 == 1 || k % 6 == 5 ? width + 1 : k % 6 == 2 ? 1 : k % 6 == 4 ? width : 0));
+}
+
+// The ground and the far wall, 4 units wide with the checkers of 4/31 that
+// the window has always had. A grid of Points x Points vertices over 30 of
+// them from the corner, so PlaneMesh<2> is one quad for checkers drawn by the
+// fragment shader and PlaneMesh<31> has a vertex at every corner of a square.
+// The ground lies in x, y and is turned into place by its view matrix, the
+// wall lies in x, z at y = 2.
+constexpr float PLANE_LENGTH = 4.0f;
+constexpr float PLANE_STEP = PLANE_LENGTH / 31;
+constexpr float PLANE_X = -PLANE_LENGTH / 2 + PLANE_STEP / 2;
+constexpr float GROUND_Y = -2.0f + PLANE_STEP;
+constexpr float WALL_Y = 2.0f;
+constexpr float WALL_Z = 0.0f;
+
+enum PlaneType { GroundPlane, WallPlane };
+
+template <int Points, PlaneType Plane>
+struct PlaneMesh
+{
+	enum { vertexCount = Points * Points, indexCount = 6 * (Points - 1) * (Points - 1) };
+
+	static constexpr float step() { return 30 * PLANE_STEP / (Points - 1); }
+
+	static constexpr float
+	position(int k)
+	{
+		return k % 4 == 3 ? 1.0f
+			: k % 4 == 0 ? PLANE_X + (k / 4) % Points * step()
+			: Plane == GroundPlane ? (k % 4 == 1 ? GROUND_Y + (k / 4) / Points * step() : 0.0f)
+			: (k % 4 == 1 ? WALL_Y : WALL_Z + (k / 4) / Points * step());
+	}
+
+	static constexpr float
+	normal(int k)
+	{
+		return Plane == GroundPlane ? (k % 3 == 1 ? -1.0f : 0.0f) : (k % 3 == 2 ? 1.0f : 0.0f);
+	}
+
+	static constexpr unsigned index(int k) { return gridIndex(k, Points); }
+};
+
+// The UV sphere of radius 1, scaled to the ball by the vertex shader.
+// CirclePoints + 1 arcs from pole to pole (the last on top of the first) of
+// ArcPoints each.
+template <int CirclePoints, int ArcPoints>
+struct SphereMesh
+{
+	enum { vertexCount = (CirclePoints + 1) * ArcPoints, indexCount = 6 * CirclePoints * (ArcPoints - 1) };
+
+	// Around the circle, and from the pole along an arc
+	typedef AngleTable<CirclePoints + 1, CirclePoints, 2> Phi;
+	typedef AngleTable<ArcPoints, ArcPoints - 1, 1> Theta;
+
+	static constexpr float
+	normal(int k)
+	{
+		return float(k % 3 == 0 ? Theta::sine[k / 3 % ArcPoints] * Phi::cosine[k / 3 / ArcPoints]
+			: k % 3 == 1 ? Theta::sine[k / 3 % ArcPoints] * Phi::sine[k / 3 / ArcPoints]
+			: Theta::cosine[k / 3 % ArcPoints]);
+	}
+
+	static constexpr float position(int k) { return k % 4 == 3 ? 1.0f : normal(k / 4 * 3 + k % 4); }
+
+	static constexpr unsigned index(int k) { return gridIndex(k, ArcPoints); }
+
+	// How far inside the sphere the middle of its longest facet edges are,
+	// over half the angle between the points around or along an arc
+	static constexpr double
+	sagitta()
+	{
+		return 1.0 - meshCos(MESH_PI / (CirclePoints < 2 * (ArcPoints - 1) ? CirclePoints : 2 * (ArcPoints - 1)));
+	}
+};
+
+// The shadow of the ball, a disc of radius 1 facing the wall or the ground:
+// the centre, then Points + 1 points around (the last on top of the first).
+// The triangles fan out from the first point around, as they always have.
+template <int Points, PlaneType Plane>
+struct DiscMesh
+{
+	enum { vertexCount = Points + 2, indexCount = 3 * Points };
+
+	static constexpr double phi(int v) { return double(v - 1) / Points * 2 * MESH_PI; }
+
+	static constexpr float
+	position(int k)
+	{
+		return k % 4 == 3 ? 1.0f
+			: k < 4 ? 0.0f
+			: k % 4 == 0 ? float(meshCos(phi(k / 4)))
+			: (k % 4 == 1) == (Plane == WallPlane) ? float(meshSin(phi(k / 4)))
+			: 0.0f;
+	}
+
+	static constexpr float
+	normal(int k)
+	{
+		return Plane == GroundPlane ? (k % 3 == 1 ? 1.0f : 0.0f) : (k % 3 == 2 ? 1.0f : 0.0f);
+	}
+
+	static constexpr unsigned index(int k) { return unsigned(k % 3 == 0 ? 1 : 1 + k / 3 + (k % 3 == 2)); }
+};
+
+// A vertex as the window uploads it, interleaved in 16 bytes: the position,
+// and the normal as signed normalized 10 bit x, y, z in one word
+// (GL_INT_2_10_10_10_REV, x in the low bits). Its 2 bit w is 1 on the odd
+// vertices of the table, which the shader colours as the other checker, so
+// the vertices can be reordered without losing the pattern.
+struct PackedNormal
+{
+	unsigned bits;
+};
+
+struct PackedVertex
+{
+	float position[3];
+	PackedNormal normal;
+};
+
+static_assert(sizeof(PackedVertex) == 16, "PackedVertex must fill 16 bytes");
+
+constexpr unsigned
+packSnorm10(float v)
+{
+	return unsigned(int(v * 511.0f + (v < 0.0f ? -0.5f : 0.5f))) & 0x3FFu;
+}
+
+constexpr PackedNormal
+packNormal(float x, float y, float z, bool odd)
+{
+	return PackedNormal{ packSnorm10(x) | packSnorm10(y) << 10 | packSnorm10(z) << 20 | unsigned(odd) << 30 };
+}
+
+template <class Mesh>
+constexpr PackedVertex
+packedVertex(int v)
+{
+	return PackedVertex{ { Mesh::position(4 * v), Mesh::position(4 * v + 1), Mesh::position(4 * v + 2) },
+		packNormal(Mesh::normal(3 * v), Mesh::normal(3 * v + 1), Mesh::normal(3 * v + 2), v % 2 == 1) };
+}
+
+// A mesh as the arrays it was expanded into
+struct MeshView
+{
+	const float* positions; // 4 per vertex
+	const float* normals;   // 3 per vertex
+	const PackedVertex* vertices;
+	int vertexCount;
+	const unsigned* indices;
+	int indexCount;
+};
+
+template <class Mesh,
+	class P = typename MakeIndices<4 * Mesh::vertexCount>::type,
+	class N = typename MakeIndices<3 * Mesh::vertexCount>::type,
+	class I = typename MakeIndices<Mesh::indexCount>::type,
+	class V = typename MakeIndices<Mesh::vertexCount>::type>
+struct MeshTables;
+
+template <class Mesh, int... P, int... N, int... I, int... V>
+struct MeshTables<Mesh, IndexList<P...>, IndexList<N...>, IndexList<I...>, IndexList<V...> >
+{
+	static constexpr float positions[sizeof...(P)] = { Mesh::position(P)... };
+	static constexpr float normals[sizeof...(N)] = { Mesh::normal(N)... };
+	static constexpr unsigned indices[sizeof...(I)] = { Mesh::index(I)... };
+	static constexpr PackedVertex vertices[sizeof...(V)] = { packedVertex<Mesh>(V)... };
+
+	static MeshView
+	view()
+	{
+		MeshView v = { positions, normals, vertices, Mesh::vertexCount, indices, Mesh::indexCount };
+		return v;
+	}
+};
+
+template <class Mesh, int... P, int... N, int... I, int... V>
+constexpr float MeshTables<Mesh, IndexList<P...>, IndexList<N...>, IndexList<I...>, IndexList<V...> >::positions[sizeof...(P)];
+template <class Mesh, int... P, int... N, int... I, int... V>
+constexpr float MeshTables<Mesh, IndexList<P...>, IndexList<N...>, IndexList<I...>, IndexList<V...> >::normals[sizeof...(N)];
+template <class Mesh, int... P, int... N, int... I, int... V>
+constexpr unsigned MeshTables<Mesh, IndexList<P...>, IndexList<N...>, IndexList<I...>, IndexList<V...> >::indices[sizeof...(I)];
+template <class Mesh, int... P, int... N, int... I, int... V>
+constexpr PackedVertex MeshTables<Mesh, IndexList<P...>, IndexList<N...>, IndexList<I...>, IndexList<V...> >::vertices[sizeof...(V)];
+
+// The meshes of the window
+typedef PlaneMesh<2, GroundPlane> GroundQuad;
+typedef PlaneMesh<2, WallPlane> WallQuad;
+typedef PlaneMesh<31, GroundPlane> GroundGrid;
+typedef PlaneMesh<31, WallPlane> WallGrid;
+typedef SphereMesh<22, 15> BallMesh;
+
+// The ball at growing detail, from 48 to 5120 triangles, to draw it by its
+// size on the screen. Its checkers are worked out by the fragment shader,
+// the same 22 tiles around and 14 from pole to pole at every level.
+typedef SphereMesh<6, 5> BallLod0;
+typedef SphereMesh<10, 7> BallLod1;
+typedef SphereMesh<14, 9> BallLod2;
+typedef BallMesh BallLod3;
+typedef SphereMesh<32, 21> BallLod4;
+typedef SphereMesh<44, 29> BallLod5;
+typedef SphereMesh<64, 41> BallLod6;
+
+const int BALL_TILES_AROUND = 22;
+const int BALL_TILES_DOWN = 14;
+
+const int SPHERE_LODS = 7;
+
+// The tables of the levels of the ball, coarsest first. In meshes.cpp, so
+// they are worked out by the compiler there only.
+void sphereLods(MeshView* lods);
+
+// The sagitta of every level, which needs none of the tables
+constexpr float SPHERE_LOD_SAGITTA[SPHERE_LODS] = {
+	float(BallLod0::sagitta()), float(BallLod1::sagitta()), float(BallLod2::sagitta()), float(BallLod3::sagitta()),
+	float(BallLod4::sagitta()), float(BallLod5::sagitta()), float(BallLod6::sagitta()),
+};
+
+// The coarsest of the levels with these sagitta whose silhouette is within
+// tolerance pixels of a sphere of radius pixels on the screen, or the
+// finest if none is
+const float SPHERE_LOD_TOLERANCE = 0.5f;
+
+inline int
+selectSphereLod(const float* sagitta, int count, float radius, float tolerance)
+{
+	for (int k = 0; k < count; k++) {
+		if (sagitta[k] * radius <= tolerance) {
+			return k;
+		}
+	}
+	return count - 1;
+}
+typedef DiscMesh<22, GroundPlane> GroundShadowMesh;
+typedef DiscMesh<22, WallPlane> WallShadowMesh;
+
+// The meshes of the window as the passes of meshopt.h leave them, kept in
+// bakedmeshes.h, which meshstats writes. The window uploads them from
+// there as they are, so it runs none of the passes.
+enum BakedMeshId
+{
+	BakedGroundQuad, BakedWallQuad, BakedGroundGrid, BakedWallGrid,
+	BakedGroundShadow, BakedWallShadow,
+	BakedBallLods, // SPHERE_LODS of them, coarsest first
+	BAKED_MESHES = BakedBallLods + SPHERE_LODS
+};
+
+// Where a baked mesh is in bakedVertices and bakedIndices. Its 16 bit
+// indices count from its first vertex.
+struct BakedMesh
+{
+	int firstVertex, vertexCount;
+	int firstIndex, indexCount;
+};
+
+#endif // MESHES_H
@@ -0,0 +1,305 @@
+#include "meshopt.h"
+
+#include <glm/glm.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+//----------------------------------------------------------------------------
+
+// Misses of a FIFO cache on every triangle. A vertex is in the cache if
+// fewer than cacheSize misses came after its own.
+static int
+cacheMisses(const unsigned* indices, int indexCount, int vertexCount, int cacheSize, int* triangleMisses)
+{
+	std::vector<int> missedAt(vertexCount, -cacheSize - 1);
+	int misses = 0;
+	for (int i = 0; i < indexCount; i += 3) {
+		int triangle = 0;
+		for (int k = 0; k < 3; k++) {
+			const unsigned v = indices[i + k];
+			if (misses - missedAt[v] > cacheSize) {
+				missedAt[v] = misses++;
+				triangle++;
+			}
+		}
+		if (triangleMisses) {
+			triangleMisses[i / 3] = triangle;
+		}
+	}
+	return misses;
+}
+
+VertexCacheStats
+analyzeVertexCache(const unsigned* indices, int indexCount, int vertexCount, int cacheSize)
+{
+	std::vector<char> used(vertexCount, 0);
+	int usedCount = 0;
+	for (int i = 0; i < indexCount; i++) {
+		usedCount += !used[indices[i]];
+		used[indices[i]] = 1;
+	}
+	const int misses = cacheMisses(indices, indexCount, vertexCount, cacheSize, NULL);
+	VertexCacheStats stats = { 0.0, 0.0 };
+	if (indexCount > 0) {
+		stats.acmr = double(misses) / (indexCount / 3);
+		stats.atvr = double(misses) / usedCount;
+	}
+	return stats;
+}
+
+//----------------------------------------------------------------------------
+
+// The score of a vertex in Forsyth's method, from where it is in the cache
+// (-1 if it is not) and how many of its triangles are left to draw. The
+// three of the last triangle all get the same score, so its neighbours are
+// not favoured by the order of its vertices. Both parts come from tables.
+const int VALENCE_SCORES = 32;
+
+struct ForsythScores
+{
+	float cache[MESH_CACHE_SIZE];
+	float valence[VALENCE_SCORES];
+
+	ForsythScores()
+	{
+		for (int p = 0; p < MESH_CACHE_SIZE; p++) {
+			cache[p] = p < 3 ? 0.75f : std::pow(1.0f - float(p - 3) / (MESH_CACHE_SIZE - 3), 1.5f);
+		}
+		for (int r = 1; r < VALENCE_SCORES; r++) {
+			valence[r] = 2.0f / std::sqrt(float(r));
+		}
+		valence[0] = -1.0f;
+	}
+};
+
+static float
+forsythScore(int cachePosition, int remaining)
+{
+	static const ForsythScores scores;
+	if (remaining == 0) {
+		return -1.0f;
+	}
+	return (cachePosition >= 0 ? scores.cache[cachePosition] : 0.0f)
+		+ (remaining < VALENCE_SCORES ? scores.valence[remaining] : 2.0f / std::sqrt(float(remaining)));
+}
+
+void
+optimizeVertexCache(unsigned* indices, int indexCount, int vertexCount)
+{
+	const int triangleCount = indexCount / 3;
+	if (triangleCount == 0) {
+		return;
+	}
+
+	// The triangles of vertex v not drawn yet are the first remaining[v]
+	// of triangles[first[v]...]
+	std::vector<int> first(vertexCount + 1, 0), remaining(vertexCount, 0);
+	for (int i = 0; i < indexCount; i++) {
+		remaining[indices[i]]++;
+	}
+	for (int v = 0; v < vertexCount; v++) {
+		first[v + 1] = first[v] + remaining[v];
+	}
+	std::vector<int> triangles(indexCount), filled(first.begin(), first.end() - 1);
+	for (int i = 0; i < indexCount; i++) {
+		triangles[filled[indices[i]]++] = i / 3;
+	}
+
+	std::vector<int> cachePosition(vertexCount, -1);
+	std::vector<float> vertexScore(vertexCount), triangleScore(triangleCount, 0.0f);
+	for (int v = 0; v < vertexCount; v++) {
+		vertexScore[v] = forsythScore(-1, remaining[v]);
+	}
+	for (int i = 0; i < indexCount; i++) {
+		triangleScore[i / 3] += vertexScore[indices[i]];
+	}
+
+	std::vector<char> drawn(triangleCount, 0);
+	std::vector<unsigned> order;
+	order.reserve(indexCount);
+	std::vector<int> cache, next;
+	int best = int(std::max_element(triangleScore.begin(), triangleScore.end()) - triangleScore.begin());
+	int unvisited = 0;
+
+	while (best >= 0) {
+		drawn[best] = 1;
+		const unsigned* corner = indices + 3 * best;
+		order.insert(order.end(), corner, corner + 3);
+		for (int k = 0; k < 3; k++) {
+			const unsigned v = corner[k];
+			int* live = &triangles[first[v]];
+			*std::find(live, live + remaining[v], best) = live[remaining[v] - 1];
+			remaining[v]--;
+		}
+
+		// The vertices of the triangle go to the front of the cache, and the
+		// ones pushed past the end drop out of it
+		next.assign(corner, corner + 3);
+		for (size_t c = 0; c < cache.size(); c++) {
+			if (cache[c] != int(corner[0]) && cache[c] != int(corner[1]) && cache[c] != int(corner[2])) {
+				next.push_back(cache[c]);
+			}
+		}
+		for (size_t c = 0; c < next.size(); c++) {
+			const int v = next[c];
+			cachePosition[v] = c < size_t(MESH_CACHE_SIZE) ? int(c) : -1;
+			const float score = forsythScore(cachePosition[v], remaining[v]);
+			const float change = score - vertexScore[v];
+			vertexScore[v] = score;
+			for (int t = 0; t < remaining[v]; t++) {
+				triangleScore[triangles[first[v] + t]] += change;
+			}
+		}
+		next.resize(std::min(next.size(), size_t(MESH_CACHE_SIZE)));
+		cache.swap(next);
+
+		// The best triangle with a vertex in the cache, else the first one
+		// left in the original order
+		best = -1;
+		float bestScore = -1.0f;
+		for (size_t c = 0; c < cache.size(); c++) {
+			const int v = cache[c];
+			for (int t = 0; t < remaining[v]; t++) {
+				const int triangle = triangles[first[v] + t];
+				if (triangleScore[triangle] > bestScore) {
+					best = triangle;
+					bestScore = triangleScore[triangle];
+				}
+			}
+		}
+		if (best < 0) {
+			while (unvisited < triangleCount && drawn[unvisited]) {
+				unvisited++;
+			}
+			best = unvisited < triangleCount ? unvisited : -1;
+		}
+	}
+
+	if (cacheMisses(order.data(), indexCount, vertexCount, MESH_CACHE_SIZE, NULL)
+		< cacheMisses(indices, indexCount, vertexCount, MESH_CACHE_SIZE, NULL)) {
+		std::copy(order.begin(), order.end(), indices);
+	}
+}
+
+//----------------------------------------------------------------------------
+
+static glm::vec3
+positionOf(const PackedVertex& v)
+{
+	return glm::vec3(v.position[0], v.position[1], v.position[2]);
+}
+
+void
+optimizeOverdraw(unsigned* indices, int indexCount, const PackedVertex* vertices, int vertexCount,
+	double threshold)
+{
+	const int triangleCount = indexCount / 3;
+	if (triangleCount < 2) {
+		return;
+	}
+
+	std::vector<int> misses(triangleCount);
+	const int totalMisses = cacheMisses(indices, indexCount, vertexCount, MESH_CACHE_SIZE, misses.data());
+	const double acmr = double(totalMisses) / triangleCount;
+
+	// A new cluster where the cache starts over (3 misses), or after a
+	// cluster that does about as well as the whole even from an empty cache,
+	// as it will be drawn after any other
+	std::vector<int> starts(1, 0), missedAt(vertexCount, -MESH_CACHE_SIZE - 1);
+	int clock = 0, clusterMisses = 0;
+	for (int t = 0; t < triangleCount; t++) {
+		if (t > starts.back() && misses[t] == 3) {
+			starts.push_back(t);
+			clusterMisses = 0;
+			clock += MESH_CACHE_SIZE + 1;
+		}
+		for (int k = 0; k < 3; k++) {
+			const unsigned v = indices[3 * t + k];
+			if (clock - missedAt[v] > MESH_CACHE_SIZE) {
+				missedAt[v] = clock++;
+				clusterMisses++;
+			}
+		}
+		if (t + 1 < triangleCount && clusterMisses <= threshold * acmr * (t + 1 - starts.back())) {
+			starts.push_back(t + 1);
+			clusterMisses = 0;
+			clock += MESH_CACHE_SIZE + 1;
+		}
+	}
+	starts.push_back(triangleCount);
+	const int clusterCount = int(starts.size()) - 1;
+
+	// Centres and normals weighted by area, from the cross products
+	std::vector<glm::vec3> centre(clusterCount, glm::vec3(0.0f)), normal(clusterCount, glm::vec3(0.0f));
+	std::vector<float> area(clusterCount, 0.0f);
+	glm::vec3 meshCentre(0.0f);
+	float meshArea = 0.0f;
+	for (int c = 0; c < clusterCount; c++) {
+		for (int t = starts[c]; t < starts[c + 1]; t++) {
+			const glm::vec3 a = positionOf(vertices[indices[3 * t]]);
+			const glm::vec3 b = positionOf(vertices[indices[3 * t + 1]]);
+			const glm::vec3 d = positionOf(vertices[indices[3 * t + 2]]);
+			const glm::vec3 cross = glm::cross(b - a, d - a);
+			const float weight = glm::length(cross);
+			centre[c] += (a + b + d) * (weight / 3.0f);
+			normal[c] += cross;
+			area[c] += weight;
+		}
+		meshCentre += centre[c];
+		meshArea += area[c];
+		centre[c] /= std::max(area[c], 1e-20f);
+	}
+	meshCentre /= std::max(meshArea, 1e-20f);
+
+	std::vector<float> facing(clusterCount);
+	std::vector<int> sorted(clusterCount);
+	for (int c = 0; c < clusterCount; c++) {
+		const float length = glm::length(normal[c]);
+		facing[c] = length > 0.0f ? glm::dot(centre[c] - meshCentre, normal[c] / length) : 0.0f;
+		sorted[c] = c;
+	}
+	std::stable_sort(sorted.begin(), sorted.end(), [&facing](int l, int r) { return facing[l] > facing[r]; });
+
+	std::vector<unsigned> order;
+	order.reserve(indexCount);
+	for (int c = 0; c < clusterCount; c++) {
+		order.insert(order.end(), indices + 3 * starts[sorted[c]], indices + 3 * starts[sorted[c] + 1]);
+	}
+	if (cacheMisses(order.data(), indexCount, vertexCount, MESH_CACHE_SIZE, NULL) <= threshold * totalMisses) {
+		std::copy(order.begin(), order.end(), indices);
+	}
+}
+
+//----------------------------------------------------------------------------
+
+int
+optimizeVertexFetch(PackedVertex* vertices, unsigned* indices, int indexCount, int vertexCount)
+{
+	std::vector<int> remap(vertexCount, -1);
+	std::vector<PackedVertex> fetched;
+	fetched.reserve(vertexCount);
+	for (int i = 0; i < indexCount; i++) {
+		int& to = remap[indices[i]];
+		if (to < 0) {
+			to = int(fetched.size());
+			fetched.push_back(vertices[indices[i]]);
+		}
+		indices[i] = unsigned(to);
+	}
+	std::copy(fetched.begin(), fetched.end(), vertices);
+	return int(fetched.size());
+}
+
+OptimizedMesh
+optimizeMesh(const MeshView& mesh)
+{
+	OptimizedMesh out;
+	out.vertices.assign(mesh.vertices, mesh.vertices + mesh.vertexCount);
+	out.indices.assign(mesh.indices, mesh.indices + mesh.indexCount);
+	optimizeVertexCache(out.indices.data(), mesh.indexCount, mesh.vertexCount);
+	optimizeOverdraw(out.indices.data(), mesh.indexCount, out.vertices.data(), mesh.vertexCount);
+	out.vertices.resize(optimizeVertexFetch(out.vertices.data(), out.indices.data(), mesh.indexCount,
+		mesh.vertexCount));
+	return out;
+}
@@ -0,0 +1,58 @@
+#ifndef MESHOPT_H
+#define MESHOPT_H
+
+#include "meshes.h"
+
+#include <vector>
+
+// Passes that reorder the triangles and vertices of a mesh for the GPU
+// without changing what it draws. Every triangle keeps its vertices in the
+// same order, so its first (provoking) vertex and flat colour stay the same.
+
+// Post-transform cache size the passes aim at
+const int MESH_CACHE_SIZE = 32;
+
+// What a FIFO post-transform cache of cacheSize vertices does with a list
+// of triangles: vertices transformed per triangle (ACMR, 3 at worst, 0.5 for
+// a large grid at best) and per vertex of the mesh (ATVR, 1 at best).
+struct VertexCacheStats
+{
+	double acmr;
+	double atvr;
+};
+
+VertexCacheStats analyzeVertexCache(const unsigned* indices, int indexCount, int vertexCount,
+	int cacheSize = MESH_CACHE_SIZE);
+
+// Triangles reordered for the cache with the scores of Tom Forsyth's
+// "Linear-speed vertex cache optimisation": each next triangle is the best
+// of those using vertices still in the cache, favouring the vertices used
+// last and those with few triangles left. The order given is kept if it
+// already does better, as the rows of a narrow mesh may.
+void optimizeVertexCache(unsigned* indices, int indexCount, int vertexCount);
+
+// Triangles, as ordered by optimizeVertexCache(), cut into clusters where
+// the cache starts over or nearly so (threshold times the ACMR of the
+// whole), and the clusters drawn from the one facing out from the centre of
+// the mesh most to the one facing in most. On a convex mesh the front then
+// tends to be drawn before the back, whatever the view, and the depth test
+// skips the back. The order given is kept if the cache would do more than
+// threshold times worse.
+void optimizeOverdraw(unsigned* indices, int indexCount, const PackedVertex* vertices, int vertexCount,
+	double threshold = 1.05);
+
+// Vertices renumbered in the order the triangles first use them, so they
+// are read from memory in order, and the unused ones left out. Returns the
+// number of vertices left at the front of vertices.
+int optimizeVertexFetch(PackedVertex* vertices, unsigned* indices, int indexCount, int vertexCount);
+
+// A copy of a mesh after all three passes
+struct OptimizedMesh
+{
+	std::vector<PackedVertex> vertices;
+	std::vector<unsigned> indices;
+};
+
+OptimizedMesh optimizeMesh(const MeshView& mesh);
+
+#endif // MESHOPT_H
@@ -0,0 +1,50 @@
+#ifndef MONITOR_H
+#define MONITOR_H
+
+#include <glm/glm.hpp>
+
+// What the step kernel saw in one step, summed over the balls it stepped,
+// to watch a long run for drift or blow-ups without a debugger. A ball
+// weighs r^3 as in BallWorld::resolveContacts(), its height is counted
+// from the ground and a ball at rest has no speed.
+// Filled in by stepBallsMonitored() and BallWorld::step() with stats set.
+struct StepStats
+{
+	double kinetic;        // sum of m v^2 / 2
+	double potential;      // sum of m |g| h
+	glm::dvec3 momentum;   // sum of m v
+	double penetration;    // total depth balls got into the room before being put back
+	float maxPenetration;
+	long long bounces;     // off the ground, the ceiling and the walls
+	long long contacts;    // touching pairs of balls found, see BallWorld::allowSleep
+	long long balls;
+
+	StepStats() { clear(); }
+
+	void
+	clear()
+	{
+		kinetic = potential = 0.0;
+		momentum = glm::dvec3(0.0);
+		penetration = 0.0;
+		maxPenetration = 0.0f;
+		bounces = contacts = balls = 0;
+	}
+
+	void
+	add(const StepStats& o)
+	{
+		kinetic += o.kinetic;
+		potential += o.potential;
+		momentum += o.momentum;
+		penetration += o.penetration;
+		maxPenetration = glm::max(maxPenetration, o.maxPenetration);
+		bounces += o.bounces;
+		contacts += o.contacts;
+		balls += o.balls;
+	}
+
+	double energy() const { return kinetic + potential; }
+};
+
+#endif // MONITOR_H
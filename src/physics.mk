@@ -0,0 +1,5 @@
+# Simulation sources, and the meshes, that do not depend on GL or GLUT.
+# Included by the Makefiles of the programs that run physics without a window.
+
+PHYSICS_SOURCES=game.cpp inputlog.cpp ballworld.cpp stepkernel.cpp grid.cpp sweepprune.cpp events.cpp trajectory.cpp threadpool.cpp snapshot.cpp rewind.cpp ensemble.cpp meshes.cpp meshopt.cpp
+PHYSICS_HEADERS=room.h monitor.h game.h inputlog.h ballworld.h stepkernel.h broadphase.h grid.h sweepprune.h impact.h events.h trajectory.h threadpool.h snapshot.h rewind.h ensemble.h meshes.h meshopt.h bakedmeshes.h
@@ -0,0 +1,271 @@
+#include "rewind.h"
+#include "ballworld.h"
+
+#include <cassert>
+#include <cstring>
+
+// A delta is a list of (zero bytes skipped, bytes stored, the stored bytes)
+// with both counts as varints, until the whole frame is covered.
+
+static void
+putVarint(std::vector<unsigned char>& out, size_t v)
+{
+	while (v >= 0x80) {
+		out.push_back((unsigned char)(v | 0x80));
+		v >>= 7;
+	}
+	out.push_back((unsigned char)v);
+}
+
+static size_t
+getVarint(const unsigned char*& p)
+{
+	size_t v = 0;
+	for (int shift = 0; ; shift += 7) {
+		unsigned char b = *p++;
+		v |= size_t(b & 0x7f) << shift;
+		if (b < 0x80) {
+			return v;
+		}
+	}
+}
+
+// Bytes from i on where a and b are equal
+static size_t
+sameRun(const unsigned char* a, const unsigned char* b, size_t i, size_t n)
+{
+	size_t start = i;
+	while (i + 8 <= n && std::memcmp(a + i, b + i, 8) == 0) {
+		i += 8;
+	}
+	while (i < n && a[i] == b[i]) {
+		i++;
+	}
+	return i - start;
+}
+
+// Append the XOR of a and b. A run of equal bytes shorter than a few bytes
+// is stored rather than skipped, as the counts would cost more.
+static void
+encodeDelta(const unsigned char* a, const unsigned char* b, size_t n, std::vector<unsigned char>& out)
+{
+	size_t i = 0;
+	while (i < n) {
+		size_t zeros = sameRun(a, b, i, n);
+		size_t start = i + zeros;
+		size_t end = start;
+		while (end < n) {
+			if (a[end] != b[end]) {
+				end++;
+				continue;
+			}
+			size_t run = sameRun(a, b, end, n);
+			if (run >= 4 || end + run == n) {
+				break;
+			}
+			end += run;
+		}
+		putVarint(out, zeros);
+		putVarint(out, end - start);
+		for (size_t k = start; k < end; k++) {
+			out.push_back(a[k] ^ b[k]);
+		}
+		i = end;
+	}
+}
+
+// XOR a delta into a frame, which turns either of the two frames it was
+// made from into the other
+static void
+applyDelta(const unsigned char* delta, unsigned char* frame, size_t n)
+{
+	size_t i = 0;
+	while (i < n) {
+		i += getVarint(delta);
+		size_t count = getVarint(delta);
+		for (size_t k = 0; k < count; k++) {
+			frame[i + k] ^= delta[k];
+		}
+		delta += count;
+		i += count;
+	}
+}
+
+//----------------------------------------------------------------------------
+
+RewindBuffer::RewindBuffer(size_t frameSize, int capacity, int keyInterval)
+	: bytes(frameSize), keyInterval(keyInterval < 1 ? 1 : keyInterval),
+	  first(0), groupCount(0), frameCount(0), newest(frameSize)
+{
+	// Enough groups that dropping the oldest still leaves capacity frames
+	groups.resize((capacity + this->keyInterval - 1) / this->keyInterval + 1);
+}
+
+void
+RewindBuffer::clear()
+{
+	for (size_t k = 0; k < groups.size(); k++) {
+		groups[k].deltas.clear();
+		groups[k].deltaEnds.clear();
+	}
+	first = groupCount = frameCount = 0;
+}
+
+void
+RewindBuffer::push(const void* frame)
+{
+	const unsigned char* f = static_cast<const unsigned char*>(frame);
+	if (groupCount > 0 && group(groupCount - 1).frames() < keyInterval) {
+		Group& g = group(groupCount - 1);
+		encodeDelta(f, newest.data(), bytes, g.deltas);
+		g.deltaEnds.push_back(g.deltas.size());
+	}
+	else {
+		if (groupCount == int(groups.size())) {
+			frameCount -= group(0).frames();
+			first = (first + 1) % int(groups.size());
+			groupCount--;
+		}
+		Group& g = group(groupCount++);
+		g.key.assign(f, f + bytes); // reuses the storage of a dropped group
+		g.deltas.clear();
+		g.deltaEnds.clear();
+	}
+	std::memcpy(newest.data(), f, bytes);
+	frameCount++;
+}
+
+bool
+RewindBuffer::back(void* frame)
+{
+	if (frameCount < 2) {
+		return false;
+	}
+	Group& g = group(groupCount - 1);
+	if (g.deltaEnds.empty()) {
+		groupCount--;
+		const Group& before = group(groupCount - 1);
+		decodeLast(before, before.frames(), newest.data());
+	}
+	else {
+		size_t begin = g.deltaEnds.size() > 1 ? g.deltaEnds[g.deltaEnds.size() - 2] : 0;
+		applyDelta(g.deltas.data() + begin, newest.data(), bytes);
+		g.deltas.resize(begin);
+		g.deltaEnds.pop_back();
+	}
+	frameCount--;
+	std::memcpy(frame, newest.data(), bytes);
+	return true;
+}
+
+void
+RewindBuffer::get(int age, void* frame) const
+{
+	assert(0 <= age && age < frameCount);
+	int index = frameCount - 1 - age; // from the oldest frame kept
+	int k = 0;
+	while (index >= group(k).frames()) {
+		index -= group(k).frames();
+		k++;
+	}
+	decodeLast(group(k), index + 1, static_cast<unsigned char*>(frame));
+}
+
+// The frames-th frame of a group
+void
+RewindBuffer::decodeLast(const Group& g, int frames, unsigned char* frame) const
+{
+	std::memcpy(frame, g.key.data(), bytes);
+	size_t begin = 0;
+	for (int d = 0; d + 1 < frames; d++) {
+		applyDelta(g.deltas.data() + begin, frame, bytes);
+		begin = g.deltaEnds[d];
+	}
+}
+
+size_t
+RewindBuffer::memoryBytes() const
+{
+	size_t total = newest.capacity();
+	for (size_t k = 0; k < groups.size(); k++) {
+		total += groups[k].key.capacity() + groups[k].deltas.capacity()
+			+ groups[k].deltaEnds.capacity() * sizeof(size_t);
+	}
+	return total;
+}
+
+//----------------------------------------------------------------------------
+
+// The floats of a frame are stored a byte plane at a time: the first byte of
+// every value, then the second and so on. A value that changed a little
+// only changes its low bytes, so the XOR with the frame before has long
+// runs of zeros in the planes of the high bytes.
+static const int floatArrays = 6;
+static const size_t worldBytesPerBall = floatArrays * sizeof(float) + sizeof(unsigned char) + 2 * sizeof(int);
+
+static void
+splitPlanes(const float* values, size_t n, unsigned char* planes)
+{
+	for (size_t i = 0; i < n; i++) {
+		unsigned char b[sizeof(float)];
+		std::memcpy(b, &values[i], sizeof(float));
+		for (size_t k = 0; k < sizeof(float); k++) {
+			planes[k * n + i] = b[k];
+		}
+	}
+}
+
+static void
+joinPlanes(const unsigned char* planes, size_t n, float* values)
+{
+	for (size_t i = 0; i < n; i++) {
+		unsigned char b[sizeof(float)];
+		for (size_t k = 0; k < sizeof(float); k++) {
+			b[k] = planes[k * n + i];
+		}
+		std::memcpy(&values[i], b, sizeof(float));
+	}
+}
+
+size_t
+worldFrameSize(const BallWorld& world)
+{
+	return world.size() * worldBytesPerBall;
+}
+
+void
+saveWorldFrame(const BallWorld& world, void* frame)
+{
+	const size_t n = world.size();
+	unsigned char* p = static_cast<unsigned char*>(frame);
+	const std::vector<float>* floats[floatArrays] = { &world.x, &world.y, &world.z, &world.vx, &world.vy, &world.vz };
+	for (int k = 0; k < floatArrays; k++) {
+		splitPlanes(floats[k]->data(), n, p);
+		p += n * sizeof(float);
+	}
+	std::memcpy(p, world.restFlag.data(), n);
+	p += n;
+	std::memcpy(p, world.quietSteps.data(), n * sizeof(int));
+	p += n * sizeof(int);
+	std::memcpy(p, world.nextInIsland.data(), n * sizeof(int));
+}
+
+void
+loadWorldFrame(BallWorld& world, const void* frame)
+{
+	const size_t n = world.size();
+	const unsigned char* p = static_cast<const unsigned char*>(frame);
+	std::vector<float>* floats[floatArrays] = { &world.x, &world.y, &world.z, &world.vx, &world.vy, &world.vz };
+	for (int k = 0; k < floatArrays; k++) {
+		joinPlanes(p, n, floats[k]->data());
+		p += n * sizeof(float);
+	}
+	std::memcpy(world.restFlag.data(), p, n);
+	p += n;
+	std::memcpy(world.quietSteps.data(), p, n * sizeof(int));
+	p += n * sizeof(int);
+	std::memcpy(world.nextInIsland.data(), p, n * sizeof(int));
+
+	// the impulses kept are those of another frame
+	world.setCachedImpulses(0, 0, 0);
+}
@@ -0,0 +1,75 @@
+#ifndef REWIND_H
+#define REWIND_H
+
+#include <cstddef>
+#include <vector>
+
+class BallWorld;
+
+// The last states of a simulation, to go back to. States are frames of a
+// fixed number of bytes. Every keyInterval-th frame is kept whole, the
+// ones in between as the XOR with the frame before, with runs of zero
+// bytes left out. A ball that did not move costs nothing and one that
+// did mostly only its low bytes.
+//
+// Frames are dropped a group (a keyframe and the deltas after it) at a
+// time, oldest first, so at least capacity frames are always there and
+// the memory stays bounded by the groups that make that up.
+//
+// Going back one frame from the newest XORs a single delta into it, and
+// going to any frame costs a keyframe copy and at most keyInterval - 1
+// deltas.
+class RewindBuffer
+{
+public:
+	RewindBuffer(size_t frameSize, int capacity, int keyInterval);
+
+	void clear();
+	void push(const void* frame);
+
+	// Frames that can be gone back to, the newest included
+	int size() const { return frameCount; }
+
+	// Drop the newest frame and write the one before it, which becomes the
+	// newest. Returns false, dropping nothing, if there is no frame before it.
+	bool back(void* frame);
+
+	// Write the frame age pushes before the newest, 0 being the newest and
+	// size() - 1 the oldest
+	void get(int age, void* frame) const;
+
+	size_t frameSize() const { return bytes; }
+
+	// Bytes held by the frames, including unused capacity
+	size_t memoryBytes() const;
+
+private:
+	struct Group
+	{
+		std::vector<unsigned char> key;
+		std::vector<unsigned char> deltas;  // one after the other
+		std::vector<size_t> deltaEnds;      // end of each delta in deltas
+		int frames() const { return 1 + int(deltaEnds.size()); }
+	};
+
+	Group& group(int k) { return groups[(first + k) % groups.size()]; }
+	const Group& group(int k) const { return groups[(first + k) % groups.size()]; }
+	void decodeLast(const Group& g, int frames, unsigned char* frame) const;
+
+	size_t bytes;
+	int keyInterval;
+	std::vector<Group> groups; // a ring of groupCount groups from first
+	int first, groupCount;
+	int frameCount;
+	std::vector<unsigned char> newest; // the newest frame, for the next delta
+};
+
+// Frames of a BallWorld: position, velocity and the sleep state of every
+// ball. The radius and the settings are taken to stay the same. The warm
+// start cache of the contact solver is not in a frame, so loading one
+// clears it and the next step with the solver starts cold.
+size_t worldFrameSize(const BallWorld& world);
+void saveWorldFrame(const BallWorld& world, void* frame);
+void loadWorldFrame(BallWorld& world, const void* frame);
+
+#endif // REWIND_H
@@ -0,0 +1,24 @@
+#ifndef ROOM_H
+#define ROOM_H
+
+#include <cfloat>
+
+// Borders of the box the balls live in
+enum { leftWall = 0, rightWall = 1, farWall = 2, nearWall = 3 };
+
+struct Room
+{
+	float ground;
+	float walls[4];
+	float ceiling; // FLT_MAX for a room open at the top
+};
+
+// Same box as the one drawn by run.cpp
+inline Room
+defaultRoom()
+{
+	Room room = { -2.0f, { -2.0f, 2.0f, -2.0f, 1.9f }, FLT_MAX };
+	return room;
+}
+
+#endif // ROOM_H
@@ -3,315 +3,127 @@
 #include <glm/gtc/type_ptr.hpp>
 
 #include "common.h"
-
+#include "game.h"
+#include "inputlog.h"
+#include "bakedmeshes.h"
+#include "meshes.h"
+#include "rewind.h"
+#include "snapshot.h"
+#include "vertexlayout.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
 #include <iostream>
+#include <string>
 #include <vector>
 
 
 const char* WINDOW_TITLE = "Sphere";
 const double FRAME_RATE_MS = 1000.0 / 60.0;
-const float PI = 3.1415926f;
-const float TWO_PI = PI * 2;
+const double PHYSICS_STEP_MS = 1000.0 / 60.0; // all physics constants below are per step
 
-// Lists
-std::vector<GLfloat> vertices;
-std::vector<GLfloat> normals;
-std::vector<GLuint> indices;
 
 
 // Array of rotation angles (in degrees) for each coordinate axis
 enum { Xaxis = 0, Yaxis = 1, Zaxis = 2, NumAxes = 3 };
 int      Axis = Xaxis;
-GLfloat  Theta[NumAxes] = { 0.0, 0.0, 0.0 };
 
 // Uniforms
 GLuint ViewCamera;
-GLuint ViewSphere, ViewSphereInvTra, sphereIndex;
+GLuint ViewSphere, ViewSphereInvTra, sphereIndex, SphereRadius;
 GLuint ViewGround, ViewGroundInvTra, groundIndex, wallIndex;
 GLuint ViewGroundShadow, groundShadowIndex;
 GLuint ViewWallShadow, wallShadowIndex;
 GLuint Projection;
+glm::mat4 projection;
+int windowHeight = 712;
 GLboolean UseLighting;
 
-// Physics
-float g = 9.8f;
-float mass = 0.0002f;
-float velocity = 150;
-float gravity = -mass * g;
-float impulse = mass * velocity;
-
-// Default settings
-float radius = 0.5f;
-glm::vec3 currPosition(0, 1, -1);
-glm::vec3 vCurrent(impulse, impulse, impulse);
-bool rest = false;
-bool pause = false;
-int view = 0;
-
-glm::vec3 lightPositionTop(0.0f, 20.0f, 0.0f);
-glm::vec3 lightPositionNear(0.0f, +1.5f, 20.0f);
-
-// Borders
-float ground = -2;
-float walls[4] = { -2.0f, 2.0f , -2.0f, 1.9f };
-enum { leftWall = 0, rightWall = 1, farWall = 2, nearWall = 3 };
-
-int
-makeGround(int lastIndex)
-{
-	float xLength = 4.0;
-	float yLength = 4.0;
-
-	float xPoints = 31; // must be odd for checkerboard pattern
-	float yPoints = yLength / xLength * xPoints; // normalize squares (each side is equal)
-
-
-	float dx = xLength / xPoints;
-	float dy = yLength / yPoints;
-	float offsetX = -xLength / 2 + dx / 2; // center at 0,0,0
-	float offsetY = -2.0f + dy;
+// Physics, see game.h
+GameConstants constants = defaultConstants();
+GameState game = startState(constants);
+const float& radius = constants.radius;
+unsigned stepCount = 0; // update() calls so far
 
-	glm::vec3 n(0, -1, 0);
+// Recording (-record file) or playing back (-replay file) the keys
+InputLog inputLog;
+std::string recordPath;
+bool replaying = false;
+size_t nextEvent = 0;
 
-	for (int i = 0; i < yPoints; i++) {
-		GLfloat y = i * dx;
+// The last ten seconds of the game, 'b' goes back half a second of them
+RewindBuffer history(sizeof(GameState), 600, 60);
+const int REWIND_STEPS = 30;
 
-		for (float j = 0; j < xPoints; j++) {
-			GLfloat z = 0;
-			GLfloat x = j * dy;
+// 'o' saves the game to this file and 'l' loads it back (-snapshot file)
+std::string snapshotPath = "sphere.bsnp";
 
-			vertices.push_back(x + offsetX);
-			vertices.push_back(y + offsetY);
-			vertices.push_back(z);
-			vertices.push_back(1);
-
-			normals.push_back(n.x);
-			normals.push_back(n.y);
-			normals.push_back(n.z);
-		}
-	}
-
-	for (int i = 0; i < (round(yPoints) - 1) * round(xPoints); i++) {
-
-		if (i % (int)xPoints != xPoints - 1) // edge
-		{
-			// right triangle
-			indices.push_back(GLuint(lastIndex + i));
-			indices.push_back(GLuint(lastIndex + i + xPoints + 1));
-			indices.push_back(GLuint(lastIndex + i + 1));
-
-			// left triangle
-			indices.push_back(GLuint(lastIndex + i));
-			indices.push_back(GLuint(lastIndex + i + xPoints));
-			indices.push_back(GLuint(lastIndex + i + xPoints + 1));
-		}
-	}
-
-	return vertices.size() / 4; // will be used in the shader
-}
+// State before the last update(), display() blends it with the current one
+glm::vec3 prevPosition = game.position;
+GLfloat prevTheta = 0.0;
+float alpha = 1.0f;
 
+glm::vec3 lightPositionTop(0.0f, 20.0f, 0.0f);
+glm::vec3 lightPositionNear(0.0f, +1.5f, 20.0f);
 
-int
-makeWall(int lastIndex)
+// Borders
+const float& ground = constants.room.ground;
+const float* walls = constants.room.walls;
+
+// Checker tiles along the 4 units of the ground and the wall. They are
+// drawn by the fragment shader, so each plane is a single quad however
+// many there are. 0 draws them from a grid of vertices instead, one
+// colour per square (-checkers n).
+int checkers = 31;
+
+// The meshes drawn, from bakedmeshes.h, in the order of the ranges of
+// gl_VertexID in vshader.glsl, and where each starts in the vertex and index
+// buffers. All levels of the ball are in its range, and display() draws one
+// of them. The indices of each mesh count from its own first vertex, so
+// they are 16 bits.
+enum {
+	GroundMesh = 0, WallMesh = 1, BallMeshes = 2,
+	GroundShadow = BallMeshes + SPHERE_LODS, WallShadow = GroundShadow + 1, NumMeshes = WallShadow + 1
+};
+struct DrawnMesh
 {
-	float xLength = 4.0;
-	float zLength = 4.0;
-
-	float xPoints = 31; // must be odd for checkerboard pattern
-	float zPoints = zLength / xLength * xPoints; // normalize squares (each side is equal)
-
-	float dx = xLength / xPoints;
-	float dz = zLength / zPoints;
-	float offsetX = -xLength / 2 + dx / 2; // center at 0,0,0
-	float offsetY = 2.0;
-	float offsetZ = 0;
-
-	glm::vec3 n(0, 0, 1);
-
-	for (int i = 0; i < zPoints; i++) {
-		GLfloat z = i * dz + offsetZ;
-
-		for (float j = 0; j < xPoints; j++) {
-			GLfloat x = j * dx;
-			GLfloat y = offsetY;
-
-			vertices.push_back(x + offsetX);
-			vertices.push_back(y);
-			vertices.push_back(z);
-			vertices.push_back(1);
-
-			normals.push_back(n.x);
-			normals.push_back(n.y);
-			normals.push_back(n.z);
-		}
-	}
-
-	for (int i = 0; i < (round(zPoints) - 1) * round(xPoints); i++) {
-
-		if (i % (int)xPoints != xPoints - 1) // edge
-		{
-			// right triangle
-			indices.push_back(GLuint(lastIndex + i));
-			indices.push_back(GLuint(lastIndex + i + xPoints + 1));
-			indices.push_back(GLuint(lastIndex + i + 1));
-
-			// left triangle
-			indices.push_back(GLuint(lastIndex + i));
-			indices.push_back(GLuint(lastIndex + i + xPoints));
-			indices.push_back(GLuint(lastIndex + i + xPoints + 1));
-		}
-	}
-
-	return vertices.size() / 4; // will be used in the shader
-}
-
-int
-makeSphere(int lastIndex, float radius)
+	const PackedVertex* vertices;
+	const GLushort* indices;
+	GLsizei vertexCount, indexCount;
+};
+DrawnMesh meshes[NumMeshes];
+GLint baseVertex[NumMeshes + 1];
+GLsizei firstIndex[NumMeshes + 1];
+
+// A mesh of bakedmeshes.h, uploaded from where it is
+DrawnMesh
+bakedMesh(int id)
 {
-	// UI Sphere variables	
-	int circlePoints = 22; // EVEN (for checkerboard pattern)        
-	int arcPoints = 15; // ODD (for checkerboard pattern), remember that north and south polls have duplicate points for each point on a circle	 	  
-
-	for (float i = 0; i <= circlePoints; i++) {
-
-		float t = i / (circlePoints);
-		float phi = t * TWO_PI;
-
-		// iterate points on an arc from (0,0,-z) to (0,0,+z)
-		for (float j = 0; j < arcPoints; j++) {
-
-			float t = j / (arcPoints - 1);
-			float theta = t * PI;
-
-			// get spherical coordinates
-			// formulas: https://en.wikipedia.org/wiki/Spherical_coordinate_system
-			GLfloat x = radius * sin(theta) * cos(phi);
-			GLfloat y = radius * sin(theta) * sin(phi);
-			GLfloat z = radius * cos(theta);
-
-			vertices.push_back(x);
-			vertices.push_back(y);
-			vertices.push_back(z);
-			vertices.push_back(1.0f);
-
-			glm::vec3 n = normalize(glm::vec3(x, y, z));
-
-			normals.push_back(n.x);
-			normals.push_back(n.y);
-			normals.push_back(n.z);
-		}
-	}
-
-	int squares = arcPoints * (circlePoints)-1;
-
-	for (int i = 0; i <= squares; i++) {
-
-		if (i % arcPoints != arcPoints - 1) // avoid north poll points
-		{
-			// right triangle
-			indices.push_back(GLuint(lastIndex + i));
-			indices.push_back(GLuint(lastIndex + i + arcPoints + 1));
-			indices.push_back(GLuint(lastIndex + i + 1));
-
-			// left triangle
-			indices.push_back(GLuint(lastIndex + i));
-			indices.push_back(GLuint(lastIndex + i + arcPoints));
-			indices.push_back(GLuint(lastIndex + i + arcPoints + 1));
-		}
-	}
-	return vertices.size() / 4; // will be used in the shader
-}
-
-int makeWallShadow(int lastIndex, float radius) {
-	GLfloat centerX = 0;
-	GLfloat centerY = 0;
-
-	int circlePoints = 22;
-
-	vertices.push_back(centerX);
-	vertices.push_back(centerY);
-	vertices.push_back(0);
-	vertices.push_back(1.0f);
-
-	// glm::vec3 n(0, -1, 0);
-	//normals.push_back(n.x);
-	//normals.push_back(n.y);
-	//normals.push_back(n.z);
-
-
-	for (float i = 0; i <= circlePoints; i++) {
-		float t = i / (circlePoints);
-		float phi = t * TWO_PI;
-
-		GLfloat x = centerX + radius * cos(phi);
-		GLfloat y = centerY + radius * sin(phi);
-		GLfloat z = 0;
-
-		vertices.push_back(x);
-		vertices.push_back(y);
-		vertices.push_back(z);
-		vertices.push_back(1.0f);
-
-		// The code will probably break if i dont have normals for every object					
-		/*normals.push_back(n.x);
-		normals.push_back(n.y);
-		normals.push_back(n.z);*/
-	}
-
-	for (int i = 0; i < circlePoints; i++) {
-
-		// triangle
-		indices.push_back(GLuint(lastIndex + 1)); // center
-		indices.push_back(GLuint(lastIndex + 1 + i)); // on circle
-		indices.push_back(GLuint(lastIndex + 1 + i + 1)); // next on circle			
-	}
-	return vertices.size() / 4; // will be used in the shader
+	const BakedMesh& baked = bakedMeshes[id];
+	DrawnMesh mesh = { bakedVertices + baked.firstVertex, bakedIndices + baked.firstIndex,
+		baked.vertexCount, baked.indexCount };
+	return mesh;
 }
 
-int makeGroundShadow(int lastIndex, float radius) {
-	GLfloat centerX = 0;
-	GLfloat centerY = 0;
-
-	int circlePoints = 22;
-
-	vertices.push_back(centerX);
-	vertices.push_back(centerY);
-	vertices.push_back(0);
-	vertices.push_back(1.0f);
-
-	//glm::vec3 n(0, -1, 0);
-	//normals.push_back(n.x);
-	//normals.push_back(n.y);
-	//normals.push_back(n.z);
-
-
-	for (float i = 0; i <= circlePoints; i++) {
-		float t = i / (circlePoints);
-		float phi = t * TWO_PI;
-
-		GLfloat x = centerX + radius * cos(phi);
-		GLfloat y = centerY + radius * sin(phi);
-		GLfloat z = 0;
-
-		vertices.push_back(x);
-		vertices.push_back(z);
-		vertices.push_back(y);
-		vertices.push_back(1.0f);
-
-		// The code will probably break if i dont have normals for every object	
-	/*	normals.push_back(n.x);
-		normals.push_back(n.y);
-		normals.push_back(n.z);*/
+void
+setMeshes()
+{
+	meshes[GroundMesh] = bakedMesh(checkers > 0 ? BakedGroundQuad : BakedGroundGrid);
+	meshes[WallMesh] = bakedMesh(checkers > 0 ? BakedWallQuad : BakedWallGrid);
+	for (int l = 0; l < SPHERE_LODS; l++) {
+		meshes[BallMeshes + l] = bakedMesh(BakedBallLods + l);
 	}
-
-	for (int i = 0; i < circlePoints; i++) {
-
-		// triangle
-		indices.push_back(GLuint(lastIndex + 1)); // center
-		indices.push_back(GLuint(lastIndex + 1 + i)); // on circle
-		indices.push_back(GLuint(lastIndex + 1 + i + 1)); // next on circle			
+	meshes[GroundShadow] = bakedMesh(BakedGroundShadow);
+	meshes[WallShadow] = bakedMesh(BakedWallShadow);
+
+	baseVertex[0] = 0;
+	firstIndex[0] = 0;
+	for (int k = 0; k < NumMeshes; k++) {
+		baseVertex[k + 1] = baseVertex[k] + meshes[k].vertexCount;
+		firstIndex[k + 1] = firstIndex[k] + meshes[k].indexCount;
 	}
-	return vertices.size() / 4; // will be used in the shader
 }
 
 
@@ -338,11 +150,14 @@ void initLight(GLuint shader) {
 void
 init()
 {
-	int endOfGround = makeGround(0);
-	int endOfWall = makeWall(endOfGround); // I really should just rotate ground instead... 
-	int endOfSpehre = makeSphere(endOfWall, radius);
-	int enfOfGroundShadow = makeGroundShadow(endOfSpehre, radius);
-	int enfOfWallShadow = makeWallShadow(enfOfGroundShadow, radius);
+	// The packed normals need GL 3.3 or its extension
+	if (!GLEW_VERSION_3_3 && !GLEW_ARB_vertex_type_2_10_10_10_rev) {
+		std::cerr << "GL_INT_2_10_10_10_REV vertex attributes are not supported" << std::endl;
+		exit(EXIT_FAILURE);
+	}
+
+	setMeshes();
+	const int vertexCount = baseVertex[NumMeshes];
 
 	// Bind and create Vertex Array Objects
 	GLuint vao;
@@ -352,31 +167,31 @@ init()
 	// Create Vertex Buffer Object
 	GLuint buffer;
 
-	// Load geomerty to GPU
+	// Load geomerty to GPU, as interleaved 16 byte vertices
 	glGenBuffers(1, &buffer);
 	glBindBuffer(GL_ARRAY_BUFFER, buffer);
-
-	//glBufferData(GL_ARRAY_BUFFER, sizeof(GLfloat) * vertices.size(), vertices.data(), GL_STATIC_DRAW);
-	glBufferData(GL_ARRAY_BUFFER, sizeof(GLfloat) * (vertices.size() + normals.size()), NULL, GL_STATIC_DRAW);
-	glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(GLfloat) * vertices.size(), vertices.data());
-	glBufferSubData(GL_ARRAY_BUFFER, sizeof(GLfloat) * vertices.size(), sizeof(GLfloat) * normals.size(), normals.data());
+	glBufferData(GL_ARRAY_BUFFER, sizeof(PackedVertex) * vertexCount, NULL, GL_STATIC_DRAW);
+	for (int k = 0; k < NumMeshes; k++) {
+		glBufferSubData(GL_ARRAY_BUFFER, sizeof(PackedVertex) * baseVertex[k],
+			sizeof(PackedVertex) * meshes[k].vertexCount, meshes[k].vertices);
+	}
 
 	glGenBuffers(1, &buffer);
 	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffer);
-	glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(GLuint) * indices.size(), indices.data(), GL_STATIC_DRAW);
+	glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(GLushort) * firstIndex[NumMeshes], NULL, GL_STATIC_DRAW);
+	for (int k = 0; k < NumMeshes; k++) {
+		glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, sizeof(GLushort) * firstIndex[k],
+			sizeof(GLushort) * meshes[k].indexCount, meshes[k].indices);
+	}
 
 	// Load Shader
 	GLuint shader = InitShader("vshader.glsl", "fshader.glsl");
 	glUseProgram(shader);
 
 	// Set up vertex arrays
-	GLuint vPosition = glGetAttribLocation(shader, "vPosition");
-	glEnableVertexAttribArray(vPosition);
-	glVertexAttribPointer(vPosition, 4, GL_FLOAT, GL_FALSE, 0, BUFFER_OFFSET(0));
-
-	GLuint vNormal = glGetAttribLocation(shader, "vNormal");
-	glEnableVertexAttribArray(vNormal);
-	glVertexAttribPointer(vNormal, 3, GL_FLOAT, GL_FALSE, 0, BUFFER_OFFSET(sizeof(GLuint) * vertices.size()));
+	VertexLayout<PackedVertex>(shader)
+		.attribute("vPosition", &PackedVertex::position)
+		.attribute("vNormal", &PackedVertex::normal);
 
 	// Retrieve transformation uniform variable locations
 	ViewCamera = glGetUniformLocation(shader, "ViewCamera");
@@ -392,10 +207,17 @@ init()
 	wallIndex = glGetUniformLocation(shader, "wallIndex");
 	sphereIndex = glGetUniformLocation(shader, "sphereIndex");
 	groundShadowIndex = glGetUniformLocation(shader, "groundShadowIndex");
-	glUniform1i(groundIndex, endOfGround);
-	glUniform1i(wallIndex, endOfWall);
-	glUniform1i(sphereIndex, endOfSpehre);
-	glUniform1i(groundShadowIndex, enfOfGroundShadow);
+	SphereRadius = glGetUniformLocation(shader, "SphereRadius");
+	glUniform1i(groundIndex, baseVertex[WallMesh]);
+	glUniform1i(wallIndex, baseVertex[BallMeshes]);
+	glUniform1i(sphereIndex, baseVertex[GroundShadow]);
+	glUniform1i(groundShadowIndex, baseVertex[WallShadow]);
+	glUniform2f(glGetUniformLocation(shader, "BallTiles"), BALL_TILES_AROUND, BALL_TILES_DOWN);
+
+	glUniform1i(glGetUniformLocation(shader, "ProceduralCheckers"), checkers > 0);
+	glUniform1f(glGetUniformLocation(shader, "CheckerSize"), PLANE_LENGTH / glm::max(checkers, 1));
+	glUniform2f(glGetUniformLocation(shader, "GroundChecker"), PLANE_X, GROUND_Y);
+	glUniform2f(glGetUniformLocation(shader, "WallChecker"), PLANE_X, WALL_Z);
 
 	initLight(shader);
 
@@ -415,29 +237,39 @@ display(void)
 
 	glm::vec3 viewer_pos(0.0, 0.0, 6.9);
 
+	// Where the ball is between the last two physics steps
+	glm::vec3 position = glm::mix(prevPosition, game.position, alpha);
+	GLfloat dTheta = game.theta[Yaxis] - prevTheta;
+	if (dTheta > 180.0) {
+		dTheta -= 360.0;
+	}
+	else if (dTheta < -180.0) {
+		dTheta += 360.0;
+	}
+	GLfloat theta = prevTheta + dTheta * alpha;
 
 	//  Generate model-view matrices
 	glm::mat4 view_sphere;
 	{
 		glm::mat4 trans, rot;
-		trans = glm::translate(trans, currPosition);
+		trans = glm::translate(trans, position);
 		trans = glm::translate(trans, -viewer_pos);
 
 		rot = glm::rotate(rot, glm::radians(-20.0f), glm::vec3(0, 0, 1)); // 3
 		rot = glm::rotate(rot, glm::radians(90.0f), glm::vec3(1, 0, 0)); // 2
-		rot = glm::rotate(rot, glm::radians(Theta[Yaxis]), glm::vec3(0, 0, 1)); // 1	
+		rot = glm::rotate(rot, glm::radians(theta), glm::vec3(0, 0, 1)); // 1	
 		view_sphere = trans * rot;
 	}
 
 	glm::mat4 view_wall_shadow;
 	{
-		glm::vec3 u = glm::normalize(lightPositionNear + currPosition);
+		glm::vec3 u = glm::normalize(lightPositionNear + position);
 		float steps = lightPositionNear.z / u.z; // how much longer than normalized
 		float magicFactor = 0.3; // pretend that the light is further than it actually is 
 		float dy = u.y * steps * magicFactor; // undo normalization 
 
 		glm::mat4 trans;
-		glm::vec3 change(currPosition.x, currPosition.y + dy, walls[farWall] + 0.01);
+		glm::vec3 change(position.x, position.y + dy, walls[farWall] + 0.01);
 		trans = glm::translate(trans, change);
 		trans = glm::translate(trans, -viewer_pos);
 		view_wall_shadow = trans;
@@ -445,13 +277,13 @@ display(void)
 
 	glm::mat4 view_ground_shadow;
 	{
-		glm::vec3 u = glm::normalize(lightPositionTop + currPosition);
+		glm::vec3 u = glm::normalize(lightPositionTop + position);
 		float steps = lightPositionTop.y / u.y; // how much longer than normalized
 		float magicFactor = 0.3; // pretend that the light is further than it actually is 
 		float dx = u.x * steps * magicFactor; // undo normalization 
 
 		glm::mat4 trans;
-		glm::vec3 change(currPosition.x + dx, ground + 0.01, currPosition.z);
+		glm::vec3 change(position.x + dx, ground + 0.01, position.z);
 		trans = glm::translate(trans, change);
 		trans = glm::translate(trans, -viewer_pos);
 		view_ground_shadow = trans;
@@ -472,12 +304,12 @@ display(void)
 		trans = glm::mat4();
 		rot = glm::mat4();
 
-		if (view == 1)
+		if (game.view == 1)
 		{
 			trans = glm::translate(trans, glm::vec3(0, -7.5, -5.3));
 			rot = glm::rotate(rot, glm::radians(80.0f), glm::vec3(1, 0, 0)); // 3		
 		}
-		else if (view == 2)
+		else if (game.view == 2)
 		{
 			trans = glm::translate(trans, glm::vec3(7, 0, -7));
 			rot = glm::rotate(rot, glm::radians(90.0f), glm::vec3(0, 1, 0)); // 3	
@@ -501,7 +333,22 @@ display(void)
 	glUniformMatrix4fv(ViewSphereInvTra, 1, GL_FALSE, glm::value_ptr(glm::transpose(glm::inverse(view_sphere))));
 	glUniformMatrix4fv(ViewGroundInvTra, 1, GL_FALSE, glm::value_ptr(glm::transpose(glm::inverse(view_ground))));
 
-	glDrawElements(GL_TRIANGLES, indices.size(), GL_UNSIGNED_INT, 0);
+	glUniform1f(SphereRadius, radius); // a snapshot may change it
+
+	// The radius of the ball on the screen in pixels picks its level
+	const glm::vec3 centre(view_camera * view_sphere * glm::vec4(0, 0, 0, 1));
+	const float distance2 = glm::dot(centre, centre) - radius * radius;
+	const float pixels = distance2 > 0.0f
+		? radius / std::sqrt(distance2) * projection[1][1] * windowHeight / 2 : 1e9f;
+	const int ballLod = BallMeshes + selectSphereLod(SPHERE_LOD_SAGITTA, SPHERE_LODS, pixels, SPHERE_LOD_TOLERANCE);
+
+	for (int k = 0; k < NumMeshes; k++) {
+		if (k >= BallMeshes && k < GroundShadow && k != ballLod) {
+			continue;
+		}
+		glDrawElementsBaseVertex(GL_TRIANGLES, firstIndex[k + 1] - firstIndex[k], GL_UNSIGNED_SHORT,
+			BUFFER_OFFSET(sizeof(GLushort) * firstIndex[k]), baseVertex[k]);
+	}
 
 	//for (int i = 0; i < indices.size(); i += 3) {
 	//    glDrawElements(GL_LINE_LOOP, 3, GL_UNSIGNED_INT, (void*)(i * sizeof(GLuint)));
@@ -512,6 +359,24 @@ display(void)
 
 //----------------------------------------------------------------------------
 
+// Carry on from a snapshot written by 'o'
+static bool
+loadSnapshot(const std::string& path)
+{
+	Snapshot snapshot;
+	if (!snapshot.open(path)) {
+		return false;
+	}
+	snapshot.restoreGame(constants, game, stepCount);
+	prevPosition = game.position;
+	prevTheta = game.theta[Yaxis];
+	history.clear();
+	history.push(&game);
+	return true;
+}
+
+//----------------------------------------------------------------------------
+
 void
 keyboard(unsigned char key, int x, int y)
 {
@@ -520,47 +385,49 @@ keyboard(unsigned char key, int x, int y)
 	case 'q': case 'Q':
 		exit(EXIT_SUCCESS);
 		break;
-	case ' ':  // hold
-		view++;
-		if (view > 2) {
-			view = 0;
+	case 'o':
+		if (!saveSnapshot(snapshotPath, constants, game, stepCount, 0)) {
+			std::cerr << "Failed to write " << snapshotPath << std::endl;
 		}
 		break;
-	case 'e':  // hold
-		pause = !pause;
-		break;
-	case 'w':
-		rest = false;
-		vCurrent.z -= impulse;
-		break;
-	case 'a':
-		rest = false;
-		vCurrent.x -= impulse;
-		break;
-	case 's':
-		rest = false;
-		vCurrent.z += impulse;
-		break;
-	case 'd':
-		rest = false;
-		vCurrent.x += impulse;
-		break;
-	case 'j':
-		rest = false;
-		vCurrent.y += impulse;
+	case 'l':
+		if (replaying || !recordPath.empty()) {
+			break; // a jump would not be in the log
+		}
+		if (!loadSnapshot(snapshotPath)) {
+			std::cerr << "Failed to read " << snapshotPath << std::endl;
+		}
 		break;
-	case 'k':
-		rest = false;
-		vCurrent.y = 0;
-		vCurrent.x = 0;
-		vCurrent.z = 0;
+	case 'b': {
+		if (replaying || !recordPath.empty()) {
+			break; // a jump would not be in the log
+		}
+		bool pause = game.pause; // stay paused to scrub on
+		for (int i = 0; i < REWIND_STEPS; i++) {
+			if (!history.back(&game)) {
+				break;
+			}
+		}
+		game.pause = pause;
+		prevPosition = game.position;
+		prevTheta = game.theta[Yaxis];
 		break;
-	case 'r': // restart
-		rest = false;
-		currPosition = glm::vec3(0, 1, -1);
-		vCurrent = glm::vec3(impulse, impulse, impulse);
+	}
+	default:
+		if (replaying) {
+			break; // the keys come from the log
+		}
+		if (key == 'r') {
+			history.push(&game); // keys since the last step are in no frame
+		}
+		if (gameKey(game, constants, key) && !recordPath.empty()) {
+			inputLog.record(stepCount, key);
+		}
+		if (key == 'r') {
+			prevPosition = game.position; // don't blend across the jump
+			history.push(&game);
+		}
 		break;
-
 	}
 }
 
@@ -581,67 +448,50 @@ mouse(int button, int state, int x, int y)
 
 //----------------------------------------------------------------------------
 
-bool clockwiseRotation = true;
+// Press the keys of the log that came before this step. At the end of the
+// log, check that the game got to the recorded end state and hand it back to
+// the keyboard.
+void
+replayKeys()
+{
+	const std::vector<InputLog::Event>& events = inputLog.events;
+	while (nextEvent < events.size() && events[nextEvent].step <= stepCount) {
+		gameKey(game, constants, events[nextEvent++].key);
+	}
+	if (stepCount < inputLog.steps) {
+		return;
+	}
+	while (nextEvent < events.size()) {
+		gameKey(game, constants, events[nextEvent++].key);
+	}
+	replaying = false;
+	bool same = hashState(game) == hashState(inputLog.end);
+	std::cout << "Replay finished after " << stepCount << " steps, "
+		<< (same ? "same end state as recorded" : "END STATE DIFFERS from the recording") << std::endl;
+}
 
 void
 update(void)
 {
+	prevPosition = game.position;
+	prevTheta = game.theta[Yaxis];
 
-
-	if (!pause && !rest) {
-		if (clockwiseRotation) {
-			Theta[Yaxis] -= 2;
-		}
-		else {
-			Theta[Yaxis] += 2;
-		}
-
-		if (Theta[Yaxis] > 360.0) {
-			Theta[Yaxis] -= 360.0;
-		}
-		else if (Theta[Yaxis] < 0) {
-			Theta[Yaxis] += 360.0;
-		}
-
-
-		// apply forces to move 
-		currPosition += vCurrent;
-		currPosition.y += gravity;
-
-		// collision detection 
-		if (currPosition.y <= ground + radius) {
-			currPosition.y = ground + radius;
-			vCurrent.y = -vCurrent.y;
-			if (abs(vCurrent.y) <= abs(gravity))
-			{
-				rest = true;
-				vCurrent = glm::vec3(0, 0, 0);
-			}
-		}
-		if (currPosition.x >= walls[rightWall] - radius) {
-			currPosition.x = walls[rightWall] - radius;
-			vCurrent.x = -vCurrent.x;
-		}
-		else if (currPosition.x <= walls[leftWall] + radius) {
-			currPosition.x = walls[leftWall] + radius;
-			vCurrent.x = -vCurrent.x;
-		}
-
-		if (currPosition.z >= walls[nearWall] - radius) {
-			currPosition.z = walls[nearWall] - radius;
-			vCurrent.z = -vCurrent.z;
-		}
-		else if (currPosition.z <= walls[farWall] + radius) {
-			currPosition.z = walls[farWall] + radius;
-			vCurrent.z = -vCurrent.z;
-			//clockwiseRotation = !clockwiseRotation;
-
-		}
-
-		// apply gravity to a new force
-		vCurrent.y += gravity;
+	if (replaying) {
+		replayKeys();
+	}
+	stepGame(game, constants);
+	stepCount++;
+	if (!game.pause) {
+		history.push(&game);
 	}
+}
+
+//----------------------------------------------------------------------------
 
+void
+interpolate(double a)
+{
+	alpha = float(a);
 }
 
 //----------------------------------------------------------------------------
@@ -652,8 +502,59 @@ reshape(int width, int height)
 	glViewport(0, 0, width, height);
 
 	GLfloat aspect = GLfloat(width) / height;
-	glm::mat4  projection = glm::perspective(glm::radians(45.0f), aspect, 0.5f, 20.0f);
+	projection = glm::perspective(glm::radians(45.0f), aspect, 0.5f, 20.0f);
+	windowHeight = height;
 
 	projection = projection;
 	glUniformMatrix4fv(Projection, 1, GL_FALSE, glm::value_ptr(projection));
 }
+
+//----------------------------------------------------------------------------
+
+static void
+saveRecording()
+{
+	inputLog.finish(stepCount, game);
+	if (!inputLog.save(recordPath)) {
+		std::cerr << "Failed to write " << recordPath << std::endl;
+	}
+}
+
+void
+setOptions(int argc, char** argv)
+{
+	for (int i = 1; i + 1 < argc; i++) {
+		if (std::strcmp(argv[i], "-record") == 0) {
+			recordPath = argv[++i];
+			inputLog.begin(constants, game);
+			atexit(saveRecording);
+		}
+		else if (std::strcmp(argv[i], "-replay") == 0) {
+			if (!inputLog.load(argv[++i])) {
+				std::cerr << "Failed to read " << argv[i] << std::endl;
+				exit(EXIT_FAILURE);
+			}
+			constants = inputLog.constants;
+			game = inputLog.start;
+			prevPosition = game.position;
+			replaying = true;
+		}
+		else if (std::strcmp(argv[i], "-checkers") == 0) {
+			checkers = std::max(std::atoi(argv[++i]), 0);
+		}
+		else if (std::strcmp(argv[i], "-snapshot") == 0) {
+			snapshotPath = argv[++i];
+		}
+		else if (std::strcmp(argv[i], "-restore") == 0) {
+			if (!loadSnapshot(argv[++i])) {
+				std::cerr << "Failed to read " << argv[i] << std::endl;
+				exit(EXIT_FAILURE);
+			}
+		}
+	}
+
+	// The start, so 'b' can go all the way back to it
+	if (history.size() == 0) {
+		history.push(&game);
+	}
+}
@@ -0,0 +1,263 @@
+#include "snapshot.h"
+#include "ballworld.h"
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#ifdef _WIN32
+#  define NOMINMAX
+#  include <windows.h>
+#else
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <unistd.h>
+#endif
+
+static const char MAGIC[4] = { 'B', 'S', 'N', 'P' };
+static const unsigned VERSION = 2;
+static const unsigned BYTE_ORDER_MARK = 0x01020304;
+static const size_t ALIGNMENT = 64;
+
+static const size_t elementSize[SnapshotHeader::NumArrays] = {
+	sizeof(float), sizeof(float), sizeof(float),
+	sizeof(float), sizeof(float), sizeof(float),
+	sizeof(float), sizeof(unsigned char), sizeof(int), sizeof(int),
+	sizeof(unsigned long long), sizeof(float),
+};
+
+// Entries of an array
+static size_t
+arrayLength(const SnapshotHeader& h, int which)
+{
+	return which < SnapshotHeader::ImpulseKeys ? h.balls : h.impulses;
+}
+
+static size_t
+alignUp(size_t n)
+{
+	return (n + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+}
+
+// The arrays of the balls of a world in the order of the header
+static void
+worldArrays(const BallWorld& w, const void* arrays[SnapshotHeader::ImpulseKeys])
+{
+	const void* list[SnapshotHeader::ImpulseKeys] = {
+		w.x.data(), w.y.data(), w.z.data(),
+		w.vx.data(), w.vy.data(), w.vz.data(),
+		w.radius.data(), w.restFlag.data(), w.quietSteps.data(), w.nextInIsland.data(),
+	};
+	std::memcpy(arrays, list, sizeof(list));
+}
+
+bool
+saveSnapshot(const std::string& path, const GameConstants& constants, const GameState& game,
+	unsigned steps, const BallWorld* world)
+{
+	SnapshotHeader h;
+	std::memset(static_cast<void*>(&h), 0, sizeof(h)); // no stray padding bytes in the file
+	std::memcpy(h.magic, MAGIC, 4);
+	h.version = VERSION;
+	h.byteOrder = BYTE_ORDER_MARK;
+	h.headerSize = sizeof(SnapshotHeader);
+	h.constantsSize = sizeof(GameConstants);
+	h.stateSize = sizeof(GameState);
+	h.constants = constants;
+	h.game = game;
+	h.steps = steps;
+
+	const void* arrays[SnapshotHeader::NumArrays] = {};
+	std::vector<unsigned long long> impulseKeys;
+	std::vector<float> impulses;
+	if (world) {
+		h.balls = world->size();
+		h.gravity = world->gravity;
+		h.room = world->room;
+		h.restitution = world->restitution;
+		h.sleepSpeed = world->sleepSpeed;
+		h.sleepSteps = world->sleepSteps;
+		h.collideBalls = world->collideBalls;
+		h.allowSleep = world->allowSleep;
+		h.broadphaseType = (unsigned char)world->broadphaseType;
+		h.contactSolver = (unsigned char)world->contactSolver;
+		h.solverIterations = world->solverIterations;
+		h.warmStart = world->warmStart;
+		worldArrays(*world, arrays);
+
+		h.impulses = world->cachedImpulseCount();
+		impulseKeys.resize(h.impulses);
+		impulses.resize(h.impulses);
+		world->getCachedImpulses(impulseKeys.data(), impulses.data());
+		arrays[SnapshotHeader::ImpulseKeys] = impulseKeys.data();
+		arrays[SnapshotHeader::Impulses] = impulses.data();
+	}
+
+	size_t at = alignUp(sizeof(SnapshotHeader));
+	for (int k = 0; k < SnapshotHeader::NumArrays; k++) {
+		h.offsets[k] = at;
+		at = alignUp(at + arrayLength(h, k) * elementSize[k]);
+	}
+	h.fileSize = at;
+
+	FILE* fp = fopen(path.c_str(), "wb");
+	if (!fp) {
+		return false;
+	}
+	static const unsigned char zeros[ALIGNMENT] = {};
+	bool ok = fwrite(&h, sizeof(h), 1, fp) == 1;
+	size_t written = sizeof(h);
+	for (int k = 0; k < SnapshotHeader::NumArrays && ok; k++) {
+		ok = fwrite(zeros, 1, size_t(h.offsets[k]) - written, fp) == size_t(h.offsets[k]) - written;
+		const size_t bytes = arrayLength(h, k) * elementSize[k];
+		ok = ok && (bytes == 0 || fwrite(arrays[k], 1, bytes, fp) == bytes);
+		written = size_t(h.offsets[k]) + bytes;
+	}
+	ok = ok && fwrite(zeros, 1, size_t(h.fileSize) - written, fp) == size_t(h.fileSize) - written;
+	return fclose(fp) == 0 && ok;
+}
+
+//----------------------------------------------------------------------------
+
+Snapshot::Snapshot()
+	: data(0), size(0)
+#ifdef _WIN32
+	, file(0), mapping(0)
+#endif
+{
+}
+
+Snapshot::~Snapshot()
+{
+	close();
+}
+
+bool
+Snapshot::open(const std::string& path)
+{
+	close();
+
+#ifdef _WIN32
+	HANDLE f = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (f == INVALID_HANDLE_VALUE) {
+		return false;
+	}
+	LARGE_INTEGER fileSize;
+	GetFileSizeEx(f, &fileSize);
+	HANDLE m = fileSize.QuadPart > 0 ? CreateFileMappingA(f, NULL, PAGE_READONLY, 0, 0, NULL) : NULL;
+	void* view = m ? MapViewOfFile(m, FILE_MAP_READ, 0, 0, 0) : NULL;
+	if (!view) {
+		if (m) {
+			CloseHandle(m);
+		}
+		CloseHandle(f);
+		return false;
+	}
+	file = f;
+	mapping = m;
+	data = view;
+	size = size_t(fileSize.QuadPart);
+#else
+	int fd = ::open(path.c_str(), O_RDONLY);
+	if (fd < 0) {
+		return false;
+	}
+	struct stat st;
+	void* view = MAP_FAILED;
+	if (fstat(fd, &st) == 0 && st.st_size > 0) {
+		view = mmap(0, size_t(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+	}
+	::close(fd); // the mapping stays valid
+	if (view == MAP_FAILED) {
+		return false;
+	}
+	data = view;
+	size = size_t(st.st_size);
+#endif
+
+	const SnapshotHeader& h = header();
+	bool ok = size >= sizeof(SnapshotHeader)
+		&& std::memcmp(h.magic, MAGIC, 4) == 0
+		&& h.version == VERSION
+		&& h.byteOrder == BYTE_ORDER_MARK
+		&& h.headerSize == sizeof(SnapshotHeader)
+		&& h.constantsSize == sizeof(GameConstants)
+		&& h.stateSize == sizeof(GameState)
+		&& h.fileSize == size;
+	for (int k = 0; k < SnapshotHeader::NumArrays && ok; k++) {
+		ok = h.offsets[k] % ALIGNMENT == 0 && h.offsets[k] + arrayLength(h, k) * elementSize[k] <= size;
+	}
+	if (!ok) {
+		close();
+	}
+	return ok;
+}
+
+void
+Snapshot::close()
+{
+	if (!data) {
+		return;
+	}
+#ifdef _WIN32
+	UnmapViewOfFile(data);
+	CloseHandle(mapping);
+	CloseHandle(file);
+	file = mapping = 0;
+#else
+	munmap(data, size);
+#endif
+	data = 0;
+	size = 0;
+}
+
+const void*
+Snapshot::array(int which) const
+{
+	return static_cast<const char*>(data) + header().offsets[which];
+}
+
+void
+Snapshot::restoreGame(GameConstants& constants, GameState& game, unsigned& steps) const
+{
+	const SnapshotHeader& h = header();
+	constants = h.constants;
+	game = h.game;
+	steps = h.steps;
+}
+
+void
+Snapshot::restoreWorld(BallWorld& world) const
+{
+	const SnapshotHeader& h = header();
+	const int n = int(h.balls);
+	world.gravity = h.gravity;
+	world.room = h.room;
+	world.restitution = h.restitution;
+	world.sleepSpeed = h.sleepSpeed;
+	world.sleepSteps = h.sleepSteps;
+	world.collideBalls = h.collideBalls != 0;
+	world.allowSleep = h.allowSleep != 0;
+	world.broadphaseType = BroadphaseType(h.broadphaseType);
+	world.contactSolver = ContactSolverType(h.contactSolver);
+	world.solverIterations = h.solverIterations;
+	world.warmStart = h.warmStart != 0;
+
+	world.x.resize(n); world.y.resize(n); world.z.resize(n);
+	world.vx.resize(n); world.vy.resize(n); world.vz.resize(n);
+	world.radius.resize(n);
+	world.restFlag.resize(n);
+	world.quietSteps.resize(n);
+	world.nextInIsland.resize(n);
+
+	const void* arrays[SnapshotHeader::ImpulseKeys];
+	worldArrays(world, arrays);
+	for (int k = 0; k < SnapshotHeader::ImpulseKeys; k++) {
+		if (n > 0) {
+			std::memcpy(const_cast<void*>(arrays[k]), array(k), n * elementSize[k]);
+		}
+	}
+	world.setCachedImpulses(int(h.impulses), static_cast<const unsigned long long*>(array(SnapshotHeader::ImpulseKeys)),
+		static_cast<const float*>(array(SnapshotHeader::Impulses)));
+}
@@ -0,0 +1,87 @@
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+#include "game.h"
+
+#include <cstddef>
+#include <string>
+
+class BallWorld;
+
+// The whole state of a run in one flat file: the game ball with its
+// constants, the step count and optionally a BallWorld. A header of fixed
+// size holds everything but the per-ball arrays and the impulses the
+// contact solver keeps, which follow it each 64-byte aligned. Nothing is parsed: writing is one write per array and
+// reading maps the file and copies each array out with one memcpy, or
+// reads the arrays in place.
+//
+// A snapshot is for the machine and build that wrote it. The header keeps
+// the byte order and the struct sizes, and open() refuses a file where
+// they differ instead of converting.
+struct SnapshotHeader
+{
+	// The arrays of every ball, then the warm start cache of the contact
+	// solver as keys and impulses
+	enum { X, Y, Z, VX, VY, VZ, Radius, RestFlag, QuietSteps, NextInIsland, ImpulseKeys, Impulses, NumArrays };
+
+	char magic[4]; // "BSNP"
+	unsigned version;
+	unsigned byteOrder; // 0x01020304 as the writer stored it
+	unsigned headerSize, constantsSize, stateSize;
+
+	GameConstants constants;
+	GameState game;
+	unsigned steps;
+
+	// BallWorld settings, balls is 0 when there is no world
+	unsigned balls;
+	float gravity;
+	Room room;
+	float restitution;
+	float sleepSpeed;
+	int sleepSteps;
+	unsigned char collideBalls, allowSleep, broadphaseType, contactSolver;
+	int solverIterations;
+	unsigned char warmStart, unused[3];
+	unsigned impulses; // entries of the warm start cache
+
+	unsigned long long offsets[NumArrays]; // of every array from the start of the file
+	unsigned long long fileSize;
+};
+
+// Returns false if the file cannot be written
+bool saveSnapshot(const std::string& path, const GameConstants& constants, const GameState& game,
+	unsigned steps, const BallWorld* world);
+
+class Snapshot
+{
+public:
+	Snapshot();
+	~Snapshot();
+
+	// Map a snapshot file. Returns false if it is missing, not a snapshot,
+	// truncated, or from another version, byte order or build.
+	bool open(const std::string& path);
+	void close();
+
+	const SnapshotHeader& header() const { return *static_cast<const SnapshotHeader*>(data); }
+
+	// An array of the world in the mapped file, valid until close()
+	const void* array(int which) const;
+
+	void restoreGame(GameConstants& constants, GameState& game, unsigned& steps) const;
+	void restoreWorld(BallWorld& world) const;
+
+private:
+	Snapshot(const Snapshot&);
+	Snapshot& operator=(const Snapshot&);
+
+	void* data;
+	size_t size;
+#ifdef _WIN32
+	void* file;
+	void* mapping;
+#endif
+};
+
+#endif // SNAPSHOT_H
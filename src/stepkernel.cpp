@@ -0,0 +1,443 @@
+#include "stepkernel.h"
+
+#include <glm/glm.hpp>
+#include <glm/simd/platform.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+// Every test picks between two values instead of jumping. Balls at rest
+// move by a step of zero length, so blocks with a few sleeping balls in
+// them can still go through here in one piece.
+// With Monitor the balls are also added to stats after the step; without
+// it that code is not compiled in at all.
+template <bool Monitor>
+static void
+stepScalar(int n, float g, const Room& room,
+	float* __restrict px, float* __restrict py, float* __restrict pz,
+	float* __restrict pvx, float* __restrict pvy, float* __restrict pvz,
+	const float* __restrict pr, unsigned char* __restrict rest, StepStats* stats)
+{
+	const float gAbs = std::abs(g);
+	const float groundY = room.ground;
+	const float ceilingY = room.ceiling;
+	const float leftX = room.walls[leftWall];
+	const float rightX = room.walls[rightWall];
+	const float farZ = room.walls[farWall];
+	const float nearZ = room.walls[nearWall];
+	StepStats sum;
+
+	for (int i = 0; i < n; i++) {
+		const float r = pr[i];
+		const float ox = px[i], oy = py[i], oz = pz[i];
+		const float ovx = pvx[i], ovy = pvy[i], ovz = pvz[i];
+		const float dt = rest[i] ? 0.0f : 1.0f; // a select on the stores would stop vectorizing
+
+		// apply forces to move
+		float nx = ox + ovx * dt;
+		float ny = oy + ovy * dt;
+		float nz = oz + ovz * dt;
+		ny += g * dt;
+		float nvx = ovx;
+		float nvy = ovy;
+		float nvz = ovz;
+
+		// collision detection
+		const float topY = ceilingY - r;
+		const bool hitCeiling = ny >= topY;
+		const float raisedY = ny - topY;
+		ny = hitCeiling ? topY : ny;
+		nvy = hitCeiling ? -nvy : nvy;
+
+		const float floorY = groundY + r;
+		const bool hitGround = ny <= floorY;
+		const float sunkY = floorY - ny;
+		ny = hitGround ? floorY : ny;
+		nvy = hitGround ? -nvy : nvy;
+		const float stopSpeed = hitGround ? gAbs : -1.0f; // only stop on the ground
+		const bool stop = std::abs(nvy) <= stopSpeed;
+
+		const float hiX = rightX - r, loX = leftX + r;
+		float flipX = nx <= loX ? -1.0f : 1.0f;
+		flipX = nx >= hiX ? -1.0f : flipX;
+		const float wallX = nx >= hiX ? hiX : loX;
+		const bool hitX = flipX < 0.0f;
+		const float pastX = std::max(loX - nx, nx - hiX);
+		nx = hitX ? wallX : nx;
+
+		const float hiZ = nearZ - r, loZ = farZ + r;
+		float flipZ = nz <= loZ ? -1.0f : 1.0f;
+		flipZ = nz >= hiZ ? -1.0f : flipZ;
+		const float wallZ = nz >= hiZ ? hiZ : loZ;
+		const bool hitZ = flipZ < 0.0f;
+		const float pastZ = std::max(loZ - nz, nz - hiZ);
+		nz = hitZ ? wallZ : nz;
+
+		// stopping zeroes the velocity before the walls turn it, as in
+		// update(), which leaves a -0 after a wall
+		nvx = stop ? 0.0f : nvx;
+		nvz = stop ? 0.0f : nvz;
+		nvx = hitX ? -nvx : nvx;
+		nvz = hitZ ? -nvz : nvz;
+
+		// apply gravity to a new force
+		nvy = stop ? g : nvy + g * dt;
+
+		px[i] = nx;
+		py[i] = ny;
+		pz[i] = nz;
+		pvx[i] = nvx;
+		pvy[i] = nvy;
+		pvz[i] = nvz;
+		rest[i] |= (unsigned char)stop;
+
+		if (Monitor) {
+			// a ball that stopped keeps g in vy, but is not moving
+			const double m = double(r) * r * r;
+			const double moving = stop ? 0.0 : dt;
+			const float depth = dt * std::max(std::max(std::max(sunkY, raisedY), std::max(pastX, pastZ)), 0.0f);
+			sum.kinetic += 0.5 * m * moving * (double(nvx) * nvx + double(nvy) * nvy + double(nvz) * nvz);
+			sum.potential += m * gAbs * (ny - groundY);
+			sum.momentum += m * moving * glm::dvec3(nvx, nvy, nvz);
+			sum.penetration += depth;
+			sum.maxPenetration = std::max(sum.maxPenetration, depth);
+			sum.bounces += (long long)(dt * (int(hitCeiling) + int(hitGround) + int(hitX) + int(hitZ)));
+		}
+	}
+	if (Monitor) {
+		sum.balls = n;
+		stats->add(sum);
+	}
+}
+
+void
+stepBallsScalar(int n, float g, const Room& room,
+	float* px, float* py, float* pz,
+	float* pvx, float* pvy, float* pvz,
+	const float* pr, unsigned char* rest)
+{
+	stepScalar<false>(n, g, room, px, py, pz, pvx, pvy, pvz, pr, rest, 0);
+}
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+// The few operations the kernel needs, for 4 lanes of SSE2 and 8 of AVX2.
+// A mask has all bits set in the lanes where a test holds, so it is -1 as
+// an int and count() adds 1 in those lanes.
+struct Lanes4
+{
+	typedef __m128 Float;
+	typedef __m128i Int;
+	enum { width = 4 };
+
+	static Float load(const float* p) { return _mm_loadu_ps(p); }
+	static void store(float* p, Float a) { _mm_storeu_ps(p, a); }
+	static Float set(float a) { return _mm_set1_ps(a); }
+	static Float add(Float a, Float b) { return _mm_add_ps(a, b); }
+	static Float sub(Float a, Float b) { return _mm_sub_ps(a, b); }
+	static Float mul(Float a, Float b) { return _mm_mul_ps(a, b); }
+	static Float lessEqual(Float a, Float b) { return _mm_cmple_ps(a, b); }
+	static Float greaterEqual(Float a, Float b) { return _mm_cmpge_ps(a, b); }
+	static Float both(Float a, Float b) { return _mm_and_ps(a, b); }
+	static Float either(Float a, Float b) { return _mm_or_ps(a, b); }
+	static Float andNot(Float mask, Float a) { return _mm_andnot_ps(mask, a); }
+	static Float negate(Float a) { return _mm_xor_ps(a, _mm_set1_ps(-0.0f)); }
+	static Float abs(Float a) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), a); }
+	static Float max(Float a, Float b) { return _mm_max_ps(a, b); }
+	static int bits(Float mask) { return _mm_movemask_ps(mask); }
+	static Int noInts() { return _mm_setzero_si128(); }
+	static Int count(Int counts, Float mask) { return _mm_sub_epi32(counts, _mm_castps_si128(mask)); }
+	static void storeInts(int* p, Int a) { _mm_storeu_si128(reinterpret_cast<__m128i*>(p), a); }
+
+	// pick a where mask is set, else b
+	static Float select(Float mask, Float a, Float b)
+	{
+		return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+	}
+
+	// set in the lanes whose rest flag is not 0
+	static Float restMask(const unsigned char* rest)
+	{
+		int word;
+		std::memcpy(&word, rest, 4);
+		const __m128i zero = _mm_setzero_si128();
+		__m128i wide = _mm_unpacklo_epi8(_mm_cvtsi32_si128(word), zero);
+		wide = _mm_unpacklo_epi16(wide, zero);
+		return _mm_castsi128_ps(_mm_xor_si128(_mm_cmpeq_epi32(wide, zero), _mm_set1_epi32(-1)));
+	}
+};
+
+#if GLM_ARCH & GLM_ARCH_AVX2_BIT
+struct Lanes8
+{
+	typedef __m256 Float;
+	typedef __m256i Int;
+	enum { width = 8 };
+
+	static Float load(const float* p) { return _mm256_loadu_ps(p); }
+	static void store(float* p, Float a) { _mm256_storeu_ps(p, a); }
+	static Float set(float a) { return _mm256_set1_ps(a); }
+	static Float add(Float a, Float b) { return _mm256_add_ps(a, b); }
+	static Float sub(Float a, Float b) { return _mm256_sub_ps(a, b); }
+	static Float mul(Float a, Float b) { return _mm256_mul_ps(a, b); }
+	static Float lessEqual(Float a, Float b) { return _mm256_cmp_ps(a, b, _CMP_LE_OQ); }
+	static Float greaterEqual(Float a, Float b) { return _mm256_cmp_ps(a, b, _CMP_GE_OQ); }
+	static Float both(Float a, Float b) { return _mm256_and_ps(a, b); }
+	static Float either(Float a, Float b) { return _mm256_or_ps(a, b); }
+	static Float andNot(Float mask, Float a) { return _mm256_andnot_ps(mask, a); }
+	static Float negate(Float a) { return _mm256_xor_ps(a, _mm256_set1_ps(-0.0f)); }
+	static Float abs(Float a) { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a); }
+	static Float max(Float a, Float b) { return _mm256_max_ps(a, b); }
+	static int bits(Float mask) { return _mm256_movemask_ps(mask); }
+	static Int noInts() { return _mm256_setzero_si256(); }
+	static Int count(Int counts, Float mask) { return _mm256_sub_epi32(counts, _mm256_castps_si256(mask)); }
+	static void storeInts(int* p, Int a) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), a); }
+	static Float select(Float mask, Float a, Float b) { return _mm256_blendv_ps(b, a, mask); }
+
+	static Float restMask(const unsigned char* rest)
+	{
+		__m256i wide = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(rest)));
+		__m256i isZero = _mm256_cmpeq_epi32(wide, _mm256_setzero_si256());
+		return _mm256_castsi256_ps(_mm256_xor_si256(isZero, _mm256_set1_epi32(-1)));
+	}
+};
+typedef Lanes8 Lanes;
+#else
+typedef Lanes4 Lanes;
+#endif
+
+// The sums of StepStats one per lane. Floats lose too much over a million
+// balls, so they go into the doubles of StepStats every few blocks, and the
+// bounces with them before an int lane could overflow.
+template <class L>
+struct LaneStats
+{
+	typedef typename L::Float F;
+	typedef typename L::Int I;
+	enum { blocks = 64 }; // blocks summed as floats
+
+	F kinetic, potential, momentumX, momentumY, momentumZ, penetration, maxPenetration;
+	I bounces;
+
+	LaneStats() { clear(); maxPenetration = L::set(0.0f); }
+
+	void
+	clear()
+	{
+		kinetic = potential = momentumX = momentumY = momentumZ = penetration = L::set(0.0f);
+		bounces = L::noInts();
+	}
+
+	static double
+	sum(F a)
+	{
+		float lanes[L::width];
+		L::store(lanes, a);
+		double total = 0.0;
+		for (int k = 0; k < L::width; k++) {
+			total += lanes[k];
+		}
+		return total;
+	}
+
+	void
+	flush(StepStats& stats)
+	{
+		stats.kinetic += sum(kinetic);
+		stats.potential += sum(potential);
+		stats.momentum += glm::dvec3(sum(momentumX), sum(momentumY), sum(momentumZ));
+		stats.penetration += sum(penetration);
+		int lanes[L::width];
+		L::storeInts(lanes, bounces);
+		for (int k = 0; k < L::width; k++) {
+			stats.bounces += lanes[k];
+		}
+		clear();
+	}
+
+	// after the last flush()
+	void
+	finish(StepStats& stats)
+	{
+		float lanes[L::width];
+		L::store(lanes, maxPenetration);
+		for (int k = 0; k < L::width; k++) {
+			stats.maxPenetration = std::max(stats.maxPenetration, lanes[k]);
+		}
+	}
+};
+
+// stepBallsScalar() for Lanes::width balls at a time, returns how many balls
+// were done. Every operation is the one of the scalar loop in the same
+// order, so the results are the same to the bit. Monitor adds to stats as
+// stepScalar() does.
+template <class L, bool Monitor>
+static int
+stepLanes(int n, float g, const Room& room,
+	float* px, float* py, float* pz,
+	float* pvx, float* pvy, float* pvz,
+	const float* pr, unsigned char* rest, StepStats* stats)
+{
+	typedef typename L::Float F;
+	LaneStats<L> sums;
+	const F zero = L::set(0.0f);
+	const F half = L::set(0.5f);
+
+	const F vg = L::set(g);
+	const F gAbs = L::set(std::abs(g));
+	const F one = L::set(1.0f);
+	const F minusOne = L::set(-1.0f);
+	const F groundY = L::set(room.ground);
+	const F ceilingY = L::set(room.ceiling);
+	const F leftX = L::set(room.walls[leftWall]);
+	const F rightX = L::set(room.walls[rightWall]);
+	const F farZ = L::set(room.walls[farWall]);
+	const F nearZ = L::set(room.walls[nearWall]);
+
+	const int end = n - n % L::width;
+	for (int first = 0; first < end; first += LaneStats<L>::blocks * L::width) {
+		const int last = std::min(end, first + LaneStats<L>::blocks * L::width);
+		for (int i = first; i < last; i += L::width) {
+			const F r = L::load(pr + i);
+			const F ox = L::load(px + i), oy = L::load(py + i), oz = L::load(pz + i);
+			const F ovx = L::load(pvx + i), ovy = L::load(pvy + i), ovz = L::load(pvz + i);
+			const F resting = L::restMask(rest + i);
+			const F dt = L::andNot(resting, one);
+
+			// apply forces to move
+			F nx = L::add(ox, L::mul(ovx, dt));
+			F ny = L::add(oy, L::mul(ovy, dt));
+			F nz = L::add(oz, L::mul(ovz, dt));
+			ny = L::add(ny, L::mul(vg, dt));
+			F nvx = ovx;
+			F nvy = ovy;
+			F nvz = ovz;
+
+			// collision detection
+			const F topY = L::sub(ceilingY, r);
+			const F hitCeiling = L::greaterEqual(ny, topY);
+			const F raisedY = L::sub(ny, topY);
+			ny = L::select(hitCeiling, topY, ny);
+			nvy = L::select(hitCeiling, L::negate(nvy), nvy);
+
+			const F floorY = L::add(groundY, r);
+			const F hitGround = L::lessEqual(ny, floorY);
+			const F sunkY = L::sub(floorY, ny);
+			ny = L::select(hitGround, floorY, ny);
+			nvy = L::select(hitGround, L::negate(nvy), nvy);
+			const F stopSpeed = L::select(hitGround, gAbs, minusOne);
+			const F stop = L::lessEqual(L::abs(nvy), stopSpeed);
+
+			const F hiX = L::sub(rightX, r), loX = L::add(leftX, r);
+			const F pastHiX = L::greaterEqual(nx, hiX);
+			const F hitX = L::either(L::lessEqual(nx, loX), pastHiX);
+			const F pastX = L::max(L::sub(loX, nx), L::sub(nx, hiX));
+			nx = L::select(hitX, L::select(pastHiX, hiX, loX), nx);
+
+			const F hiZ = L::sub(nearZ, r), loZ = L::add(farZ, r);
+			const F pastHiZ = L::greaterEqual(nz, hiZ);
+			const F hitZ = L::either(L::lessEqual(nz, loZ), pastHiZ);
+			const F pastZ = L::max(L::sub(loZ, nz), L::sub(nz, hiZ));
+			nz = L::select(hitZ, L::select(pastHiZ, hiZ, loZ), nz);
+
+			nvx = L::andNot(stop, nvx);
+			nvz = L::andNot(stop, nvz);
+			nvx = L::select(hitX, L::negate(nvx), nvx);
+			nvz = L::select(hitZ, L::negate(nvz), nvz);
+
+			// apply gravity to a new force
+			nvy = L::select(stop, vg, L::add(nvy, L::mul(vg, dt)));
+
+			L::store(px + i, nx);
+			L::store(py + i, ny);
+			L::store(pz + i, nz);
+			L::store(pvx + i, nvx);
+			L::store(pvy + i, nvy);
+			L::store(pvz + i, nvz);
+
+			const int stopped = L::bits(stop);
+			for (int k = 0; k < L::width; k++) {
+				rest[i + k] |= (unsigned char)((stopped >> k) & 1);
+			}
+
+			if (Monitor) {
+				const F m = L::mul(L::mul(r, r), r);
+				const F moving = L::mul(m, L::andNot(stop, dt));
+				const F depth = L::mul(dt, L::max(L::max(L::max(sunkY, raisedY), L::max(pastX, pastZ)), zero));
+				const F speed2 = L::add(L::add(L::mul(nvx, nvx), L::mul(nvy, nvy)), L::mul(nvz, nvz));
+				sums.kinetic = L::add(sums.kinetic, L::mul(L::mul(half, moving), speed2));
+				sums.potential = L::add(sums.potential, L::mul(L::mul(m, gAbs), L::sub(ny, groundY)));
+				sums.momentumX = L::add(sums.momentumX, L::mul(moving, nvx));
+				sums.momentumY = L::add(sums.momentumY, L::mul(moving, nvy));
+				sums.momentumZ = L::add(sums.momentumZ, L::mul(moving, nvz));
+				sums.penetration = L::add(sums.penetration, depth);
+				sums.maxPenetration = L::max(sums.maxPenetration, depth);
+				sums.bounces = L::count(sums.bounces, L::andNot(resting, hitCeiling));
+				sums.bounces = L::count(sums.bounces, L::andNot(resting, hitGround));
+				sums.bounces = L::count(sums.bounces, L::andNot(resting, hitX));
+				sums.bounces = L::count(sums.bounces, L::andNot(resting, hitZ));
+			}
+		}
+		if (Monitor) {
+			sums.flush(*stats);
+		}
+	}
+	if (Monitor) {
+		sums.finish(*stats);
+		stats->balls += end;
+	}
+	return end;
+}
+
+#endif // GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+void
+stepBalls(int n, float g, const Room& room,
+	float* px, float* py, float* pz,
+	float* pvx, float* pvy, float* pvz,
+	const float* pr, unsigned char* rest)
+{
+	int done = 0;
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	done = stepLanes<Lanes, false>(n, g, room, px, py, pz, pvx, pvy, pvz, pr, rest, 0);
+#endif
+	stepBallsScalar(n - done, g, room, px + done, py + done, pz + done,
+		pvx + done, pvy + done, pvz + done, pr + done, rest + done);
+}
+
+void
+stepBallsMonitored(int n, float g, const Room& room,
+	float* px, float* py, float* pz,
+	float* pvx, float* pvy, float* pvz,
+	const float* pr, unsigned char* rest, StepStats& stats)
+{
+	int done = 0;
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	done = stepLanes<Lanes, true>(n, g, room, px, py, pz, pvx, pvy, pvz, pr, rest, &stats);
+#endif
+	stepScalar<true>(n - done, g, room, px + done, py + done, pz + done,
+		pvx + done, pvy + done, pvz + done, pr + done, rest + done, &stats);
+}
+
+int
+stepBallsWidth()
+{
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	return Lanes::width;
+#else
+	return 1;
+#endif
+}
+
+const char*
+stepBallsInstructions()
+{
+#if GLM_ARCH & GLM_ARCH_AVX2_BIT
+	return "AVX2";
+#elif GLM_ARCH & GLM_ARCH_SSE2_BIT
+	return "SSE2";
+#else
+	return "none";
+#endif
+}
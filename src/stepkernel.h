@@ -0,0 +1,39 @@
+#ifndef STEPKERNEL_H
+#define STEPKERNEL_H
+
+#include "monitor.h"
+#include "room.h"
+
+// The step of BallWorld: move balls [0, n) by their velocity, bounce them
+// off the room and stop them on the ground, the same as update() in
+// run.cpp. Balls with rest set stay where they are.
+// The arrays must not overlap.
+
+// Several balls per instruction with SSE2 or AVX2 intrinsics, whichever the
+// compiler targets (as detected by glm/simd/platform.h), and stepBallsScalar()
+// for the balls left over or when there is neither.
+void stepBalls(int n, float g, const Room& room,
+	float* px, float* py, float* pz,
+	float* pvx, float* pvy, float* pvz,
+	const float* pr, unsigned char* rest);
+
+// One ball at a time, written without branches so the compiler can still
+// vectorize it where it is able to
+void stepBallsScalar(int n, float g, const Room& room,
+	float* px, float* py, float* pz,
+	float* pvx, float* pvy, float* pvz,
+	const float* pr, unsigned char* rest);
+
+// stepBalls() that also adds the energy, momentum, penetration and bounces
+// of the balls after the step to stats. stepBalls() is the same code with
+// that part left out at compile time, so it costs nothing there.
+void stepBallsMonitored(int n, float g, const Room& room,
+	float* px, float* py, float* pz,
+	float* pvx, float* pvy, float* pvz,
+	const float* pr, unsigned char* rest, StepStats& stats);
+
+// Balls per instruction in stepBalls(), and the instruction set used
+int stepBallsWidth();
+const char* stepBallsInstructions();
+
+#endif // STEPKERNEL_H
@@ -0,0 +1,131 @@
+#include "sweepprune.h"
+#include "ballworld.h"
+
+#include <algorithm>
+
+SweepAndPrune::SweepAndPrune()
+	: swaps(0), allBalls(true)
+{
+}
+
+void
+SweepAndPrune::build(const BallWorld& world)
+{
+	const int n = world.size();
+
+	// Balls were added or removed, nothing to be coherent with
+	const bool fresh = !allBalls || int(entries.size()) != n;
+	if (fresh) {
+		entries.resize(n);
+		for (int i = 0; i < n; i++) {
+			entries[i].ball = i;
+		}
+	}
+	allBalls = true;
+	sortEntries(world, fresh);
+}
+
+void
+SweepAndPrune::build(const BallWorld& world, const std::vector<int>& balls)
+{
+	const int n = world.size();
+	const bool fresh = int(listed.size()) != n || (allBalls && int(entries.size()) != n);
+	if (fresh) {
+		entries.clear();
+		listed.assign(n, 0);
+	}
+	else if (allBalls) {
+		listed.assign(n, 1);
+	}
+	allBalls = false;
+
+	// listed goes to 3 for the balls that stay and to 2 for new ones
+	const int count = int(balls.size());
+	for (int k = 0; k < count; k++) {
+		listed[balls[k]] |= 2;
+	}
+	size_t kept = 0;
+	for (size_t k = 0; k < entries.size(); k++) {
+		unsigned char& state = listed[entries[k].ball];
+		if (state == 3) {
+			entries[kept++] = entries[k];
+		} else {
+			state = 0;
+		}
+	}
+	entries.resize(kept);
+	for (int k = 0; k < count; k++) {
+		const int i = balls[k];
+		if (listed[i] == 2) {
+			Entry e;
+			e.ball = i;
+			entries.push_back(e);
+		}
+		listed[i] = 1;
+	}
+	sortEntries(world, fresh);
+}
+
+void
+SweepAndPrune::sortEntries(const BallWorld& world, bool fresh)
+{
+	const int n = int(entries.size());
+	swaps = 0;
+
+	// Refresh the intervals in the order of the last step
+	for (int k = 0; k < n; k++) {
+		Entry& e = entries[k];
+		const int i = e.ball;
+		e.x = world.x[i];
+		e.y = world.y[i];
+		e.z = world.z[i];
+		e.radius = world.radius[i];
+		e.minX = e.x - e.radius;
+		e.maxX = e.x + e.radius;
+	}
+
+	// Insertion sort, cheap when the order barely changed. If the balls moved
+	// so far that it turns quadratic, give up and sort from scratch.
+	const long long maxSwaps = 8LL * n;
+	for (int k = 1; k < n && !fresh; k++) {
+		Entry e = entries[k];
+		int j = k;
+		while (j > 0 && entries[j - 1].minX > e.minX) {
+			entries[j] = entries[j - 1];
+			j--;
+		}
+		entries[j] = e;
+		swaps += k - j;
+		fresh = swaps > maxSwaps;
+	}
+
+	if (fresh) {
+		std::sort(entries.begin(), entries.end(),
+			[](const Entry& l, const Entry& r) { return l.minX < r.minX; });
+	}
+}
+
+void
+SweepAndPrune::findPairs(std::vector<BallPair>& pairs) const
+{
+	pairs.clear();
+	const int n = int(entries.size());
+
+	for (int k = 0; k < n; k++) {
+		const Entry& a = entries[k];
+
+		// everything after a that starts before a ends overlaps it along x
+		for (int j = k + 1; j < n && entries[j].minX <= a.maxX; j++) {
+			const Entry& b = entries[j];
+			const float dx = b.x - a.x;
+			const float dy = b.y - a.y;
+			const float dz = b.z - a.z;
+			const float reach = a.radius + b.radius;
+
+			if (dx * dx + dy * dy + dz * dz < reach * reach) {
+				BallPair pair = { std::min(a.ball, b.ball), std::max(a.ball, b.ball) };
+				pairs.push_back(pair);
+			}
+		}
+	}
+}
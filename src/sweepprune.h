@@ -0,0 +1,45 @@
+#ifndef SWEEPPRUNE_H
+#define SWEEPPRUNE_H
+
+#include "broadphase.h"
+
+#include <vector>
+
+// Sweep and prune along x.
+// The balls are kept sorted by the left end of their x interval from one
+// step to the next. Balls only move a little per step, so the order is
+// nearly right already and an insertion sort fixes it in close to O(n).
+// A sweep then only tests balls whose x intervals overlap.
+// Works best when balls are spread along x, e.g. not all stacked in a column.
+class SweepAndPrune : public Broadphase
+{
+public:
+	SweepAndPrune();
+
+	void build(const BallWorld& world);
+
+	// Balls no longer listed are dropped and new ones added at the end, so
+	// the order of the others is still kept for the insertion sort
+	void build(const BallWorld& world, const std::vector<int>& balls);
+	void findPairs(std::vector<BallPair>& pairs) const;
+
+	// Swaps made by the insertion sort in the last build
+	long long lastSwaps() const { return swaps; }
+
+private:
+	void sortEntries(const BallWorld& world, bool fresh);
+
+	struct Entry
+	{
+		float minX, maxX;
+		float x, y, z, radius;
+		int ball;
+	};
+
+	std::vector<Entry> entries; // sorted by minX
+	std::vector<unsigned char> listed; // by ball, has an entry
+	long long swaps;
+	bool allBalls; // entries has every ball, from the build() without a list
+};
+
+#endif // SWEEPPRUNE_H
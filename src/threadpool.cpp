@@ -0,0 +1,132 @@
+#include "threadpool.h"
+
+#include <algorithm>
+
+ThreadPool::ThreadPool(int threads)
+	: body(0), remaining(0), generation(0), stopping(false)
+{
+	if (threads <= 0) {
+		threads = std::max(1, int(std::thread::hardware_concurrency()));
+	}
+	for (int t = 0; t < threads; t++) {
+		queues.push_back(new Queue);
+	}
+	// queue 0 belongs to the thread calling parallelFor()
+	for (int t = 1; t < threads; t++) {
+		workers.push_back(std::thread(&ThreadPool::work, this, t));
+	}
+}
+
+ThreadPool::~ThreadPool()
+{
+	{
+		std::lock_guard<std::mutex> hold(wakeLock);
+		stopping = true;
+	}
+	wakeUp.notify_all();
+	for (size_t t = 0; t < workers.size(); t++) {
+		workers[t].join();
+	}
+	for (size_t t = 0; t < queues.size(); t++) {
+		delete queues[t];
+	}
+}
+
+void
+ThreadPool::parallelFor(int first, int last, int grain, const std::function<void(int, int)>& loopBody)
+{
+	if (first >= last) {
+		return;
+	}
+	grain = std::max(grain, 1);
+	const int chunks = (last - first + grain - 1) / grain;
+	const int threads = threadCount();
+
+	if (threads == 1 || chunks == 1) {
+		for (int begin = first; begin < last; begin += grain) {
+			loopBody(begin, std::min(begin + grain, last));
+		}
+		return;
+	}
+
+	body = &loopBody;
+	remaining = chunks;
+
+	// Deal out neighbouring chunks to the same thread
+	for (int t = 0; t < threads; t++) {
+		const int c0 = int(static_cast<long long>(chunks) * t / threads);
+		const int c1 = int(static_cast<long long>(chunks) * (t + 1) / threads);
+		std::lock_guard<std::mutex> hold(queues[t]->lock);
+		for (int c = c0; c < c1; c++) {
+			const int begin = first + c * grain;
+			Chunk chunk = { begin, std::min(begin + grain, last) };
+			queues[t]->chunks.push_back(chunk);
+		}
+	}
+	{
+		std::lock_guard<std::mutex> hold(wakeLock);
+		generation++;
+	}
+	wakeUp.notify_all();
+
+	while (remaining > 0) {
+		if (!runOne(0)) {
+			std::this_thread::yield();
+		}
+	}
+	body = 0;
+}
+
+// Run one chunk, from the own queue if possible, else stolen from another
+// thread. Returns false when every queue is empty.
+bool
+ThreadPool::runOne(int self)
+{
+	const int threads = threadCount();
+	Chunk chunk;
+	bool found = false;
+
+	for (int k = 0; k < threads && !found; k++) {
+		const int victim = (self + k) % threads;
+		Queue& queue = *queues[victim];
+		std::lock_guard<std::mutex> hold(queue.lock);
+		if (queue.chunks.empty()) {
+			continue;
+		}
+		if (victim == self) {
+			chunk = queue.chunks.front();
+			queue.chunks.pop_front();
+		} else {
+			chunk = queue.chunks.back();
+			queue.chunks.pop_back();
+		}
+		found = true;
+	}
+	if (!found) {
+		return false;
+	}
+
+	(*body)(chunk.begin, chunk.end);
+	remaining--;
+	return true;
+}
+
+void
+ThreadPool::work(int self)
+{
+	unsigned seen = 0;
+	for (;;) {
+		{
+			std::unique_lock<std::mutex> hold(wakeLock);
+			while (!stopping && generation == seen) {
+				wakeUp.wait(hold);
+			}
+			if (stopping) {
+				return;
+			}
+			seen = generation;
+		}
+		while (runOne(self)) {
+		}
+	}
+}
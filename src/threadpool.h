@@ -0,0 +1,63 @@
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// A fixed set of threads for running loops over index ranges.
+// A loop is cut into chunks that are dealt out to a queue per thread in
+// order. Every thread works through its own queue from the front and,
+// when it runs dry, steals from the back of the others, so chunks of
+// uneven cost still keep all threads busy until the loop is done.
+// The calling thread works too, so a pool of 1 runs everything in place.
+class ThreadPool
+{
+public:
+	// threads <= 0 uses one thread per hardware thread
+	explicit ThreadPool(int threads = 0);
+	~ThreadPool();
+
+	int threadCount() const { return int(queues.size()); }
+
+	// Calls body(begin, end) on chunks of [first, last) of at most grain
+	// indices, and returns when they are all done. Which thread runs a chunk
+	// and in what order is not fixed, so the chunks must not write to
+	// anything another chunk reads or writes.
+	void parallelFor(int first, int last, int grain, const std::function<void(int, int)>& body);
+
+private:
+	struct Chunk
+	{
+		int begin, end;
+	};
+
+	struct Queue
+	{
+		std::mutex lock;
+		std::deque<Chunk> chunks;
+	};
+
+	ThreadPool(const ThreadPool&);
+	ThreadPool& operator=(const ThreadPool&);
+
+	void work(int self);
+	bool runOne(int self);
+
+	std::vector<Queue*> queues;
+	std::vector<std::thread> workers;
+
+	const std::function<void(int, int)>* body;
+	std::atomic<int> remaining; // chunks of the current loop not finished yet
+
+	std::mutex wakeLock;
+	std::condition_variable wakeUp;
+	unsigned generation; // counts loops, so sleeping workers know a new one started
+	bool stopping;
+};
+
+#endif // THREADPOOL_H
@@ -0,0 +1,47 @@
+#include "trajectory.h"
+#include "ballworld.h"
+
+#include <algorithm>
+
+// Simulator for ball i alone, balls do not see each other in it anyway
+static BallWorld
+singleBall(const BallWorld& world, int i)
+{
+	BallWorld single;
+	single.gravity = world.gravity;
+	single.room = world.room;
+	single.addBall(world.position(i), world.velocity(i), world.radius[i]);
+	single.restFlag[0] = world.restFlag[i];
+	return single;
+}
+
+Trajectory::Trajectory(const BallWorld& world, int i)
+	: sim(singleBall(world, i)), gravity(world.gravity)
+{
+	impacts.push_back(sim.lastImpact(0));
+}
+
+void
+Trajectory::extendTo(double t) const
+{
+	while (!impacts.back().rest && impacts.back().time < t && sim.advanceToNextEvent()) {
+		impacts.push_back(sim.lastImpact(0));
+	}
+}
+
+static bool
+beforeImpact(double t, const BallState& s)
+{
+	return t < s.time;
+}
+
+BallState
+Trajectory::stateAt(double t) const
+{
+	t = std::max(t, 0.0);
+	extendTo(t);
+
+	// last impact at or before t
+	std::vector<BallState>::const_iterator it = std::upper_bound(impacts.begin(), impacts.end(), t, beforeImpact);
+	return flyTo(*(it - 1), t, gravity);
+}
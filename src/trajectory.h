@@ -0,0 +1,33 @@
+#ifndef TRAJECTORY_H
+#define TRAJECTORY_H
+
+#include "events.h"
+
+#include <vector>
+
+class BallWorld;
+
+// Random access to the path of one ball, e.g. for scrubbing a timeline.
+// Every impact is kept in a time ordered index, so the state at any time is
+// a binary search plus one parabola instead of a replay from the start.
+// Impacts are computed the first time a query goes past the last one known.
+class Trajectory
+{
+public:
+	// Path of ball i from the current state of world, which is time 0
+	Trajectory(const BallWorld& world, int i);
+
+	// Times before 0 give the start, times after the ball came to rest its resting state
+	BallState stateAt(double t) const;
+
+	int cachedImpacts() const { return int(impacts.size()) - 1; }
+
+private:
+	void extendTo(double t) const;
+
+	mutable EventSimulator sim;
+	mutable std::vector<BallState> impacts; // impacts[0] is the start
+	double gravity;
+};
+
+#endif // TRAJECTORY_H
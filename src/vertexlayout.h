@@ -0,0 +1,70 @@
+#ifndef VERTEXLAYOUT_H
+#define VERTEXLAYOUT_H
+
+#include <GL/glew.h>
+
+#include "meshes.h"
+
+// How a field of a vertex struct is read as a vertex attribute. There is one
+// for every type a vertex is made of.
+template <class T>
+struct AttributeFormat;
+
+template <>
+struct AttributeFormat<float[3]>
+{
+	static const GLint size = 3;
+	static const GLenum type = GL_FLOAT;
+	static const GLboolean normalized = GL_FALSE;
+};
+
+template <>
+struct AttributeFormat<PackedNormal>
+{
+	static const GLint size = 4;
+	static const GLenum type = GL_INT_2_10_10_10_REV;
+	static const GLboolean normalized = GL_TRUE;
+};
+
+// The attributes of a buffer of interleaved Vertex structs, taken from the
+// fields themselves, so the stride, offsets and formats follow the struct:
+//
+//	VertexLayout<PackedVertex>(shader)
+//		.attribute("vPosition", &PackedVertex::position)
+//		.attribute("vNormal", &PackedVertex::normal);
+//
+// Reads the array buffer bound at the time, from byte first of it.
+template <class Vertex>
+class VertexLayout
+{
+public:
+	explicit VertexLayout(GLuint shader, GLsizeiptr first = 0) : shader(shader), first(first) {}
+
+	template <class T>
+	VertexLayout&
+	attribute(const char* name, T Vertex::* field)
+	{
+		const GLint location = glGetAttribLocation(shader, name);
+		if (location < 0) {
+			return *this; // not used by the shader
+		}
+		glEnableVertexAttribArray(GLuint(location));
+		glVertexAttribPointer(GLuint(location), AttributeFormat<T>::size, AttributeFormat<T>::type,
+			AttributeFormat<T>::normalized, sizeof(Vertex), reinterpret_cast<const GLvoid*>(first + offsetOf(field)));
+		return *this;
+	}
+
+private:
+	template <class T>
+	static GLsizeiptr
+	offsetOf(T Vertex::* field)
+	{
+		static const Vertex vertex = Vertex();
+		return reinterpret_cast<const char*>(&(vertex.*field)) - reinterpret_cast<const char*>(&vertex);
+	}
+
+	GLuint shader;
+	GLsizeiptr first;
+};
+
+#endif // VERTEXLAYOUT_H
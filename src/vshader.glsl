@@ -17,15 +17,35 @@ uniform int wallIndex;
 uniform int sphereIndex;
 uniform int groundShadowIndex;
 
+// The sphere and the shadows are meshes of radius 1, scaled here to the ball
+uniform float SphereRadius;
+vec4 position;
+
 flat out vec4 f_colour;
 
+// Checkers of the ground and the wall worked out per fragment, from where
+// it is on the plane in tiles. The tiles whose row plus column has the
+// parity blackTiles are black; -1 draws the material of the vertex.
+uniform bool ProceduralCheckers;
+uniform float CheckerSize;
+uniform vec2 GroundChecker;
+uniform vec2 WallChecker;
+out vec2 checker;
+flat out int blackTiles;
+
+// The ball has its checkers worked out per fragment as well, from the point
+// of the sphere of radius 1, so every level of detail has the same tiles.
+// The tiles whose row plus column has the parity redTiles are red.
+out vec3 ballPoint;
+flat out int redTiles;
+
 // for lighting
 
 uniform bool UseLighting;
 uniform vec4 lightPositionTop;
 uniform vec4 lightPositionNear;
 
-in vec4 vNormal;
+in vec4 vNormal; // w is 1 on odd vertices of the tables, for the checkers
 out vec3 N, L, E;
 out vec3 N2, L2, E2;
 
@@ -39,7 +59,7 @@ void set(mat4 ViewModel, mat4 ViewModelInvTra){
 	if (UseLighting) {
 		/*** Blinn-Phong shader: ***/
 
-		vec3 pos = (ViewModel * vPosition).xyz;
+		vec3 pos = (ViewModel * position).xyz;
 
 		L = lightPositionTop.xyz - pos;
 		E = -pos;
@@ -50,7 +70,7 @@ void set(mat4 ViewModel, mat4 ViewModelInvTra){
 		E2 = -pos;
 		N2 = ( ViewModelInvTra*vec4(vNormal.x,vNormal.y,vNormal.z,0) ).xyz;
 	}
-	gl_Position = Projection * ViewCamera * ViewModel * vPosition;
+	gl_Position = Projection * ViewCamera * ViewModel * position;
 }
 
 
@@ -81,11 +101,29 @@ void black_rubber(){
 
 void main()
 {
-	if(gl_VertexID < groundIndex)
+	blackTiles = -1;
+	checker = vec2(0.0);
+	redTiles = -1;
+	ballPoint = vPosition.xyz;
+	position = vPosition;
+	// 1/3 for even vertices where GL reads 2 bit signed w as (2w + 1) / 3
+	bool oddVertex = vNormal.w > 0.5;
+	if (gl_VertexID >= wallIndex) {
+		position.xyz *= SphereRadius;
+	}
+
+	if(gl_VertexID < groundIndex && ProceduralCheckers)
+	{
+		set(ViewGround,ViewGroundInvTra);
+		black_rubber();
+		checker = (vPosition.xy - GroundChecker) / CheckerSize;
+		blackTiles = 0;
+	}
+	else if(gl_VertexID < groundIndex)
 	{ 
 		set(ViewGround,ViewGroundInvTra);
 	
-		if (gl_VertexID % 2 == 0 ) 
+		if (!oddVertex) 
 		{ 
 			black_rubber( ); 
 		} else 
@@ -93,11 +131,18 @@ void main()
 			white_rubber(); 
 		}
 	} 
+	else if(gl_VertexID < wallIndex && ProceduralCheckers)
+	{
+		set(ViewGround,ViewGroundInvTra);
+		white_rubber();
+		checker = (vPosition.xz - WallChecker) / CheckerSize;
+		blackTiles = 1;
+	}
 	else if(gl_VertexID < wallIndex)
 	{ 
 		set(ViewGround,ViewGroundInvTra);		
 		
-		if (gl_VertexID % 2 == 0 ) 
+		if (oddVertex) // the wall used to start at odd vertex 961
 		{ 
 			white_rubber(); 
 		} else 
@@ -108,14 +153,8 @@ void main()
 	else if(gl_VertexID < sphereIndex) 
 	{
 		set(ViewSphere,ViewSphereInvTra);
-
-		if (gl_VertexID % 2 == 0 ) 
-		{ 
-			white_rubber(); 
-		} else 
-		{ 
-			red_rubber(); 
-		}			
+		white_rubber();
+		redTiles = 1;
 	}
 	else if(gl_VertexID < groundShadowIndex) 
 	{
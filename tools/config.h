@@ -0,0 +1,119 @@
+#ifndef CONFIG_H
+#define CONFIG_H
+
+// Settings for the programs in this directory, read from a file of
+// "key = value" lines ('#' starts a comment) and from key=value arguments,
+// which win over the file.
+
+#include <glm/glm.hpp>
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+
+class Config
+{
+public:
+	// Returns false if the file cannot be read
+	bool
+	load(const std::string& path)
+	{
+		std::ifstream in(path.c_str());
+		if (!in) {
+			return false;
+		}
+		std::string line;
+		while (std::getline(in, line)) {
+			line = line.substr(0, line.find('#'));
+			parse(line);
+		}
+		return true;
+	}
+
+	// The first argument without '=' names a config file, the others set
+	// one key each. Returns false if the file cannot be read.
+	bool
+	parseArgs(int argc, char** argv)
+	{
+		for (int i = 1; i < argc; i++) {
+			std::string arg = argv[i];
+			if (arg.find('=') == std::string::npos) {
+				if (!load(arg)) {
+					fprintf(stderr, "cannot read %s\n", arg.c_str());
+					return false;
+				}
+			}
+		}
+		for (int i = 1; i < argc; i++) {
+			parse(argv[i]);
+		}
+		return true;
+	}
+
+	bool has(const std::string& key) const { return values.count(key) != 0; }
+
+	std::string
+	getString(const std::string& key, const std::string& fallback) const
+	{
+		std::map<std::string, std::string>::const_iterator it = values.find(key);
+		return it == values.end() ? fallback : it->second;
+	}
+
+	double
+	getDouble(const std::string& key, double fallback) const
+	{
+		return has(key) ? std::atof(getString(key, "").c_str()) : fallback;
+	}
+
+	float getFloat(const std::string& key, float fallback) const { return float(getDouble(key, fallback)); }
+	int getInt(const std::string& key, int fallback) const { return int(getDouble(key, fallback)); }
+
+	// count numbers separated by spaces, missing ones keep their value
+	void
+	getFloats(const std::string& key, float* out, int count) const
+	{
+		std::istringstream in(getString(key, ""));
+		for (int i = 0; i < count && in >> out[i]; i++) {
+		}
+	}
+
+	glm::vec3
+	getVec3(const std::string& key, const glm::vec3& fallback) const
+	{
+		glm::vec3 v = fallback;
+		getFloats(key, &v.x, 3);
+		return v;
+	}
+
+private:
+	void
+	parse(const std::string& line)
+	{
+		std::string::size_type eq = line.find('=');
+		if (eq == std::string::npos) {
+			return;
+		}
+		std::string key = trim(line.substr(0, eq));
+		if (!key.empty()) {
+			values[key] = trim(line.substr(eq + 1));
+		}
+	}
+
+	static std::string
+	trim(const std::string& s)
+	{
+		const char* space = " \t\r\n";
+		std::string::size_type begin = s.find_first_not_of(space);
+		if (begin == std::string::npos) {
+			return "";
+		}
+		return s.substr(begin, s.find_last_not_of(space) - begin + 1);
+	}
+
+	std::map<std::string, std::string> values;
+};
+
+#endif // CONFIG_H
@@ -0,0 +1,268 @@
+// Runs the physics for a number of steps without a window and reports how
+// fast it went and where everything ended up. The hash of the final state
+// changes with any bit of it, so two runs can be compared by one number.
+//
+// Usage: headless [config file] [key=value ...]
+//
+//   steps = 1000000         steps to run
+//   balls = 0               0 runs the ball of the window game, more runs a
+//                           BallWorld with that many random balls
+//
+// The game ball (defaults are the ones of the window):
+//   position = 0 1 -1       start position
+//   velocity = x y z        start velocity, the impulse on every axis by default
+//   gravity, impulse, radius, spin
+//   ground = -2             the room
+//   walls = -2 2 -2 1.9     left, right, far, near
+//
+// A BallWorld:
+//   radius = 0.02, seed = 1, collide = 0, restitution = 1, sleep = 0
+//   solver = 0              1 resolves contacts with the contact solver,
+//   iterations = 2          sweeps of it per step
+//   threads = 0             0 steps on the calling thread, more uses a pool
+//   monitor = file.csv      write the energy, momentum, penetration, bounces
+//                           and contacts of every step (see monitor.h)
+//
+// Snapshots, to stop a long run and carry on with it later:
+//   restore = file          start from a snapshot instead of the settings above,
+//                           a game or a world depending on what it holds
+//   snapshot = file         write a snapshot of the end state
+
+#include "ballworld.h"
+#include "config.h"
+#include "game.h"
+#include "snapshot.h"
+#include "threadpool.h"
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+
+static double
+nowSeconds()
+{
+	using namespace std::chrono;
+	return duration<double>(steady_clock::now().time_since_epoch()).count();
+}
+
+// FNV-1a of raw bytes, as hashState() does for the game
+static unsigned long long
+hashBytes(const void* data, size_t size, unsigned long long h = 14695981039346656037ull)
+{
+	const unsigned char* p = static_cast<const unsigned char*>(data);
+	for (size_t i = 0; i < size; i++) {
+		h = (h ^ p[i]) * 1099511628211ull;
+	}
+	return h;
+}
+
+static Room
+readRoom(const Config& config, Room room)
+{
+	room.ground = config.getFloat("ground", room.ground);
+	config.getFloats("walls", room.walls, 4);
+	return room;
+}
+
+static void
+report(int steps, double seconds)
+{
+	printf("steps       %d\n", steps);
+	printf("seconds     %.6f\n", seconds);
+	printf("steps/sec   %.6g\n", steps / seconds);
+	printf("ns/step     %.3f\n", seconds * 1e9 / steps);
+}
+
+static void
+printVec3(const char* name, const glm::vec3& v)
+{
+	printf("%-11s %.9g %.9g %.9g\n", name, v.x, v.y, v.z);
+}
+
+static bool
+writeSnapshot(const Config& config, const GameConstants& c, const GameState& s, unsigned steps,
+	const BallWorld* world)
+{
+	if (!config.has("snapshot")) {
+		return true;
+	}
+	const std::string path = config.getString("snapshot", "");
+	if (!saveSnapshot(path, c, s, steps, world)) {
+		fprintf(stderr, "cannot write %s\n", path.c_str());
+		return false;
+	}
+	return true;
+}
+
+static int
+runGame(const Config& config, int steps, const Snapshot* restore)
+{
+	GameConstants c = defaultConstants();
+	c.gravity = config.getFloat("gravity", c.gravity);
+	c.impulse = config.getFloat("impulse", c.impulse);
+	c.radius = config.getFloat("radius", c.radius);
+	c.spin = config.getFloat("spin", c.spin);
+	c.start = config.getVec3("position", c.start);
+	c.room = readRoom(config, c.room);
+
+	GameState s = startState(c);
+	s.velocity = config.getVec3("velocity", s.velocity);
+
+	unsigned stepCount = 0;
+	if (restore) {
+		restore->restoreGame(c, s, stepCount);
+	}
+
+	double start = nowSeconds();
+	for (int i = 0; i < steps; i++) {
+		stepGame(s, c);
+	}
+	double seconds = nowSeconds() - start;
+	if (!writeSnapshot(config, c, s, stepCount + steps, 0)) {
+		return 1;
+	}
+
+	report(steps, seconds);
+	printVec3("position", s.position);
+	printVec3("velocity", s.velocity);
+	printf("theta       %.9g\n", s.theta[1]);
+	printf("rest        %d\n", int(s.rest));
+
+	printf("hash        %016llx\n", hashState(s));
+	return 0;
+}
+
+static int
+runWorld(const Config& config, int steps, int n, const Snapshot* restore)
+{
+	BallWorld world;
+	world.room = readRoom(config, world.room);
+	world.collideBalls = config.getInt("collide", 0) != 0;
+	world.restitution = config.getFloat("restitution", world.restitution);
+	world.allowSleep = config.getInt("sleep", 0) != 0;
+	world.contactSolver = config.getInt("solver", 0) != 0 ? SequentialImpulses : PairwiseContacts;
+	world.solverIterations = config.getInt("iterations", world.solverIterations);
+
+	// Same spread as the benchmarks: anywhere in the room up to 4 above the
+	// ground, about as fast as the game ball
+	const float r = config.getFloat("radius", 0.02f);
+	const Room& room = world.room;
+	std::mt19937 rng(config.getInt("seed", 1));
+	std::uniform_real_distribution<float> px(room.walls[leftWall] + r, room.walls[rightWall] - r);
+	std::uniform_real_distribution<float> py(room.ground + r, room.ground + 4.0f);
+	std::uniform_real_distribution<float> pz(room.walls[farWall] + r, room.walls[nearWall] - r);
+	std::uniform_real_distribution<float> v(-0.03f, 0.03f);
+	GameConstants c = defaultConstants();
+	GameState s = startState(c);
+	unsigned stepCount = 0;
+	if (restore) {
+		double restoreStart = nowSeconds();
+		restore->restoreGame(c, s, stepCount);
+		restore->restoreWorld(world);
+		n = world.size();
+		printf("restore ms  %.3f\n", (nowSeconds() - restoreStart) * 1e3);
+	}
+	else {
+		world.reserve(n);
+		for (int i = 0; i < n; i++) {
+			world.addBall(glm::vec3(px(rng), py(rng), pz(rng)), glm::vec3(v(rng), v(rng), v(rng)), r);
+		}
+	}
+
+	const int threads = config.getInt("threads", 0);
+	ThreadPool* pool = threads > 0 ? new ThreadPool(threads) : 0;
+	world.threadPool = pool;
+
+	StepStats stats, first;
+	FILE* monitor = 0;
+	if (config.has("monitor")) {
+		const std::string path = config.getString("monitor", "");
+		monitor = fopen(path.c_str(), "w");
+		if (!monitor) {
+			fprintf(stderr, "cannot write %s\n", path.c_str());
+			delete pool;
+			return 1;
+		}
+		fprintf(monitor, "step,balls,kinetic,potential,energy,momentum_x,momentum_y,momentum_z,"
+			"penetration,max_penetration,bounces,contacts\n");
+		world.stats = &stats;
+	}
+
+	double start = nowSeconds();
+	for (int i = 0; i < steps; i++) {
+		world.step();
+		if (monitor) {
+			fprintf(monitor, "%u,%lld,%.9g,%.9g,%.9g,%.9g,%.9g,%.9g,%.9g,%.9g,%lld,%lld\n",
+				stepCount + i + 1, stats.balls, stats.kinetic, stats.potential, stats.energy(),
+				stats.momentum.x, stats.momentum.y, stats.momentum.z,
+				stats.penetration, stats.maxPenetration, stats.bounces, stats.contacts);
+			if (i == 0) {
+				first = stats;
+			}
+		}
+	}
+	double seconds = nowSeconds() - start;
+	delete pool;
+	if (monitor) {
+		fclose(monitor);
+	}
+	if (!writeSnapshot(config, c, s, stepCount + steps, &world)) {
+		return 1;
+	}
+
+	report(steps, seconds);
+	printf("balls       %d\n", n);
+	printf("ns/ball     %.3f\n", seconds * 1e9 / (double(steps) * n));
+	printf("awake       %d\n", world.awakeCount());
+
+	glm::dvec3 sum(0.0);
+	for (int i = 0; i < n; i++) {
+		sum += glm::dvec3(world.position(i));
+	}
+	printVec3("mean", glm::vec3(sum / double(n)));
+	if (monitor) {
+		printf("energy      %.9g after the first step, %.9g after the last\n", first.energy(), stats.energy());
+	}
+
+	const size_t bytes = n * sizeof(float);
+	unsigned long long h = hashBytes(world.x.data(), bytes);
+	h = hashBytes(world.y.data(), bytes, h);
+	h = hashBytes(world.z.data(), bytes, h);
+	h = hashBytes(world.vx.data(), bytes, h);
+	h = hashBytes(world.vy.data(), bytes, h);
+	h = hashBytes(world.vz.data(), bytes, h);
+	h = hashBytes(world.restFlag.data(), n, h);
+	printf("hash        %016llx\n", h);
+	return 0;
+}
+
+int
+main(int argc, char** argv)
+{
+	Config config;
+	if (!config.parseArgs(argc, argv)) {
+		return 1;
+	}
+
+	const int steps = config.getInt("steps", 1000000);
+	const int balls = config.getInt("balls", 0);
+	if (steps <= 0) {
+		fprintf(stderr, "steps must be positive\n");
+		return 1;
+	}
+
+	Snapshot snapshot;
+	const Snapshot* restore = 0;
+	if (config.has("restore")) {
+		const std::string path = config.getString("restore", "");
+		if (!snapshot.open(path)) {
+			fprintf(stderr, "%s is not a snapshot of this build\n", path.c_str());
+			return 1;
+		}
+		restore = &snapshot;
+	}
+	if (restore && restore->header().balls > 0) {
+		return runWorld(config, steps, 0, restore);
+	}
+	return balls > 0 && !restore ? runWorld(config, steps, balls, 0) : runGame(config, steps, restore);
+}
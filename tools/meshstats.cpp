@@ -0,0 +1,207 @@
+// Reports what the passes of meshopt.h do to the meshes of the window: the
+// vertices transformed per triangle (ACMR) and per vertex (ATVR) by a FIFO
+// post-transform cache, as generated, after the cache pass, and after the
+// overdraw pass, and the bytes of the indices as 32 and as 16 bits. Also
+// checks that the optimized mesh has the same triangles, each with the same
+// first vertex, and that bakedmeshes.h, which the window uploads, still
+// holds what the passes give. Then the level of detail of the ball that
+// display() picks at radii on the screen. No GL is needed.
+//
+// Usage: meshstats [config file] [key=value ...]
+//
+//   cache = 32              cache size to simulate, e.g. 16 for old GPUs
+//   repeats = 1000          times optimizeMesh() runs on each mesh to time it
+//   tolerance = 0.5         pixels the outline of the ball may be off by
+//   bake = file             write the meshes after the passes as bakedmeshes.h,
+//                           e.g. bake=../src/bakedmeshes.h after changing
+//                           meshes.h or meshopt.h
+
+#include "bakedmeshes.h"
+#include "config.h"
+#include "meshopt.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+struct NamedMesh
+{
+	std::string name;
+	MeshView mesh;
+};
+
+// The triangles as the bytes of their vertices, in order
+static std::vector<std::string>
+triangles(const PackedVertex* vertices, const unsigned* indices, int indexCount)
+{
+	std::vector<std::string> out;
+	for (int i = 0; i < indexCount; i += 3) {
+		std::string triangle(3 * sizeof(PackedVertex), '\0');
+		for (int k = 0; k < 3; k++) {
+			std::memcpy(&triangle[k * sizeof(PackedVertex)], &vertices[indices[i + k]], sizeof(PackedVertex));
+		}
+		out.push_back(triangle);
+	}
+	std::sort(out.begin(), out.end());
+	return out;
+}
+
+// Whether bakedmeshes.h holds mesh as baked mesh id
+static bool
+sameAsBaked(int id, const OptimizedMesh& mesh)
+{
+	const BakedMesh& baked = bakedMeshes[id];
+	return baked.vertexCount == int(mesh.vertices.size()) && baked.indexCount == int(mesh.indices.size())
+		&& std::memcmp(bakedVertices + baked.firstVertex, mesh.vertices.data(), sizeof(PackedVertex) * baked.vertexCount) == 0
+		&& std::equal(mesh.indices.begin(), mesh.indices.end(), bakedIndices + baked.firstIndex);
+}
+
+// Shortest text that reads back as the same float, as a float literal
+static std::string
+floatLiteral(float f)
+{
+	char text[32];
+	snprintf(text, sizeof(text), "%.9g", f);
+	std::string literal(text);
+	if (literal.find_first_of(".e") == std::string::npos) {
+		literal += ".0";
+	}
+	return literal + "f";
+}
+
+// Writes the meshes as bakedmeshes.h
+static bool
+writeBaked(const std::string& path, const std::vector<NamedMesh>& meshes, const std::vector<OptimizedMesh>& optimized)
+{
+	for (int m = 0; m < BAKED_MESHES; m++) {
+		if (optimized[m].vertices.size() > 65536) {
+			fprintf(stderr, "%s has too many vertices for 16 bit indices\n", meshes[m].name.c_str());
+			return false;
+		}
+	}
+	FILE* fp = fopen(path.c_str(), "w");
+	if (!fp) {
+		return false;
+	}
+	fprintf(fp, "// Generated by tools/meshstats with bake=file: the meshes of meshes.h after\n"
+		"// the passes of meshopt.h, in the order of BakedMeshId. Do not edit, bake\n"
+		"// them again after changing either, meshstats says when it is needed.\n\n"
+		"#ifndef BAKEDMESHES_H\n#define BAKEDMESHES_H\n\n#include \"meshes.h\"\n\n");
+
+	fprintf(fp, "static const BakedMesh bakedMeshes[BAKED_MESHES] = {\n");
+	int vertexCount = 0, indexCount = 0;
+	for (int m = 0; m < BAKED_MESHES; m++) {
+		const int vertices = int(optimized[m].vertices.size()), indices = int(optimized[m].indices.size());
+		fprintf(fp, "\t{ %d, %d, %d, %d }, // %s\n", vertexCount, vertices, indexCount, indices, meshes[m].name.c_str());
+		vertexCount += vertices;
+		indexCount += indices;
+	}
+	fprintf(fp, "};\n\n");
+
+	fprintf(fp, "static const PackedVertex bakedVertices[%d] = {\n", vertexCount);
+	for (int m = 0; m < BAKED_MESHES; m++) {
+		fprintf(fp, "\t// %s\n", meshes[m].name.c_str());
+		for (size_t v = 0; v < optimized[m].vertices.size(); v++) {
+			const PackedVertex& vertex = optimized[m].vertices[v];
+			fprintf(fp, "\t{ { %s, %s, %s }, { 0x%08xu } },\n", floatLiteral(vertex.position[0]).c_str(),
+				floatLiteral(vertex.position[1]).c_str(), floatLiteral(vertex.position[2]).c_str(), vertex.normal.bits);
+		}
+	}
+	fprintf(fp, "};\n\n");
+
+	fprintf(fp, "static const unsigned short bakedIndices[%d] = {\n", indexCount);
+	for (int m = 0; m < BAKED_MESHES; m++) {
+		fprintf(fp, "\t// %s\n", meshes[m].name.c_str());
+		const std::vector<unsigned>& indices = optimized[m].indices;
+		for (size_t i = 0; i < indices.size(); i++) {
+			fprintf(fp, "%s%u,%s", i % 16 == 0 ? "\t" : " ", indices[i], i % 16 == 15 || i + 1 == indices.size() ? "\n" : "");
+		}
+	}
+	fprintf(fp, "};\n\n#endif // BAKEDMESHES_H\n");
+	return fclose(fp) == 0;
+}
+
+int
+main(int argc, char** argv)
+{
+	Config config;
+	if (!config.parseArgs(argc, argv)) {
+		return 1;
+	}
+	const int cacheSize = config.getInt("cache", MESH_CACHE_SIZE);
+	const int repeats = config.getInt("repeats", 1000);
+	const float tolerance = float(config.getDouble("tolerance", SPHERE_LOD_TOLERANCE));
+
+	// In the order of BakedMeshId
+	MeshView lods[SPHERE_LODS];
+	sphereLods(lods);
+	std::vector<NamedMesh> meshes;
+	meshes.push_back(NamedMesh{ "ground quad", MeshTables<GroundQuad>::view() });
+	meshes.push_back(NamedMesh{ "wall quad", MeshTables<WallQuad>::view() });
+	meshes.push_back(NamedMesh{ "ground grid", MeshTables<GroundGrid>::view() });
+	meshes.push_back(NamedMesh{ "wall grid", MeshTables<WallGrid>::view() });
+	meshes.push_back(NamedMesh{ "ground shadow", MeshTables<GroundShadowMesh>::view() });
+	meshes.push_back(NamedMesh{ "wall shadow", MeshTables<WallShadowMesh>::view() });
+	for (int l = 0; l < SPHERE_LODS; l++) {
+		meshes.push_back(NamedMesh{ "ball level " + std::to_string(l), lods[l] });
+	}
+	const int meshCount = int(meshes.size());
+	std::vector<OptimizedMesh> optimized(meshCount);
+	bool same = true, baked = true;
+
+	printf("FIFO cache of %d vertices, ACMR / ATVR\n", cacheSize);
+	printf("%-14s %8s %9s %15s %15s %15s %14s %8s\n", "mesh", "vertices", "triangles",
+		"generated", "cache pass", "overdraw pass", "index bytes", "us");
+	for (int m = 0; m < meshCount; m++) {
+		const MeshView& mesh = meshes[m].mesh;
+		const VertexCacheStats before = analyzeVertexCache(mesh.indices, mesh.indexCount, mesh.vertexCount, cacheSize);
+
+		std::vector<unsigned> indices(mesh.indices, mesh.indices + mesh.indexCount);
+		optimizeVertexCache(indices.data(), mesh.indexCount, mesh.vertexCount);
+		const VertexCacheStats cached = analyzeVertexCache(indices.data(), mesh.indexCount, mesh.vertexCount, cacheSize);
+
+		optimized[m] = optimizeMesh(mesh);
+		const auto start = std::chrono::steady_clock::now();
+		for (int r = 0; r < repeats; r++) {
+			optimizeMesh(mesh);
+		}
+		const double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+		const int vertexCount = int(optimized[m].vertices.size());
+		const VertexCacheStats after = analyzeVertexCache(optimized[m].indices.data(), mesh.indexCount, vertexCount, cacheSize);
+
+		same = same && triangles(mesh.vertices, mesh.indices, mesh.indexCount)
+			== triangles(optimized[m].vertices.data(), optimized[m].indices.data(), mesh.indexCount);
+		baked = baked && sameAsBaked(m, optimized[m]);
+
+		const int indexSize = vertexCount <= 65536 ? 2 : 4;
+		printf("%-14s %8d %9d %7.3f / %5.3f %7.3f / %5.3f %7.3f / %5.3f %6d -> %-5d %8.1f\n", meshes[m].name.c_str(),
+			vertexCount, mesh.indexCount / 3, before.acmr, before.atvr, cached.acmr, cached.atvr,
+			after.acmr, after.atvr, 4 * mesh.indexCount, indexSize * mesh.indexCount, us / repeats);
+	}
+	printf("triangles %s\n", same ? "the same" : "DIFFER");
+
+	if (config.has("bake")) {
+		const std::string path = config.getString("bake", "");
+		if (!writeBaked(path, meshes, optimized)) {
+			fprintf(stderr, "cannot write %s\n", path.c_str());
+			return 1;
+		}
+		printf("baked into %s\n", path.c_str());
+	}
+	else {
+		printf("bakedmeshes.h %s\n", baked ? "up to date" : "OUT OF DATE, run meshstats bake=../src/bakedmeshes.h");
+	}
+
+	const int fixedTriangles = BallMesh::indexCount / 3;
+	printf("\nball with its outline off by at most %g pixels\n", tolerance);
+	printf("%-10s %6s %10s %10s\n", "radius px", "level", "triangles", "of fixed");
+	const float radii[] = { 2, 5, 10, 20, 50, 100, 200, 400, 800 };
+	for (size_t r = 0; r < sizeof(radii) / sizeof(radii[0]); r++) {
+		const int level = selectSphereLod(SPHERE_LOD_SAGITTA, SPHERE_LODS, radii[r], tolerance);
+		const int triangles = lods[level].indexCount / 3;
+		printf("%-10g %6d %10d %10.2f\n", radii[r], level, triangles, double(triangles) / fixedTriangles);
+	}
+	return same && (baked || config.has("bake")) ? 0 : 1;
+}
@@ -0,0 +1,112 @@
+// Plays back a game recorded with "-record file" in the window, as fast as
+// it can and without drawing, and checks that it ends in the recorded state.
+// Can also write a log from a script of keys, for long scripted sessions.
+//
+// Usage: replay [config file] [key=value ...]
+//
+//   log = game.blog         log to play back
+//   repeat = 1              play it this many times, for timing
+//
+//   record = game.blog      instead write a log of the default game
+//   steps = 216000          steps to run
+//   keys = 600:j 1200:a     keys to press, each after that many steps
+
+#include "config.h"
+#include "inputlog.h"
+
+#include <chrono>
+#include <cstdio>
+#include <sstream>
+
+static double
+nowSeconds()
+{
+	using namespace std::chrono;
+	return duration<double>(steady_clock::now().time_since_epoch()).count();
+}
+
+static void
+printState(const GameState& s)
+{
+	printf("position    %.9g %.9g %.9g\n", s.position.x, s.position.y, s.position.z);
+	printf("velocity    %.9g %.9g %.9g\n", s.velocity.x, s.velocity.y, s.velocity.z);
+	printf("theta       %.9g\n", s.theta[1]);
+	printf("rest        %d\n", int(s.rest));
+	printf("hash        %016llx\n", hashState(s));
+}
+
+static int
+writeScript(const Config& config)
+{
+	const std::string path = config.getString("record", "");
+	const int steps = config.getInt("steps", 216000);
+
+	InputLog log;
+	GameConstants c = defaultConstants();
+	GameState s = startState(c);
+	log.begin(c, s);
+
+	std::istringstream keys(config.getString("keys", ""));
+	std::string item;
+	while (keys >> item) {
+		unsigned step;
+		char key;
+		if (sscanf(item.c_str(), "%u:%c", &step, &key) != 2) {
+			fprintf(stderr, "bad key %s, expected step:key\n", item.c_str());
+			return 1;
+		}
+		if (!log.events.empty() && step < log.events.back().step) {
+			fprintf(stderr, "keys must be in step order\n");
+			return 1;
+		}
+		log.record(step, (unsigned char)key);
+	}
+
+	log.finish(steps, s);
+	log.finish(steps, replay(log));
+	if (!log.save(path)) {
+		fprintf(stderr, "cannot write %s\n", path.c_str());
+		return 1;
+	}
+	printf("wrote %s, %u steps, %d keys\n", path.c_str(), log.steps, int(log.events.size()));
+	printState(log.end);
+	return 0;
+}
+
+int
+main(int argc, char** argv)
+{
+	Config config;
+	if (!config.parseArgs(argc, argv)) {
+		return 1;
+	}
+	if (config.has("record")) {
+		return writeScript(config);
+	}
+
+	const std::string path = config.getString("log", "");
+	InputLog log;
+	if (!log.load(path)) {
+		fprintf(stderr, "cannot read %s as a game log\n", path.c_str());
+		return 1;
+	}
+
+	const int repeat = config.getInt("repeat", 1);
+	GameState end = log.start;
+	double start = nowSeconds();
+	for (int i = 0; i < repeat; i++) {
+		end = replay(log);
+	}
+	double seconds = nowSeconds() - start;
+	const double steps = double(log.steps) * repeat;
+
+	const bool same = hashState(end) == hashState(log.end);
+	printf("steps       %u x %d\n", log.steps, repeat);
+	printf("keys        %d\n", int(log.events.size()));
+	printf("seconds     %.6f\n", seconds);
+	printf("steps/sec   %.6g\n", steps / seconds);
+	printf("ns/step     %.3f\n", seconds * 1e9 / steps);
+	printState(end);
+	printf("end state   %s\n", same ? "same as recorded" : "DIFFERS from the recording");
+	return same ? 0 : 1;
+}
@@ -0,0 +1,267 @@
+// Runs the ball of the game for every combination of a set of settings,
+// spread over a thread pool, and writes what happened in each to a table.
+// No window is opened and nothing of GL is linked.
+//
+// Usage: sweep [config file] [key=value ...]
+//
+// Every setting below takes one value, a list "1 2 3", or a range
+// "first:last:count" of evenly spaced values. All combinations are run.
+//   g = 9.8, mass = 0.0002, velocity = 150
+//                           as in run.cpp: gravity is -mass * g, and the
+//                           ball starts with mass * velocity along every axis
+//   radius = 0.5
+//   ground = -2, left = -2, right = 2, far = -2, near = 1.9
+//
+//   steps = 216000          most steps a run takes if the ball keeps moving
+//   threads = 0             0 uses one thread per hardware thread
+//   out = sweep.csv         a file ending in .bin is written as binary
+//
+// One row per run: the settings, the step the ball came to rest (-1 if it
+// did not), the bounces off the ground and off the walls, and where it ended.
+//
+// Binary layout, little endian: "BSWP", u32 version 1, u32 columns, u32 rows,
+// the column names separated by commas and ended by '\n', then the rows as
+// f64 values.
+
+#include "config.h"
+#include "game.h"
+#include "threadpool.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <vector>
+
+enum { G, Mass, Velocity, Radius, Ground, Left, Right, Far, Near, NumSettings };
+
+static const char* settingNames[NumSettings] = {
+	"g", "mass", "velocity", "radius", "ground", "left", "right", "far", "near"
+};
+
+static const char* resultNames[] = {
+	"rest_step", "ground_bounces", "wall_bounces", "x", "y", "z"
+};
+enum { NumResults = sizeof(resultNames) / sizeof(resultNames[0]) };
+
+struct Run
+{
+	double settings[NumSettings];
+	double results[NumResults];
+};
+
+static double
+nowSeconds()
+{
+	using namespace std::chrono;
+	return duration<double>(steady_clock::now().time_since_epoch()).count();
+}
+
+// A value, a list of values or first:last:count. Returns false if it is
+// none of them.
+static bool
+parseValues(const std::string& text, std::vector<double>& values)
+{
+	values.clear();
+	std::istringstream in(text);
+	std::string item;
+	while (in >> item) {
+		double first, last;
+		int count;
+		char end;
+		if (sscanf(item.c_str(), "%lf:%lf:%d%c", &first, &last, &count, &end) == 3) {
+			if (count < 1) {
+				return false;
+			}
+			for (int i = 0; i < count; i++) {
+				values.push_back(count == 1 ? first : first + (last - first) * i / (count - 1));
+			}
+		}
+		else if (sscanf(item.c_str(), "%lf%c", &first, &end) == 1) {
+			values.push_back(first);
+		}
+		else {
+			return false;
+		}
+	}
+	return !values.empty();
+}
+
+// Run the game ball until it rests or the steps run out
+static void
+simulate(Run& run, int maxSteps)
+{
+	const double* v = run.settings;
+	GameConstants c = defaultConstants();
+	c.gravity = float(-v[Mass] * v[G]);
+	c.impulse = float(v[Mass] * v[Velocity]);
+	c.radius = float(v[Radius]);
+	c.room.ground = float(v[Ground]);
+	c.room.walls[leftWall] = float(v[Left]);
+	c.room.walls[rightWall] = float(v[Right]);
+	c.room.walls[farWall] = float(v[Far]);
+	c.room.walls[nearWall] = float(v[Near]);
+	GameState s = startState(c);
+
+	int restStep = -1, groundBounces = 0, wallBounces = 0;
+	for (int step = 0; step < maxSteps; step++) {
+		const glm::vec3 before = s.velocity;
+		stepGame(s, c);
+		if (s.rest) {
+			restStep = step + 1;
+			groundBounces++; // the last one stopped it
+			break;
+		}
+		// Gravity only pulls vy down, so it turning up is the ground.
+		// Only the walls turn vx and vz around.
+		groundBounces += before.y < 0 && s.velocity.y > 0;
+		wallBounces += (before.x < 0) != (s.velocity.x < 0);
+		wallBounces += (before.z < 0) != (s.velocity.z < 0);
+	}
+
+	double* r = run.results;
+	r[0] = restStep;
+	r[1] = groundBounces;
+	r[2] = wallBounces;
+	r[3] = s.position.x;
+	r[4] = s.position.y;
+	r[5] = s.position.z;
+}
+
+static std::string
+header()
+{
+	std::string names;
+	for (int k = 0; k < NumSettings; k++) {
+		names += settingNames[k];
+		names += ',';
+	}
+	for (int k = 0; k < NumResults; k++) {
+		names += resultNames[k];
+		names += k + 1 < NumResults ? ',' : '\n';
+	}
+	return names;
+}
+
+static bool
+writeCsv(const std::string& path, const std::vector<Run>& runs)
+{
+	FILE* fp = fopen(path.c_str(), "w");
+	if (!fp) {
+		return false;
+	}
+	fputs(header().c_str(), fp);
+	for (size_t i = 0; i < runs.size(); i++) {
+		for (int k = 0; k < NumSettings; k++) {
+			fprintf(fp, "%.9g,", runs[i].settings[k]);
+		}
+		for (int k = 0; k < NumResults; k++) {
+			fprintf(fp, k + 1 < NumResults ? "%.9g," : "%.9g\n", runs[i].results[k]);
+		}
+	}
+	return fclose(fp) == 0;
+}
+
+static void
+putU32(FILE* fp, unsigned v)
+{
+	const unsigned char b[4] = { (unsigned char)v, (unsigned char)(v >> 8), (unsigned char)(v >> 16), (unsigned char)(v >> 24) };
+	fwrite(b, 1, 4, fp);
+}
+
+static void
+putF64(FILE* fp, double d)
+{
+	unsigned long long v;
+	std::memcpy(&v, &d, sizeof(v));
+	putU32(fp, unsigned(v));
+	putU32(fp, unsigned(v >> 32));
+}
+
+static bool
+writeBinary(const std::string& path, const std::vector<Run>& runs)
+{
+	FILE* fp = fopen(path.c_str(), "wb");
+	if (!fp) {
+		return false;
+	}
+	fwrite("BSWP", 1, 4, fp);
+	putU32(fp, 1);
+	putU32(fp, NumSettings + NumResults);
+	putU32(fp, unsigned(runs.size()));
+	const std::string names = header();
+	fwrite(names.data(), 1, names.size(), fp);
+	for (size_t i = 0; i < runs.size(); i++) {
+		for (int k = 0; k < NumSettings; k++) {
+			putF64(fp, runs[i].settings[k]);
+		}
+		for (int k = 0; k < NumResults; k++) {
+			putF64(fp, runs[i].results[k]);
+		}
+	}
+	bool ok = !ferror(fp);
+	return fclose(fp) == 0 && ok;
+}
+
+int
+main(int argc, char** argv)
+{
+	Config config;
+	if (!config.parseArgs(argc, argv)) {
+		return 1;
+	}
+
+	const GameConstants c = defaultConstants();
+	const double defaults[NumSettings] = {
+		9.8, 0.0002, 150, c.radius,
+		c.room.ground, c.room.walls[leftWall], c.room.walls[rightWall], c.room.walls[farWall], c.room.walls[nearWall]
+	};
+
+	std::vector<double> values[NumSettings];
+	size_t combinations = 1;
+	for (int k = 0; k < NumSettings; k++) {
+		if (!config.has(settingNames[k])) {
+			values[k].assign(1, defaults[k]);
+		}
+		else if (!parseValues(config.getString(settingNames[k], ""), values[k])) {
+			fprintf(stderr, "bad %s, expected values or first:last:count\n", settingNames[k]);
+			return 1;
+		}
+		combinations *= values[k].size();
+	}
+
+	// Every combination, the first setting changing slowest
+	std::vector<Run> runs(combinations);
+	for (size_t i = 0; i < combinations; i++) {
+		size_t rest = i;
+		for (int k = NumSettings - 1; k >= 0; k--) {
+			runs[i].settings[k] = values[k][rest % values[k].size()];
+			rest /= values[k].size();
+		}
+	}
+
+	const int steps = config.getInt("steps", 216000);
+	ThreadPool pool(config.getInt("threads", 0));
+	double start = nowSeconds();
+	pool.parallelFor(0, int(runs.size()), 1, [&](int begin, int end) {
+		for (int i = begin; i < end; i++) {
+			simulate(runs[i], steps);
+		}
+	});
+	double seconds = nowSeconds() - start;
+
+	const std::string path = config.getString("out", "sweep.csv");
+	const bool binary = path.size() >= 4 && path.compare(path.size() - 4, 4, ".bin") == 0;
+	if (!(binary ? writeBinary(path, runs) : writeCsv(path, runs))) {
+		fprintf(stderr, "cannot write %s\n", path.c_str());
+		return 1;
+	}
+
+	printf("runs        %d\n", int(runs.size()));
+	printf("threads     %d\n", pool.threadCount());
+	printf("seconds     %.6f\n", seconds);
+	printf("runs/sec    %.6g\n", runs.size() / seconds);
+	printf("wrote       %s\n", path.c_str());
+	return 0;
+}